@@ -11,6 +11,7 @@ option(BUILD_AHBOT                          "Build Auction House Bot mod"
 option(BUILD_METRICS                        "Build Metrics, generate data for Grafana"  OFF)
 option(BUILD_RECASTDEMOMOD                  "Build map/vmap/mmap viewer"                OFF)
 option(BUILD_GIT_ID                         "Build git_id"                              OFF)
+option(BUILD_BENCHMARKS                     "Build mangos-bench micro-benchmark suite"  OFF)
 option(BUILD_DOCS                           "Build documentation with doxygen"          OFF)
 option(CMAKE_INTERPROCEDURAL_OPTIMIZATION   "Enable link-time optimizations"            OFF)
 option(BUILD_DEPRECATED_PLAYERBOT           "Build previous version of Playerbot mod"   OFF)
@@ -39,6 +40,7 @@ message(STATUS
     BUILD_METRICS           Build Metrics, generate data for Grafana
     BUILD_RECASTDEMOMOD     Build map/vmap/mmap viewer
     BUILD_GIT_ID            Build git_id
+    BUILD_BENCHMARKS        Build mangos-bench micro-benchmark suite
     BUILD_DOCS              Build documentation with doxygen
     CMAKE_INTERPROCEDURAL_OPTIMIZATION Enable link-time optimizations
     BUILD_DEPRECATED_PLAYERBOT         Build Playerbot mod (deprecated)
@@ -21,7 +21,7 @@
 
 DROP TABLE IF EXISTS `character_db_version`;
 CREATE TABLE `character_db_version` (
-  `required_z2819_01_characters_item_instance_text_id_fix` bit(1) DEFAULT NULL
+  `required_z2820_01_characters_aura_blob` bit(1) DEFAULT NULL
 ) ENGINE=MyISAM DEFAULT CHARSET=utf8 ROW_FORMAT=DYNAMIC COMMENT='Last applied sql update to DB';
 
 --
@@ -212,6 +212,27 @@ LOCK TABLES `character_aura` WRITE;
 /*!40000 ALTER TABLE `character_aura` ENABLE KEYS */;
 UNLOCK TABLES;
 
+--
+-- Table structure for table `character_aura_blob`
+--
+
+DROP TABLE IF EXISTS `character_aura_blob`;
+CREATE TABLE `character_aura_blob` (
+  `guid` int(11) unsigned NOT NULL DEFAULT '0' COMMENT 'Global Unique Identifier',
+  `version` int(11) unsigned NOT NULL DEFAULT '0',
+  `data` longtext,
+  PRIMARY KEY (`guid`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8 ROW_FORMAT=DYNAMIC COMMENT='Player System';
+
+--
+-- Dumping data for table `character_aura_blob`
+--
+
+LOCK TABLES `character_aura_blob` WRITE;
+/*!40000 ALTER TABLE `character_aura_blob` DISABLE KEYS */;
+/*!40000 ALTER TABLE `character_aura_blob` ENABLE KEYS */;
+UNLOCK TABLES;
+
 --
 -- Table structure for table `character_battleground_data`
 --
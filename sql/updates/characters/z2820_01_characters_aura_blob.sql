@@ -0,0 +1,10 @@
+ALTER TABLE character_db_version CHANGE COLUMN required_z2819_01_characters_item_instance_text_id_fix required_z2820_01_characters_aura_blob bit;
+
+-- packed per-character aura snapshot written next to character_aura;
+-- parsed at login instead of the aura rows when the version matches
+CREATE TABLE `character_aura_blob` (
+  `guid` int(11) unsigned NOT NULL DEFAULT '0' COMMENT 'Global Unique Identifier',
+  `version` int(11) unsigned NOT NULL DEFAULT '0',
+  `data` longtext,
+  PRIMARY KEY (`guid`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8 ROW_FORMAT=DYNAMIC COMMENT='Player System';
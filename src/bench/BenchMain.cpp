@@ -0,0 +1,260 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * mangos-bench: reproducible micro-benchmarks for the core's hot paths,
+ * built on the ChronoTimeTracker from Util/CodeBench.h. All random input
+ * is generated from fixed seeds so two runs on the same machine measure
+ * the same work - diff the ns/op numbers between releases to catch
+ * regressions before they show up on live.
+ *
+ * Usage:
+ *   mangos-bench                        - run the self-contained benchmarks
+ *   mangos-bench <dataDir> <mapId> \
+ *     <x1> <y1> <z1> <x2> <y2> <z2>     - additionally run the pathfinding
+ *                                         benchmark against the mmap tiles of
+ *                                         <dataDir>/mmaps (same data dir the
+ *                                         server uses), pathing between the
+ *                                         two given points
+ *
+ * Benchmarks needing a live world (ThreatManager::selectNextVictim,
+ * Object::BuildValuesUpdate on real units) cannot run standalone; for those
+ * this suite measures the data-structure inner loops they spend their time
+ * in (update-mask serialization, ByteBuffer packing).
+ */
+
+#include "Common.h"
+#include "Util/CodeBench.h"
+#include "Util/ByteBuffer.h"
+#include "Entities/ObjectGuid.h"
+#include "Entities/UpdateMask.h"
+#include "Entities/UpdateFields.h"
+#include "MotionGenerators/MoveMap.h"
+#include "MotionGenerators/MoveMapSharedDefines.h"
+#include "MotionGenerators/PathFinder.h"
+#include "BIH.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // fixed seed - identical input on every run
+    uint32 const BENCH_SEED = 0x5EED;
+
+    void ReportResult(char const* name, uint32 iterations, std::chrono::nanoseconds elapsed)
+    {
+        printf("%-32s %10u iterations %12.1f ns/op\n", name, iterations, double(elapsed.count()) / iterations);
+    }
+
+    // === ByteBuffer packing ================================================
+
+    // builds the payload of a typical movement broadcast over and over -
+    // the single most executed serialization pattern on a busy realm
+    void BenchByteBufferPack()
+    {
+        uint32 const iterations = 200000;
+
+        ChronoTimeTracker tracker("ByteBuffer.pack");
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            ByteBuffer buf;
+            buf.appendPackGUID(uint64(0xF130000000000000ull | i));
+            buf << uint32(i);                   // movement flags
+            buf << uint32(i * 17);              // timestamp
+            buf << float(i % 1000) << float(i % 2000) << float(i % 100) << float(0.5f);
+            buf << uint32(0);                   // fall time
+        }
+        ReportResult("ByteBuffer.pack", iterations, tracker.elapsedNanos());
+    }
+
+    void BenchByteBufferUnpack()
+    {
+        uint32 const iterations = 200000;
+
+        ByteBuffer source;
+        source.appendPackGUID(0xF130000000001234ull);
+        source << uint32(0x12345678) << uint32(0x9ABCDEF0);
+        source << float(1.0f) << float(2.0f) << float(3.0f) << float(4.0f);
+        source << uint32(0);
+
+        ChronoTimeTracker tracker("ByteBuffer.unpack");
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            ByteBuffer buf(source);
+            ObjectGuid guid;
+            uint32 flags, time, fallTime;
+            float x, y, z, o;
+            buf >> guid.ReadAsPacked() >> flags >> time >> x >> y >> z >> o >> fallTime;
+        }
+        ReportResult("ByteBuffer.unpack", iterations, tracker.elapsedNanos());
+    }
+
+    // === update-mask value serialization ===================================
+
+    // the inner loop of Object::BuildValuesUpdate: walk a player-sized
+    // update mask and append every dirty value. Uses a fixed dirty-bit
+    // pattern of roughly the density of a combat update
+    void BenchUpdateMaskSerialize()
+    {
+        uint32 const iterations = 20000;
+        uint32 const valuesCount = PLAYER_END;
+
+        UpdateMask updateMask;
+        updateMask.SetCount(valuesCount);
+        for (uint32 index = 0; index < valuesCount; index += 7)
+            updateMask.SetBit(index);
+
+        std::vector<uint32> values(valuesCount);
+        for (uint32 index = 0; index < valuesCount; ++index)
+            values[index] = index * 2654435761u;
+
+        ChronoTimeTracker tracker("UpdateMask.serialize");
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            ByteBuffer buf(512);
+            buf << uint8(updateMask.GetBlockCount());
+            buf.append(updateMask.GetMask(), updateMask.GetLength());
+            for (uint32 index = 0; index < valuesCount; ++index)
+                if (updateMask.GetBit(index))
+                    buf << values[index];
+        }
+        ReportResult("UpdateMask.serialize", iterations, tracker.elapsedNanos());
+    }
+
+    // === BIH ray intersection ==============================================
+
+    struct BoxBoundsFunc
+    {
+        void operator()(G3D::AABox const& box, G3D::AABox& out) const { out = box; }
+    };
+
+    struct CountingRayCallback
+    {
+        uint32 hits = 0;
+        bool operator()(G3D::Ray const& /*ray*/, uint32 /*entry*/, float& /*maxDist*/, bool /*stopAtFirst*/, bool /*ignoreM2Model*/)
+        {
+            ++hits;
+            return false;
+        }
+    };
+
+    void BenchBIHIntersectRay()
+    {
+        uint32 const boxCount = 10000;
+        uint32 const iterations = 100000;
+
+        std::mt19937 rng(BENCH_SEED);
+        std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+        std::uniform_real_distribution<float> extent(1.0f, 10.0f);
+
+        std::vector<G3D::AABox> boxes;
+        boxes.reserve(boxCount);
+        for (uint32 i = 0; i < boxCount; ++i)
+        {
+            G3D::Vector3 low(position(rng), position(rng), position(rng));
+            G3D::Vector3 size(extent(rng), extent(rng), extent(rng));
+            boxes.push_back(G3D::AABox(low, low + size));
+        }
+
+        BIH tree;
+        BoxBoundsFunc bounds;
+        {
+            ChronoTimeTracker buildTracker("BIH.build");
+            tree.build(boxes, bounds);
+            ReportResult("BIH.build", 1, buildTracker.elapsedNanos());
+        }
+
+        std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+        CountingRayCallback callback;
+
+        ChronoTimeTracker tracker("BIH.intersectRay");
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            G3D::Vector3 origin(position(rng), position(rng), position(rng));
+            G3D::Vector3 dir(direction(rng), direction(rng), direction(rng));
+            if (dir.squaredMagnitude() < 0.01f)
+                dir = G3D::Vector3(1.0f, 0.0f, 0.0f);
+            dir = dir.unit();
+
+            float maxDist = 500.0f;
+            tree.intersectRay(G3D::Ray::fromOriginAndDirection(origin, dir), callback, maxDist);
+        }
+        ReportResult("BIH.intersectRay", iterations, tracker.elapsedNanos());
+        printf("%-32s %u hits (checksum)\n", "", callback.hits);
+    }
+
+    // === pathfinding against real mmap tiles ===============================
+
+    void BenchCalculatePath(char const* dataDir, uint32 mapId, G3D::Vector3 const& start, G3D::Vector3 const& end)
+    {
+        uint32 const iterations = 1000;
+
+        std::string basePath(dataDir);
+        if (!basePath.empty() && basePath.back() != '/')
+            basePath += '/';
+
+        MMAP::MMapManager* manager = MMAP::MMapFactory::createOrGetMMapManager();
+        if (!manager->loadMapInstance(basePath, mapId, 0))
+        {
+            printf("PathFinder.calculatePath: failed to load mmap data for map %u from %smmaps\n", mapId, basePath.c_str());
+            return;
+        }
+        manager->loadAllMapTiles(basePath, mapId);
+        printf("PathFinder.calculatePath: map %u, %u tiles loaded\n", mapId, manager->getLoadedTilesCount());
+
+        dtNavMeshQuery const* query = manager->GetNavMeshQuery(mapId, 0);
+        if (!query)
+        {
+            printf("PathFinder.calculatePath: no navmesh query for map %u\n", mapId);
+            return;
+        }
+
+        PathFinder path(mapId, query, NAV_GROUND | NAV_WATER, NAV_EMPTY);
+
+        ChronoTimeTracker tracker("PathFinder.calculatePath");
+        for (uint32 i = 0; i < iterations; ++i)
+            path.calculate(start, end);
+        ReportResult("PathFinder.calculatePath", iterations, tracker.elapsedNanos());
+        printf("%-32s type %u, %u points\n", "", uint32(path.getPathType()), uint32(path.getPath().size()));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    printf("mangos-bench: fixed-seed micro-benchmarks, compare ns/op between builds\n\n");
+
+    BenchByteBufferPack();
+    BenchByteBufferUnpack();
+    BenchUpdateMaskSerialize();
+    BenchBIHIntersectRay();
+
+    if (argc == 9)
+    {
+        uint32 const mapId = atoi(argv[2]);
+        G3D::Vector3 const start(atof(argv[3]), atof(argv[4]), atof(argv[5]));
+        G3D::Vector3 const end(atof(argv[6]), atof(argv[7]), atof(argv[8]));
+        BenchCalculatePath(argv[1], mapId, start, end);
+    }
+    else
+        printf("\nPathFinder.calculatePath skipped - pass <dataDir> <mapId> <x1> <y1> <z1> <x2> <y2> <z2> to run it\n");
+
+    return 0;
+}
@@ -70,7 +70,8 @@ typedef enum
     GRID_STATE_ACTIVE = 1,
     GRID_STATE_IDLE = 2,
     GRID_STATE_REMOVAL = 3,
-    MAX_GRID_STATE = 4
+    GRID_STATE_UNLOADING = 4,                               // objects are being destroyed in bounded slices across ticks
+    MAX_GRID_STATE = 5
 } grid_state_t;
 
 template
@@ -20,7 +20,6 @@
 
 EventProcessor::EventProcessor()
 {
-    m_time = 0;
     m_aborting = false;
 }
 
@@ -31,31 +30,24 @@ EventProcessor::~EventProcessor()
 
 void EventProcessor::Update(uint32 p_time)
 {
-    // update time
-    m_time += p_time;
-
-    // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    // main event loop - the wheel unlinks each expired event before its
+    // handler runs, so an event re-adding itself goes through AddEvent as before
+    m_events.Advance(m_events.GetTime() + p_time, [&](BasicEvent* event)
     {
-        // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
-
-        if (!Event->to_Abort)
+        if (!event->to_Abort)
         {
-            if (Event->Execute(m_time, p_time))
+            if (event->Execute(m_events.GetTime(), p_time))
             {
                 // completely destroy event if it is not re-added
-                delete Event;
+                delete event;
             }
         }
         else
         {
-            Event->Abort(m_time);
-            delete Event;
+            event->Abort(m_events.GetTime());
+            delete event;
         }
-    }
+    });
 }
 
 void EventProcessor::KillAllEvents(bool force)
@@ -64,64 +56,48 @@ void EventProcessor::KillAllEvents(bool force)
     m_aborting = true;
 
     // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
+    m_events.Visit([&](BasicEvent* event)
     {
-        EventList::iterator i_old = i;
-        ++i;
-
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
-        {
-            delete i_old->second;
-
-            if (!force)                                     // need per-element cleanup
-                m_events.erase(i_old);
-        }
-    }
-
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
+        event->to_Abort = true;
+        event->Abort(m_events.GetTime());
+    });
+
+    // then delete them; if not forced, non-deletable events (need per-element
+    // cleanup) stay scheduled and are destroyed when their time comes
+    m_events.RemoveIf(
+        [force](BasicEvent* event) { return force || event->IsDeletable(); },
+        [](BasicEvent* event) { delete event; });
 }
 
 void EventProcessor::KillEvent(BasicEvent* event)
 {
-    for (EventList::iterator iter = m_events.begin(); iter != m_events.end();)
-    {
-        if (iter->second == event)
-        {
-            delete iter->second;
-            iter = m_events.erase(iter);
-        }
-        else ++iter;
-    }
+    m_events.RemoveIf(
+        [event](BasicEvent* other) { return other == event; },
+        [](BasicEvent* other) { delete other; });
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
 {
     if (set_addtime)
-        Event->m_addTime = m_time;
+        Event->m_addTime = m_events.GetTime();
 
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    m_events.Insert(Event, e_time);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* Event, uint64 msTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
+    // unlink without destroying, then reschedule at the new time
+    if (m_events.RemoveIf(
+            [Event](BasicEvent* other) { return other == Event; },
+            [](BasicEvent* /*other*/) {}))
     {
-        if (itr->second != Event)
-            continue;
-
         Event->m_execTime = msTime;
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(msTime, Event));
-        break;
+        m_events.Insert(Event, msTime);
     }
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
 {
-    return m_time + t_offset;
+    return m_events.GetTime() + t_offset;
 }
@@ -20,8 +20,7 @@
 #define __EVENTPROCESSOR_H
 
 #include "Platform/Define.h"
-
-#include <map>
+#include "Utilities/TimerWheel.h"
 
 // Note. All times are in milliseconds here.
 
@@ -55,8 +54,6 @@ class BasicEvent
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
-
 class EventProcessor
 {
     public:
@@ -70,12 +67,16 @@ class EventProcessor
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true);
         void ModifyEventTime(BasicEvent* event, uint64 msTime);
         uint64 CalculateTime(uint64 t_offset) const;
-        EventList& GetEvents() { return m_events; }
+
+        bool HasEvents() const { return !m_events.IsEmpty(); }
+
+        // invokes visitor(BasicEvent*) for every pending event, in no particular order
+        template <typename Visitor>
+        void VisitEvents(Visitor&& visitor) { m_events.Visit(visitor); }
 
     protected:
 
-        uint64 m_time;
-        EventList m_events;
+        TimerWheel<BasicEvent*> m_events;
         bool m_aborting;
 };
 
@@ -0,0 +1,207 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_H_TIMERWHEEL
+#define MANGOS_H_TIMERWHEEL
+
+#include "Platform/Define.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+/**
+ * Hierarchical timing wheel with O(1) insertion and amortized O(1) expiry.
+ *
+ * Six levels of 64 slots cover a horizon of 2^36 ticks (~2 years at one
+ * millisecond per tick). An item is hashed into the slot of the coarsest
+ * level its remaining delay fits and cascades down one level each time a
+ * finer wheel completes a rotation, so nothing is compared or rebalanced
+ * while an item waits - the multimap this replaces paid a tree rebalance
+ * per insert and per expiry.
+ *
+ * Levels are allocated on first use: an idle wheel (the common case for
+ * the per-unit event processors) owns no slot storage at all, and
+ * Advance() on an empty wheel is a plain assignment.
+ *
+ * Not thread safe - same ownership rules as the containers it replaces.
+ */
+template <typename T>
+class TimerWheel
+{
+    public:
+        static uint32 const SLOT_BITS = 6;
+        static uint32 const SLOTS = 1 << SLOT_BITS;         // 64
+        static uint32 const LEVELS = 6;
+        static uint64 const HORIZON = uint64(1) << (SLOT_BITS * LEVELS);
+
+        TimerWheel() : m_time(0), m_count(0) {}
+
+        uint64 GetTime() const { return m_time; }
+        void SetTime(uint64 time) { m_time = time; }        // only valid while empty
+        size_t GetCount() const { return m_count; }
+        bool IsEmpty() const { return m_count == 0; }
+
+        // schedules item at absolute time expireTime; times at or before the
+        // current time fire on the next tick, times beyond the horizon are clamped
+        void Insert(T item, uint64 expireTime)
+        {
+            if (expireTime <= m_time)
+                expireTime = m_time + 1;
+            else if (expireTime - m_time >= HORIZON)
+                expireTime = m_time + HORIZON - 1;
+
+            SlotFor(expireTime).push_back(Entry{ item, expireTime });
+            ++m_count;
+        }
+
+        // advances the wheel to newTime, invoking handler(item) for everything
+        // that expires on the way, in time order; handler may Insert()
+        template <typename Handler>
+        void Advance(uint64 newTime, Handler&& handler)
+        {
+            while (m_time < newTime)
+            {
+                if (!m_count)
+                {
+                    m_time = newTime;
+                    return;
+                }
+                Tick(handler);
+            }
+        }
+
+        // invokes visitor(item) for every scheduled item, in no particular order
+        template <typename Visitor>
+        void Visit(Visitor&& visitor)
+        {
+            for (auto& level : m_levels)
+            {
+                if (!level)
+                    continue;
+                for (auto& slot : *level)
+                    for (Entry& entry : slot)
+                        visitor(entry.item);
+            }
+        }
+
+        // removes every item for which pred(item) holds, invoking onRemove(item)
+        // for each before unlinking it; returns the number removed
+        template <typename Pred, typename OnRemove>
+        size_t RemoveIf(Pred&& pred, OnRemove&& onRemove)
+        {
+            size_t removed = 0;
+            for (auto& level : m_levels)
+            {
+                if (!level)
+                    continue;
+                for (auto& slot : *level)
+                {
+                    for (size_t i = 0; i < slot.size();)
+                    {
+                        if (pred(slot[i].item))
+                        {
+                            onRemove(slot[i].item);
+                            slot.erase(slot.begin() + i);
+                            --m_count;
+                            ++removed;
+                        }
+                        else
+                            ++i;
+                    }
+                }
+            }
+            return removed;
+        }
+
+        void Clear()
+        {
+            for (auto& level : m_levels)
+                if (level)
+                    for (auto& slot : *level)
+                        slot.clear();
+            m_count = 0;
+        }
+
+    private:
+        struct Entry
+        {
+            T item;
+            uint64 time;
+        };
+
+        typedef std::array<std::vector<Entry>, SLOTS> SlotArray;
+
+        std::vector<Entry>& SlotFor(uint64 expireTime)
+        {
+            uint64 const delta = expireTime - m_time;
+            uint32 level = 0;
+            while (delta >= (uint64(1) << (SLOT_BITS * (level + 1))))
+                ++level;
+
+            if (!m_levels[level])
+                m_levels[level].reset(new SlotArray());
+            return (*m_levels[level])[(expireTime >> (SLOT_BITS * level)) & (SLOTS - 1)];
+        }
+
+        // moves one level-N slot's items back through SlotFor so they land on
+        // the finer wheels that now cover their remaining delay
+        void Cascade(uint32 level, uint32 index)
+        {
+            std::vector<Entry>& slot = (*m_levels[level])[index];
+            if (slot.empty())
+                return;
+
+            std::vector<Entry> pending;
+            pending.swap(slot);
+            for (Entry& entry : pending)
+                SlotFor(entry.time).push_back(entry);
+        }
+
+        template <typename Handler>
+        void Tick(Handler& handler)
+        {
+            ++m_time;
+
+            // a finer wheel completing a rotation pulls the next slot of the
+            // coarser one apart; boundaries coincide, coarsest first
+            for (uint32 level = LEVELS - 1; level >= 1; --level)
+                if (m_levels[level] && !(m_time & ((uint64(1) << (SLOT_BITS * level)) - 1)))
+                    Cascade(level, (m_time >> (SLOT_BITS * level)) & (SLOTS - 1));
+
+            if (!m_levels[0])
+                return;
+
+            std::vector<Entry>& slot = (*m_levels[0])[m_time & (SLOTS - 1)];
+            if (slot.empty())
+                return;
+
+            // move the due items out first - the handler may schedule new ones
+            std::vector<Entry> due;
+            due.swap(slot);
+            m_count -= due.size();
+            for (Entry& entry : due)
+                handler(entry.item);
+        }
+
+        uint64 m_time;
+        size_t m_count;
+        std::unique_ptr<SlotArray> m_levels[LEVELS];
+};
+
+#endif
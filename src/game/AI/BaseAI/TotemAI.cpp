@@ -49,7 +49,7 @@ void TotemAI::EnterEvadeMode()
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_EVADE)
+        if (i.event->event_type == EVENT_T_EVADE)
             CheckAndReadyEventForExecution(i);
     }
     ProcessEvents();
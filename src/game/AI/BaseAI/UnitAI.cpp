@@ -627,15 +627,37 @@ void UnitAI::SendAIEventAround(AIEventType eventType, Unit* invoker, uint32 dela
         // Allow sending custom AI events to all units in range
         if ((eventType >= AI_EVENT_CUSTOM_EVENTAI_A && eventType <= AI_EVENT_CUSTOM_EVENTAI_F && eventType != AI_EVENT_GOT_CCED) || eventType > AI_EVENT_START_ESCORT)
         {
-            MaNGOS::AnyUnitInObjectRangeCheck u_check(m_unit, radius);
-            MaNGOS::CreatureListSearcher<MaNGOS::AnyUnitInObjectRangeCheck> searcher(receiverList, u_check);
-            Cell::VisitAllObjects(m_unit, searcher, radius);
+            // packed mirror prescan first, the exact range check runs on survivors only
+            std::vector<Unit*> candidates;
+            m_unit->GetMap()->ScanSnapshotUnitsInRange(m_unit->GetPositionX(), m_unit->GetPositionY(), m_unit->GetPositionZ(), radius, m_unit->GetCombatReach(), candidates);
+            for (Unit* candidate : candidates)
+                if (candidate->IsCreature() && candidate->IsAlive() && m_unit->IsWithinDistInMap(candidate, radius))
+                    receiverList.push_back(static_cast<Creature*>(candidate));
         }
         else // TODO: Expand functionality in future if needed
         {
             MaNGOS::AnyAssistCreatureInRangeCheck u_check(m_unit, invoker, radius);
-            MaNGOS::CreatureListSearcher<MaNGOS::AnyAssistCreatureInRangeCheck> searcher(receiverList, u_check);
-            Cell::VisitAllObjects(m_unit, searcher, radius);
+            // on continents assisters must be friendly to us by faction template,
+            // so the per-cell faction index narrows the scan; in dungeons
+            // CanAssistInCombatAgainst skips the friendliness check entirely
+            if (!m_unit->GetMap()->Instanceable())
+            {
+                FactionTemplateEntry const* ownTemplate = m_unit->GetFactionTemplateEntry();
+                std::vector<Creature*> candidates;
+                m_unit->GetMap()->VisitFactionIndexed(m_unit, radius, [ownTemplate](uint32 faction)
+                {
+                    FactionTemplateEntry const* entry = sFactionTemplateStore.LookupEntry(faction);
+                    return !ownTemplate || !entry || entry->IsFriendlyTo(*ownTemplate);
+                }, candidates);
+                for (Creature* candidate : candidates)
+                    if (u_check(candidate))
+                        receiverList.push_back(candidate);
+            }
+            else
+            {
+                MaNGOS::CreatureListSearcher<MaNGOS::AnyAssistCreatureInRangeCheck> searcher(receiverList, u_check);
+                Cell::VisitAllObjects(m_unit, searcher, radius);
+            }
         }
 
         if (!receiverList.empty())
@@ -40,7 +40,7 @@ bool CreatureEventAIHolder::UpdateRepeatTimer(Creature* creature, uint32 repeatM
         timer = urand(repeatMin, repeatMax);
     else
     {
-        sLog.outErrorEventAI("Creature %u using Event %u (Type = %u) has RandomMax < RandomMin. Event repeating disabled.", creature->GetEntry(), event.event_id, event.event_type);
+        sLog.outErrorEventAI("Creature %u using Event %u (Type = %u) has RandomMax < RandomMin. Event repeating disabled.", creature->GetEntry(), event->event_id, event->event_type);
         enabled = false;
         return false;
     }
@@ -75,12 +75,12 @@ void CreatureEventAI::GetAIInformation(ChatHandler& reader)
     reader.PSendSysMessage("Current events of this creature:");
     for (CreatureEventAIList::const_iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
     {
-        if (itr->event.action[2].type != ACTION_T_NONE)
-            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%u)  --  %2u(%5u)", itr->event.event_id, uint32(itr->event.event_type), itr->enabled ? "On" : "Off", itr->timer / 1000, itr->event.action[0].type, itr->event.action[0].raw.param1, itr->event.action[1].type, itr->event.action[1].raw.param1, itr->event.action[2].type, itr->event.action[2].raw.param1);
-        else if (itr->event.action[1].type != ACTION_T_NONE)
-            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%5u)", itr->event.event_id, uint32(itr->event.event_type), itr->enabled ? "On" : "Off", itr->timer / 1000, itr->event.action[0].type, itr->event.action[0].raw.param1, itr->event.action[1].type, itr->event.action[1].raw.param1);
+        if (itr->event->action[2].type != ACTION_T_NONE)
+            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%u)  --  %2u(%5u)", itr->event->event_id, uint32(itr->event->event_type), itr->enabled ? "On" : "Off", itr->timer / 1000, itr->event->action[0].type, itr->event->action[0].raw.param1, itr->event->action[1].type, itr->event->action[1].raw.param1, itr->event->action[2].type, itr->event->action[2].raw.param1);
+        else if (itr->event->action[1].type != ACTION_T_NONE)
+            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%5u)", itr->event->event_id, uint32(itr->event->event_type), itr->enabled ? "On" : "Off", itr->timer / 1000, itr->event->action[0].type, itr->event->action[0].raw.param1, itr->event->action[1].type, itr->event->action[1].raw.param1);
         else
-            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) action[type(param1)]:  %2u(%5u)", itr->event.event_id, uint32(itr->event.event_type), itr->enabled ? "On" : "Off", itr->timer / 1000, itr->event.action[0].type, itr->event.action[0].raw.param1);
+            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) action[type(param1)]:  %2u(%5u)", itr->event->event_id, uint32(itr->event->event_type), itr->enabled ? "On" : "Off", itr->timer / 1000, itr->event->action[0].type, itr->event->action[0].raw.param1);
     }
 }
 
@@ -148,20 +148,43 @@ void CreatureEventAI::InitAI()
         }
     };
 
-    // Need make copy for filter unneeded steps and safe in case table reload
-    auto creatureEventsItr = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventEntryAIMap()->find(m_creature->GetEntry());
-    if (creatureEventsItr != m_creature->GetMap()->GetMapDataContainer().GetCreatureEventEntryAIMap()->end())
+    // Holders only reference the shared definitions - hold the maps so a table
+    // reload cannot free them while this AI is alive (refreshed on respawn)
+    m_EventAIEntryData = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventEntryAIMap();
+    m_EventAIGuidData = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventGuidAIMap();
+
+    auto creatureEventsItr = m_EventAIEntryData->find(m_creature->GetEntry());
+    if (creatureEventsItr != m_EventAIEntryData->end())
     {
         const CreatureEventAI_Event_Vec& creatureEvent = creatureEventsItr->second;
         processMap(creatureEvent);
     }
 
-    auto creatureEventsGuidItr = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventGuidAIMap()->find(m_creature->GetDbGuid());
-    if (creatureEventsGuidItr != m_creature->GetMap()->GetMapDataContainer().GetCreatureEventGuidAIMap()->end())
+    auto creatureEventsGuidItr = m_EventAIGuidData->find(m_creature->GetDbGuid());
+    if (creatureEventsGuidItr != m_EventAIGuidData->end())
     {
         const CreatureEventAI_Event_Vec& creatureEvent = creatureEventsGuidItr->second;
         processMap(creatureEvent);
     }
+
+    RebuildPhaseEventIndex();
+}
+
+void CreatureEventAI::SetPhase(uint8 phase)
+{
+    if (m_Phase == phase)
+        return;
+
+    m_Phase = phase;
+    RebuildPhaseEventIndex();
+}
+
+void CreatureEventAI::RebuildPhaseEventIndex()
+{
+    m_PhaseEventIndex.clear();
+    for (uint32 idx = 0; idx < uint32(m_CreatureEventAIList.size()); ++idx)
+        if (!(m_CreatureEventAIList[idx].event->event_inverse_phase_mask & (1 << m_Phase)))
+            m_PhaseEventIndex.push_back(idx);
 }
 
 bool CreatureEventAI::IsTimerExecutedEvent(EventAI_Type type) const
@@ -259,31 +282,31 @@ bool CreatureEventAI::CheckEvent(CreatureEventAIHolder& holder, Unit* actionInvo
     if (!holder.enabled || holder.timer || holder.inProgress)
         return false;
 
-    if (holder.event.event_flags & EFLAG_COMBAT_ACTION && !CanExecuteCombatAction())
+    if (holder.event->event_flags & EFLAG_COMBAT_ACTION && !CanExecuteCombatAction())
         return false;
 
     // Check the inverse phase mask (event doesn't trigger if current phase bit is set in mask)
-    if (holder.event.event_inverse_phase_mask & (1 << m_Phase))
+    if (holder.event->event_inverse_phase_mask & (1 << m_Phase))
     {
-        if (!IsTimerExecutedEvent(holder.event.event_type))
-            DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "%s: Event %u skipped because of phasemask %u. Current phase %u", GetAIName().data(), holder.event.event_id, holder.event.event_inverse_phase_mask, m_Phase);
+        if (!IsTimerExecutedEvent(holder.event->event_type))
+            DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "%s: Event %u skipped because of phasemask %u. Current phase %u", GetAIName().data(), holder.event->event_id, holder.event->event_inverse_phase_mask, m_Phase);
         return false;
     }
 
     if (m_currentRangedMode)
     {
-        if (holder.event.event_flags & EFLAG_MELEE_MODE_ONLY)
+        if (holder.event->event_flags & EFLAG_MELEE_MODE_ONLY)
             return false;
     }
     else
     {
-        if (holder.event.event_flags & EFLAG_RANGED_MODE_ONLY)
+        if (holder.event->event_flags & EFLAG_RANGED_MODE_ONLY)
             return false;
     }
 
     LOG_PROCESS_EVENT;
 
-    CreatureEventAI_Event const& event = holder.event;
+    CreatureEventAI_Event const& event = *holder.event;
 
     // Check event conditions based on the event type, also reset events
     switch (event.event_type)
@@ -547,7 +570,7 @@ bool CreatureEventAI::CheckEvent(CreatureEventAIHolder& holder, Unit* actionInvo
                 return false;
             break;
         default:
-            sLog.outErrorEventAI("Creature %u using Event %u has invalid Event Type(%u), missing from ProcessEvent() Switch.", m_creature->GetEntry(), holder.event.event_id, holder.event.event_type);
+            sLog.outErrorEventAI("Creature %u using Event %u has invalid Event Type(%u), missing from ProcessEvent() Switch.", m_creature->GetEntry(), holder.event->event_id, holder.event->event_type);
             return false;
     }
 
@@ -556,23 +579,23 @@ bool CreatureEventAI::CheckEvent(CreatureEventAIHolder& holder, Unit* actionInvo
 
 void GetRepeatTimers(CreatureEventAIHolder& holder, uint32& repeatMin, uint32& repeatMax)
 {
-    switch (holder.event.event_type)
+    switch (holder.event->event_type)
     {
         // 0th and 1st index
         case EVENT_T_KILL:
-        case EVENT_T_TARGET_CASTING: repeatMin = holder.event.raw.params[0]; repeatMax = holder.event.raw.params[1]; return;
+        case EVENT_T_TARGET_CASTING: repeatMin = holder.event->raw.params[0]; repeatMax = holder.event->raw.params[1]; return;
         // 1st and 2nd index
         case EVENT_T_SUMMONED_UNIT:
         case EVENT_T_SUMMONED_JUST_DIED:
-        case EVENT_T_SUMMONED_JUST_DESPAWN: repeatMin = holder.event.raw.params[1]; repeatMax = holder.event.raw.params[2]; return;
+        case EVENT_T_SUMMONED_JUST_DESPAWN: repeatMin = holder.event->raw.params[1]; repeatMax = holder.event->raw.params[2]; return;
         // Most events are on 2nd and 3rd index - TODO: completely unify this
-        default: repeatMin = holder.event.raw.params[2]; repeatMax = holder.event.raw.params[3]; return;
+        default: repeatMin = holder.event->raw.params[2]; repeatMax = holder.event->raw.params[3]; return;
     }
 }
 
 void CreatureEventAI::ResetEvent(CreatureEventAIHolder& holder)
 {
-    if (IsTimerBasedEvent(holder.event.event_type))
+    if (IsTimerBasedEvent(holder.event->event_type))
     {
         uint32 repeatMin, repeatMax;
         GetRepeatTimers(holder, repeatMin, repeatMax);
@@ -580,7 +603,7 @@ void CreatureEventAI::ResetEvent(CreatureEventAIHolder& holder)
     }
 
     // Disable non-repeatable events
-    if (IsRepeatableEvent(holder.event.event_type) && !(holder.event.event_flags & EFLAG_REPEATABLE))
+    if (IsRepeatableEvent(holder.event->event_type) && !(holder.event->event_flags & EFLAG_REPEATABLE))
         holder.enabled = false;
 }
 
@@ -596,7 +619,7 @@ void CreatureEventAI::CheckAndReadyEventForExecution(CreatureEventAIHolder& hold
 bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& holder, Unit* actionInvoker, Unit* AIEventSender /*=nullptr*/)
 {
     bool actionSuccess = false;
-    if (holder.event.event_flags & EFLAG_COMBAT_ACTION && !CanExecuteCombatAction())
+    if (holder.event->event_flags & EFLAG_COMBAT_ACTION && !CanExecuteCombatAction())
     {
         holder.inProgress = false;
         return false;
@@ -605,7 +628,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& holder, Unit* actionIn
     uint32 rnd = urand();
 
     // Reset timer if roll failed
-    if (holder.event.event_chance <= rnd % 100)
+    if (holder.event->event_chance <= rnd % 100)
     {
         ResetEvent(holder);
         holder.inProgress = false;
@@ -614,20 +637,20 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& holder, Unit* actionIn
 
     // Process actions, normal case
     rnd = urand();
-    if (!(holder.event.event_flags & EFLAG_RANDOM_ACTION))
+    if (!(holder.event->event_flags & EFLAG_RANDOM_ACTION))
     {
-        actionSuccess = ProcessAction(holder.event.action[0], rnd, holder.event.event_id, actionInvoker, AIEventSender, holder.eventTarget);
+        actionSuccess = ProcessAction(holder.event->action[0], rnd, holder.event->event_id, actionInvoker, AIEventSender, holder.eventTarget);
 
-        if (!(holder.event.event_flags & EFLAG_COMBAT_ACTION) || actionSuccess)
+        if (!(holder.event->event_flags & EFLAG_COMBAT_ACTION) || actionSuccess)
             for (uint32 j = 1; j < MAX_ACTIONS; ++j)
-                ProcessAction(holder.event.action[j], rnd, holder.event.event_id, actionInvoker, AIEventSender, holder.eventTarget);
+                ProcessAction(holder.event->action[j], rnd, holder.event->event_id, actionInvoker, AIEventSender, holder.eventTarget);
     }
     // Process actions, random case
     else
     {
         // amount of real actions
         uint32 count = 0;
-        for (auto& j : holder.event.action)
+        for (auto& j : holder.event->action)
             if (j.type != ACTION_T_NONE)
                 ++count;
 
@@ -640,7 +663,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& holder, Unit* actionIn
             uint32 j = 0;
             for (; ; ++j)
             {
-                if (holder.event.action[j].type != ACTION_T_NONE)
+                if (holder.event->action[j].type != ACTION_T_NONE)
                 {
                     if (!idx)
                         break;
@@ -649,11 +672,11 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& holder, Unit* actionIn
             }
 
             rnd = urand(); // need to randomize again to prevent always same result when both event and action are randomized
-            actionSuccess = ProcessAction(holder.event.action[j], rnd, holder.event.event_id, actionInvoker, AIEventSender, holder.eventTarget);
+            actionSuccess = ProcessAction(holder.event->action[j], rnd, holder.event->event_id, actionInvoker, AIEventSender, holder.eventTarget);
         }
     }
 
-    if (!(holder.event.event_flags & EFLAG_COMBAT_ACTION) || actionSuccess)
+    if (!(holder.event->event_flags & EFLAG_COMBAT_ACTION) || actionSuccess)
         ResetEvent(holder);
 
     holder.inProgress = false;
@@ -917,7 +940,7 @@ bool CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             break;
         }
         case ACTION_T_SET_PHASE:
-            m_Phase = action.set_phase.phase;
+            SetPhase(action.set_phase.phase);
             DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "%s: ACTION_T_SET_PHASE - script %u for %s, phase is now %u", GetAIName().data(), eventId, m_creature->GetGuidStr().c_str(), m_Phase);
             break;
         case ACTION_T_INC_PHASE:
@@ -926,15 +949,15 @@ bool CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             if (new_phase < 0)
             {
                 sLog.outErrorEventAI("Event %d decrease Phase under 0. CreatureEntry = %d", eventId, m_creature->GetEntry());
-                m_Phase = 0;
+                SetPhase(0);
             }
             else if (new_phase >= MAX_PHASE)
             {
                 sLog.outErrorEventAI("Event %d incremented Phase above %u. Phase mask cannot be used with phases past %u. CreatureEntry = %d", eventId, MAX_PHASE - 1, MAX_PHASE - 1, m_creature->GetEntry());
-                m_Phase = MAX_PHASE - 1;
+                SetPhase(MAX_PHASE - 1);
             }
             else
-                m_Phase = new_phase;
+                SetPhase(new_phase);
 
             DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "%s: ACTION_T_INC_PHASE - script %u for %s, phase is now %u", GetAIName().data(), eventId, m_creature->GetGuidStr().c_str(), m_Phase);
             break;
@@ -989,12 +1012,12 @@ bool CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             }
             break;
         case ACTION_T_RANDOM_PHASE:
-            m_Phase = GetRandActionParam(rnd, action.random_phase.phase1, action.random_phase.phase2, action.random_phase.phase3);
+            SetPhase(GetRandActionParam(rnd, action.random_phase.phase1, action.random_phase.phase2, action.random_phase.phase3));
             DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "%s: ACTION_T_RANDOM_PHASE - script %u for %s, phase is now %u", GetAIName().data(), eventId, m_creature->GetGuidStr().c_str(), m_Phase);
             break;
         case ACTION_T_RANDOM_PHASE_RANGE:
             if (action.random_phase_range.phaseMax > action.random_phase_range.phaseMin)
-                m_Phase = rnd % (action.random_phase_range.phaseMax - action.random_phase_range.phaseMin + 1) + action.random_phase_range.phaseMin;
+                SetPhase(rnd % (action.random_phase_range.phaseMax - action.random_phase_range.phaseMin + 1) + action.random_phase_range.phaseMin);
             else
                 sLog.outErrorEventAI("ACTION_T_RANDOM_PHASE_RANGE cannot have Param2 <= Param1. Divide by Zero. Event = %d. CreatureEntry = %d", eventId, m_creature->GetEntry());
             break;
@@ -1394,18 +1417,18 @@ void CreatureEventAI::JustRespawned()                       // NOTE that this is
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        CreatureEventAI_Event const& event = i.event;
+        CreatureEventAI_Event const& event = *i.event;
         switch (event.event_type)
         {
             // Handle Spawned Events
             case EVENT_T_SPAWNED:
-                if (SpawnedEventConditionsCheck(i.event))
+                if (SpawnedEventConditionsCheck(*i.event))
                     CheckAndReadyEventForExecution(i);
                 break;
             case EVENT_T_TIMER_IN_COMBAT:
             case EVENT_T_TIMER_OOC:
             case EVENT_T_TIMER_GENERIC:
-                if (i.UpdateRepeatTimer(m_creature, i.event.timer.initialMin, i.event.timer.initialMax))
+                if (i.UpdateRepeatTimer(m_creature, i.event->timer.initialMin, i.event->timer.initialMax))
                     i.enabled = true;
                 break;
             default: // reset all events with initialMin/Max here
@@ -1434,7 +1457,7 @@ void CreatureEventAI::Reset()
     // Reset all events to enabled
     for (auto& i : m_CreatureEventAIList)
     {
-        CreatureEventAI_Event const& event = i.event;
+        CreatureEventAI_Event const& event = *i.event;
         switch (event.event_type)
         {
             // Dont reset any combat timers
@@ -1459,7 +1482,7 @@ void CreatureEventAI::JustReachedHome()
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_REACHED_HOME)
+        if (i.event->event_type == EVENT_T_REACHED_HOME)
             CheckAndReadyEventForExecution(i);
     }
     ProcessEvents();
@@ -1475,7 +1498,7 @@ void CreatureEventAI::EnterEvadeMode()
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_EVADE)
+        if (i.event->event_type == EVENT_T_EVADE)
             CheckAndReadyEventForExecution(i);
     }
     ProcessEvents();
@@ -1496,13 +1519,13 @@ void CreatureEventAI::JustDied(Unit* killer)
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_DEATH)
+        if (i.event->event_type == EVENT_T_DEATH)
             CheckAndReadyEventForExecution(i, killer);
     }
     ProcessEvents(killer);
 
     // reset phase after any death state events
-    m_Phase = 0;
+    SetPhase(0);
 
     if ((m_despawnAggregationMask & AGGREGATION_DEATH) != 0)
         DespawnGuids(m_despawnGuids);
@@ -1514,7 +1537,7 @@ void CreatureEventAI::KilledUnit(Unit* victim)
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_KILL)
+        if (i.event->event_type == EVENT_T_KILL)
             CheckAndReadyEventForExecution(i, victim);
     }
     ProcessEvents(victim);
@@ -1525,7 +1548,7 @@ void CreatureEventAI::JustSummoned(Creature* summoned)
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_SUMMONED_UNIT)
+        if (i.event->event_type == EVENT_T_SUMMONED_UNIT)
             CheckAndReadyEventForExecution(i, summoned);
     }
     ProcessEvents(summoned);
@@ -1539,7 +1562,7 @@ void CreatureEventAI::SummonedCreatureJustDied(Creature* summoned)
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_SUMMONED_JUST_DIED)
+        if (i.event->event_type == EVENT_T_SUMMONED_JUST_DIED)
             CheckAndReadyEventForExecution(i, summoned);
     }
     ProcessEvents(summoned);
@@ -1550,7 +1573,7 @@ void CreatureEventAI::SummonedCreatureDespawn(Creature* summoned)
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        if (i.event.event_type == EVENT_T_SUMMONED_JUST_DESPAWN)
+        if (i.event->event_type == EVENT_T_SUMMONED_JUST_DESPAWN)
             CheckAndReadyEventForExecution(i, summoned);
     }
     ProcessEvents(summoned);
@@ -1563,8 +1586,8 @@ void CreatureEventAI::ReceiveAIEvent(AIEventType eventType, Unit* sender, Unit*
     IncreaseDepthIfNecessary();
     for (auto& itr : m_CreatureEventAIList)
     {
-        if (itr.event.event_type == EVENT_T_RECEIVE_AI_EVENT &&
-                itr.event.receiveAIEvent.eventType == uint32(eventType) && (!itr.event.receiveAIEvent.senderEntry || itr.event.receiveAIEvent.senderEntry == sender->GetEntry()))
+        if (itr.event->event_type == EVENT_T_RECEIVE_AI_EVENT &&
+                itr.event->receiveAIEvent.eventType == uint32(eventType) && (!itr.event->receiveAIEvent.senderEntry || itr.event->receiveAIEvent.senderEntry == sender->GetEntry()))
             CheckAndReadyEventForExecution(itr, invoker, sender);
     }
     ProcessEvents(invoker, sender);
@@ -1582,9 +1605,9 @@ void CreatureEventAI::OnSpellCast(SpellEntry const* spellInfo, Unit* target)
 {
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_SPELL_CAST)
+        if (i.event->event_type == EVENT_T_SPELL_CAST)
             // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (spellInfo->Id == i.event.spellCast.spellId)
+            if (spellInfo->Id == i.event->spellCast.spellId)
                 CheckAndReadyEventForExecution(i, target);
 
     ProcessEvents(target);
@@ -1597,7 +1620,7 @@ void CreatureEventAI::EnterCombat(Unit* enemy)
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
     {
-        CreatureEventAI_Event const& event = i.event;
+        CreatureEventAI_Event const& event = *i.event;
         switch (event.event_type)
         {
             case EVENT_T_AGGRO:
@@ -1635,17 +1658,17 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
     {
         for (auto& itr : m_CreatureEventAIList)
         {
-            if (itr.event.event_type == EVENT_T_OOC_LOS)
+            if (itr.event->event_type == EVENT_T_OOC_LOS)
             {
                 // can trigger if closer than fMaxAllowedRange
-                float fMaxAllowedRange = (float)itr.event.ooc_los.maxRange;
+                float fMaxAllowedRange = (float)itr.event->ooc_los.maxRange;
 
                 // who must be player type if this option is turned on
-                if (!itr.event.ooc_los.playerOnly || who->GetTypeId() == TYPEID_PLAYER)
+                if (!itr.event->ooc_los.playerOnly || who->GetTypeId() == TYPEID_PLAYER)
                 {
                     // if friendly event && who is not hostile OR hostile event && who is hostile
-                    if ((itr.event.ooc_los.noHostile && !m_creature->IsEnemy(who)) ||
-                            ((!itr.event.ooc_los.noHostile) && m_creature->IsEnemy(who)))
+                    if ((itr.event->ooc_los.noHostile && !m_creature->IsEnemy(who)) ||
+                            ((!itr.event->ooc_los.noHostile) && m_creature->IsEnemy(who)))
                     {
                         // if range is ok and we are actually in LOS
                         if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
@@ -1664,10 +1687,10 @@ void CreatureEventAI::SpellHit(Unit* unit, const SpellEntry* spellInfo)
 {
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_SPELLHIT)
+        if (i.event->event_type == EVENT_T_SPELLHIT)
             // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i.event.spell_hit.spellId || spellInfo->Id == i.event.spell_hit.spellId)
-                if (GetSchoolMask(spellInfo->School) & i.event.spell_hit.schoolMask)
+            if (!i.event->spell_hit.spellId || spellInfo->Id == i.event->spell_hit.spellId)
+                if (GetSchoolMask(spellInfo->School) & i.event->spell_hit.schoolMask)
                     CheckAndReadyEventForExecution(i, unit);
 
     ProcessEvents(unit);
@@ -1677,10 +1700,10 @@ void CreatureEventAI::SpellHitTarget(Unit* target, const SpellEntry* spellInfo)
 {
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_SPELLHIT_TARGET)
+        if (i.event->event_type == EVENT_T_SPELLHIT_TARGET)
             // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i.event.spell_hit_target.spellId || spellInfo->Id == i.event.spell_hit_target.spellId)
-                if (GetSchoolMask(spellInfo->School) & i.event.spell_hit_target.schoolMask)
+            if (!i.event->spell_hit_target.spellId || spellInfo->Id == i.event->spell_hit_target.spellId)
+                if (GetSchoolMask(spellInfo->School) & i.event->spell_hit_target.schoolMask)
                     CheckAndReadyEventForExecution(i, target);
 
     ProcessEvents(target);
@@ -1826,9 +1849,9 @@ void CreatureEventAI::ReceiveEmote(Player* player, uint32 textEmote)
     IncreaseDepthIfNecessary();
     for (auto& itr : m_CreatureEventAIList)
     {
-        if (itr.event.event_type == EVENT_T_RECEIVE_EMOTE)
+        if (itr.event->event_type == EVENT_T_RECEIVE_EMOTE)
         {
-            if (itr.event.receive_emote.emoteId != textEmote)
+            if (itr.event->receive_emote.emoteId != textEmote)
                 continue;
 
             CheckAndReadyEventForExecution(itr, player);
@@ -1875,7 +1898,7 @@ void CreatureEventAI::JustPreventedDeath(Unit* attacker)
 {
     IncreaseDepthIfNecessary();
     for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_DEATH_PREVENTED)
+        if (i.event->event_type == EVENT_T_DEATH_PREVENTED)
             // If spell id matches (or no spell id) & if spell school matches (or no spell school)
             CheckAndReadyEventForExecution(i, attacker);
 
@@ -1929,35 +1952,33 @@ void CreatureEventAI::UpdateEventTimers(const uint32 diff)
     {
         m_EventDiff += diff;
 
-        // Check for time based events
+        // Check for time based events - only the ones eligible in the current
+        // phase, the rest keep their timers frozen exactly as before
         IncreaseDepthIfNecessary();
-        for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+        for (uint32 idx : m_PhaseEventIndex)
         {
-            if (i->event.event_type == EVENT_T_TARGET_NOT_REACHABLE)
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[idx];
+            if (holder.event->event_type == EVENT_T_TARGET_NOT_REACHABLE)
             {
-                CheckAndReadyEventForExecution(*i);
+                CheckAndReadyEventForExecution(holder);
                 continue;
             }
 
             // Decrement Timers
-            if (i->timer)
+            if (holder.timer)
             {
-                // Do not decrement timers if event cannot trigger in this phase
-                if (!(i->event.event_inverse_phase_mask & (1 << m_Phase)))
-                {
-                    if (i->timer > m_EventDiff)
-                        i->timer -= m_EventDiff;
-                    else
-                        i->timer = 0;
-                }
+                if (holder.timer > m_EventDiff)
+                    holder.timer -= m_EventDiff;
+                else
+                    holder.timer = 0;
             }
 
             // Skip processing of events that have time remaining or are disabled
-            if (!(i->enabled) || i->timer)
+            if (!holder.enabled || holder.timer)
                 continue;
 
-            if (IsTimerExecutedEvent(i->event.event_type))
-                CheckAndReadyEventForExecution(*i);
+            if (IsTimerExecutedEvent(holder.event->event_type))
+                CheckAndReadyEventForExecution(holder);
         }
         ProcessEvents();
 
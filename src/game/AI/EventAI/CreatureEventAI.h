@@ -35,7 +35,7 @@ class WorldObject;
 
 #define LOG_PROCESS_EVENT                                                                                                       \
     DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "CreatureEventAI: Event type %u (script %u) triggered for %s (invoked by %s)",    \
-                     holder.event.event_type, holder.event.event_id, m_creature->GetGuidStr().c_str(), actionInvoker ? actionInvoker->GetGuidStr().c_str() : "<no invoker>")
+                     holder.event->event_type, holder.event->event_id, m_creature->GetGuidStr().c_str(), actionInvoker ? actionInvoker->GetGuidStr().c_str() : "<no invoker>")
 
 enum EventAI_Type
 {
@@ -843,9 +843,11 @@ typedef std::unordered_map<uint32, CreatureEventAI_Summon> CreatureEventAI_Summo
 
 struct CreatureEventAIHolder
 {
-    CreatureEventAIHolder(CreatureEventAI_Event p) : event(p), timer(0), enabled(true), inProgress(false), eventTarget(nullptr) {}
+    CreatureEventAIHolder(CreatureEventAI_Event const& p) : event(&p), timer(0), enabled(true), inProgress(false), eventTarget(nullptr) {}
 
-    CreatureEventAI_Event event;
+    // immutable definition, shared by all instances of the creature - lifetime
+    // pinned by the owning AI holding the event map's shared_ptr
+    CreatureEventAI_Event const* event;
     uint32 timer;
     bool enabled;
     bool inProgress;
@@ -916,6 +918,9 @@ class CreatureEventAI : public CreatureAI
         bool IsRepeatableEvent(EventAI_Type type) const;
         bool IsTimerBasedEvent(EventAI_Type type) const;
 
+        void SetPhase(uint8 phase);
+        void RebuildPhaseEventIndex();
+
         uint32 m_EventUpdateTime;                           // Time between event updates
         uint32 m_EventDiff;                                 // Time between the last event call
         bool   m_bEmptyList;
@@ -923,6 +928,9 @@ class CreatureEventAI : public CreatureAI
         // Variables used by Events themselves
         typedef std::vector<CreatureEventAIHolder> CreatureEventAIList;
         CreatureEventAIList m_CreatureEventAIList;          // Holder for events (stores enabled, time, and eventid)
+        std::vector<uint32> m_PhaseEventIndex;              // Indexes of events eligible in m_Phase - rebuilt on phase change so the tick skips the rest
+        std::shared_ptr<CreatureEventAI_Event_Map> m_EventAIEntryData; // keep the shared event definitions alive across table reloads
+        std::shared_ptr<CreatureEventAI_Event_Map> m_EventAIGuidData;
         std::vector<std::vector<std::reference_wrapper<CreatureEventAIHolder>>> m_creatureEventAITempList; // Holder for events that are ready to go off
         uint32 m_depth;
 
@@ -121,6 +121,9 @@ class AnticheatLibInterface
         // run only on startup
         virtual void Initialize() = 0;
 
+        // run once at shutdown - stop any threads the module owns
+        virtual void Shutdown() {}
+
         // create anticheat session for a new world session
         virtual std::unique_ptr<SessionAnticheatInterface> NewSession(WorldSession *session, const BigNumber &K) = 0;
 
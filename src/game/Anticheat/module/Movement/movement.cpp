@@ -8,6 +8,7 @@
 
 #include "movement.hpp"
 #include "../config.hpp"
+#include "../worker.hpp"
 #include "../libanticheat.hpp"
 #include "../cyclic.hpp"
 
@@ -307,6 +308,31 @@ void Movement::CheckExpiredOrders(uint32 latency)
 }
 
 // Movement processing anticheat main routine
+void Movement::QueueDeferredChecks(MovementInfo const& movementInfo, uint16 opcode, float dist2dSq)
+{
+    MovementSnapshot snapshot;
+    snapshot.accountId = _me->GetSession()->GetAccountId();
+    snapshot.opcode = opcode;
+    snapshot.mi = movementInfo;
+    snapshot.lastMi = GetLastMovementInfo();
+    memcpy(snapshot.clientSpeeds, clientSpeeds, sizeof(clientSpeeds));
+    snapshot.jumpInitialSpeed = _jumpInitialSpeed;
+    snapshot.serverInitTime = _serverInitTime;
+    snapshot.clientInitTime = _clientInitTime;
+    snapshot.dist2dSq = dist2dSq;
+    snapshot.mapId = _me->GetMapId();
+    snapshot.team = _me->GetTeam();
+    BattleGround* bg = _me->GetBattleGround();
+    snapshot.bgWaitJoin = bg && bg->GetStatus() == STATUS_WAIT_JOIN;
+    snapshot.taxiFlying = _me->IsTaxiFlying();
+    snapshot.inKnockBack = _inKnockBack;
+    snapshot.justTeleported = _justTeleported;
+    snapshot.splineFinalized = _me->movespline->Finalized();
+    snapshot.kickOrBanPending = _anticheat->IsKickTimerActive() || _anticheat->IsBanTimerActive();
+
+    AnticheatWorker::instance().Push(std::move(snapshot));
+}
+
 bool Movement::HandleAnticheatTests(MovementInfo& movementInfo, WorldSession* session, const WorldPacket& packet)
 {
     MANGOS_ASSERT(!!_me);
@@ -351,80 +377,10 @@ bool Movement::HandleAnticheatTests(MovementInfo& movementInfo, WorldSession* se
         _jumpInitialSpeed = std::max(_jumpInitialSpeed, 7.f);
     }
 
-    /*if ((movementInfo.moveFlags & MOVE_ROOT) && (movementInfo.moveFlags & MOVE_MASK_MOVING_OR_TURN))
-        APPEND_CHEAT(CHEAT_TYPE_ROOT_MOVE);*/
-
-    if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_MULTIJUMP) &&
-        opcode == MSG_MOVE_JUMP &&
-        GetLastMovementInfo().moveFlags & MOVEFLAG_JUMPING)
-    {
-        _anticheat->RecordCheatInternal(CHEAT_TYPE_MULTIJUMP, "Jump start %u", movementInfo.jump.startClientTime);
-
-        std::string str;
-        DumpMovement(str);
-
-        sLog.outBasic("Multijump debug output:\n%s", str.c_str());
-    }
-
-    if (opcode == MSG_MOVE_STOP_SWIM && (movementInfo.moveFlags & MOVEFLAG_SWIMMING))
-        _anticheat->RecordCheatInternal(CHEAT_TYPE_FLY_HACK);
-
-    if (!movementInfo.ctime && sAnticheatConfig.IsEnabled(CHEAT_TYPE_NULL_CLIENT_TIME))
-        _anticheat->RecordCheatInternal(CHEAT_TYPE_NULL_CLIENT_TIME);
-
-    // This can happen if the player is knocked back while jumping
-    if (opcode == MSG_MOVE_JUMP && sAnticheatConfig.IsEnabled(CHEAT_TYPE_OVERSPEED_JUMP) && !IsInKnockBack())
-    {
-        // if the player is jumping, use the movement speed based on flags from the last movement.
-        // otherwise, use this one.  note that if the player was swimming, we should also use the
-        // old movement flags.  this is because the client will use the swimming speed for this
-        // case, rather than the ground speed.
-        auto const expected = !!(GetLastMovementInfo().moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_SWIMMING)) ?
-            GetXYFlagBasedClientSpeed(GetLastMovementInfo().moveFlags) :
-            GetXYFlagBasedClientSpeed(movementInfo.moveFlags);
-
-        // XXX: these should all be temporary until the above logic is perfected
-        auto const oldServerSpeed = _me->GetXYFlagBasedSpeed(GetLastMovementInfo().moveFlags);
-        auto const oldClientSpeed = GetXYFlagBasedClientSpeed(GetLastMovementInfo().moveFlags);
-        auto const serverSpeed = _me->GetXYFlagBasedSpeed(movementInfo.moveFlags);
-        auto const clientSpeed = GetXYFlagBasedClientSpeed(movementInfo.moveFlags);
-
-        if (movementInfo.jump.xyspeed > expected)
-        {
-            _anticheat->RecordCheatInternal(CHEAT_TYPE_OVERSPEED_JUMP,
-                "Lateral jump speed is too high (%f > %f) flags 0x%lx -> 0x%lx old server: %f old client: %f new server: %f new client: %f opcode: %s",
-                movementInfo.jump.xyspeed, expected, GetLastMovementInfo().moveFlags, movementInfo.moveFlags,
-                oldServerSpeed, oldClientSpeed, serverSpeed, clientSpeed, LookupOpcodeName(opcode));
-
-            std::string str;
-
-            _anticheat->GetMovementDebugString(str);
-
-            sLog.outBasic("%s", str.c_str());
-        }
-    }
-
-    // Not allowed to change horizontal speed while jumping (unless it was zero)
-    if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_JUMP_SPEED_CHANGE) &&
-        !IsInKnockBack() &&
-        opcode != CMSG_MOVE_KNOCK_BACK_ACK && opcode != MSG_MOVE_STOP &&
-        (movementInfo.moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR)) &&
-        (GetLastMovementInfo().moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR)) &&
-        movementInfo.jump.xyspeed > GetLastMovementInfo().jump.xyspeed + 0.0001f        &&
-        GetLastMovementInfo().jump.xyspeed > 0.0001f &&
-        !(!!((movementInfo.moveFlags | GetLastMovementInfo().moveFlags) & MOVEFLAG_WATERWALKING)
-            && GetLastMovementInfo().jump.xyspeed < 0.001f))   // true when entering water with waterwalking
-    {
-        _anticheat->RecordCheatInternal(CHEAT_TYPE_JUMP_SPEED_CHANGE,
-            "Lateral jump speed changed from %f to %f flags 0x%lx -> 0x%lx opcode %s jump zspeed: %f cos: %f sin: %f fall time: %d",
-            GetLastMovementInfo().jump.xyspeed, movementInfo.jump.xyspeed, GetLastMovementInfo().moveFlags,
-            movementInfo.moveFlags, LookupOpcodeName(opcode), movementInfo.jump.zspeed,
-            movementInfo.jump.cosAngle, movementInfo.jump.sinAngle, movementInfo.fallTime);
-
-        std::string str;
-        DumpMovement(str);
-        sLog.outBasic("Lateral check recent movements:\n%s", str.c_str());
-    }
+    // everything below this point used to run a battery of analytic checks
+    // inline.  those now run on the dedicated anticheat worker against this
+    // snapshot; verdicts are applied by SessionAnticheat::Update next tick
+    QueueDeferredChecks(movementInfo, opcode, dist2d);
 
     // use the first processed movement as a client/server clock sync
     if (!_serverInitTime || !_clientInitTime)
@@ -432,175 +388,6 @@ bool Movement::HandleAnticheatTests(MovementInfo& movementInfo, WorldSession* se
         _serverInitTime = movementInfo.stime;
         _clientInitTime = movementInfo.ctime;
     }
-    else
-    {
-        if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_NUM_DESYNC) && !_anticheat->IsKickTimerActive() && !_anticheat->IsBanTimerActive())
-        {
-            constexpr float msPerMinuteTolerance = 500.f;
-            auto constexpr toleranceMultiplier = msPerMinuteTolerance / (MINUTE * IN_MILLISECONDS);
-
-            // some computers clocks move at slightly different speeds.  experimentally, the maximum
-            // tolerance observed is about 140ms per minute.  however there is little gain for a speedhack
-            // which accelerates the clock by merely 500ms per minute as this would resemble an increase
-            // of only 0.8% movement speed.  therefore we will apply a tolerance of 500ms per minute since
-            // the clock has synced.
-
-            auto const serverDiff = WorldTimer::getMSTimeDiff(movementInfo.stime, _serverInitTime);
-            auto const clientDiff = WorldTimer::getMSTimeDiff(movementInfo.ctime, _clientInitTime);
-            auto const tolerance = std::max(5000.f, serverDiff * toleranceMultiplier);
-
-            // if more time passed for us than it did for them, this is not useful as a cheat, but can happen due to
-            // fluctuations in network latency
-            if (clientDiff > (serverDiff + tolerance))
-            {
-                _anticheat->RecordCheatInternal(CHEAT_TYPE_NUM_DESYNC,
-                    "Client desync exceeded tolerance.  Desync: %d server diff: %d client diff: %d tolerance: %f",
-                    clientDiff - serverDiff, serverDiff, clientDiff, tolerance);
-            }
-        }
-
-        // Client going back in time ... ?!
-        if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_TIME_BACK) && movementInfo.ctime < GetLastMovementInfo().ctime)
-        {
-            // temporary measure to remove false positives
-            if (GetLastMovementInfo().ctime - movementInfo.ctime < 1000)
-            {
-                _anticheat->RecordCheatInternal(CHEAT_TYPE_TIME_BACK, "Clock moved in reverse from %u to %u",
-                    GetLastMovementInfo().ctime, movementInfo.ctime);
-            }
-            else
-            {
-                std::string log;
-                _anticheat->GetMovementDebugString(log);
-
-                sLog.outBasic("TimeBack debug output.\n%s", log.c_str());
-            }
-        }
-    }
-
-    // Warsong Battleground - specific checks
-    if (_me->GetMapId() == 489 && sAnticheatConfig.IsEnabled(CHEAT_TYPE_FORBIDDEN))
-    {
-        // Too high - not allowed (but possible with some engineering items malfunction)
-        if (!(movementInfo.moveFlags & (MOVEFLAG_FALLINGFAR | MOVEFLAG_JUMPING)) && movementInfo.pos.z > 380.0f)
-            _anticheat->RecordCheatInternal(CHEAT_TYPE_FORBIDDEN, "Too high in Warsong Gulch (z = %f)", movementInfo.pos.z);
-
-        if (BattleGround* bg = _me->GetBattleGround())
-        {
-            if (bg->GetStatus() == STATUS_WAIT_JOIN)
-            {
-                // Battleground not started. Players should be in their starting areas.
-                if (_me->GetTeam() == ALLIANCE && movementInfo.pos.x < 1490.0f)
-                    _anticheat->RecordCheatInternal(CHEAT_TYPE_FORBIDDEN, "Outside alliance starting area (%f, %f, %f)",
-                        movementInfo.pos.x, movementInfo.pos.y, movementInfo.pos.z);
-                if (_me->GetTeam() == HORDE && movementInfo.pos.x > 957.0f)
-                    _anticheat->RecordCheatInternal(CHEAT_TYPE_FORBIDDEN, "Outside horde starting area (%f, %f, %f)",
-                        movementInfo.pos.x, movementInfo.pos.y, movementInfo.pos.z);
-            }
-        }
-    }
-
-    // Minimal checks on transports
-    if (movementInfo.moveFlags & MOVEFLAG_ONTRANSPORT &&
-        sAnticheatConfig.IsEnabled(CHEAT_TYPE_TELE_TO_TRANSPORT) &&
-        GetLastMovementInfo().ctime &&
-        !(GetLastMovementInfo().moveFlags & MOVEFLAG_ONTRANSPORT))
-    {
-        auto constexpr maxDist2d = 100.f * 100.f;
-
-        if (dist2d > maxDist2d)
-            _anticheat->RecordCheatInternal(CHEAT_TYPE_TELE_TO_TRANSPORT, "Movement distance %f", sqrtf(dist2d));
-    }
-
-    if (opcode == CMSG_MOVE_FALL_RESET && CheckFallReset(movementInfo))
-        _anticheat->RecordCheatInternal(CHEAT_TYPE_BAD_FALL_RESET, "Bad fall reset");
-
-    // Distance computation related
-    if (!_me->IsTaxiFlying() &&
-        !(movementInfo.moveFlags & MOVEFLAG_ONTRANSPORT) &&
-        sAnticheatConfig.EnableAntiSpeedHack() &&
-        !_justTeleported)
-    {
-        float allowedDXY = 0.0f;
-        float allowedDZ = 0.0f;
-        float realDistance2D_sq = 0.0f;
-
-        auto const dt = movementInfo.ctime - GetLastMovementInfo().ctime;
-
-        // Check vs extrapolation
-        if (sAnticheatConfig.EnableExtrapolation())
-        {
-            Position extrap;
-
-            // predict destination given the last movement position, direction, and flags, and compare to value reported by the client
-            if (ExtrapolateMovement(GetLastMovementInfo(), dt, extrap))
-            {
-                auto const includeZ = !!((movementInfo.moveFlags | GetLastMovementInfo().moveFlags) & MOVEFLAG_JUMPING);
-
-                // how far our extrapolation predicted they will go (squared)
-                auto const extrapDist2 = DistanceSquared(GetLastMovementInfo().pos, extrap, includeZ);
-
-                // how far they actually went (squared)
-                auto const theirDist2 = DistanceSquared(GetLastMovementInfo().pos, movementInfo.pos, includeZ);
-
-                // if they went further than we expected, record it
-                if (theirDist2 > extrapDist2)
-                {
-                    constexpr float minErr = 1.f;
-
-                    auto const extrapDist = sqrt(extrapDist2);
-                    auto const theirDist = sqrt(theirDist2);
-
-                    auto const delta = theirDist - extrapDist;
-
-                    if (delta > extrapolationEpsilon)
-                    {
-                        overSpeedDistanceTick += delta;
-                        overSpeedDistanceTotal += delta;
-                    }
-
-                    if (delta >= minErr)
-                        if (auto const anticheat = dynamic_cast<AnticheatLib *>(GetAnticheatLib()))
-                            anticheat->OfferExtrapolationData(
-                                GetLastMovementInfo(),
-                                clientSpeeds[GetMoveType(GetLastMovementInfo().moveFlags)],
-                                clientSpeeds[GetMoveType(movementInfo.moveFlags)],
-                                movementInfo, extrap, delta);
-                }
-            }
-        }
-        else if (GetMaxAllowedDist(GetLastMovementInfo(), dt, allowedDXY, allowedDZ))
-        {
-            // Allow some margin
-            allowedDXY += 0.5f;
-            allowedDZ += 0.5f;
-
-            realDistance2D_sq = DistanceSquared(movementInfo.pos, GetLastMovementInfo().pos, false);
-
-            if (realDistance2D_sq > allowedDXY * allowedDXY * 1.1f)
-            {
-                auto const dist = sqrt(realDistance2D_sq) - allowedDXY;
-
-                if (dist > extrapolationEpsilon)
-                {
-                    overSpeedDistanceTick += dist;
-                    overSpeedDistanceTotal += dist;
-                }
-            }
-
-            if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_OVERSPEED_Z) && fabs(movementInfo.pos.z - GetLastMovementInfo().pos.z) > allowedDZ)
-                _anticheat->RecordCheatInternal(CHEAT_TYPE_OVERSPEED_Z, "z changed from %f to %f, difference of %f, max allowed: %f",
-                    GetLastMovementInfo().pos.z, movementInfo.pos.z, fabs(movementInfo.pos.z - GetLastMovementInfo().pos.z), allowedDZ);
-        }
-
-        // Client should send heartbeats every 500ms at the most (it can send them sooner
-        // if movement flags change, i.e. entering or exiting a transport)
-        if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_SKIPPED_HEARTBEATS) &&
-            dt > 1000 &&
-            GetLastMovementInfo().ctime &&
-            GetLastMovementInfo().moveFlags & MOVEFLAG_MASK_MOVING)
-            _anticheat->RecordCheatInternal(CHEAT_TYPE_SKIPPED_HEARTBEATS, "Time since last movement: %d", dt);
-    }
 
     //GetLastMovementInfo() = movementInfo;
     //GetLastMovementInfo().UpdateTime(WorldTimer::getMSTime());
@@ -960,20 +747,6 @@ bool Movement::IsTeleportAllowed(MovementInfo const& movementInfo, float& distan
     return false;
 }
 
-bool Movement::CheckFallReset(MovementInfo const& movementInfo) const
-{
-    if (!sAnticheatConfig.getConfig(CONFIG_BOOL_AC_MOVEMENT_CHEAT_BAD_FALL_RESET_ENABLED))
-        return false;
-
-    if (GetLastMovementInfo().ctime)
-    {
-        if (!GetLastMovementInfo().HasMovementFlag(MovementFlags(MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR)))
-            return true;
-    }
-
-    return movementInfo.fallTime != 0 || movementInfo.jump.zspeed != 0.0f;
-}
-
 bool Movement::CheckTeleport(uint16 opcode, MovementInfo& movementInfo)
 {
     if (_me->GetMover()->GetTypeId() != TYPEID_PLAYER)
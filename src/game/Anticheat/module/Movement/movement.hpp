@@ -100,7 +100,9 @@ class Movement
 
         bool IsTeleportAllowed(MovementInfo const& movementInfo, float& distance);
 
-        bool CheckFallReset(MovementInfo const& movementInfo) const;
+        // sample everything the deferred analytics need and hand it to the
+        // anticheat worker thread
+        void QueueDeferredChecks(MovementInfo const& movementInfo, uint16 opcode, float dist2dSq);
 
     public:
         float clientSpeeds[MAX_MOVE_TYPE];
@@ -26,6 +26,7 @@
 #include "Antispam/antispammgr.hpp"
 #include "Antispam/antispam.hpp"
 #include "Movement/movement.hpp"
+#include "worker.hpp"
 #include "Warden/warden.hpp"
 #include "Warden/WardenWin.hpp"
 #include "Warden/WardenMac.hpp"
@@ -236,6 +237,13 @@ void AnticheatLib::Initialize()
     // these should be loaded only on startup since they wont change without a recompile anyway
     sLog.outString("Loading scripted Warden scans...");
     Warden::LoadScriptedScans();
+
+    AnticheatWorker::instance().Start();
+}
+
+void AnticheatLib::Shutdown()
+{
+    AnticheatWorker::instance().Stop();
 }
 
 std::unique_ptr<SessionAnticheatInterface> AnticheatLib::NewSession(WorldSession *session, const BigNumber &K)
@@ -769,6 +777,32 @@ void SessionAnticheat::Update(uint32 diff)
 
     _warden->Update(diff);
 
+    // apply verdicts the anticheat worker produced from our movement snapshots
+    VerdictBatch batch;
+    if (AnticheatWorker::instance().TakeVerdicts(_session->GetAccountId(), batch))
+    {
+        if (_movementData)
+        {
+            _movementData->overSpeedDistanceTick += batch.overSpeedDistance;
+            _movementData->overSpeedDistanceTotal += batch.overSpeedDistance;
+        }
+
+        for (auto const &verdict : batch.verdicts)
+        {
+            // dump the session's circular movement evidence buffer for post-hoc analysis
+            if (verdict.evidenceDump && _movementData)
+            {
+                std::string str;
+                _movementData->DumpMovement(str);
+                sLog.outBasic("%s evidence:\n%s",
+                    verdict.message.empty() ? "Movement verdict" : verdict.message.c_str(), str.c_str());
+            }
+
+            if (verdict.type < CHEATS_COUNT)
+                RecordCheatInternal(verdict.type, verdict.message.empty() ? nullptr : "%s", verdict.message.c_str());
+        }
+    }
+
     if (_tickTimer > diff)
         _tickTimer -= diff;
     else
@@ -827,6 +861,9 @@ void SessionAnticheat::Disconnect()
         sAntispamMgr.CacheSession(_antispam);
         _antispam.reset();
     }
+
+    // the worker routes verdicts by account id - drop anything still pending
+    AnticheatWorker::instance().DropSession(_session->GetAccountId());
 }
 
 void SessionAnticheat::SendPlayerInfo(ChatHandler *handler) const
@@ -225,6 +225,7 @@ class AnticheatLib : public AnticheatLibInterface
     public:
         virtual void Reload();
         virtual void Initialize();
+        virtual void Shutdown() override;
 
         virtual std::unique_ptr<SessionAnticheatInterface> NewSession(WorldSession *, const BigNumber &K);
 
@@ -0,0 +1,565 @@
+#include "worker.hpp"
+#include "config.hpp"
+#include "libanticheat.hpp"
+
+#include "Common.h"
+#include "Server/Opcodes.h"
+#include "Util/Timer.h"
+#include "Log/Log.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+float DistanceSquared(const Position &a, const Position &b, bool includeZ)
+{
+    float ret = pow(a.x - b.x, 2);
+    ret += pow(a.y - b.y, 2);
+
+    if (includeZ)
+        ret += pow(a.z - b.z, 2);
+
+    return ret;
+}
+
+uint32 GetMoveType(uint32 moveFlags)
+{
+    if (moveFlags & MOVEFLAG_SWIMMING)
+        return moveFlags & MOVEFLAG_BACKWARD ? MOVE_SWIM_BACK : MOVE_SWIM;
+    else if (moveFlags & MOVEFLAG_WALK_MODE)
+        return MOVE_WALK;
+    else if (moveFlags & MOVEFLAG_MASK_MOVING)
+        return moveFlags & MOVEFLAG_BACKWARD ? MOVE_RUN_BACK : MOVE_RUN;
+
+    return MOVE_RUN;
+}
+
+float GetXYFlagBasedClientSpeed(float const* clientSpeeds, uint32 moveFlags)
+{
+    // swimming?
+    if (!!(moveFlags & MOVEFLAG_SWIMMING))
+    {
+        if (!!(moveFlags & MOVEFLAG_BACKWARD))
+            return clientSpeeds[MOVE_SWIM_BACK];
+
+        return clientSpeeds[MOVE_SWIM];
+    }
+
+    // not moving laterally? zero!
+    if (!(moveFlags & MOVEFLAG_MASK_XY))
+        return 0.f;
+
+    // walking?
+    if (!!(moveFlags & MOVEFLAG_WALK_MODE))
+        return clientSpeeds[MOVE_WALK];
+
+    if (!!(moveFlags & MOVEFLAG_BACKWARD))
+        return clientSpeeds[MOVE_RUN_BACK];
+
+    return clientSpeeds[MOVE_RUN];
+}
+
+constexpr float extrapolationEpsilon = 0.0002f;
+
+std::string FormatVerdict(const char *format, ...)
+{
+    char buffer[512];
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    return buffer;
+}
+}
+
+namespace Movement
+{
+extern float computeFallElevation(float time, bool slowFall, float initialSpeed);
+}
+
+namespace NamreebAnticheat
+{
+namespace
+{
+// snapshot twin of Movement::ExtrapolateMovement.  the ground height clamp
+// and line of sight veto are omitted - both need live map access and neither
+// affects the two dimensional distance comparison used for ground movement
+bool ExtrapolateSnapshot(MovementSnapshot const& snapshot, MovementInfo const& mi, uint32 diffMs, Position &pos)
+{
+    if (mi.moveFlags & (MOVEFLAG_PITCH_UP | MOVEFLAG_PITCH_DOWN | MOVEFLAG_ONTRANSPORT))
+        return false;
+    if (mi.moveFlags & MOVEFLAG_FALLINGFAR)
+        return false;
+    if (!snapshot.splineFinalized)
+        return false;
+    if (mi.ctime == 0)
+        return false;
+
+    // if we are not moving, position shouldn't change
+    if (!(mi.moveFlags & MOVEFLAG_MASK_MOVING))
+    {
+        pos = mi.pos;
+        return true;
+    }
+
+    pos = mi.pos;
+
+    float o = pos.o;
+
+    auto const speed = snapshot.clientSpeeds[GetMoveType(mi.moveFlags)];
+
+    if (mi.moveFlags & MOVEFLAG_BACKWARD)
+        o += M_PI_F;
+    else if (mi.moveFlags & MOVEFLAG_STRAFE_LEFT)
+    {
+        if (mi.moveFlags & MOVEFLAG_FORWARD)
+            o += M_PI_F / 4;
+        else
+            o += M_PI_F / 2;
+    }
+    else if (mi.moveFlags & MOVEFLAG_STRAFE_RIGHT)
+    {
+        if (mi.moveFlags & MOVEFLAG_FORWARD)
+            o -= M_PI_F / 4;
+        else
+            o -= M_PI_F / 2;
+    }
+
+    if (mi.moveFlags & MOVEFLAG_JUMPING)
+    {
+        float diffT = WorldTimer::getMSTimeDiff(mi.jump.startClientTime, diffMs + mi.ctime) / 1000.f;
+        pos.x = mi.jump.start.x;
+        pos.y = mi.jump.start.y;
+        pos.z = mi.jump.start.z;
+        // Fatal error. Avoid crashing here ...
+        if (!pos.x || !pos.y || !pos.z || diffT > 10000.f)
+            return false;
+        pos.x += mi.jump.cosAngle * mi.jump.xyspeed * diffT;
+        pos.y += mi.jump.sinAngle * mi.jump.xyspeed * diffT;
+        pos.z -= ::Movement::computeFallElevation(diffT, mi.moveFlags & MOVEFLAG_SAFE_FALL, -snapshot.jumpInitialSpeed);
+    }
+    else if (mi.moveFlags & (MOVEFLAG_TURN_LEFT | MOVEFLAG_TURN_RIGHT))
+    {
+        if (mi.moveFlags & MOVEFLAG_MASK_MOVING)
+        {
+            // Every 2 sec
+            float T = 0.75f * (snapshot.clientSpeeds[MOVE_TURN_RATE]) * (diffMs / 1000.f);
+            float R = 1.295f * speed / M_PI * cos(mi.s_pitch);
+            pos.z += diffMs * speed / 1000.0f * sin(mi.s_pitch);
+            // Find the center of the circle we are moving on
+            if (mi.moveFlags & MOVEFLAG_TURN_LEFT)
+            {
+                pos.x += R * cos(o + M_PI / 2);
+                pos.y += R * sin(o + M_PI / 2);
+                pos.o += T;
+                T = T - M_PI / 2.0f;
+            }
+            else
+            {
+                pos.x += R * cos(o - M_PI / 2);
+                pos.y += R * sin(o - M_PI / 2);
+                pos.o -= T;
+                T = -T + M_PI / 2.0f;
+            }
+            pos.x += R * cos(o + T);
+            pos.y += R * sin(o + T);
+        }
+        else
+        {
+            float diffO = snapshot.clientSpeeds[MOVE_TURN_RATE] * diffMs / 1000.f;
+            if (mi.moveFlags & MOVEFLAG_TURN_LEFT)
+                pos.o += diffO;
+            else
+                pos.o -= diffO;
+        }
+    }
+    else
+    {
+        pos.x += speed * cos(o) * (diffMs / 1000.f);
+        pos.y += speed * sin(o) * (diffMs / 1000.f);
+    }
+
+    return true;
+}
+
+// snapshot twin of Movement::GetMaxAllowedDist
+bool MaxAllowedDistSnapshot(MovementSnapshot const& snapshot, MovementInfo const& mi, uint32 diffMs, float &dxy, float &dz)
+{
+    dxy = dz = 0.001f; // Epsilon
+
+    if (mi.moveFlags & MOVEFLAG_ONTRANSPORT)
+        return false;
+
+    if (!snapshot.splineFinalized)
+        return false;
+
+    // Dernier paquet pas a jour (connexion, TP autre map ...)
+    if (!mi.ctime)
+        return false;
+
+    if (!(mi.moveFlags & MOVEFLAG_MASK_MOVING))
+    {
+        dxy = dz = 0.f;
+        return true;
+    }
+
+    auto const speed = snapshot.clientSpeeds[GetMoveType(mi.moveFlags)];
+
+    if (mi.moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR))
+    {
+        dxy = mi.jump.xyspeed / 1000 * diffMs;
+        static constexpr float terminalVelocity = 60.148003f;
+        static constexpr float terminalSlowFallVelocity = 7.f;
+        dz = (mi.moveFlags & MOVEFLAG_SAFE_FALL) ? terminalSlowFallVelocity : terminalVelocity;
+        dz = dz / 1000 * diffMs;
+        return true;
+    }
+
+    dxy = speed / 1000 * diffMs;
+    dz = speed / 1000 * diffMs;
+
+    return true;
+}
+
+// snapshot twin of Movement::CheckFallReset
+bool CheckFallResetSnapshot(MovementSnapshot const& snapshot)
+{
+    if (!sAnticheatConfig.getConfig(CONFIG_BOOL_AC_MOVEMENT_CHEAT_BAD_FALL_RESET_ENABLED))
+        return false;
+
+    if (snapshot.lastMi.ctime)
+    {
+        if (!snapshot.lastMi.HasMovementFlag(MovementFlags(MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR)))
+            return true;
+    }
+
+    return snapshot.mi.fallTime != 0 || snapshot.mi.jump.zspeed != 0.0f;
+}
+}
+
+AnticheatWorker& AnticheatWorker::instance()
+{
+    static AnticheatWorker worker;
+    return worker;
+}
+
+AnticheatWorker::AnticheatWorker() : _head(0), _tail(0), _running(false)
+{
+    for (size_t i = 0; i < RingSize; ++i)
+        _ring[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+void AnticheatWorker::Start()
+{
+    if (_running.exchange(true))
+        return;
+
+    _thread = std::thread(&AnticheatWorker::Run, this);
+}
+
+void AnticheatWorker::Stop()
+{
+    if (!_running.exchange(false))
+        return;
+
+    if (_thread.joinable())
+        _thread.join();
+}
+
+bool AnticheatWorker::Push(MovementSnapshot&& snapshot)
+{
+    size_t pos = _head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Slot& slot = _ring[pos & (RingSize - 1)];
+        size_t const seq = slot.sequence.load(std::memory_order_acquire);
+        intptr_t const diff = intptr_t(seq) - intptr_t(pos);
+
+        if (diff == 0)
+        {
+            if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.snapshot = std::move(snapshot);
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+            return false;                           // ring full, drop
+        else
+            pos = _head.load(std::memory_order_relaxed);
+    }
+}
+
+void AnticheatWorker::Run()
+{
+    while (_running.load(std::memory_order_relaxed))
+    {
+        size_t const pos = _tail.load(std::memory_order_relaxed);
+        Slot& slot = _ring[pos & (RingSize - 1)];
+        size_t const seq = slot.sequence.load(std::memory_order_acquire);
+
+        if (intptr_t(seq) - intptr_t(pos + 1) < 0)
+        {
+            // ring empty - movement packets arrive in bursts, a short nap
+            // between them is cheaper than a condition variable handshake
+            // on every push
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+
+        VerdictBatch batch;
+        uint32 const accountId = slot.snapshot.accountId;
+        EvaluateSnapshot(slot.snapshot, batch);
+
+        slot.sequence.store(pos + RingSize, std::memory_order_release);
+        _tail.store(pos + 1, std::memory_order_relaxed);
+
+        if (batch.verdicts.empty() && batch.overSpeedDistance == 0.f)
+            continue;
+
+        std::lock_guard<std::mutex> guard(_verdictLock);
+        VerdictBatch& pending = _verdicts[accountId];
+        pending.overSpeedDistance += batch.overSpeedDistance;
+        for (auto& verdict : batch.verdicts)
+            pending.verdicts.emplace_back(std::move(verdict));
+    }
+}
+
+bool AnticheatWorker::TakeVerdicts(uint32 accountId, VerdictBatch& out)
+{
+    std::lock_guard<std::mutex> guard(_verdictLock);
+
+    auto itr = _verdicts.find(accountId);
+    if (itr == _verdicts.end())
+        return false;
+
+    out = std::move(itr->second);
+    _verdicts.erase(itr);
+    return true;
+}
+
+void AnticheatWorker::DropSession(uint32 accountId)
+{
+    std::lock_guard<std::mutex> guard(_verdictLock);
+    _verdicts.erase(accountId);
+}
+
+void AnticheatWorker::EvaluateSnapshot(MovementSnapshot const& snapshot, VerdictBatch& batch)
+{
+    auto const opcode = snapshot.opcode;
+    MovementInfo const& movementInfo = snapshot.mi;
+    MovementInfo const& lastMovementInfo = snapshot.lastMi;
+
+    if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_MULTIJUMP) &&
+        opcode == MSG_MOVE_JUMP &&
+        lastMovementInfo.moveFlags & MOVEFLAG_JUMPING)
+        batch.verdicts.push_back({ CHEAT_TYPE_MULTIJUMP, true,
+            FormatVerdict("Jump start %u", movementInfo.jump.startClientTime) });
+
+    if (opcode == MSG_MOVE_STOP_SWIM && (movementInfo.moveFlags & MOVEFLAG_SWIMMING))
+        batch.verdicts.push_back({ CHEAT_TYPE_FLY_HACK, false, "" });
+
+    if (!movementInfo.ctime && sAnticheatConfig.IsEnabled(CHEAT_TYPE_NULL_CLIENT_TIME))
+        batch.verdicts.push_back({ CHEAT_TYPE_NULL_CLIENT_TIME, false, "" });
+
+    // This can happen if the player is knocked back while jumping
+    if (opcode == MSG_MOVE_JUMP && sAnticheatConfig.IsEnabled(CHEAT_TYPE_OVERSPEED_JUMP) && !snapshot.inKnockBack)
+    {
+        // if the player is jumping, use the movement speed based on flags from the last movement.
+        // otherwise, use this one.  note that if the player was swimming, we should also use the
+        // old movement flags.  this is because the client will use the swimming speed for this
+        // case, rather than the ground speed.
+        auto const expected = !!(lastMovementInfo.moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_SWIMMING)) ?
+            GetXYFlagBasedClientSpeed(snapshot.clientSpeeds, lastMovementInfo.moveFlags) :
+            GetXYFlagBasedClientSpeed(snapshot.clientSpeeds, movementInfo.moveFlags);
+
+        if (movementInfo.jump.xyspeed > expected)
+            batch.verdicts.push_back({ CHEAT_TYPE_OVERSPEED_JUMP, true,
+                FormatVerdict("Lateral jump speed is too high (%f > %f) flags 0x%x -> 0x%x opcode: %s",
+                    movementInfo.jump.xyspeed, expected, lastMovementInfo.moveFlags,
+                    movementInfo.moveFlags, LookupOpcodeName(opcode)) });
+    }
+
+    // Not allowed to change horizontal speed while jumping (unless it was zero)
+    if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_JUMP_SPEED_CHANGE) &&
+        !snapshot.inKnockBack &&
+        opcode != CMSG_MOVE_KNOCK_BACK_ACK && opcode != MSG_MOVE_STOP &&
+        (movementInfo.moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR)) &&
+        (lastMovementInfo.moveFlags & (MOVEFLAG_JUMPING | MOVEFLAG_FALLINGFAR)) &&
+        movementInfo.jump.xyspeed > lastMovementInfo.jump.xyspeed + 0.0001f &&
+        lastMovementInfo.jump.xyspeed > 0.0001f &&
+        !(!!((movementInfo.moveFlags | lastMovementInfo.moveFlags) & MOVEFLAG_WATERWALKING)
+            && lastMovementInfo.jump.xyspeed < 0.001f))   // true when entering water with waterwalking
+        batch.verdicts.push_back({ CHEAT_TYPE_JUMP_SPEED_CHANGE, true,
+            FormatVerdict("Lateral jump speed changed from %f to %f flags 0x%x -> 0x%x opcode %s jump zspeed: %f cos: %f sin: %f fall time: %d",
+                lastMovementInfo.jump.xyspeed, movementInfo.jump.xyspeed, lastMovementInfo.moveFlags,
+                movementInfo.moveFlags, LookupOpcodeName(opcode), movementInfo.jump.zspeed,
+                movementInfo.jump.cosAngle, movementInfo.jump.sinAngle, movementInfo.fallTime) });
+
+    // clock checks only once the first processed movement has synced the clocks
+    if (snapshot.serverInitTime && snapshot.clientInitTime)
+    {
+        if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_NUM_DESYNC) && !snapshot.kickOrBanPending)
+        {
+            constexpr float msPerMinuteTolerance = 500.f;
+            auto constexpr toleranceMultiplier = msPerMinuteTolerance / (MINUTE * IN_MILLISECONDS);
+
+            // some computers clocks move at slightly different speeds.  experimentally, the maximum
+            // tolerance observed is about 140ms per minute.  however there is little gain for a speedhack
+            // which accelerates the clock by merely 500ms per minute as this would resemble an increase
+            // of only 0.8% movement speed.  therefore we will apply a tolerance of 500ms per minute since
+            // the clock has synced.
+
+            auto const serverDiff = WorldTimer::getMSTimeDiff(movementInfo.stime, snapshot.serverInitTime);
+            auto const clientDiff = WorldTimer::getMSTimeDiff(movementInfo.ctime, snapshot.clientInitTime);
+            auto const tolerance = std::max(5000.f, serverDiff * toleranceMultiplier);
+
+            // if more time passed for us than it did for them, this is not useful as a cheat, but can happen due to
+            // fluctuations in network latency
+            if (clientDiff > (serverDiff + tolerance))
+                batch.verdicts.push_back({ CHEAT_TYPE_NUM_DESYNC, false,
+                    FormatVerdict("Client desync exceeded tolerance.  Desync: %d server diff: %d client diff: %d tolerance: %f",
+                        clientDiff - serverDiff, serverDiff, clientDiff, tolerance) });
+        }
+
+        // Client going back in time ... ?!
+        if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_TIME_BACK) && movementInfo.ctime < lastMovementInfo.ctime)
+        {
+            // temporary measure to remove false positives
+            if (lastMovementInfo.ctime - movementInfo.ctime < 1000)
+                batch.verdicts.push_back({ CHEAT_TYPE_TIME_BACK, false,
+                    FormatVerdict("Clock moved in reverse from %u to %u", lastMovementInfo.ctime, movementInfo.ctime) });
+            else
+                batch.verdicts.push_back({ CHEATS_COUNT, true, "TimeBack debug output" });
+        }
+    }
+
+    // Warsong Battleground - specific checks
+    if (snapshot.mapId == 489 && sAnticheatConfig.IsEnabled(CHEAT_TYPE_FORBIDDEN))
+    {
+        // Too high - not allowed (but possible with some engineering items malfunction)
+        if (!(movementInfo.moveFlags & (MOVEFLAG_FALLINGFAR | MOVEFLAG_JUMPING)) && movementInfo.pos.z > 380.0f)
+            batch.verdicts.push_back({ CHEAT_TYPE_FORBIDDEN, false,
+                FormatVerdict("Too high in Warsong Gulch (z = %f)", movementInfo.pos.z) });
+
+        if (snapshot.bgWaitJoin)
+        {
+            // Battleground not started. Players should be in their starting areas.
+            if (snapshot.team == ALLIANCE && movementInfo.pos.x < 1490.0f)
+                batch.verdicts.push_back({ CHEAT_TYPE_FORBIDDEN, false,
+                    FormatVerdict("Outside alliance starting area (%f, %f, %f)",
+                        movementInfo.pos.x, movementInfo.pos.y, movementInfo.pos.z) });
+            if (snapshot.team == HORDE && movementInfo.pos.x > 957.0f)
+                batch.verdicts.push_back({ CHEAT_TYPE_FORBIDDEN, false,
+                    FormatVerdict("Outside horde starting area (%f, %f, %f)",
+                        movementInfo.pos.x, movementInfo.pos.y, movementInfo.pos.z) });
+        }
+    }
+
+    // Minimal checks on transports
+    if (movementInfo.moveFlags & MOVEFLAG_ONTRANSPORT &&
+        sAnticheatConfig.IsEnabled(CHEAT_TYPE_TELE_TO_TRANSPORT) &&
+        lastMovementInfo.ctime &&
+        !(lastMovementInfo.moveFlags & MOVEFLAG_ONTRANSPORT))
+    {
+        auto constexpr maxDist2d = 100.f * 100.f;
+
+        if (snapshot.dist2dSq > maxDist2d)
+            batch.verdicts.push_back({ CHEAT_TYPE_TELE_TO_TRANSPORT, false,
+                FormatVerdict("Movement distance %f", sqrtf(snapshot.dist2dSq)) });
+    }
+
+    if (opcode == CMSG_MOVE_FALL_RESET && CheckFallResetSnapshot(snapshot))
+        batch.verdicts.push_back({ CHEAT_TYPE_BAD_FALL_RESET, false, "Bad fall reset" });
+
+    // Distance computation related
+    if (!snapshot.taxiFlying &&
+        !(movementInfo.moveFlags & MOVEFLAG_ONTRANSPORT) &&
+        sAnticheatConfig.EnableAntiSpeedHack() &&
+        !snapshot.justTeleported)
+    {
+        float allowedDXY = 0.0f;
+        float allowedDZ = 0.0f;
+
+        auto const dt = movementInfo.ctime - lastMovementInfo.ctime;
+
+        // Check vs extrapolation
+        if (sAnticheatConfig.EnableExtrapolation())
+        {
+            Position extrap;
+
+            // predict destination given the last movement position, direction, and flags, and compare to value reported by the client
+            if (ExtrapolateSnapshot(snapshot, lastMovementInfo, dt, extrap))
+            {
+                auto const includeZ = !!((movementInfo.moveFlags | lastMovementInfo.moveFlags) & MOVEFLAG_JUMPING);
+
+                // how far our extrapolation predicted they will go (squared)
+                auto const extrapDist2 = DistanceSquared(lastMovementInfo.pos, extrap, includeZ);
+
+                // how far they actually went (squared)
+                auto const theirDist2 = DistanceSquared(lastMovementInfo.pos, movementInfo.pos, includeZ);
+
+                // if they went further than we expected, record it
+                if (theirDist2 > extrapDist2)
+                {
+                    constexpr float minErr = 1.f;
+
+                    auto const extrapDist = sqrt(extrapDist2);
+                    auto const theirDist = sqrt(theirDist2);
+
+                    auto const delta = theirDist - extrapDist;
+
+                    if (delta > extrapolationEpsilon)
+                        batch.overSpeedDistance += delta;
+
+                    if (delta >= minErr)
+                        if (auto const anticheat = dynamic_cast<AnticheatLib *>(GetAnticheatLib()))
+                            anticheat->OfferExtrapolationData(
+                                lastMovementInfo,
+                                snapshot.clientSpeeds[GetMoveType(lastMovementInfo.moveFlags)],
+                                snapshot.clientSpeeds[GetMoveType(movementInfo.moveFlags)],
+                                movementInfo, extrap, delta);
+                }
+            }
+        }
+        else if (MaxAllowedDistSnapshot(snapshot, lastMovementInfo, dt, allowedDXY, allowedDZ))
+        {
+            // Allow some margin
+            allowedDXY += 0.5f;
+            allowedDZ += 0.5f;
+
+            float const realDistance2D_sq = DistanceSquared(movementInfo.pos, lastMovementInfo.pos, false);
+
+            if (realDistance2D_sq > allowedDXY * allowedDXY * 1.1f)
+            {
+                auto const dist = sqrt(realDistance2D_sq) - allowedDXY;
+
+                if (dist > extrapolationEpsilon)
+                    batch.overSpeedDistance += dist;
+            }
+
+            if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_OVERSPEED_Z) && fabs(movementInfo.pos.z - lastMovementInfo.pos.z) > allowedDZ)
+                batch.verdicts.push_back({ CHEAT_TYPE_OVERSPEED_Z, false,
+                    FormatVerdict("z changed from %f to %f, difference of %f, max allowed: %f",
+                        lastMovementInfo.pos.z, movementInfo.pos.z,
+                        fabs(movementInfo.pos.z - lastMovementInfo.pos.z), allowedDZ) });
+        }
+
+        // Client should send heartbeats every 500ms at the most (it can send them sooner
+        // if movement flags change, i.e. entering or exiting a transport)
+        if (sAnticheatConfig.IsEnabled(CHEAT_TYPE_SKIPPED_HEARTBEATS) &&
+            dt > 1000 &&
+            lastMovementInfo.ctime &&
+            lastMovementInfo.moveFlags & MOVEFLAG_MASK_MOVING)
+            batch.verdicts.push_back({ CHEAT_TYPE_SKIPPED_HEARTBEATS, false,
+                FormatVerdict("Time since last movement: %d", dt) });
+    }
+}
+}
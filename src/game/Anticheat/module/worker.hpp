@@ -0,0 +1,121 @@
+#ifndef __ANTICHEATWORKER_HPP_
+#define __ANTICHEATWORKER_HPP_
+
+#include "libanticheat.hpp"
+
+#include "Common.h"
+#include "Entities/Object.h"
+#include "Entities/Unit.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NamreebAnticheat
+{
+// everything the deferred movement analytics need, sampled on the handler
+// thread while the session still owns the player
+struct MovementSnapshot
+{
+    uint32 accountId;
+    uint16 opcode;
+    MovementInfo mi;
+    MovementInfo lastMi;
+    float clientSpeeds[MAX_MOVE_TYPE];
+    float jumpInitialSpeed;
+    uint32 serverInitTime;
+    uint32 clientInitTime;
+    float dist2dSq;
+    uint32 mapId;
+    uint32 team;
+    bool bgWaitJoin;
+    bool taxiFlying;
+    bool inKnockBack;
+    bool justTeleported;
+    bool splineFinalized;
+    bool kickOrBanPending;
+};
+
+// a single detection produced off-thread, applied by the owning session on
+// its next update
+struct Verdict
+{
+    // CHEATS_COUNT means "evidence dump only", no cheat entry is recorded
+    CheatType type;
+
+    // attach the session's circular movement evidence buffer to the log
+    bool evidenceDump;
+
+    std::string message;
+};
+
+struct VerdictBatch
+{
+    std::vector<Verdict> verdicts;
+
+    // added to the session's over-speed accumulators on application
+    float overSpeedDistance = 0.f;
+};
+
+// Dedicated anticheat evaluation thread.
+//
+// Movement handlers snapshot each packet into a fixed size lock-free ring;
+// this thread drains the ring, runs the stateless movement analytics on the
+// snapshots, and posts verdicts keyed by account, which the owning session
+// picks up and applies (log / kick / ban) from its next Update tick.
+class AnticheatWorker
+{
+    public:
+        static AnticheatWorker& instance();
+
+        void Start();
+        void Stop();
+
+        // queue a snapshot for evaluation.  returns false when the ring is
+        // full, in which case the snapshot is dropped (fail open - the
+        // gating checks have already run inline)
+        bool Push(MovementSnapshot&& snapshot);
+
+        // called by SessionAnticheat::Update.  returns false when there is
+        // nothing pending for the account
+        bool TakeVerdicts(uint32 accountId, VerdictBatch& out);
+
+        // discard any pending verdicts when a session goes away
+        void DropSession(uint32 accountId);
+
+        // the deferred analytics, exposed for the worker loop.  pure with
+        // respect to world state - everything it reads is in the snapshot
+        static void EvaluateSnapshot(MovementSnapshot const& snapshot, VerdictBatch& batch);
+
+    private:
+        // bounded multi-producer single-consumer ring (Vyukov style: each
+        // slot carries a sequence number so producers never take a lock)
+        static constexpr size_t RingSize = 4096;    // must be a power of two
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            MovementSnapshot snapshot;
+        };
+
+        AnticheatWorker();
+
+        void Run();
+
+        std::array<Slot, RingSize> _ring;
+        std::atomic<size_t> _head;                  // next slot to write
+        std::atomic<size_t> _tail;                  // next slot to read
+
+        std::thread _thread;
+        std::atomic<bool> _running;
+
+        std::mutex _verdictLock;
+        std::unordered_map<uint32, VerdictBatch> _verdicts;
+};
+}
+
+#endif /*!__ANTICHEATWORKER_HPP_*/
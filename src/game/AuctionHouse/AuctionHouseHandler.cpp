@@ -574,11 +574,6 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recv_data)
     // DEBUG_LOG("Auctionhouse search %s list from: %u, searchedname: %s, levelmin: %u, levelmax: %u, auctionSlotID: %u, auctionMainCategory: %u, auctionSubCategory: %u, quality: %u, usable: %u",
     //  auctioneerGuid.GetString().c_str(), listfrom, searchedname.c_str(), levelmin, levelmax, auctionSlotID, auctionMainCategory, auctionSubCategory, quality, usable);
 
-    WorldPacket data(SMSG_AUCTION_LIST_RESULT, (4 + 4));
-    uint32 count = 0;
-    uint32 totalcount = 0;
-    data << uint32(0);
-
     // converting string that we try to find to lower case
     std::wstring wsearchedname;
     if (!Utf8toWStr(searchedname, wsearchedname))
@@ -586,6 +581,36 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recv_data)
 
     wstrToLower(wsearchedname);
 
+    // hand the search to the dedicated thread - it works on an immutable snapshot and
+    // sends the finished packet back through the world messager
+    if (usable == 0x00)
+    {
+        AuctionSearchRequest request;
+        request.accountId = GetAccountId();
+        request.snapshot = auctionHouse->GetSearchSnapshot();
+        request.wsearchedname = wsearchedname;
+        request.listfrom = listfrom;
+        request.levelmin = levelmin;
+        request.levelmax = levelmax;
+        request.inventoryType = auctionSlotID;
+        request.itemClass = auctionMainCategory;
+        request.itemSubClass = auctionSubCategory;
+        request.quality = quality;
+        request.locIdx = GetSessionDbLocaleIndex();
+
+        sWorld.GetAuctionHouseSearcher().GetMessager().AddMessage([request](AuctionHouseSearcher* searcher)
+        {
+            searcher->ExecuteSearch(request);
+        });
+        return;
+    }
+
+    // usable-filtered searches depend on live player state and stay on the world thread
+    WorldPacket data(SMSG_AUCTION_LIST_RESULT, (4 + 4));
+    uint32 count = 0;
+    uint32 totalcount = 0;
+    data << uint32(0);
+
     auctionHouse->BuildListAuctionItems(data, _player,
                                         wsearchedname, listfrom, levelmin, levelmax, usable,
                                         auctionSlotID, auctionMainCategory, auctionSubCategory, quality,
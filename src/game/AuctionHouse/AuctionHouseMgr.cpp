@@ -517,6 +517,117 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(Unit* unit)
     return sAuctionHouseStore.LookupEntry(houseid);
 }
 
+void AuctionHouseObject::AddAuction(AuctionEntry* ah)
+{
+    MANGOS_ASSERT(ah);
+
+    // precompute the search attributes once instead of resolving the prototype per list request
+    if (ItemPrototype const* proto = ObjectMgr::GetItemPrototype(ah->itemTemplate))
+    {
+        ah->itemClass = proto->Class;
+        ah->itemSubClass = proto->SubClass;
+        ah->itemInvType = proto->InventoryType;
+        ah->itemQuality = proto->Quality;
+        ah->itemLevel = proto->RequiredLevel;
+    }
+    else
+    {
+        ah->itemClass = 0;
+        ah->itemSubClass = 0;
+        ah->itemInvType = 0;
+        ah->itemQuality = 0;
+        ah->itemLevel = 0;
+    }
+
+    AuctionsMap[ah->Id] = ah;
+    SearchIndex[MakeAuctionSearchKey(ah->itemClass, ah->itemSubClass, ah->Id)] = ah;
+
+    // same predicate the AHBot buy pass used to re-evaluate per scan: anything
+    // with a player owner or a standing bid (bids matter for loaded auctions)
+    if (ah->owner || ah->bid)
+        PlayerInterest.insert(ah->Id);
+    else
+    {
+        ++m_aggregates.botAuctionCount;
+        if (ah->itemQuality < MAX_ITEM_QUALITY)
+            ++m_aggregates.botQualityCount[ah->itemQuality];
+    }
+
+    ++m_generation;
+}
+
+void AuctionHouseObject::EraseFromIndex(AuctionEntry const* ah)
+{
+    SearchIndex.erase(MakeAuctionSearchKey(ah->itemClass, ah->itemSubClass, ah->Id));
+
+    // every removal path (cancel, sale, expiry) funnels through here, so this
+    // is also where the market bookkeeping retires the auction
+    PlayerInterest.erase(ah->Id);
+    if (!ah->owner)
+    {
+        --m_aggregates.botAuctionCount;
+        if (ah->itemQuality < MAX_ITEM_QUALITY)
+            --m_aggregates.botQualityCount[ah->itemQuality];
+    }
+
+    ++m_generation;
+}
+
+bool AuctionHouseObject::RemoveAuction(uint32 id)
+{
+    AuctionEntryMap::iterator itr = AuctionsMap.find(id);
+    if (itr == AuctionsMap.end())
+        return false;
+
+    EraseFromIndex(itr->second);
+    AuctionsMap.erase(itr);
+    return true;
+}
+
+std::shared_ptr<AuctionSearchSnapshot const> AuctionHouseObject::GetSearchSnapshot()
+{
+    if (!SearchSnapshot || SearchSnapshot->generation != m_generation)
+    {
+        // capture everything the search thread needs while items may still be touched;
+        // bursts of searches between content changes all share the same snapshot
+        std::shared_ptr<AuctionSearchSnapshot> snapshot = std::make_shared<AuctionSearchSnapshot>();
+        snapshot->generation = m_generation;
+        snapshot->rows.reserve(SearchIndex.size());
+
+        for (auto const& pair : SearchIndex)
+        {
+            AuctionEntry const* ah = pair.second;
+            Item* item = sAuctionMgr.GetAItem(ah->itemGuidLow);
+            if (!item)
+                continue;
+
+            AuctionSearchRow row;
+            row.searchKey = pair.first;
+            row.auctionId = ah->Id;
+            row.itemTemplate = ah->itemTemplate;
+            row.itemInvType = ah->itemInvType;
+            row.itemQuality = ah->itemQuality;
+            row.itemLevel = ah->itemLevel;
+            row.enchantId = item->GetEnchantmentId(EnchantmentSlot(PERM_ENCHANTMENT_SLOT));
+            row.randomPropertyId = item->GetItemRandomPropertyId();
+            row.suffixFactor = item->GetItemSuffixFactor();
+            row.itemCount = item->GetCount();
+            row.spellCharges = item->GetSpellCharges();
+            row.owner = ah->owner;
+            row.startbid = ah->startbid;
+            row.bid = ah->bid;
+            row.buyout = ah->buyout;
+            row.expireTime = ah->expireTime;
+            row.bidder = ah->bidder;
+            snapshot->rows.push_back(row);
+        }
+
+        SearchSnapshot = snapshot;
+    }
+
+    return SearchSnapshot;
+}
+
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld.GetGameTime();
@@ -540,6 +651,7 @@ void AuctionHouseObject::Update()
 
             itr->second->DeleteFromDB();
             sAuctionMgr.RemoveAItem(itr->second->itemGuidLow);
+            EraseFromIndex(itr->second);
             delete itr->second;
             AuctionsMap.erase(itr++);
         }
@@ -589,42 +701,85 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
 {
     int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
 
-    for (auto& AentryItr : AuctionsMap)
+    // restrict the scan to the class (or class+subclass) range of the search index
+    uint64 keyFirst = MakeAuctionSearchKey(0, 0, 0);
+    uint64 keyLast = MakeAuctionSearchKey(0xff, 0xff, 0xffffffff);
+    if (itemClass != 0xffffffff)
     {
-        auto Aentry = AentryItr.second;
-        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
-        if (!item)
-            continue;
+        if (itemSubClass != 0xffffffff)
+        {
+            keyFirst = MakeAuctionSearchKey(itemClass, itemSubClass, 0);
+            keyLast = MakeAuctionSearchKey(itemClass, itemSubClass, 0xffffffff);
+        }
+        else
+        {
+            keyFirst = MakeAuctionSearchKey(itemClass, 0, 0);
+            keyLast = MakeAuctionSearchKey(itemClass, 0xff, 0xffffffff);
+        }
+    }
+
+    // fingerprint of everything but listfrom - a page flip keeps the fingerprint and moves listfrom
+    uint64 paramsHash = std::hash<std::wstring>()(wsearchedname);
+    for (uint32 param : { levelmin, levelmax, usable, inventoryType, itemClass, itemSubClass, quality, uint32(loc_idx + 1) })
+        paramsHash = paramsHash * 31 + param;
 
+    AuctionSearchIndex::const_iterator itr = SearchIndex.lower_bound(keyFirst);
+    AuctionSearchIndex::const_iterator end = SearchIndex.upper_bound(keyLast);
+
+    // resume at the stored cursor when the client asks for the page right after the last one
+    // and the house content did not change in between - skips both the rescan and the recount
+    bool resumed = false;
+    std::unordered_map<uint32, SearchCursor>::iterator cursorItr = SearchCursors.find(player->GetGUIDLow());
+    if (cursorItr != SearchCursors.end())
+    {
+        SearchCursor const& cursor = cursorItr->second;
+        if (cursor.paramsHash == paramsHash && cursor.generation == m_generation && cursor.nextOffset == listfrom)
         {
-            ItemPrototype const* proto = item->GetProto();
+            itr = SearchIndex.lower_bound(cursor.nextKey);
+            totalcount = cursor.total;
+            resumed = true;
+        }
+    }
 
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
-                continue;
+    uint32 matched = listfrom;                              // matches before the current iterator position
+    if (!resumed)
+        matched = 0;
 
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-                continue;
+    uint64 nextKey = keyLast + 1;                           // resume point for the next page
+    for (; itr != end; ++itr)
+    {
+        AuctionEntry* Aentry = itr->second;
+
+        if (itemSubClass != 0xffffffff && Aentry->itemSubClass != itemSubClass)
+            continue;
 
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
+        if (inventoryType != 0xffffffff && Aentry->itemInvType != inventoryType)
+        {
+            if (inventoryType != INVTYPE_CHEST || Aentry->itemInvType != INVTYPE_ROBE)
             {
-                if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
-                {
-                    // if inventory type is chest, we want to return robes too
-                    // i.e. cloth chests are in most cases robes by definition
+                // if inventory type is chest, we want to return robes too
+                // i.e. cloth chests are in most cases robes by definition
 
-                    continue;
-                }
+                continue;
             }
+        }
 
-            if (quality != 0xffffffff && proto->Quality < quality)
-                continue;
+        if (quality != 0xffffffff && Aentry->itemQuality < quality)
+            continue;
 
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
+        if (levelmin != 0x00 && (Aentry->itemLevel < levelmin || (levelmax != 0x00 && Aentry->itemLevel > levelmax)))
+            continue;
+
+        if (usable != 0x00 || !wsearchedname.empty())
+        {
+            ItemPrototype const* proto = ObjectMgr::GetItemPrototype(Aentry->itemTemplate);
+            if (!proto)
                 continue;
 
             if (usable != 0x00)
             {
-                if (player->CanUseItem(item) != EQUIP_ERR_OK)
+                Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
+                if (!item || player->CanUseItem(item) != EQUIP_ERR_OK)
                     continue;
 
                 if (proto->Class == ITEM_CLASS_RECIPE)
@@ -637,21 +792,41 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
                 }
             }
 
-            std::string name = proto->Name1;
-            sObjectMgr.GetItemLocaleStrings(proto->ItemId, loc_idx, &name);
-
-            if (!wsearchedname.empty() && !Utf8FitTo(name, wsearchedname))
-                continue;
-
-            if (count < MAX_AUCTION_ITEMS_CLIENT_UI_PAGE && totalcount >= listfrom)
+            if (!wsearchedname.empty())
             {
-                ++count;
-                Aentry->BuildAuctionInfo(data);
+                std::string name = proto->Name1;
+                sObjectMgr.GetItemLocaleStrings(proto->ItemId, loc_idx, &name);
+
+                if (!Utf8FitTo(name, wsearchedname))
+                    continue;
             }
         }
 
-        ++totalcount;
+        if (matched >= listfrom && count < MAX_AUCTION_ITEMS_CLIENT_UI_PAGE)
+        {
+            ++count;
+            Aentry->BuildAuctionInfo(data);
+        }
+        else if (matched >= listfrom + MAX_AUCTION_ITEMS_CLIENT_UI_PAGE && nextKey > keyLast)
+        {
+            nextKey = itr->first;
+            if (resumed)                                    // total is already known from the first scan
+                break;
+        }
+
+        ++matched;
     }
+
+    if (!resumed)
+        totalcount = matched;
+
+    SearchCursor cursor;
+    cursor.paramsHash = paramsHash;
+    cursor.nextKey = nextKey;
+    cursor.nextOffset = listfrom + count;
+    cursor.total = totalcount;
+    cursor.generation = m_generation;
+    SearchCursors[player->GetGUIDLow()] = cursor;
 }
 
 AuctionEntry* AuctionHouseObject::AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout, uint32 deposit, Player* pl /*= nullptr*/)
@@ -799,6 +974,9 @@ bool AuctionEntry::UpdateBid(uint32 newbid, Player* newbidder /*=nullptr*/)
     bidder = newbidder ? newbidder->GetGUIDLow() : 0;
     bid = newbid;
 
+    sAuctionMgr.GetAuctionsMap(auctionHouseEntry)->InvalidateSearch();
+    sAuctionMgr.GetAuctionsMap(auctionHouseEntry)->OnAuctionBid(this);
+
     if ((newbid < buyout) || (buyout == 0))                 // bid
     {
         if (auction_owner && newbidder) // don't send notification unless newbidder is set (AHBot bidding), otherwise player will be told auction was sold when it was just a bid
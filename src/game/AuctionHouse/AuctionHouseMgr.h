@@ -20,7 +20,9 @@
 #define _AUCTION_HOUSE_MGR_H
 
 #include "Common.h"
+#include "Globals/SharedDefines.h"
 #include "Server/DBCStructure.h"
+#include "AuctionHouse/AuctionHouseSearcher.h"
 
 class Item;
 class Player;
@@ -67,6 +69,14 @@ struct AuctionEntry
     uint32 deposit;                                         // deposit can be calculated only when creating auction
     AuctionHouseEntry const* auctionHouseEntry;             // in AuctionHouse.dbc
 
+    // item search attributes, precomputed from the prototype when the auction is added
+    // so list searches don't have to resolve item/prototype per auction
+    uint32 itemClass;
+    uint32 itemSubClass;
+    uint32 itemInvType;
+    uint32 itemQuality;
+    uint32 itemLevel;                                       // RequiredLevel of the prototype
+
     // helpers
     uint32 GetHouseId() const { return auctionHouseEntry->houseId; }
     uint32 GetHouseFaction() const { return auctionHouseEntry->faction; }
@@ -83,7 +93,7 @@ struct AuctionEntry
 class AuctionHouseObject
 {
     public:
-        AuctionHouseObject() {}
+        AuctionHouseObject() : m_generation(0) {}
         ~AuctionHouseObject()
         {
             for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
@@ -92,17 +102,22 @@ class AuctionHouseObject
 
         typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
         typedef std::pair<AuctionEntryMap::const_iterator, AuctionEntryMap::const_iterator> AuctionEntryMapBounds;
+        typedef std::map<uint64, AuctionEntry*> AuctionSearchIndex;
+
+        // running totals of server-generated (AHBot) auctions, maintained on
+        // post/sell/expire so status queries don't walk the whole container
+        struct MarketAggregates
+        {
+            uint32 botAuctionCount = 0;
+            uint32 botQualityCount[MAX_ITEM_QUALITY] = {};
+        };
 
         uint32 GetCount() const { return AuctionsMap.size(); }
 
         AuctionEntryMap const& GetAuctions() const { return AuctionsMap; }
         AuctionEntryMapBounds GetAuctionsBounds() const {return AuctionEntryMapBounds(AuctionsMap.begin(), AuctionsMap.end()); }
 
-        void AddAuction(AuctionEntry* ah)
-        {
-            MANGOS_ASSERT(ah);
-            AuctionsMap[ah->Id] = ah;
-        }
+        void AddAuction(AuctionEntry* ah);
 
         AuctionEntry* GetAuction(uint32 id) const
         {
@@ -110,7 +125,19 @@ class AuctionHouseObject
             return itr != AuctionsMap.end() ? itr->second : nullptr;
         }
 
-        bool RemoveAuction(uint32 id) { return !!AuctionsMap.erase(id); }
+        bool RemoveAuction(uint32 id);
+
+        // invalidates search cursors and the search snapshot after in-place changes (bids)
+        void InvalidateSearch() { ++m_generation; }
+
+        MarketAggregates const& GetMarketAggregates() const { return m_aggregates; }
+
+        // auctions a player posted or bid on - the only candidates for the AHBot
+        // buy pass, which therefore never has to walk the bot's own listings
+        std::set<uint32> const& GetPlayerInterestAuctions() const { return PlayerInterest; }
+
+        // called when a bid lands on this house so the auction enters the interest set
+        void OnAuctionBid(AuctionEntry const* ah) { PlayerInterest.insert(ah->Id); }
 
         void Update();
 
@@ -121,8 +148,30 @@ class AuctionHouseObject
                                    uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
                                    uint32& count, uint32& totalcount);
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout = 0, uint32 deposit = 0, Player* pl = nullptr);
+
+        // immutable snapshot for the search thread; rebuilt lazily when the house changed (world thread only)
+        std::shared_ptr<AuctionSearchSnapshot const> GetSearchSnapshot();
     private:
+        void EraseFromIndex(AuctionEntry const* ah);
+
+        // last list search of a player; lets the next page resume at the stored index key
+        // instead of rescanning from the start (stable against concurrent add/remove via generation)
+        struct SearchCursor
+        {
+            uint64 paramsHash;                              // fingerprint of the filter set the cursor was built for
+            uint64 nextKey;                                 // first index key not returned yet
+            uint32 nextOffset;                              // listfrom value the cursor can resume at
+            uint32 total;                                   // total match count, counted on the first scan
+            uint32 generation;                              // house generation the cursor was built at
+        };
+
         AuctionEntryMap AuctionsMap;
+        AuctionSearchIndex SearchIndex;                     // auctions keyed by item class/subclass for ranged list searches
+        std::set<uint32> PlayerInterest;                    // ids of auctions with a player owner or a standing bid
+        MarketAggregates m_aggregates;
+        std::unordered_map<uint32, SearchCursor> SearchCursors; // by player lowguid
+        std::shared_ptr<AuctionSearchSnapshot const> SearchSnapshot; // last snapshot handed to the search thread
+        uint32 m_generation;                                // bumped on every add/remove, invalidates cursors and the snapshot
 };
 
 enum AuctionHouseType
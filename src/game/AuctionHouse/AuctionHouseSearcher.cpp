@@ -0,0 +1,177 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "AuctionHouse/AuctionHouseSearcher.h"
+#include "AuctionHouse/AuctionHouseMgr.h"
+#include "Globals/ObjectMgr.h"
+#include "World/World.h"
+#include "Server/WorldPacket.h"
+#include "Server/WorldSession.h"
+#include "Util/Util.h"
+
+#include <algorithm>
+
+void AuctionHouseSearcher::Update()
+{
+    while (!World::IsStopped())
+    {
+        GetMessager().Execute(this);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+}
+
+void AuctionHouseSearcher::ExecuteSearch(AuctionSearchRequest const& request)
+{
+    std::vector<AuctionSearchRow> const& rows = request.snapshot->rows;
+
+    // restrict the scan to the class (or class+subclass) range of the sorted rows
+    uint64 keyFirst = MakeAuctionSearchKey(0, 0, 0);
+    uint64 keyLast = MakeAuctionSearchKey(0xff, 0xff, 0xffffffff);
+    if (request.itemClass != 0xffffffff)
+    {
+        if (request.itemSubClass != 0xffffffff)
+        {
+            keyFirst = MakeAuctionSearchKey(request.itemClass, request.itemSubClass, 0);
+            keyLast = MakeAuctionSearchKey(request.itemClass, request.itemSubClass, 0xffffffff);
+        }
+        else
+        {
+            keyFirst = MakeAuctionSearchKey(request.itemClass, 0, 0);
+            keyLast = MakeAuctionSearchKey(request.itemClass, 0xff, 0xffffffff);
+        }
+    }
+
+    auto keyLess = [](AuctionSearchRow const& row, uint64 key) { return row.searchKey < key; };
+    size_t first = std::lower_bound(rows.begin(), rows.end(), keyFirst, keyLess) - rows.begin();
+    size_t last = std::lower_bound(rows.begin(), rows.end(), keyLast + 1, keyLess) - rows.begin();
+
+    // fingerprint of everything but listfrom - a page flip keeps the fingerprint and moves listfrom
+    uint64 paramsHash = std::hash<std::wstring>()(request.wsearchedname);
+    for (uint32 param : { request.levelmin, request.levelmax, request.inventoryType, request.itemClass, request.itemSubClass, request.quality, uint32(request.locIdx + 1) })
+        paramsHash = paramsHash * 31 + param;
+
+    uint32 totalcount = 0;
+
+    // resume at the stored cursor when the client asks for the page right after the last
+    // one and the snapshot was not replaced in between (weak_ptr still locks to it)
+    bool resumed = false;
+    std::unordered_map<uint32, SearchCursor>::iterator cursorItr = m_cursors.find(request.accountId);
+    if (cursorItr != m_cursors.end())
+    {
+        SearchCursor const& cursor = cursorItr->second;
+        if (cursor.paramsHash == paramsHash && cursor.nextOffset == request.listfrom && cursor.snapshot.lock() == request.snapshot)
+        {
+            first = cursor.nextRow;
+            totalcount = cursor.total;
+            resumed = true;
+        }
+    }
+
+    WorldPacket data(SMSG_AUCTION_LIST_RESULT, (4 + 4));
+    data << uint32(0);                                      // amount place holder
+
+    uint32 count = 0;
+    uint32 matched = resumed ? request.listfrom : 0;        // matches before the current row
+    size_t nextRow = rows.size();                           // resume point for the next page
+    time_t curTime = time(nullptr);
+
+    for (size_t i = first; i < last; ++i)
+    {
+        AuctionSearchRow const& row = rows[i];
+
+        if (request.inventoryType != 0xffffffff && row.itemInvType != request.inventoryType)
+        {
+            if (request.inventoryType != INVTYPE_CHEST || row.itemInvType != INVTYPE_ROBE)
+            {
+                // if inventory type is chest, we want to return robes too
+                // i.e. cloth chests are in most cases robes by definition
+
+                continue;
+            }
+        }
+
+        if (request.quality != 0xffffffff && row.itemQuality < request.quality)
+            continue;
+
+        if (request.levelmin != 0x00 && (row.itemLevel < request.levelmin || (request.levelmax != 0x00 && row.itemLevel > request.levelmax)))
+            continue;
+
+        if (!request.wsearchedname.empty())
+        {
+            ItemPrototype const* proto = ObjectMgr::GetItemPrototype(row.itemTemplate);
+            if (!proto)
+                continue;
+
+            std::string name = proto->Name1;
+            sObjectMgr.GetItemLocaleStrings(proto->ItemId, request.locIdx, &name);
+
+            if (!Utf8FitTo(name, request.wsearchedname))
+                continue;
+        }
+
+        if (matched >= request.listfrom && count < MAX_AUCTION_ITEMS_CLIENT_UI_PAGE)
+        {
+            ++count;
+
+            data << uint32(row.auctionId);
+            data << uint32(row.itemTemplate);
+            data << uint32(row.enchantId);
+            data << uint32(row.randomPropertyId);
+            data << uint32(row.suffixFactor);
+            data << uint32(row.itemCount);
+            data << uint32(row.spellCharges);
+            data << ObjectGuid(HIGHGUID_PLAYER, row.owner);
+            data << uint32(row.startbid);
+            data << uint32(row.bid ? std::max(row.bid / 100 * 5, 1u) : 0); // minimal outbid, see AuctionEntry::GetAuctionOutBid
+            data << uint32(row.buyout);
+            data << uint32((row.expireTime - curTime) * IN_MILLISECONDS);
+            data << ObjectGuid(HIGHGUID_PLAYER, row.bidder);
+            data << uint32(row.bid);
+        }
+        else if (matched >= request.listfrom + MAX_AUCTION_ITEMS_CLIENT_UI_PAGE && nextRow == rows.size())
+        {
+            nextRow = i;
+            if (resumed)                                    // total is already known from the first scan
+                break;
+        }
+
+        ++matched;
+    }
+
+    if (!resumed)
+        totalcount = matched;
+
+    data.put<uint32>(0, count);
+    data << uint32(totalcount);
+
+    SearchCursor cursor;
+    cursor.snapshot = request.snapshot;
+    cursor.paramsHash = paramsHash;
+    cursor.nextRow = nextRow;
+    cursor.nextOffset = request.listfrom + count;
+    cursor.total = totalcount;
+    m_cursors[request.accountId] = cursor;
+
+    // hand the finished packet back to the world thread for delivery
+    sWorld.GetMessager().AddMessage([accountId = request.accountId, data](World* world)
+    {
+        if (WorldSession* session = world->FindSession(accountId))
+            session->SendPacket(data);
+    });
+}
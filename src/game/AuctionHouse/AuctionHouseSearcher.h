@@ -0,0 +1,110 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _AUCTION_HOUSE_SEARCHER_H
+#define _AUCTION_HOUSE_SEARCHER_H
+
+#include "Common.h"
+#include "Multithreading/Messager.h"
+
+#include <memory>
+#include <unordered_map>
+
+// composite search key: item class / subclass / auction id, so that both a class range
+// and a class+subclass range are contiguous and ordered by auction id
+inline uint64 MakeAuctionSearchKey(uint32 itemClass, uint32 itemSubClass, uint32 id)
+{
+    return (uint64(itemClass & 0xff) << 40) | (uint64(itemSubClass & 0xff) << 32) | uint64(id);
+}
+
+// one auction flattened for searching off the world thread: filter attributes plus
+// everything the client list entry needs, captured while the item still may be touched
+struct AuctionSearchRow
+{
+    uint64 searchKey;
+    uint32 auctionId;
+    uint32 itemTemplate;
+    uint32 itemInvType;
+    uint32 itemQuality;
+    uint32 itemLevel;
+    uint32 enchantId;
+    int32  randomPropertyId;
+    uint32 suffixFactor;
+    uint32 itemCount;
+    int32  spellCharges;
+    uint32 owner;
+    uint32 startbid;
+    uint32 bid;
+    uint32 buyout;
+    time_t expireTime;
+    uint32 bidder;
+};
+
+// immutable per-generation copy of one auction house, rows sorted by searchKey;
+// rebuilt on the world thread only when the house content changed since the last search
+struct AuctionSearchSnapshot
+{
+    std::vector<AuctionSearchRow> rows;
+    uint32 generation;
+};
+
+// a list search as handed over to the search thread
+struct AuctionSearchRequest
+{
+    uint32 accountId;
+    std::shared_ptr<AuctionSearchSnapshot const> snapshot;
+    std::wstring wsearchedname;
+    uint32 listfrom;
+    uint32 levelmin;
+    uint32 levelmax;
+    uint32 inventoryType;
+    uint32 itemClass;
+    uint32 itemSubClass;
+    uint32 quality;
+    int locIdx;
+};
+
+// Executes auction list searches on a dedicated thread against immutable snapshots and
+// sends the finished packet back through the world messager - same pattern as LFGQueue
+class AuctionHouseSearcher
+{
+    public:
+        void Update();                                      // thread loop, ran from World::StartAuctionHouseSearchThread
+
+        Messager<AuctionHouseSearcher>& GetMessager() { return m_messager; }
+
+        void ExecuteSearch(AuctionSearchRequest const& request); // search thread only
+
+    private:
+        // last search of an account; the next page resumes at the stored row when the
+        // snapshot is still the live one (weak_ptr expires together with the snapshot)
+        struct SearchCursor
+        {
+            std::weak_ptr<AuctionSearchSnapshot const> snapshot;
+            uint64 paramsHash;                              // fingerprint of the filter set the cursor was built for
+            size_t nextRow;                                 // first row index not returned yet
+            uint32 nextOffset;                              // listfrom value the cursor can resume at
+            uint32 total;                                   // total match count, counted on the first scan
+        };
+
+        std::unordered_map<uint32, SearchCursor> m_cursors; // by account id, search thread only
+
+        Messager<AuctionHouseSearcher> m_messager;
+};
+
+#endif
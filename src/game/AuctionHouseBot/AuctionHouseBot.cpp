@@ -254,14 +254,16 @@ void AuctionHouseBot::Update()
         }
     } else if (m_houseAction >= MAX_AUCTION_HOUSE_TYPE && urand(0, 99) < m_chanceBuy)
     {
-        // Buy items
-        AuctionHouseObject::AuctionEntryMapBounds bounds = auctionHouse->GetAuctionsBounds();
+        // Buy items - the house maintains the subset of auctions a player posted
+        // or bid on, so this pass no longer walks the bot's own listings
+        std::set<uint32> const& candidates = auctionHouse->GetPlayerInterestAuctions();
         std::vector<AuctionEntry*> buyoutAuctions;
-        for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+        for (std::set<uint32>::const_iterator idItr = candidates.begin(); idItr != candidates.end();)
         {
-            AuctionEntry* auction = itr->second;
-            if (auction->owner == 0 && auction->bid == 0)
-                continue; // ignore bidding/buying auctions that were created by ahbot and not bidded on by player
+            // advance before use: a winning bid removes the auction from the set
+            AuctionEntry* auction = auctionHouse->GetAuction(*(idItr++));
+            if (!auction)
+                continue;
             Item* item = sAuctionMgr.GetAItem(auction->itemGuidLow);
             if (!item)
                 continue; // shouldn't happen, but apparently it does(?)
@@ -324,28 +326,11 @@ void AuctionHouseBot::PrepareStatusInfos(AuctionHouseBotStatusInfo& statusInfo)
 {
     for (uint32 i = 0; i < MAX_AUCTION_HOUSE_TYPE; ++i)
     {
-        statusInfo[i].ItemsCount = 0;
-
-        for (unsigned int& j : statusInfo[i].QualityInfo)
-            j = 0;
-
-        AuctionHouseObject::AuctionEntryMapBounds bounds = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i))->GetAuctionsBounds();
-        for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-        {
-            AuctionEntry* entry = itr->second;
-            if (Item* item = sAuctionMgr.GetAItem(entry->itemGuidLow))
-            {
-                ItemPrototype const* prototype = item->GetProto();
-                if (!entry->owner)
-                {
-                    // count only ahbot auctions
-                    if (prototype->Quality < MAX_ITEM_QUALITY)
-                        ++statusInfo[i].QualityInfo[prototype->Quality];
-
-                    ++statusInfo[i].ItemsCount;
-                }
-            }
-        }
+        // the house keeps these totals current on post/sell/expire
+        AuctionHouseObject::MarketAggregates const& aggregates = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i))->GetMarketAggregates();
+        statusInfo[i].ItemsCount = aggregates.botAuctionCount;
+        for (uint32 j = 0; j < MAX_ITEM_QUALITY; ++j)
+            statusInfo[i].QualityInfo[j] = aggregates.botQualityCount[j];
     }
 }
 
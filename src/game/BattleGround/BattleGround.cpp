@@ -704,7 +704,6 @@ void BattleGround::EndBattleGround(Team winner)
     int32 winmsg_id = 0;
 
     uint32 bgScoresWinner = TEAM_INDEX_NEUTRAL;
-    uint64 battleground_id = 1;
 
     if (winner == ALLIANCE)
     {
@@ -729,26 +728,8 @@ void BattleGround::EndBattleGround(Team winner)
     else
         SetWinner(WINNER_NONE);
 
-    // store battleground scores
-    if (sWorld.getConfig(CONFIG_BOOL_BATTLEGROUND_SCORE_STATISTICS))
-    {
-        static SqlStatementID insPvPstatsBattleground;
-
-        SqlStatement stmt = CharacterDatabase.CreateStatement(insPvPstatsBattleground, "INSERT INTO pvpstats_battlegrounds (id, winner_team, bracket_id, type, date) VALUES (?, ?, ?, ?, " _NOW_ ")");
-
-        uint8 battleground_bracket = GetMinLevel() / 10;
-        uint8 battleground_type = (uint8)GetTypeId();
-
-        // query next id
-        auto queryResult = CharacterDatabase.Query("SELECT MAX(id) FROM pvpstats_battlegrounds");
-        if (queryResult)
-        {
-            Field* fields = queryResult->Fetch();
-            battleground_id = fields[0].GetUInt64() + 1;
-        }
-
-        stmt.PExecute(battleground_id, bgScoresWinner, battleground_bracket, battleground_type);
-    }
+    // per-player score rows are buffered here and flushed as one transaction after the loop
+    std::vector<std::pair<uint32, BattleGroundScore*>> statsRows;
 
     SetStatus(STATUS_WAIT_LEAVE);
     // we must set it this way, because end time is sent in packet!
@@ -797,28 +778,11 @@ void BattleGround::EndBattleGround(Team winner)
         // this line is obsolete - team is set ALWAYS
         // if(!team) team = plr->GetTeam();
 
-        // store battleground score statistics for each player
+        // buffer battleground score statistics for each player - the scores stay owned by m_playerScores
         if (sWorld.getConfig(CONFIG_BOOL_BATTLEGROUND_SCORE_STATISTICS))
         {
-            static SqlStatementID insPvPstatsPlayer;
             BattleGroundScoreMap::iterator score = m_playerScores.find(m_Player.first);
-            SqlStatement stmt = CharacterDatabase.CreateStatement(insPvPstatsPlayer, "INSERT INTO pvpstats_players (battleground_id, character_guid, score_killing_blows, score_deaths, score_honorable_kills, score_bonus_honor, score_damage_done, attr_1, attr_2, attr_3, attr_4, attr_5) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-
-            stmt.addUInt32(battleground_id);
-            stmt.addUInt32(plr->GetGUIDLow());
-            BattleGroundScore *pScore = score->second;
-            stmt.addUInt32(pScore->GetKillingBlows());
-            stmt.addUInt32(pScore->GetDeaths());
-            stmt.addUInt32(pScore->GetHonorableKills());
-            stmt.addUInt32(pScore->GetBonusHonor());
-            stmt.addUInt32(pScore->GetDishonorableKills());
-            stmt.addUInt32(pScore->GetAttr1());
-            stmt.addUInt32(pScore->GetAttr2());
-            stmt.addUInt32(pScore->GetAttr3());
-            stmt.addUInt32(pScore->GetAttr4());
-            stmt.addUInt32(pScore->GetAttr5());
-
-            stmt.Execute();
+            statsRows.emplace_back(plr->GetGUIDLow(), score->second);
         }
 
         if (team == winner)
@@ -841,6 +805,43 @@ void BattleGround::EndBattleGround(Team winner)
         plr->GetSession()->SendPacket(data);
     }
 
+    // flush the whole match result as a single transaction - one op for the DB delay thread instead of one write per player
+    if (!statsRows.empty())
+    {
+        static SqlStatementID insPvPstatsBattleground;
+        static SqlStatementID insPvPstatsPlayer;
+
+        uint64 battleground_id = sBattleGroundMgr.GenerateBattlegroundStatsId();
+
+        CharacterDatabase.BeginTransaction();
+
+        SqlStatement stmt = CharacterDatabase.CreateStatement(insPvPstatsBattleground, "INSERT INTO pvpstats_battlegrounds (id, winner_team, bracket_id, type, date) VALUES (?, ?, ?, ?, " _NOW_ ")");
+        stmt.PExecute(battleground_id, bgScoresWinner, uint8(GetMinLevel() / 10), uint8(GetTypeId()));
+
+        for (auto const& statsRow : statsRows)
+        {
+            SqlStatement playerStmt = CharacterDatabase.CreateStatement(insPvPstatsPlayer, "INSERT INTO pvpstats_players (battleground_id, character_guid, score_killing_blows, score_deaths, score_honorable_kills, score_bonus_honor, score_damage_done, attr_1, attr_2, attr_3, attr_4, attr_5) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+
+            playerStmt.addUInt32(battleground_id);
+            playerStmt.addUInt32(statsRow.first);
+            BattleGroundScore* pScore = statsRow.second;
+            playerStmt.addUInt32(pScore->GetKillingBlows());
+            playerStmt.addUInt32(pScore->GetDeaths());
+            playerStmt.addUInt32(pScore->GetHonorableKills());
+            playerStmt.addUInt32(pScore->GetBonusHonor());
+            playerStmt.addUInt32(pScore->GetDishonorableKills());
+            playerStmt.addUInt32(pScore->GetAttr1());
+            playerStmt.addUInt32(pScore->GetAttr2());
+            playerStmt.addUInt32(pScore->GetAttr3());
+            playerStmt.addUInt32(pScore->GetAttr4());
+            playerStmt.addUInt32(pScore->GetAttr5());
+
+            playerStmt.Execute();
+        }
+
+        CharacterDatabase.CommitTransaction();
+    }
+
     // AV message is different - TODO: check if others are also wrong
     if (winmsg_id && GetTypeId() != BATTLEGROUND_AV)
         SendMessageToAll(winmsg_id, CHAT_MSG_BG_SYSTEM_NEUTRAL);
@@ -41,7 +41,7 @@ INSTANTIATE_SINGLETON_1(BattleGroundMgr);
 /***            BATTLEGROUND MANAGER                   ***/
 /*********************************************************/
 
-BattleGroundMgr::BattleGroundMgr() : m_testing(false)
+BattleGroundMgr::BattleGroundMgr() : m_testing(false), m_nextPvpStatsId(1)
 {
     for (uint8 i = BATTLEGROUND_TYPE_NONE; i < MAX_BATTLEGROUND_TYPE_ID; ++i)
         m_battleGrounds[i].clear();
@@ -432,6 +432,13 @@ void BattleGroundMgr::AddBattleGround(uint32 instanceId, BattleGroundTypeId bgTy
 */
 void BattleGroundMgr::CreateInitialBattleGrounds()
 {
+    // seed the pvpstats id sequence here so EndBattleGround does not need a synchronous MAX(id) lookup
+    if (sWorld.getConfig(CONFIG_BOOL_BATTLEGROUND_SCORE_STATISTICS))
+    {
+        if (auto queryResult = CharacterDatabase.Query("SELECT MAX(id) FROM pvpstats_battlegrounds"))
+            m_nextPvpStatsId = queryResult->Fetch()[0].GetUInt64() + 1;
+    }
+
     uint32 count = 0;
     //                                             0   1                 2                 3      4      5                6             7            8
     auto queryResult = WorldDatabase.Query("SELECT id, MinPlayersPerTeam,MaxPlayersPerTeam,MinLvl,MaxLvl,AllianceStartLoc,HordeStartLoc,StartMaxDist,PlayerSkinReflootId FROM battleground_template");
@@ -25,6 +25,7 @@
 #include "BattleGround.h"
 #include "BattleGround/BattleGroundDefines.h"
 
+#include <atomic>
 #include <mutex>
 
 typedef std::map<uint32, MaNGOS::unique_trackable_ptr<BattleGround>> BattleGroundSet;
@@ -118,6 +119,9 @@ class BattleGroundMgr
 
         std::set<uint32> const& GetUsedRefLootIds() const { return m_usedRefloot; }
 
+        // next pvpstats_battlegrounds id - seeded once at startup so match end does not query MAX(id); atomic because bgs end on map update threads
+        uint64 GenerateBattlegroundStatsId() { return m_nextPvpStatsId++; }
+
         uint32 GetMinLevelForBattleGroundBracketId(BattleGroundBracketId bracket_id, BattleGroundTypeId bgTypeId) const;
         uint32 GetMaxLevelForBattleGroundBracketId(BattleGroundBracketId bracket_id, BattleGroundTypeId bgTypeId) const;
         BattleGroundBracketId GetBattleGroundBracketIdFromLevel(BattleGroundTypeId bgTypeId, uint32 playerLevel) const;
@@ -133,6 +137,7 @@ class BattleGroundMgr
         BattleGroundSet m_battleGrounds[MAX_BATTLEGROUND_TYPE_ID];
         bool m_testing;
         std::set<uint32> m_usedRefloot;
+        std::atomic<uint64> m_nextPvpStatsId;
 
         Messager<BattleGroundMgr> m_messager;
 };
@@ -42,6 +42,10 @@ BattleGroundQueueItem::BattleGroundQueueItem()
                 m_waitTimes[i][j][k] = 0;
         }
     }
+
+    for (uint8 i = 0; i < MAX_BATTLEGROUND_BRACKETS; ++i)
+        for (uint8 j = 0; j < BG_QUEUE_GROUP_TYPES_COUNT; ++j)
+            m_eligiblePlayers[i][j] = 0;
 }
 
 BattleGroundQueueItem::~BattleGroundQueueItem()
@@ -176,6 +180,8 @@ GroupQueueInfo* BattleGroundQueueItem::AddGroup(ObjectGuid leader, AddGroupToQue
     if (queueInfo->groupTeam == HORDE)
         ++index;                                            // BG_QUEUE_*_ALLIANCE -> BG_QUEUE_*_HORDE
 
+    queueInfo->queueIndex = index;
+
     DEBUG_LOG("Adding Group to BattleGroundQueueItem bgTypeId : %u, bracket_id : %u, index : %u", bgTypeId, bracketId, index);
 
     uint32 lastOnlineTime = WorldTimer::getMSTime();
@@ -203,6 +209,7 @@ GroupQueueInfo* BattleGroundQueueItem::AddGroup(ObjectGuid leader, AddGroupToQue
 
         // add GroupInfo to m_QueuedGroups
         m_queuedGroups[bracketId][index].push_back(queueInfo);
+        m_eligiblePlayers[bracketId][index] += queueInfo->players.size();
 
         // announce to world, this code needs mutex
         if (!isPremade && sWorld.getConfig(CONFIG_UINT32_BATTLEGROUND_QUEUE_ANNOUNCER_JOIN))
@@ -211,18 +218,10 @@ GroupQueueInfo* BattleGroundQueueItem::AddGroup(ObjectGuid leader, AddGroupToQue
             {
                 char const* bgName = bg->GetName();
                 uint32 minPlayers = bg->GetMinPlayersPerTeam();
-                uint32 qHorde = 0;
-                uint32 qAlliance = 0;
                 uint32 q_min_level = sBattleGroundMgr.GetMinLevelForBattleGroundBracketId(bracketId, bgTypeId);
                 uint32 qMaxLevel = sBattleGroundMgr.GetMaxLevelForBattleGroundBracketId(bracketId, bgTypeId);
-                GroupsQueueType::const_iterator itr;
-                for (itr = m_queuedGroups[bracketId][BG_QUEUE_NORMAL_ALLIANCE].begin(); itr != m_queuedGroups[bracketId][BG_QUEUE_NORMAL_ALLIANCE].end(); ++itr)
-                    if (!(*itr)->isInvitedToBgInstanceGuid)
-                        qAlliance += (*itr)->players.size();
-
-                for (itr = m_queuedGroups[bracketId][BG_QUEUE_NORMAL_HORDE].begin(); itr != m_queuedGroups[bracketId][BG_QUEUE_NORMAL_HORDE].end(); ++itr)
-                    if (!(*itr)->isInvitedToBgInstanceGuid)
-                        qHorde += (*itr)->players.size();
+                uint32 qAlliance = m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE];
+                uint32 qHorde = m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_HORDE];
 
                 sWorld.GetMessager().AddMessage([playerGuid = leader, bgName, q_min_level, qMaxLevel, qAlliance, minPlayers, qHorde](World* /*world*/)
                 {
@@ -360,7 +359,12 @@ void BattleGroundQueueItem::RemovePlayer(BattleGroundQueue& queue, ObjectGuid gu
     // remove player queue info from group queue info
     GroupQueueInfoPlayers::iterator pitr = group->players.find(guid);
     if (pitr != group->players.end())
+    {
         group->players.erase(pitr);
+        // invited groups are not counted as eligible anymore
+        if (!group->isInvitedToBgInstanceGuid)
+            --m_eligiblePlayers[bracketId][index];
+    }
 
     // if invited to bg, and should decrease invited count, then do it
     if (decreaseInvitedCount && group->isInvitedToBgInstanceGuid)
@@ -429,6 +433,8 @@ bool BattleGroundQueueItem::InviteGroupToBg(GroupQueueInfo& groupInfo, BattleGro
     if (!groupInfo.isInvitedToBgInstanceGuid)
     {
         // not yet invited
+        // group leaves the eligible pool on invitation
+        m_eligiblePlayers[groupInfo.bgBracketId][groupInfo.queueIndex] -= groupInfo.players.size();
         // set invitation
         groupInfo.isInvitedToBgInstanceGuid = queueInfo.GetInstanceId();
         groupInfo.mapId = queueInfo.GetMapId();
@@ -627,6 +633,10 @@ bool BattleGroundQueueItem::CheckPremadeMatch(BattleGroundBracketId bracketId, u
             if (!(*itr)->isInvitedToBgInstanceGuid && ((*itr)->joinTime < time_before || (*itr)->players.size() < minPlayersPerTeam))
             {
                 // we must insert group to normal queue and erase pointer from premade queue
+                uint32 const movedPlayers = (*itr)->players.size();
+                m_eligiblePlayers[bracketId][BG_QUEUE_PREMADE_ALLIANCE + i] -= movedPlayers;
+                m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE + i] += movedPlayers;
+                (*itr)->queueIndex = BG_QUEUE_NORMAL_ALLIANCE + i;
                 m_queuedGroups[bracketId][BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
                 m_queuedGroups[bracketId][BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr);
             }
@@ -746,6 +756,10 @@ bool BattleGroundQueueItem::CheckSkirmishForSameFaction(BattleGroundBracketId br
         (*itr)->groupTeam = otherTeamId;
 
         // add team to other queue
+        uint32 const movedPlayers = (*itr)->players.size();
+        m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE + teamIdx] -= movedPlayers;
+        m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE + otherTeamIdx] += movedPlayers;
+        (*itr)->queueIndex = BG_QUEUE_NORMAL_ALLIANCE + otherTeamIdx;
         m_queuedGroups[bracketId][BG_QUEUE_NORMAL_ALLIANCE + otherTeamIdx].push_front(*itr);
 
         // remove team from old queue
@@ -783,6 +797,13 @@ void BattleGroundQueueItem::Update(BattleGroundQueue& queue, BattleGroundTypeId
         m_queuedGroups[bracketId][BG_QUEUE_NORMAL_HORDE].empty())
         return;
 
+    // if everyone still queued is already invited - nothing to fill, move or compose until the queue changes again
+    if (!m_eligiblePlayers[bracketId][BG_QUEUE_PREMADE_ALLIANCE] &&
+        !m_eligiblePlayers[bracketId][BG_QUEUE_PREMADE_HORDE] &&
+        !m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE] &&
+        !m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_HORDE])
+        return;
+
     // battleground with free slot for player should be always in the beggining of the queue
     // maybe it would be better to create bgfreeslotqueue for each bracket_id
     BgFreeSlotQueueType::iterator next;
@@ -885,8 +906,13 @@ void BattleGroundQueueItem::Update(BattleGroundQueue& queue, BattleGroundTypeId
     }
 
     // now check if there are in queues enough players to start new game of (normal battleground, or non-rated arena)
+    // cheap pre-check from the eligibility counters before walking the normal queue lists
+    bool const normalMatchPossible = queue.IsTesting()
+        ? (m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE] || m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_HORDE])
+        : (m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_ALLIANCE] >= minPlayersPerTeam && m_eligiblePlayers[bracketId][BG_QUEUE_NORMAL_HORDE] >= minPlayersPerTeam);
+
     // if there are enough players in pools, start new battleground or non rated arena
-    if (CheckNormalMatch(queue, bgTemplate, bracketId, minPlayersPerTeam, maxPlayersPerTeam))
+    if (normalMatchPossible && CheckNormalMatch(queue, bgTemplate, bracketId, minPlayersPerTeam, maxPlayersPerTeam))
     {
         BattleGround* bgTemplate = sBattleGroundMgr.GetBattleGroundTemplate(bgTypeId);
         if (!bgTemplate)
@@ -51,6 +51,7 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  removeInviteTime;                               // time when we will remove invite for players in group
     uint32  isInvitedToBgInstanceGuid;                      // was invited to certain BG
     uint32  desiredInstanceId;                              // queued for this instance specifically
+    uint32  queueIndex;                                     // current index into m_queuedGroups second dimension (kept in sync on queue moves)
 };
 
 struct BattleGroundInQueueInfo
@@ -149,6 +150,11 @@ class BattleGroundQueueItem
         */
         GroupsQueueType m_queuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
 
+        // count of queued players per bracket / group type that are not yet invited to a battleground
+        // maintained incrementally on add / remove / invite / queue moves, so queue events and the
+        // join announcer can decide in O(1) whether a scan of the group lists can produce anything
+        uint32 m_eligiblePlayers[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
+
         // class to select and invite groups to bg
         class SelectionPool
         {
@@ -110,6 +110,7 @@ void Channel::Join(Player* player, const char* password)
 
     PlayerInfo& pinfo = m_players[guid];
     pinfo.player = guid;
+    pinfo.plr = player;
     pinfo.flags = MEMBER_FLAG_NONE;
 
     MakeYouJoined(data, m_name, *this);
@@ -504,7 +505,7 @@ void Channel::SendChannelListResponse(Player* player, bool/* display = false*/)
     uint32 count = 0;
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
     {
-        if (Player* member = sObjectMgr.GetPlayer(i->first))
+        if (Player* member = i->second.plr)
         {
             if (visibilityCheck && (member->GetSession()->GetSecurity() > visibilityThreshold || !member->IsVisibleGloballyFor(player)))
                 continue;
@@ -733,14 +734,20 @@ void Channel::SendToOne(WorldPacket const& data, ObjectGuid receiver) const
 
 void Channel::SendToAll(WorldPacket const& data) const
 {
+    data.GetSharedPayload();                                // snapshot once, before the first socket lock
+
+    // members carry their player pointer, no global guid lookup per recipient
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
-        SendToOne(data, i->first);
+        if (Player* plr = i->second.plr)
+            plr->GetSession()->SendPacket(data);
 }
 
 void Channel::SendMessage(WorldPacket const& data, ObjectGuid sender) const
 {
+    data.GetSharedPayload();
+
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
-        if (Player* plr = sObjectMgr.GetPlayer(i->first))
+        if (Player* plr = i->second.plr)
             if (!sender || !plr->GetSocial()->HasIgnore(sender))
                 plr->GetSession()->SendPacket(data);
 }
@@ -132,6 +132,7 @@ class Channel
         struct PlayerInfo
         {
             ObjectGuid player;
+            Player* plr;                                    // cached on join; entries are erased before the player object goes away
             uint8 flags;
 
             inline bool HasFlag(uint8 flag) const { return (flags & flag) != 0; }
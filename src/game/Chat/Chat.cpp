@@ -409,9 +409,9 @@ ChatCommand* ChatHandler::getCommandTable()
 
     static ChatCommand lookupPlayerCommandTable[] =
     {
-        { "account",        SEC_GAMEMASTER,     true,  &ChatHandler::HandleLookupPlayerAccountCommand, "", nullptr },
-        { "email",          SEC_GAMEMASTER,     true,  &ChatHandler::HandleLookupPlayerEmailCommand,   "", nullptr },
-        { "ip",             SEC_GAMEMASTER,     true,  &ChatHandler::HandleLookupPlayerIpCommand,      "", nullptr },
+        { "account",        SEC_GAMEMASTER,     true,  &ChatHandler::HandleLookupPlayerAccountCommand, "", nullptr, CHAT_COMMAND_FLAG_OFFTHREAD },
+        { "email",          SEC_GAMEMASTER,     true,  &ChatHandler::HandleLookupPlayerEmailCommand,   "", nullptr, CHAT_COMMAND_FLAG_OFFTHREAD },
+        { "ip",             SEC_GAMEMASTER,     true,  &ChatHandler::HandleLookupPlayerIpCommand,      "", nullptr, CHAT_COMMAND_FLAG_OFFTHREAD },
         { nullptr,          0,                  false, nullptr,                                        "", nullptr }
     };
 
@@ -785,16 +785,26 @@ ChatCommand* ChatHandler::getCommandTable()
         { nullptr,          0,                  false, nullptr,                                        "", nullptr }
     };
 
+    static ChatCommand serverInfoCommandTable[] =
+    {
+        { "maps",           SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerInfoMapsCommand,      "", nullptr },
+        { "",               SEC_PLAYER,         true,  &ChatHandler::HandleServerInfoCommand,          "", nullptr },
+        { nullptr,          0,                  false, nullptr,                                        "", nullptr }
+    };
+
     static ChatCommand serverCommandTable[] =
     {
         { "corpses",        SEC_GAMEMASTER,     true,  &ChatHandler::HandleServerCorpsesCommand,       "", nullptr },
         { "exit",           SEC_CONSOLE,        true,  &ChatHandler::HandleServerExitCommand,          "", nullptr },
         { "idlerestart",    SEC_ADMINISTRATOR,  true,  nullptr,                                        "", serverIdleRestartCommandTable },
         { "idleshutdown",   SEC_ADMINISTRATOR,  true,  nullptr,                                        "", serverIdleShutdownCommandTable },
-        { "info",           SEC_PLAYER,         true,  &ChatHandler::HandleServerInfoCommand,          "", nullptr },
+        { "info",           SEC_PLAYER,         true,  nullptr,                                        "", serverInfoCommandTable },
         { "log",            SEC_CONSOLE,        true,  nullptr,                                        "", serverLogCommandTable },
+        { "memtrend",       SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerMemTrendCommand,      "", nullptr },
         { "motd",           SEC_PLAYER,         true,  &ChatHandler::HandleServerMotdCommand,          "", nullptr },
+        { "opcodes",        SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerOpcodesCommand,       "", nullptr },
         { "plimit",         SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerPLimitCommand,        "", nullptr },
+        { "profile",        SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerProfileCommand,       "", nullptr },
         { "resetallraid",   SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerResetAllRaidCommand,  "", nullptr },
         { "restart",        SEC_ADMINISTRATOR,  true,  nullptr,                                        "", serverRestartCommandTable },
         { "shutdown",       SEC_ADMINISTRATOR,  true,  nullptr,                                        "", serverShutdownCommandTable },
@@ -1422,26 +1432,32 @@ void ChatHandler::ExecuteCommand(const char* text)
     {
         case CHAT_COMMAND_OK:
         {
-            SetSentErrorMessage(false);
-            if ((this->*(command->Handler))((char*)text))   // text content destroyed at call
+            if ((command->Flags & CHAT_COMMAND_FLAG_OFFTHREAD) && m_session)
             {
+                // DB-bound read-only command: hand it to the world's command
+                // worker so the scan does not block the world thread. Output
+                // arrives through the session, which is kept alive until the
+                // command finished. Logged here because the worker must not
+                // touch the player object.
                 if (command->SecurityLevel > SEC_PLAYER)
                     LogCommand(fullcmd.c_str());
-            }
-            // some commands have custom error messages. Don't send the default one in these cases.
-            else if (!HasSentErrorMessage())
-            {
-                if (!command->Help.empty())
-                    SendSysMessage(command->Help.c_str());
-                else
-                    SendSysMessage(LANG_CMD_SYNTAX);
 
-                if (ChatCommand* showCommand = (command->Name[0] == '\0' && parentCommand ? parentCommand : command))
-                    if (ChatCommand* childs = showCommand->ChildCommands)
-                        ShowHelpForSubCommands(childs, showCommand->Name);
+                WorldSession* session = m_session;
+                session->IncPendingOffThreadCommands();
 
-                SetSentErrorMessage(true);
+                std::string args = text;
+                ChatCommand* cmd = command;
+                ChatCommand* parent = parentCommand;
+                sWorld.ScheduleOffThreadCommand([session, cmd, parent, args, fullcmd]()
+                {
+                    ChatHandler handler(session);
+                    handler.CallCommandHandler(cmd, parent, args.c_str(), fullcmd.c_str(), false);
+                    session->DecPendingOffThreadCommands();
+                });
+                break;
             }
+
+            CallCommandHandler(command, parentCommand, text, fullcmd.c_str(), true);
             break;
         }
         case CHAT_COMMAND_UNKNOWN_SUBCOMMAND:
@@ -1460,6 +1476,32 @@ void ChatHandler::ExecuteCommand(const char* text)
     }
 }
 
+void ChatHandler::CallCommandHandler(ChatCommand* command, ChatCommand* parentCommand, char const* args, char const* fullcmd, bool logOnSuccess)
+{
+    std::string argsBuf = args;                             // handlers destroy the buffer content while parsing
+
+    SetSentErrorMessage(false);
+    if ((this->*(command->Handler))(argsBuf.data()))
+    {
+        if (logOnSuccess && command->SecurityLevel > SEC_PLAYER)
+            LogCommand(fullcmd);
+    }
+    // some commands have custom error messages. Don't send the default one in these cases.
+    else if (!HasSentErrorMessage())
+    {
+        if (!command->Help.empty())
+            SendSysMessage(command->Help.c_str());
+        else
+            SendSysMessage(LANG_CMD_SYNTAX);
+
+        if (ChatCommand* showCommand = (command->Name[0] == '\0' && parentCommand ? parentCommand : command))
+            if (ChatCommand* childs = showCommand->ChildCommands)
+                ShowHelpForSubCommands(childs, showCommand->Name);
+
+        SetSentErrorMessage(true);
+    }
+}
+
 /**
  * Function find appropriate command and update command security level and help text
  *
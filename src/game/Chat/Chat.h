@@ -47,6 +47,15 @@ class Pet;
 class Player;
 class Unit;
 
+enum ChatCommandFlags
+{
+    // command only reads the databases and sends output through the session;
+    // it may run on the world's command worker thread instead of blocking the
+    // world thread. Handlers carrying this flag must not touch world state or
+    // the player object.
+    CHAT_COMMAND_FLAG_OFFTHREAD = 0x01,
+};
+
 class ChatCommand
 {
     public:
@@ -56,6 +65,7 @@ class ChatCommand
         bool (ChatHandler::*Handler)(char* args);
         std::string        Help;
         ChatCommand*       ChildCommands;
+        uint32             Flags = 0;
 };
 
 enum ChatCommandSearchResult
@@ -185,6 +195,7 @@ class ChatHandler
 
         bool SetDataForCommandInTable(ChatCommand* commandTable, const char* text, uint32 security, std::string const& help);
         void ExecuteCommand(const char* text);
+        void CallCommandHandler(ChatCommand* command, ChatCommand* parentCommand, char const* args, char const* fullcmd, bool logOnSuccess);
         void LogCommand(char const* fullcmd) const;
 
         bool ShowHelpForCommand(ChatCommand* table, const char* cmd);
@@ -635,10 +646,14 @@ class ChatHandler
         bool HandleServerIdleRestartCommand(char* args);
         bool HandleServerIdleShutDownCommand(char* args);
         bool HandleServerInfoCommand(char* args);
+        bool HandleServerInfoMapsCommand(char* args);
+        bool HandleServerMemTrendCommand(char* args);
         bool HandleServerLogFilterCommand(char* args);
         bool HandleServerLogLevelCommand(char* args);
         bool HandleServerMotdCommand(char* args);
         bool HandleServerPLimitCommand(char* args);
+        bool HandleServerOpcodesCommand(char* args);
+        bool HandleServerProfileCommand(char* args);
         bool HandleServerResetAllRaidCommand(char* args);
         bool HandleServerRestartCommand(char* args);
         bool HandleServerSetMotdCommand(char* args);
@@ -97,28 +97,30 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket& recv_data)
 
     DEBUG_LOG("CHAT: packet received. type %u, lang %u", type, lang);
 
-    // prevent talking at unknown language (cheating)
-    LanguageDesc const* langDesc = GetLanguageDescByID(lang);
-    if (!langDesc)
-    {
-        SendNotification(LANG_UNKNOWN_LANGUAGE);
-        return;
-    }
-    if (langDesc->skill_id != 0 && !_player->HasSkill(langDesc->skill_id))
-    {
-        SendNotification(LANG_NOT_LEARNED_LANGUAGE);
-        return;
-    }
-
     if (lang == LANG_ADDON)
     {
         // Disabled addon channel?
         if (!sWorld.getConfig(CONFIG_BOOL_ADDON_CHANNEL))
             return;
     }
-    // LANG_ADDON should not be changed nor be affected by flood control
+    // LANG_ADDON needs no language skill and should not be changed nor be
+    // affected by flood control; skip the whole language block on this lane -
+    // addon sync traffic is by far the highest-volume use of this opcode
     else
     {
+        // prevent talking at unknown language (cheating)
+        LanguageDesc const* langDesc = GetLanguageDescByID(lang);
+        if (!langDesc)
+        {
+            SendNotification(LANG_UNKNOWN_LANGUAGE);
+            return;
+        }
+        if (langDesc->skill_id != 0 && !_player->HasSkill(langDesc->skill_id))
+        {
+            SendNotification(LANG_NOT_LEARNED_LANGUAGE);
+            return;
+        }
+
         // send in universal language if player in .gmon mode (ignore spell effects)
         if (_player->IsGameMaster())
             lang = LANG_UNIVERSAL;
@@ -25,6 +25,7 @@
 #include "Globals/ObjectAccessor.h"
 #include "Tools/Language.h"
 #include "Accounts/AccountMgr.h"
+#include "World/MemoryTrend.h"
 #include "SystemConfig.h"
 #include "revision.h"
 #include "Util/Util.h"
@@ -108,6 +109,28 @@ bool ChatHandler::HandleServerInfoCommand(char* /*args*/)
     return true;
 }
 
+bool ChatHandler::HandleServerInfoMapsCommand(char* /*args*/)
+{
+    std::string text;
+    sWorld.BuildServerInfoMapsText(text);
+    SendSysMessage(text.c_str());
+
+    return true;
+}
+
+bool ChatHandler::HandleServerMemTrendCommand(char* args)
+{
+    uint32 hours = 24;
+    if (*args && !ExtractUInt32(&args, hours))
+        return false;
+
+    if (!hours)
+        hours = 24;
+
+    sMemoryTrend.Report(*this, hours);
+    return true;
+}
+
 bool ChatHandler::HandleDismountCommand(char* /*args*/)
 {
     Player* player = m_session->GetPlayer();
@@ -157,11 +180,8 @@ bool ChatHandler::HandleGMListIngameCommand(char* /*args*/)
     std::list< std::pair<std::string, bool> > names;
 
     {
-        HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-        HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-        for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+        for (Player* player : sObjectAccessor.GetPlayersSnapshot())
         {
-            Player* player = itr->second;
             AccountTypes security = player->GetSession()->GetSecurity();
             if ((player->IsGameMaster() || (security > SEC_PLAYER && security <= (AccountTypes)sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_IN_GM_LIST))) &&
                 (!m_session || player->IsVisibleGloballyFor(m_session->GetPlayer())))
@@ -18,6 +18,7 @@
 
 #include "Common.h"
 #include "Database/DatabaseEnv.h"
+#include "Server/OpcodeStatistics.h"
 #include "Server/WorldSession.h"
 #include "World/World.h"
 #include "Globals/ObjectMgr.h"
@@ -44,6 +45,7 @@
 #include "SystemConfig.h"
 #include "Config/Config.h"
 #include "Mails/Mail.h"
+#include "Metric/FrameProfiler.h"
 #include "Util/Util.h"
 #include "Entities/ItemEnchantmentMgr.h"
 #include "BattleGround/BattleGroundMgr.h"
@@ -153,11 +155,8 @@ bool ChatHandler::HandleBotMapCommand(char* args)
     PSendSysMessage("BOTMAP:BEGIN zone=%u map=%u", zoneId, mapId);
 
     uint32 count = 0;
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType const& players = sObjectAccessor.GetPlayers();
-    for (auto const& it : players)
+    for (Player* p : sObjectAccessor.GetPlayersSnapshot())
     {
-        Player* p = it.second;
         if (!p || !p->IsInWorld())
             continue;
 
@@ -4729,9 +4728,8 @@ bool ChatHandler::HandleResetAllCommand(char* args)
     }
 
     CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE (at_login & '%u') = '0'", atLogin, atLogin);
-    HashMapHolder<Player>::MapType const& plist = sObjectAccessor.GetPlayers();
-    for (const auto& itr : plist)
-        itr.second->SetAtLoginFlag(atLogin);
+    for (Player* player : sObjectAccessor.GetPlayersSnapshot())
+        player->SetAtLoginFlag(atLogin);
 
     return true;
 }
@@ -5940,6 +5938,32 @@ bool ChatHandler::HandleServerPLimitCommand(char* args)
     return true;
 }
 
+/// Dump the heaviest opcode handlers; ".server opcodes reset" restarts the counters
+bool ChatHandler::HandleServerOpcodesCommand(char* args)
+{
+    if (ExtractLiteralArg(&args, "reset"))
+    {
+        OpcodeStatistics::instance().Reset();
+        SendSysMessage("Opcode statistics reset.");
+        return true;
+    }
+
+    for (auto const& line : OpcodeStatistics::instance().Dump(20))
+        PSendSysMessage("%s", line.c_str());
+
+    return true;
+}
+
+/// Dump the worst recent world tick as a flame-graph collapsed stack
+bool ChatHandler::HandleServerProfileCommand(char* /*args*/)
+{
+    std::vector<std::string> lines = metric::FrameProfiler::instance().DumpWorstTick();
+    for (auto const& line : lines)
+        PSendSysMessage("%s", line.c_str());
+
+    return true;
+}
+
 bool ChatHandler::HandleCastCommand(char* args)
 {
     if (!*args)
@@ -215,6 +215,7 @@ void ThreatContainer::clearReferences()
         delete (*i);
     }
     iThreatList.clear();
+    iRefIndex.clear();
 }
 
 //============================================================
@@ -225,13 +226,8 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim)
     if (!victim)
         return nullptr;
 
-    ObjectGuid guid = victim->GetObjectGuid();
-
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-        if ((*i)->getUnitGuid() == guid)
-            return (*i);
-
-    return nullptr;
+    auto itr = iRefIndex.find(victim->GetObjectGuid());
+    return itr != iRefIndex.end() ? itr->second : nullptr;
 }
 
 //============================================================
@@ -289,7 +285,12 @@ void ThreatContainer::update(bool force, bool isPlayer)
 {
     if ((iDirty || force || isPlayer) && iThreatList.size() > 1)
     {
-        iThreatList.sort([&](const HostileReference* lhs, const HostileReference* rhs)->bool
+        // sort a flat scratch copy instead of the list itself: stable_sort over
+        // contiguous pointers is considerably cheaper than list::sort's node
+        // merging, and the existing nodes just get the sorted order written back
+        // (so no iterator into the list is ever invalidated)
+        iSortScratch.assign(iThreatList.begin(), iThreatList.end());
+        std::stable_sort(iSortScratch.begin(), iSortScratch.end(), [&](const HostileReference* lhs, const HostileReference* rhs)->bool
         {
             Unit* owner = lhs->getSource()->getOwner();
             if (isPlayer)
@@ -320,6 +321,7 @@ void ThreatContainer::update(bool force, bool isPlayer)
                 return lhs->GetHostileState() > rhs->GetHostileState();
             return lhs->getThreat() > rhs->getThreat(); // reverse sorting
         });
+        std::copy(iSortScratch.begin(), iSortScratch.end(), iThreatList.begin());
     }
     iDirty = false;
 }
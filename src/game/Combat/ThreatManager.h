@@ -24,7 +24,10 @@
 #include "Utilities/LinkedReference/Reference.h"
 #include "Entities/UnitEvents.h"
 #include "Entities/ObjectGuid.h"
+#include "Entities/ObjectPool.h"
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 //==============================================================
 
@@ -104,6 +107,11 @@ class HostileReference : public Reference<Unit, ThreatManager>
 
         //=================================================
 
+        // combat churn allocates one of these per attacker/target pair;
+        // recycle the blocks like the other per-combat objects
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         HostileReference* next() { return static_cast<HostileReference*>(Reference<Unit, ThreatManager>::next()); }
 
         //=================================================
@@ -143,7 +151,8 @@ class HostileReference : public Reference<Unit, ThreatManager>
 //==============================================================
 class ThreatManager;
 
-typedef std::list<HostileReference*> ThreatList;
+// list nodes recycle through the same free lists as the references they hold
+typedef std::list<HostileReference*, MaNGOS::PoolAllocator<HostileReference*>> ThreatList;
 
 class ThreatContainer
 {
@@ -172,14 +181,18 @@ class ThreatContainer
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* ref) { iThreatList.remove(ref); }
-        void addReference(HostileReference* hostileReference) { iThreatList.push_back(hostileReference); }
+        void remove(HostileReference* ref) { iRefIndex.erase(ref->getUnitGuid()); iThreatList.remove(ref); }
+        void addReference(HostileReference* hostileReference) { iThreatList.push_back(hostileReference); iRefIndex[hostileReference->getUnitGuid()] = hostileReference; }
         void clearReferences();
         // Sort the list if necessary
         void update(bool force, bool isPlayer);
 
         ThreatList iThreatList;
     private:
+        // guid lookup over the list - every hit resolves its attacker ref
+        // through here, which must not cost a walk of the whole threat list
+        std::unordered_map<ObjectGuid, HostileReference*> iRefIndex;
+        std::vector<HostileReference*> iSortScratch;        // reused by update() so each re-sort is allocation free
         bool iDirty;
 };
 
@@ -611,6 +611,7 @@ class ScriptAction
         bool ExecuteDbscriptCommand(WorldObject* pSource, WorldObject* pTarget, Object* pSourceOrItem, bool buddyFound);
 
         const char* GetTableName() const { return m_table; }
+        ScriptMapType GetScriptType() const { return m_scriptType; }
         uint32 GetId() const { return m_script->id; }
         ObjectGuid GetSourceGuid() const { return m_sourceGuid; }
         ObjectGuid GetTargetGuid() const { return m_targetGuid; }
@@ -21,7 +21,7 @@
 #include "Database/DatabaseEnv.h"
 #include "Entities/UpdateData.h"
 
-Bag::Bag(): Item()
+Bag::Bag(): Item(), m_createBlockStale(~uint64(0))
 {
     m_objectType |= (TYPEMASK_ITEM | TYPEMASK_CONTAINER);
     m_objectTypeId = TYPEID_CONTAINER;
@@ -144,6 +144,7 @@ void Bag::RemoveItem(uint8 slot)
 
     m_bagslot[slot] = nullptr;
     SetGuidValue(CONTAINER_FIELD_SLOT_1 + (slot * 2), ObjectGuid());
+    OnSlotItemChanged(slot);
 }
 
 void Bag::StoreItem(uint8 slot, Item* pItem)
@@ -158,16 +159,73 @@ void Bag::StoreItem(uint8 slot, Item* pItem)
         pItem->SetGuidValue(ITEM_FIELD_OWNER, GetOwnerGuid());
         pItem->SetContainer(this);
         pItem->SetSlot(slot);
+        OnSlotItemChanged(slot);
     }
 }
 
+void Bag::AddToClientUpdateList()
+{
+    Item::AddToClientUpdateList();
+
+    m_createBlockStale |= 1;                                // the bag's own block
+}
+
+void Bag::OnSlotItemChanged(uint8 slot)
+{
+    if (slot < MAX_BAG_SIZE)
+        m_createBlockStale |= uint64(1) << (1 + slot);
+}
+
 void Bag::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const
 {
-    Item::BuildCreateUpdateBlockForPlayer(data, target);
+    // create blocks are only ever built for the owner; anything else (a GM
+    // inspecting another player's container) bypasses the cache, since field
+    // visibility can differ per viewer
+    if (!target || target->GetObjectGuid() != GetOwnerGuid())
+    {
+        Item::BuildCreateUpdateBlockForPlayer(data, target);
+
+        for (uint32 i = 0; i < GetBagSize(); ++i)
+            if (m_bagslot[i])
+                m_bagslot[i]->BuildCreateUpdateBlockForPlayer(data, target);
+        return;
+    }
+
+    if (m_createBlockCache.size() != GetBagSize() + 1)
+    {
+        m_createBlockCache.assign(GetBagSize() + 1, ByteBuffer());
+        m_createBlockStale = ~uint64(0);
+    }
+
+    AppendCreateBlock(0, this, data, target);
 
     for (uint32 i = 0; i < GetBagSize(); ++i)
         if (m_bagslot[i])
-            m_bagslot[i]->BuildCreateUpdateBlockForPlayer(data, target);
+            AppendCreateBlock(1 + i, m_bagslot[i], data, target);
+}
+
+void Bag::AppendCreateBlock(uint32 index, Object const* object, UpdateData* data, Player* target) const
+{
+    uint64 const bit = uint64(1) << index;
+
+    // an object with unflushed field changes is serialized directly and left
+    // stale: nothing would invalidate a snapshot taken between two flushes
+    if (object->HasPendingValueChanges())
+    {
+        m_createBlockStale |= bit;
+        object->BuildCreateUpdateBlockForPlayer(data, target);
+        return;
+    }
+
+    ByteBuffer& cached = m_createBlockCache[index];
+    if (m_createBlockStale & bit)
+    {
+        cached.clear();
+        object->BuildCreateUpdateBlock(cached, target);
+        m_createBlockStale &= ~bit;
+    }
+
+    data->AddUpdateBlock(cached);
 }
 
 // If the bag is empty returns true
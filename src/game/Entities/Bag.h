@@ -64,11 +64,23 @@ class Bag : public Item
         void DeleteFromDB() override;
 
         void BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const override;
+        void AddToClientUpdateList() override;
+
+        // drops the cached create block of a slot after its item changed
+        void OnSlotItemChanged(uint8 slot);
 
     protected:
 
+        void AppendCreateBlock(uint32 index, Object const* object, UpdateData* data, Player* target) const;
+
         // Bag Storage space
         Item* m_bagslot[MAX_BAG_SIZE];
+
+        // pre-serialized create blocks for the owner: [0] the bag itself,
+        // [1 + slot] its contents; entries are rebuilt lazily when their
+        // stale bit is set (slot changes, item field changes)
+        mutable std::vector<ByteBuffer> m_createBlockCache;
+        mutable uint64 m_createBlockStale;
 };
 
 inline Item* NewItemOrBag(ItemPrototype const* proto)
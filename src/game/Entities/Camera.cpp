@@ -147,7 +147,37 @@ template void Camera::UpdateVisibilityOf(DynamicObject*, UpdateData&, WorldObjec
 void Camera::UpdateVisibilityForOwner(bool addToWorld)
 {
     MaNGOS::VisibleNotifier notifier(*this);
-    Cell::VisitAllObjects(m_source, notifier, addToWorld ? MAX_VISIBILITY_DISTANCE : m_source->GetVisibilityData().GetVisibilityDistance(), false);
+
+    if (addToWorld)
+        Cell::VisitAllObjects(m_source, notifier, MAX_VISIBILITY_DISTANCE, false);
+    else
+    {
+        // walk the shared per-tick cell snapshots instead of revisiting the
+        // grids - crowded cells are scanned once and diffed per camera
+        Map* map = m_source->GetMap();
+        CellArea area = Cell::CalculateCellArea(m_source->GetPositionX(), m_source->GetPositionY(), m_source->GetVisibilityData().GetVisibilityDistance());
+
+        for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+        {
+            for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+            {
+                for (WorldObject* target : map->GetCellSnapshot(CellPair(x, y)).objects)
+                {
+                    switch (target->GetTypeId())
+                    {
+                        case TYPEID_PLAYER:        UpdateVisibilityOf(static_cast<Player*>(target), notifier.i_data, notifier.i_visibleNow); break;
+                        case TYPEID_UNIT:          UpdateVisibilityOf(static_cast<Creature*>(target), notifier.i_data, notifier.i_visibleNow); break;
+                        case TYPEID_GAMEOBJECT:    UpdateVisibilityOf(static_cast<GameObject*>(target), notifier.i_data, notifier.i_visibleNow); break;
+                        case TYPEID_DYNAMICOBJECT: UpdateVisibilityOf(static_cast<DynamicObject*>(target), notifier.i_data, notifier.i_visibleNow); break;
+                        case TYPEID_CORPSE:        UpdateVisibilityOf(static_cast<Corpse*>(target), notifier.i_data, notifier.i_visibleNow); break;
+                        default: break;
+                    }
+                    notifier.i_clientGUIDs.erase(target->GetObjectGuid());
+                }
+            }
+        }
+    }
+
     notifier.Notify();
 }
 
@@ -39,6 +39,8 @@
 #include "Tools/Language.h"
 #include "Chat/Chat.h"
 #include "Spells/SpellMgr.h"
+#include "Server/StressTestMgr.h"
+#include "Server/ReplayMgr.h"
 #include "Anticheat/Anticheat.hpp"
 
 #ifdef BUILD_DEPRECATED_PLAYERBOT
@@ -190,6 +192,7 @@ bool LoginQueryHolder::Initialize()
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADGROUP,           "SELECT groupId FROM group_member WHERE memberGuid ='%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADBOUNDINSTANCES,  "SELECT id, permanent, map, resettime FROM character_instance LEFT JOIN instance ON instance = id WHERE guid = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADAURAS,           "SELECT caster_guid,item_guid,spell,stackcount,remaincharges,basepoints0,basepoints1,basepoints2,periodictime0,periodictime1,periodictime2,maxduration,remaintime,effIndexMask FROM character_aura WHERE guid = '%u'", m_guid.GetCounter());
+    res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADAURABLOB,        "SELECT version,data FROM character_aura_blob WHERE guid = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADSPELLS,          "SELECT spell,active,disabled FROM character_spell WHERE guid = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADQUESTSTATUS,     "SELECT quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4 FROM character_queststatus WHERE guid = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADWEEKLYQUESTSTATUS, "SELECT quest FROM character_queststatus_weekly WHERE guid = '%u'", m_guid.GetCounter());
@@ -205,13 +208,42 @@ bool LoginQueryHolder::Initialize()
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADBGDATA,          "SELECT instance_id, team, join_x, join_y, join_z, join_o, join_map FROM character_battleground_data WHERE guid = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADACCOUNTDATA,     "SELECT type, time, data FROM character_account_data WHERE guid='%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADSKILLS,          "SELECT skill, value, max FROM character_skills WHERE guid = '%u'", m_guid.GetCounter());
-    res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADMAILS,           "SELECT id,messageType,sender,receiver,subject,itemTextId,expire_time,deliver_time,money,cod,checked,stationery,mailTemplateId,has_items FROM mail WHERE receiver = '%u' ORDER BY id DESC", m_guid.GetCounter());
-    res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS,     "SELECT itemEntry, creatorGuid, giftCreatorGuid, count, duration, charges, flags, enchantments, randomPropertyId, durability, itemTextId, mail_id, item_guid, item_template FROM mail_items JOIN item_instance ON item_guid = guid WHERE receiver = '%u'", m_guid.GetCounter());
+    // mailbox contents load lazily on first mailbox interaction, login only needs the unread count and next delivery time
+    res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADMAILSUMMARY,     "SELECT COUNT(CASE WHEN deliver_time <= " _UNIXTIME_ " AND (checked & 1) = 0 THEN 1 END), MIN(CASE WHEN deliver_time > " _UNIXTIME_ " THEN deliver_time END) FROM mail WHERE receiver = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_FORGOTTEN_SKILLS,    "SELECT skill, value FROM character_forgotten_skills WHERE guid = '%u'", m_guid.GetCounter());
 
     return res;
 }
 
+enum CharCreateQuery
+{
+    CHAR_CREATE_QUERY_REALM_COUNT = 0,
+    CHAR_CREATE_QUERY_RACES,
+
+    MAX_CHAR_CREATE_QUERY
+};
+
+// groups the character-DB reads of the async character creation pipeline
+class CharCreateQueryHolder : public SqlQueryHolder
+{
+    private:
+        uint32 m_accountId;
+    public:
+        explicit CharCreateQueryHolder(uint32 accountId) : m_accountId(accountId) {}
+        uint32 GetAccountId() const { return m_accountId; }
+        bool Initialize();
+};
+
+bool CharCreateQueryHolder::Initialize()
+{
+    SetSize(MAX_CHAR_CREATE_QUERY);
+
+    bool res = true;
+    res &= SetPQuery(CHAR_CREATE_QUERY_REALM_COUNT, "SELECT COUNT(guid) FROM characters WHERE account = '%u'", m_accountId);
+    res &= SetPQuery(CHAR_CREATE_QUERY_RACES,       "SELECT race FROM characters WHERE account = '%u'", m_accountId);
+    return res;
+}
+
 // don't call WorldSession directly
 // it may get deleted before the query callbacks get executed
 // instead pass an account id to this handler
@@ -229,6 +261,42 @@ class CharacterHandler
             session->HandleCharEnum(result);
         }
 
+        void HandleCharCreateAccountCallback(QueryResult* result, uint32 account)
+        {
+            WorldSession* session = sWorld.FindSession(account);
+            if (!session)
+            {
+                delete result;
+                return;
+            }
+            session->HandleCharCreateAccountChecked(result);
+        }
+
+        void HandleCharCreateQueriesCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
+        {
+            if (!holder)
+                return;
+
+            WorldSession* session = sWorld.FindSession(((CharCreateQueryHolder*)holder)->GetAccountId());
+            if (!session)
+            {
+                delete holder;
+                return;
+            }
+            session->HandleCharCreateFinalize(holder);
+        }
+
+        void HandleCharDeleteCallback(QueryResult* result, uint32 account)
+        {
+            WorldSession* session = sWorld.FindSession(account);
+            if (!session)
+            {
+                delete result;
+                return;
+            }
+            session->HandleCharDeleteConfirmed(result);
+        }
+
         void HandlePlayerLoginCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
         {
             if (!holder) return;
@@ -284,6 +352,63 @@ class CharacterHandler
             masterSession->GetPlayer()->GetPlayerbotMgr()->OnBotLogin(botSession->GetPlayer());
         }
 #endif
+
+        // Creates the socketless session for a stress-test character once its
+        // login queries finished - same mechanism as the bot logins above
+        void HandleStressSessionLoginCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
+        {
+            if (!holder)
+                return;
+
+            LoginQueryHolder* lqh = (LoginQueryHolder*)holder;
+            if (sObjectMgr.GetPlayer(lqh->GetGuid()))
+            {
+                delete holder;
+                return;
+            }
+
+            uint32 const guidLow = lqh->GetGuid().GetCounter();
+            WorldSession* session = new WorldSession(lqh->GetAccountId(), nullptr, SEC_PLAYER, 0, DEFAULT_LOCALE, "", 0);
+            session->SetNoAnticheat();
+            session->HandlePlayerLogin(lqh); // will delete lqh
+
+            if (!session->GetPlayer())
+            {
+                sLog.outError("StressTest: failed to log in character %u", guidLow);
+                delete session;
+                return;
+            }
+
+            sStressTestMgr.OnSessionLogin(session);
+        }
+
+        // Same socketless mechanism for a character being driven by a replay capture
+        void HandleReplaySessionLoginCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
+        {
+            if (!holder)
+                return;
+
+            LoginQueryHolder* lqh = (LoginQueryHolder*)holder;
+            if (sObjectMgr.GetPlayer(lqh->GetGuid()))
+            {
+                delete holder;
+                return;
+            }
+
+            uint32 const guidLow = lqh->GetGuid().GetCounter();
+            WorldSession* session = new WorldSession(lqh->GetAccountId(), nullptr, SEC_PLAYER, 0, DEFAULT_LOCALE, "", 0);
+            session->SetNoAnticheat();
+            session->HandlePlayerLogin(lqh); // will delete lqh
+
+            if (!session->GetPlayer())
+            {
+                sLog.outError("Replay: failed to log in character %u", guidLow);
+                delete session;
+                return;
+            }
+
+            sReplayMgr.OnSessionLogin(session);
+        }
 } chrHandler;
 
 void WorldSession::HandleCharEnum(QueryResult* result)
@@ -310,11 +435,27 @@ void WorldSession::HandleCharEnum(QueryResult* result)
 
     data.put<uint8>(0, num);
 
+    if (sWorld.getConfig(CONFIG_BOOL_CHAR_ENUM_CACHE))
+        sWorld.SetCharacterEnumCache(GetAccountId(), std::vector<uint8>(data.contents(), data.contents() + data.size()));
+
     m_anticheat->SendCharEnum(std::move(data));
 }
 
 void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recv_data*/)
 {
+    // serve repeated character screen visits from the cached enum payload
+    if (sWorld.getConfig(CONFIG_BOOL_CHAR_ENUM_CACHE))
+    {
+        std::vector<uint8> cached;
+        if (sWorld.GetCharacterEnumCache(GetAccountId(), cached))
+        {
+            WorldPacket data(SMSG_CHAR_ENUM, cached.size());
+            data.append(cached.data(), cached.size());
+            m_anticheat->SendCharEnum(std::move(data));
+            return;
+        }
+    }
+
     /// get all the data necessary for loading all characters (along with their pets) on the account
     CharacterDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharEnumCallback, GetAccountId(),
                                   //           0               1                2                3                 4                  5                       6                        7
@@ -346,6 +487,13 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
 
     WorldPacket data(SMSG_CHAR_CREATE, 1);                  // returned with diff.values in all cases
 
+    if (m_charCreateInfo)                                   // previous creation on this session still in flight
+    {
+        data << (uint8)CHAR_CREATE_ERROR;
+        SendPacket(data, true);
+        return;
+    }
+
     if (GetSecurity() == SEC_PLAYER)
     {
         if (uint32 mask = sWorld.getConfig(CONFIG_UINT32_CHARACTERS_CREATING_DISABLED))
@@ -420,31 +568,93 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
         return;
     }
 
-    auto resultacct = LoginDatabase.PQuery("SELECT SUM(numchars) FROM realmcharacters WHERE acctid = '%u'", GetAccountId());
-    if (resultacct)
+    // optimistic reservation: answers the name race between two in-flight creates
+    // without holding any lock across the DB roundtrips below
+    if (!sObjectMgr.ReservePendingCharacterName(name))
+    {
+        data << (uint8)CHAR_CREATE_NAME_IN_USE;
+        SendPacket(data, true);
+        return;
+    }
+
+    m_charCreateInfo.reset(new CharacterCreateInfo());
+    m_charCreateInfo->name       = name;
+    m_charCreateInfo->race       = race_;
+    m_charCreateInfo->class_     = class_;
+    m_charCreateInfo->gender     = gender;
+    m_charCreateInfo->skin       = skin;
+    m_charCreateInfo->face       = face;
+    m_charCreateInfo->hairStyle  = hairStyle;
+    m_charCreateInfo->hairColor  = hairColor;
+    m_charCreateInfo->facialHair = facialHair;
+    m_charCreateInfo->outfitId   = outfitId;
+
+    // the remaining checks need DB roundtrips - run them off the DB threads and
+    // answer the client from the callbacks
+    LoginDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharCreateAccountCallback, GetAccountId(),
+                              "SELECT SUM(numchars) FROM realmcharacters WHERE acctid = '%u'", GetAccountId());
+}
+
+// abandon the in-flight creation: free the reserved name and answer the client
+void WorldSession::CharCreateAbort(uint8 result)
+{
+    sObjectMgr.ReleasePendingCharacterName(m_charCreateInfo->name);
+    m_charCreateInfo.reset();
+
+    WorldPacket data(SMSG_CHAR_CREATE, 1);
+    data << result;
+    SendPacket(data, true);
+}
+
+void WorldSession::HandleCharCreateAccountChecked(QueryResult* result)
+{
+    if (!m_charCreateInfo)                                  // session state vanished while the query was in flight
     {
-        Field* fields = resultacct->Fetch();
+        delete result;
+        return;
+    }
+
+    if (result)
+    {
+        Field* fields = result->Fetch();
         uint32 acctcharcount = fields[0].GetUInt32();
+        delete result;
 
         if (acctcharcount >= sWorld.getConfig(CONFIG_UINT32_CHARACTERS_PER_ACCOUNT))
         {
-            data << (uint8)CHAR_CREATE_ACCOUNT_LIMIT;
-            SendPacket(data, true);
+            CharCreateAbort(CHAR_CREATE_ACCOUNT_LIMIT);
             return;
         }
     }
 
-    auto queryResult = CharacterDatabase.PQuery("SELECT COUNT(guid) FROM characters WHERE account = '%u'", GetAccountId());
+    CharCreateQueryHolder* holder = new CharCreateQueryHolder(GetAccountId());
+    if (!holder->Initialize())
+    {
+        delete holder;                                      // delete all unprocessed queries
+        CharCreateAbort(CHAR_CREATE_ERROR);
+        return;
+    }
+
+    CharacterDatabase.DelayQueryHolder(&chrHandler, &CharacterHandler::HandleCharCreateQueriesCallback, holder);
+}
+
+void WorldSession::HandleCharCreateFinalize(SqlQueryHolder* holder)
+{
+    if (!m_charCreateInfo)                                  // session state vanished while the queries were in flight
+    {
+        delete holder;
+        return;
+    }
+
     uint8 charcount = 0;
-    if (queryResult)
+    if (auto countResult = holder->GetResult(CHAR_CREATE_QUERY_REALM_COUNT))
     {
-        Field* fields = queryResult->Fetch();
-        charcount = fields[0].GetUInt8();
+        charcount = (*countResult)[0].GetUInt8();
 
         if (charcount >= sWorld.getConfig(CONFIG_UINT32_CHARACTERS_PER_REALM))
         {
-            data << (uint8)CHAR_CREATE_SERVER_LIMIT;
-            SendPacket(data, true);
+            delete holder;
+            CharCreateAbort(CHAR_CREATE_SERVER_LIMIT);
             return;
         }
     }
@@ -453,53 +663,51 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
     CinematicsSkipMode skipCinematics = CinematicsSkipMode(sWorld.getConfig(CONFIG_UINT32_SKIP_CINEMATICS));
 
     bool have_same_race = false;
-    if (!AllowTwoSideAccounts || skipCinematics == CINEMATICS_SKIP_SAME_RACE)
+    if (auto raceResult = holder->GetResult(CHAR_CREATE_QUERY_RACES))
     {
-        auto queryResult2 = CharacterDatabase.PQuery("SELECT race FROM characters WHERE account = '%u' %s",
-                               GetAccountId(), (skipCinematics == CINEMATICS_SKIP_SAME_RACE) ? "" : "LIMIT 1");
-        if (queryResult2)
-        {
-            Team team_ = Player::TeamForRace(race_);
+        Team team_ = Player::TeamForRace(m_charCreateInfo->race);
 
-            Field* field = queryResult2->Fetch();
-            uint8 acc_race  = field[0].GetUInt32();
+        Field* field = raceResult->Fetch();
+        uint8 acc_race  = field[0].GetUInt32();
 
-            // need to check team only for first character
-            // TODO: what to if account already has characters of both races?
-            if (!AllowTwoSideAccounts)
+        // need to check team only for first character
+        // TODO: what to if account already has characters of both races?
+        if (!AllowTwoSideAccounts)
+        {
+            if (acc_race == 0 || Player::TeamForRace(acc_race) != team_)
             {
-                if (acc_race == 0 || Player::TeamForRace(acc_race) != team_)
-                {
-                    data << (uint8)CHAR_CREATE_PVP_TEAMS_VIOLATION;
-                    SendPacket(data, true);
-                    return;
-                }
+                delete holder;
+                CharCreateAbort(CHAR_CREATE_PVP_TEAMS_VIOLATION);
+                return;
             }
+        }
 
-            // search same race for cinematic or same class if need
-            // TODO: check if cinematic already shown? (already logged in?; cinematic field)
-            while (skipCinematics == CINEMATICS_SKIP_SAME_RACE && !have_same_race)
-            {
-                if (!queryResult2->NextRow())
-                    break;
+        // search same race for cinematic or same class if need
+        // TODO: check if cinematic already shown? (already logged in?; cinematic field)
+        while (skipCinematics == CINEMATICS_SKIP_SAME_RACE && !have_same_race)
+        {
+            if (!raceResult->NextRow())
+                break;
 
-                field = queryResult2->Fetch();
-                acc_race = field[0].GetUInt32();
+            field = raceResult->Fetch();
+            acc_race = field[0].GetUInt32();
 
-                have_same_race = race_ == acc_race;
-            }
+            have_same_race = m_charCreateInfo->race == acc_race;
         }
     }
 
+    delete holder;
+
+    CharacterCreateInfo const& info = *m_charCreateInfo;
+
     Player* pNewChar = new Player(this);
-    if (!pNewChar->Create(sObjectMgr.GeneratePlayerLowGuid(), name, race_, class_, gender, skin, face, hairStyle, hairColor, facialHair, outfitId))
+    if (!pNewChar->Create(sObjectMgr.GeneratePlayerLowGuid(), info.name, info.race, info.class_, info.gender,
+                          info.skin, info.face, info.hairStyle, info.hairColor, info.facialHair, info.outfitId))
     {
         // Player not create (race/class problem?)
         delete pNewChar;
 
-        data << (uint8)CHAR_CREATE_ERROR;
-        SendPacket(data, true);
-
+        CharCreateAbort(CHAR_CREATE_ERROR);
         return;
     }
 
@@ -508,19 +716,26 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
 
     pNewChar->SetAtLoginFlag(AT_LOGIN_FIRST);               // First login
 
-    // Player created, save it now
+    // Player created, save it now (the writes are queued on the char-DB connection)
     pNewChar->SaveToDB();
     charcount += 1;
 
+    ObjectMgr::InvalidateCharacterLookupCache();
+
     LoginDatabase.PExecute("DELETE FROM realmcharacters WHERE acctid= '%u' AND realmid = '%u'", GetAccountId(), realmID);
     LoginDatabase.PExecute("INSERT INTO realmcharacters (numchars, acctid, realmid) VALUES (%u, %u, %u)",  charcount, GetAccountId(), realmID);
 
+    sObjectMgr.ReleasePendingCharacterName(info.name);
+
+    WorldPacket data(SMSG_CHAR_CREATE, 1);
     data << (uint8)CHAR_CREATE_SUCCESS;
     SendPacket(data, true);
 
     const std::string& IP_str = GetRemoteAddress();
-    DETAIL_LOG("Account: %d (IP: %s) Create Character:[%s] (guid: %u)", GetAccountId(), IP_str.c_str(), name.c_str(), pNewChar->GetGUIDLow());
-    sLog.outChar("Account: %d (IP: %s) Create Character:[%s] (guid: %u)", GetAccountId(), IP_str.c_str(), name.c_str(), pNewChar->GetGUIDLow());
+    DETAIL_LOG("Account: %d (IP: %s) Create Character:[%s] (guid: %u)", GetAccountId(), IP_str.c_str(), info.name.c_str(), pNewChar->GetGUIDLow());
+    sLog.outChar("Account: %d (IP: %s) Create Character:[%s] (guid: %u)", GetAccountId(), IP_str.c_str(), info.name.c_str(), pNewChar->GetGUIDLow());
+
+    m_charCreateInfo.reset();
 
     delete pNewChar;                                        // created only to call SaveToDB()
 }
@@ -534,9 +749,6 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recv_data)
     if (sObjectMgr.GetPlayer(guid))
         return;
 
-    uint32 accountId = 0;
-    std::string name;
-
     // is guild leader
     if (sGuildMgr.GetGuildByLeader(guid))
     {
@@ -546,20 +758,32 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recv_data)
         return;
     }
 
-    uint32 lowguid = guid.GetCounter();
+    // ownership check and the delete itself run off the DB thread; answer via callback
+    CharacterDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharDeleteCallback, GetAccountId(),
+                                  "SELECT account, name, guid FROM characters WHERE guid = '%u'", guid.GetCounter());
+}
 
-    auto queryResult = CharacterDatabase.PQuery("SELECT account,name FROM characters WHERE guid='%u'", lowguid);
-    if (queryResult)
-    {
-        Field* fields = queryResult->Fetch();
-        accountId = fields[0].GetUInt32();
-        name = fields[1].GetCppString();
-    }
+void WorldSession::HandleCharDeleteConfirmed(QueryResult* result)
+{
+    if (!result)                                            // unknown guid - same silent ignore as the old synchronous path
+        return;
+
+    Field* fields = result->Fetch();
+    uint32 accountId = fields[0].GetUInt32();
+    std::string name = fields[1].GetCppString();
+    uint32 lowguid   = fields[2].GetUInt32();
+    delete result;
 
     // prevent deleting other players' characters using cheating tools
     if (accountId != GetAccountId())
         return;
 
+    ObjectGuid guid(HIGHGUID_PLAYER, lowguid);
+
+    // state may have changed while the ownership query was in flight
+    if (sObjectMgr.GetPlayer(guid) || sGuildMgr.GetGuildByLeader(guid))
+        return;
+
     std::string IP_str = GetRemoteAddress();
     BASIC_LOG("Account: %d (IP: %s) Delete Character:[%s] (guid: %u)", GetAccountId(), IP_str.c_str(), name.c_str(), lowguid);
     sLog.outChar("Account: %d (IP: %s) Delete Character:[%s] (guid: %u)", GetAccountId(), IP_str.c_str(), name.c_str(), lowguid);
@@ -694,6 +918,56 @@ void PlayerbotMgr::LoginPlayerBot(ObjectGuid playerGuid)
 }
 #endif
 
+// Lives here rather than in StressTestMgr.cpp for the same reason as
+// PlayerbotMgr::LoginPlayerBot above: it needs the file-local LoginQueryHolder
+void StressTestMgr::LoginStressSession(ObjectGuid playerGuid)
+{
+    if (sObjectMgr.GetPlayer(playerGuid))
+        return;
+
+    uint32 accountId = sObjectMgr.GetPlayerAccountIdByGUID(playerGuid);
+    if (accountId == 0)
+        return;
+
+    // never hijack an account with a real session attached
+    if (sWorld.FindSession(accountId))
+        return;
+
+    LoginQueryHolder* holder = new LoginQueryHolder(accountId, playerGuid);
+    if (!holder->Initialize())
+    {
+        delete holder;                                      // delete all unprocessed queries
+        return;
+    }
+    CharacterDatabase.DelayQueryHolder(&chrHandler, &CharacterHandler::HandleStressSessionLoginCallback, holder);
+}
+
+// Same placement rationale as the stress-test login above
+void ReplayMgr::LoginReplaySession(ObjectGuid playerGuid)
+{
+    if (sObjectMgr.GetPlayer(playerGuid))
+        return;
+
+    uint32 accountId = sObjectMgr.GetPlayerAccountIdByGUID(playerGuid);
+    if (accountId == 0)
+    {
+        sLog.outError("Replay: captured character %u does not exist in this database", playerGuid.GetCounter());
+        return;
+    }
+
+    // never hijack an account with a real session attached
+    if (sWorld.FindSession(accountId))
+        return;
+
+    LoginQueryHolder* holder = new LoginQueryHolder(accountId, playerGuid);
+    if (!holder->Initialize())
+    {
+        delete holder;                                      // delete all unprocessed queries
+        return;
+    }
+    CharacterDatabase.DelayQueryHolder(&chrHandler, &CharacterHandler::HandleReplaySessionLoginCallback, holder);
+}
+
 void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
 {
     ObjectGuid playerGuid = holder->GetGuid();
@@ -726,8 +1000,6 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
 
     pCurrChar->GetMotionMaster()->Initialize();
 
-    Group* group = pCurrChar->GetGroup();
-
     WorldPacket data(SMSG_LOGIN_VERIFY_WORLD, 20);
     data << pCurrChar->GetMapId();
     if (pCurrChar->GetTransport())
@@ -784,6 +1056,7 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
             SendPacket(data);
             DEBUG_LOG("WORLD: Sent guild-motd (SMSG_GUILD_EVENT)");
 
+            guild->OnMemberLogin(pCurrChar->GetGUIDLow());
             guild->BroadcastEvent(GE_SIGNED_ON, pCurrChar->GetObjectGuid(), pCurrChar->GetName());
         }
         else
@@ -797,16 +1070,42 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
     if (!pCurrChar->IsAlive())
         pCurrChar->SendCorpseReclaimDelay(true);
 
-    pCurrChar->SendInitialPacketsBeforeAddToMap();
+    ///- The rest of the login is staged off the world thread: the initial
+    /// packet blobs (spells, action buttons, reputations) only touch the
+    /// loading player and immutable stores, so they are built on the command
+    /// worker, and the final map add returns here through the world messager.
+    /// Session removal is deferred by the pending counter meanwhile.
+    delete holder;
 
-    // Show cinematic at the first time that player login
-    if (!pCurrChar->getCinematic())
+    IncPendingOffThreadCommands();
+    sWorld.ScheduleOffThreadCommand([this, pCurrChar]()
     {
-        pCurrChar->setCinematic(1);
+        pCurrChar->SendInitialPacketsBeforeAddToMap();
 
-        if (ChrRacesEntry const* rEntry = sChrRacesStore.LookupEntry(pCurrChar->getRace()))
-            pCurrChar->SendCinematicStart(rEntry->CinematicSequence);
-    }
+        // Show cinematic at the first time that player login
+        if (!pCurrChar->getCinematic())
+        {
+            pCurrChar->setCinematic(1);
+
+            if (ChrRacesEntry const* rEntry = sChrRacesStore.LookupEntry(pCurrChar->getRace()))
+                pCurrChar->SendCinematicStart(rEntry->CinematicSequence);
+        }
+
+        sWorld.GetMessager().AddMessage([this](World* /*world*/)
+        {
+            HandlePlayerLoginFinalize();
+            DecPendingOffThreadCommands();
+        });
+    });
+}
+
+void WorldSession::HandlePlayerLoginFinalize()
+{
+    Player* pCurrChar = GetPlayer();
+    if (!pCurrChar || !PlayerLoading())
+        return;                                             // session was logged out while the login was staged
+
+    Group* group = pCurrChar->GetGroup();
 
     uint32 miscRequirement = 0;
     AreaLockStatus lockStatus = AREA_LOCKSTATUS_OK;
@@ -940,7 +1239,6 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
         pCurrChar->SetStandState(UNIT_STAND_STATE_STAND);
 
     m_playerLoading = false;
-    delete holder;
 }
 
 void WorldSession::HandlePlayerReconnect()
@@ -968,6 +1266,7 @@ void WorldSession::HandlePlayerReconnect()
             object->RemoveClientIAmAt(_player);
     }
     _player->m_clientGUIDs.clear();
+    _player->m_questGameObjects.clear();
 
     m_initialZoneUpdated = false;
 
@@ -1004,6 +1303,7 @@ void WorldSession::HandlePlayerReconnect()
             SendPacket(data);
             DEBUG_LOG("WORLD: Sent guild-motd (SMSG_GUILD_EVENT)");
 
+            guild->OnMemberLogin(_player->GetGUIDLow());
             guild->BroadcastEvent(GE_SIGNED_ON, _player->GetObjectGuid(), _player->GetName());
         }
         else
@@ -1220,6 +1520,9 @@ void WorldSession::HandleChangePlayerNameOpcodeCallBack(QueryResult* result, uin
     CharacterDatabase.PExecute("UPDATE characters set name = '%s', at_login = at_login & ~ %u WHERE guid ='%u'", newname.c_str(), uint32(AT_LOGIN_RENAME), guidLow);
     CharacterDatabase.CommitTransaction();
 
+    sWorld.InvalidateCharacterEnumCache(accountId);
+    ObjectMgr::InvalidateCharacterLookupCache();
+
     sLog.outChar("Account: %d (IP: %s) Character:[%s] (guid:%u) Changed name to: %s", session->GetAccountId(), session->GetRemoteAddress().c_str(), oldname.c_str(), guidLow, newname.c_str());
 
     WorldPacket data(SMSG_CHAR_RENAME, 1 + 8 + (newname.size() + 1));
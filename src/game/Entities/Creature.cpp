@@ -138,7 +138,9 @@ Creature::Creature(CreatureSubtype subtype) : Unit(),
     m_lootStatus(CREATURE_LOOT_STATUS_NONE),
     m_corpseAccelerationDecayDelay(MINIMUM_LOOTING_TIME),
     m_respawnTime(0), m_respawnDelay(25), m_respawnOverriden(false), m_respawnOverrideOnce(false), m_corpseDelay(60), m_canAggro(false),
-    m_respawnradius(5.0f), m_checkForHelp(true), m_interactionPauseTimer(0), m_subtype(subtype), m_defaultMovementType(IDLE_MOTION_TYPE),
+    m_respawnradius(5.0f), m_checkForHelp(true), m_interactionPauseTimer(0), m_aiLodElapsed(0), m_aiLodCheckTimer(0), m_aiLodThrottled(false),
+    m_lastClaimedUpdateTick(0), m_tapResolveTick(0), m_tapRecipient(nullptr), m_tapGroup(nullptr),
+    m_subtype(subtype), m_defaultMovementType(IDLE_MOTION_TYPE),
     m_equipmentId(0), m_detectionRange(20.f), m_AlreadyCallAssistance(false), m_canCallForAssistance(true),
     m_temporaryFactionFlags(TEMPFACTION_NONE),
     m_originalEntry(0), m_gameEventVendorId(0),
@@ -179,6 +181,12 @@ void Creature::AddToWorld()
             GetMap()->GetObjectsStore().insert<Creature>(GetObjectGuid(), (Creature*)this);
         if (GetDbGuid())
             GetMap()->AddDbGuidObject(this);
+
+        // (re)establish direct references in the creature linking holder
+        if (sCreatureLinkingMgr.GetLinkedTriggerInformation(this))
+            GetMap()->GetCreatureLinkingHolder()->AddSlaveToHolder(this);
+        if (m_isCreatureLinkingTrigger)
+            GetMap()->GetCreatureLinkingHolder()->AddMasterToHolder(this);
     }
 
     switch (GetSubtype())
@@ -209,6 +217,31 @@ void Creature::AddToWorld()
         GetMap()->AddToSpawnCount(GetObjectGuid());
 }
 
+bool Creature::CanUseCachedCreateBlock(Player* target) const
+{
+    // object side: everything serialized into the block must be covered by the
+    // cache invalidation hooks (field changes, relocation, speed changes) -
+    // rule out the transient states that are not
+    if (!IsAlive() || IsInCombat() || GetVictim() || GetTransport() ||
+            !IsStopped() || m_movementInfo.HasMovementFlag(MOVEFLAG_SPLINE_ENABLED))
+        return false;
+
+    // viewer side: these make BuildValuesUpdate emit different bytes per viewer
+    if (GetUInt32Value(UNIT_NPC_FLAGS) & (UNIT_NPC_FLAG_TRAINER | UNIT_NPC_FLAG_STABLEMASTER | UNIT_NPC_FLAG_FLIGHTMASTER))
+        return false;
+
+    if (HasAuraType(SPELL_AURA_MOD_STALKED))                // hunter's mark visibility is per caster
+        return false;
+
+    if (target->IsGameMaster() || target->CanSeeSpecialInfoOf(this))
+        return false;
+
+    if (!IsFogOfWarVisibleHealth(target))                   // health would be sent as a percentage for this viewer
+        return false;
+
+    return CanShareValuesUpdateWith(target);
+}
+
 void Creature::RemoveFromWorld()
 {
     ///- Remove the creature from the accessor
@@ -216,6 +249,7 @@ void Creature::RemoveFromWorld()
     {
         if (IsUnit())
             GetMap()->GetObjectsStore().erase<Creature>(GetObjectGuid(), (Creature*)nullptr);
+            GetMap()->IncrementObjectRemovalCounter();
         if (GetDbGuid())
             GetMap()->RemoveDbGuidObject(this);
 
@@ -252,6 +286,10 @@ void Creature::RemoveFromWorld()
 
         ClearCreatureGroup();
 
+        // drop any direct references held by the creature linking holder
+        if (m_isCreatureLinkingTrigger || sCreatureLinkingMgr.GetLinkedTriggerInformation(this))
+            GetMap()->GetCreatureLinkingHolder()->ClearLinkingReferences(*this);
+
         if (AI())
             AI()->RelinquishFollow(ObjectGuid());
     }
@@ -765,7 +803,11 @@ void Creature::Update(const uint32 diff)
         }
         case ALIVE:
         {
-            Unit::Update(diff);
+            uint32 elapsed = diff;
+            if (!UpdateAiLod(diff, elapsed))
+                break;
+
+            Unit::Update(elapsed);
 
             // creature can be dead after Unit::Update call
             // CORPSE/DEAD state will processed at next tick (in other case death timer will be updated unexpectedly)
@@ -774,7 +816,7 @@ void Creature::Update(const uint32 diff)
 
             // Creature can be dead after unit update
             if (IsAlive())
-                RegenerateAll(diff);
+                RegenerateAll(elapsed);
 
             break;
         }
@@ -783,6 +825,82 @@ void Creature::Update(const uint32 diff)
     }
 }
 
+bool Creature::ClaimUpdateTick()
+{
+    uint32 const tick = GetMap()->GetUpdateTick();
+    if (m_lastClaimedUpdateTick == tick)
+        return false;
+
+    m_lastClaimedUpdateTick = tick;
+    return true;
+}
+
+bool Creature::UpdateAiLod(uint32 diff, uint32& elapsed)
+{
+    uint32 const interval = sWorld.getConfig(CONFIG_UINT32_AI_LOD_INTERVAL);
+    // reduced rate only applies to idle world mobs - anything a player interacts
+    // with, anything script-driven and anything owned updates at full rate
+    if (!interval || !GetMap()->IsContinent() || IsInCombat() || isActiveObject() ||
+        IsTemporarySummon() || GetMasterGuid() || IsPlayerControlled())
+    {
+        elapsed = diff + m_aiLodElapsed;                    // fold in time skipped before full rate was forced
+        m_aiLodElapsed = 0;
+        m_aiLodThrottled = false;
+        return true;
+    }
+
+    if (m_aiLodThrottled)
+    {
+        m_aiLodElapsed += diff;
+        if (m_aiLodElapsed < interval)
+            return false;
+
+        // interval expired - deliver the accumulated time and re-check proximity
+        elapsed = m_aiLodElapsed;
+        m_aiLodElapsed = 0;
+        if (HasPlayerWithinLodDistance())
+        {
+            m_aiLodThrottled = false;
+            m_aiLodCheckTimer = interval;
+        }
+        return true;
+    }
+
+    // full rate - periodically verify someone is still around
+    if (m_aiLodCheckTimer <= diff)
+    {
+        m_aiLodCheckTimer = interval;
+        if (!HasPlayerWithinLodDistance())
+            m_aiLodThrottled = true;
+    }
+    else
+        m_aiLodCheckTimer -= diff;
+
+    elapsed = diff + m_aiLodElapsed;                        // catch up right after a proximity snap-back
+    m_aiLodElapsed = 0;
+    return true;
+}
+
+bool Creature::HasPlayerWithinLodDistance() const
+{
+    float const range = float(sWorld.getConfig(CONFIG_UINT32_AI_LOD_DISTANCE));
+    Player* player = nullptr;
+    MaNGOS::AnyPlayerInObjectRangeCheck check(this, range);
+    MaNGOS::PlayerSearcher<MaNGOS::AnyPlayerInObjectRangeCheck> searcher(player, check);
+    Cell::VisitWorldObjects(this, searcher, range);
+    return player != nullptr;
+}
+
+void Creature::OnPlayerProximity()
+{
+    if (!m_aiLodThrottled)
+        return;
+
+    // skipped time is delivered with the next tick so the AI catches up immediately
+    m_aiLodThrottled = false;
+    m_aiLodCheckTimer = sWorld.getConfig(CONFIG_UINT32_AI_LOD_INTERVAL);
+}
+
 void Creature::RegenerateAll(uint32 diff)
 {
     m_regenTimer += diff;
@@ -1154,6 +1272,8 @@ void Creature::SetLootRecipient(Unit* unit)
     // to loot the creature after it dies
     // should be set to nullptr after the loot disappears
 
+    m_tapResolveTick = 0;                                   // drop the memoized tap resolution
+
     if (!unit)
     {
         m_lootRecipientGuid.Clear();
@@ -1780,24 +1900,14 @@ void Creature::LoadEquipment(uint32 equip_entry, bool force)
 
 bool Creature::HasQuest(uint32 quest_id) const
 {
-    QuestRelationsMapBounds bounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(GetEntry());
-    for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-    {
-        if (itr->second == quest_id)
-            return true;
-    }
-    return false;
+    QuestRelations const& relations = sObjectMgr.GetCreatureQuestRelations(GetEntry());
+    return std::find(relations.begin(), relations.end(), quest_id) != relations.end();
 }
 
 bool Creature::HasInvolvedQuest(uint32 quest_id) const
 {
-    QuestRelationsMapBounds bounds = sObjectMgr.GetCreatureQuestInvolvedRelationsMapBounds(GetEntry());
-    for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-    {
-        if (itr->second == quest_id)
-            return true;
-    }
-    return false;
+    QuestRelations const& relations = sObjectMgr.GetCreatureQuestInvolvedRelations(GetEntry());
+    return std::find(relations.begin(), relations.end(), quest_id) != relations.end();
 }
 
 bool Creature::IsRegeneratingPower() const
@@ -2173,8 +2283,18 @@ void Creature::CallForHelp(float radius)
         radius = GetCreatureInfo()->CallForHelp;
 
     MaNGOS::CallOfHelpCreatureInRangeDo u_do(this, GetVictim(), radius);
-    MaNGOS::CreatureWorker<MaNGOS::CallOfHelpCreatureInRangeDo> worker(this, u_do);
-    Cell::VisitGridObjects(this, worker, radius);
+    // helpers must be friendly to us by faction template (CanAssist), so the
+    // per-cell faction index narrows the scan to matching creatures
+    FactionTemplateEntry const* ownTemplate = GetFactionTemplateEntry();
+    std::vector<Creature*> candidates;
+    GetMap()->VisitFactionIndexed(this, radius, [ownTemplate](uint32 faction)
+    {
+        FactionTemplateEntry const* entry = sFactionTemplateStore.LookupEntry(faction);
+        return !ownTemplate || !entry || entry->IsFriendlyTo(*ownTemplate);
+    }, candidates);
+    for (Creature* candidate : candidates)
+        if (!candidate->IsPet())                            // the old scan visited grid objects only
+            u_do(candidate);
 }
 
 /// if enemy provided, check for initial combat help against enemy
@@ -2817,22 +2937,17 @@ void Creature::SetLootStatus(CreatureLootStatus status, bool forced)
 // TODO:: this is semi correct. For group situation need more work but its not a big issue
 bool Creature::IsTappedBy(Player* plr) const
 {
-    if (Player* recipient = GetLootRecipient())
+    if (m_tapResolveTick != GetMap()->GetUpdateTick())
     {
-        if (recipient == plr)
-            return true;
+        m_tapRecipient = GetLootRecipient();
+        m_tapGroup = m_tapRecipient ? m_tapRecipient->GetGroup() : nullptr;
+        m_tapResolveTick = GetMap()->GetUpdateTick();
+    }
 
-        if (Group* grp = recipient->GetGroup())
-        {
-            if (Group* plrGroup = plr->GetGroup())
-            {
-                if (plrGroup == grp)
-                    return true;
-            }
-        }
+    if (!m_tapRecipient)
         return false;
-    }
-    return false;
+
+    return plr == m_tapRecipient || (m_tapGroup && plr->GetGroup() == m_tapGroup);
 }
 
 void Creature::SetBaseWalkSpeed(float speed)
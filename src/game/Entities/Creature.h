@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "Entities/Unit.h"
+#include "Entities/ObjectPool.h"
 #include "Globals/SharedDefines.h"
 #include "Entities/CreatureDefines.h"
 #include "Server/DBCEnums.h"
@@ -592,10 +593,17 @@ class Creature : public Unit
         explicit Creature(CreatureSubtype subtype = CREATURE_SUBTYPE_GENERIC);
         virtual ~Creature();
 
+        // recycle instance storage through the spawn pool (covers subclasses
+        // via the deleting destructor, which passes the dynamic size)
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
         void CleanupsBeforeDelete() override;
 
+        bool CanUseCachedCreateBlock(Player* target) const override;
+
         bool Create(uint32 dbGuid, uint32 guidlow, CreatureCreatePos& cPos, CreatureInfo const* cinfo, const CreatureData* data = nullptr, GameEventCreatureData const* eventData = nullptr);
         bool LoadCreatureAddon(bool reload);
 
@@ -611,6 +619,11 @@ class Creature : public Unit
 
         void Update(const uint32 diff) override;  // overwrite Unit::Update
 
+        // AI level of detail: without a player within AILod.Distance the creature ticks
+        // at AILod.Interval with elapsed-time catch-up - called from the visibility
+        // notifier to snap back to full rate when a player moves into aggro range
+        void OnPlayerProximity();
+
         virtual void RegenerateAll(uint32 update_diff);
         uint32 GetEquipmentId() const { return m_equipmentId; }
 
@@ -954,6 +967,13 @@ class Creature : public Unit
         uint32 m_lootMoney;
         ObjectGuid m_lootRecipientGuid;                     // player who will have rights for looting if m_lootGroupRecipient==0 or group disbanded
         uint32 m_lootGroupRecipientId;                      // group who will have rights for looting if set and exist
+
+        // tap resolution memoized per map tick: BuildValuesUpdate asks once per
+        // nearby viewer and the recipient/group lookups only run for the first;
+        // the cached pointers are compared against, never dereferenced
+        mutable uint32 m_tapResolveTick;
+        mutable Player* m_tapRecipient;
+        mutable Group* m_tapGroup;
         CreatureLootStatus m_lootStatus;                    // loot status (used to know when we could loot, pickpocket or skin)
         uint32 m_corpseAccelerationDecayDelay;              // time for ReduceCorpseDecayTimer
 
@@ -970,6 +990,19 @@ class Creature : public Unit
         float m_respawnradius;
         uint32 m_interactionPauseTimer;                     // (msecs) waypoint pause time when interacted with
 
+        // AI level of detail
+        bool UpdateAiLod(uint32 diff, uint32& elapsed);     // false when this tick should be skipped entirely
+        bool HasPlayerWithinLodDistance() const;
+        uint32 m_aiLodElapsed;                              // (msecs) time skipped since the last delivered update
+        uint32 m_aiLodCheckTimer;                           // (msecs) time until the next proximity re-check at full rate
+        bool m_aiLodThrottled;                              // no player nearby, ticking at reduced rate
+
+        // owner-driven minions (pets/totems) can be updated both right behind their
+        // owner and through the normal grid visit; the first caller in a map tick
+        // claims it, the second one no-ops
+        bool ClaimUpdateTick();
+        uint32 m_lastClaimedUpdateTick;
+
         CreatureSubtype m_subtype;                          // set in Creatures subclasses for fast it detect without dynamic_cast use
         void RegeneratePower(float timerMultiplier);
         virtual void RegenerateHealth();
@@ -338,7 +338,7 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
         {
             if (itr->second.linkingFlag == pInfo->linkingFlag)
             {
-                itr->second.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+                RegisterSlave(itr->second, pCreature);
                 pCreature = nullptr;                           // Store that is was handled
                 break;
             }
@@ -348,7 +348,7 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
         if (pCreature)
         {
             InfoAndGuids tmp;
-            tmp.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+            tmp.linkedGuids.push_back({ pCreature->GetDbGuid(), pCreature->GetObjectGuid(), pCreature });
             tmp.linkingFlag = pInfo->linkingFlag;
             tmp.searchRange = 0;
             m_holderGuidMap.insert(HolderMap::value_type(pInfo->masterId, tmp));
@@ -362,7 +362,7 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
     {
         if (itr->second.linkingFlag == pInfo->linkingFlag && itr->second.searchRange == pInfo->searchRange)
         {
-            itr->second.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+            RegisterSlave(itr->second, pCreature);
             pCreature = nullptr;                               // Store that is was handled
             break;
         }
@@ -372,13 +372,31 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
     if (pCreature)
     {
         InfoAndGuids tmp;
-        tmp.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+        tmp.linkedGuids.push_back({ pCreature->GetDbGuid(), pCreature->GetObjectGuid(), pCreature });
         tmp.linkingFlag = pInfo->linkingFlag;
         tmp.searchRange = pInfo->searchRange;
         m_holderMap.insert(HolderMap::value_type(pInfo->masterId, tmp));
     }
 }
 
+// Helper function to insert or refresh a direct slave reference
+void CreatureLinkingHolder::RegisterSlave(InfoAndGuids& holder, Creature* pCreature)
+{
+    // Refresh the existing reference on respawn or grid reload instead of
+    // growing the list with every new incarnation of the same spawn
+    for (SlaveRef& slave : holder.linkedGuids)
+    {
+        if (pCreature->GetDbGuid() ? slave.dbGuid == pCreature->GetDbGuid() : slave.guid == pCreature->GetObjectGuid())
+        {
+            slave.guid = pCreature->GetObjectGuid();
+            slave.creature = pCreature;
+            return;
+        }
+    }
+
+    holder.linkedGuids.push_back({ pCreature->GetDbGuid(), pCreature->GetObjectGuid(), pCreature });
+}
+
 // Function to add master-NPCs to the holder
 void CreatureLinkingHolder::AddMasterToHolder(Creature* pCreature)
 {
@@ -389,13 +407,39 @@ void CreatureLinkingHolder::AddMasterToHolder(Creature* pCreature)
     if (!sCreatureLinkingMgr.IsLinkedMaster(pCreature))
         return;
 
-    // Check, if already stored
-    BossGuidMapBounds bounds = m_masterGuid.equal_range(pCreature->GetEntry());
-    for (BossGuidMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-        if (itr->second == pCreature->GetObjectGuid())
+    // Check, if already stored - refresh the direct reference for a new
+    // incarnation of the same spawn
+    auto bounds = m_masterGuid.equal_range(pCreature->GetEntry());
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (pCreature->GetDbGuid() ? itr->second.dbGuid == pCreature->GetDbGuid() : itr->second.guid == pCreature->GetObjectGuid())
+        {
+            itr->second.guid = pCreature->GetObjectGuid();
+            itr->second.creature = pCreature;
             return;                                         // Already added
+        }
+    }
 
-    m_masterGuid.insert(BossGuidMap::value_type(pCreature->GetEntry(), pCreature->GetObjectGuid()));
+    m_masterGuid.insert(BossGuidMap::value_type(pCreature->GetEntry(), { pCreature->GetDbGuid(), pCreature->GetObjectGuid(), pCreature }));
+}
+
+// Function to drop direct object references when a creature leaves the map
+void CreatureLinkingHolder::ClearLinkingReferences(Creature& creature)
+{
+    if (CreatureLinkingInfo const* pInfo = sCreatureLinkingMgr.GetLinkedTriggerInformation(&creature))
+    {
+        HolderMap& holder = (pInfo->mapId == INVALID_MAP_ID ? m_holderGuidMap : m_holderMap);
+        HolderMapBounds bounds = holder.equal_range(pInfo->masterId);
+        for (HolderMap::iterator itr = bounds.first; itr != bounds.second; ++itr)
+            for (SlaveRef& slave : itr->second.linkedGuids)
+                if (slave.creature == &creature)
+                    slave.creature = nullptr;
+    }
+
+    auto finds = m_masterGuid.equal_range(creature.GetEntry());
+    for (auto itr = finds.first; itr != finds.second; ++itr)
+        if (itr->second.creature == &creature)
+            itr->second.creature = nullptr;
 }
 
 // Function to process actions for linked NPCs
@@ -459,7 +503,7 @@ void CreatureLinkingHolder::DoCreatureLinkingEvent(CreatureLinkingEvent eventTyp
                 BossGuidMapBounds finds = m_masterGuid.equal_range(pInfo->masterId);
                 for (BossGuidMap::const_iterator itr = finds.first; itr != finds.second; ++itr)
                 {
-                    Creature* master = pSource->GetMap()->GetCreature(itr->second);
+                    Creature* master = itr->second.creature;
                     if (master && IsSlaveInRangeOfMaster(pSource, master, pInfo->searchRange))
                     {
                         pMaster = master;
@@ -510,7 +554,7 @@ void CreatureLinkingHolder::DoCreatureLinkingEvent(CreatureLinkingEvent eventTyp
 }
 
 // Helper function, to process a slave list
-void CreatureLinkingHolder::ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, std::list<std::pair<uint32, ObjectGuid>>& slaveGuidList, Unit* pEnemy)
+void CreatureLinkingHolder::ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, std::vector<SlaveRef>& slaveList, Unit* pEnemy)
 {
     if (!flag)
         return;
@@ -523,23 +567,16 @@ void CreatureLinkingHolder::ProcessSlaveGuidList(CreatureLinkingEvent eventType,
         postprocessFlag = (postprocessFlag & ~(FLAG_RESPAWN_ON_EVADE | FLAG_RESPAWN_ON_DEATH | FLAG_RESPAWN_ON_RESPAWN));
     }
 
-    for (auto slave_itr = slaveGuidList.begin(); slave_itr != slaveGuidList.end();)
+    // Flat walk over direct references - no guid lookups here. Indexed loop
+    // because a processed slave can respawn group members, which re-registers
+    // them and may grow this very array
+    for (size_t i = 0; i < slaveList.size(); ++i)
     {
-        Creature* pSlave;
-        if ((*slave_itr).first)
-            pSlave = pSource->GetMap()->GetCreature((*slave_itr).first);
-        else
-            pSlave = pSource->GetMap()->GetCreature((*slave_itr).second);
-        if ((!pSlave || pSlave->IsCorpse()) && preprocessFlag) // dynguid respawning
-            pSource->GetMap()->GetSpawnManager().RespawnCreature((*slave_itr).first);
+        Creature* pSlave = slaveList[i].creature;
+        if ((!pSlave || pSlave->IsCorpse()) && preprocessFlag && slaveList[i].dbGuid) // dynguid respawning
+            pSource->GetMap()->GetSpawnManager().RespawnCreature(slaveList[i].dbGuid);
         if (!pSlave)
-        {
-            // Remove old guid first
-            slave_itr = slaveGuidList.erase(slave_itr);
             continue;
-        }
-
-        ++slave_itr;
 
         // Ignore Pets
         if (pSlave->IsPet())
@@ -736,7 +773,7 @@ bool CreatureLinkingHolder::CanSpawn(uint32 dbGuid, Map* _map, CreatureLinkingIn
     BossGuidMapBounds finds = m_masterGuid.equal_range(pInfo->masterId);
     for (BossGuidMap::const_iterator itr = finds.first; itr != finds.second; ++itr)
     {
-        Creature* pMaster = _map->GetCreature(itr->second);
+        Creature* pMaster = itr->second.creature;
         if (pMaster && IsSlaveInRangeOfMaster(pMaster, sx, sy, pInfo->searchRange))
         {
             if (pInfo->linkingFlag & FLAG_CANT_SPAWN_IF_BOSS_DEAD)
@@ -763,7 +800,7 @@ bool CreatureLinkingHolder::TryFollowMaster(Creature* pCreature)
         BossGuidMapBounds finds = m_masterGuid.equal_range(pInfo->masterId);
         for (BossGuidMap::const_iterator itr = finds.first; itr != finds.second; ++itr)
         {
-            pMaster = pCreature->GetMap()->GetCreature(itr->second);
+            pMaster = itr->second.creature;
             if (pMaster && IsSlaveInRangeOfMaster(pCreature, pMaster, pInfo->searchRange))
                 break;
         }
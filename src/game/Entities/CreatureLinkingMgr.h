@@ -154,6 +154,9 @@ class CreatureLinkingHolder
         // Function to add master-NPCs to the holder
         void AddMasterToHolder(Creature* pCreature);
 
+        // Function to drop direct object references when a creature leaves the map
+        void ClearLinkingReferences(Creature& creature);
+
         // Function to process actions for linked NPCs
         void DoCreatureLinkingEvent(CreatureLinkingEvent eventType, Creature* pSource, Unit* pEnemy = nullptr);
 
@@ -166,28 +169,40 @@ class CreatureLinkingHolder
         bool TryFollowMaster(Creature* pCreature);
 
     private:
+        // Direct reference to a linked creature, established at spawn time and
+        // cleared when the object leaves the map - event propagation walks
+        // these flat arrays without any guid lookups
+        struct SlaveRef
+        {
+            uint32 dbGuid;
+            ObjectGuid guid;
+            Creature* creature;
+        };
         // Structure associated to a master
         struct InfoAndGuids
         {
             uint16 linkingFlag: 16;
             uint16 searchRange: 16;
-            std::list<std::pair<uint32, ObjectGuid>> linkedGuids;
+            std::vector<SlaveRef> linkedGuids;
             bool inUse = false;
         };
-        // Structure associated to a master (guid case)
-        struct InfoAndGuid
+        // Direct reference to a master instance
+        struct MasterRef
         {
-            uint16 linkingFlag;
-            ObjectGuid linkedGuid;
+            uint32 dbGuid;
+            ObjectGuid guid;
+            Creature* creature;
         };
 
         typedef std::multimap < uint32 /*masterEntryOrGuid*/, InfoAndGuids > HolderMap;
         typedef std::pair<HolderMap::iterator, HolderMap::iterator> HolderMapBounds;
-        typedef std::multimap < uint32 /*Entry*/, ObjectGuid > BossGuidMap;
+        typedef std::multimap < uint32 /*Entry*/, MasterRef > BossGuidMap;
         typedef std::pair<BossGuidMap::const_iterator, BossGuidMap::const_iterator> BossGuidMapBounds;
 
+        // Helper function to insert or refresh a direct slave reference
+        static void RegisterSlave(InfoAndGuids& holder, Creature* pCreature);
         // Helper function, to process a slave list
-        void ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, std::list<std::pair<uint32, ObjectGuid>>& slaveGuidList, Unit* pEnemy);
+        void ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, std::vector<SlaveRef>& slaveList, Unit* pEnemy);
         // Helper function, to process a single slave
         void ProcessSlave(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, Creature* pSlave, Unit* pEnemy);
         // Helper function to set following
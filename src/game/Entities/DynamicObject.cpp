@@ -51,6 +51,7 @@ void DynamicObject::RemoveFromWorld()
     {
         GetViewPoint().Event_RemovedFromWorld();
         GetMap()->GetObjectsStore().erase<DynamicObject>(GetObjectGuid(), (DynamicObject*)nullptr);
+        GetMap()->IncrementObjectRemovalCounter();
     }
 
     Object::RemoveFromWorld();
@@ -92,6 +92,8 @@ GameObject::GameObject() : WorldObject(),
     m_isInUse = false;
     m_reStockTimer = 0;
     m_rearmTimer = 0;
+    m_trapSearchPending = true;
+    m_capturePending = true;
     m_despawnTimer = TimePoint::max();
 
     m_delayedActionTimer = 0;
@@ -166,6 +168,7 @@ void GameObject::RemoveFromWorld()
             GetMap()->RemoveGameObjectModel(*m_model);
 
         GetMap()->GetObjectsStore().erase<GameObject>(GetObjectGuid(), (GameObject*)nullptr);
+        GetMap()->IncrementObjectRemovalCounter();
         if (GetDbGuid())
             GetMap()->RemoveDbGuidObject(this);
 
@@ -310,6 +313,23 @@ void GameObject::Update(const uint32 diff)
         return;
     }
 
+    // Idle shortcut: the vast majority of spawned objects (chests, ore nodes,
+    // doors, chairs, signs...) sit in GO_READY with nothing armed and only ever
+    // react to a deadline or a player interaction. For those, skip the state
+    // machine entirely. The predicate is re-evaluated from scratch each tick, so
+    // anything that arms a timer, attaches an event, or flips the loot state
+    // brings the object straight back onto the full path next update.
+    if (m_lootState == GO_READY && !m_respawnTime && m_spawnedByDefault && !m_AI &&
+            !m_delayedActionTimer && !m_events.HasEvents() && IsEventDrivenType())
+    {
+        uint32 const maxCharges = GetGOInfo()->GetCharges();
+        if (!maxCharges || !m_useTimes)                     // a started charge count must reach the despawn check below
+        {
+            WorldObject::Update(diff);                      // heartbeat only
+            return;
+        }
+    }
+
     m_events.Update(diff);
 
     switch (m_lootState)
@@ -325,6 +345,7 @@ void GameObject::Update(const uint32 diff)
                     if (owner && owner->IsInCombat())
                         m_cooldownTime = time(nullptr) + GetGOInfo()->trap.startDelay;
                     m_lootState = GO_READY;
+                    m_trapSearchPending = true;             // check for units already standing inside
                     break;
                 }
                 case GAMEOBJECT_TYPE_FISHINGNODE:           // Keep not ready for some delay
@@ -435,32 +456,15 @@ void GameObject::Update(const uint32 diff)
                 GameObjectInfo const* goInfo = GetGOInfo();
                 if (goInfo->type == GAMEOBJECT_TYPE_TRAP && GetGoState() == GO_STATE_READY)   // traps
                 {
-                    if (m_cooldownTime < time(nullptr))
+                    // The search only runs while the trap is stirred: arming and
+                    // rearming check once for units already standing inside, after
+                    // that nearby unit relocations re-stir it (OnUnitRelocation)
+                    // instead of the trap sweeping its radius with a grid searcher
+                    // every tick
+                    if (m_trapSearchPending && m_cooldownTime < time(nullptr))
                     {
-                        // FIXME: this is activation radius (in different casting radius that must be selected from spell data)
                         // TODO: move activated state code (cast itself) to GO_ACTIVATED, in this place only check activating and set state
-                        float radius = float(goInfo->trap.diameter) / 2.0f;
-
-                        // behavior verified on classic
-                        // TODO: needs more research
-                        if (goInfo->GetLockId() == 12) // 21 objects currently (hunter traps), all with 5 or less for diameter -> use diameter as radius instead
-                            radius = float(goInfo->trap.diameter);
-
-                        bool valid = true;
-                        if (!radius)
-                        {
-                            if (goInfo->trap.cooldown != 3)     // cast in other case (at some triggering/linked go/etc explicit call)
-                                valid = false;
-                            else
-                            {
-                                if (m_respawnTime > 0)
-                                    valid = false;
-                                else // battlegrounds gameobjects has data2 == 0 && data5 == 3
-                                    radius = float(goInfo->trap.cooldown);
-                            }
-                        }
-
-                        if (valid)
+                        if (float radius = GetTrapSearchRadius())
                         {
                             // Should trap trigger?
                             Unit* target = nullptr;                     // pointer to appropriate target if found any
@@ -484,9 +488,17 @@ void GameObject::Update(const uint32 diff)
                                     }
                                     case 2: // all
                                     {
-                                        MaNGOS::AnyUnitInObjectRangeCheck u_check(this, radius);
-                                        MaNGOS::UnitSearcher<MaNGOS::AnyUnitInObjectRangeCheck> checker(target, u_check);
-                                        Cell::VisitAllObjects(this, checker, radius);
+                                        // packed mirror prescan first, the exact range check runs on survivors only
+                                        std::vector<Unit*> candidates;
+                                        GetMap()->ScanSnapshotUnitsInRange(GetPositionX(), GetPositionY(), GetPositionZ(), radius, GetCombatReach(), candidates);
+                                        for (Unit* candidate : candidates)
+                                        {
+                                            if (candidate->IsAlive() && IsWithinDistInMap(candidate, radius))
+                                            {
+                                                target = candidate;
+                                                break;
+                                            }
+                                        }
                                         break;
                                     }
                                     default: // unfriendly
@@ -499,8 +511,13 @@ void GameObject::Update(const uint32 diff)
                                 }
                             }
 
-                            if (target && (!goInfo->trapCustom.triggerOn || !target->HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_UNINTERACTIBLE))) // do not trigger on hostile traps if not selectable
-                                Use(target);
+                            if (target)
+                            {
+                                if (!goInfo->trapCustom.triggerOn || !target->HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_UNINTERACTIBLE)) // do not trigger on hostile traps if not selectable
+                                    Use(target);
+                            }
+                            else // dormant until something moves nearby
+                                m_trapSearchPending = false;
                         }
                     }
                 }
@@ -559,7 +576,11 @@ void GameObject::Update(const uint32 diff)
                     m_captureTimer += diff;
                     if (m_captureTimer >= 5000)
                     {
-                        TickCapturePoint();
+                        // empty points go dormant instead of sweeping their radius
+                        // every tick; nearby player relocations re-stir them
+                        // (OnUnitRelocation), so idle contested zones cost nothing
+                        if (m_capturePending || !m_UniqueUsers.empty())
+                            TickCapturePoint();
                         m_captureTimer -= 5000;
                     }
                     break;
@@ -583,7 +604,7 @@ void GameObject::Update(const uint32 diff)
             switch (GetGoType())
             {
                 case GAMEOBJECT_TYPE_TRAP:
-                    if (m_events.GetEvents().size() > 0)
+                    if (m_events.HasEvents())
                     {
                         preventDespawn = true;
                         break;
@@ -1032,24 +1053,14 @@ GameObjectInfo const* GameObject::GetGOInfo() const
 /*********************************************************/
 bool GameObject::HasQuest(uint32 quest_id) const
 {
-    QuestRelationsMapBounds bounds = sObjectMgr.GetGOQuestRelationsMapBounds(GetEntry());
-    for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-    {
-        if (itr->second == quest_id)
-            return true;
-    }
-    return false;
+    QuestRelations const& relations = sObjectMgr.GetGOQuestRelations(GetEntry());
+    return std::find(relations.begin(), relations.end(), quest_id) != relations.end();
 }
 
 bool GameObject::HasInvolvedQuest(uint32 quest_id) const
 {
-    QuestRelationsMapBounds bounds = sObjectMgr.GetGOQuestInvolvedRelationsMapBounds(GetEntry());
-    for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-    {
-        if (itr->second == quest_id)
-            return true;
-    }
-    return false;
+    QuestRelations const& relations = sObjectMgr.GetGOQuestInvolvedRelations(GetEntry());
+    return std::find(relations.begin(), relations.end(), quest_id) != relations.end();
 }
 
 bool GameObject::IsTransport() const
@@ -1067,6 +1078,18 @@ bool GameObject::IsMoTransport() const
     return gInfo->type == GAMEOBJECT_TYPE_MO_TRANSPORT;
 }
 
+bool GameObject::CanUseCachedCreateBlock(Player* target) const
+{
+    if (IsTransport())                                      // serialized with per-tick path progress
+        return false;
+
+    // GAMEOBJECT_DYN_FLAGS is evaluated per viewer for quest objects and GMs
+    if (target->IsGameMaster() || ActivateToQuest(target))
+        return false;
+
+    return CanShareValuesUpdateWith(target);
+}
+
 void GameObject::SaveRespawnTime()
 {
     if (m_respawnTime > time(nullptr) && m_spawnedByDefault)
@@ -1184,22 +1207,18 @@ bool GameObject::ActivateToQuest(Player* pTarget) const
             // these conditions are not sufficient/will fail.
             // Never expect flags|4 for these GO's? (NF-note: It doesn't appear it's expected)
 
-            QuestRelationsMapBounds bounds = sObjectMgr.GetGOQuestRelationsMapBounds(GetEntry());
-
-            for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+            for (uint32 quest_id : sObjectMgr.GetGOQuestRelations(GetEntry()))
             {
-                const Quest* qInfo = sObjectMgr.GetQuestTemplate(itr->second);
+                const Quest* qInfo = sObjectMgr.GetQuestTemplate(quest_id);
 
                 if (pTarget->CanTakeQuest(qInfo, false))
                     return true;
             }
 
-            bounds = sObjectMgr.GetGOQuestInvolvedRelationsMapBounds(GetEntry());
-
-            for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+            for (uint32 quest_id : sObjectMgr.GetGOQuestInvolvedRelations(GetEntry()))
             {
-                if ((pTarget->GetQuestStatus(itr->second) == QUEST_STATUS_INCOMPLETE || pTarget->GetQuestStatus(itr->second) == QUEST_STATUS_COMPLETE)
-                        && !pTarget->GetQuestRewardStatus(itr->second))
+                if ((pTarget->GetQuestStatus(quest_id) == QUEST_STATUS_INCOMPLETE || pTarget->GetQuestStatus(quest_id) == QUEST_STATUS_COMPLETE)
+                        && !pTarget->GetQuestRewardStatus(quest_id))
                     return true;
             }
 
@@ -2001,9 +2020,63 @@ void GameObject::UpdateRotationFields(float rotation2 /*=0.0f*/, float rotation3
     SetFloatValue(GAMEOBJECT_ROTATION + 3, rotation3);
 }
 
+float GameObject::GetTrapSearchRadius() const
+{
+    GameObjectInfo const* goInfo = GetGOInfo();
+    // FIXME: this is activation radius (in different casting radius that must be selected from spell data)
+    float radius = float(goInfo->trap.diameter) / 2.0f;
+
+    // behavior verified on classic
+    // TODO: needs more research
+    if (goInfo->GetLockId() == 12) // 21 objects currently (hunter traps), all with 5 or less for diameter -> use diameter as radius instead
+        radius = float(goInfo->trap.diameter);
+
+    if (!radius)
+    {
+        if (goInfo->trap.cooldown != 3 || m_respawnTime > 0)    // cast in other case (at some triggering/linked go/etc explicit call)
+            return 0.0f;
+        radius = float(goInfo->trap.cooldown);              // battlegrounds gameobjects has data2 == 0 && data5 == 3
+    }
+
+    return radius;
+}
+
+void GameObject::OnUnitRelocation(Unit* who)
+{
+    switch (GetGoType())
+    {
+        case GAMEOBJECT_TYPE_TRAP:
+        {
+            if (m_trapSearchPending || m_lootState != GO_READY)
+                return;
+
+            float const radius = GetTrapSearchRadius();
+            // the slack covers the relocation displacement gate and combat reach, so a
+            // unit cannot step past the stir distance between two notifications
+            if (radius && IsWithinDistInMap(who, radius + 6.0f))
+                m_trapSearchPending = true;
+            break;
+        }
+        case GAMEOBJECT_TYPE_CAPTURE_POINT:
+        {
+            if (m_capturePending || m_lootState != GO_ACTIVATED || !who->IsPlayer())
+                return;
+
+            float const radius = GetGOInfo()->capturePoint.radius;
+            if (radius && IsWithinDistInMap(who, radius + 6.0f))
+                m_capturePending = true;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
 void GameObject::SetLootState(LootState state, Unit* user/*= nullptr*/)
 {
     m_lootState = state;
+    if (state == GO_READY && GetGoType() == GAMEOBJECT_TYPE_TRAP)
+        m_trapSearchPending = true;                         // rearmed: re-check for units already standing inside
     UpdateCollisionState();
 
     // Call for GameObjectAI script
@@ -2281,7 +2354,15 @@ void GameObject::TickCapturePoint()
     {
         // set to inactive if all players left capture point zone
         if (m_UniqueUsers.empty())
+        {
             SetActiveObjectState(false);
+
+            // go dormant until a nearby relocation stirs the point again; points
+            // wider than the relocation notify coverage keep scanning, entering
+            // their radius would not reliably produce a stir
+            if (radius <= MAX_CREATURE_ATTACK_RADIUS)
+                m_capturePending = false;
+        }
         return;
     }
 
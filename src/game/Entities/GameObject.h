@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Globals/SharedDefines.h"
 #include "Entities/Object.h"
+#include "Entities/ObjectPool.h"
 #include "Util/Util.h"
 #include "AI/BaseAI/GameObjectAI.h"
 #include "Spells/SpellDefines.h"
@@ -691,6 +692,9 @@ class GameObject : public WorldObject
         explicit GameObject();
         ~GameObject();
 
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         static GameObject* CreateGameObject(uint32 entry);
 
         void AddToWorld() override;
@@ -705,6 +709,8 @@ class GameObject : public WorldObject
         bool IsTransport() const;
         bool IsMoTransport() const;
 
+        bool CanUseCachedCreateBlock(Player* target) const override;
+
         bool HasStaticDBSpawnData() const;                  // listed in `gameobject` table and have fixed in DB guid
 
         void UpdateRotationFields(float rotation2 = 0.0f, float rotation3 = 0.0f);
@@ -766,6 +772,24 @@ class GameObject : public WorldObject
         void Delete();
 
         GameobjectTypes GetGoType() const { return GameobjectTypes(GetUInt32Value(GAMEOBJECT_TYPE_ID)); }
+        // types that only do work on a deadline or interaction - see the idle
+        // shortcut in GameObject::Update; actively ticking types (traps running
+        // periodic target searches, capture points, fishing nodes, transports)
+        // must run the full state machine every tick
+        bool IsEventDrivenType() const
+        {
+            switch (GetGoType())
+            {
+                case GAMEOBJECT_TYPE_TRAP:
+                case GAMEOBJECT_TYPE_FISHINGNODE:
+                case GAMEOBJECT_TYPE_TRANSPORT:
+                case GAMEOBJECT_TYPE_MO_TRANSPORT:
+                case GAMEOBJECT_TYPE_CAPTURE_POINT:
+                    return false;
+                default:
+                    return true;
+            }
+        }
         void SetGoType(GameobjectTypes type) { SetUInt32Value(GAMEOBJECT_TYPE_ID, type); }
         GOState GetGoState() const { return GOState(GetUInt32Value(GAMEOBJECT_STATE)); }
         void SetGoState(GOState state);
@@ -786,6 +810,13 @@ class GameObject : public WorldObject
         LootState GetLootState() const { return m_lootState; }
         void SetLootState(LootState state, Unit* user = nullptr);
 
+        // activation radius of a radius-triggered trap, 0 for traps only fired explicitly
+        float GetTrapSearchRadius() const;
+        // stirs a dormant armed trap or idle capture point when a unit moves
+        // in its vicinity; the target/player search itself stays with
+        // GameObject::Update
+        void OnUnitRelocation(Unit* who);
+
         void AddToSkillupList(Player* player);
         bool IsInSkillupList(Player* player) const;
         void ClearSkillupList() { m_SkillupSet.clear(); }
@@ -922,6 +953,10 @@ class GameObject : public WorldObject
 
         // Used for trap type
         time_t m_rearmTimer;                                // timer to rearm the trap once disarmed
+        bool m_trapSearchPending;                           // armed trap must run its target search; cleared when a search finds nothing, re-set by nearby relocations
+
+        // Used for capture point type
+        bool m_capturePending;                              // capture point must run its player scan; cleared when the point sits empty, re-set by nearby relocations
 
         // Used for chest type
         bool m_isInUse;                                     // only one player at time are allowed to open chest
@@ -557,6 +557,15 @@ Player* Item::GetOwner()const
     return sObjectMgr.GetPlayer(GetOwnerGuid());
 }
 
+void Item::SetCount(uint32 value)
+{
+    SetUInt32Value(ITEM_FIELD_STACK_COUNT, value);
+
+    // stack size changes do not pass through the player's store/remove paths
+    if (Player* owner = GetOwner())
+        owner->InvalidateItemCountCache();
+}
+
 uint32 Item::GetSkill() const
 {
     const static uint32 item_weapon_skills[MAX_ITEM_SUBCLASS_WEAPON] =
@@ -1015,6 +1024,11 @@ void Item::AddToClientUpdateList()
 {
     if (Player* pl = GetOwner())
         pl->GetMap()->AddUpdateObject(this);
+
+    // first change since the last flush: the container's cached create block
+    // for this slot no longer matches
+    if (m_container)
+        m_container->OnSlotItemChanged(GetSlot());
 }
 
 void Item::RemoveFromClientUpdateList()
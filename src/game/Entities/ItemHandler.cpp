@@ -26,6 +26,7 @@
 #include "Entities/Item.h"
 #include "Entities/UpdateData.h"
 #include "Chat/Chat.h"
+#include "World/World.h"
 
 void WorldSession::HandleSplitItemOpcode(WorldPacket& recv_data)
 {
@@ -730,6 +731,43 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
     uint8 customitems = vItems ? vItems->GetItemCount() : 0;
     uint8 numitems = customitems + (tItems ? tItems->GetItemCount() : 0);
 
+    float discountMod = _player->GetReputationPriceDiscount(pCreature);
+
+    // the row selection below only depends on (entry, class, race, reputation
+    // rank, discount) unless per-item conditions or GM visibility are involved -
+    // reuse one built list for everyone matching the key and patch live limited
+    // stock counts into the cached bytes
+    bool cacheable = sWorld.getConfig(CONFIG_BOOL_VENDOR_LIST_CACHE) && !_player->IsGameMaster();
+    for (int i = 0; i < numitems && cacheable; ++i)
+        if (VendorItem const* crItem = i < customitems ? vItems->GetItem(i) : tItems->GetItem(i - customitems))
+            if (crItem->conditionId)
+                cacheable = false;
+
+    uint64 cacheKey = 0;
+    if (cacheable)
+    {
+        FactionTemplateEntry const* factionTemplate = pCreature->GetFactionTemplateEntry();
+        uint32 repRank = factionTemplate ? uint32(_player->GetReputationRank(factionTemplate->faction)) : 0;
+        cacheKey = (uint64(pCreature->GetEntry()) << 32) | (uint64(_player->getClass()) << 24)
+                   | (uint64(_player->getRace()) << 16) | (uint64(repRank) << 8) | uint64(uint8(discountMod * 100.0f + 0.5f));
+
+        if (ObjectMgr::VendorListCache const* cache = sObjectMgr.GetVendorListCache(cacheKey))
+        {
+            WorldPacket cached(SMSG_LIST_INVENTORY, 8 + cache->payload.size());
+            cached << ObjectGuid(vendorguid);
+            cached.append(cache->payload.data(), cache->payload.size());
+            for (auto& slot : cache->limitedSlots)
+            {
+                uint32 index = slot.second;
+                if (VendorItem const* crItem = index < customitems ? vItems->GetItem(index) : tItems->GetItem(index - customitems))
+                    cached.put<uint32>(8 + slot.first, pCreature->GetVendorItemCurrentCount(crItem));
+            }
+            SendPacket(cached);
+            return;
+        }
+    }
+
+    ObjectMgr::VendorListCache cache;
     uint8 count = 0;
 
     WorldPacket data(SMSG_LIST_INVENTORY, (8 + 1 + numitems * 7 * 4));
@@ -738,8 +776,6 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
     size_t count_pos = data.wpos();
     data << uint8(count);
 
-    float discountMod = _player->GetReputationPriceDiscount(pCreature);
-
     for (int i = 0; i < numitems; ++i)
     {
         VendorItem const* crItem = i < customitems ? vItems->GetItem(i) : tItems->GetItem(i - customitems);
@@ -777,6 +813,8 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
                 data << uint32(count);
                 data << uint32(itemId);
                 data << uint32(pProto->DisplayInfoID);
+                if (crItem->maxcount > 0)
+                    cache.limitedSlots.push_back({ uint32(data.wpos() - 8), uint32(i) });
                 data << uint32(crItem->maxcount <= 0 ? 0xFFFFFFFF : pCreature->GetVendorItemCurrentCount(crItem));
                 data << uint32(price);
                 data << uint32(pProto->MaxDurability);
@@ -789,13 +827,16 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
     }
 
     if (count == 0)
-    {
         data << uint8(0);                                   // "Vendor has no inventory"
-        SendPacket(data);
-        return;
+    else
+        data.put<uint8>(count_pos, count);
+
+    if (cacheable)
+    {
+        cache.payload.assign(data.contents() + 8, data.contents() + data.size());
+        sObjectMgr.StoreVendorListCache(cacheKey, std::move(cache));
     }
 
-    data.put<uint8>(count_pos, count);
     SendPacket(data);
 }
 
@@ -44,14 +44,21 @@
 #include "Loot/LootMgr.h"
 #include "Spells/SpellMgr.h"
 #include "MotionGenerators/PathFinder.h"
+#include "Entities/ObjectPool.h"
+#include "World/MemoryTrend.h"
 
 Object::Object(): m_updateFlag(0), m_itsNewObject(false), m_dbGuid(0), m_scriptRef(this, NoopObjectDeleter())
 {
+    MemoryTrend::Account(MEMTREND_OBJECTS, +1);
+
     m_objectTypeId      = TYPEID_OBJECT;
     m_objectType        = TYPEMASK_OBJECT;
 
     m_uint32Values      = nullptr;
+    m_changedBits       = nullptr;
     m_valuesCount       = 0;
+    m_firstChangedIndex = 0;
+    m_lastChangedIndex  = 0;
 
     m_inWorld           = false;
     m_objectUpdated     = false;
@@ -60,6 +67,8 @@ Object::Object(): m_updateFlag(0), m_itsNewObject(false), m_dbGuid(0), m_scriptR
 
 Object::~Object()
 {
+    MemoryTrend::Account(MEMTREND_OBJECTS, -1);
+
     if (IsInWorld())
     {
         ///- Do NOT call RemoveFromWorld here, if the object is a player it will crash
@@ -73,7 +82,8 @@ Object::~Object()
         MANGOS_ASSERT(false);
     }
 
-    delete[] m_uint32Values;
+    if (m_uint32Values)
+        MaNGOS::ObjectMemoryPool::Release(m_uint32Values, (m_valuesCount + GetChangedBitsWords()) * sizeof(uint32));
 
     delete m_loot;
 }
@@ -104,10 +114,13 @@ void Object::RemoveFromWorld()
 
 void Object::_InitValues()
 {
-    m_uint32Values = new uint32[ m_valuesCount ];
-    memset(m_uint32Values, 0, m_valuesCount * sizeof(uint32));
+    // values and dirty bit words share one pool block
+    m_uint32Values = static_cast<uint32*>(MaNGOS::ObjectMemoryPool::Acquire((m_valuesCount + GetChangedBitsWords()) * sizeof(uint32)));
+    memset(m_uint32Values, 0, (m_valuesCount + GetChangedBitsWords()) * sizeof(uint32));
 
-    m_changedValues.resize(m_valuesCount, false);
+    m_changedBits = m_uint32Values + m_valuesCount;
+    m_firstChangedIndex = m_valuesCount;
+    m_lastChangedIndex = 0;
 
     m_objectUpdated = false;
 }
@@ -168,6 +181,27 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
     if (!target)
         return;
 
+    // a static spawn serializes identically for every plain viewer: reuse one
+    // cached block instead of rebuilding it for each player walking into view
+    if (CanUseCachedCreateBlock(target))
+    {
+        if (!m_createBlockCache)
+            m_createBlockCache.reset(new ByteBuffer(500));
+
+        if (m_createBlockCache->empty())
+            BuildCreateUpdateBlock(*m_createBlockCache, target);
+
+        data->AddUpdateBlock(*m_createBlockCache);
+        return;
+    }
+
+    ByteBuffer buf(500);
+    BuildCreateUpdateBlock(buf, target);
+    data->AddUpdateBlock(buf);
+}
+
+void Object::BuildCreateUpdateBlock(ByteBuffer& buf, Player* target) const
+{
     uint8  updatetype   = UPDATETYPE_CREATE_OBJECT;
     uint8 updateFlags  = m_updateFlag;
 
@@ -200,7 +234,6 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
 
     // DEBUG_LOG("BuildCreateUpdate: update-type: %u, object-type: %u got updateFlags: %X", updatetype, m_objectTypeId, updateFlags);
 
-    ByteBuffer buf(500);
     buf << uint8(updatetype);
     buf << GetPackGUID();
     buf << uint8(m_objectTypeId);
@@ -210,7 +243,6 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
     updateMask.SetCount(m_valuesCount);
     _SetCreateBits(updateMask, target);
     BuildValuesUpdate(updatetype, &buf, &updateMask, target);
-    data->AddUpdateBlock(buf);
 }
 
 void Object::SendCreateUpdateToPlayer(Player* player) const
@@ -256,6 +288,55 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData& data, UpdateMask& updat
     data.AddUpdateBlock(buf);
 }
 
+// true when one of the changed fields is serialized differently per viewer in
+// BuildValuesUpdate, making the built block unshareable between viewers
+bool Object::HasViewerDependentChanges() const
+{
+    if (isType(TYPEMASK_GAMEOBJECT))
+        return !static_cast<GameObject const*>(this)->IsTransport();    // quest activation state is evaluated per viewer
+
+    if (isType(TYPEMASK_UNIT))
+    {
+        static uint16 const viewerDependentFields[] = { UNIT_NPC_FLAGS, UNIT_FIELD_HEALTH, UNIT_FIELD_MAXHEALTH, UNIT_FIELD_FLAGS, UNIT_DYNAMIC_FLAGS, UNIT_FIELD_FACTIONTEMPLATE };
+        for (uint16 index : viewerDependentFields)
+            if (IsChangedValue(index))
+                return true;
+        return false;
+    }
+
+    if (isType(TYPEMASK_CORPSE))
+        return IsChangedValue(CORPSE_FIELD_BYTES_1) && sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP);
+
+    return false;
+}
+
+// viewers with plain public visibility get the same update mask and the same
+// bytes - self, owners, group members and special-info viewers do not
+bool Object::CanShareValuesUpdateWith(Player* target) const
+{
+    if (target == this)
+        return false;
+
+    uint16 const* flags = nullptr;
+    uint16 visibleFlag = GetUpdateFieldFlagsForTarget(target, flags);
+    return visibleFlag == (UF_FLAG_PUBLIC | UF_FLAG_DYNAMIC);
+}
+
+bool Object::BuildSharedValuesUpdateBlock(ByteBuffer& buf, Player* target) const
+{
+    UpdateMask updateMask;
+    updateMask.SetCount(m_valuesCount);
+
+    _SetUpdateBits(updateMask, target);
+    if (!updateMask.HasData())
+        return false;
+
+    buf << uint8(UPDATETYPE_VALUES);
+    buf << GetPackGUID();
+    BuildValuesUpdate(UPDATETYPE_VALUES, &buf, &updateMask, target);
+    return true;
+}
+
 void Object::BuildForcedValuesUpdateBlockForPlayer(UpdateData* data, Player* target) const
 {
     ByteBuffer buf(500);
@@ -424,316 +505,306 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
     // 2 specialized loops for speed optimization in non-unit case
     if (isType(TYPEMASK_UNIT))                              // unit (creature/player) case
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint16 index = updateMask->FindNextSetBit(0); index < m_valuesCount; index = updateMask->FindNextSetBit(index + 1))
         {
-            if (updateMask->GetBit(index))
+            if (index == UNIT_NPC_FLAGS)
             {
-                if (index == UNIT_NPC_FLAGS)
-                {
-                    uint32 appendValue = m_uint32Values[index];
+                uint32 appendValue = m_uint32Values[index];
 
-                    if (GetTypeId() == TYPEID_UNIT)
+                if (GetTypeId() == TYPEID_UNIT)
+                {
+                    if (appendValue & UNIT_NPC_FLAG_TRAINER)
                     {
-                        if (appendValue & UNIT_NPC_FLAG_TRAINER)
-                        {
-                            if (!((Creature*)this)->IsTrainerOf(target, false))
-                                appendValue &= ~UNIT_NPC_FLAG_TRAINER;
-                        }
+                        if (!((Creature*)this)->IsTrainerOf(target, false))
+                            appendValue &= ~UNIT_NPC_FLAG_TRAINER;
+                    }
 
-                        if (appendValue & UNIT_NPC_FLAG_STABLEMASTER)
-                        {
-                            if (target->getClass() != CLASS_HUNTER)
-                                appendValue &= ~UNIT_NPC_FLAG_STABLEMASTER;
-                        }
+                    if (appendValue & UNIT_NPC_FLAG_STABLEMASTER)
+                    {
+                        if (target->getClass() != CLASS_HUNTER)
+                            appendValue &= ~UNIT_NPC_FLAG_STABLEMASTER;
+                    }
 
-                        if (appendValue & UNIT_NPC_FLAG_FLIGHTMASTER)
+                    if (appendValue & UNIT_NPC_FLAG_FLIGHTMASTER)
+                    {
+                        for (uint32 quest_id : sObjectMgr.GetCreatureQuestRelations(((Creature*)this)->GetEntry()))
                         {
-                            QuestRelationsMapBounds bounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(((Creature*)this)->GetEntry());
-                            for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+                            Quest const* pQuest = sObjectMgr.GetQuestTemplate(quest_id);
+                            if (target->CanSeeStartQuest(pQuest))
                             {
-                                Quest const* pQuest = sObjectMgr.GetQuestTemplate(itr->second);
-                                if (target->CanSeeStartQuest(pQuest))
-                                {
-                                    appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
-                                    break;
-                                }
+                                appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
+                                break;
                             }
+                        }
 
-                            bounds = sObjectMgr.GetCreatureQuestInvolvedRelationsMapBounds(((Creature*)this)->GetEntry());
-                            for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+                        for (uint32 quest_id : sObjectMgr.GetCreatureQuestInvolvedRelations(((Creature*)this)->GetEntry()))
+                        {
+                            Quest const* pQuest = sObjectMgr.GetQuestTemplate(quest_id);
+                            if (target->CanRewardQuest(pQuest, false))
                             {
-                                Quest const* pQuest = sObjectMgr.GetQuestTemplate(itr->second);
-                                if (target->CanRewardQuest(pQuest, false))
-                                {
-                                    appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
-                                    break;
-                                }
+                                appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
+                                break;
                             }
                         }
                     }
+                }
 
-                    *data << uint32(appendValue);
+                *data << uint32(appendValue);
+            }
+            // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+            else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
+            {
+                // convert from float to uint32 and send
+                *data << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+            }
+
+            // there are some float values which may be negative or can't get negative due to other checks
+            else if ((index >= PLAYER_FIELD_NEGSTAT0    && index <= PLAYER_FIELD_NEGSTAT4) ||
+                     (index >= PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
+                     (index >= PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
+                     (index >= PLAYER_FIELD_POSSTAT0    && index <= PLAYER_FIELD_POSSTAT4))
+            {
+                *data << uint32(m_floatValues[index]);
+            }
+            else if (index == UNIT_FIELD_HEALTH || index == UNIT_FIELD_MAXHEALTH)
+            {
+                uint32 value = m_uint32Values[index];
+
+                // Fog of War: replace absolute health values with percentages for non-allied units according to settings
+                if (!static_cast<const Unit*>(this)->IsFogOfWarVisibleHealth(target) &&
+                    !target->CanSeeSpecialInfoOf(static_cast<const Unit*>(this)))
+                {
+                    switch (index)
+                    {
+                        case UNIT_FIELD_HEALTH:     value = uint32(ceil((100.0 * value) / m_uint32Values[UNIT_FIELD_MAXHEALTH]));   break;
+                        case UNIT_FIELD_MAXHEALTH:  value = 100;                                                                    break;
+                    }
                 }
-                // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-                else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
+
+                *data << value;
+            }
+            else if (index == UNIT_FIELD_FLAGS)
+            {
+                uint32 value = m_uint32Values[index];
+
+                // For gamemasters in GM mode:
+                if (target->IsGameMaster())
                 {
-                    // convert from float to uint32 and send
-                    *data << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+                    // Gamemasters should be always able to select units - remove not selectable flag:
+                    value &= ~UNIT_FLAG_UNINTERACTIBLE;
                 }
 
-                // there are some float values which may be negative or can't get negative due to other checks
-                else if ((index >= PLAYER_FIELD_NEGSTAT0    && index <= PLAYER_FIELD_NEGSTAT4) ||
-                         (index >= PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
-                         (index >= PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
-                         (index >= PLAYER_FIELD_POSSTAT0    && index <= PLAYER_FIELD_POSSTAT4))
+                // Client bug workaround: Fix for missing chat channels when resuming taxi flight on login
+                // Client does not send any chat joining attempts by itself when taxi flag is on
+                if (target == this && (value & UNIT_FLAG_TAXI_FLIGHT))
                 {
-                    *data << uint32(m_floatValues[index]);
+                    if (sWorld.getConfig(CONFIG_BOOL_TAXI_FLIGHT_CHAT_FIX))
+                        if (WorldSession* session = static_cast<Player const*>(this)->GetSession())
+                            if (!session->IsInitialZoneUpdated())
+                                value &= ~UNIT_FLAG_TAXI_FLIGHT;
                 }
-                else if (index == UNIT_FIELD_HEALTH || index == UNIT_FIELD_MAXHEALTH)
+
+                // On login/reconnect: delay combat state application at client UI to not interfere with secure frames init
+                if (target == this && (value & UNIT_FLAG_IN_COMBAT))
                 {
-                    uint32 value = m_uint32Values[index];
+                    if (static_cast<Player const*>(this)->GetSession()->PlayerLoading())
+                        value &= ~UNIT_FLAG_IN_COMBAT;
+                }
 
-                    // Fog of War: replace absolute health values with percentages for non-allied units according to settings
-                    if (!static_cast<const Unit*>(this)->IsFogOfWarVisibleHealth(target) &&
-                        !target->CanSeeSpecialInfoOf(static_cast<const Unit*>(this)))
-                    {
-                        switch (index)
-                        {
-                            case UNIT_FIELD_HEALTH:     value = uint32(ceil((100.0 * value) / m_uint32Values[UNIT_FIELD_MAXHEALTH]));   break;
-                            case UNIT_FIELD_MAXHEALTH:  value = 100;                                                                    break;
-                        }
-                    }
+                *data << value;
+            }
+            // Hide lootable animation for unallowed players
+            // Handle tapped flag
+            else if (index == UNIT_DYNAMIC_FLAGS && GetTypeId() == TYPEID_UNIT)
+            {
+                Creature* creature = (Creature*)this;
+                uint32 dynflagsValue = m_uint32Values[index];
+                bool setTapFlags = false;
 
-                    *data << value;
-                }
-                else if (index == UNIT_FIELD_FLAGS)
+                if (creature->IsAlive())
                 {
-                    uint32 value = m_uint32Values[index];
-
-                    // For gamemasters in GM mode:
-                    if (target->IsGameMaster())
-                    {
-                        // Gamemasters should be always able to select units - remove not selectable flag:
-                        value &= ~UNIT_FLAG_UNINTERACTIBLE;
-                    }
+                    // creature is alive so, not lootable
+                    dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
 
-                    // Client bug workaround: Fix for missing chat channels when resuming taxi flight on login
-                    // Client does not send any chat joining attempts by itself when taxi flag is on
-                    if (target == this && (value & UNIT_FLAG_TAXI_FLIGHT))
+                    if (creature->IsInCombat())
                     {
-                        if (sWorld.getConfig(CONFIG_BOOL_TAXI_FLIGHT_CHAT_FIX))
-                            if (WorldSession* session = static_cast<Player const*>(this)->GetSession())
-                                if (!session->IsInitialZoneUpdated())
-                                    value &= ~UNIT_FLAG_TAXI_FLIGHT;
+                        // as creature is in combat we have to manage tap flags
+                        setTapFlags = true;
                     }
-
-                    // On login/reconnect: delay combat state application at client UI to not interfere with secure frames init
-                    if (target == this && (value & UNIT_FLAG_IN_COMBAT))
+                    else
                     {
-                        if (static_cast<Player const*>(this)->GetSession()->PlayerLoading())
-                            value &= ~UNIT_FLAG_IN_COMBAT;
+                        // creature is not in combat so its not tapped
+                        dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
+                        //sLog.outString(">> %s is not in combat so not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
                     }
-
-                    *data << value;
                 }
-                // Hide lootable animation for unallowed players
-                // Handle tapped flag
-                else if (index == UNIT_DYNAMIC_FLAGS && GetTypeId() == TYPEID_UNIT)
+                else
                 {
-                    Creature* creature = (Creature*)this;
-                    uint32 dynflagsValue = m_uint32Values[index];
-                    bool setTapFlags = false;
-
-                    if (creature->IsAlive())
+                    // check loot flag
+                    if (creature->m_loot && creature->m_loot->CanLoot(target))
                     {
-                        // creature is alive so, not lootable
-                        dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
-
-                        if (creature->IsInCombat())
-                        {
-                            // as creature is in combat we have to manage tap flags
-                            setTapFlags = true;
-                        }
-                        else
-                        {
-                            // creature is not in combat so its not tapped
-                            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
-                            //sLog.outString(">> %s is not in combat so not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
+                        // creature is dead and this player can loot it
+                        dynflagsValue = dynflagsValue | UNIT_DYNFLAG_LOOTABLE;
+                        //sLog.outString(">> %s is lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
                     }
                     else
                     {
-                        // check loot flag
-                        if (creature->m_loot && creature->m_loot->CanLoot(target))
-                        {
-                            // creature is dead and this player can loot it
-                            dynflagsValue = dynflagsValue | UNIT_DYNFLAG_LOOTABLE;
-                            //sLog.outString(">> %s is lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-                        else
-                        {
-                            // creature is dead but this player cannot loot it
-                            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
-                            //sLog.outString(">> %s is not lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-
-                        // as creature is died we have to manage tap flags
-                        setTapFlags = true;
+                        // creature is dead but this player cannot loot it
+                        dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
+                        //sLog.outString(">> %s is not lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
                     }
 
-                    // check tap flags
-                    if (setTapFlags)
+                    // as creature is died we have to manage tap flags
+                    setTapFlags = true;
+                }
+
+                // check tap flags
+                if (setTapFlags)
+                {
+                    if (creature->IsTappedBy(target))
                     {
-                        if (creature->IsTappedBy(target))
-                        {
-                            // creature is in combat or died and tapped by this player
-                            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
-                            //sLog.outString(">> %s is tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-                        else
-                        {
-                            // creature is in combat or died but not tapped by this player
-                            dynflagsValue = dynflagsValue | UNIT_DYNFLAG_TAPPED;
-                            //sLog.outString(">> %s is not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
+                        // creature is in combat or died and tapped by this player
+                        dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
+                        //sLog.outString(">> %s is tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
                     }
-
-                    if (GetTypeId() == TYPEID_UNIT || GetTypeId() == TYPEID_PLAYER)
+                    else
                     {
-                        Unit const* unit = static_cast<const Unit*>(this); // hunters mark effects should only be visible to owners and not all players
-                        if (!unit->HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetObjectGuid()))
-                            dynflagsValue &= ~UNIT_DYNFLAG_TRACK_UNIT;
+                        // creature is in combat or died but not tapped by this player
+                        dynflagsValue = dynflagsValue | UNIT_DYNFLAG_TAPPED;
+                        //sLog.outString(">> %s is not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
                     }
+                }
 
-                    *data << dynflagsValue;
+                if (GetTypeId() == TYPEID_UNIT || GetTypeId() == TYPEID_PLAYER)
+                {
+                    Unit const* unit = static_cast<const Unit*>(this); // hunters mark effects should only be visible to owners and not all players
+                    if (!unit->HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetObjectGuid()))
+                        dynflagsValue &= ~UNIT_DYNFLAG_TRACK_UNIT;
                 }
-                else if (index == UNIT_FIELD_FACTIONTEMPLATE)
+
+                *data << dynflagsValue;
+            }
+            else if (index == UNIT_FIELD_FACTIONTEMPLATE)
+            {
+                uint32 value = m_uint32Values[index];
+
+                // [XFACTION]: Alter faction if detected crossfaction group interaction when updating faction field:
+                if (this != target && GetTypeId() == TYPEID_PLAYER)
                 {
-                    uint32 value = m_uint32Values[index];
+                    Player const* thisPlayer = static_cast<Player const*>(this);
 
-                    // [XFACTION]: Alter faction if detected crossfaction group interaction when updating faction field:
-                    if (this != target && GetTypeId() == TYPEID_PLAYER)
+                    if (sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP) && target->IsInGroup(thisPlayer))
                     {
-                        Player const* thisPlayer = static_cast<Player const*>(this);
+                        const uint32 targetTeam = target->GetTeam();
 
-                        if (sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP) && target->IsInGroup(thisPlayer))
+                        if (thisPlayer->GetTeam() != targetTeam && value == Player::getFactionForRace(thisPlayer->getRace()))
                         {
-                            const uint32 targetTeam = target->GetTeam();
-
-                            if (thisPlayer->GetTeam() != targetTeam && value == Player::getFactionForRace(thisPlayer->getRace()))
+                            switch (targetTeam)
                             {
-                                switch (targetTeam)
-                                {
-                                    case ALLIANCE:  value = 1054;   break;  // "Alliance Generic"
-                                    case HORDE:     value = 1495;   break;  // "Horde Generic"
-                                }
+                                case ALLIANCE:  value = 1054;   break;  // "Alliance Generic"
+                                case HORDE:     value = 1495;   break;  // "Horde Generic"
                             }
                         }
                     }
-
-                    *data << value;
-                }
-                else                                        // Unhandled index, just send
-                {
-                    // send in current format (float as float, uint32 as uint32)
-                    *data << m_uint32Values[index];
                 }
+
+                *data << value;
+            }
+            else                                        // Unhandled index, just send
+            {
+                // send in current format (float as float, uint32 as uint32)
+                *data << m_uint32Values[index];
             }
         }
     }
     else if (isType(TYPEMASK_CORPSE))                       // corpse case
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint16 index = updateMask->FindNextSetBit(0); index < m_valuesCount; index = updateMask->FindNextSetBit(index + 1))
         {
-            if (updateMask->GetBit(index))
+            if (index == CORPSE_FIELD_BYTES_1)
             {
-                if (index == CORPSE_FIELD_BYTES_1)
+                uint32 value = m_uint32Values[index];
+
+                // [XFACTION]: Alter race field if detected crossfaction group interaction:
+                if (sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP))
                 {
-                    uint32 value = m_uint32Values[index];
+                    Corpse const* thisCorpse = static_cast<Corpse const*>(this);
+                    ObjectGuid const& ownerGuid = thisCorpse->GetOwnerGuid();
+                    Group const* targetGroup = target->GetGroup();
 
-                    // [XFACTION]: Alter race field if detected crossfaction group interaction:
-                    if (sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP))
+                    if (ownerGuid != target->GetObjectGuid() && targetGroup && targetGroup->IsMember(ownerGuid))
                     {
-                        Corpse const* thisCorpse = static_cast<Corpse const*>(this);
-                        ObjectGuid const& ownerGuid = thisCorpse->GetOwnerGuid();
-                        Group const* targetGroup = target->GetGroup();
-
-                        if (ownerGuid != target->GetObjectGuid() && targetGroup && targetGroup->IsMember(ownerGuid))
-                        {
-                            const uint8 targetRace = target->getRace();
+                        const uint8 targetRace = target->getRace();
 
-                            if (Player::TeamForRace(thisCorpse->getRace()) != Player::TeamForRace(targetRace))
-                                value = ((value &~ uint32(0xFF << 8)) | (uint32(targetRace) << 8));
-                        }
+                        if (Player::TeamForRace(thisCorpse->getRace()) != Player::TeamForRace(targetRace))
+                            value = ((value &~ uint32(0xFF << 8)) | (uint32(targetRace) << 8));
                     }
-
-                    *data << value;
                 }
-                else
-                    *data << m_uint32Values[index];         // other cases
+
+                *data << value;
             }
+            else
+                *data << m_uint32Values[index];         // other cases
         }
     }
     else if (isType(TYPEMASK_GAMEOBJECT))                   // gameobject case
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint16 index = updateMask->FindNextSetBit(0); index < m_valuesCount; index = updateMask->FindNextSetBit(index + 1))
         {
-            if (updateMask->GetBit(index))
+            // send in current format (float as float, uint32 as uint32)
+            if (index == GAMEOBJECT_DYN_FLAGS)
             {
-                // send in current format (float as float, uint32 as uint32)
-                if (index == GAMEOBJECT_DYN_FLAGS)
+                if (IsActivateToQuest)
                 {
-                    if (IsActivateToQuest)
+                    GameObject const* gameObject = static_cast<GameObject const*>(this);
+                    switch (((GameObject*)this)->GetGoType())
                     {
-                        GameObject const* gameObject = static_cast<GameObject const*>(this);
-                        switch (((GameObject*)this)->GetGoType())
-                        {
-                            case GAMEOBJECT_TYPE_QUESTGIVER:
-                            case GAMEOBJECT_TYPE_CHEST:
-                                if (gameObject->GetLootState() == GO_READY || gameObject->GetLootState() == GO_ACTIVATED)
-                                    *data << uint16(GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE);
-                                else
-                                    *data << uint16(0);
+                        case GAMEOBJECT_TYPE_QUESTGIVER:
+                        case GAMEOBJECT_TYPE_CHEST:
+                            if (gameObject->GetLootState() == GO_READY || gameObject->GetLootState() == GO_ACTIVATED)
+                                *data << uint16(GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE);
+                            else
                                 *data << uint16(0);
-                                break;
-                            case GAMEOBJECT_TYPE_GENERIC:
-                            case GAMEOBJECT_TYPE_SPELL_FOCUS:
-                            case GAMEOBJECT_TYPE_GOOBER:
-                                *data << uint16(GO_DYNFLAG_LO_ACTIVATE);
-                                *data << uint16(0);
-                                break;
-                            default:
-                                *data << uint32(0);         // unknown, not happen.
-                                break;
-                        }
+                            *data << uint16(0);
+                            break;
+                        case GAMEOBJECT_TYPE_GENERIC:
+                        case GAMEOBJECT_TYPE_SPELL_FOCUS:
+                        case GAMEOBJECT_TYPE_GOOBER:
+                            *data << uint16(GO_DYNFLAG_LO_ACTIVATE);
+                            *data << uint16(0);
+                            break;
+                        default:
+                            *data << uint32(0);         // unknown, not happen.
+                            break;
                     }
-                    else
-                        *data << uint32(0);                 // disable quest object
                 }
                 else
-                    *data << m_uint32Values[index];         // other cases
+                    *data << uint32(0);                 // disable quest object
             }
+            else
+                *data << m_uint32Values[index];         // other cases
         }
     }
     else                                                    // other objects case (no special index checks)
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint16 index = updateMask->FindNextSetBit(0); index < m_valuesCount; index = updateMask->FindNextSetBit(index + 1))
         {
-            if (updateMask->GetBit(index))
-            {
-                // send in current format (float as float, uint32 as uint32)
-                *data << m_uint32Values[index];
-            }
+            // send in current format (float as float, uint32 as uint32)
+            *data << m_uint32Values[index];
         }
     }
 }
 
 void Object::ClearUpdateMask(bool remove)
 {
-    if (m_uint32Values)
+    if (m_uint32Values && m_firstChangedIndex < m_valuesCount)
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
-            m_changedValues[index] = false;
+        uint32 firstWord = m_firstChangedIndex >> 5;
+        uint32 lastWord = m_lastChangedIndex >> 5;
+        memset(m_changedBits + firstWord, 0, (lastWord - firstWord + 1) * sizeof(uint32));
+
+        m_firstChangedIndex = m_valuesCount;
+        m_lastChangedIndex = 0;
     }
 
     if (m_objectUpdated)
@@ -828,9 +899,19 @@ void Object::_SetUpdateBits(UpdateMask& updateMask, Player* target) const
     uint16 visibleFlag = GetUpdateFieldFlagsForTarget(target, flags);
     MANGOS_ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-        if (m_changedValues[index] && (flags[index] & visibleFlag))
+    // mostly-clean objects only scan their dirty index range, and the dirty
+    // bit words act as a summary that skips 32 clean fields at a time
+    for (uint16 index = m_firstChangedIndex; index <= m_lastChangedIndex && index < m_valuesCount; ++index)
+    {
+        if (!(index & 0x1F) && !m_changedBits[index >> 5])
+        {
+            index += 31;
+            continue;
+        }
+
+        if (IsChangedValue(index) && (flags[index] & visibleFlag))
             updateMask.SetBit(index);
+    }
 }
 
 void Object::_SetCreateBits(UpdateMask& updateMask, Player* target) const
@@ -851,7 +932,7 @@ void Object::SetInt32Value(uint16 index, int32 value)
     if (m_int32Values[index] != value)
     {
         m_int32Values[index] = value;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -863,7 +944,7 @@ void Object::SetUInt32Value(uint16 index, uint32 value)
     if (m_uint32Values[index] != value)
     {
         m_uint32Values[index] = value;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -875,8 +956,8 @@ void Object::SetUInt64Value(uint16 index, const uint64& value)
     {
         m_uint32Values[index] = *((uint32*)&value);
         m_uint32Values[index + 1] = *(((uint32*)&value) + 1);
-        m_changedValues[index] = true;
-        m_changedValues[index + 1] = true;
+        MarkChangedValue(index);
+        MarkChangedValue(index + 1);
         MarkForClientUpdate();
     }
 }
@@ -888,11 +969,52 @@ void Object::SetFloatValue(uint16 index, float value)
     if (m_floatValues[index] != value)
     {
         m_floatValues[index] = value;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
 
+void Object::SetUInt32ValuesBulk(uint16 index, uint32 const* values, uint16 count)
+{
+    MANGOS_ASSERT(uint32(index) + count <= m_valuesCount || PrintIndexError(index, true));
+
+    // memcmp compiles down to a wide compare; the common case during stat
+    // recalculation cascades is that nothing in the span actually changed
+    if (!count || memcmp(&m_uint32Values[index], values, count * sizeof(uint32)) == 0)
+        return;
+
+    for (uint16 i = 0; i < count; ++i)
+    {
+        if (m_uint32Values[index + i] == values[i])
+            continue;
+
+        m_uint32Values[index + i] = values[i];
+        MarkChangedValue(index + i);
+    }
+
+    MarkForClientUpdate();
+}
+
+void Object::SetFloatValuesBulk(uint16 index, float const* values, uint16 count)
+{
+    MANGOS_ASSERT(uint32(index) + count <= m_valuesCount || PrintIndexError(index, true));
+
+    // bitwise equality implies float equality, so this early-out is safe
+    if (!count || memcmp(&m_floatValues[index], values, count * sizeof(float)) == 0)
+        return;
+
+    for (uint16 i = 0; i < count; ++i)
+    {
+        if (m_floatValues[index + i] == values[i])
+            continue;
+
+        m_floatValues[index + i] = values[i];
+        MarkChangedValue(index + i);
+    }
+
+    MarkForClientUpdate();
+}
+
 void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
 {
     MANGOS_ASSERT(index < m_valuesCount || PrintIndexError(index, true));
@@ -907,7 +1029,7 @@ void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFF) << (offset * 8));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 8));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -926,7 +1048,7 @@ void Object::SetUInt16Value(uint16 index, uint8 offset, uint16 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFFFF) << (offset * 16));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 16));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -988,7 +1110,7 @@ void Object::SetFlag(uint16 index, uint32 newFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1002,7 +1124,7 @@ void Object::RemoveFlag(uint16 index, uint32 oldFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1020,7 +1142,7 @@ void Object::SetByteFlag(uint16 index, uint8 offset, uint8 newFlag)
     if (!(uint8(m_uint32Values[index] >> (offset * 8)) & newFlag))
     {
         m_uint32Values[index] |= uint32(uint32(newFlag) << (offset * 8));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1038,7 +1160,7 @@ void Object::RemoveByteFlag(uint16 index, uint8 offset, uint8 oldFlag)
     if (uint8(m_uint32Values[index] >> (offset * 8)) & oldFlag)
     {
         m_uint32Values[index] &= ~uint32(uint32(oldFlag) << (offset * 8));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1050,7 +1172,7 @@ void Object::SetShortFlag(uint16 index, bool highpart, uint16 newFlag)
     if (!(uint16(m_uint32Values[index] >> (highpart ? 16 : 0)) & newFlag))
     {
         m_uint32Values[index] |= uint32(uint32(newFlag) << (highpart ? 16 : 0));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1062,7 +1184,7 @@ void Object::RemoveShortFlag(uint16 index, bool highpart, uint16 oldFlag)
     if (uint16(m_uint32Values[index] >> (highpart ? 16 : 0)) & oldFlag)
     {
         m_uint32Values[index] &= ~uint32(uint32(oldFlag) << (highpart ? 16 : 0));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1130,7 +1252,7 @@ void Object::MarkForClientUpdate()
 
 void Object::ForceValuesUpdateAtIndex(uint16 index)
 {
-    m_changedValues[index] = true;
+    MarkChangedValue(index);
     if (m_inWorld && !m_objectUpdated)
     {
         AddToClientUpdateList();
@@ -1216,6 +1338,8 @@ void WorldObject::Relocate(float x, float y, float z, float orientation)
 
     if (isType(TYPEMASK_UNIT))
         m_movementInfo.ChangePosition(x, y, z, orientation);
+
+    InvalidateCreateBlockCache();
 }
 
 void WorldObject::Relocate(float x, float y, float z)
@@ -1226,6 +1350,8 @@ void WorldObject::Relocate(float x, float y, float z)
 
     if (isType(TYPEMASK_UNIT))
         m_movementInfo.ChangePosition(x, y, z, GetOrientation());
+
+    InvalidateCreateBlockCache();
 }
 
 void WorldObject::SetOrientation(float orientation)
@@ -1234,6 +1360,8 @@ void WorldObject::SetOrientation(float orientation)
 
     if (isType(TYPEMASK_UNIT))
         m_movementInfo.ChangeOrientation(orientation);
+
+    InvalidateCreateBlockCache();
 }
 
 uint32 WorldObject::GetZoneId() const
@@ -1648,7 +1776,9 @@ void WorldObject::UpdateAllowedPositionZ(float x, float y, float& z, Map* atMap
     if (!atMap)
         atMap = GetMap();
 
-    float ground_z = atMap->GetHeight(x, y, z);
+    // movers keep a terrain cursor so the repeated queries of a movement step
+    // resolve their tile once
+    float ground_z = IsUnit() ? atMap->GetHeight(static_cast<Unit const*>(this)->GetTerrainCursor(), x, y, z) : atMap->GetHeight(x, y, z);
     if (ground_z > INVALID_HEIGHT)
         z = ground_z;
 }
@@ -1803,7 +1933,7 @@ namespace MaNGOS
     class MonsterChatBuilder
     {
         public:
-            MonsterChatBuilder(WorldObject const& obj, ChatMsg msgtype, std::vector<std::string> content, Language language, Unit const* target)
+            MonsterChatBuilder(WorldObject const& obj, ChatMsg msgtype, std::vector<std::string> const& content, Language language, Unit const* target)
                 : i_object(obj), i_msgtype(msgtype), i_content(content), i_language(language), i_target(target) {}
             void operator()(WorldPacket& data, int32 loc_idx)
             {
@@ -1820,14 +1950,14 @@ namespace MaNGOS
         private:
             WorldObject const& i_object;
             ChatMsg i_msgtype;
-            std::vector<std::string> i_content;
+            std::vector<std::string> const& i_content;      // interned content owned by the text stores
             Language i_language;
             Unit const* i_target;
     };
 }                                                           // namespace MaNGOS
 
 /// Helper function to create localized around a source
-void _DoLocalizedTextAround(WorldObject const* source, std::vector<std::string> content, ChatMsg msgtype, Language language, Unit const* target, float range)
+void _DoLocalizedTextAround(WorldObject const* source, std::vector<std::string> const& content, ChatMsg msgtype, Language language, Unit const* target, float range)
 {
     MaNGOS::MonsterChatBuilder say_build(*source, msgtype, content, language, target);
     MaNGOS::LocalizedPacketDo<MaNGOS::MonsterChatBuilder> say_do(say_build);
@@ -1836,7 +1966,7 @@ void _DoLocalizedTextAround(WorldObject const* source, std::vector<std::string>
 }
 
 /// Function that sends a text associated to a MangosString or BroadcastText
-void WorldObject::MonsterText(std::vector<std::string> content, uint32 type, Language lang, Unit const* target) const
+void WorldObject::MonsterText(std::vector<std::string> const& content, uint32 type, Language lang, Unit const* target) const
 {
     switch (type)
     {
@@ -2494,7 +2624,12 @@ struct WorldObjectChangeAccumulator
 {
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
-    WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d) : i_updateDatas(d), i_object(obj)
+    ByteBuffer i_sharedBlock;
+    bool i_shareable;
+    bool i_sharedBuilt;
+    bool i_sharedHasData;
+    WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d) : i_updateDatas(d), i_object(obj),
+        i_shareable(!obj.HasViewerDependentChanges()), i_sharedBuilt(false), i_sharedHasData(false)
     {
         // send self fields changes in another way, otherwise
         // with new camera system when player's camera too far from player, camera wouldn't receive packets and changes from player
@@ -2518,13 +2653,32 @@ struct WorldObjectChangeAccumulator
             {
 #endif
             if (owner != &i_object && owner->HasAtClient(&i_object))
-                i_object.BuildUpdateDataForPlayer(owner, i_updateDatas);
+                BuildForViewer(owner);
 #ifdef ENABLE_PLAYERBOTS
             }
 #endif
         }
     }
 
+    void BuildForViewer(Player* owner)
+    {
+        if (i_shareable && i_object.CanShareValuesUpdateWith(owner))
+        {
+            // serialize the block once and reuse it for every plain viewer
+            if (!i_sharedBuilt)
+            {
+                i_sharedHasData = i_object.BuildSharedValuesUpdateBlock(i_sharedBlock, owner);
+                i_sharedBuilt = true;
+            }
+
+            if (i_sharedHasData)
+                i_updateDatas[owner].AddUpdateBlock(i_sharedBlock);
+            return;
+        }
+
+        i_object.BuildUpdateDataForPlayer(owner, i_updateDatas);
+    }
+
     template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
 };
 
@@ -2599,11 +2753,20 @@ void WorldObject::AddGCD(SpellEntry const& spellEntry, uint32 forcedDuration /*=
     if (!gcdRecTime)
         return;
 
-    m_GCDCatMap.emplace(spellEntry.StartRecoveryCategory, std::chrono::milliseconds(gcdRecTime) + GetMap()->GetCurrentClockTime());
+    TimePoint expiry = std::chrono::milliseconds(gcdRecTime) + GetMap()->GetCurrentClockTime();
+    m_GCDCatMap.emplace(spellEntry.StartRecoveryCategory, expiry);
+    if (expiry < m_gcdEarliestExpiry)
+        m_gcdEarliestExpiry = expiry;
+    if (expiry > m_gcdLatestExpiry)
+        m_gcdLatestExpiry = expiry;
 }
 
 bool WorldObject::HasGCD(SpellEntry const* spellEntry) const
 {
+    // single compare answers the common case of no running GCD at all
+    if (GetMap()->GetCurrentClockTime() >= m_gcdLatestExpiry)
+        return false;
+
     if (spellEntry)
     {
         auto gcdItr = m_GCDCatMap.find(spellEntry->StartRecoveryCategory);
@@ -2634,15 +2797,24 @@ void WorldObject::AddCooldown(SpellEntry const& spellEntry, ItemPrototype const*
 
 void WorldObject::UpdateCooldowns(TimePoint const& now)
 {
-    // handle GCD
-    auto cdItr = m_GCDCatMap.begin();
-    while (cdItr != m_GCDCatMap.end())
+    // handle GCD - scan only once the earliest entry actually lapsed
+    if (now >= m_gcdEarliestExpiry)
     {
-        auto& cd = cdItr->second;
-        if (cd <= now)
-            cdItr = m_GCDCatMap.erase(cdItr);
-        else
-            ++cdItr;
+        TimePoint earliest = TimePoint::max();
+        auto cdItr = m_GCDCatMap.begin();
+        while (cdItr != m_GCDCatMap.end())
+        {
+            auto& cd = cdItr->second;
+            if (cd <= now)
+                cdItr = m_GCDCatMap.erase(cdItr);
+            else
+            {
+                if (cd < earliest)
+                    earliest = cd;
+                ++cdItr;
+            }
+        }
+        m_gcdEarliestExpiry = earliest;
     }
 
     // handle spell and category cooldowns
@@ -2719,18 +2891,23 @@ bool WorldObject::IsSpellReady(SpellEntry const& spellEntry, ItemPrototype const
         }
     }
 
+    // probe the table only while any cooldown can still be running - this check
+    // runs several times per cast attempt, including failed client spam
+    if (m_cooldownMap.MaybeHasCooldown(now))
     {
-        auto itr = m_cooldownMap.FindBySpellId(spellEntry.Id);
-        if (itr != m_cooldownMap.end() && !(*itr).second->IsSpellCDExpired(now))
-            if (!itemProto || itemProto->ItemId == (*itr).second.get()->GetItemId())
-                return false;
-    }
+        {
+            auto itr = m_cooldownMap.FindBySpellId(spellEntry.Id);
+            if (itr != m_cooldownMap.end() && !(*itr).second->IsSpellCDExpired(now))
+                if (!itemProto || itemProto->ItemId == (*itr).second.get()->GetItemId())
+                    return false;
+        }
 
-    if (spellCategory)
-    {
-        auto itr = m_cooldownMap.FindByCategory(spellCategory);
-        if (itr != m_cooldownMap.end() && !(*itr).second->IsCatCDExpired(now))
-            return false;
+        if (spellCategory)
+        {
+            auto itr = m_cooldownMap.FindByCategory(spellCategory);
+            if (itr != m_cooldownMap.end() && !(*itr).second->IsCatCDExpired(now))
+                return false;
+        }
     }
 
     if (spellEntry.PreventionType == SPELL_PREVENTION_TYPE_SILENCE && CheckLockout(GetSpellSchoolMask(&spellEntry), now))
@@ -2756,6 +2933,9 @@ bool WorldObject::IsSpellOnPermanentCooldown(SpellEntry const& spellEntry) const
     else
         now = World::GetCurrentClockTime();
 
+    if (!m_cooldownMap.MaybeHasCooldown(now))
+        return false;
+
     auto itr = m_cooldownMap.FindBySpellId(spellEntry.Id);
     if (itr != m_cooldownMap.end() && !(*itr).second->IsSpellCDExpired(now))
         return itr->second->IsPermanent();
@@ -2796,6 +2976,8 @@ void WorldObject::ResetGCD(SpellEntry const* spellEntry /*= nullptr*/)
     if (!spellEntry)
     {
         m_GCDCatMap.clear();
+        m_gcdEarliestExpiry = TimePoint::max();
+        m_gcdLatestExpiry = TimePoint();
         return;
     }
 
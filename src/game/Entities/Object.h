@@ -202,6 +202,12 @@ class CooldownContainer
 
         void Update(TimePoint const& now)
         {
+            // nothing can have expired yet - skip the scan (runs every unit tick)
+            if (now < m_earliestExpiry)
+                return;
+
+            TimePoint earliest = TimePoint::max();
+            TimePoint latest = TimePoint();
             auto spellCDItr = m_spellIdMap.begin();
             while (spellCDItr != m_spellIdMap.end())
             {
@@ -215,14 +221,36 @@ class CooldownContainer
                         m_categoryMap.erase(cd->m_category);
                         cd->m_category = 0;
                     }
+                    if (!cd->m_typePermanent)
+                    {
+                        // the entry leaves the table once both its own and its category time passed
+                        TimePoint expiry = std::max(cd->m_expireTime, cd->m_catExpireTime);
+                        if (expiry < earliest)
+                            earliest = expiry;
+                        if (expiry > latest)
+                            latest = expiry;
+                    }
                     ++spellCDItr;
                 }
             }
+            m_earliestExpiry = earliest;
+            m_latestExpiry = latest;
         }
 
         bool AddCooldown(TimePoint clockNow, uint32 spellId, uint32 duration, uint32 spellCategory = 0, uint32 categoryDuration = 0, uint32 itemId = 0, bool onHold = false)
         {
             RemoveBySpellId(spellId);
+            if (onHold)
+                ++m_permanentCount;
+            else
+            {
+                // maintain the deadline window the fast paths test against
+                TimePoint expiry = clockNow + std::chrono::milliseconds(std::max(duration, categoryDuration));
+                if (expiry < m_earliestExpiry)
+                    m_earliestExpiry = expiry;
+                if (expiry > m_latestExpiry)
+                    m_latestExpiry = expiry;
+            }
             auto resultItr = m_spellIdMap.emplace(spellId, std::make_unique<CooldownData>(clockNow, spellId, duration, spellCategory, categoryDuration, itemId, onHold));
             // do not overwrite one permanent category cooldown with another permanent category cooldown
             if (resultItr.second && spellCategory && categoryDuration)
@@ -233,8 +261,15 @@ class CooldownContainer
                     // we must keep original category cd owner for sake of client sync
                     if (catItr != m_spellIdMap.end())
                     {
+                        if (catItr->second->m_typePermanent)
+                            --m_permanentCount;
                         catItr->second->SetCatCDExpireTime(std::chrono::milliseconds(categoryDuration) + clockNow);
                         catItr->second->m_typePermanent = false;
+                        TimePoint catExpiry = clockNow + std::chrono::milliseconds(categoryDuration);
+                        if (catExpiry < m_earliestExpiry)
+                            m_earliestExpiry = catExpiry;
+                        if (catExpiry > m_latestExpiry)
+                            m_latestExpiry = catExpiry;
                         resultItr.first->second->m_category = 0;
                     }
                     else
@@ -253,6 +288,8 @@ class CooldownContainer
             if (spellCDItr != m_spellIdMap.end())
             {
                 auto& cdData = spellCDItr->second;
+                if (cdData->m_typePermanent)
+                    --m_permanentCount;
                 if (cdData->m_category)
                 {
                     auto catCDItr = m_categoryMap.find(cdData->m_category);
@@ -276,6 +313,8 @@ class CooldownContainer
         Iterator erase(ConstIterator spellCDItr)
         {
             auto& cdData = spellCDItr->second;
+            if (cdData->m_typePermanent)
+                --m_permanentCount;
             if (cdData->m_category)
             {
                 auto catCDItr = m_categoryMap.find(cdData->m_category);
@@ -293,7 +332,18 @@ class CooldownContainer
             return itr != m_categoryMap.end() ? itr->second : end();
         }
 
-        void clear() { m_spellIdMap.clear(); m_categoryMap.clear(); }
+        void clear()
+        {
+            m_spellIdMap.clear();
+            m_categoryMap.clear();
+            m_earliestExpiry = TimePoint::max();
+            m_latestExpiry = TimePoint();
+            m_permanentCount = 0;
+        }
+
+        // two-compare fast gate for the HasSpellCooldown family: false guarantees
+        // every cooldown in the table has lapsed, so probes can be skipped outright
+        bool MaybeHasCooldown(TimePoint const& now) const { return m_permanentCount || now < m_latestExpiry; }
 
         ConstIterator begin() const { return m_spellIdMap.begin(); }
         ConstIterator end() const { return m_spellIdMap.end(); }
@@ -303,6 +353,12 @@ class CooldownContainer
     private:
         spellIdMap m_spellIdMap;
         categoryMap m_categoryMap;
+
+        // deadline window over all finite entries: Update() scans only once the
+        // earliest removal deadline passed, probes only while the latest one runs
+        TimePoint m_earliestExpiry = TimePoint::max();
+        TimePoint m_latestExpiry;
+        uint32 m_permanentCount = 0;
 };
 
 struct Position
@@ -396,6 +452,13 @@ class Object
         bool isType(TypeMask mask) const { return (mask & m_objectType) != 0; }
 
         virtual void BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const;
+        // serializes the single create block into buf, letting callers cache it
+        void BuildCreateUpdateBlock(ByteBuffer& buf, Player* target) const;
+        // true when the create block for this viewer is byte-identical to the
+        // one any other plain viewer would get and the object state is stable
+        // enough to reuse it - overridden where caching pays off (static
+        // creature and gameobject spawns)
+        virtual bool CanUseCachedCreateBlock(Player* /*target*/) const { return false; }
         void SendCreateUpdateToPlayer(Player* player) const;
 
         // must be overwrite in appropriate subclasses (WorldObject, Item currently), or will crash
@@ -410,6 +473,12 @@ class Object
         void BuildValuesUpdateBlockForPlayer(UpdateData& data, UpdateMask& updateMask, Player* target) const;
         void BuildForcedValuesUpdateBlockForPlayer(UpdateData* data, Player* target) const;
         void BuildOutOfRangeUpdateBlock(UpdateData* data) const;
+
+        // multi-viewer batching: viewers receiving byte-identical values blocks
+        // share one serialization instead of rebuilding it per viewer
+        bool HasViewerDependentChanges() const;
+        bool CanShareValuesUpdateWith(Player* target) const;
+        bool BuildSharedValuesUpdateBlock(ByteBuffer& buf, Player* target) const;
         void BuildMovementUpdateBlock(UpdateData* data, uint8 flags = 0) const;
 
         virtual void DestroyForPlayer(Player* target) const;
@@ -471,6 +540,9 @@ class Object
         void SetGuidValue(uint16 index, ObjectGuid const& value) { SetUInt64Value(index, value.GetRawValue()); }
         void SetStatFloatValue(uint16 index, float value);
         void SetStatInt32Value(uint16 index, int32 value);
+        // apply a contiguous span of field values with a single dirty-scan and one client update notification
+        void SetUInt32ValuesBulk(uint16 index, uint32 const* values, uint16 count);
+        void SetFloatValuesBulk(uint16 index, float const* values, uint16 count);
         void ApplyModUInt32Value(uint16 index, int32 val, bool apply);
         void ApplyModInt32Value(uint16 index, int32 val, bool apply);
         void ApplyModPositiveFloatValue(uint16 index, float val, bool apply);
@@ -599,13 +671,17 @@ class Object
 
         void ClearUpdateMask(bool remove);
 
+        // object has field changes not yet flushed to viewers - serialized
+        // snapshots taken now would go stale without further notification
+        bool HasPendingValueChanges() const { return m_objectUpdated || m_firstChangedIndex <= m_lastChangedIndex; }
+
         void _LoadIntoDataField(const char* data, uint32 startOffset, uint32 count);
 
         uint16 GetValuesCount() const { return m_valuesCount; }
 
         virtual bool HasQuest(uint32 /* quest_id */) const { return false; }
         virtual bool HasInvolvedQuest(uint32 /* quest_id */) const { return false; }
-        void SetItsNewObject(bool enable) { m_itsNewObject = enable; }
+        void SetItsNewObject(bool enable) { m_itsNewObject = enable; InvalidateCreateBlockCache(); }
 
         Loot* m_loot;
 
@@ -643,7 +719,39 @@ class Object
             float*  m_floatValues;
         };
 
-        std::vector<bool> m_changedValues;
+        // marks a field dirty and keeps the [first, last] dirty index range
+        // current, so clean scans touch no fields and dirty scans only the span
+        void MarkChangedValue(uint16 index)
+        {
+            m_changedBits[index >> 5] |= uint32(1) << (index & 0x1F);
+            if (index < m_firstChangedIndex)
+                m_firstChangedIndex = index;
+            if (index > m_lastChangedIndex)
+                m_lastChangedIndex = index;
+            InvalidateCreateBlockCache();
+        }
+
+        // drop the cached create block; any field or movement change makes it stale
+        void InvalidateCreateBlockCache() const
+        {
+            if (m_createBlockCache)
+                m_createBlockCache->clear();
+        }
+
+        // create block serialized for a plain viewer, reused across viewers
+        // of static spawns; empty when stale, unallocated until first use
+        mutable std::unique_ptr<ByteBuffer> m_createBlockCache;
+
+        bool IsChangedValue(uint16 index) const { return (m_changedBits[index >> 5] >> (index & 0x1F)) & 1; }
+
+        uint32 GetChangedBitsWords() const { return (uint32(m_valuesCount) + 31) / 32; }
+
+        // dirty bit words, co-allocated directly behind m_uint32Values in the
+        // same pool block - one allocation per object, and the words double as
+        // a summary that lets scans skip 32 clean fields at a time
+        uint32* m_changedBits;
+        uint16 m_firstChangedIndex;                         // inclusive; m_valuesCount when nothing is dirty
+        uint16 m_lastChangedIndex;                          // inclusive; 0 when nothing is dirty
 
         uint16 m_valuesCount;
 
@@ -1049,7 +1157,7 @@ class WorldObject : public Object
         void MonsterYell(const char* text, uint32 language, Unit const* target = nullptr) const;
         void MonsterTextEmote(const char* text, Unit const* target, bool IsBossEmote = false) const;
         void MonsterWhisper(const char* text, Unit const* target, bool IsBossWhisper = false) const;
-        void MonsterText(std::vector<std::string> content, uint32 type, Language lang, Unit const* target) const;
+        void MonsterText(std::vector<std::string> const& content, uint32 type, Language lang, Unit const* target) const;
 
         void PlayDistanceSound(uint32 sound_id, PlayPacketParameters parameters = PlayPacketParameters(PlayPacketSettings::SET)) const;
         void PlayDirectSound(uint32 sound_id, PlayPacketParameters parameters = PlayPacketParameters(PlayPacketSettings::SET)) const;
@@ -1201,6 +1309,10 @@ class WorldObject : public Object
         bool GetExpireTime(SpellEntry const& spellEntry, TimePoint& expireTime, bool& isPermanent) const;
 
         GCDMap            m_GCDCatMap;
+        // deadline window over m_GCDCatMap - same role as the one inside
+        // CooldownContainer (fast HasGCD answer, per-tick scan skip)
+        TimePoint         m_gcdEarliestExpiry = TimePoint::max();
+        TimePoint         m_gcdLatestExpiry;
         LockoutMap        m_lockoutMap;
         CooldownContainer m_cooldownMap;
 
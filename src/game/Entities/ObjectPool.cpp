@@ -0,0 +1,82 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Entities/ObjectPool.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // only a handful of distinct sizes ever show up here (the concrete
+    // object classes and a few UpdateFields array lengths), so an exact-size
+    // map beats power-of-two buckets - no block is ever handed out oversized
+    struct FreeLists
+    {
+        std::mutex lock;
+        std::unordered_map<size_t, std::vector<void*>> blocks;
+    };
+
+    FreeLists& GetFreeLists()
+    {
+        static FreeLists instance;
+        return instance;
+    }
+
+    // enough for sustained respawn waves, small enough that a spike
+    // (a raid despawning, a grid unload) does not pin memory forever
+    constexpr size_t MAX_CACHED_PER_SIZE = 512;
+}
+
+namespace MaNGOS
+{
+    void* ObjectMemoryPool::Acquire(size_t size)
+    {
+        FreeLists& lists = GetFreeLists();
+        {
+            std::lock_guard<std::mutex> guard(lists.lock);
+            auto itr = lists.blocks.find(size);
+            if (itr != lists.blocks.end() && !itr->second.empty())
+            {
+                void* ptr = itr->second.back();
+                itr->second.pop_back();
+                return ptr;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    void ObjectMemoryPool::Release(void* ptr, size_t size)
+    {
+        if (!ptr)
+            return;
+
+        FreeLists& lists = GetFreeLists();
+        {
+            std::lock_guard<std::mutex> guard(lists.lock);
+            std::vector<void*>& list = lists.blocks[size];
+            if (list.size() < MAX_CACHED_PER_SIZE)
+            {
+                list.push_back(ptr);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OBJECTPOOL_H
+#define MANGOS_OBJECTPOOL_H
+
+#include "Platform/Define.h"
+
+#include <cstddef>
+
+namespace MaNGOS
+{
+    /**
+     * Size-bucketed recycler for the allocations behind dynamic spawns.
+     *
+     * Respawn churn (temporary spawns, spawn groups, pooled spawns) runs a
+     * full new/delete cycle per object - the Creature/GameObject instance
+     * itself plus its UpdateFields array. During mass events that is
+     * thousands of heap round trips per minute. Released blocks are kept on
+     * a free list keyed by their exact size and handed back to the next
+     * spawn of the same type, so steady-state respawning stops touching the
+     * global allocator.
+     *
+     * The pool is process wide rather than per map: blocks are released
+     * from the object destructor, which has no map context, and instances
+     * migrate between maps anyway (pets, transports). Each free list is
+     * capped so a one-off spike cannot pin memory forever.
+     */
+    class ObjectMemoryPool
+    {
+        public:
+            static void* Acquire(size_t size);
+            static void Release(void* ptr, size_t size);
+    };
+
+    /**
+     * STL allocator over ObjectMemoryPool - lets node based containers with
+     * high element churn (the per-unit aura holder map) recycle their nodes
+     * through the same free lists instead of the global allocator.
+     */
+    template <typename T>
+    struct PoolAllocator
+    {
+        typedef T value_type;
+
+        PoolAllocator() = default;
+        template <typename U>
+        PoolAllocator(PoolAllocator<U> const&) {}
+
+        T* allocate(size_t n) { return static_cast<T*>(ObjectMemoryPool::Acquire(n * sizeof(T))); }
+        void deallocate(T* ptr, size_t n) { ObjectMemoryPool::Release(ptr, n * sizeof(T)); }
+
+        bool operator==(PoolAllocator const&) const { return true; }
+        bool operator!=(PoolAllocator const&) const { return false; }
+    };
+}
+
+#endif
@@ -54,8 +54,10 @@ float VisibilityData::GetVisibilityDistance() const
 {
     if (IsVisibilityOverridden())
         return m_visibilityDistanceOverride;
-    else
-        return m_owner->GetMap()->GetVisibilityDistance();
+
+    // crowded-grid governor scales the map distance down under extreme local load
+    Map* map = m_owner->GetMap();
+    return map->GetVisibilityDistance() * map->GetVisibilityScale(m_owner->GetPositionX(), m_owner->GetPositionY());
 }
 
 float VisibilityData::GetVisibilityDistanceFor(WorldObject* obj) const
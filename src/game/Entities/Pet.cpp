@@ -81,6 +81,7 @@ void Pet::RemoveFromWorld()
     ///- Remove the pet from the accessor
     if (IsInWorld())
         GetMap()->GetObjectsStore().erase<Pet>(GetObjectGuid(), (Pet*)nullptr);
+        GetMap()->IncrementObjectRemovalCounter();
 
     ///- Don't call the function for Creature, normal mobs + totems go in a different storage
     Unit::RemoveFromWorld();
@@ -643,6 +644,9 @@ void Pet::Update(const uint32 diff)
     if (m_removed)                                          // pet already removed, just wait in remove queue, no updates
         return;
 
+    if (!ClaimUpdateTick())                                 // already ticked right behind the owner this map tick
+        return;
+
     switch (m_deathState)
     {
         case CORPSE:
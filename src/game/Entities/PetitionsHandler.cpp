@@ -146,24 +146,19 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recv_data)
 
     // a petition is invalid, if both the owner and the type matches
     // we checked above, if this player is in an arenateam, so this must be data corruption
-    auto queryResult = CharacterDatabase.PQuery("SELECT petitionguid FROM petition WHERE ownerguid = '%u'", _player->GetGUIDLow());
-
     std::ostringstream ssInvalidPetitionGUIDs;
 
-    if (queryResult)
+    while (Petition const* invalid = sGuildMgr.GetPetitionByOwner(_player->GetObjectGuid()))
     {
-        do
-        {
-            Field* fields = queryResult->Fetch();
-            ssInvalidPetitionGUIDs << "'" << fields[0].GetUInt32() << "' , ";
-        }
-        while (queryResult->NextRow());
+        ssInvalidPetitionGUIDs << "'" << invalid->petitionLowGuid << "' , ";
+        sGuildMgr.DeletePetition(invalid->petitionLowGuid);
     }
 
     // delete petitions with the same guid as this one
     ssInvalidPetitionGUIDs << "'" << charter->GetGUIDLow() << "'";
 
     DEBUG_LOG("Invalid petition GUIDs: %s", ssInvalidPetitionGUIDs.str().c_str());
+    sGuildMgr.AddPetition(charter->GetGUIDLow(), _player->GetObjectGuid(), name);
     CharacterDatabase.escape_string(name);
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM petition WHERE petitionguid IN ( %s )",  ssInvalidPetitionGUIDs.str().c_str());
@@ -190,11 +185,11 @@ void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recv_data)
     if (_player->GetGuildId())
         return;
 
-    auto queryResult = CharacterDatabase.PQuery("SELECT playerguid FROM petition_sign WHERE petitionguid = '%u'", petitionguid_low);
+    Petition const* petition = sGuildMgr.GetPetition(petitionguid_low);
 
-    // queryResult==nullptr also correct in case no sign yet
-    if (queryResult)
-        signs = (uint8)queryResult->GetRowCount();
+    // petition==nullptr also correct in case no sign yet
+    if (petition)
+        signs = (uint8)petition->signatures.size();
 
     DEBUG_LOG("CMSG_PETITION_SHOW_SIGNATURES petition: %s", petitionguid.GetString().c_str());
 
@@ -204,15 +199,10 @@ void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recv_data)
     data << uint32(petitionguid_low);                       // guild guid (in mangos always same as GUID_LOPART(petitionguid)
     data << uint8(signs);                                   // sign's count
 
-    for (uint8 i = 1; i <= signs; ++i)
+    for (uint8 i = 0; i < signs; ++i)
     {
-        Field* fields2 = queryResult->Fetch();
-        ObjectGuid signerGuid = ObjectGuid(HIGHGUID_PLAYER, fields2[0].GetUInt32());
-
-        data << ObjectGuid(signerGuid);                     // Player GUID
+        data << ObjectGuid(petition->signatures[i].first);  // Player GUID
         data << uint32(0);                                  // there 0 ...
-
-        queryResult->NextRow();
     }
     SendPacket(data);
 }
@@ -237,19 +227,12 @@ void WorldSession::SendPetitionQueryOpcode(ObjectGuid petitionguid) const
 
     ObjectGuid ownerGuid;
     std::string name = "NO_NAME_FOR_GUID";
-    uint8 signs = 0;
-
-    auto queryResult = CharacterDatabase.PQuery(
-                              "SELECT ownerguid, name, "
-                              "  (SELECT COUNT(playerguid) FROM petition_sign WHERE petition_sign.petitionguid = '%u') AS signs "
-                              "FROM petition WHERE petitionguid = '%u'", petitionLowGuid, petitionLowGuid);
 
-    if (queryResult)
+    Petition const* petition = sGuildMgr.GetPetition(petitionLowGuid);
+    if (petition)
     {
-        Field* fields = queryResult->Fetch();
-        ownerGuid = ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32());
-        name      = fields[1].GetCppString();
-        signs     = fields[2].GetUInt8();
+        ownerGuid = petition->ownerGuid;
+        name      = petition->name;
     }
     else
     {
@@ -305,6 +288,8 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recv_data)
         return;
     }
 
+    sGuildMgr.SetPetitionName(petitionGuid.GetCounter(), newname);
+
     std::string db_newname = newname;
     CharacterDatabase.escape_string(db_newname);
     CharacterDatabase.PExecute("UPDATE petition SET name = '%s' WHERE petitionguid = '%u'",
@@ -330,21 +315,16 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recv_data)
 
     uint32 petitionLowGuid = petitionGuid.GetCounter();
 
-    auto queryResult = CharacterDatabase.PQuery(
-                              "SELECT ownerguid, "
-                              "  (SELECT COUNT(playerguid) FROM petition_sign WHERE petition_sign.petitionguid = '%u') AS signs "
-                              "FROM petition WHERE petitionguid = '%u'", petitionLowGuid, petitionLowGuid);
-
-    if (!queryResult)
+    Petition const* petition = sGuildMgr.GetPetition(petitionLowGuid);
+    if (!petition)
     {
         sLog.outError("any petition on server...");
         return;
     }
 
-    Field* fields = queryResult->Fetch();
-    uint32 ownerLowGuid = fields[0].GetUInt32();
-    ObjectGuid ownerGuid = ObjectGuid(HIGHGUID_PLAYER, ownerLowGuid);
-    uint8 signs = fields[1].GetUInt8();
+    ObjectGuid ownerGuid = petition->ownerGuid;
+    uint32 ownerLowGuid = ownerGuid.GetCounter();
+    uint8 signs = (uint8)petition->signatures.size();
 
     if (ownerGuid == _player->GetObjectGuid())
         return;
@@ -377,9 +357,7 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recv_data)
     if(!_player->GetPlayerbotAI())
     {
 #endif
-    queryResult = CharacterDatabase.PQuery("SELECT playerguid FROM petition_sign WHERE player_account = '%u' AND petitionguid = '%u'", GetAccountId(), petitionLowGuid);
-
-    if (queryResult)
+    if (petition->HasSignatureFromAccount(GetAccountId()))
     {
         WorldPacket data(SMSG_PETITION_SIGN_RESULTS, (8 + 8 + 4));
         data << ObjectGuid(petitionGuid);
@@ -398,6 +376,7 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recv_data)
     }
 #endif
 
+    sGuildMgr.SignPetition(petitionLowGuid, _player->GetObjectGuid(), GetAccountId());
     CharacterDatabase.PExecute("INSERT INTO petition_sign (ownerguid,petitionguid, playerguid, player_account) VALUES ('%u', '%u', '%u','%u')",
                                ownerLowGuid, petitionLowGuid, _player->GetGUIDLow(), GetAccountId());
 
@@ -433,14 +412,11 @@ void WorldSession::HandlePetitionDeclineOpcode(WorldPacket& recv_data)
 
     uint32 petitionLowGuid = petitionGuid.GetCounter();
 
-    auto queryResult = CharacterDatabase.PQuery("SELECT ownerguid FROM petition WHERE petitionguid = '%u'", petitionLowGuid);
-    if (!queryResult)
+    Petition const* petition = sGuildMgr.GetPetition(petitionLowGuid);
+    if (!petition)
         return;
 
-    Field* fields = queryResult->Fetch();
-    ObjectGuid ownerguid = ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32());
-
-    Player* owner = sObjectMgr.GetPlayer(ownerguid);
+    Player* owner = sObjectMgr.GetPlayer(petition->ownerGuid);
     if (owner)                                              // petition owner online
     {
         WorldPacket data(MSG_PETITION_DECLINE, 8);
@@ -485,10 +461,10 @@ void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recv_data)
 
     /// Get petition signs count
     uint8 signs = 0;
-    auto queryResult = CharacterDatabase.PQuery("SELECT playerguid FROM petition_sign WHERE petitionguid = '%u'", petitionGuid.GetCounter());
-    // queryResult==nullptr also correct charter without signs
-    if (queryResult)
-        signs = (uint8)queryResult->GetRowCount();
+    Petition const* petition = sGuildMgr.GetPetition(petitionGuid.GetCounter());
+    // petition==nullptr also correct charter without signs
+    if (petition)
+        signs = (uint8)petition->signatures.size();
 
     /// Send response
     WorldPacket data(SMSG_PETITION_SHOW_SIGNATURES, (8 + 8 + 4 + signs + signs * 12));
@@ -497,15 +473,10 @@ void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recv_data)
     data << uint32(petitionGuid.GetCounter());              // guild guid (in mangos always same as low part of petition guid)
     data << uint8(signs);                                   // sign's count
 
-    for (uint8 i = 1; i <= signs; ++i)
+    for (uint8 i = 0; i < signs; ++i)
     {
-        Field* fields2 = queryResult->Fetch();
-        ObjectGuid signerGuid = ObjectGuid(HIGHGUID_PLAYER, fields2[0].GetUInt32());
-
-        data << ObjectGuid(signerGuid);                     // Player GUID
+        data << ObjectGuid(petition->signatures[i].first);  // Player GUID
         data << uint32(0);                                  // there 0 ...
-
-        queryResult->NextRow();
     }
 
     player->GetSession()->SendPacket(data);
@@ -523,23 +494,20 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recv_data)
     DEBUG_LOG("Petition %s turned in by %s", petitionGuid.GetString().c_str(), _player->GetGuidStr().c_str());
 
     /// Collect petition info data
-    ObjectGuid ownerGuid;
-    std::string name;
-
-    // data
-    auto queryResult = CharacterDatabase.PQuery("SELECT ownerguid, name FROM petition WHERE petitionguid = '%u'", petitionGuid.GetCounter());
-    if (queryResult)
-    {
-        Field* fields = queryResult->Fetch();
-        ownerGuid = ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32());
-        name = fields[1].GetCppString();
-    }
-    else
+    Petition const* petition = sGuildMgr.GetPetition(petitionGuid.GetCounter());
+    if (!petition)
     {
         sLog.outError("CMSG_TURN_IN_PETITION: petition table not have data for guid %u!", petitionGuid.GetCounter());
         return;
     }
 
+    // snapshot the petition data: guild creation removes the index entries of everyone
+    // who joins (via RemovePetitionsAndSigns), invalidating the pointer mid-loop
+    ObjectGuid ownerGuid = petition->ownerGuid;
+    std::string name = petition->name;
+    std::vector<std::pair<ObjectGuid, uint32>> signatures = petition->signatures;
+    petition = nullptr;
+
     if (_player->GetGuildId())
     {
         WorldPacket data(SMSG_TURN_IN_PETITION_RESULTS, 4);
@@ -552,8 +520,7 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recv_data)
         return;
 
     // signs
-    queryResult = CharacterDatabase.PQuery("SELECT playerguid FROM petition_sign WHERE petitionguid = '%u'", petitionGuid.GetCounter());
-    uint8 signs = queryResult ? (uint8)queryResult->GetRowCount() : 0;
+    uint8 signs = (uint8)signatures.size();
 
     uint32 count = sWorld.getConfig(CONFIG_UINT32_MIN_PETITION_SIGNS);
     if (signs < count)
@@ -599,9 +566,7 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recv_data)
     // add members
     for (uint8 i = 0; i < signs; ++i)
     {
-        Field* fields = queryResult->Fetch();
-
-        ObjectGuid signGuid = ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32());
+        ObjectGuid signGuid = signatures[i].first;
         if (signGuid.IsEmpty())
             continue;
 
@@ -616,10 +581,9 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recv_data)
             if (WorldSession* session = signee->GetSession())
                 session->SendGuildCommandResult(GUILD_FOUNDER_S, name, 0);
         }
-
-        queryResult->NextRow();
     }
 
+    sGuildMgr.DeletePetition(petitionGuid.GetCounter());
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM petition WHERE petitionguid = '%u'", petitionGuid.GetCounter());
     CharacterDatabase.PExecute("DELETE FROM petition_sign WHERE petitionguid = '%u'", petitionGuid.GetCounter());
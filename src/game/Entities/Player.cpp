@@ -80,6 +80,8 @@
 #include <array>
 
 #define ZONE_UPDATE_INTERVAL (1 * IN_MILLISECONDS)
+// second-scale housekeeping in Player::Update is batched on this sub-tick
+#define PLAYER_SLOW_TICK_INTERVAL (500)
 
 #define PLAYER_SKILL_INDEX(x) (PLAYER_SKILL_INFO_1_1 + ((x) * 3))
 #define PLAYER_SKILL_VALUE_INDEX(x) (PLAYER_SKILL_INDEX(x) + 1)
@@ -481,6 +483,9 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
     m_speakTime = 0;
     m_speakCount = 0;
 
+    m_initialSpellsCacheStale = true;
+    m_actionButtonsCacheStale = true;
+
     m_objectType |= TYPEMASK_PLAYER;
     m_objectTypeId = TYPEID_PLAYER;
 
@@ -507,6 +512,7 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
 
     m_zoneUpdateId = 0;
     m_zoneUpdateTimer = 0;
+    m_slowTickTime = 0;
     m_positionStatusUpdateTimer = 0;
 
     m_areaUpdateId = 0;
@@ -517,6 +523,9 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
     // this must help in case next save after mass player load after server startup
     m_nextSave = urand(m_nextSave / 2, m_nextSave * 3 / 2);
 
+    m_lastSavedCharacterHash = 0;
+    m_lastSavedAuraHash = 0;
+
     clearResurrectRequestData();
 
     m_SpellModRemoveCount = 0;
@@ -528,6 +537,9 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
     // group is initialized in the reference constructor
     SetGroupInvite(nullptr);
     m_groupUpdateMask = 0;
+    m_lastGroupPositionX = 0.0f;
+    m_lastGroupPositionY = 0.0f;
+    m_groupPositionNextUpdate = 0;
 
     ClearHonorInfo();
 
@@ -554,6 +566,7 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
 
     m_playerMenu = std::make_unique<PlayerMenu>(GetSession());
     m_currentBuybackSlot = BUYBACK_SLOT_START;
+    m_itemCountCacheDirty = true;
 
     m_WeeklyQuestChanged = false;
 
@@ -579,6 +592,10 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
 
     m_logintime = time(nullptr);
     m_Last_tick = m_logintime;
+    m_itemDurationPending = 0;
+    m_itemDurationNext = 0;
+    m_enchantPendingTime = 0;
+    m_enchantNextExpiry = 0;
     m_WeaponProficiency = 0;
     m_ArmorProficiency = 0;
     m_canParry = false;
@@ -598,6 +615,8 @@ Player::Player(WorldSession* session) : Unit(), m_taxiTracker(*this), m_mover(th
     //////////////////// Rest System/////////////////////
 
     m_mailsUpdated = false;
+    m_mailsLoaded = false;
+    m_mailsLoadRequested = false;
     unReadMails = 0;
     m_nextMailDelivereTime = 0;
 
@@ -1414,45 +1433,67 @@ void Player::Update(const uint32 diff)
     Unit::Update(diff);
     SetCanDelayTeleport(false);
 
+    // controlled summons tick right behind their owner: one warm pass over
+    // owner plus minions instead of visits scattered through the object phase
+    // (ClaimUpdateTick dedupes against the grid visit, which stays as the
+    // fallback when the owner is gone - the player phase is serial, so unlike
+    // creature owners this cannot race the parallel object workers)
+    if (IsInWorld())
+        CallForAllControlledUnits([diff](Unit* minion) { minion->Update(diff); },
+                                  CONTROLLED_PET | CONTROLLED_MINIPET | CONTROLLED_GUARDIANS | CONTROLLED_TOTEMS);
+
     if (IsHasDelayedTeleport() && m_semaphoreTeleport_Near)
         TeleportTo(m_teleport_dest, m_teleport_options);
 
     time_t now = time(nullptr);
 
-    UpdatePvPFlagTimer(diff);
+    // Second-scale housekeeping only runs on the slow sub-tick; passing the
+    // accumulated diff keeps every timer's total exact
+    m_slowTickTime += diff;
+    uint32 slowDiff = 0;
+    if (m_slowTickTime >= PLAYER_SLOW_TICK_INTERVAL)
+    {
+        slowDiff = m_slowTickTime;
+        m_slowTickTime = 0;
+    }
 
-    UpdatePvPContestedFlagTimer(diff);
+    if (slowDiff)
+    {
+        UpdatePvPFlagTimer(slowDiff);
 
-    UpdateDuelFlag(now);
+        UpdatePvPContestedFlagTimer(slowDiff);
 
-    CheckDuelDistance(now);
+        UpdateDuelFlag(now);
 
-    // Update items that have just a limited lifetime
-    if (now > m_Last_tick)
-        UpdateItemDuration(uint32(now - m_Last_tick));
+        CheckDuelDistance(now);
 
-    if (!m_timedquests.empty())
-    {
-        QuestSet::iterator iter = m_timedquests.begin();
-        while (iter != m_timedquests.end())
+        if (!m_timedquests.empty())
         {
-            QuestStatusData& q_status = mQuestStatus[*iter];
-            if (q_status.m_timer <= diff)
+            QuestSet::iterator iter = m_timedquests.begin();
+            while (iter != m_timedquests.end())
             {
-                uint32 quest_id = *iter;
-                ++iter; // Current iter will be removed in FailQuest
-                FailQuest(quest_id);
-            }
-            else
-            {
-                q_status.m_timer -= diff;
-                if (q_status.uState != QUEST_NEW)
-                    q_status.uState = QUEST_CHANGED;
-                ++iter;
+                QuestStatusData& q_status = mQuestStatus[*iter];
+                if (q_status.m_timer <= slowDiff)
+                {
+                    uint32 quest_id = *iter;
+                    ++iter; // Current iter will be removed in FailQuest
+                    FailQuest(quest_id);
+                }
+                else
+                {
+                    q_status.m_timer -= slowDiff;
+                    if (q_status.uState != QUEST_NEW)
+                        q_status.uState = QUEST_CHANGED;
+                    ++iter;
+                }
             }
         }
     }
 
+    // Update items that have just a limited lifetime
+    if (now > m_Last_tick)
+        UpdateItemDuration(uint32(now - m_Last_tick));
+
     if (hasUnitState(UNIT_STAT_MELEE_ATTACKING))
     {
         UpdateMeleeAttackingState();
@@ -1469,7 +1510,7 @@ void Player::Update(const uint32 diff)
         }
     }
 
-    if (HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_RESTING))
+    if (slowDiff && HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_RESTING))
     {
         if (GetTimeInnEnter() > 0) // Freeze update
         {
@@ -1490,9 +1531,9 @@ void Player::Update(const uint32 diff)
             m_positionStatusUpdateTimer -= diff;
     }
 
-    if (m_zoneUpdateTimer > 0)
+    if (slowDiff && m_zoneUpdateTimer > 0)
     {
-        if (diff >= m_zoneUpdateTimer)
+        if (slowDiff >= m_zoneUpdateTimer)
         {
             uint32 newzone, newarea;
             GetZoneAndAreaId(newzone, newarea);
@@ -1525,7 +1566,7 @@ void Player::Update(const uint32 diff)
             }
         }
         else
-            m_zoneUpdateTimer -= diff;
+            m_zoneUpdateTimer -= slowDiff;
     }
 
     if (m_cannotBeDetectedTimer > 0)
@@ -2782,6 +2823,8 @@ void Player::GiveLevel(uint32 level)
     if (level == GetLevel())
         return;
 
+    InvalidateConditionCache();
+
     uint32 plClass = getClass();
 
     PlayerLevelInfo info;
@@ -3027,31 +3070,40 @@ void Player::InitStatsForLevel(bool reapplyMods)
 
 void Player::SendInitialSpells() const
 {
-    uint16 spellCount = 0;
+    // the spell list only changes on learn/unlearn events, so the serialized
+    // block is kept between sends; only the cooldown section is time-dependent
+    if (m_initialSpellsCacheStale)
+    {
+        uint16 spellCount = 0;
 
-    WorldPacket data(SMSG_INITIAL_SPELLS, (1 + 2 + 4 * m_spells.size() + 2 + m_cooldownMap.size() * (2 + 2 + 2 + 4 + 4)));
-    data << uint8(0);
+        m_initialSpellsCache.clear();
+        m_initialSpellsCache << uint8(0);
 
-    size_t countPos = data.wpos();
-    data << uint16(spellCount); // spell count placeholder
+        size_t countPos = m_initialSpellsCache.wpos();
+        m_initialSpellsCache << uint16(spellCount); // spell count placeholder
 
-    for (const auto& m_spell : m_spells)
-    {
-        PlayerSpell const& playerSpell = m_spell.second;
+        for (const auto& m_spell : m_spells)
+        {
+            PlayerSpell const& playerSpell = m_spell.second;
 
-        if (playerSpell.state == PLAYERSPELL_REMOVED)
-            continue;
+            if (playerSpell.state == PLAYERSPELL_REMOVED)
+                continue;
 
-        if (!playerSpell.active || playerSpell.disabled)
-            continue;
+            if (!playerSpell.active || playerSpell.disabled)
+                continue;
 
-        data << uint16(m_spell.first);
-        data << uint16(0); // it's not slot id
+            m_initialSpellsCache << uint16(m_spell.first);
+            m_initialSpellsCache << uint16(0); // it's not slot id
 
-        spellCount += 1;
+            spellCount += 1;
+        }
+
+        m_initialSpellsCache.put<uint16>(countPos, spellCount); // write real count value
+        m_initialSpellsCacheStale = false;
     }
 
-    data.put<uint16>(countPos, spellCount); // write real count value
+    WorldPacket data(SMSG_INITIAL_SPELLS, (m_initialSpellsCache.size() + 2 + m_cooldownMap.size() * (2 + 2 + 2 + 4 + 4)));
+    data.append(m_initialSpellsCache);
 
     // write cooldown data
     uint32 cdCount = 0;
@@ -3189,6 +3241,8 @@ static inline bool IsUnlearnSpellsPacketNeededForSpell(uint32 spellId)
 
 bool Player::addSpell(uint32 spell_id, bool active, bool learning, bool dependent, bool disabled)
 {
+    m_initialSpellsCacheStale = true;
+
     SpellEntry const* spellInfo = sSpellTemplate.LookupEntry<SpellEntry>(spell_id);
     if (!spellInfo)
     {
@@ -3524,6 +3578,8 @@ bool Player::IsNeedCastPassiveLikeSpellAtLearn(SpellEntry const* spellInfo) cons
 
 void Player::learnSpell(uint32 spell_id, bool dependent, bool talent)
 {
+    InvalidateConditionCache();
+
     PlayerSpellMap::iterator itr = m_spells.find(spell_id);
 
     bool disabled = (itr != m_spells.end()) ? itr->second.disabled : false;
@@ -3558,6 +3614,10 @@ void Player::removeSpell(uint32 spell_id, bool disabled, bool learn_low_rank, bo
     if (itr == m_spells.end())
         return;
 
+    m_initialSpellsCacheStale = true;
+
+    InvalidateConditionCache();
+
     // Always try to remove all dependent spells if present (needed to reset some talents properly)
     SpellLearnSpellMapBounds spell_bounds = sSpellMgr.GetSpellLearnSpellMapBounds(spell_id);
     for (SpellLearnSpellMap::const_iterator child_itr = spell_bounds.first; child_itr != spell_bounds.second; ++child_itr)
@@ -4091,6 +4151,10 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
     // for nonexistent account avoid update realm
     if (accountId == 0)
         updateRealmChars = false;
+    else
+        sWorld.InvalidateCharacterEnumCache(accountId);
+
+    ObjectMgr::InvalidateCharacterLookupCache();
 
     uint32 charDelete_method = sWorld.getConfig(CONFIG_UINT32_CHARDELETE_METHOD);
     uint32 charDelete_minLvl = sWorld.getConfig(CONFIG_UINT32_CHARDELETE_MIN_LEVEL);
@@ -4244,6 +4308,7 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
             CharacterDatabase.PExecute("DELETE FROM characters WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_action WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_aura WHERE guid = '%u'", lowguid);
+            CharacterDatabase.PExecute("DELETE FROM character_aura_blob WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_battleground_data WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_gifts WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_homebind WHERE guid = '%u'", lowguid);
@@ -5292,6 +5357,8 @@ bool Player::UpdateSkill(uint16 id, uint16 diff)
         if (skillStatus.uState != SKILL_NEW)
             skillStatus.uState = SKILL_CHANGED;
 
+        InvalidateConditionCache();
+
         return true;
     }
 
@@ -5436,6 +5503,8 @@ bool Player::UpdateSkillPro(uint16 SkillId, int32 Chance, uint16 diff)
         if (skillStatus.uState != SKILL_NEW)
             skillStatus.uState = SKILL_CHANGED;
 
+        InvalidateConditionCache();
+
         DEBUG_LOG("Player::UpdateSkillPro Chance=%3.1f%% taken", Chance / 10.0);
         return true;
     }
@@ -5559,6 +5628,8 @@ void Player::SetSkill(SkillStatusMap::iterator itr, uint16 value, uint16 max, ui
     if (status.uState == SKILL_DELETED)
         return;
 
+    InvalidateConditionCache();
+
     if (value) // Update
     {
         if (step)
@@ -6083,16 +6154,23 @@ void Player::SendInitialActionButtons() const
 {
     DETAIL_LOG("Initializing Action Buttons for '%u'", GetGUIDLow());
 
-    WorldPacket data(SMSG_ACTION_BUTTONS, (MAX_ACTION_BUTTONS * 4));
-    for (uint8 button = 0; button < MAX_ACTION_BUTTONS; ++button)
+    if (m_actionButtonsCacheStale)
     {
-        ActionButtonList::const_iterator itr = m_actionButtons.find(button);
-        if (itr != m_actionButtons.end() && itr->second.uState != ACTIONBUTTON_DELETED)
-            data << uint32(itr->second.packedData);
-        else
-            data << uint32(0);
+        m_actionButtonsCache.clear();
+        for (uint8 button = 0; button < MAX_ACTION_BUTTONS; ++button)
+        {
+            ActionButtonList::const_iterator itr = m_actionButtons.find(button);
+            if (itr != m_actionButtons.end() && itr->second.uState != ACTIONBUTTON_DELETED)
+                m_actionButtonsCache << uint32(itr->second.packedData);
+            else
+                m_actionButtonsCache << uint32(0);
+        }
+        m_actionButtonsCacheStale = false;
     }
 
+    WorldPacket data(SMSG_ACTION_BUTTONS, (MAX_ACTION_BUTTONS * 4));
+    data.append(m_actionButtonsCache);
+
     GetSession()->SendPacket(data);
     DETAIL_LOG("Action Buttons for '%u' Initialized", GetGUIDLow());
 }
@@ -6174,6 +6252,8 @@ ActionButton* Player::addActionButton(uint8 button, uint32 action, uint8 type)
     // set data and update to CHANGED if not NEW
     ab.SetActionAndType(action, ActionButtonType(type));
 
+    m_actionButtonsCacheStale = true;
+
     DETAIL_LOG("Player '%u' Added Action '%u' (type %u) to Button '%u'", GetGUIDLow(), action, uint32(type), button);
     return &ab;
 }
@@ -6189,6 +6269,8 @@ void Player::removeActionButton(uint8 button)
     else
         buttonItr->second.uState = ACTIONBUTTON_DELETED; // saved, will deleted at next save
 
+    m_actionButtonsCacheStale = true;
+
     DETAIL_LOG("Action Button '%u' Removed from Player '%u'", button, GetGUIDLow());
 }
 
@@ -6224,9 +6306,15 @@ bool Player::SetPosition(float x, float y, float z, float orientation, bool tele
         y = GetPositionY();
         z = GetPositionZ();
 
-        // group update
+        // group update - only flag a map dot refresh once the member moved far
+        // enough for the whole-yard packet coordinates to actually change
         if (GetGroup() && (old_x != x || old_y != y))
-            SetGroupUpdateFlag(GROUP_UPDATE_FLAG_POSITION);
+        {
+            float dx = x - m_lastGroupPositionX;
+            float dy = y - m_lastGroupPositionY;
+            if (dx * dx + dy * dy >= GROUP_POSITION_MIN_DISPLACEMENT * GROUP_POSITION_MIN_DISPLACEMENT)
+                SetGroupUpdateFlag(GROUP_UPDATE_FLAG_POSITION);
+        }
 
         if (GetTrader() && !IsWithinDistInMap(GetTrader(), INTERACTION_DISTANCE))
             TradeCancel(true, TRADE_STATUS_TARGET_TO_FAR);
@@ -6571,6 +6659,9 @@ void Player::RewardReputation(Creature* victim, float rate)
     if (!Rep)
         return;
 
+    // a kill can touch both factions plus their team factions - report once
+    GetReputationMgr().BeginBatch();
+
     if (Rep->repfaction1 && (!Rep->team_dependent || GetTeam() == ALLIANCE))
     {
         int32 donerep1 = CalculateReputationGain(REPUTATION_SOURCE_KILL, Rep->repvalue1, Rep->repfaction1, victim->GetLevel());
@@ -6606,11 +6697,16 @@ void Player::RewardReputation(Creature* victim, float rate)
                 GetReputationMgr().ModifyReputation(team2_factionEntry, donerep2 / 2);
         }
     }
+
+    GetReputationMgr().EndBatch();
 }
 
 // Calculate how many reputation points player gain with the quest
 void Player::RewardReputation(Quest const* pQuest)
 {
+    // a quest can reward several factions - report once
+    GetReputationMgr().BeginBatch();
+
     // quest reputation reward/loss
     for (int i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)
     {
@@ -6627,6 +6723,8 @@ void Player::RewardReputation(Quest const* pQuest)
                 GetReputationMgr().ModifyReputation(factionEntry, rep, noSpillover);
         }
     }
+
+    GetReputationMgr().EndBatch();
 }
 
 // Update honor fields , cleanKills is only used during char saving
@@ -7038,6 +7136,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea, bool force)
         }
     }
 
+    GetMap()->UpdateZoneRegistry(this, m_zoneUpdateId, newZone);
+
     m_zoneUpdateId = newZone;
     m_zoneUpdateTimer = ZONE_UPDATE_INTERVAL;
 
@@ -7257,6 +7357,9 @@ void Player::_ApplyItemBonuses(ItemPrototype const* proto, uint8 slot, bool appl
     if (slot >= INVENTORY_SLOT_BAG_END || !proto)
         return;
 
+    // an item carries several stat/resistance lines; batch them into one recomputation
+    BeginStatBatch();
+
     for (uint32 i = 0; i < MAX_ITEM_PROTO_STATS; ++i)
     {
         float val = float(proto->ItemStat[i].ItemStatValue);
@@ -7319,6 +7422,8 @@ void Player::_ApplyItemBonuses(ItemPrototype const* proto, uint8 slot, bool appl
     if (proto->ArcaneRes)
         HandleStatModifier(UNIT_MOD_RESISTANCE_ARCANE, BASE_VALUE, float(proto->ArcaneRes), apply);
 
+    EndStatBatch();
+
     if (proto->IsWeapon())
     {
         WeaponAttackType attType = BASE_ATTACK;
@@ -8370,42 +8475,76 @@ InventoryResult Player::CanUnequipItems(uint32 item, uint32 count) const
     return res;
 }
 
-uint32 Player::GetItemCount(uint32 item, bool inBankAlso, Item* skipItem) const
+void Player::RebuildItemCountCache() const
 {
-    uint32 count = 0;
+    m_itemCountCache.clear();
+    m_bankItemCountCache.clear();
+
     for (int i = EQUIPMENT_SLOT_START; i < INVENTORY_SLOT_ITEM_END; ++i)
-    {
-        Item* pItem = GetItemByPos(INVENTORY_SLOT_BAG_0, i);
-        if (pItem && pItem != skipItem && pItem->GetEntry() == item)
-            count += pItem->GetCount();
-    }
+        if (Item* pItem = GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            m_itemCountCache[pItem->GetEntry()] += pItem->GetCount();
+
     for (int i = KEYRING_SLOT_START; i < KEYRING_SLOT_END; ++i)
-    {
-        Item* pItem = GetItemByPos(INVENTORY_SLOT_BAG_0, i);
-        if (pItem && pItem != skipItem && pItem->GetEntry() == item)
-            count += pItem->GetCount();
-    }
+        if (Item* pItem = GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            m_itemCountCache[pItem->GetEntry()] += pItem->GetCount();
+
     for (int i = INVENTORY_SLOT_BAG_START; i < INVENTORY_SLOT_BAG_END; ++i)
+        if (Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            for (uint32 j = 0; j < pBag->GetBagSize(); ++j)
+                if (Item* pItem = pBag->GetItemByPos(j))
+                    m_itemCountCache[pItem->GetEntry()] += pItem->GetCount();
+
+    for (int i = BANK_SLOT_ITEM_START; i < BANK_SLOT_ITEM_END; ++i)
+        if (Item* pItem = GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            m_bankItemCountCache[pItem->GetEntry()] += pItem->GetCount();
+
+    for (int i = BANK_SLOT_BAG_START; i < BANK_SLOT_BAG_END; ++i)
+        if (Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            for (uint32 j = 0; j < pBag->GetBagSize(); ++j)
+                if (Item* pItem = pBag->GetItemByPos(j))
+                    m_bankItemCountCache[pItem->GetEntry()] += pItem->GetCount();
+
+    m_itemCountCacheDirty = false;
+}
+
+uint32 Player::GetItemCount(uint32 item, bool inBankAlso, Item* skipItem) const
+{
+    if (m_itemCountCacheDirty)
+        RebuildItemCountCache();
+
+    uint32 count = 0;
+    auto itr = m_itemCountCache.find(item);
+    if (itr != m_itemCountCache.end())
+        count = itr->second;
+
+    if (inBankAlso)
     {
-        Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, i);
-        if (pBag)
-            count += pBag->GetItemCount(item, skipItem);
+        itr = m_bankItemCountCache.find(item);
+        if (itr != m_bankItemCountCache.end())
+            count += itr->second;
     }
 
-    if (inBankAlso)
+    if (skipItem && skipItem->GetEntry() == item && skipItem->GetOwnerGuid() == GetObjectGuid())
     {
-        for (int i = BANK_SLOT_ITEM_START; i < BANK_SLOT_ITEM_END; ++i)
+        uint8 bag = skipItem->GetBagSlot();
+        uint8 slot = skipItem->GetSlot();
+
+        // subtract only when the item sits in a region the caches actually counted
+        bool counted = false;
+        if (bag == INVENTORY_SLOT_BAG_0)
         {
-            Item* pItem = GetItemByPos(INVENTORY_SLOT_BAG_0, i);
-            if (pItem && pItem != skipItem && pItem->GetEntry() == item)
-                count += pItem->GetCount();
-        }
-        for (int i = BANK_SLOT_BAG_START; i < BANK_SLOT_BAG_END; ++i)
-        {
-            Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, i);
-            if (pBag)
-                count += pBag->GetItemCount(item, skipItem);
+            if (slot < INVENTORY_SLOT_ITEM_END || (slot >= KEYRING_SLOT_START && slot < KEYRING_SLOT_END))
+                counted = true;
+            else if (inBankAlso && slot >= BANK_SLOT_ITEM_START && slot < BANK_SLOT_ITEM_END)
+                counted = true;
         }
+        else if (bag >= INVENTORY_SLOT_BAG_START && bag < INVENTORY_SLOT_BAG_END)
+            counted = true;
+        else if (inBankAlso && bag >= BANK_SLOT_BAG_START && bag < BANK_SLOT_BAG_END)
+            counted = true;
+
+        if (counted)
+            count -= std::min(count, skipItem->GetCount());
     }
 
     return count;
@@ -8659,6 +8798,14 @@ bool Player::IsValidPos(uint8 bag, uint8 slot, bool explicit_pos) const
 
 bool Player::HasItemCount(uint32 item, uint32 count, bool inBankAlso) const
 {
+    // fast path over the per-entry count caches; the walk below additionally skips
+    // items locked in a pending trade, so it only remains for active trades
+    if (!m_trade)
+    {
+        uint32 total = GetItemCount(item, inBankAlso);
+        return count ? total >= count : total > 0;
+    }
+
     uint32 tempcount = 0;
     for (int i = EQUIPMENT_SLOT_START; i < INVENTORY_SLOT_ITEM_END; ++i)
     {
@@ -10132,6 +10279,8 @@ Item* Player::_StoreItem(uint16 pos, Item* pItem, uint32 count, bool clone, bool
 
     DEBUG_LOG("STORAGE: StoreItem bag = %u, slot = %u, item = %u, count = %u", bag, slot, pItem->GetEntry(), count);
 
+    InvalidateItemCountCache();
+
     Item* pItem2 = GetItemByPos(bag, slot);
 
     if (!pItem2)
@@ -10229,6 +10378,8 @@ Item* Player::EquipNewItem(uint16 pos, uint32 item, bool update)
 
 Item* Player::EquipItem(uint16 pos, Item* pItem, bool update)
 {
+    InvalidateConditionCache();
+
     AddEnchantmentDurations(pItem);
     AddItemDurations(pItem);
 
@@ -10386,6 +10537,8 @@ void Player::VisualizeItem(uint8 slot, Item* pItem)
     if (!pItem)
         return;
 
+    InvalidateItemCountCache();
+
     // check also  BIND_WHEN_PICKED_UP and BIND_QUEST_ITEM for .additem or .additemset case by GM (not binded at adding to inventory)
     ItemPrototype const* itemProto = pItem->GetProto();
     if (itemProto->Bonding == BIND_WHEN_EQUIPPED || itemProto->Bonding == BIND_WHEN_PICKED_UP || itemProto->Bonding == BIND_QUEST_ITEM)
@@ -10418,6 +10571,10 @@ void Player::RemoveItem(uint8 bag, uint8 slot, bool update)
     {
         DEBUG_LOG("STORAGE: RemoveItem bag = %u, slot = %u, item = %u", bag, slot, pItem->GetEntry());
 
+        InvalidateItemCountCache();
+
+        InvalidateConditionCache();
+
         RemoveEnchantmentDurations(pItem);
         RemoveItemDurations(pItem);
 
@@ -10519,6 +10676,8 @@ void Player::DestroyItem(uint8 bag, uint8 slot, bool update)
     {
         DEBUG_LOG("STORAGE: DestroyItem bag = %u, slot = %u, item = %u", bag, slot, pItem->GetEntry());
 
+        InvalidateItemCountCache();
+
         // start from destroy contained items (only equipped bag can have its)
         if (pItem->IsBag() && pItem->IsEquipped()) // this also prevent infinity loop if empty bag stored in bag==slot
         {
@@ -10878,6 +11037,9 @@ void Player::SplitItem(uint16 src, uint16 dst, uint32 count)
 
 void Player::SwapItem(uint16 src, uint16 dst)
 {
+    // covers the direct bag-content exchange below, which bypasses RemoveItem/_StoreItem
+    InvalidateItemCountCache();
+
     uint8 srcbag = src >> 8;
     uint8 srcslot = src & 255;
 
@@ -11332,22 +11494,85 @@ void Player::TradeCancel(bool sendback, TradeStatus status /*= TRADE_STATUS_TRAD
 void Player::UpdateItemDuration(uint32 time, bool realtimeonly)
 {
     if (m_itemDuration.empty())
+    {
+        m_itemDurationPending = 0;
         return;
+    }
 
     DEBUG_LOG("Player::UpdateItemDuration(%u,%s)", time, realtimeonly ? "true" : "false");
 
-    for (ItemDurationList::const_iterator itr = m_itemDuration.begin(); itr != m_itemDuration.end();)
+    if (realtimeonly)
+    {
+        // offline elapsed time, applied once at login to real-time items only
+        for (ItemDurationList::const_iterator itr = m_itemDuration.begin(); itr != m_itemDuration.end();)
+        {
+            Item* item = *itr;
+            ++itr; // current element can be erased in UpdateDuration
+
+            if (item->GetProto()->ExtraFlags & ITEM_EXTRA_REAL_TIME_DURATION)
+                item->UpdateDuration(this, time);
+        }
+
+        MaterializeItemDurations();
+        return;
+    }
+
+    // elapsed time only accumulates until the nearest expiry is actually due;
+    // the item fields and the expiry pass catch up in one batch then
+    m_itemDurationPending += time;
+    if (m_itemDurationPending < m_itemDurationNext)
+        return;
+
+    MaterializeItemDurations();
+}
+
+void Player::MaterializeItemDurations()
+{
+    uint32 const elapsed = m_itemDurationPending;
+    m_itemDurationPending = 0;
+    m_itemDurationNext = std::numeric_limits<uint32>::max();
+
+    if (m_itemDuration.empty())
+        return;
+
+    if (elapsed)
     {
-        Item* item = *itr;
-        ++itr; // current element can be erased in UpdateDuration
+        for (ItemDurationList::const_iterator itr = m_itemDuration.begin(); itr != m_itemDuration.end();)
+        {
+            Item* item = *itr;
+            ++itr; // current element can be erased in UpdateDuration
 
-        if (!(realtimeonly) || (item->GetProto()->ExtraFlags & ITEM_EXTRA_REAL_TIME_DURATION))
-            item->UpdateDuration(this, time);
+            item->UpdateDuration(this, elapsed);
+        }
     }
+
+    for (Item* item : m_itemDuration)
+        m_itemDurationNext = std::min(m_itemDurationNext, item->GetUInt32Value(ITEM_FIELD_DURATION));
 }
 
 void Player::UpdateEnchantTime(uint32 time)
 {
+    if (m_enchantDuration.empty())
+    {
+        m_enchantPendingTime = 0;
+        return;
+    }
+
+    // same deadline gate as item durations: nothing is walked until the
+    // earliest enchant can actually run out
+    m_enchantPendingTime += time;
+    if (m_enchantPendingTime < m_enchantNextExpiry)
+        return;
+
+    MaterializeEnchantDurations();
+}
+
+void Player::MaterializeEnchantDurations()
+{
+    uint32 const elapsed = m_enchantPendingTime;
+    m_enchantPendingTime = 0;
+    m_enchantNextExpiry = std::numeric_limits<uint32>::max();
+
     for (EnchantDurationList::iterator itr = m_enchantDuration.begin(), next; itr != m_enchantDuration.end(); itr = next)
     {
         MANGOS_ASSERT(itr->item);
@@ -11356,15 +11581,16 @@ void Player::UpdateEnchantTime(uint32 time)
         {
             next = m_enchantDuration.erase(itr);
         }
-        else if (itr->leftduration <= time)
+        else if (itr->leftduration <= elapsed)
         {
             ApplyEnchantment(itr->item, itr->slot, false, false);
             itr->item->ClearEnchantment(itr->slot);
             next = m_enchantDuration.erase(itr);
         }
-        else if (itr->leftduration > time)
+        else
         {
-            itr->leftduration -= time;
+            itr->leftduration -= elapsed;
+            m_enchantNextExpiry = std::min(m_enchantNextExpiry, itr->leftduration);
             ++next;
         }
     }
@@ -11385,6 +11611,8 @@ void Player::AddEnchantmentDurations(Item* item)
 
 void Player::RemoveEnchantmentDurations(Item* item)
 {
+    MaterializeEnchantDurations();
+
     for (EnchantDurationList::iterator itr = m_enchantDuration.begin(); itr != m_enchantDuration.end();)
     {
         if (itr->item == item)
@@ -11400,6 +11628,8 @@ void Player::RemoveEnchantmentDurations(Item* item)
 
 void Player::RemoveAllEnchantments(EnchantmentSlot slot)
 {
+    MaterializeEnchantDurations();
+
     // remove enchantments from equipped items first to clean up the m_enchantDuration list
     for (EnchantDurationList::iterator itr = m_enchantDuration.begin(), next; itr != m_enchantDuration.end(); itr = next)
     {
@@ -11446,6 +11676,8 @@ void Player::AddEnchantmentDuration(Item* item, EnchantmentSlot slot, uint32 dur
     if (slot >= MAX_ENCHANTMENT_SLOT)
         return;
 
+    MaterializeEnchantDurations();
+
     for (EnchantDurationList::iterator itr = m_enchantDuration.begin(); itr != m_enchantDuration.end(); ++itr)
     {
         if (itr->item == item && itr->slot == slot)
@@ -11459,6 +11691,7 @@ void Player::AddEnchantmentDuration(Item* item, EnchantmentSlot slot, uint32 dur
     {
         GetSession()->SendItemEnchantTimeUpdate(GetObjectGuid(), item->GetObjectGuid(), slot, uint32(duration / 1000));
         m_enchantDuration.push_back(EnchantDuration(item, slot, duration));
+        m_enchantNextExpiry = std::min(m_enchantNextExpiry, duration);
     }
 }
 
@@ -11634,6 +11867,8 @@ void Player::ApplyEnchantment(Item* item, EnchantmentSlot slot, bool apply, bool
 
 void Player::SendEnchantmentDurations()
 {
+    MaterializeEnchantDurations();
+
     for (EnchantDurationList::const_iterator itr = m_enchantDuration.begin(); itr != m_enchantDuration.end(); ++itr)
     {
         GetSession()->SendItemEnchantTimeUpdate(GetObjectGuid(), itr->item->GetObjectGuid(), itr->slot, uint32(itr->leftduration) / 1000);
@@ -12177,14 +12412,14 @@ uint32 Player::GetDefaultGossipMenuForSource(WorldObject* pSource) const
 
 void Player::PrepareQuestMenu(ObjectGuid guid) const
 {
-    QuestRelationsMapBounds rbounds;
-    QuestRelationsMapBounds irbounds;
+    QuestRelations const* relations;
+    QuestRelations const* involvedRelations;
 
     // pets also can have quests
     if (Creature* pCreature = GetMap()->GetAnyTypeCreature(guid))
     {
-        rbounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(pCreature->GetEntry());
-        irbounds = sObjectMgr.GetCreatureQuestInvolvedRelationsMapBounds(pCreature->GetEntry());
+        relations = &sObjectMgr.GetCreatureQuestRelations(pCreature->GetEntry());
+        involvedRelations = &sObjectMgr.GetCreatureQuestInvolvedRelations(pCreature->GetEntry());
     }
     else
     {
@@ -12195,8 +12430,8 @@ void Player::PrepareQuestMenu(ObjectGuid guid) const
 
         if (GameObject* pGameObject = _map->GetGameObject(guid))
         {
-            rbounds = sObjectMgr.GetGOQuestRelationsMapBounds(pGameObject->GetEntry());
-            irbounds = sObjectMgr.GetGOQuestInvolvedRelationsMapBounds(pGameObject->GetEntry());
+            relations = &sObjectMgr.GetGOQuestRelations(pGameObject->GetEntry());
+            involvedRelations = &sObjectMgr.GetGOQuestInvolvedRelations(pGameObject->GetEntry());
         }
         else
             return;
@@ -12205,10 +12440,8 @@ void Player::PrepareQuestMenu(ObjectGuid guid) const
     QuestMenu& qm = m_playerMenu->GetQuestMenu();
     qm.ClearMenu();
 
-    for (QuestRelationsMap::const_iterator itr = irbounds.first; itr != irbounds.second; ++itr)
+    for (uint32 quest_id : *involvedRelations)
     {
-        uint32 quest_id = itr->second;
-
         Quest const* pQuest = sObjectMgr.GetQuestTemplate(quest_id);
 
         if (!pQuest || !pQuest->IsActive())
@@ -12224,10 +12457,8 @@ void Player::PrepareQuestMenu(ObjectGuid guid) const
             qm.AddMenuItem(quest_id, DIALOG_STATUS_CHAT);
     }
 
-    for (QuestRelationsMap::const_iterator itr = rbounds.first; itr != rbounds.second; ++itr)
+    for (uint32 quest_id : *relations)
     {
-        uint32 quest_id = itr->second;
-
         Quest const* pQuest = sObjectMgr.GetQuestTemplate(quest_id);
 
         if (!pQuest || !pQuest->IsActive())
@@ -12367,11 +12598,11 @@ bool Player::IsCurrentQuest(uint32 quest_id, uint8 completed_or_not) const
 
 Quest const* Player::GetNextQuest(ObjectGuid guid, Quest const* pQuest) const
 {
-    QuestRelationsMapBounds rbounds;
+    QuestRelations const* relations;
 
     if (Creature* pCreature = GetMap()->GetAnyTypeCreature(guid))
     {
-        rbounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(pCreature->GetEntry());
+        relations = &sObjectMgr.GetCreatureQuestRelations(pCreature->GetEntry());
     }
     else
     {
@@ -12382,16 +12613,16 @@ Quest const* Player::GetNextQuest(ObjectGuid guid, Quest const* pQuest) const
 
         if (GameObject* pGameObject = _map->GetGameObject(guid))
         {
-            rbounds = sObjectMgr.GetGOQuestRelationsMapBounds(pGameObject->GetEntry());
+            relations = &sObjectMgr.GetGOQuestRelations(pGameObject->GetEntry());
         }
         else
             return nullptr;
     }
 
     uint32 nextQuestID = pQuest->GetNextQuestInChain();
-    for (QuestRelationsMap::const_iterator itr = rbounds.first; itr != rbounds.second; ++itr)
+    for (uint32 quest_id : *relations)
     {
-        if (itr->second == nextQuestID)
+        if (quest_id == nextQuestID)
             return sObjectMgr.GetQuestTemplate(nextQuestID);
     }
 
@@ -12617,6 +12848,8 @@ void Player::SendPetTameFailure(PetTameFailureReason reason) const
 
 void Player::AddQuest(Quest const* pQuest, Object* questGiver)
 {
+    InvalidateConditionCache();
+
     uint16 log_slot = FindQuestSlot(0);
     MANGOS_ASSERT(log_slot < MAX_QUEST_LOG_SIZE);
 
@@ -12768,6 +13001,8 @@ void Player::IncompleteQuest(uint32 quest_id)
 
 void Player::RewardQuest(Quest const* pQuest, uint32 reward, Object* questGiver, bool announce)
 {
+    InvalidateConditionCache();
+
     uint32 quest_id = pQuest->GetQuestId();
 
     for (int i = 0; i < QUEST_ITEM_OBJECTIVES_COUNT; ++i)
@@ -13495,6 +13730,8 @@ bool Player::CanShareQuest(uint32 quest_id) const
 
 void Player::SetQuestStatus(uint32 quest_id, QuestStatus status)
 {
+    InvalidateConditionCache();
+
     if (sObjectMgr.GetQuestTemplate(quest_id))
     {
         QuestStatusData& q_status = mQuestStatus[quest_id];
@@ -13600,6 +13837,8 @@ void Player::RewardPlayerAndGroupAtEventExplored(uint32 questId, WorldObject con
 
 void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 {
+    InvalidateConditionCache();
+
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         uint32 questid = GetQuestSlotQuestId(i);
@@ -13644,6 +13883,8 @@ void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 
 void Player::ItemRemovedQuestCheck(uint32 entry, uint32 count)
 {
+    InvalidateConditionCache();
+
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         uint32 questid = GetQuestSlotQuestId(i);
@@ -13906,6 +14147,8 @@ void Player::MoneyChanged(uint32 count)
 
 void Player::ReputationChanged(FactionEntry const* factionEntry)
 {
+    InvalidateConditionCache();
+
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         if (uint32 questid = GetQuestSlotQuestId(i))
@@ -14615,14 +14858,13 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
 
     // apply original stats mods before spell loading or item equipment that call before equip _RemoveStatsMods()
 
-    // Mail
-    _LoadMails(holder->GetResult(PLAYER_LOGIN_QUERY_LOADMAILS));
-    _LoadMailedItems(holder->GetResult(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS));
-    UpdateNextMailTimeAndUnreads();
+    // Mail: only the unread count and next delivery time load here, the
+    // mailbox contents themselves load on first mailbox interaction
+    _LoadMailSummary(holder->GetResult(PLAYER_LOGIN_QUERY_LOADMAILSUMMARY));
 
     _LoadSpells(holder->GetResult(PLAYER_LOGIN_QUERY_LOADSPELLS));
 
-    _LoadAuras(holder->GetResult(PLAYER_LOGIN_QUERY_LOADAURAS), time_diff);
+    _LoadAuras(holder->GetResult(PLAYER_LOGIN_QUERY_LOADAURABLOB), holder->GetResult(PLAYER_LOGIN_QUERY_LOADAURAS), time_diff);
 
     // add ghost flag (must be after aura load: PLAYER_FLAGS_GHOST set in aura)
     if (HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_GHOST))
@@ -14827,17 +15069,130 @@ void Player::_LoadActions(std::unique_ptr<QueryResult> queryResult)
     }
 }
 
-void Player::_LoadAuras(std::unique_ptr<QueryResult> queryResult, uint32 timediff)
+// character_aura_blob format revision; bump when the packed field set changes,
+// older snapshots then fall back to the character_aura row parse
+static uint32 const AURA_BLOB_VERSION = 1;
+static uint32 const AURA_BLOB_FIELDS = 14;
+
+void Player::_LoadAura(ObjectGuid casterGuid, uint32 itemLowGuid, uint32 spellid, uint32 stackcount, uint32 remaincharges, int32* damage, uint32 const* periodicTime, int32 maxduration, int32 remaintime, uint32 effIndexMask, uint32 timediff)
+{
+    SpellEntry const* spellproto = sSpellTemplate.LookupEntry<SpellEntry>(spellid);
+    if (!spellproto)
+    {
+        sLog.outError("Unknown spell (spellid %u), ignore.", spellid);
+        return;
+    }
+
+    if (remaintime != -1 && (spellproto->HasAttribute(SPELL_ATTR_EX4_AURA_EXPIRES_OFFLINE) || !IsPositiveSpell(spellproto)))
+    {
+        if (remaintime / IN_MILLISECONDS <= int32(timediff))
+            return;
+
+        remaintime -= timediff * IN_MILLISECONDS;
+    }
+
+    // prevent wrong values of remaincharges
+    if (spellproto->procCharges == 0)
+        remaincharges = 0;
+
+    if (!spellproto->StackAmount)
+        stackcount = 1;
+    else if (spellproto->StackAmount < stackcount)
+        stackcount = spellproto->StackAmount;
+    else if (!stackcount)
+        stackcount = 1;
+
+    SpellAuraHolder* holder = CreateSpellAuraHolder(spellproto, this, nullptr);
+    holder->SetLoadedState(casterGuid, ObjectGuid(HIGHGUID_ITEM, itemLowGuid), stackcount, remaincharges, maxduration, remaintime);
+
+    for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+    {
+        if ((effIndexMask & (1 << i)) == 0)
+            continue;
+
+        Aura* aura = CreateAura(spellproto, SpellEffectIndex(i), nullptr, nullptr, holder, this);
+        if (!damage[i])
+            damage[i] = aura->GetModifier()->m_amount;
+
+        aura->SetLoadedState(damage[i], periodicTime[i]);
+        holder->AddAura(aura, SpellEffectIndex(i));
+    }
+
+    const bool empty = holder->IsEmptyHolder();
+    if (!empty)
+    {
+        // reset stolen single target auras
+        if (casterGuid != GetObjectGuid() && holder->GetTrackedAuraType() == TRACK_AURA_TYPE_SINGLE_TARGET)
+            holder->SetTrackedAuraType(TRACK_AURA_TYPE_NOT_TRACKED);
+
+        // FIXME: commits related to SPELLAURAHOLDER_STATE_DB_LOAD need to be backported from tbc+
+        // holder->SetState(SPELLAURAHOLDER_STATE_DB_LOAD); // Safeguard mechanism against some actions
+    }
+
+    if (!empty && AddSpellAuraHolder(holder))
+    {
+        holder->SetState(SPELLAURAHOLDER_STATE_READY);
+        DETAIL_LOG("Added player auras from spellid %u", spellproto->Id);
+
+        if (holder->GetSpellProto()->HasAttribute(SPELL_ATTR_COOLDOWN_ON_EVENT))
+            AddCooldown(*holder->GetSpellProto(), nullptr, true);
+    }
+    else
+        delete holder;
+}
+
+bool Player::_LoadAurasFromBlob(QueryResult* queryResult, uint32 timediff)
+{
+    if (!queryResult)
+        return false;
+
+    Field* fields = queryResult->Fetch();
+    if (fields[0].GetUInt32() != AURA_BLOB_VERSION)
+        return false;                                       // written by another core revision, parse the rows instead
+
+    Tokens tokens = StrSplit(fields[1].GetCppString(), " ");
+    if (tokens.empty() || tokens.size() % AURA_BLOB_FIELDS != 0)
+        return false;
+
+    for (size_t pos = 0; pos < tokens.size(); pos += AURA_BLOB_FIELDS)
+    {
+        ObjectGuid casterGuid = ObjectGuid(uint64(strtoull(tokens[pos + 0].c_str(), nullptr, 10)));
+        uint32 itemLowGuid = strtoul(tokens[pos + 1].c_str(), nullptr, 10);
+        uint32 spellid = strtoul(tokens[pos + 2].c_str(), nullptr, 10);
+        uint32 stackcount = strtoul(tokens[pos + 3].c_str(), nullptr, 10);
+        uint32 remaincharges = strtoul(tokens[pos + 4].c_str(), nullptr, 10);
+        int32 damage[MAX_EFFECT_INDEX];
+        uint32 periodicTime[MAX_EFFECT_INDEX];
+
+        for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+        {
+            damage[i] = atoi(tokens[pos + 5 + i].c_str());
+            periodicTime[i] = strtoul(tokens[pos + 8 + i].c_str(), nullptr, 10);
+        }
+
+        int32 maxduration = atoi(tokens[pos + 11].c_str());
+        int32 remaintime = atoi(tokens[pos + 12].c_str());
+        uint32 effIndexMask = strtoul(tokens[pos + 13].c_str(), nullptr, 10);
+
+        _LoadAura(casterGuid, itemLowGuid, spellid, stackcount, remaincharges, damage, periodicTime, maxduration, remaintime, effIndexMask, timediff);
+    }
+
+    return true;
+}
+
+void Player::_LoadAuras(std::unique_ptr<QueryResult> blobResult, std::unique_ptr<QueryResult> rowResult, uint32 timediff)
 {
     // RemoveAllAuras(); -- some spells casted before aura load, for example in LoadSkills, aura list explicitly cleaned early
 
     // QueryResult *result = CharacterDatabase.PQuery("SELECT caster_guid,item_guid,spell,stackcount,remaincharges,basepoints0,basepoints1,basepoints2,periodictime0,periodictime1,periodictime2,maxduration,remaintime,effIndexMask FROM character_aura WHERE guid = '%u'",GetGUIDLow());
 
-    if (queryResult)
+    // the packed snapshot holds the same values as the character_aura rows;
+    // the rows stay the fallback for characters last saved by another revision
+    if (!_LoadAurasFromBlob(blobResult.get(), timediff) && rowResult)
     {
         do
         {
-            Field* fields = queryResult->Fetch();
+            Field* fields = rowResult->Fetch();
             ObjectGuid caster_guid = ObjectGuid(fields[0].GetUInt64());
             uint32 item_lowguid = fields[1].GetUInt32();
             uint32 spellid = fields[2].GetUInt32();
@@ -14856,70 +15211,8 @@ void Player::_LoadAuras(std::unique_ptr<QueryResult> queryResult, uint32 timedif
             int32 remaintime = fields[12].GetInt32();
             uint32 effIndexMask = fields[13].GetUInt32();
 
-            SpellEntry const* spellproto = sSpellTemplate.LookupEntry<SpellEntry>(spellid);
-            if (!spellproto)
-            {
-                sLog.outError("Unknown spell (spellid %u), ignore.", spellid);
-                continue;
-            }
-
-            if (remaintime != -1 && (spellproto->HasAttribute(SPELL_ATTR_EX4_AURA_EXPIRES_OFFLINE) || !IsPositiveSpell(spellproto)))
-            {
-                if (remaintime / IN_MILLISECONDS <= int32(timediff))
-                    continue;
-
-                remaintime -= timediff * IN_MILLISECONDS;
-            }
-
-            // prevent wrong values of remaincharges
-            if (spellproto->procCharges == 0)
-                remaincharges = 0;
-
-            if (!spellproto->StackAmount)
-                stackcount = 1;
-            else if (spellproto->StackAmount < stackcount)
-                stackcount = spellproto->StackAmount;
-            else if (!stackcount)
-                stackcount = 1;
-
-            SpellAuraHolder* holder = CreateSpellAuraHolder(spellproto, this, nullptr);
-            holder->SetLoadedState(caster_guid, ObjectGuid(HIGHGUID_ITEM, item_lowguid), stackcount, remaincharges, maxduration, remaintime);
-
-            for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
-            {
-                if ((effIndexMask & (1 << i)) == 0)
-                    continue;
-
-                Aura* aura = CreateAura(spellproto, SpellEffectIndex(i), nullptr, nullptr, holder, this);
-                if (!damage[i])
-                    damage[i] = aura->GetModifier()->m_amount;
-
-                aura->SetLoadedState(damage[i], periodicTime[i]);
-                holder->AddAura(aura, SpellEffectIndex(i));
-            }
-
-            const bool empty = holder->IsEmptyHolder();
-            if (!empty)
-            {
-                // reset stolen single target auras
-                if (caster_guid != GetObjectGuid() && holder->GetTrackedAuraType() == TRACK_AURA_TYPE_SINGLE_TARGET)
-                    holder->SetTrackedAuraType(TRACK_AURA_TYPE_NOT_TRACKED);
-
-                // FIXME: commits related to SPELLAURAHOLDER_STATE_DB_LOAD need to be backported from tbc+
-                // holder->SetState(SPELLAURAHOLDER_STATE_DB_LOAD); // Safeguard mechanism against some actions
-            }
-
-            if (!empty && AddSpellAuraHolder(holder))
-            {
-                holder->SetState(SPELLAURAHOLDER_STATE_READY);
-                DETAIL_LOG("Added player auras from spellid %u", spellproto->Id);
-
-                if (holder->GetSpellProto()->HasAttribute(SPELL_ATTR_COOLDOWN_ON_EVENT))
-                    AddCooldown(*holder->GetSpellProto(), nullptr, true);
-            }
-            else
-                delete holder;
-        } while (queryResult->NextRow());
+            _LoadAura(caster_guid, item_lowguid, spellid, stackcount, remaincharges, damage, periodicTime, maxduration, remaintime, effIndexMask, timediff);
+        } while (rowResult->NextRow());
     }
 
     if (getClass() == CLASS_WARRIOR && !HasAuraType(SPELL_AURA_MOD_SHAPESHIFT))
@@ -15187,6 +15480,11 @@ void Player::_LoadMailedItems(std::unique_ptr<QueryResult> queryResult)
         Mail* mail = GetMail(mail_id);
         if (!mail)
             continue;
+
+        // item of a mail delivered while online before the lazy load completed
+        if (GetMItem(item_guid_low))
+            continue;
+
         mail->AddItem(item_guid_low, item_template);
 
         ItemPrototype const* proto = ObjectMgr::GetItemPrototype(item_template);
@@ -15216,7 +15514,6 @@ void Player::_LoadMailedItems(std::unique_ptr<QueryResult> queryResult)
 
 void Player::_LoadMails(std::unique_ptr<QueryResult> queryResult)
 {
-    m_mail.clear();
     //        0  1           2      3        4       5          6           7            8     9   10      11         12             13
     //"SELECT id,messageType,sender,receiver,subject,itemTextId,expire_time,deliver_time,money,cod,checked,stationery,mailTemplateId,has_items FROM mail WHERE receiver = '%u' ORDER BY id DESC",GetGUIDLow()
     if (!queryResult)
@@ -15225,6 +15522,11 @@ void Player::_LoadMails(std::unique_ptr<QueryResult> queryResult)
     do
     {
         Field* fields = queryResult->Fetch();
+
+        // mail delivered while online before the lazy load completed is already in memory
+        if (GetMail(fields[0].GetUInt32()))
+            continue;
+
         Mail* m = new Mail;
         m->messageID = fields[0].GetUInt32();
         m->messageType = fields[1].GetUInt8();
@@ -15256,6 +15558,86 @@ void Player::_LoadMails(std::unique_ptr<QueryResult> queryResult)
     } while (queryResult->NextRow());
 }
 
+void Player::_LoadMailSummary(std::unique_ptr<QueryResult> queryResult)
+{
+    //        0                                                                      1
+    //"SELECT COUNT(CASE WHEN deliver_time <= <now> AND (checked & 1) = 0 THEN 1 END), MIN(CASE WHEN deliver_time > <now> THEN deliver_time END) FROM mail WHERE receiver = '%u'"
+    unReadMails = 0;
+    m_nextMailDelivereTime = 0;
+
+    if (!queryResult)
+        return;
+
+    Field* fields = queryResult->Fetch();
+    uint32 unread = fields[0].GetUInt32();
+    unReadMails = uint8(unread < 255 ? unread : 255);
+    m_nextMailDelivereTime = (time_t)fields[1].GetUInt64();
+}
+
+/// holds the deferred mailbox content queries, see Player::LoadMailsAsync
+class MailLoadQueryHolder : public SqlQueryHolder
+{
+    public:
+        ObjectGuid m_guid;
+        explicit MailLoadQueryHolder(ObjectGuid guid) : m_guid(guid) {}
+
+        bool Initialize()
+        {
+            SetSize(2);
+
+            bool res = SetPQuery(0, "SELECT id,messageType,sender,receiver,subject,itemTextId,expire_time,deliver_time,money,cod,checked,stationery,mailTemplateId,has_items FROM mail WHERE receiver = '%u' ORDER BY id DESC", m_guid.GetCounter());
+            res &= SetPQuery(1, "SELECT itemEntry, creatorGuid, giftCreatorGuid, count, duration, charges, flags, enchantments, randomPropertyId, durability, itemTextId, mail_id, item_guid, item_template FROM mail_items JOIN item_instance ON item_guid = guid WHERE receiver = '%u'", m_guid.GetCounter());
+            return res;
+        }
+};
+
+struct MailLoadHandler
+{
+    void HandleCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
+    {
+        MailLoadQueryHolder* mailHolder = (MailLoadQueryHolder*)holder;
+
+        if (Player* player = sObjectMgr.GetPlayer(mailHolder->m_guid))
+            player->ApplyLoadedMails(mailHolder);
+
+        delete holder;
+    }
+} mailLoadHandler;
+
+void Player::LoadMailsAsync()
+{
+    if (m_mailsLoaded || m_mailsLoadRequested)
+        return;
+
+    MailLoadQueryHolder* holder = new MailLoadQueryHolder(GetObjectGuid());
+    if (!holder->Initialize())
+    {
+        delete holder;                                      // delete all unprocessed queries
+        return;
+    }
+
+    m_mailsLoadRequested = true;
+    CharacterDatabase.DelayQueryHolder(&mailLoadHandler, &MailLoadHandler::HandleCallback, holder);
+}
+
+void Player::ApplyLoadedMails(SqlQueryHolder* holder)
+{
+    m_mailsLoadRequested = false;
+
+    if (m_mailsLoaded)
+        return;
+
+    _LoadMails(holder->GetResult(0));
+    _LoadMailedItems(holder->GetResult(1));
+    m_mailsLoaded = true;
+
+    UpdateNextMailTimeAndUnreads();
+
+    // replay the mail list request that triggered the load
+    if (GetSession())
+        GetSession()->SendMailListResult();
+}
+
 void Player::LoadPet()
 {
     // fixme: the pet should still be loaded if the player is not in world
@@ -15790,9 +16172,6 @@ void Player::SaveToDB()
     static SqlStatementID delChar;
     static SqlStatementID insChar;
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delChar, "DELETE FROM characters WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
-
     SqlStatement uberInsert = CharacterDatabase.CreateStatement(insChar,
         "INSERT INTO characters (guid,account,name,race,class,gender,level,xp,money,playerBytes,playerBytes2,playerFlags,"
         "map, position_x, position_y, position_z, orientation, "
@@ -15930,7 +16309,19 @@ void Player::SaveToDB()
 
     uberInsert.addUInt8(m_fishingSteps);
 
-    uberInsert.Execute();
+    // skip rewriting the characters row when no bound value changed since the
+    // last save; played time (20/21), rest bonus (22) and logout time (23) tick
+    // on every save, so they are excluded from the comparison and only flushed
+    // together with a real change or with the forced save at logout
+    uint32 const characterHash = uberInsert.CalculateBoundHash({ 20, 21, 22, 23 });
+    if (characterHash != m_lastSavedCharacterHash || m_session->isLogingOut())
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(delChar, "DELETE FROM characters WHERE guid = ?");
+        stmt.PExecute(GetGUIDLow());
+
+        uberInsert.Execute();
+        m_lastSavedCharacterHash = characterHash;
+    }
 
     if (m_mailsUpdated) // save mails only when needed
         _SaveMail();
@@ -15949,7 +16340,13 @@ void Player::SaveToDB()
     _SaveHonorCP();
     GetSession()->SaveTutorialsData(); // changed only while character in game
 
-    CharacterDatabase.CommitTransaction();
+    // journaled commit: with Database.CharacterJournal set, the save is
+    // crash safe the moment this returns, even though the MySQL flush is
+    // still batched on the delay thread
+    CharacterDatabase.CommitJournaledTransaction();
+
+    // the character screen enum shows data written above (level, zone, gear, ...)
+    sWorld.InvalidateCharacterEnumCache(GetSession()->GetAccountId());
 
     // check if stats should only be saved on logout
     // save stats can be out of transaction
@@ -16028,34 +16425,49 @@ void Player::_SaveAuras()
     static SqlStatementID deleteAuras;
     static SqlStatementID insertAuras;
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM character_aura WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
-
-    SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
-
-    if (auraHolders.empty())
-        return;
+    struct AuraSaveRow
+    {
+        uint64 casterGuid;
+        uint32 itemGuid;
+        uint32 spellId;
+        uint32 stackAmount;
+        uint8 charges;
+        int32 damage[MAX_EFFECT_INDEX];
+        uint32 periodicTime[MAX_EFFECT_INDEX];
+        int32 maxDuration;
+        int32 remainTime;
+        uint32 effIndexMask;
+    };
 
-    stmt = CharacterDatabase.CreateStatement(insertAuras,
-        "INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, "
-        "basepoints0, basepoints1, basepoints2, periodictime0, periodictime1, periodictime2, maxduration, remaintime, effIndexMask) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+    // collect the savable rows first so the table rewrite can be skipped
+    // entirely when nothing changed since the last save (remaining durations
+    // are part of the hash, so running temporary auras still save every time)
+    std::vector<AuraSaveRow> rows;
+    uint32 rowsHash = 0x811C9DC5;
+    auto feedHash = [&rowsHash](void const* data, size_t size)
+    {
+        unsigned char const* bytes = static_cast<unsigned char const*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            rowsHash ^= bytes[i];
+            rowsHash *= 0x01000193;
+        }
+    };
 
-    for (const auto& auraHolder : auraHolders)
+    for (const auto& auraHolder : GetSpellAuraHolderMap())
     {
         SpellAuraHolder* holder = auraHolder.second;
         // skip all holders from spells that are passive or channeled
         // save singleTarget auras if self cast.
         if (holder->IsSaveToDbHolder())
         {
-            int32 damage[MAX_EFFECT_INDEX];
-            uint32 periodicTime[MAX_EFFECT_INDEX];
-            uint32 effIndexMask = 0;
+            AuraSaveRow row;
+            row.effIndexMask = 0;
 
             for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
             {
-                damage[i] = 0;
-                periodicTime[i] = 0;
+                row.damage[i] = 0;
+                row.periodicTime[i] = 0;
 
                 if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
                 {
@@ -16063,34 +16475,101 @@ void Player::_SaveAuras()
                     if (!aur->IsSaveToDbAura())
                         continue;
 
-                    damage[i] = aur->GetModifier()->m_amount;
-                    periodicTime[i] = aur->GetModifier()->periodictime;
-                    effIndexMask |= (1 << i);
+                    row.damage[i] = aur->GetModifier()->m_amount;
+                    row.periodicTime[i] = aur->GetModifier()->periodictime;
+                    row.effIndexMask |= (1 << i);
                 }
             }
 
-            if (!effIndexMask)
+            if (!row.effIndexMask)
                 continue;
 
-            stmt.addUInt32(GetGUIDLow());
-            stmt.addUInt64(holder->GetCasterGuid().GetRawValue());
-            stmt.addUInt32(holder->GetCastItemGuid().GetCounter());
-            stmt.addUInt32(holder->GetId());
-            stmt.addUInt32(holder->GetStackAmount());
-            stmt.addUInt8(holder->GetAuraCharges());
-
-            for (int i : damage)
-                stmt.addInt32(i);
+            row.casterGuid = holder->GetCasterGuid().GetRawValue();
+            row.itemGuid = holder->GetCastItemGuid().GetCounter();
+            row.spellId = holder->GetId();
+            row.stackAmount = holder->GetStackAmount();
+            row.charges = holder->GetAuraCharges();
+            row.maxDuration = holder->GetAuraMaxDuration();
+            row.remainTime = holder->GetAuraDuration();
 
-            for (unsigned int i : periodicTime)
-                stmt.addUInt32(i);
+            feedHash(&row.casterGuid, sizeof(row.casterGuid));
+            feedHash(&row.itemGuid, sizeof(row.itemGuid));
+            feedHash(&row.spellId, sizeof(row.spellId));
+            feedHash(&row.stackAmount, sizeof(row.stackAmount));
+            feedHash(&row.charges, sizeof(row.charges));
+            feedHash(row.damage, sizeof(row.damage));
+            feedHash(row.periodicTime, sizeof(row.periodicTime));
+            feedHash(&row.maxDuration, sizeof(row.maxDuration));
+            feedHash(&row.remainTime, sizeof(row.remainTime));
+            feedHash(&row.effIndexMask, sizeof(row.effIndexMask));
 
-            stmt.addInt32(holder->GetAuraMaxDuration());
-            stmt.addInt32(holder->GetAuraDuration());
-            stmt.addUInt32(effIndexMask);
-            stmt.Execute();
+            rows.push_back(row);
         }
     }
+
+    if (rowsHash == m_lastSavedAuraHash && !m_session->isLogingOut())
+        return;
+
+    static SqlStatementID deleteAuraBlob;
+    static SqlStatementID insertAuraBlob;
+
+    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM character_aura WHERE guid = ?");
+    stmt.PExecute(GetGUIDLow());
+
+    SqlStatement blobStmt = CharacterDatabase.CreateStatement(deleteAuraBlob, "DELETE FROM character_aura_blob WHERE guid = ?");
+    blobStmt.PExecute(GetGUIDLow());
+
+    m_lastSavedAuraHash = rowsHash;
+
+    if (rows.empty())
+        return;
+
+    // pack the same rows into the per-character snapshot parsed at login
+    std::ostringstream blob;
+    for (AuraSaveRow const& row : rows)
+    {
+        blob << row.casterGuid << ' ' << row.itemGuid << ' ' << row.spellId << ' ' << row.stackAmount << ' ' << uint32(row.charges);
+
+        for (int32 i : row.damage)
+            blob << ' ' << i;
+
+        for (uint32 i : row.periodicTime)
+            blob << ' ' << i;
+
+        blob << ' ' << row.maxDuration << ' ' << row.remainTime << ' ' << row.effIndexMask << ' ';
+    }
+
+    blobStmt = CharacterDatabase.CreateStatement(insertAuraBlob, "INSERT INTO character_aura_blob (guid, version, data) VALUES (?, ?, ?)");
+    blobStmt.addUInt32(GetGUIDLow());
+    blobStmt.addUInt32(AURA_BLOB_VERSION);
+    blobStmt.addString(blob);
+    blobStmt.Execute();
+
+    stmt = CharacterDatabase.CreateStatement(insertAuras,
+        "INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, "
+        "basepoints0, basepoints1, basepoints2, periodictime0, periodictime1, periodictime2, maxduration, remaintime, effIndexMask) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+
+    for (AuraSaveRow const& row : rows)
+    {
+        stmt.addUInt32(GetGUIDLow());
+        stmt.addUInt64(row.casterGuid);
+        stmt.addUInt32(row.itemGuid);
+        stmt.addUInt32(row.spellId);
+        stmt.addUInt32(row.stackAmount);
+        stmt.addUInt8(row.charges);
+
+        for (int32 i : row.damage)
+            stmt.addInt32(i);
+
+        for (uint32 i : row.periodicTime)
+            stmt.addUInt32(i);
+
+        stmt.addInt32(row.maxDuration);
+        stmt.addInt32(row.remainTime);
+        stmt.addUInt32(row.effIndexMask);
+        stmt.Execute();
+    }
 }
 
 void Player::_SaveInventory()
@@ -16115,6 +16594,10 @@ void Player::_SaveInventory()
         m_items[i]->FSetState(ITEM_NEW);
     }
 
+    // settle pending elapsed time so the saved fields are current
+    MaterializeItemDurations();
+    MaterializeEnchantDurations();
+
 #ifdef ENABLE_PLAYERBOTS
     if (!GetPlayerbotAI())
     {
@@ -16182,18 +16665,23 @@ void Player::_SaveHonorCP()
                 itr->state = HK_DELETED;
                 break;
             case HK_NEW:
-                CharacterDatabase.PExecute(
-                    "INSERT INTO character_honor_cp (guid,victim_type,victim,honor,date,type) "
-                    " VALUES (%u,%u,%u,%f,%u,%u)",
-                    GetGUIDLow(),
-                    itr->victimType,
-                    itr->victimID,
-                    itr->honorPoints,
-                    itr->date,
-                    itr->type);
+            {
+                static SqlStatementID insertHonorCP;
+
+                SqlStatement stmt = CharacterDatabase.CreateStatement(insertHonorCP,
+                    "INSERT INTO character_honor_cp (guid,victim_type,victim,honor,date,type) VALUES (?, ?, ?, ?, ?, ?)");
+                stmt.addUInt32(GetGUIDLow());
+                stmt.addUInt8(itr->victimType);
+                stmt.addUInt32(itr->victimID);
+                stmt.addFloat(itr->honorPoints);
+                stmt.addUInt32(itr->date);
+                stmt.addUInt8(itr->type);
+                stmt.Execute();
+
                 itr->state = HK_UNCHANGED;
                 tempList.push_back(*itr);
                 break;
+            }
             case HK_UNCHANGED:
                 tempList.push_back(*itr);
                 break;
@@ -16569,13 +17057,19 @@ void Player::SendAttackSwingNotInRange() const
 
 void Player::SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, float z, float o, uint32 zone)
 {
-    std::ostringstream ss;
-    ss << "UPDATE characters SET position_x='" << x << "',position_y='" << y
-       << "',position_z='" << z << "',orientation='" << o << "',map='" << mapid
-       << "',zone='" << zone << "',trans_x='0',trans_y='0',trans_z='0',"
-       << "transguid='0',taxi_path='' WHERE guid='" << guid.GetCounter() << "'";
-    DEBUG_LOG("%s", ss.str().c_str());
-    CharacterDatabase.Execute(ss.str().c_str());
+    static SqlStatementID updatePosition;
+
+    SqlStatement stmt = CharacterDatabase.CreateStatement(updatePosition,
+        "UPDATE characters SET position_x = ?, position_y = ?, position_z = ?, orientation = ?, map = ?, zone = ?, "
+        "trans_x = 0, trans_y = 0, trans_z = 0, transguid = 0, taxi_path = '' WHERE guid = ?");
+    stmt.addFloat(x);
+    stmt.addFloat(y);
+    stmt.addFloat(z);
+    stmt.addFloat(o);
+    stmt.addUInt32(mapid);
+    stmt.addUInt32(zone);
+    stmt.addUInt32(guid.GetCounter());
+    stmt.Execute();
 }
 
 void Player::SetUInt32ValueInArray(Tokens& tokens, uint16 index, uint32 value)
@@ -17042,16 +17536,23 @@ void Player::AddSpellMod(SpellModifier* mod, bool apply)
         }
     }
 
+    SpellModOp modOp = mod->op;
     if (apply)
     {
-        m_spellMods[mod->op].push_back(mod);
-        m_spellMods[mod->op].sort(SpellModifierComparator());
+        m_spellMods[modOp].push_back(mod);
+        m_spellMods[modOp].sort(SpellModifierComparator());
     }
     else
     {
-        m_spellMods[mod->op].remove(mod);
+        m_spellMods[modOp].remove(mod);
         delete mod;
     }
+
+    // rebuild the aggregate affect mask for this op - ApplySpellMod tests it to skip lists that cannot match
+    ClassFamilyMask aggregateMask;
+    for (SpellModifier* modifier : m_spellMods[modOp])
+        aggregateMask |= modifier->mask;
+    m_spellModMask[modOp] = aggregateMask;
 }
 
 void Player::SendAllSpellMods(SpellModType modType)
@@ -17163,25 +17664,21 @@ void Player::RemovePetitionsAndSigns(ObjectGuid guid)
 {
     uint32 lowguid = guid.GetCounter();
 
-    auto queryResult = CharacterDatabase.PQuery("SELECT ownerguid,petitionguid FROM petition_sign WHERE playerguid = '%u'", lowguid);
-    if (queryResult)
+    std::vector<uint32> signedPetitions = sGuildMgr.RemovePetitionSignatures(guid);
+    if (!signedPetitions.empty())
     {
-        do // this part effectively does nothing, since the deletion / modification only takes place _after_ the PetitionQuery. Though I don't know if the result remains intact if I execute the delete query beforehand.
+        for (uint32 petitionLowGuid : signedPetitions)
         {
-            // and SendPetitionQueryOpcode reads data from the DB
-            Field* fields = queryResult->Fetch();
-            ObjectGuid ownerguid = ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32());
-            ObjectGuid petitionguid = ObjectGuid(HIGHGUID_ITEM, fields[1].GetUInt32());
-
             // send update if charter owner in game
-            Player* owner = sObjectMgr.GetPlayer(ownerguid);
-            if (owner)
-                owner->GetSession()->SendPetitionQueryOpcode(petitionguid);
-        } while (queryResult->NextRow());
+            if (Petition const* petition = sGuildMgr.GetPetition(petitionLowGuid))
+                if (Player* owner = sObjectMgr.GetPlayer(petition->ownerGuid))
+                    owner->GetSession()->SendPetitionQueryOpcode(ObjectGuid(HIGHGUID_ITEM, petitionLowGuid));
+        }
 
         CharacterDatabase.PExecute("DELETE FROM petition_sign WHERE playerguid = '%u'", lowguid);
     }
 
+    sGuildMgr.DeletePetitionsByOwner(guid);
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM petition WHERE ownerguid = '%u'", lowguid);
     CharacterDatabase.PExecute("DELETE FROM petition_sign WHERE ownerguid = '%u'", lowguid);
@@ -17222,6 +17719,7 @@ void Player::ResetMap()
             object->RemoveClientIAmAt(this);
     }
     m_clientGUIDs.clear();
+    m_questGameObjects.clear();
     Unit::ResetMap();
 }
 
@@ -17443,6 +17941,28 @@ int32 Player::GetTaxiPathSplineOffset() const
     return int32(m_taxiTracker.GetResumeWaypointIndex());
 }
 
+TaxiPathSplinePtr Player::GetTaxiPathBakedSpline() const
+{
+    Taxi::Map const& map = GetTaxiPathSpline();
+    Taxi::Route const& route = m_taxiTracker.GetRoute();
+
+    if (route.pathID >= sTaxiPathSplinesByPath.size())
+        return nullptr;
+
+    TaxiPathSplinePtr const& baked = sTaxiPathSplinesByPath[route.pathID];
+    if (!baked)
+        return nullptr;
+
+    // the baked points can stand in for the assembled leg only when the leg
+    // is exactly the whole path: stitched, trimmed or resumed-on-another-map
+    // legs differ and keep runtime assembly
+    TaxiPathNodeList const& nodes = sTaxiPathNodesByPath[route.pathID];
+    if (map.size() != nodes.size() || map.front() != nodes.front() || map.back() != nodes.back())
+        return nullptr;
+
+    return baked;
+}
+
 void Player::OnTaxiFlightStart(const TaxiPathEntry* /*path*/)
 {
 }
@@ -18031,12 +18551,16 @@ bool Player::CanJoinToBattleground() const
 void Player::AddAtClient(WorldObject* target)
 {
     m_clientGUIDs.insert(target->GetObjectGuid());
+    if (target->GetTypeId() == TYPEID_GAMEOBJECT && sObjectMgr.IsGameObjectForQuests(target->GetEntry()))
+        m_questGameObjects.insert(target->GetObjectGuid());
     target->AddClientIAmAt(this);
 }
 
 void Player::RemoveAtClient(WorldObject* target)
 {
     m_clientGUIDs.erase(target->GetObjectGuid());
+    if (target->GetTypeId() == TYPEID_GAMEOBJECT)
+        m_questGameObjects.erase(target->GetObjectGuid());
     target->RemoveClientIAmAt(this);
 }
 
@@ -18303,10 +18827,23 @@ void Player::SendInitialPacketsAfterAddToMap(bool reconnect)
     SendItemDurations();        // must be after add to map
 }
 
+void Player::OnGroupPositionBroadcast(float nearestRecipientDist)
+{
+    m_lastGroupPositionX = GetPositionX();
+    m_lastGroupPositionY = GetPositionY();
+    m_groupPositionNextUpdate = World::GetCurrentMSTime() + uint32(std::min(nearestRecipientDist, 1000.0f)) * GROUP_POSITION_MS_PER_YARD;
+}
+
 void Player::SendUpdateToOutOfRangeGroupMembers()
 {
     if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
         return;
+
+    // hold back pure position refreshes until the adaptive pause set by the
+    // last broadcast elapses - any other flagged change flushes immediately
+    if (m_groupUpdateMask == GROUP_UPDATE_FLAG_POSITION && World::GetCurrentMSTime() < m_groupPositionNextUpdate)
+        return;
+
     if (Group* group = GetGroup())
         group->UpdatePlayerOutOfRange(this);
 
@@ -18694,18 +19231,14 @@ bool Player::HasQuestForGO(int32 GOId) const
 
 void Player::UpdateForQuestWorldObjects()
 {
-    if (m_clientGUIDs.empty())
+    if (m_questGameObjects.empty())
         return;
 
     UpdateData updateData;
-    for (auto m_clientGUID : m_clientGUIDs)
+    for (auto guid : m_questGameObjects)
     {
-        if (m_clientGUID.IsGameObject())
-        {
-            if (GameObject* obj = GetMap()->GetGameObject(m_clientGUID))
-                if (sObjectMgr.IsGameObjectForQuests(obj->GetEntry()))
-                    obj->BuildValuesUpdateBlockForPlayerWithFlags(updateData, this, UF_FLAG_DYNAMIC);
-        }
+        if (GameObject* obj = GetMap()->GetGameObject(guid))
+            obj->BuildValuesUpdateBlockForPlayerWithFlags(updateData, this, UF_FLAG_DYNAMIC);
     }
     for (size_t i = 0; i < updateData.GetPacketCount(); ++i)
     {
@@ -18759,6 +19292,10 @@ void Player::SummonIfPossible(bool agree, ObjectGuid guid)
 
 void Player::RemoveItemDurations(Item* item)
 {
+    // bring the leaving item's duration field up to date first - it may be
+    // mailed, traded or saved from outside this player's tracking
+    MaterializeItemDurations();
+
     for (ItemDurationList::iterator itr = m_itemDuration.begin(); itr != m_itemDuration.end(); ++itr)
     {
         if (*itr == item)
@@ -18773,7 +19310,9 @@ void Player::AddItemDurations(Item* item)
 {
     if (item->GetUInt32Value(ITEM_FIELD_DURATION))
     {
+        MaterializeItemDurations();
         m_itemDuration.push_back(item);
+        m_itemDurationNext = std::min(m_itemDurationNext, item->GetUInt32Value(ITEM_FIELD_DURATION));
         item->SendTimeUpdate(this);
     }
 }
@@ -19282,7 +19821,7 @@ void Player::UpdateTerainEnvironmentFlags(Map* m, float x, float y, float z)
 {
     float collisionHeight = GetCollisionHeight();
     GridMapLiquidData liquid_status;
-    GridMapLiquidStatus res = m->GetTerrain()->getLiquidStatus(x, y, z, MAP_ALL_LIQUIDS, &liquid_status, collisionHeight);
+    GridMapLiquidStatus res = m->GetTerrain()->getLiquidStatus(GetLiquidCursor(), x, y, z, MAP_ALL_LIQUIDS, &liquid_status, collisionHeight);
     if (!res)
     {
         SetEnvironmentFlags(ENVIRONMENT_MASK_LIQUID_FLAGS, false);
@@ -20622,7 +21161,10 @@ void Player::_LoadCreatedInstanceTimers()
 
 void Player::_SaveNewInstanceIdTimer()
 {
-    CharacterDatabase.PExecute("DELETE FROM account_instances_entered WHERE AccountId = '%u'", m_session->GetAccountId());
+    static SqlStatementID deleteInstanceTimer;
+
+    SqlStatement delStmt = CharacterDatabase.CreateStatement(deleteInstanceTimer, "DELETE FROM account_instances_entered WHERE AccountId = ?");
+    delStmt.PExecute(m_session->GetAccountId());
 
     if (m_enteredInstances.empty())
         return;
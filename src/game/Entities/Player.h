@@ -41,6 +41,7 @@
 #include "Server/SQLStorages.h"
 #include "Loot/LootMgr.h"
 #include "Cinematics/CinematicMgr.h"
+#include "Globals/Conditions.h"
 #include "BattleGround/BattleGroundDefines.h"
 
 #include<vector>
@@ -691,6 +692,7 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOADGROUP,
     PLAYER_LOGIN_QUERY_LOADBOUNDINSTANCES,
     PLAYER_LOGIN_QUERY_LOADAURAS,
+    PLAYER_LOGIN_QUERY_LOADAURABLOB,
     PLAYER_LOGIN_QUERY_LOADSPELLS,
     PLAYER_LOGIN_QUERY_FORGOTTEN_SKILLS,
     PLAYER_LOGIN_QUERY_LOADQUESTSTATUS,
@@ -706,8 +708,7 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOADBGDATA,
     PLAYER_LOGIN_QUERY_LOADACCOUNTDATA,
     PLAYER_LOGIN_QUERY_LOADSKILLS,
-    PLAYER_LOGIN_QUERY_LOADMAILS,
-    PLAYER_LOGIN_QUERY_LOADMAILEDITEMS,
+    PLAYER_LOGIN_QUERY_LOADMAILSUMMARY,
     PLAYER_LOGIN_QUERY_LOADWEEKLYQUESTSTATUS,
 
     MAX_PLAYER_LOGIN_QUERY
@@ -1045,6 +1046,8 @@ class Player : public Unit
 
         Taxi::Map const& GetTaxiPathSpline() const;
         int32 GetTaxiPathSplineOffset() const;
+        // baked shared points for the current leg, null when the leg is not a whole single-map path
+        TaxiPathSplinePtr GetTaxiPathBakedSpline() const;
 
         void OnTaxiFlightStart(const TaxiPathEntry* path);
         void OnTaxiFlightEnd(const TaxiPathEntry* path);
@@ -1066,6 +1069,7 @@ class Player : public Unit
         bool ViableEquipSlots(ItemPrototype const* proto, uint8* viable_slots) const;
         uint8 FindEquipSlot(ItemPrototype const* proto, uint32 slot, bool swap) const;
         uint32 GetItemCount(uint32 item, bool inBankAlso = false, Item* skipItem = nullptr) const;
+        void InvalidateItemCountCache() { m_itemCountCacheDirty = true; }
         Item* GetItemByGuid(ObjectGuid guid) const;
         Item* GetItemByPos(uint16 pos) const;
         Item* GetItemByPos(uint8 bag, uint8 slot) const;
@@ -1187,6 +1191,10 @@ class Player : public Unit
 
         void UpdateEnchantTime(uint32 time);
         void UpdateItemDuration(uint32 time, bool realtimeonly = false);
+        // apply accumulated elapsed time to the duration lists and recompute
+        // the next expiry deadlines (see the gates in the Update* functions)
+        void MaterializeEnchantDurations();
+        void MaterializeItemDurations();
         void AddEnchantmentDurations(Item* item);
         void RemoveEnchantmentDurations(Item* item);
         void RemoveAllEnchantments(EnchantmentSlot slot);
@@ -1419,6 +1427,12 @@ class Player : public Unit
         PlayerMails::iterator GetMailBegin() { return m_mail.begin();}
         PlayerMails::iterator GetMailEnd() { return m_mail.end();}
 
+        // mailbox contents load lazily on first mailbox interaction; login only
+        // fetches the unread count and next delivery time
+        bool AreMailsLoaded() const { return m_mailsLoaded; }
+        void LoadMailsAsync();
+        void ApplyLoadedMails(SqlQueryHolder* holder);      // for call from mail load query callback
+
         /*********************************************************/
         /*** MAILED ITEMS SYSTEM ***/
         /*********************************************************/
@@ -1557,6 +1571,9 @@ class Player : public Unit
         static void RemoveFromGroup(Group* group, ObjectGuid guid, uint8 method = GROUP_LEAVE);
         void RemoveFromGroup(uint8 method = GROUP_LEAVE) { RemoveFromGroup(GetGroup(), GetObjectGuid(), method); }
         void SendUpdateToOutOfRangeGroupMembers();
+        // bookkeeping after a map dot refresh went out: remembers the broadcast
+        // position and scales the next refresh pause with the viewer distance
+        void OnGroupPositionBroadcast(float nearestRecipientDist);
 
         void SetInGuild(uint32 GuildId) { SetUInt32Value(PLAYER_GUILDID, GuildId); }
         void SetRank(uint32 rankId) { SetUInt32Value(PLAYER_GUILDRANK, rankId); }
@@ -1760,6 +1777,8 @@ class Player : public Unit
 
         ReputationMgr&       GetReputationMgr()       { return m_reputationMgr; }
         ReputationMgr const& GetReputationMgr() const { return m_reputationMgr; }
+        ConditionResultCache& GetConditionResultCache() const { return m_conditionResultCache; }
+        void InvalidateConditionCache() { m_conditionResultCache.Invalidate(); }
         ReputationRank GetReputationRank(uint32 faction_id) const;
         void RewardReputation(Creature* victim, float rate);
         void RewardReputation(Quest const* pQuest);
@@ -2277,13 +2296,16 @@ class Player : public Unit
         /*********************************************************/
 
         void _LoadActions(std::unique_ptr<QueryResult> queryResult);
-        void _LoadAuras(std::unique_ptr<QueryResult> queryResult, uint32 timediff);
+        void _LoadAuras(std::unique_ptr<QueryResult> blobResult, std::unique_ptr<QueryResult> rowResult, uint32 timediff);
+        bool _LoadAurasFromBlob(QueryResult* queryResult, uint32 timediff);
+        void _LoadAura(ObjectGuid casterGuid, uint32 itemLowGuid, uint32 spellid, uint32 stackcount, uint32 remaincharges, int32* damage, uint32 const* periodicTime, int32 maxduration, int32 remaintime, uint32 effIndexMask, uint32 timediff);
         void _LoadBoundInstances(std::unique_ptr<QueryResult> queryResult);
         void _LoadHonorCP(std::unique_ptr<QueryResult> queryResult);
         void _LoadInventory(std::unique_ptr<QueryResult> queryResult, uint32 timediff);
         void _LoadItemLoot(std::unique_ptr<QueryResult> queryResult);
         void _LoadMails(std::unique_ptr<QueryResult> queryResult);
         void _LoadMailedItems(std::unique_ptr<QueryResult> queryResult);
+        void _LoadMailSummary(std::unique_ptr<QueryResult> queryResult);
         void _LoadQuestStatus(std::unique_ptr<QueryResult> queryResult);
         void _LoadWeeklyQuestStatus(std::unique_ptr<QueryResult> queryResult);
         void _LoadGroup(std::unique_ptr<QueryResult> queryResult);
@@ -2353,6 +2375,8 @@ class Player : public Unit
 
         Team m_team;
         uint32 m_nextSave;
+        uint32 m_lastSavedCharacterHash;                    // bound-parameter hash of the characters row at last save
+        uint32 m_lastSavedAuraHash;                         // hash of the character_aura rows at last save
         time_t m_speakTime;
         uint32 m_speakCount;
         uint32 m_atLoginFlags;
@@ -2360,6 +2384,12 @@ class Player : public Unit
         Item* m_items[PLAYER_SLOTS_COUNT];
         uint32 m_currentBuybackSlot;
 
+        // per-entry item counts, rebuilt lazily on the first count query after an inventory mutation
+        void RebuildItemCountCache() const;
+        mutable std::unordered_map<uint32, uint32> m_itemCountCache;     // equipment, inventory, keyring and bag contents
+        mutable std::unordered_map<uint32, uint32> m_bankItemCountCache; // bank slots and bank bag contents
+        mutable bool m_itemCountCacheDirty;
+
         std::vector<Item*> m_itemUpdateQueue;
         bool m_itemUpdateQueueBlocked;
 
@@ -2373,19 +2403,34 @@ class Player : public Unit
         uint32 m_GuildIdInvited;
 
         PlayerMails m_mail;
+        bool m_mailsLoaded;                                 // mailbox contents fetched from DB (lazy, first mailbox use)
+        bool m_mailsLoadRequested;                          // lazy load query in flight
         PlayerSpellMap m_spells;
 
         ActionButtonList m_actionButtons;
 
+        // serialized spell list block of SMSG_INITIAL_SPELLS and body of
+        // SMSG_ACTION_BUTTONS, rebuilt only after learn/unlearn or button
+        // changes; the time-dependent cooldown section is built per send
+        mutable ByteBuffer m_initialSpellsCache;
+        mutable bool m_initialSpellsCacheStale;
+        mutable ByteBuffer m_actionButtonsCache;
+        mutable bool m_actionButtonsCacheStale;
+
         float m_auraBaseMod[BASEMOD_END][MOD_END];
 
         uint32 m_enchantmentFlatMod[MAX_ATTACK]; // TODO: Stat system - incorporate generically, exposes a required hidden weapon stat that does not apply when unarmed
 
         SpellModList m_spellMods[MAX_SPELLMOD];
+        ClassFamilyMask m_spellModMask[MAX_SPELLMOD];       // per-op OR of all active mod affect masks, rebuilt in AddSpellMod - lets ApplySpellMod skip ops that cannot match
         int32 m_SpellModRemoveCount;
         SpellFamily m_spellClassName; // s_spellClassSet
         EnchantDurationList m_enchantDuration;
         ItemDurationList m_itemDuration;
+        uint32 m_enchantPendingTime;                        // elapsed ms not yet applied to m_enchantDuration
+        uint32 m_enchantNextExpiry;                         // smallest leftduration at last materialization
+        uint32 m_itemDurationPending;                       // elapsed seconds not yet applied to m_itemDuration
+        uint32 m_itemDurationNext;                          // smallest remaining duration at last materialization
 
         ObjectGuid m_resurrectGuid;
         uint32 m_resurrectMap;
@@ -2410,6 +2455,7 @@ class Player : public Unit
         uint32 m_zoneUpdateTimer;
         uint32 m_areaUpdateId;
         uint32 m_positionStatusUpdateTimer;
+        uint32 m_slowTickTime;                              // accumulated time towards the next slow housekeeping sub-tick
 
         uint32 m_deathTimer;
         time_t m_deathExpireTime;
@@ -2442,6 +2488,9 @@ class Player : public Unit
         GroupReference m_originalGroup;
         Group* m_groupInvite;
         uint32 m_groupUpdateMask;
+        float m_lastGroupPositionX;                         // position of the last broadcast map dot refresh
+        float m_lastGroupPositionY;
+        uint32 m_groupPositionNextUpdate;                   // ms timestamp before which pure position refreshes are held back
 
         // Player summoning
         time_t m_summon_expire;
@@ -2548,6 +2597,9 @@ class Player : public Unit
 
         ReputationMgr  m_reputationMgr;
 
+        // memoized condition results, filled lazily during evaluation (see ConditionEntry::Meets)
+        mutable ConditionResultCache m_conditionResultCache;
+
         int32 m_cannotBeDetectedTimer;
 
         bool m_launched;
@@ -2556,6 +2608,10 @@ class Player : public Unit
         std::set<SpellModifierPair>* m_consumedMods;
 
         GuidSet m_clientGUIDs;
+        // visible gameobjects relevant for quest status updates - subset of
+        // m_clientGUIDs maintained by the visibility diffing, so the quest
+        // sparkle refresh does not have to walk the whole visible set
+        GuidSet m_questGameObjects;
 
         std::unordered_map<uint32, TimePoint> m_enteredInstances;
         uint32 m_createdInstanceClearTimer;
@@ -2594,6 +2650,8 @@ template <class T> void Player::ApplySpellMod(uint32 spellId, SpellModOp op, T&
 {
     SpellEntry const* spellInfo = sSpellTemplate.LookupEntry<SpellEntry>(spellId);
     if (!spellInfo || spellInfo->SpellFamilyName != GetSpellClass() || spellInfo->HasAttribute(SPELL_ATTR_EX3_IGNORE_CASTER_MODIFIERS)) return; // client condition
+    if (!spellInfo->IsFitToFamilyMask(m_spellModMask[op])) // no mod on this op can affect the spell - skip the whole list
+        return;
     int32 totalpct = 100;
     int32 totalflat = 0;
     std::vector<SpellModifier*> consumedFiniteMods;
@@ -2603,6 +2661,8 @@ template <class T> void Player::ApplySpellMod(uint32 spellId, SpellModOp op, T&
             if (T((basevalue + totalflat) * std::max(0, totalpct) / 100) <= 0)
                 break;
 
+        if (!spellInfo->IsFitToFamilyMask(mod->mask)) // cheap mask test first - avoids the spell template lookup in IsAffectedBySpellmod
+            continue;
         if (!IsAffectedBySpellmod(spellInfo, mod, m_consumedMods))
             continue;
         if (mod->type == SPELLMOD_FLAT)
@@ -76,17 +76,18 @@ void Player::UpdateSpellDamageBonus()
     // Magic damage modifiers implemented in Unit::SpellDamageBonusDone
     // This information for client side use only
     // Get damage bonus for all schools
+    uint32 bonuses[MAX_SPELL_SCHOOL - SPELL_SCHOOL_HOLY];
     for (int i = SPELL_SCHOOL_HOLY; i < MAX_SPELL_SCHOOL; ++i)
-        SetStatInt32Value(PLAYER_FIELD_MOD_DAMAGE_DONE_POS + i, SpellBaseDamageBonusDone(GetSchoolMask(i)));
+        bonuses[i - SPELL_SCHOOL_HOLY] = uint32(std::max(0, SpellBaseDamageBonusDone(GetSchoolMask(i))));
+    SetUInt32ValuesBulk(PLAYER_FIELD_MOD_DAMAGE_DONE_POS + SPELL_SCHOOL_HOLY, bonuses, MAX_SPELL_SCHOOL - SPELL_SCHOOL_HOLY);
 }
 
 bool Player::UpdateAllStats()
 {
+    uint32 stats[MAX_STATS];
     for (int i = STAT_STRENGTH; i < MAX_STATS; ++i)
-    {
-        float value = GetTotalStatValue(Stats(i));
-        SetStat(Stats(i), (int32)value);
-    }
+        stats[i] = uint32(std::max(0, int32(GetTotalStatValue(Stats(i)))));
+    SetUInt32ValuesBulk(UNIT_FIELD_STAT0, stats, MAX_STATS);
 
     UpdateAttackPowerAndDamage();
     UpdateAttackPowerAndDamage(true);
@@ -369,20 +370,18 @@ void Player::UpdateDamagePhysical(WeaponAttackType attType)
 
     CalculateMinMaxDamage(attType, false, mindamage, maxdamage);
 
+    float const damage[2] = { std::max(0.0f, mindamage), std::max(0.0f, maxdamage) };
     switch (attType)
     {
         case BASE_ATTACK:
         default:
-            SetStatFloatValue(UNIT_FIELD_MINDAMAGE, mindamage);
-            SetStatFloatValue(UNIT_FIELD_MAXDAMAGE, maxdamage);
+            SetFloatValuesBulk(UNIT_FIELD_MINDAMAGE, damage, 2);
             break;
         case OFF_ATTACK:
-            SetStatFloatValue(UNIT_FIELD_MINOFFHANDDAMAGE, mindamage);
-            SetStatFloatValue(UNIT_FIELD_MAXOFFHANDDAMAGE, maxdamage);
+            SetFloatValuesBulk(UNIT_FIELD_MINOFFHANDDAMAGE, damage, 2);
             break;
         case RANGED_ATTACK:
-            SetStatFloatValue(UNIT_FIELD_MINRANGEDDAMAGE, mindamage);
-            SetStatFloatValue(UNIT_FIELD_MAXRANGEDDAMAGE, maxdamage);
+            SetFloatValuesBulk(UNIT_FIELD_MINRANGEDDAMAGE, damage, 2);
             break;
     }
 }
@@ -768,28 +767,26 @@ void Creature::UpdateDamagePhysical(WeaponAttackType attType)
     mindamage *= conditionalMod;
     maxdamage *= conditionalMod;
 
-    uint16 fieldmin, fieldmax;
+    uint16 fieldmin;
 
     switch (attType)
     {
         case RANGED_ATTACK:
             fieldmin = UNIT_FIELD_MINRANGEDDAMAGE;
-            fieldmax = UNIT_FIELD_MAXRANGEDDAMAGE;
             break;
         case BASE_ATTACK:
             fieldmin = UNIT_FIELD_MINDAMAGE;
-            fieldmax = UNIT_FIELD_MAXDAMAGE;
             break;
         case OFF_ATTACK:
             fieldmin = UNIT_FIELD_MINOFFHANDDAMAGE;
-            fieldmax = UNIT_FIELD_MAXOFFHANDDAMAGE;
             break;
         default:
             return;
     }
 
-    SetStatFloatValue(fieldmin, mindamage);
-    SetStatFloatValue(fieldmax, maxdamage);
+    // min/max fields are adjacent for every attack type
+    float const damage[2] = { std::max(0.0f, mindamage), std::max(0.0f, maxdamage) };
+    SetFloatValuesBulk(fieldmin, damage, 2);
 }
 
 float Creature::GetConditionalTotalPhysicalDamageModifier(WeaponAttackType attType) const
@@ -79,6 +79,9 @@ bool Totem::Create(uint32 guidlow, CreatureCreatePos& cPos, CreatureInfo const*
 
 void Totem::Update(const uint32 diff)
 {
+    if (!ClaimUpdateTick())                                 // already ticked right behind the owner this map tick
+        return;
+
     Unit* owner = GetOwner();
     if (!owner || !owner->IsAlive() || !IsAlive())
     {
@@ -497,11 +497,47 @@ void GenericTransport::UpdatePosition(float x, float y, float z, float o)
 
 void GenericTransport::UpdatePassengerPositions(PassengerSet& passengers)
 {
+    if (passengers.empty())
+        return;
+
+    // grouped cell relocation - move everyone without firing the
+    // per-passenger visibility notifiers on every movement step
     for (const auto passenger : passengers)
-        UpdatePassengerPosition(passenger);
+        UpdatePassengerPosition(passenger, false);
+
+    // one combined visibility pass per transport per step - skipped entirely
+    // while no outside player can see us, apart from a slow heartbeat so
+    // passengers still refresh their own view of the world along the route
+    uint32 now = GetMap()->GetCurrentMSTime();
+    if (WorldTimer::getMSTimeDiff(m_lastPassengerNotify, now) < 2 * IN_MILLISECONDS && !HasExternalObservers())
+        return;
+
+    m_lastPassengerNotify = now;
+    for (const auto passenger : passengers)
+        if (passenger->IsInWorld() && passenger->IsUnit())
+            static_cast<Unit*>(passenger)->OnRelocated();
+}
+
+bool GenericTransport::HasExternalObservers() const
+{
+    float const dist = GetMap()->GetVisibilityDistance() + GetObjectBoundingRadius();
+    for (const auto& ref : GetMap()->GetPlayers())
+    {
+        Player* player = ref.getSource();
+        if (!player || !player->IsInWorld())
+            continue;
+
+        if (m_passengers.find(player) != m_passengers.end())
+            continue;
+
+        if (player->IsWithinDist3d(GetPositionX(), GetPositionY(), GetPositionZ(), dist))
+            return true;
+    }
+
+    return false;
 }
 
-void GenericTransport::UpdatePassengerPosition(WorldObject* passenger)
+void GenericTransport::UpdatePassengerPosition(WorldObject* passenger, bool notify)
 {
     // transport teleported but passenger not yet (can happen for players)
     if (passenger->IsInWorld() && passenger->GetMap() != GetMap())
@@ -531,7 +567,7 @@ void GenericTransport::UpdatePassengerPosition(WorldObject* passenger)
         {
             Creature* creature = dynamic_cast<Creature*>(passenger);
             if (passenger->IsInWorld())
-                GetMap()->CreatureRelocation(creature, x, y, z, o);
+                GetMap()->CreatureRelocation(creature, x, y, z, o, notify);
             else
                 passenger->Relocate(x, y, z, o);
             creature->m_movementInfo.t_time = GetPathProgress();
@@ -540,7 +576,7 @@ void GenericTransport::UpdatePassengerPosition(WorldObject* passenger)
         case TYPEID_PLAYER:
             //relocate only passengers in world and skip any player that might be still logging in/teleporting
             if (passenger->IsInWorld())
-                GetMap()->PlayerRelocation(dynamic_cast<Player*>(passenger), x, y, z, o);
+                GetMap()->PlayerRelocation(dynamic_cast<Player*>(passenger), x, y, z, o, notify);
             else
             {
                 passenger->Relocate(x, y, z, o);
@@ -30,13 +30,13 @@ typedef std::set<WorldObject*> PassengerSet;
 class GenericTransport : public GameObject
 {
     public:
-        GenericTransport() : m_passengerTeleportIterator(m_passengers.end()), m_pathProgress(0), m_movementStarted(0) {}
+        GenericTransport() : m_passengerTeleportIterator(m_passengers.end()), m_pathProgress(0), m_movementStarted(0), m_lastPassengerNotify(0) {}
         bool AddPassenger(Unit* passenger, bool adjustCoords = true);
         bool RemovePassenger(Unit* passenger);
         bool AddPetToTransport(Unit* passenger, Pet* pet);
 
         void UpdatePosition(float x, float y, float z, float o);
-        void UpdatePassengerPosition(WorldObject* object);
+        void UpdatePassengerPosition(WorldObject* object, bool notify = true);
 
         PassengerSet& GetPassengers() { return m_passengers; }
 
@@ -60,12 +60,15 @@ class GenericTransport : public GameObject
         uint32 GetPathProgress() const { return m_pathProgress; }
     protected:
         void UpdatePassengerPositions(PassengerSet& passengers);
+        // true when a player who is not aboard can currently see the transport
+        bool HasExternalObservers() const;
 
         PassengerSet m_passengers;
         PassengerSet::iterator m_passengerTeleportIterator;
 
         uint32 m_pathProgress; // for MO transport its full time since start for normal time in cycle
         uint32 m_movementStarted;
+        uint32 m_lastPassengerNotify; // last passenger visibility pass (ms time)
 };
 
 class ElevatorTransport : public GenericTransport
@@ -44,6 +44,7 @@
 #include "OutdoorPvP/OutdoorPvP.h"
 #include "Maps/GridDefines.h"
 #include "Grids/GridNotifiersImpl.h"
+#include "Util/TickArena.h"
 #include "Grids/CellImpl.h"
 #include "Maps/MapPersistentStateMgr.h"
 #include "MotionGenerators/MovementGenerator.h"
@@ -358,6 +359,7 @@ Unit::Unit() :
     // m_AurasCheck = 2000;
     // m_removeAuraTimer = 4;
     m_spellAuraHoldersUpdateIterator = m_spellAuraHolders.end();
+    m_procHolderMask = 0;
     m_AuraFlags = 0;
 
     m_Visibility = VISIBILITY_ON;
@@ -365,9 +367,15 @@ Unit::Unit() :
 
     m_transform = 0;
     m_canModifyStats = false;
+    m_statBatchDepth = 0;
+    m_dirtyStatMods = 0;
 
     for (auto& i : m_spellImmune)
         i.clear();
+    m_immuneSchoolMask = 0;
+    m_immuneDamageMask = 0;
+    m_immuneDispelMask = 0;
+    m_immuneMechanicMask = 0;
     for (auto& i : m_auraModifiersGroup)
     {
         i[BASE_VALUE] = 0.0f;
@@ -4152,6 +4160,8 @@ void Unit::_UpdateSpells(uint32 time)
     {
         SpellAuraHolder* i_holder = m_spellAuraHoldersUpdateIterator->second;
         ++m_spellAuraHoldersUpdateIterator;                 // need shift to next for allow update if need into aura update
+        if (!i_holder->IsTickUpdateNeeded())                // passive/permanent holders without periodic or area effects have no per-tick work
+            continue;
         i_holder->UpdateHolder(time);
 #ifdef BUILD_METRICS
         updatedSpellIds.push_back(i_holder->GetId());
@@ -4511,17 +4521,17 @@ bool Unit::isInAccessablePlaceFor(Unit const* unit) const
 
 bool Unit::IsInWater() const
 {
-    return GetTerrain()->IsInWater(GetPositionX(), GetPositionY(), GetPositionZ());
+    return GetTerrain()->IsInWater(GetLiquidCursor(), GetPositionX(), GetPositionY(), GetPositionZ());
 }
 
 bool Unit::IsInSwimmableWater() const
 {
-    return GetTerrain()->IsSwimmable(GetPositionX(), GetPositionY(), GetPositionZ());
+    return GetTerrain()->IsSwimmable(GetLiquidCursor(), GetPositionX(), GetPositionY(), GetPositionZ());
 }
 
 bool Unit::IsUnderwater() const
 {
-    return GetTerrain()->IsUnderWater(GetPositionX(), GetPositionY(), GetPositionZ());
+    return GetTerrain()->IsUnderWater(GetLiquidCursor(), GetPositionX(), GetPositionY(), GetPositionZ());
 }
 
 bool Unit::IsAboveGround(float diff) const
@@ -4893,6 +4903,16 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     holder->SetCreationDelayFlag();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
 
+    if (uint32 procFlags = holder->GetProcEventFlags())
+    {
+        // keep spell id order so proc handling order matches the old full-map walk
+        auto pos = m_procHolders.begin();
+        while (pos != m_procHolders.end() && (*pos)->GetId() <= holder->GetId())
+            ++pos;
+        m_procHolders.insert(pos, holder);
+        m_procHolderMask |= procFlags;
+    }
+
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
             AddAuraToModList(aur);
@@ -5393,6 +5413,17 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
         }
     }
 
+    if (holder->GetProcEventFlags())
+    {
+        auto pos = std::find(m_procHolders.begin(), m_procHolders.end(), holder);
+        if (pos != m_procHolders.end())
+            m_procHolders.erase(pos);
+
+        m_procHolderMask = 0;
+        for (SpellAuraHolder* procHolder : m_procHolders)
+            m_procHolderMask |= procHolder->GetProcEventFlags();
+    }
+
     holder->SetRemoveMode(mode);
     holder->UnregisterAndCleanupTrackedAuras();
 
@@ -5933,7 +5964,8 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage* log)
         }
     }
 
-    log->attacker->SendMessageToSet(data, true);
+    if (log->attacker->IsInWorld())
+        log->attacker->GetMap()->QueueCombatLogPacket(log->attacker, data);
 }
 
 void Unit::SendSpellNonMeleeDamageLog(WorldObject* attacker, Unit* target, uint32 spellID, uint32 damage, SpellSchoolMask damageSchoolMask, uint32 absorbedDamage, int32 resist, bool isPeriodic, uint32 blocked, bool criticalHit, bool split)
@@ -5993,7 +6025,9 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo) const
             return;
     }
 
-    aura->GetTarget()->SendMessageToSet(data, true);
+    Unit* auraTarget = aura->GetTarget();
+    if (auraTarget->IsInWorld())
+        auraTarget->GetMap()->QueueCombatLogPacket(auraTarget, data);
 }
 
 void Unit::SendSpellMiss(WorldObject* caster, Unit* target, uint32 spellID, SpellMissInfo missInfo)
@@ -6249,6 +6283,15 @@ void Unit::SetPowerType(Powers new_powertype)
     }
 }
 
+void Unit::setFaction(uint32 faction)
+{
+    SetUInt32Value(UNIT_FIELD_FACTIONTEMPLATE, faction);
+
+    // keep the per-cell faction index in step (charms, script faction swaps)
+    if (GetTypeId() == TYPEID_UNIT && IsInWorld())
+        GetMap()->UpdateFactionIndex(static_cast<Creature*>(this), faction);
+}
+
 FactionTemplateEntry const* Unit::GetFactionTemplateEntry() const
 {
     FactionTemplateEntry const* entry = sFactionTemplateStore.LookupEntry(GetFaction());
@@ -7370,19 +7413,8 @@ int32 Unit::SpellBaseHealingBonusTaken(SpellSchoolMask schoolMask) const
 
 bool Unit::IsImmuneToDamage(SpellSchoolMask shoolMask)
 {
-    // If m_immuneToSchool type contain this school type, IMMUNE damage.
-    SpellImmuneList const& schoolList = m_spellImmune[IMMUNITY_SCHOOL];
-    for (auto itr : schoolList)
-        if (itr.type & shoolMask)
-            return true;
-
-    // If m_immuneToDamage type contain magic, IMMUNE damage.
-    SpellImmuneList const& damageList = m_spellImmune[IMMUNITY_DAMAGE];
-    for (auto itr : damageList)
-        if (itr.type & shoolMask)
-            return true;
-
-    return false;
+    // school and damage immunity, pre-aggregated in ApplySpellImmune
+    return ((m_immuneSchoolMask | m_immuneDamageMask) & shoolMask) != 0;
 }
 
 bool Unit::IsImmuneToSpell(SpellEntry const* spellInfo, bool /*castOnSelf*/, uint8 effectMask, WorldObject const* caster)
@@ -7393,11 +7425,15 @@ bool Unit::IsImmuneToSpell(SpellEntry const* spellInfo, bool /*castOnSelf*/, uin
     // TODO add spellEffect immunity checks!, player with flag in bg is immune to immunity buffs from other friendly players!
     // SpellImmuneList const& dispelList = m_spellImmune[IMMUNITY_EFFECT];
 
-    SpellImmuneList const& dispelList = m_spellImmune[IMMUNITY_DISPEL];
-    for (auto itr : dispelList)
-        if (itr.type == spellInfo->Dispel)
-            return true;
+    if (spellInfo->Dispel >= 32 || (m_immuneDispelMask & (1 << spellInfo->Dispel)))
+    {
+        SpellImmuneList const& dispelList = m_spellImmune[IMMUNITY_DISPEL];
+        for (auto itr : dispelList)
+            if (itr.type == spellInfo->Dispel)
+                return true;
+    }
 
+    if (m_immuneSchoolMask & GetSpellSchoolMask(spellInfo))
     {
         bool isPositive = IsPositiveEffectMask(spellInfo, effectMask, caster, this);
         if (IsAuraApplyEffects(spellInfo, SpellEffectIndexMask(effectMask)))
@@ -7413,10 +7449,13 @@ bool Unit::IsImmuneToSpell(SpellEntry const* spellInfo, bool /*castOnSelf*/, uin
 
     if (uint32 mechanic = spellInfo->Mechanic)
     {
-        SpellImmuneList const& mechanicList = m_spellImmune[IMMUNITY_MECHANIC];
-        for (auto itr : mechanicList)
-            if (itr.type == mechanic)
-                return true;
+        if (mechanic > 64 || (m_immuneMechanicMask & (uint64(1) << (mechanic - 1))))
+        {
+            SpellImmuneList const& mechanicList = m_spellImmune[IMMUNITY_MECHANIC];
+            for (auto itr : mechanicList)
+                if (itr.type == mechanic)
+                    return true;
+        }
 
         AuraList const& immuneAuraApply = GetAurasByType(SPELL_AURA_MECHANIC_IMMUNITY_MASK);
         for (auto iter : immuneAuraApply)
@@ -7441,10 +7480,13 @@ bool Unit::IsImmuneToSpellEffect(SpellEntry const* spellInfo, SpellEffectIndex i
 
     if (uint32 mechanic = spellInfo->EffectMechanic[index])
     {
-        SpellImmuneList const& mechanicList = m_spellImmune[IMMUNITY_MECHANIC];
-        for (auto itr : mechanicList)
-            if (itr.type == mechanic)
-                return true;
+        if (mechanic > 64 || (m_immuneMechanicMask & (uint64(1) << (mechanic - 1))))
+        {
+            SpellImmuneList const& mechanicList = m_spellImmune[IMMUNITY_MECHANIC];
+            for (auto itr : mechanicList)
+                if (itr.type == mechanic)
+                    return true;
+        }
 
         AuraList const& immuneAuraApply = GetAurasByType(SPELL_AURA_MECHANIC_IMMUNITY_MASK);
         for (auto iter : immuneAuraApply)
@@ -7464,6 +7506,9 @@ bool Unit::IsImmuneToSpellEffect(SpellEntry const* spellInfo, SpellEffectIndex i
 
 bool Unit::IsImmuneToSchool(SpellEntry const* spellInfo, uint8 effectMask) const
 {
+    if (!(m_immuneSchoolMask & GetSpellSchoolMask(spellInfo)))
+        return false;
+
     SpellImmuneList const& schoolList = m_spellImmune[IMMUNITY_SCHOOL];
     for (auto itr : schoolList)
     {
@@ -7751,6 +7796,37 @@ void Unit::ApplySpellImmune(Aura const* aura, uint32 op, uint32 type, bool apply
             }
         }
     }
+
+    RebuildSpellImmunityCache(op);
+}
+
+void Unit::RebuildSpellImmunityCache(uint32 op)
+{
+    switch (op)
+    {
+        case IMMUNITY_SCHOOL:
+            m_immuneSchoolMask = 0;
+            for (auto const& itr : m_spellImmune[IMMUNITY_SCHOOL])
+                m_immuneSchoolMask |= itr.type;
+            break;
+        case IMMUNITY_DAMAGE:
+            m_immuneDamageMask = 0;
+            for (auto const& itr : m_spellImmune[IMMUNITY_DAMAGE])
+                m_immuneDamageMask |= itr.type;
+            break;
+        case IMMUNITY_DISPEL:
+            m_immuneDispelMask = 0;
+            for (auto const& itr : m_spellImmune[IMMUNITY_DISPEL])
+                m_immuneDispelMask |= itr.type < 32 ? (1 << itr.type) : ~uint32(0);
+            break;
+        case IMMUNITY_MECHANIC:
+            m_immuneMechanicMask = 0;
+            for (auto const& itr : m_spellImmune[IMMUNITY_MECHANIC])
+                m_immuneMechanicMask |= (itr.type && itr.type <= 64) ? (uint64(1) << (itr.type - 1)) : ~uint64(0);
+            break;
+        default:                                            // effect and state lists are matched by exact id, not maskable
+            break;
+    }
 }
 
 void Unit::ApplySpellDispelImmunity(const Aura* aura, DispelType type, bool apply)
@@ -8552,6 +8628,8 @@ void Unit::SetSpeedRate(UnitMoveType mtype, float rate, bool forced)
 
         propagateSpeedChange();
 
+        InvalidateCreateBlockCache();               // speeds are serialized into the cached create block
+
         const SpeedOpcodePair& speedOpcodes = SetSpeed2Opc_table[mtype];
 
         if (forced && IsClientControlled())
@@ -9060,6 +9138,20 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
     if (!CanModifyStats())
         return false;
 
+    // while a batch window is open only mark the node dirty; max health and max power
+    // stay immediate because aura handlers read them back within the same window
+    if (m_statBatchDepth && (unitMod < UNIT_MOD_HEALTH || unitMod > UNIT_MOD_HAPPINESS))
+    {
+        m_dirtyStatMods |= (1 << unitMod);
+        return true;
+    }
+
+    UpdateDependentStats(unitMod);
+    return true;
+}
+
+void Unit::UpdateDependentStats(UnitMods unitMod)
+{
     switch (unitMod)
     {
         case UNIT_MOD_STAT_STRENGTH:
@@ -9094,8 +9186,38 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
         default:
             break;
     }
+}
 
-    return true;
+void Unit::EndStatBatch()
+{
+    MANGOS_ASSERT(m_statBatchDepth);
+    if (--m_statBatchDepth == 0 && m_dirtyStatMods)
+        FlushDirtyStats();
+}
+
+void Unit::FlushDirtyStats()
+{
+    uint32 mask = m_dirtyStatMods;
+    m_dirtyStatMods = 0;
+
+    if (!mask || !CanModifyStats())
+        return;
+
+    uint32 const statMask = mask & ((1 << UNIT_MOD_STAT_END) - 1);
+    if (statMask & (statMask - 1))                          // several primary stats changed: one full pass is cheaper
+    {
+        UpdateAllStats();
+        return;
+    }
+
+    // the player UpdateStats cascade already refreshes attack power and weapon damage
+    if (statMask && GetTypeId() == TYPEID_PLAYER)
+        mask &= ~((1 << UNIT_MOD_ATTACK_POWER) | (1 << UNIT_MOD_ATTACK_POWER_RANGED) |
+                  (1 << UNIT_MOD_DAMAGE_MAINHAND) | (1 << UNIT_MOD_DAMAGE_OFFHAND) | (1 << UNIT_MOD_DAMAGE_RANGED));
+
+    for (uint32 i = 0; i < UNIT_MOD_END; ++i)
+        if (mask & (1 << i))
+            UpdateDependentStats(UnitMods(i));
 }
 
 float Unit::GetModifierValue(UnitMods unitMod, UnitModifierType modifierType) const
@@ -10412,10 +10534,10 @@ void Unit::UpdateReactives(uint32 p_time)
 
 Unit* Unit::SelectRandomUnfriendlyTarget(Unit* except /*= nullptr*/, float radius /*= ATTACK_DISTANCE*/) const
 {
-    UnitList targets;
+    MaNGOS::TickList<Unit*> targets;
 
     MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck u_check(this, radius);
-    MaNGOS::UnitListSearcher<MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck> searcher(targets, u_check);
+    MaNGOS::UnitListSearcher<MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck, MaNGOS::TickList<Unit*>> searcher(targets, u_check);
     Cell::VisitAllObjects(this, searcher, radius);
 
     // remove current target
@@ -10423,11 +10545,11 @@ Unit* Unit::SelectRandomUnfriendlyTarget(Unit* except /*= nullptr*/, float radiu
         targets.remove(except);
 
     // remove not LoS targets
-    for (UnitList::iterator tIter = targets.begin(); tIter != targets.end();)
+    for (auto tIter = targets.begin(); tIter != targets.end();)
     {
         if (!IsWithinLOSInMap(*tIter, true))
         {
-            UnitList::iterator tIter2 = tIter;
+            auto tIter2 = tIter;
             ++tIter;
             targets.erase(tIter2);
         }
@@ -10441,7 +10563,7 @@ Unit* Unit::SelectRandomUnfriendlyTarget(Unit* except /*= nullptr*/, float radiu
 
     // select random
     uint32 rIdx = urand(0, targets.size() - 1);
-    UnitList::const_iterator tcIter = targets.begin();
+    auto tcIter = targets.begin();
     for (uint32 i = 0; i < rIdx; ++i)
         ++tcIter;
 
@@ -10450,10 +10572,10 @@ Unit* Unit::SelectRandomUnfriendlyTarget(Unit* except /*= nullptr*/, float radiu
 
 Unit* Unit::SelectRandomFriendlyTarget(Unit* except /*= nullptr*/, float radius /*= ATTACK_DISTANCE*/) const
 {
-    UnitList targets;
+    MaNGOS::TickList<Unit*> targets;
 
     MaNGOS::AnySpellAssistableUnitInObjectRangeCheck u_check(this, nullptr, radius);
-    MaNGOS::UnitListSearcher<MaNGOS::AnySpellAssistableUnitInObjectRangeCheck> searcher(targets, u_check);
+    MaNGOS::UnitListSearcher<MaNGOS::AnySpellAssistableUnitInObjectRangeCheck, MaNGOS::TickList<Unit*>> searcher(targets, u_check);
 
     Cell::VisitAllObjects(this, searcher, radius);
 
@@ -10462,11 +10584,11 @@ Unit* Unit::SelectRandomFriendlyTarget(Unit* except /*= nullptr*/, float radius
         targets.remove(except);
 
     // remove not LoS targets
-    for (UnitList::iterator tIter = targets.begin(); tIter != targets.end();)
+    for (auto tIter = targets.begin(); tIter != targets.end();)
     {
         if (!IsWithinLOSInMap(*tIter, true))
         {
-            UnitList::iterator tIter2 = tIter;
+            auto tIter2 = tIter;
             ++tIter;
             targets.erase(tIter2);
         }
@@ -10480,7 +10602,7 @@ Unit* Unit::SelectRandomFriendlyTarget(Unit* except /*= nullptr*/, float radius
 
     // select random
     uint32 rIdx = urand(0, targets.size() - 1);
-    UnitList::const_iterator tcIter = targets.begin();
+    auto tcIter = targets.begin();
     for (uint32 i = 0; i < rIdx; ++i)
         ++tcIter;
 
@@ -10975,24 +11097,34 @@ SpellAuraHolder* Unit::GetSpellAuraHolder(uint32 spellid, ObjectGuid casterGuid)
 class UnitVisitObjectsInRangeNotifyEvent : public BasicEvent
 {
     public:
-        UnitVisitObjectsInRangeNotifyEvent(Unit& owner) : BasicEvent(), m_owner(owner) {}
+        UnitVisitObjectsInRangeNotifyEvent(Unit& owner, bool distanceGated) : BasicEvent(), m_owner(owner), m_distanceGated(distanceGated) {}
+
+        void ClearDistanceGate() { m_distanceGated = false; }
 
         bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
         {
-            float radius = std::max(m_owner.GetDetectionRange(), uint32(MAX_CREATURE_ATTACK_RADIUS)) * sWorld.getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO);
-            if (m_owner.IsPlayer())
+            // movement-triggered events are dropped while the accumulated
+            // displacement since the last executed visit stays below the
+            // configured threshold; the next relocation re-arms the event
+            if (m_distanceGated && !m_owner.HasAINotifyDisplacement())
             {
-                MaNGOS::PlayerVisitObjectsNotifier notify(static_cast<Player&>(m_owner));
-                Cell::VisitAllObjects(&m_owner, notify, radius);
+                m_owner.FinalizeAINotifyEvent();
+                return true;
             }
-            else // if(m_owner.GetTypeId() == TYPEID_UNIT)
+            m_owner.StoreAINotifiedPosition();
+
+            float radius = std::max(m_owner.GetDetectionRange(), uint32(MAX_CREATURE_ATTACK_RADIUS)) * sWorld.getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO);
+            bool const isPlayer = m_owner.IsPlayer();
+            if (!isPlayer)
             {
+                //since the scan runs we override can aggro with true if creature is alive
                 Creature& creature = static_cast<Creature&>(m_owner);
-                //since visitor was called we override can aggro with true if creature is alive
                 creature.SetCanAggro(creature.IsAlive());
-                MaNGOS::CreatureVisitObjectsNotifier notify(creature);
-                Cell::VisitAllObjects(&m_owner, notify, radius);
             }
+
+            if (m_owner.IsInWorld() && m_owner.IsAlive() && !(isPlayer && static_cast<Player&>(m_owner).IsTaxiFlying()))
+                VisitNearbyUnits(radius);
+
             m_owner.FinalizeAINotifyEvent();
             return true;
         }
@@ -11003,22 +11135,147 @@ class UnitVisitObjectsInRangeNotifyEvent : public BasicEvent
         }
 
     private:
+        // gathers unit candidates from the shared per-tick cell snapshots and
+        // batches the distance cut over packed positions, so only units truly
+        // within the notify radius reach the per-pair AI virtual dispatch -
+        // the cell area otherwise over-covers the radius by more than half
+        void VisitNearbyUnits(float radius)
+        {
+            Map* map = m_owner.GetMap();
+            bool const isPlayer = m_owner.IsPlayer();
+            bool const ownerHasAI = m_owner.AI() != nullptr;
+
+            // map updates run one map per worker, so per-thread scratch
+            // buffers make the scan allocation-free in steady state
+            static thread_local std::vector<Unit*> candidates;
+            static thread_local std::vector<float> xs, ys, zs, reach;
+            static thread_local std::vector<uint8> within;
+            candidates.clear();
+
+            CellArea area = Cell::CalculateCellArea(m_owner.GetPositionX(), m_owner.GetPositionY(), radius);
+            for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+                for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+                    for (WorldObject* object : map->GetCellSnapshot(CellPair(x, y)).objects)
+                    {
+                        if (object->IsUnit() && object != &m_owner)
+                            candidates.push_back(static_cast<Unit*>(object));
+                        else if (object->IsGameObject())    // dormant traps wait for exactly this movement notification
+                            static_cast<GameObject*>(object)->OnUnitRelocation(&m_owner);
+                    }
+
+            size_t const count = candidates.size();
+            xs.resize(count);
+            ys.resize(count);
+            zs.resize(count);
+            reach.resize(count);
+            within.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Unit* unit = candidates[i];
+                xs[i] = unit->GetPositionX();
+                ys[i] = unit->GetPositionY();
+                zs[i] = unit->GetPositionZ();
+                reach[i] = unit->GetCombatReach();
+            }
+
+            // flat indexed float math the compiler can vectorize; the combat
+            // reach slack mirrors IsWithinDist so no borderline pair is lost
+            float const ox = m_owner.GetPositionX();
+            float const oy = m_owner.GetPositionY();
+            float const oz = m_owner.GetPositionZ();
+            float const ownerReach = m_owner.GetCombatReach();
+            for (size_t i = 0; i < count; ++i)
+            {
+                float const dx = xs[i] - ox;
+                float const dy = ys[i] - oy;
+                float const dz = zs[i] - oz;
+                float const limit = radius + ownerReach + reach[i];
+                within[i] = uint8(dx * dx + dy * dy + dz * dz <= limit * limit);
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!within[i])
+                    continue;
+
+                Unit* who = candidates[i];
+                if (!who->IsInWorld())
+                    continue;
+
+                if (isPlayer)
+                {
+                    Player& player = static_cast<Player&>(m_owner);
+                    if (who->IsCreature())
+                    {
+                        Creature* creature = static_cast<Creature*>(who);
+                        if (!creature->IsAlive())
+                            continue;
+
+                        creature->OnPlayerProximity();      // restore full AI tick rate
+
+                        UnitVisitObjectsNotifierWorker(creature, &player);
+                        if (ownerHasAI)
+                            UnitVisitObjectsNotifierWorker(&player, creature);
+                    }
+                    else if (who->IsPlayer())
+                    {
+                        Player* other = static_cast<Player*>(who);
+                        if (other->IsAlive() && !other->IsTaxiFlying())
+                            continue;
+
+                        if (other->AI())
+                            UnitVisitObjectsNotifierWorker(other, &player);
+                        if (ownerHasAI)
+                            UnitVisitObjectsNotifierWorker(&player, other);
+                    }
+                }
+                else
+                {
+                    Creature& creature = static_cast<Creature&>(m_owner);
+                    if (who->IsPlayer())
+                    {
+                        Player* player = static_cast<Player*>(who);
+                        if (!player->IsAlive() || player->IsTaxiFlying())
+                            continue;
+
+                        creature.OnPlayerProximity();       // restore full AI tick rate
+
+                        if (player->AI())
+                            UnitVisitObjectsNotifierWorker(player, &creature);
+                        UnitVisitObjectsNotifierWorker(&creature, player);
+                    }
+                    else if (who->IsCreature())
+                    {
+                        Creature* other = static_cast<Creature*>(who);
+                        if (!other->IsAlive())
+                            continue;
+
+                        UnitVisitObjectsNotifierWorker(other, &creature);
+                        UnitVisitObjectsNotifierWorker(&creature, other);
+                    }
+                }
+            }
+        }
+
         Unit & m_owner;
+        bool m_distanceGated;
 };
 
-void Unit::ScheduleAINotify(uint32 delay, bool forced)
+void Unit::ScheduleAINotify(uint32 delay, bool forced, bool distanceGated)
 {
     if (!IsAINotifyScheduled())
     {
-        m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this);
+        m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this, distanceGated);
         m_events.AddEvent(m_AINotifyEvent, m_events.CalculateTime(delay));
     }
     else if (forced)
     {
         m_events.KillEvent(m_AINotifyEvent);
-        m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this);
+        m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this, distanceGated);
         m_events.AddEvent(m_AINotifyEvent, m_events.CalculateTime(delay));
     }
+    else if (!distanceGated)                                // state-driven request must not be dropped by a pending gated event
+        static_cast<UnitVisitObjectsInRangeNotifyEvent*>(m_AINotifyEvent)->ClearDistanceGate();
 }
 
 void Unit::AbortAINotifyEvent()
@@ -11046,7 +11303,22 @@ void Unit::OnRelocated()
         GetViewPoint().Call_UpdateVisibilityForOwner();
         UpdateObjectVisibility();
     }
-    ScheduleAINotify(World::GetRelocationAINotifyDelay());
+    ScheduleAINotify(World::GetRelocationAINotifyDelay(), false, true);
+}
+
+bool Unit::HasAINotifyDisplacement() const
+{
+    float dx = m_last_ai_notified_position.x - GetPositionX();
+    float dy = m_last_ai_notified_position.y - GetPositionY();
+    float dz = m_last_ai_notified_position.z - GetPositionZ();
+    return dx * dx + dy * dy + dz * dz > World::GetRelocationAILowerLimitSq();
+}
+
+void Unit::StoreAINotifiedPosition()
+{
+    m_last_ai_notified_position.x = GetPositionX();
+    m_last_ai_notified_position.y = GetPositionY();
+    m_last_ai_notified_position.z = GetPositionZ();
 }
 
 void Unit::UpdateSplineMovement(uint32 t_diff)
@@ -11852,9 +12124,12 @@ void Unit::InterruptSpellsCastedOnMe(bool killDelayed)
 {
     UnitList targets;
     // Maximum spellInfo range=100m ?
-    MaNGOS::AnyUnitInObjectRangeCheck u_check(this, 100.0f);
-    MaNGOS::UnitListSearcher<MaNGOS::AnyUnitInObjectRangeCheck> searcher(targets, u_check);
-    Cell::VisitAllObjects(this, searcher, GetMap()->GetVisibilityDistance());
+    // packed mirror prescan first, the exact range check runs on survivors only
+    std::vector<Unit*> candidates;
+    GetMap()->ScanSnapshotUnitsInRange(GetPositionX(), GetPositionY(), GetPositionZ(), 100.0f, GetCombatReach(), candidates);
+    for (Unit* candidate : candidates)
+        if (candidate->IsAlive() && IsWithinDistInMap(candidate, 100.0f))
+            targets.push_back(candidate);
     for (auto& target : targets)
     {
         if (!CanAttack(target))
@@ -11867,11 +12142,16 @@ void Unit::InterruptSpellsCastedOnMe(bool killDelayed)
         if (!killDelayed)
             continue;
         // 2/ Interrupt spells that are not referenced but that still have an event (like delayed spellInfo)
-        for (auto i_events = target->m_events.GetEvents().begin(); i_events != target->m_events.GetEvents().end(); ++i_events)
-            if (SpellEvent* event = dynamic_cast<SpellEvent*>(i_events->second))
-                if (event && event->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
+        std::vector<Spell*> spellsToCancel;
+        target->m_events.VisitEvents([&](BasicEvent* basicEvent)
+        {
+            if (SpellEvent* event = dynamic_cast<SpellEvent*>(basicEvent))
+                if (event->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
                     if (event->GetSpell()->getState() != SPELL_STATE_FINISHED)
-                        event->GetSpell()->cancel();
+                        spellsToCancel.push_back(event->GetSpell());
+        });
+        for (Spell* spell : spellsToCancel)
+            spell->cancel();
     }
 }
 
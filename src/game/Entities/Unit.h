@@ -28,6 +28,7 @@
 
 #include "Common.h"
 #include "Entities/Object.h"
+#include "Entities/ObjectPool.h"
 #include "Server/Opcodes.h"
 #include "Spells/SpellAuraDefines.h"
 #include "AI/BaseAI/CreatureAI.h"
@@ -1073,7 +1074,10 @@ class Unit : public WorldObject
 {
     public:
         typedef std::set<Unit*> AttackerSet;
-        typedef std::multimap<uint32 /*spellId*/, SpellAuraHolder*> SpellAuraHolderMap;
+        // aura churn allocates/frees a node per applied holder; routing the nodes
+        // through the spawn pool keeps them recycled and cache warm
+        typedef std::multimap<uint32 /*spellId*/, SpellAuraHolder*, std::less<uint32>,
+                MaNGOS::PoolAllocator<std::pair<uint32 const, SpellAuraHolder*>>> SpellAuraHolderMap;
         typedef std::pair<SpellAuraHolderMap::iterator, SpellAuraHolderMap::iterator> SpellAuraHolderBounds;
         typedef std::pair<SpellAuraHolderMap::const_iterator, SpellAuraHolderMap::const_iterator> SpellAuraHolderConstBounds;
         typedef std::list<SpellAuraHolder*> SpellAuraHolderList;
@@ -1361,7 +1365,7 @@ class Unit : public WorldObject
 
         // faction template id
         uint32 GetFaction() const override { return GetUInt32Value(UNIT_FIELD_FACTIONTEMPLATE); }
-        void setFaction(uint32 faction) { SetUInt32Value(UNIT_FIELD_FACTIONTEMPLATE, faction); }
+        void setFaction(uint32 faction);                    // also refreshes the map's per-cell faction index for creatures
         FactionTemplateEntry const* GetFactionTemplateEntry() const;
         void RestoreOriginalFaction();
         bool IsNeutralToAll() const;
@@ -2015,6 +2019,12 @@ class Unit : public WorldObject
         Powers GetPowerTypeByAuraGroup(UnitMods unitMod) const;
         bool CanModifyStats() const { return m_canModifyStats; }
         void SetCanModifyStats(bool modifyStats) { m_canModifyStats = modifyStats; }
+        // batch window for stat modifier waves: while open, HandleStatModifier only marks
+        // the touched UnitMods dirty and the dependent values are recomputed once on close
+        void BeginStatBatch() { ++m_statBatchDepth; }
+        void EndStatBatch();
+        void UpdateDependentStats(UnitMods unitMod);
+        void FlushDirtyStats();
 
         static float GetHealthBonusFromStamina(float stamina);
         virtual float GetHealthBonusFromStamina() const;
@@ -2068,6 +2078,13 @@ class Unit : public WorldObject
         TrackedAuraTargetMap&       GetTrackedAuraTargets(TrackedAuraType type)       { return m_trackedAuraTargets[type]; }
         TrackedAuraTargetMap const& GetTrackedAuraTargets(TrackedAuraType type) const { return m_trackedAuraTargets[type]; }
         SpellImmuneList m_spellImmune[MAX_SPELL_IMMUNITY];
+        // aggregated immunity masks, rebuilt whenever ApplySpellImmune touches
+        // the backing list - the per-hit checks read one integer and only walk
+        // the list when the mask already says a matching entry exists
+        uint32 m_immuneSchoolMask;                          // OR of IMMUNITY_SCHOOL entry school masks
+        uint32 m_immuneDamageMask;                          // OR of IMMUNITY_DAMAGE entry school masks
+        uint32 m_immuneDispelMask;                          // bit per DispelType
+        uint64 m_immuneMechanicMask;                        // bit per (mechanic - 1); all bits when a mechanic does not fit
         bool IsAOEImmune() const { return m_aoeImmune; }
         void SetAOEImmune(bool state) { m_aoeImmune = state; }
         bool IsChainImmune() const { return m_chainImmune; }
@@ -2220,6 +2237,7 @@ class Unit : public WorldObject
 
         void ApplySpellImmune(Aura const* aura, uint32 op, uint32 type, bool apply);
         void ApplySpellDispelImmunity(Aura const* aura, DispelType type, bool apply);
+        void RebuildSpellImmunityCache(uint32 op);
         virtual bool IsImmuneToSpell(SpellEntry const* spellInfo, bool castOnSelf, uint8 effectMask, WorldObject const* caster);
         virtual bool IsImmuneToDamage(SpellSchoolMask meleeSchoolMask);
         virtual bool IsImmuneToSpellEffect(SpellEntry const* spellInfo, SpellEffectIndex index, bool castOnSelf) const;
@@ -2341,10 +2359,21 @@ class Unit : public WorldObject
         // Movement info
         Movement::MoveSpline* movespline;
 
-        void ScheduleAINotify(uint32 delay, bool forced = false);
+        // terrain tile of the last height query for this mover; mutable so the
+        // const position-adjust helpers can refresh it
+        TerrainInfo::TerrainCursor& GetTerrainCursor() const { return m_terrainCursor; }
+
+        // last liquid queries for this mover (swim state, breath timers)
+        TerrainInfo::LiquidCursor& GetLiquidCursor() const { return m_liquidCursor; }
+
+        // distanceGated: the event may be dropped when the unit has not moved
+        // far enough since its last executed AI notify (movement jitter)
+        void ScheduleAINotify(uint32 delay, bool forced = false, bool distanceGated = false);
         bool IsAINotifyScheduled() const { return m_AINotifyEvent != nullptr;}
         void FinalizeAINotifyEvent() { m_AINotifyEvent = nullptr; }
         void AbortAINotifyEvent();
+        bool HasAINotifyDisplacement() const;
+        void StoreAINotifiedPosition();
         void OnRelocated();
 
         bool IsLinkingEventTrigger() { return m_isCreatureLinkingTrigger; }
@@ -2451,6 +2480,9 @@ class Unit : public WorldObject
     protected:
         bool MeetsSelectAttackingRequirement(Unit* target, SpellEntry const* spellInfo, uint32 selectFlags, SelectAttackingTargetParams params, int32 unitConditionId) const;
 
+        mutable TerrainInfo::TerrainCursor m_terrainCursor;
+        mutable TerrainInfo::LiquidCursor m_liquidCursor;
+
         struct WeaponDamageInfo
         {
             struct Weapon
@@ -2485,6 +2517,8 @@ class Unit : public WorldObject
 
         SpellAuraHolderMap m_spellAuraHolders;
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
+        std::vector<SpellAuraHolder*> m_procHolders;        // holders with nonzero event proc flags, kept in spell id order
+        uint32 m_procHolderMask;                            // OR of their proc flags - swings with no relevant procs exit on one mask test
         AuraList m_deletedAuras;                            // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
         std::map<uint32, Aura*> m_classScripts;
@@ -2524,6 +2558,8 @@ class Unit : public WorldObject
         WeaponDamageInfo m_weaponDamageInfo;
 
         bool m_canModifyStats;
+        uint8 m_statBatchDepth;                             // nesting depth of open stat batch windows
+        uint32 m_dirtyStatMods;                             // bitmask of UnitMods deferred while a batch window is open
         // std::list< spellEffectPair > AuraSpells[TOTAL_AURAS];  // TODO: use this if ok for mem
 
         float m_speed_rate[MAX_MOVE_TYPE];
@@ -2606,6 +2642,7 @@ class Unit : public WorldObject
 
         UnitVisibility m_Visibility;
         Position m_last_notified_position;
+        Position m_last_ai_notified_position;
         BasicEvent* m_AINotifyEvent;
         ShortTimeTracker m_movesplineTimer;
 
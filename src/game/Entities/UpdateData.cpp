@@ -60,60 +60,87 @@ void UpdateData::AddUpdateBlock(const ByteBuffer& block)
     }
 }
 
-void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+// per-thread deflate context, initialized once and reset between packets:
+// deflateInit is a sizable share of the compression cost
+static thread_local z_stream s_compressStream;
+static thread_local bool s_compressStreamReady = false;
+static thread_local int s_compressStreamLevel = -1;
+
+static void ResetCompressStream()
 {
-    z_stream c_stream;
+    if (s_compressStreamReady)
+    {
+        deflateEnd(&s_compressStream);
+        s_compressStreamReady = false;
+    }
+}
 
-    c_stream.zalloc = (alloc_func)nullptr;
-    c_stream.zfree = (free_func)nullptr;
-    c_stream.opaque = (voidpf)nullptr;
+void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+{
+    // large packets may use a stronger tier than the default Z_BEST_SPEED (1)
+    int const level = int(sWorld.getConfig(uint32(src_size) >= sWorld.getConfig(CONFIG_UINT32_COMPRESSION_LARGE_SIZE)
+                          ? CONFIG_UINT32_COMPRESSION_LARGE_LEVEL : CONFIG_UINT32_COMPRESSION));
 
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld.getConfig(CONFIG_UINT32_COMPRESSION));
-    if (z_res != Z_OK)
+    int z_res;
+    if (!s_compressStreamReady)
     {
-        sLog.outError("Can't compress update packet (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
+        s_compressStream.zalloc = (alloc_func)nullptr;
+        s_compressStream.zfree = (free_func)nullptr;
+        s_compressStream.opaque = (voidpf)nullptr;
+
+        z_res = deflateInit(&s_compressStream, level);
+        if (z_res != Z_OK)
+        {
+            sLog.outError("Can't compress update packet (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
+            *dst_size = 0;
+            return;
+        }
+
+        s_compressStreamReady = true;
+        s_compressStreamLevel = level;
+    }
+    else
+    {
+        deflateReset(&s_compressStream);
+        if (level != s_compressStreamLevel)
+        {
+            deflateParams(&s_compressStream, level, Z_DEFAULT_STRATEGY);
+            s_compressStreamLevel = level;
+        }
     }
 
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
+    s_compressStream.next_out = (Bytef*)dst;
+    s_compressStream.avail_out = *dst_size;
+    s_compressStream.next_in = (Bytef*)src;
+    s_compressStream.avail_in = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
+    z_res = deflate(&s_compressStream, Z_NO_FLUSH);
     if (z_res != Z_OK)
     {
         sLog.outError("Can't compress update packet (zlib: deflate) Error code: %i (%s)", z_res, zError(z_res));
+        ResetCompressStream();
         *dst_size = 0;
         return;
     }
 
-    if (c_stream.avail_in != 0)
+    if (s_compressStream.avail_in != 0)
     {
         sLog.outError("Can't compress update packet (zlib: deflate not greedy)");
+        ResetCompressStream();
         *dst_size = 0;
         return;
     }
 
-    z_res = deflate(&c_stream, Z_FINISH);
+    z_res = deflate(&s_compressStream, Z_FINISH);
     if (z_res != Z_STREAM_END)
     {
         sLog.outError("Can't compress update packet (zlib: deflate should report Z_STREAM_END instead %i (%s)", z_res, zError(z_res));
+        ResetCompressStream();
         *dst_size = 0;
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        sLog.outError("Can't compress update packet (zlib: deflateEnd) Error code: %i (%s)", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    *dst_size = c_stream.total_out;
+    *dst_size = s_compressStream.total_out;
 }
 
 WorldPacket UpdateData::BuildPacket(size_t index, bool hasTransport)
@@ -21,6 +21,10 @@
 
 #include "Util/Errors.h"
 
+#if COMPILER == COMPILER_MICROSOFT
+#include <intrin.h>
+#endif
+
 class UpdateMask
 {
     public:
@@ -48,6 +52,26 @@ class UpdateMask
             return (((uint8*)mUpdateMask)[ index >> 3 ] & (1 << (index & 0x7))) != 0;
         }
 
+        // Word-at-a-time scan: returns the index of the first set bit at or
+        // after index, or GetCount() when no further bit is set. Lets callers
+        // enumerate set fields without testing every bit individually.
+        uint32 FindNextSetBit(uint32 index) const
+        {
+            if (index >= mCount)
+                return mCount;
+
+            uint32 block = index >> 5;
+            uint32 value = mUpdateMask[block] & (~uint32(0) << (index & 0x1F));
+            while (!value)
+            {
+                if (++block >= mBlocks)
+                    return mCount;
+                value = mUpdateMask[block];
+            }
+
+            return (block << 5) + LowestSetBit(value);
+        }
+
         uint32 GetBlockCount() const { return mBlocks; }
         uint32 GetLength() const { return mBlocks << 2; }
         uint32 GetCount() const { return mCount; }
@@ -115,6 +139,17 @@ class UpdateMask
         }
 
     private:
+        static uint32 LowestSetBit(uint32 value)
+        {
+#if COMPILER == COMPILER_MICROSOFT
+            unsigned long pos;
+            _BitScanForward(&pos, value);
+            return pos;
+#else
+            return __builtin_ctz(value);
+#endif
+        }
+
         bool mHasData;
         uint32 mCount;
         uint32 mBlocks;
@@ -764,6 +764,106 @@ void GameEventMgr::ApplyNewEvent(uint16 event_id, bool resume)
     OnEventHappened(event_id, true, resume);
 }
 
+namespace
+{
+// bounded per-tick slice for event spawn/despawn application: big events
+// (Darkmoon Faire) tag thousands of guids, and applying them in a single map
+// tick is our largest scheduled tick spike. Each slice reposts the remainder
+// to the map messager, so the event finishes applying over the following
+// ticks once the queue drains.
+constexpr size_t GAME_EVENT_GUIDS_PER_TICK = 200;
+
+void SpawnEventGuidsSliced(Map* map, std::pair<std::vector<uint32>, std::vector<uint32>> dbGuids)
+{
+    size_t budget = GAME_EVENT_GUIDS_PER_TICK;
+    while (budget && !dbGuids.first.empty())
+    {
+        uint32 creatureDbGuid = dbGuids.first.back();
+        dbGuids.first.pop_back();
+        --budget;
+        // fetching here again for future reloading
+        CreatureData const* data = sObjectMgr.GetCreatureData(creatureDbGuid);
+        MANGOS_ASSERT(data);
+        map->GetPersistentState()->AddCreatureToGrid(creatureDbGuid, data);
+        map->GetSpawnManager().AddEventGuid(creatureDbGuid, HIGHGUID_UNIT);
+        if (map->IsLoaded(data->posX, data->posY))
+            Creature::SpawnCreature(creatureDbGuid, map); // dynguid
+    }
+
+    while (budget && !dbGuids.second.empty())
+    {
+        uint32 goDbGuid = dbGuids.second.back();
+        dbGuids.second.pop_back();
+        --budget;
+        GameObjectData const* data = sObjectMgr.GetGOData(goDbGuid);
+        MANGOS_ASSERT(data);
+        map->GetPersistentState()->AddGameobjectToGrid(goDbGuid, data);
+        map->GetSpawnManager().AddEventGuid(goDbGuid, HIGHGUID_UNIT);
+        if (map->IsLoaded(data->posX, data->posY))
+            GameObject::SpawnGameObject(goDbGuid, map); // dynguid
+    }
+
+    // not drained yet - continue on the next map tick
+    if (!dbGuids.first.empty() || !dbGuids.second.empty())
+        map->GetMessager().AddMessage([dbGuids](Map* map)
+        {
+            SpawnEventGuidsSliced(map, dbGuids);
+        });
+}
+
+void UnspawnEventGuidsSliced(Map* map, std::pair<std::vector<uint32>, std::vector<uint32>> dbGuids)
+{
+    std::vector<uint32> creatureSlice;
+    std::vector<uint32> goSlice;
+
+    size_t budget = GAME_EVENT_GUIDS_PER_TICK;
+    while (budget && !dbGuids.first.empty())
+    {
+        creatureSlice.push_back(dbGuids.first.back());
+        dbGuids.first.pop_back();
+        --budget;
+    }
+
+    while (budget && !dbGuids.second.empty())
+    {
+        goSlice.push_back(dbGuids.second.back());
+        dbGuids.second.pop_back();
+        --budget;
+    }
+
+    for (uint32 creatureDbGuid : creatureSlice)
+    {
+        // fetching here again for future reloading
+        CreatureData const* data = sObjectMgr.GetCreatureData(creatureDbGuid);
+        MANGOS_ASSERT(data);
+        map->GetPersistentState()->RemoveCreatureFromGrid(creatureDbGuid, data);
+        map->GetSpawnManager().RemoveEventGuid(creatureDbGuid, HIGHGUID_UNIT);
+        if (Creature* creature = map->GetCreature(creatureDbGuid))
+            if (creature->IsAlive()) // do not remove lootables
+                creature->AddObjectToRemoveList();
+    }
+
+    for (uint32 goDbGuid : goSlice)
+    {
+        GameObjectData const* data = sObjectMgr.GetGOData(goDbGuid);
+        MANGOS_ASSERT(data);
+        map->GetPersistentState()->RemoveGameobjectFromGrid(goDbGuid, data);
+        map->GetSpawnManager().RemoveEventGuid(goDbGuid, HIGHGUID_GAMEOBJECT);
+        if (GameObject* go = map->GetGameObject(goDbGuid))
+            go->Delete();
+    }
+
+    map->GetSpawnManager().RemoveSpawns(creatureSlice, goSlice);
+
+    // not drained yet - continue on the next map tick
+    if (!dbGuids.first.empty() || !dbGuids.second.empty())
+        map->GetMessager().AddMessage([dbGuids](Map* map)
+        {
+            UnspawnEventGuidsSliced(map, dbGuids);
+        });
+}
+}
+
 void GameEventMgr::GameEventSpawn(int16 event_id)
 {
     int32 internal_event_id = m_gameEvents.size() + event_id - 1;
@@ -838,26 +938,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
                 {
                     map->GetMessager().AddMessage([dbGuids](Map* map) // double indirection so it executes in map thread
                     {
-                        for (uint32 creatureDbGuid : dbGuids.first)
-                        {
-                            // fetching here again for future reloading
-                            CreatureData const* data = sObjectMgr.GetCreatureData(creatureDbGuid);
-                            MANGOS_ASSERT(data);
-                            map->GetPersistentState()->AddCreatureToGrid(creatureDbGuid, data);
-                            map->GetSpawnManager().AddEventGuid(creatureDbGuid, HIGHGUID_UNIT);
-                            if (map->IsLoaded(data->posX, data->posY))
-                                Creature::SpawnCreature(creatureDbGuid, map); // dynguid
-                        }
-
-                        for (uint32 goDbGuid : dbGuids.second)
-                        {
-                            GameObjectData const* data = sObjectMgr.GetGOData(goDbGuid);
-                            MANGOS_ASSERT(data);
-                            map->GetPersistentState()->AddGameobjectToGrid(goDbGuid, data);
-                            map->GetSpawnManager().AddEventGuid(goDbGuid, HIGHGUID_UNIT);
-                            if (map->IsLoaded(data->posX, data->posY))
-                                GameObject::SpawnGameObject(goDbGuid, map); // dynguid
-                        }
+                        SpawnEventGuidsSliced(map, dbGuids);
                     });
                 });
             }
@@ -946,29 +1027,7 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
                 {
                     map->GetMessager().AddMessage([dbGuids](Map* map) // double indirection so it executes in map thread
                     {
-                        for (uint32 creatureDbGuid : dbGuids.first)
-                        {
-                            // fetching here again for future reloading
-                            CreatureData const* data = sObjectMgr.GetCreatureData(creatureDbGuid);
-                            MANGOS_ASSERT(data);
-                            map->GetPersistentState()->RemoveCreatureFromGrid(creatureDbGuid, data);
-                            map->GetSpawnManager().RemoveEventGuid(creatureDbGuid, HIGHGUID_UNIT);
-                            if (Creature* creature = map->GetCreature(creatureDbGuid))
-                                if (creature->IsAlive()) // do not remove lootables
-                                    creature->AddObjectToRemoveList();
-                        }
-
-                        for (uint32 goDbGuid : dbGuids.second)
-                        {
-                            GameObjectData const* data = sObjectMgr.GetGOData(goDbGuid);
-                            MANGOS_ASSERT(data);
-                            map->GetPersistentState()->RemoveGameobjectFromGrid(goDbGuid, data);
-                            map->GetSpawnManager().RemoveEventGuid(goDbGuid, HIGHGUID_GAMEOBJECT);
-                            if (GameObject* go = map->GetGameObject(goDbGuid))
-                                go->Delete();
-                        }
-
-                        map->GetSpawnManager().RemoveSpawns(dbGuids.first, dbGuids.second);
+                        UnspawnEventGuidsSliced(map, dbGuids);
                     });
                 });
             }
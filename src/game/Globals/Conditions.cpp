@@ -119,16 +119,80 @@ bool ConditionEntry::Meets(WorldObject const* target, Map const* map, WorldObjec
         sLog.outErrorDb("CONDITION %u type %u used with bad parameters, called from %s, used with target: %s, map %i, source %s",
             m_entry, m_condition, conditionSourceToStr[conditionSourceType], target ? target->GetGuidStr().c_str() : "<nullptr>", map ? map->GetId() : -1, source ? source->GetGuidStr().c_str() : "<nullptr>");
         return false;
-    } 
+    }
+
+    // Conditions reading only the player's own state are served from the per-player cache;
+    // repeated evaluations (gossip reopens, questgiver status sweeps, loot rolls) become lookups
+    Player const* cachePlayer = nullptr;
+    if (target && target->IsPlayer() && IsCacheable(conditionSourceType))
+    {
+        cachePlayer = static_cast<Player const*>(target);
+        bool cachedResult;
+        if (cachePlayer->GetConditionResultCache().Lookup(m_entry, cachedResult))
+            return cachedResult;
+    }
 
     bool result = Evaluate(target, map, source, conditionSourceType);
 
     if (m_flags & CONDITION_FLAG_REVERSE_RESULT)
         result = !result;
 
+    if (cachePlayer)
+        cachePlayer->GetConditionResultCache().Store(m_entry, result);
+
     return result;
 }
 
+// A condition result may only be memoized per player when it depends on nothing but the
+// player's own state - no source, map, world or position inputs - and its whole sub-condition
+// tree does likewise
+bool ConditionEntry::IsCacheable(ConditionSource conditionSourceType) const
+{
+    if (m_flags & CONDITION_FLAG_SWAP_TARGETS)              // target is no longer the player after swap
+        return false;
+
+    switch (m_condition)
+    {
+        case CONDITION_NOT:
+            return sConditionStorage.LookupEntry<ConditionEntry>(m_value1)->IsCacheable(conditionSourceType);
+        case CONDITION_OR:
+        case CONDITION_AND:
+        {
+            if (!sConditionStorage.LookupEntry<ConditionEntry>(m_value1)->IsCacheable(conditionSourceType))
+                return false;
+            if (!sConditionStorage.LookupEntry<ConditionEntry>(m_value2)->IsCacheable(conditionSourceType))
+                return false;
+            if (m_value3 && !sConditionStorage.LookupEntry<ConditionEntry>(m_value3)->IsCacheable(conditionSourceType))
+                return false;
+            if (m_value4 && !sConditionStorage.LookupEntry<ConditionEntry>(m_value4)->IsCacheable(conditionSourceType))
+                return false;
+            return true;
+        }
+        case CONDITION_TEAM:
+            // refering loot may override the result through the two side interaction config
+            return conditionSourceType != CONDITION_FROM_REFERING_LOOT;
+        case CONDITION_ITEM:
+        case CONDITION_ITEM_EQUIPPED:
+        case CONDITION_REPUTATION_RANK_MIN:
+        case CONDITION_SKILL:
+        case CONDITION_QUESTREWARDED:
+        case CONDITION_QUESTTAKEN:
+        case CONDITION_RACE_CLASS:
+        case CONDITION_LEVEL:
+        case CONDITION_SPELL:
+        case CONDITION_QUESTAVAILABLE:
+        case CONDITION_QUEST_NONE:
+        case CONDITION_ITEM_WITH_BANK:
+        case CONDITION_LEARNABLE_ABILITY:
+        case CONDITION_SKILL_BELOW:
+        case CONDITION_REPUTATION_RANK_MAX:
+        case CONDITION_GENDER:
+            return true;
+        default:
+            return false;
+    }
+}
+
 bool ConditionEntry::CheckOp(ConditionOperation op, int32 value, int32 operand)
 {
     switch (op)
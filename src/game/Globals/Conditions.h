@@ -21,6 +21,8 @@
 
 #include "Globals/SharedDefines.h"
 
+#include <unordered_map>
+
 class Map;
 class WorldObject;
 
@@ -167,6 +169,9 @@ class ConditionEntry
         // Checks if the condition is met
         bool Meets(WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType) const;
 
+        // True when the result depends only on the target player's own state, so it can be memoized per player
+        bool IsCacheable(ConditionSource conditionSourceType) const;
+
         static bool CheckOp(ConditionOperation op, int32 value, int32 operand);
     private:
         void DisableCondition() { m_condition = CONDITION_NONE; m_flags ^= CONDITION_FLAG_REVERSE_RESULT; }
@@ -181,6 +186,37 @@ class ConditionEntry
         uint8 m_flags;
 };
 
+// Per-player memoization of condition results for conditions that only read the player's own
+// state (level, quests, items, skills, spells, reputation, team, race/class, gender). Entries
+// are stamped with the epoch of the player state they were computed from; any relevant state
+// change bumps the epoch, lazily invalidating the whole cache without touching the map.
+class ConditionResultCache
+{
+    public:
+        ConditionResultCache() : m_epoch(0) {}
+
+        bool Lookup(uint32 conditionId, bool& result) const
+        {
+            auto itr = m_results.find(conditionId);
+            if (itr == m_results.end() || itr->second.first != m_epoch)
+                return false;
+
+            result = itr->second.second;
+            return true;
+        }
+
+        void Store(uint32 conditionId, bool result)
+        {
+            m_results[conditionId] = { m_epoch, result };
+        }
+
+        void Invalidate() { ++m_epoch; }
+
+    private:
+        uint32 m_epoch;                                     // bumped on every relevant player state change
+        std::unordered_map<uint32, std::pair<uint32, bool>> m_results;
+};
+
 // Check if a player meets condition conditionId
 bool IsConditionSatisfied(uint32 conditionId, WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType);
 
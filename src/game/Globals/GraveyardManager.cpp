@@ -24,8 +24,11 @@
 #include "Maps/Map.h"
 #include "World/World.h"
 
-WorldSafeLocsEntry const* GraveyardManager::GetClosestGraveyardHelper(GraveYardMapBounds bounds, float x, float y, float z, uint32 mapId, Team team) const
+WorldSafeLocsEntry const* GraveyardManager::GetClosestGraveyardHelper(std::vector<GraveyardCandidate> const* candidates, float x, float y, float z, uint32 mapId, Team team) const
 {
+    if (!candidates)
+        return nullptr;
+
     // Simulate std. algorithm:
     //   found some graveyard associated to (ghost_zone,ghost_map)
     //
@@ -51,17 +54,15 @@ WorldSafeLocsEntry const* GraveyardManager::GetClosestGraveyardHelper(GraveYardM
 
     InstanceTemplate const* tempEntry = sObjectMgr.GetInstanceTemplate(mapId);
 
-    for (GraveYardMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+    for (GraveyardCandidate const& candidate : *candidates)
     {
-        GraveYardData const& data = itr->second;
-
-        // Checked on load
-        WorldSafeLocsEntry const* entry = sWorldSafeLocsStore.LookupEntry<WorldSafeLocsEntry>(data.safeLocId);
+        // Resolved when the index was built
+        WorldSafeLocsEntry const* entry = candidate.entry;
 
         // skip enemy faction graveyard
         // team == TEAM_BOTH_ALLOWED case can be at call from .neargrave
         // TEAM_INVALID != team for all teams
-        if (data.team != TEAM_BOTH_ALLOWED && data.team != team && team != TEAM_BOTH_ALLOWED)
+        if (candidate.team != TEAM_BOTH_ALLOWED && candidate.team != team && team != TEAM_BOTH_ALLOWED)
             continue;
 
         // find now nearest graveyard at other (continent) map
@@ -132,6 +133,17 @@ void GraveyardManager::Init(Map* map)
     // TODO: Only load relevant ones for specific map - warning: for example TK needs to have netherstorm
     // For now its likely not that harmful, its not that big
     m_graveyardMap = sWorld.GetGraveyardManager().GetGraveyardMap();
+
+    m_graveyardIndex.clear();
+    for (auto const& pair : m_graveyardMap)
+        AddToIndex(pair.first, pair.second);
+}
+
+void GraveyardManager::AddToIndex(uint32 locKey, GraveYardData const& data)
+{
+    // Checked on load
+    if (WorldSafeLocsEntry const* entry = sWorldSafeLocsStore.LookupEntry<WorldSafeLocsEntry>(data.safeLocId))
+        m_graveyardIndex[locKey].push_back({ entry, data.team });
 }
 
 WorldSafeLocsEntry const* GraveyardManager::GetClosestGraveYard(float x, float y, float z, uint32 mapId, Team team) const
@@ -149,20 +161,20 @@ WorldSafeLocsEntry const* GraveyardManager::GetClosestGraveYard(float x, float y
     WorldSafeLocsEntry const* graveyard = nullptr;
     if (areaId != 0)
     {
-        auto bounds = m_graveyardMap.equal_range(GraveyardLinkKey(areaId, GRAVEYARD_AREALINK));
-        graveyard = GetClosestGraveyardHelper(bounds, x, y, z, mapId, team);
+        auto itr = m_graveyardIndex.find(GraveyardLinkKey(areaId, GRAVEYARD_AREALINK));
+        graveyard = GetClosestGraveyardHelper(itr != m_graveyardIndex.end() ? &itr->second : nullptr, x, y, z, mapId, team);
     }
 
     if (zoneId != 0 && graveyard == nullptr)
     {
-        auto bounds = m_graveyardMap.equal_range(GraveyardLinkKey(zoneId, GRAVEYARD_AREALINK));
-        graveyard = GetClosestGraveyardHelper(bounds, x, y, z, mapId, team);
+        auto itr = m_graveyardIndex.find(GraveyardLinkKey(zoneId, GRAVEYARD_AREALINK));
+        graveyard = GetClosestGraveyardHelper(itr != m_graveyardIndex.end() ? &itr->second : nullptr, x, y, z, mapId, team);
     }
 
     if (graveyard == nullptr)
     {
-        auto bounds = m_graveyardMap.equal_range(GraveyardLinkKey(mapId, GRAVEYARD_MAPLINK));
-        graveyard = GetClosestGraveyardHelper(bounds, x, y, z, mapId, team);
+        auto itr = m_graveyardIndex.find(GraveyardLinkKey(mapId, GRAVEYARD_MAPLINK));
+        graveyard = GetClosestGraveyardHelper(itr != m_graveyardIndex.end() ? &itr->second : nullptr, x, y, z, mapId, team);
     }
 
     if (graveyard == nullptr)
@@ -242,6 +254,7 @@ bool GraveyardManager::AddGraveYardLink(uint32 id, uint32 locId, uint32 linkKind
     data.safeLocId = id;
     data.team = team;
     m_graveyardMap.insert(GraveYardMap::value_type(locKey, data));
+    AddToIndex(locKey, data);
 
     if (inDB)
         WorldDatabase.PExecuteLog("INSERT INTO game_graveyard_zone "
@@ -264,6 +277,13 @@ void GraveyardManager::SetGraveYardLinkTeam(uint32 id, uint32 locKey, Team team)
             continue;
 
         data.team = team;                                   // Validate link
+
+        // mirror the change into the resolved index
+        auto indexItr = m_graveyardIndex.find(locKey);
+        if (indexItr != m_graveyardIndex.end())
+            for (GraveyardCandidate& candidate : indexItr->second)
+                if (candidate.entry->ID == id)
+                    candidate.team = team;
         return;
     }
 
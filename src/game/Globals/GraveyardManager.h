@@ -43,6 +43,15 @@ struct GraveYardData
 typedef std::multimap < uint32 /*locId*/, GraveYardData > GraveYardMap;
 typedef std::pair<GraveYardMap::const_iterator, GraveYardMap::const_iterator> GraveYardMapBounds;
 
+// candidate with the safe-loc entry resolved at index build time, so the
+// closest-graveyard query is only distance computations over a flat vector
+struct GraveyardCandidate
+{
+    WorldSafeLocsEntry const* entry;
+    Team team;
+};
+typedef std::unordered_map<uint32 /*locKey*/, std::vector<GraveyardCandidate>> GraveyardIndex;
+
 class Map;
 
 class GraveyardManager
@@ -61,9 +70,11 @@ class GraveyardManager
         // Only for use in Map
         GraveYardMap& GetGraveyardMap() { return m_graveyardMap; }
     private:
-        WorldSafeLocsEntry const* GetClosestGraveyardHelper(GraveYardMapBounds bounds, float x, float y, float z, uint32 mapId, Team team) const;
+        WorldSafeLocsEntry const* GetClosestGraveyardHelper(std::vector<GraveyardCandidate> const* candidates, float x, float y, float z, uint32 mapId, Team team) const;
+        void AddToIndex(uint32 locKey, GraveYardData const& data);
 
         GraveYardMap m_graveyardMap;
+        GraveyardIndex m_graveyardIndex;                    // per-link-key resolved candidates, kept in sync with m_graveyardMap
 };
 
 #endif
\ No newline at end of file
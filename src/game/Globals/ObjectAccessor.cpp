@@ -35,33 +35,49 @@
 INSTANTIATE_SINGLETON_2(ObjectAccessor, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(ObjectAccessor, std::mutex);
 
+template<class T>
+typename HashMapHolder<T>::Shard& HashMapHolder<T>::GetShard(ObjectGuid guid)
+{
+    return s_shards[guid.GetCounter() & (NUM_SHARDS - 1)];
+}
+
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
 {
-    WriteGuard guard(i_lock);
-    m_objectMap[o->GetObjectGuid()] = o;
+    Shard& shard = GetShard(o->GetObjectGuid());
+    std::lock_guard<std::mutex> guard(shard.lock);
+    shard.objects[o->GetObjectGuid()] = o;
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
-    WriteGuard guard(i_lock);
-    m_objectMap.erase(o->GetObjectGuid());
+    Shard& shard = GetShard(o->GetObjectGuid());
+    std::lock_guard<std::mutex> guard(shard.lock);
+    shard.objects.erase(o->GetObjectGuid());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    ReadGuard guard(i_lock);
-    typename MapType::iterator itr = m_objectMap.find(guid);
-    return (itr != m_objectMap.end()) ? itr->second : nullptr;
+    Shard& shard = GetShard(guid);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    typename MapType::iterator itr = shard.objects.find(guid);
+    return (itr != shard.objects.end()) ? itr->second : nullptr;
 }
 
 template<class T>
-typename HashMapHolder<T>::MapType& HashMapHolder<T>::GetContainer() { return m_objectMap; }
-
-template<class T>
-typename HashMapHolder<T>::LockType& HashMapHolder<T>::GetLock() { return i_lock; }
+std::vector<T*> HashMapHolder<T>::GetAllSnapshot()
+{
+    std::vector<T*> snapshot;
+    for (Shard& shard : s_shards)
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        for (auto& itr : shard.objects)
+            snapshot.push_back(itr.second);
+    }
+    return snapshot;
+}
 
 ObjectAccessor::ObjectAccessor() {}
 ObjectAccessor::~ObjectAccessor()
@@ -113,11 +129,9 @@ Player* ObjectAccessor::FindPlayer(ObjectGuid guid, bool inWorld /*= true*/)
 
 Player* ObjectAccessor::FindPlayerByName(const char* name)
 {
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        if (iter->second->IsInWorld() && (::strcmp(name, iter->second->GetName()) == 0))
-            return iter->second;
+    for (Player* player : HashMapHolder<Player>::GetAllSnapshot())
+        if (player->IsInWorld() && (::strcmp(name, player->GetName()) == 0))
+            return player;
 
     return nullptr;
 }
@@ -125,18 +139,16 @@ Player* ObjectAccessor::FindPlayerByName(const char* name)
 void
 ObjectAccessor::SaveAllPlayers() const
 {
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (auto& itr : m)
+    for (Player* player : HashMapHolder<Player>::GetAllSnapshot())
     {
-        if (itr.second->IsInWorld())
-            itr.second->GetMap()->GetMessager().AddMessage([guid = itr.second->GetObjectGuid()](Map* map)
+        if (player->IsInWorld())
+            player->GetMap()->GetMessager().AddMessage([guid = player->GetObjectGuid()](Map* map)
             {
-                if (Player* player = map->GetPlayer(guid))
-                    player->SaveToDB();
+                if (Player* plr = map->GetPlayer(guid))
+                    plr->SaveToDB();
             });
         else
-            itr.second->SaveToDB();
+            player->SaveToDB();
     }
 }
 
@@ -293,6 +305,7 @@ ObjectAccessor::ConvertCorpseForPlayer(ObjectGuid player_guid, bool insignia)
 
         // add bones in grid store if grid loaded where corpse placed
         map->Add(bones);
+        map->QueueBonesDecay(bones);
     }
 
     // all references to the corpse should be removed at this point
@@ -319,8 +332,7 @@ void ObjectAccessor::RemoveOldCorpses()
 
 /// Define the static member of HashMapHolder
 
-template <class T> typename HashMapHolder<T>::MapType HashMapHolder<T>::m_objectMap;
-template <class T> std::mutex HashMapHolder<T>::i_lock;
+template <class T> typename HashMapHolder<T>::Shard HashMapHolder<T>::s_shards[HashMapHolder<T>::NUM_SHARDS];
 
 /// Global definitions for the hashmap storage
 
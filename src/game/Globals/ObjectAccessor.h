@@ -43,9 +43,6 @@ class HashMapHolder
     public:
 
         typedef std::unordered_map<ObjectGuid, T*>   MapType;
-        typedef std::mutex LockType;
-        typedef std::lock_guard<std::mutex> ReadGuard;
-        typedef std::lock_guard<std::mutex> WriteGuard;
 
         static void Insert(T* o);
 
@@ -53,17 +50,29 @@ class HashMapHolder
 
         static T* Find(ObjectGuid guid);
 
-        static MapType& GetContainer();
-
-        static LockType& GetLock();
+        // stable snapshot of all stored objects - safe to iterate without
+        // holding any shard lock; entries can log out afterwards, so callers
+        // still need their usual IsInWorld checks
+        static std::vector<T*> GetAllSnapshot();
 
     private:
 
         // Non instanceable only static
         HashMapHolder() {}
 
-        static LockType i_lock;
-        static MapType  m_objectMap;
+        // guid-sharded storage so map workers, chat handlers and remote
+        // access threads no longer serialize on one global lock
+        static uint32 const NUM_SHARDS = 16;
+
+        struct Shard
+        {
+            std::mutex lock;
+            MapType objects;
+        };
+
+        static Shard& GetShard(ObjectGuid guid);
+
+        static Shard s_shards[NUM_SHARDS];
 };
 
 class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLevelLockable<ObjectAccessor, std::mutex> >
@@ -87,9 +96,9 @@ class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLev
         static Player* FindPlayerByName(const char* name);
         static void KickPlayer(ObjectGuid guid);
 
-        HashMapHolder<Player>::MapType& GetPlayers() const
+        std::vector<Player*> GetPlayersSnapshot() const
         {
-            return HashMapHolder<Player>::GetContainer();
+            return HashMapHolder<Player>::GetAllSnapshot();
         }
 
         void SaveAllPlayers() const;
@@ -66,6 +66,8 @@
 
 INSTANTIATE_SINGLETON_1(ObjectMgr);
 
+QuestRelations const ObjectMgr::m_emptyQuestRelations;
+
 bool normalizePlayerName(std::string& name, size_t max_len)
 {
     if (name.empty())
@@ -1860,7 +1862,9 @@ void ObjectMgr::LoadCreatures()
 {
     uint32 count = 0;
     //                                             0                       1   2
-    auto queryResult = WorldDatabase.Query("SELECT creature.guid, creature.id, map,"
+    // typed query: spawn tables are the largest startup loads, fetching them
+    // over the binary protocol skips the per-column text conversions
+    auto queryResult = WorldDatabase.QueryTyped("SELECT creature.guid, creature.id, map,"
                           //        3           4           5            6                 7                 8          9
                           "position_x, position_y, position_z, orientation, spawntimesecsmin, spawntimesecsmax, spawndist,"
                           //   10         11        12
@@ -2069,7 +2073,7 @@ void ObjectMgr::LoadGameObjects()
     uint32 count = 0;
 
     //                                                           0              1    2           3            4          5            6
-    auto queryResult = WorldDatabase.Query("SELECT gameobject.guid, gameobject.id, map, position_x, position_y, position_z, orientation,"
+    auto queryResult = WorldDatabase.QueryTyped("SELECT gameobject.guid, gameobject.id, map, position_x, position_y, position_z, orientation,"
                           //       7          8          9          10               11                12         13     14
                           "rotation0, rotation1, rotation2, rotation3, spawntimesecsmin, spawntimesecsmax, spawnMask, event,"
                           //                       15                                   16
@@ -2338,6 +2342,30 @@ void ObjectMgr::RemoveGameobjectFromGrid(uint32 guid, GameObjectData const* data
     cell_guids.gameobjects.erase(guid);
 }
 
+// query shapes of the offline character lookups below that are safe to cache:
+// their rows only change on character create/delete/rename (the map lookup is
+// deliberately absent - the map changes on every logout)
+static char const* characterLookupShapes[] =
+{
+    "SELECT guid FROM characters WHERE name",
+    "SELECT name FROM characters",
+    "SELECT race FROM characters",
+    "SELECT class FROM characters",
+    "SELECT account FROM characters",
+};
+
+void ObjectMgr::RegisterCharacterLookupCache()
+{
+    for (char const* shape : characterLookupShapes)
+        CharacterDatabase.RegisterCachedQueryShape(shape);
+}
+
+void ObjectMgr::InvalidateCharacterLookupCache()
+{
+    for (char const* shape : characterLookupShapes)
+        CharacterDatabase.InvalidateCachedQueries(shape);
+}
+
 // Get player map id of offline player. Return -1 if not found!
 int32 ObjectMgr::GetPlayerMapIdByGUID(ObjectGuid const& guid) const
 {
@@ -2373,6 +2401,16 @@ ObjectGuid ObjectMgr::GetPlayerGuidByName(std::string name) const
     return guid;
 }
 
+bool ObjectMgr::ReservePendingCharacterName(const std::string& name)
+{
+    return m_pendingCharacterNames.insert(name).second;
+}
+
+void ObjectMgr::ReleasePendingCharacterName(const std::string& name)
+{
+    m_pendingCharacterNames.erase(name);
+}
+
 bool ObjectMgr::GetPlayerNameByGUID(ObjectGuid guid, std::string& name) const
 {
     // prevent DB access for online player
@@ -4904,6 +4942,21 @@ void ObjectMgr::LoadQuests()
         }
     }
 
+    // direct quest-id index for the hot GetQuestTemplate path; only built when the
+    // id space is dense enough that the pointer array stays cheap
+    m_QuestTemplateIndex.clear();                           // need for reload case
+    uint32 maxQuestId = 0;
+    for (auto& itr : mQuestTemplates)
+        maxQuestId = std::max(maxQuestId, itr.first);
+    if (maxQuestId && maxQuestId < mQuestTemplates.size() * 16)
+    {
+        m_QuestTemplateIndex.resize(maxQuestId + 1, nullptr);
+        for (auto& itr : mQuestTemplates)
+            m_QuestTemplateIndex[itr.first] = itr.second.get();
+    }
+    else if (maxQuestId)
+        sLog.outString("Quest id space too sparse for direct index (max id %u for " SIZEFMTD " quests), keeping hash lookups", maxQuestId, mQuestTemplates.size());
+
     sLog.outString(">> Loaded " SIZEFMTD " quests definitions", mQuestTemplates.size());
     sLog.outString();
 }
@@ -7943,7 +7996,7 @@ void ObjectMgr::LoadQuestRelationsHelper(QuestRelationsMap& map, char const* tab
             continue;
         }
 
-        map.insert(QuestRelationsMap::value_type(id, quest));
+        map[id].push_back(quest);
 
         ++count;
     }
@@ -7957,13 +8010,15 @@ void ObjectMgr::LoadGameobjectQuestRelations()
 {
     LoadQuestRelationsHelper(m_GOQuestRelations, "gameobject_questrelation");
 
-    for (auto& m_GOQuestRelation : m_GOQuestRelations)
+    for (auto& relation : m_GOQuestRelations)
     {
-        GameObjectInfo const* goInfo = GetGameObjectInfo(m_GOQuestRelation.first);
+        GameObjectInfo const* goInfo = GetGameObjectInfo(relation.first);
         if (!goInfo)
-            sLog.outErrorDb("Table `gameobject_questrelation` have data for nonexistent gameobject entry (%u) and existing quest %u", m_GOQuestRelation.first, m_GOQuestRelation.second);
+            for (uint32 quest : relation.second)
+                sLog.outErrorDb("Table `gameobject_questrelation` have data for nonexistent gameobject entry (%u) and existing quest %u", relation.first, quest);
         else if (goInfo->type != GAMEOBJECT_TYPE_QUESTGIVER)
-            sLog.outErrorDb("Table `gameobject_questrelation` have data gameobject entry (%u) for quest %u, but GO is not GAMEOBJECT_TYPE_QUESTGIVER", m_GOQuestRelation.first, m_GOQuestRelation.second);
+            for (uint32 quest : relation.second)
+                sLog.outErrorDb("Table `gameobject_questrelation` have data gameobject entry (%u) for quest %u, but GO is not GAMEOBJECT_TYPE_QUESTGIVER", relation.first, quest);
     }
 }
 
@@ -7971,13 +8026,15 @@ void ObjectMgr::LoadGameobjectInvolvedRelations()
 {
     LoadQuestRelationsHelper(m_GOQuestInvolvedRelations, "gameobject_involvedrelation");
 
-    for (auto& m_GOQuestInvolvedRelation : m_GOQuestInvolvedRelations)
+    for (auto& relation : m_GOQuestInvolvedRelations)
     {
-        GameObjectInfo const* goInfo = GetGameObjectInfo(m_GOQuestInvolvedRelation.first);
+        GameObjectInfo const* goInfo = GetGameObjectInfo(relation.first);
         if (!goInfo)
-            sLog.outErrorDb("Table `gameobject_involvedrelation` have data for nonexistent gameobject entry (%u) and existing quest %u", m_GOQuestInvolvedRelation.first, m_GOQuestInvolvedRelation.second);
+            for (uint32 quest : relation.second)
+                sLog.outErrorDb("Table `gameobject_involvedrelation` have data for nonexistent gameobject entry (%u) and existing quest %u", relation.first, quest);
         else if (goInfo->type != GAMEOBJECT_TYPE_QUESTGIVER)
-            sLog.outErrorDb("Table `gameobject_involvedrelation` have data gameobject entry (%u) for quest %u, but GO is not GAMEOBJECT_TYPE_QUESTGIVER", m_GOQuestInvolvedRelation.first, m_GOQuestInvolvedRelation.second);
+            for (uint32 quest : relation.second)
+                sLog.outErrorDb("Table `gameobject_involvedrelation` have data gameobject entry (%u) for quest %u, but GO is not GAMEOBJECT_TYPE_QUESTGIVER", relation.first, quest);
     }
 }
 
@@ -7985,11 +8042,12 @@ void ObjectMgr::LoadCreatureQuestRelations()
 {
     LoadQuestRelationsHelper(m_CreatureQuestRelations, "creature_questrelation");
 
-    for (auto& m_CreatureQuestRelation : m_CreatureQuestRelations)
+    for (auto& relation : m_CreatureQuestRelations)
     {
-        CreatureInfo const* cInfo = GetCreatureTemplate(m_CreatureQuestRelation.first);
+        CreatureInfo const* cInfo = GetCreatureTemplate(relation.first);
         if (!cInfo)
-            sLog.outErrorDb("Table `creature_questrelation` have data for nonexistent creature entry (%u) and existing quest %u", m_CreatureQuestRelation.first, m_CreatureQuestRelation.second);
+            for (uint32 quest : relation.second)
+                sLog.outErrorDb("Table `creature_questrelation` have data for nonexistent creature entry (%u) and existing quest %u", relation.first, quest);
     }
 }
 
@@ -7997,11 +8055,12 @@ void ObjectMgr::LoadCreatureInvolvedRelations()
 {
     LoadQuestRelationsHelper(m_CreatureQuestInvolvedRelations, "creature_involvedrelation");
 
-    for (auto& m_CreatureQuestInvolvedRelation : m_CreatureQuestInvolvedRelations)
+    for (auto& relation : m_CreatureQuestInvolvedRelations)
     {
-        CreatureInfo const* cInfo = GetCreatureTemplate(m_CreatureQuestInvolvedRelation.first);
+        CreatureInfo const* cInfo = GetCreatureTemplate(relation.first);
         if (!cInfo)
-            sLog.outErrorDb("Table `creature_involvedrelation` have data for nonexistent creature entry (%u) and existing quest %u", m_CreatureQuestInvolvedRelation.first, m_CreatureQuestInvolvedRelation.second);
+            for (uint32 quest : relation.second)
+                sLog.outErrorDb("Table `creature_involvedrelation` have data for nonexistent creature entry (%u) and existing quest %u", relation.first, quest);
     }
 }
 
@@ -8247,6 +8306,7 @@ int ObjectMgr::GetOrNewStorageLocaleIndexFor(LocaleConstant loc)
     if (loc == DEFAULT_LOCALE)
         return -1;
 
+    std::lock_guard<std::mutex> guard(m_LocalForIndexMtx);
     for (size_t i = 0; i < m_LocalForIndex.size(); ++i)
         if (m_LocalForIndex[i] == loc)
             return i;
@@ -8989,6 +9049,7 @@ void ObjectMgr::LoadVendors(char const* tableName, bool isTemplates)
     for (auto& itr : vendorList)
         itr.second.Clear();
     vendorList.clear();
+    InvalidateVendorListCaches();
 
     auto queryResult = WorldDatabase.PQuery("SELECT entry, item, maxcount, incrtime, condition_id FROM %s ORDER BY slot", tableName);
     if (!queryResult)
@@ -9074,8 +9135,11 @@ void ObjectMgr::LoadActiveEntities(Map* _map)
     {
         for (CreatureDataMap::const_iterator itr = mCreatureDataMap.begin(); itr != mCreatureDataMap.end(); ++itr)
         {
+            // queued rather than loaded in place: object-loading every spawn grid
+            // of a continent here stalls map creation for a long time right when
+            // players flood in after a restart
             if (itr->second.mapid == _map->GetId())
-                _map->ForceLoadGrid(itr->second.posX, itr->second.posY);
+                _map->QueueGridWarmup(itr->second.posX, itr->second.posY);
         }
     }
     else                                                    // Normal case - Load all npcs that are active
@@ -9431,10 +9495,27 @@ void ObjectMgr::LoadDungeonEncounters()
     sDungeonEncounterStore.Load();
 }
 
+ObjectMgr::VendorListCache const* ObjectMgr::GetVendorListCache(uint64 key) const
+{
+    auto itr = m_vendorListCache.find(key);
+    return itr != m_vendorListCache.end() ? &itr->second : nullptr;
+}
+
+void ObjectMgr::StoreVendorListCache(uint64 key, VendorListCache&& cache)
+{
+    m_vendorListCache[key] = std::move(cache);
+}
+
+void ObjectMgr::InvalidateVendorListCaches()
+{
+    m_vendorListCache.clear();
+}
+
 void ObjectMgr::AddVendorItem(uint32 entry, uint32 item, uint32 maxcount, uint32 incrtime)
 {
     VendorItemData& vList = m_mCacheVendorItemMap[entry];
     vList.AddItem(item, maxcount, incrtime, 0);
+    InvalidateVendorListCaches();
 
     WorldDatabase.PExecuteLog("INSERT INTO npc_vendor (entry,item,maxcount,incrtime) VALUES('%u','%u','%u','%u')", entry, item, maxcount, incrtime);
 }
@@ -9448,6 +9529,8 @@ bool ObjectMgr::RemoveVendorItem(uint32 entry, uint32 item)
     if (!iter->second.RemoveItem(item))
         return false;
 
+    InvalidateVendorListCaches();
+
     WorldDatabase.PExecuteLog("DELETE FROM npc_vendor WHERE entry='%u' AND item='%u'", entry, item);
     return true;
 }
@@ -9917,7 +10000,8 @@ bool DoDisplayText(WorldObject* source, int32 entry, Unit const* target, uint32
 {
     uint32 sound, emote, type = 0;
     Language lang = LANG_UNIVERSAL;
-    std::vector<std::string> content;
+    // point at the interned per-locale content owned by the stores - never copy it per send
+    std::vector<std::string> const* content = nullptr;
     Gender sourceGender = source->IsUnit() ? (Gender)((Unit*)source)->getGender() : GENDER_NONE;
 
     if (BroadcastText const* bct = sObjectMgr.GetBroadcastText(entry))
@@ -9926,13 +10010,13 @@ bool DoDisplayText(WorldObject* source, int32 entry, Unit const* target, uint32
         type = bct->chatTypeId;
         sound = bct->soundId1;
         emote = bct->emoteIds[0];
-        content = bct->maleText;
+        content = &bct->maleText;
 
         if ((sourceGender == GENDER_FEMALE || sourceGender == GENDER_NONE) && !bct->femaleText[DEFAULT_LOCALE].empty() && bct->femaleText.size() > 0)
-            content = bct->femaleText;
+            content = &bct->femaleText;
 
         if (bct->maleText.size() > 0 && !bct->maleText[DEFAULT_LOCALE].empty())
-            content = bct->maleText;
+            content = &bct->maleText;
     }
     else if (MangosStringLocale const* data = sObjectMgr.GetMangosStringLocale(entry))
     {
@@ -9943,19 +10027,19 @@ bool DoDisplayText(WorldObject* source, int32 entry, Unit const* target, uint32
         if (BroadcastText const* bct = data->broadcastText)
         {
             if ((sourceGender == GENDER_FEMALE || sourceGender == GENDER_NONE) && !bct->femaleText[DEFAULT_LOCALE].empty() && bct->femaleText.size() > 0)
-                content = bct->femaleText;
+                content = &bct->femaleText;
 
             if (bct->maleText.size() > 0 && !bct->maleText[DEFAULT_LOCALE].empty())
-                content = bct->maleText;
+                content = &bct->maleText;
         }
         else
-            content = data->Content;
+            content = &data->Content;
     }
 
     if (chatTypeOverride > 0)
         type = chatTypeOverride;
 
-    if (content.empty())
+    if (!content || content->empty())
     {
         _DoStringError("DoScriptText with source %s could not find text entry %i.", source->GetGuidStr().c_str(), entry);
         return false;
@@ -10000,6 +10084,6 @@ bool DoDisplayText(WorldObject* source, int32 entry, Unit const* target, uint32
         return false;
     }
 
-    source->MonsterText(content, type, lang, target);
+    source->MonsterText(*content, type, lang, target);
     return true;
 }
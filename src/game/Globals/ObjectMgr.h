@@ -38,6 +38,7 @@
 #include <map>
 #include <climits>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <optional>
 
@@ -218,10 +219,10 @@ typedef std::unordered_map<uint32, AreaTriggerLocale> AreaTriggerLocaleMap;
 
 typedef std::multimap<int32, uint32> ExclusiveQuestGroupsMap;
 typedef std::multimap<uint32, ItemRequiredTarget> ItemRequiredTargetMap;
-typedef std::multimap<uint32, uint32> QuestRelationsMap;
+typedef std::vector<uint32> QuestRelations;                 // flattened quest ids of one questgiver entry
+typedef std::unordered_map<uint32, QuestRelations> QuestRelationsMap;
 typedef std::pair<ExclusiveQuestGroupsMap::const_iterator, ExclusiveQuestGroupsMap::const_iterator> ExclusiveQuestGroupsMapBounds;
 typedef std::pair<ItemRequiredTargetMap::const_iterator, ItemRequiredTargetMap::const_iterator> ItemRequiredTargetMapBounds;
-typedef std::pair<QuestRelationsMap::const_iterator, QuestRelationsMap::const_iterator> QuestRelationsMapBounds;
 
 struct PetLevelInfo
 {
@@ -527,6 +528,12 @@ class ObjectMgr
         uint32 GetPlayerAccountIdByGUID(ObjectGuid guid) const;
         uint32 GetPlayerAccountIdByPlayerName(const std::string& name) const;
 
+        // read-through caching of the offline character lookups above (mail delivery,
+        // auctions and rosters repeat them constantly for the same characters)
+        static void RegisterCharacterLookupCache();
+        // must be called whenever a character is created, deleted or renamed
+        static void InvalidateCharacterLookupCache();
+
         bool AddTaxiShortcut(const TaxiPathEntry* path, uint32 lengthTakeoff, uint32 lengthLanding);
         bool GetTaxiShortcut(uint32 pathid, TaxiShortcutData& data);
         void LoadTaxiShortcuts();
@@ -536,6 +543,10 @@ class ObjectMgr
 
         Quest const* GetQuestTemplate(uint32 quest_id) const
         {
+            // direct index built at the end of LoadQuests when the id space is dense enough
+            if (!m_QuestTemplateIndex.empty())
+                return quest_id < m_QuestTemplateIndex.size() ? m_QuestTemplateIndex[quest_id] : nullptr;
+
             QuestMap::const_iterator itr = mQuestTemplates.find(quest_id);
             return itr != mQuestTemplates.end() ? itr->second.get() : nullptr;
         }
@@ -1029,6 +1040,12 @@ class ObjectMgr
         void LoadReservedPlayersNames();
         bool IsReservedName(const std::string& name) const;
 
+        // optimistic reservation of a character name whose async create has not yet
+        // reached the characters table (handlers and DB callbacks both run on the
+        // world update thread, so no locking is needed)
+        bool ReservePendingCharacterName(const std::string& name);
+        void ReleasePendingCharacterName(const std::string& name);
+
         static bool CheckPublicMessageLanguage(const std::string& message);
 
         // name with valid structure and symbols
@@ -1103,6 +1120,18 @@ class ObjectMgr
         bool RemoveVendorItem(uint32 entry, uint32 item);
         bool IsVendorItemValid(bool isTemplate, char const* tableName, uint32 vendor_entry, uint32 item_id, uint32 maxcount, uint32 incrtime, uint16 conditionId, Player* pl = nullptr) const;
 
+        // cached SMSG_LIST_INVENTORY payload (everything after the vendor guid) for one
+        // (vendor entry, class, race, reputation rank, discount) combination; offsets of
+        // limited-stock count fields are kept so live counts are patched in at send time
+        struct VendorListCache
+        {
+            std::vector<uint8> payload;
+            std::vector<std::pair<uint32, uint32>> limitedSlots;    // payload offset, combined item index
+        };
+        VendorListCache const* GetVendorListCache(uint64 key) const;
+        void StoreVendorListCache(uint64 key, VendorListCache&& cache);
+        void InvalidateVendorListCaches();                          // called on any vendor list mutation or reload
+
         ItemRequiredTargetMapBounds GetItemRequiredTargetMapBounds(uint32 uiItemEntry) const
         {
             return m_ItemRequiredTarget.equal_range(uiItemEntry);
@@ -1140,24 +1169,24 @@ class ObjectMgr
             return m_ExclusiveQuestGroups.equal_range(groupId);
         }
 
-        QuestRelationsMapBounds GetCreatureQuestRelationsMapBounds(uint32 entry) const
+        QuestRelations const& GetCreatureQuestRelations(uint32 entry) const
         {
-            return m_CreatureQuestRelations.equal_range(entry);
+            return GetQuestRelations(m_CreatureQuestRelations, entry);
         }
 
-        QuestRelationsMapBounds GetCreatureQuestInvolvedRelationsMapBounds(uint32 entry) const
+        QuestRelations const& GetCreatureQuestInvolvedRelations(uint32 entry) const
         {
-            return m_CreatureQuestInvolvedRelations.equal_range(entry);
+            return GetQuestRelations(m_CreatureQuestInvolvedRelations, entry);
         }
 
-        QuestRelationsMapBounds GetGOQuestRelationsMapBounds(uint32 entry) const
+        QuestRelations const& GetGOQuestRelations(uint32 entry) const
         {
-            return m_GOQuestRelations.equal_range(entry);
+            return GetQuestRelations(m_GOQuestRelations, entry);
         }
 
-        QuestRelationsMapBounds GetGOQuestInvolvedRelationsMapBounds(uint32 entry) const
+        QuestRelations const& GetGOQuestInvolvedRelations(uint32 entry) const
         {
-            return m_GOQuestInvolvedRelations.equal_range(entry);
+            return GetQuestRelations(m_GOQuestInvolvedRelations, entry);
         }
 
         QuestRelationsMap& GetCreatureQuestRelationsMap() { return m_CreatureQuestRelations; }
@@ -1249,6 +1278,7 @@ class ObjectMgr
         ObjectGuidGenerator<HIGHGUID_CORPSE>     m_CorpseGuids;
 
         QuestMap            mQuestTemplates;
+        std::vector<Quest*> m_QuestTemplateIndex;           // quest by id, built at LoadQuests when ids are dense
 
         typedef std::unordered_map<uint32, GossipText> GossipTextMap;
         typedef std::unordered_map<uint32, uint32> QuestAreaTriggerMap;
@@ -1284,6 +1314,9 @@ class ObjectMgr
         typedef std::set<std::wstring> ReservedNamesMap;
         ReservedNamesMap    m_ReservedNames;
 
+        // normalized names with a character creation still in flight
+        std::set<std::string> m_pendingCharacterNames;
+
         TaxiShortcutMap     m_TaxiShortcutMap;
 
         GameTeleMap         m_GameTeleMap;
@@ -1292,6 +1325,7 @@ class ObjectMgr
 
         typedef             std::vector<LocaleConstant> LocalForIndex;
         LocalForIndex        m_LocalForIndex;
+        std::mutex           m_LocalForIndexMtx;            // locale loaders may run on parallel startup threads
 
         ExclusiveQuestGroupsMap m_ExclusiveQuestGroups;
 
@@ -1301,6 +1335,16 @@ class ObjectMgr
         QuestRelationsMap       m_GOQuestInvolvedRelations;
 
     private:
+        static QuestRelations const& GetQuestRelations(QuestRelationsMap const& map, uint32 entry)
+        {
+            auto itr = map.find(entry);
+            if (itr == map.end())
+                return m_emptyQuestRelations;
+            return itr->second;
+        }
+
+        static QuestRelations const m_emptyQuestRelations;  // returned for entries without quest relations
+
         void LoadCreatureAddons(SQLStorage& creatureaddons, char const* entryName, char const* comment);
         void ConvertCreatureAddonAuras(CreatureDataAddon* addon, char const* table, char const* guidEntryStr);
         void LoadQuestRelationsHelper(QuestRelationsMap& map, char const* table);
@@ -1371,6 +1415,7 @@ class ObjectMgr
         CacheNpcTextIdMap m_mCacheNpcTextIdMap;
         CacheVendorItemMap m_mCacheVendorTemplateItemMap;
         CacheVendorItemMap m_mCacheVendorItemMap;
+        std::map<uint64, VendorListCache> m_vendorListCache;
         CacheTrainerSpellMap m_mCacheTrainerTemplateSpellMap;
         CacheTrainerSpellMap m_mCacheTrainerSpellMap;
 
@@ -112,6 +112,21 @@ namespace MaNGOS
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
     };
 
+    // fills a per-cell object snapshot that all cameras share within one tick
+    struct CellSnapshotFiller
+    {
+        explicit CellSnapshotFiller(std::vector<WorldObject*>& objects) : m_objects(objects) {}
+        template<class T> void Visit(GridRefManager<T>& m)
+        {
+            for (auto& iter : m)
+                m_objects.push_back(iter.getSource());
+        }
+        void Visit(CameraMapType&) {}
+
+        private:
+            std::vector<WorldObject*>& m_objects;
+    };
+
     struct ObjectUpdater
     {
         ObjectUpdater(WorldObjectUnSet& otus, const uint32& diff) : m_objectToUpdateSet(otus), m_timeDiff(diff) {}
@@ -126,28 +141,6 @@ namespace MaNGOS
             uint32 m_timeDiff;
     };
 
-    struct PlayerVisitObjectsNotifier
-    {
-        Player& i_player;
-        PlayerVisitObjectsNotifier(Player& pl) : i_player(pl) {}
-        template<class T> void Visit(GridRefManager<T>&) {}
-#ifdef _MSC_VER
-        template<> void Visit(PlayerMapType&);
-        template<> void Visit(CreatureMapType&);
-#endif
-    };
-
-    struct CreatureVisitObjectsNotifier
-    {
-        Creature& i_creature;
-        CreatureVisitObjectsNotifier(Creature& c) : i_creature(c) {}
-        template<class T> void Visit(GridRefManager<T>&) {}
-#ifdef _MSC_VER
-        template<> void Visit(PlayerMapType&);
-        template<> void Visit(CreatureMapType&);
-#endif
-    };
-
     struct DynamicObjectUpdater
     {
         DynamicObject& i_dynobject;
@@ -221,13 +214,13 @@ namespace MaNGOS
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
     };
 
-    template<class Check>
+    template<class Check, class Container = WorldObjectList>
     struct WorldObjectListSearcher
     {
-        WorldObjectList& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        WorldObjectListSearcher(WorldObjectList& objects, Check& check) : i_objects(objects), i_check(check) {}
+        WorldObjectListSearcher(Container& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
@@ -306,26 +299,26 @@ namespace MaNGOS
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
     };
 
-    template<class Check>
+    template<class Check, class Container = GameObjectList>
     struct GameObjectListSearcher
     {
-        GameObjectList& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        GameObjectListSearcher(GameObjectList& objects, Check& check) : i_objects(objects), i_check(check) {}
+        GameObjectListSearcher(Container& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(GameObjectMapType& m);
 
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
     };
 
-    template<class Check>
+    template<class Check, class Container = DynamicObjectList>
     struct DynamicObjectListSearcher
     {
-        DynamicObjectList& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        DynamicObjectListSearcher(DynamicObjectList& objects, Check& check) : i_objects(objects), i_check(check) {}
+        DynamicObjectListSearcher(Container& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(DynamicObjectMapType& m);
 
@@ -365,13 +358,13 @@ namespace MaNGOS
     };
 
     // All accepted by Check units if any
-    template<class Check>
+    template<class Check, class Container = UnitList>
     struct UnitListSearcher
     {
-        UnitList& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        UnitListSearcher(UnitList& objects, Check& check) : i_objects(objects), i_check(check) {}
+        UnitListSearcher(Container& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
@@ -408,13 +401,13 @@ namespace MaNGOS
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
     };
 
-    template<class Check>
+    template<class Check, class Container = CreatureList>
     struct CreatureListSearcher
     {
-        CreatureList& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        CreatureListSearcher(CreatureList& objects, Check& check) : i_objects(objects), i_check(check) {}
+        CreatureListSearcher(Container& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(CreatureMapType& m);
 
@@ -452,13 +445,13 @@ namespace MaNGOS
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
     };
 
-    template<class Check>
+    template<class Check, class Container = PlayerList>
     struct PlayerListSearcher
     {
-        PlayerList& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        PlayerListSearcher(PlayerList& objects, Check& check)
+        PlayerListSearcher(Container& objects, Check& check)
             : i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType& m);
@@ -1443,10 +1436,6 @@ namespace MaNGOS
     };
 
 #ifndef _MSC_VER
-    template<> void PlayerVisitObjectsNotifier::Visit<Player>(PlayerMapType&);
-    template<> void PlayerVisitObjectsNotifier::Visit<Creature>(CreatureMapType&);
-    template<> void CreatureVisitObjectsNotifier::Visit<Player>(PlayerMapType&);
-    template<> void CreatureVisitObjectsNotifier::Visit<Creature>(CreatureMapType&);
     template<> inline void DynamicObjectUpdater::Visit<Creature>(CreatureMapType&);
     template<> inline void DynamicObjectUpdater::Visit<Player>(PlayerMapType&);
 #endif
@@ -101,86 +101,6 @@ inline void CreatureVisitCreatureWorker(Creature* c1, Creature* c2)
     }
 }
 
-template<>
-inline void MaNGOS::PlayerVisitObjectsNotifier::Visit(CreatureMapType& m)
-{
-    if (!i_player.IsAlive() || i_player.IsTaxiFlying())
-        return;
-
-    bool playerHasAI = i_player.AI() != nullptr;
-
-    for (auto& iter : m)
-    {
-        Creature* creature = iter.getSource();
-        if (!creature->IsAlive())
-            continue;
-
-        UnitVisitObjectsNotifierWorker(creature, &i_player);
-
-        if (playerHasAI)
-            UnitVisitObjectsNotifierWorker(&i_player, creature);
-    }
-}
-
-template<>
-inline void MaNGOS::PlayerVisitObjectsNotifier::Visit(PlayerMapType& m)
-{
-    if (!i_player.IsAlive() || i_player.IsTaxiFlying())
-        return;
-
-    bool playerHasAI = i_player.AI() != nullptr;
-
-    for (auto& iter : m)
-    {
-        Player* player = iter.getSource();
-        if (player->IsAlive() && !player->IsTaxiFlying())
-            continue;
-
-        if (player->AI())
-            UnitVisitObjectsNotifierWorker(player, &i_player);
-
-        if (playerHasAI)
-            UnitVisitObjectsNotifierWorker(&i_player, player);
-    }
-}
-
-template<>
-inline void MaNGOS::CreatureVisitObjectsNotifier::Visit(PlayerMapType& m)
-{
-    if (!i_creature.IsAlive())
-        return;
-
-    for (auto& iter : m)
-    {
-        Player* player = iter.getSource();
-        if (!player->IsAlive() || player->IsTaxiFlying())
-            continue;
-
-        if (player->AI())
-            UnitVisitObjectsNotifierWorker(player, &i_creature);
-
-        UnitVisitObjectsNotifierWorker(&i_creature, player);
-    }
-}
-
-template<>
-inline void MaNGOS::CreatureVisitObjectsNotifier::Visit(CreatureMapType& m)
-{
-    if (!i_creature.IsAlive())
-        return;
-
-    for (auto& iter : m)
-    {
-        Creature* creature = iter.getSource();
-        if (creature == &i_creature || !creature->IsAlive())
-            continue;
-
-        UnitVisitObjectsNotifierWorker(creature, &i_creature);
-
-        UnitVisitObjectsNotifierWorker(&i_creature, creature);
-    }
-}
-
 inline void MaNGOS::DynamicObjectUpdater::VisitHelper(Unit* target)
 {
     if (!target->IsAlive() || target->IsTaxiFlying())
@@ -403,40 +323,40 @@ void MaNGOS::WorldObjectSearcher<Check>::Visit(DynamicObjectMapType& m)
     }
 }
 
-template<class Check>
-void MaNGOS::WorldObjectListSearcher<Check>::Visit(PlayerMapType& m)
+template<class Check, class Container>
+void MaNGOS::WorldObjectListSearcher<Check, Container>::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MaNGOS::WorldObjectListSearcher<Check>::Visit(CreatureMapType& m)
+template<class Check, class Container>
+void MaNGOS::WorldObjectListSearcher<Check, Container>::Visit(CreatureMapType& m)
 {
     for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MaNGOS::WorldObjectListSearcher<Check>::Visit(CorpseMapType& m)
+template<class Check, class Container>
+void MaNGOS::WorldObjectListSearcher<Check, Container>::Visit(CorpseMapType& m)
 {
     for (CorpseMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MaNGOS::WorldObjectListSearcher<Check>::Visit(GameObjectMapType& m)
+template<class Check, class Container>
+void MaNGOS::WorldObjectListSearcher<Check, Container>::Visit(GameObjectMapType& m)
 {
     for (GameObjectMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MaNGOS::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType& m)
+template<class Check, class Container>
+void MaNGOS::WorldObjectListSearcher<Check, Container>::Visit(DynamicObjectMapType& m)
 {
     for (DynamicObjectMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -472,8 +392,8 @@ void MaNGOS::GameObjectLastSearcher<Check>::Visit(GameObjectMapType& m)
     }
 }
 
-template<class Check>
-void MaNGOS::GameObjectListSearcher<Check>::Visit(GameObjectMapType& m)
+template<class Check, class Container>
+void MaNGOS::GameObjectListSearcher<Check, Container>::Visit(GameObjectMapType& m)
 {
     for (GameObjectMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -482,8 +402,8 @@ void MaNGOS::GameObjectListSearcher<Check>::Visit(GameObjectMapType& m)
 
 // Dynamicobject searchers
 
-template<class Check>
-void MaNGOS::DynamicObjectListSearcher<Check>::Visit(DynamicObjectMapType& m)
+template<class Check, class Container>
+void MaNGOS::DynamicObjectListSearcher<Check, Container>::Visit(DynamicObjectMapType& m)
 {
     for (DynamicObjectMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -546,16 +466,16 @@ void MaNGOS::UnitLastSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
-template<class Check>
-void MaNGOS::UnitListSearcher<Check>::Visit(PlayerMapType& m)
+template<class Check, class Container>
+void MaNGOS::UnitListSearcher<Check, Container>::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MaNGOS::UnitListSearcher<Check>::Visit(CreatureMapType& m)
+template<class Check, class Container>
+void MaNGOS::UnitListSearcher<Check, Container>::Visit(CreatureMapType& m)
 {
     for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -591,8 +511,8 @@ void MaNGOS::CreatureLastSearcher<Check>::Visit(CreatureMapType& m)
     }
 }
 
-template<class Check>
-void MaNGOS::CreatureListSearcher<Check>::Visit(CreatureMapType& m)
+template<class Check, class Container>
+void MaNGOS::CreatureListSearcher<Check, Container>::Visit(CreatureMapType& m)
 {
     for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -616,8 +536,8 @@ void MaNGOS::PlayerSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
-template<class Check>
-void MaNGOS::PlayerListSearcher<Check>::Visit(PlayerMapType& m)
+template<class Check, class Container>
+void MaNGOS::PlayerListSearcher<Check, Container>::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -58,7 +58,7 @@ RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, c
         info.UpdateTimeTracker(t_diff);
         if (info.getTimeTracker().Passed())
         {
-            if (!m.UnloadGrid(x, y, false))
+            if (!m.BeginUnloadGrid(x, y, false))
             {
                 DEBUG_LOG("Grid[%u,%u] for map %u differed unloading due to players or active objects nearby", x, y, m.GetId());
                 m.ResetGridExpiry(grid);
@@ -66,3 +66,11 @@ RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, c
         }
     }
 }
+
+void
+UnloadingState::Update(Map& m, NGridType& /*grid*/, GridInfo&, const uint32& x, const uint32& y, const uint32&) const
+{
+    // destruct one slice of the dying grid per map tick; the grid leaves the
+    // GridRefManager (and with it this state machine) once the last slice is done
+    m.ContinueUnloadGrid(x, y);
+}
@@ -61,4 +61,12 @@ class RemovalState : public GridState
         virtual ~RemovalState() {}
 };
 
+class UnloadingState : public GridState
+{
+    public:
+
+        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
+        virtual ~UnloadingState() {}
+};
+
 #endif
@@ -723,13 +723,36 @@ void Group::UpdatePlayerOutOfRange(Player* pPlayer)
     if (pPlayer->GetGroupUpdateFlag() == GROUP_UPDATE_FLAG_NONE)
         return;
 
+    // usually every member has the player at client and nobody needs the
+    // packet - only build it once an actual recipient turns up
     WorldPacket data;
-    WorldSession::BuildPartyMemberStatsChangedPacket(pPlayer, data);
-
+    float nearestDist2 = -1.0f;                             // squared distance to the nearest recipient on the same map
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
+    {
         if (Player* player = itr->getSource())
+        {
             if (player != pPlayer && !player->HasAtClient(pPlayer))
+            {
+                if (data.empty())
+                    WorldSession::BuildPartyMemberStatsChangedPacket(pPlayer, data);
                 player->GetSession()->SendPacket(data);
+
+                if (player->IsInWorld() && player->GetMap() == pPlayer->GetMap())
+                {
+                    float dx = player->GetPositionX() - pPlayer->GetPositionX();
+                    float dy = player->GetPositionY() - pPlayer->GetPositionY();
+                    float dist2 = dx * dx + dy * dy;
+                    if (nearestDist2 < 0 || dist2 < nearestDist2)
+                        nearestDist2 = dist2;
+                }
+            }
+        }
+    }
+
+    // a position went out (or nobody wanted one): remember it and let the next
+    // pure map dot refresh wait the longer the farther the nearest viewer is
+    if (pPlayer->GetGroupUpdateFlag() & GROUP_UPDATE_FLAG_POSITION)
+        pPlayer->OnGroupPositionBroadcast(nearestDist2 >= 0 ? sqrtf(nearestDist2) : (data.empty() ? 0.0f : 1000.0f));
 }
 
 void Group::UpdatePlayerOnlineStatus(Player* player, bool online /*= true*/)
@@ -776,6 +799,8 @@ void Group::UpdateOfflineLeader(time_t time, uint32 delay)
 
 void Group::BroadcastPacket(WorldPacket const& packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore) const
 {
+    packet.GetSharedPayload();                              // serialized once, shared by every member's socket
+
     for (GroupReference const* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* pl = itr->getSource();
@@ -93,6 +93,12 @@ enum GroupUpdateFlags
 };
 
 #define GROUP_UPDATE_FLAGS_COUNT          21
+
+// decimation of out-of-range position refreshes (map dot updates): the packet
+// carries whole-yard coordinates, so sub-yard moves never render, and a dot
+// hundreds of yards from its nearest viewer barely moves between refreshes
+float const GROUP_POSITION_MIN_DISPLACEMENT = 2.0f;     // yards moved before a refresh is flagged at all
+uint32 const GROUP_POSITION_MS_PER_YARD     = 20;       // added refresh pause per yard to the nearest viewer (1000 yd -> 20 s)
 // 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,11,12,13,14,15,16,17,18,19
 static const uint8 GroupUpdateLength[GROUP_UPDATE_FLAGS_COUNT] = { 1, 2, 2, 1, 2, 2, 2, 2, 4, 4, 2, 8, 1, 2, 2, 2, 1, 2, 2, 4, 2 };
 
@@ -224,6 +224,10 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
     newmember.Pnote   = (std::string)"";
     newmember.LogoutTime = time(nullptr);
     members[lowguid] = newmember;
+    InvalidateRosterCache();
+
+    if (pl)
+        m_OnlineMembers.insert(lowguid);
 
     std::string dbPnote   = newmember.Pnote;
     std::string dbOFFnote = newmember.OFFnote;
@@ -233,6 +237,9 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
     CharacterDatabase.PExecute("INSERT INTO guild_member (guildid,guid,`rank`,pnote,offnote) VALUES ('%u', '%u', '%u','%s','%s')",
                                m_Id, lowguid, newmember.RankId, dbPnote.c_str(), dbOFFnote.c_str());
 
+    // guild id is part of the character enum data
+    sWorld.InvalidateCharacterEnumCache(newmember.accountId);
+
     // If player not in game data in data field will be loaded from guild tables, no need to update it!!
     if (pl)
     {
@@ -249,6 +256,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
 void Guild::SetMOTD(std::string motd)
 {
     MOTD = motd;
+    InvalidateRosterCache();
 
     // motd now can be used for encoding to DB
     CharacterDatabase.escape_string(motd);
@@ -258,6 +266,7 @@ void Guild::SetMOTD(std::string motd)
 void Guild::SetGINFO(std::string ginfo)
 {
     GINFO = ginfo;
+    InvalidateRosterCache();
 
     // ginfo now can be used for encoding to DB
     CharacterDatabase.escape_string(ginfo);
@@ -478,6 +487,7 @@ void Guild::SetLeader(ObjectGuid guid)
 
     m_LeaderGuid = guid;
     slot->ChangeRank(GR_GUILDMASTER);
+    InvalidateRosterCache();
 
     CharacterDatabase.PExecute("UPDATE guild SET leaderguid='%u' WHERE guildid='%u'", guid.GetCounter(), m_Id);
 }
@@ -533,7 +543,15 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
         }
     }
 
-    members.erase(lowguid);
+    MemberList::iterator memberItr = members.find(lowguid);
+    if (memberItr != members.end())
+    {
+        // guild id is part of the character enum data; the member may be offline here
+        sWorld.InvalidateCharacterEnumCache(memberItr->second.accountId);
+        members.erase(memberItr);
+        InvalidateRosterCache();
+        m_OnlineMembers.erase(lowguid);
+    }
 
     Player* player = sObjectMgr.GetPlayer(guid);
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
@@ -562,10 +580,12 @@ void Guild::BroadcastToGuild(WorldSession* session, const std::string& msg, uint
 
     WorldPacket data;
     ChatHandler::BuildChatPacket(data, CHAT_MSG_GUILD, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
+    // build the payload snapshot up front, outside any recipient's socket lock
+    data.GetSharedPayload();
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (uint32 lowguid : m_OnlineMembers)
     {
-        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, lowguid));
 
         if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
             pl->GetSession()->SendPacket(data);
@@ -581,12 +601,14 @@ void Guild::BroadcastToOfficers(WorldSession* session, const std::string& msg, u
     if (!player || !HasRankRight(player->GetRank(), GR_RIGHT_OFFCHATSPEAK))
         return;
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
-    {
-        WorldPacket data;
-        ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
+    // serialized once; every recipient's socket shares the payload snapshot
+    WorldPacket data;
+    ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
+    data.GetSharedPayload();
 
-        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+    for (uint32 lowguid : m_OnlineMembers)
+    {
+        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, lowguid));
 
         if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
             pl->GetSession()->SendPacket(data);
@@ -595,9 +617,11 @@ void Guild::BroadcastToOfficers(WorldSession* session, const std::string& msg, u
 
 void Guild::BroadcastPacket(WorldPacket& packet)
 {
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    packet.GetSharedPayload();                              // one serialization for all recipients
+
+    for (uint32 lowguid : m_OnlineMembers)
     {
-        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, lowguid));
         if (player)
             player->GetSession()->SendPacket(packet);
     }
@@ -605,14 +629,15 @@ void Guild::BroadcastPacket(WorldPacket& packet)
 
 void Guild::BroadcastPacketToRank(WorldPacket& packet, uint32 rankId)
 {
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (uint32 lowguid : m_OnlineMembers)
     {
-        if (itr->second.RankId == rankId)
-        {
-            Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-            if (player)
-                player->GetSession()->SendPacket(packet);
-        }
+        MemberList::const_iterator itr = members.find(lowguid);
+        if (itr == members.end() || itr->second.RankId != rankId)
+            continue;
+
+        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, lowguid));
+        if (player)
+            player->GetSession()->SendPacket(packet);
     }
 }
 
@@ -634,6 +659,7 @@ void Guild::CreateRank(std::string name_, uint32 rights)
 void Guild::AddRank(const std::string& name_, uint32 rights)
 {
     m_Ranks.push_back(RankInfo(name_, rights));
+    InvalidateRosterCache();
 }
 
 void Guild::DelRank()
@@ -647,6 +673,7 @@ void Guild::DelRank()
     CharacterDatabase.PExecute("DELETE FROM guild_rank WHERE rid>='%u' AND guildid='%u'", rank, m_Id);
 
     m_Ranks.pop_back();
+    InvalidateRosterCache();
 }
 
 std::string Guild::GetRankName(uint32 rankId)
@@ -671,6 +698,7 @@ void Guild::SetRankName(uint32 rankId, std::string name_)
         return;
 
     m_Ranks[rankId].Name = name_;
+    InvalidateRosterCache();
 
     // name now can be used for encoding to DB
     CharacterDatabase.escape_string(name_);
@@ -683,6 +711,7 @@ void Guild::SetRankRights(uint32 rankId, uint32 rights)
         return;
 
     m_Ranks[rankId].Rights = rights;
+    InvalidateRosterCache();
 
     CharacterDatabase.PExecute("UPDATE guild_rank SET rights='%u' WHERE rid='%u' AND guildid='%u'", rights, rankId, m_Id);
 }
@@ -711,9 +740,29 @@ void Guild::Disband()
 }
 
 void Guild::Roster(WorldSession* session /*= nullptr*/)
+{
+    bool const showOfficerNotes = session && HasRankRight(session->GetPlayer()->GetRank(), GR_RIGHT_VIEWOFFNOTE);
+
+    RosterCacheEntry& cache = m_rosterCache[showOfficerNotes ? 1 : 0];
+    time_t const now = time(nullptr);
+    if (!cache.valid || now - cache.builtAt >= GUILD_ROSTER_CACHE_SECONDS)
+    {
+        BuildRosterPacket(cache.packet, showOfficerNotes);
+        cache.builtAt = now;
+        cache.valid = true;
+    }
+
+    if (session)
+        session->SendPacket(cache.packet);
+    else
+        BroadcastPacket(cache.packet);
+    DEBUG_LOG("WORLD: Sent (SMSG_GUILD_ROSTER)");
+}
+
+void Guild::BuildRosterPacket(WorldPacket& data, bool showOfficerNotes)
 {
     // we can only guess size
-    WorldPacket data(SMSG_GUILD_ROSTER, (4 + MOTD.length() + 1 + GINFO.length() + 1 + 4 + m_Ranks.size() * 4 + members.size() * 50));
+    data.Initialize(SMSG_GUILD_ROSTER, (4 + MOTD.length() + 1 + GINFO.length() + 1 + 4 + m_Ranks.size() * 4 + members.size() * 50));
     data << uint32(members.size());
     data << MOTD;
     data << GINFO;
@@ -734,7 +783,7 @@ void Guild::Roster(WorldSession* session /*= nullptr*/)
             data << uint8(pl->getClass());
             data << uint32(pl->GetZoneId());
             data << itr->second.Pnote;
-            data << ((session && HasRankRight(session->GetPlayer()->GetRank(), GR_RIGHT_VIEWOFFNOTE)) ? itr->second.OFFnote : "");
+            data << (showOfficerNotes ? itr->second.OFFnote : "");
         }
         else
         {
@@ -747,14 +796,9 @@ void Guild::Roster(WorldSession* session /*= nullptr*/)
             data << uint32(itr->second.ZoneId);
             data << float(float(time(nullptr) - itr->second.LogoutTime) / float(DAY));
             data << itr->second.Pnote;
-            data << ((session && HasRankRight(session->GetPlayer()->GetRank(), GR_RIGHT_VIEWOFFNOTE)) ? itr->second.OFFnote : "");
+            data << (showOfficerNotes ? itr->second.OFFnote : "");
         }
     }
-    if (session)
-        session->SendPacket(data);
-    else
-        BroadcastPacket(data);
-    DEBUG_LOG("WORLD: Sent (SMSG_GUILD_ROSTER)");
 }
 
 void Guild::Query(WorldSession* session)
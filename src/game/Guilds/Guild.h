@@ -23,12 +23,14 @@
 #include "Entities/Item.h"
 #include "Globals/ObjectAccessor.h"
 #include "Globals/SharedDefines.h"
+#include "Server/WorldPacket.h"
 #include "Util/UniqueTrackablePtr.h"
 
 class Item;
 
 #define GUILD_RANKS_MIN_COUNT   5
 #define GUILD_RANKS_MAX_COUNT   10
+#define GUILD_ROSTER_CACHE_SECONDS 2
 
 enum GuildDefaultRanks
 {
@@ -248,11 +250,15 @@ class Guild
             BroadcastEvent(event, ObjectGuid(), str1, str2, str3);
         }
 
+        // presence upkeep: broadcasts only visit members registered here
+        void OnMemberLogin(uint32 lowguid) { m_OnlineMembers.insert(lowguid); InvalidateRosterCache(); }
+        void OnMemberLogout(uint32 lowguid) { m_OnlineMembers.erase(lowguid); InvalidateRosterCache(); }
+
         template<class Do>
         void BroadcastWorker(Do& _do, Player* except = nullptr)
         {
-            for (MemberList::iterator itr = members.begin(); itr != members.end(); ++itr)
-                if (Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first)))
+            for (uint32 lowguid : m_OnlineMembers)
+                if (Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, lowguid)))
                     if (player != except)
                         _do(player);
         }
@@ -292,6 +298,12 @@ class Guild
         }
 
         void Roster(WorldSession* session = nullptr);          // nullptr = broadcast
+        // drops the cached roster packets; call after any change a roster row displays
+        void InvalidateRosterCache()
+        {
+            m_rosterCache[0].valid = false;
+            m_rosterCache[1].valid = false;
+        }
         void Query(WorldSession* session);
 
         // Guild EventLog
@@ -324,6 +336,7 @@ class Guild
         RankList m_Ranks;
 
         MemberList members;
+        std::set<uint32> m_OnlineMembers;                   // lowguids of members currently in world, maintained on login/logout
 
         /** These are actually ordered lists. The first element is the oldest entry.*/
         typedef std::list<GuildEventLogEntry> GuildEventLog;
@@ -333,6 +346,19 @@ class Guild
 
         MaNGOS::unique_weak_ptr<Guild> m_weakRef;
 
+        // cached SMSG_GUILD_ROSTER payloads, one per officer-note visibility,
+        // served to repeat opens; online member level/zone and the offline-days
+        // column drift with time, so entries also expire after a short interval
+        struct RosterCacheEntry
+        {
+            WorldPacket packet;
+            time_t builtAt = 0;
+            bool valid = false;
+        };
+        RosterCacheEntry m_rosterCache[2];
+
+        void BuildRosterPacket(WorldPacket& data, bool showOfficerNotes);
+
     private:
         void UpdateAccountsNumber() { m_accountsNumber = 0;}// mark for lazy calculation at request in GetAccountsNumber
 };
@@ -313,6 +313,7 @@ void WorldSession::HandleGuildPromoteOpcode(WorldPacket& recvPacket)
     uint32 newRankId = slot->RankId - 1;                    // when promoting player, rank is decreased
 
     slot->ChangeRank(newRankId);
+    guild->InvalidateRosterCache();
     // Put record into guild log
     guild->LogGuildEvent(GUILD_EVENT_LOG_PROMOTE_PLAYER, GetPlayer()->GetObjectGuid(), slot->guid, newRankId);
 
@@ -374,6 +375,7 @@ void WorldSession::HandleGuildDemoteOpcode(WorldPacket& recvPacket)
     uint32 newRankId = slot->RankId + 1;                    // when demoting player, rank is increased
 
     slot->ChangeRank(newRankId);
+    guild->InvalidateRosterCache();
     // Put record into guild log
     guild->LogGuildEvent(GUILD_EVENT_LOG_DEMOTE_PLAYER, GetPlayer()->GetObjectGuid(), slot->guid, newRankId);
 
@@ -481,6 +483,7 @@ void WorldSession::HandleGuildLeaderOpcode(WorldPacket& recvPacket)
 
     guild->SetLeader(slot->guid);
     oldSlot->ChangeRank(GR_OFFICER);
+    guild->InvalidateRosterCache();
 
     guild->BroadcastEvent(GE_LEADER_CHANGED, oldLeader->GetName(), name.c_str());
 }
@@ -547,6 +550,7 @@ void WorldSession::HandleGuildSetPublicNoteOpcode(WorldPacket& recvPacket)
     recvPacket >> PNOTE;
 
     slot->SetPNOTE(PNOTE);
+    guild->InvalidateRosterCache();
 
     guild->Roster(this);
 }
@@ -584,6 +588,7 @@ void WorldSession::HandleGuildSetOfficerNoteOpcode(WorldPacket& recvPacket)
     recvPacket >> OFFNOTE;
 
     slot->SetOFFNOTE(OFFNOTE);
+    guild->InvalidateRosterCache();
 
     guild->Roster(this);
 }
@@ -145,3 +145,130 @@ void GuildMgr::LoadGuilds()
     sLog.outString(">> Loaded %u guild definitions", count);
     sLog.outString();
 }
+
+Petition const* GuildMgr::GetPetition(uint32 petitionLowGuid) const
+{
+    PetitionMap::const_iterator itr = m_petitionMap.find(petitionLowGuid);
+    if (itr != m_petitionMap.end())
+        return &itr->second;
+
+    return nullptr;
+}
+
+Petition const* GuildMgr::GetPetitionByOwner(ObjectGuid ownerGuid) const
+{
+    for (const auto& itr : m_petitionMap)
+        if (itr.second.ownerGuid == ownerGuid)
+            return &itr.second;
+
+    return nullptr;
+}
+
+void GuildMgr::AddPetition(uint32 petitionLowGuid, ObjectGuid ownerGuid, std::string const& name)
+{
+    Petition& petition = m_petitionMap[petitionLowGuid];
+    petition.petitionLowGuid = petitionLowGuid;
+    petition.ownerGuid = ownerGuid;
+    petition.name = name;
+    petition.signatures.clear();
+}
+
+void GuildMgr::SetPetitionName(uint32 petitionLowGuid, std::string const& name)
+{
+    PetitionMap::iterator itr = m_petitionMap.find(petitionLowGuid);
+    if (itr != m_petitionMap.end())
+        itr->second.name = name;
+}
+
+void GuildMgr::SignPetition(uint32 petitionLowGuid, ObjectGuid signerGuid, uint32 signerAccount)
+{
+    PetitionMap::iterator itr = m_petitionMap.find(petitionLowGuid);
+    if (itr != m_petitionMap.end())
+        itr->second.signatures.emplace_back(signerGuid, signerAccount);
+}
+
+void GuildMgr::DeletePetition(uint32 petitionLowGuid)
+{
+    m_petitionMap.erase(petitionLowGuid);
+}
+
+void GuildMgr::DeletePetitionsByOwner(ObjectGuid ownerGuid)
+{
+    for (PetitionMap::iterator itr = m_petitionMap.begin(); itr != m_petitionMap.end();)
+    {
+        if (itr->second.ownerGuid == ownerGuid)
+            itr = m_petitionMap.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+std::vector<uint32> GuildMgr::RemovePetitionSignatures(ObjectGuid signerGuid)
+{
+    std::vector<uint32> affected;
+
+    for (auto& itr : m_petitionMap)
+    {
+        auto& signatures = itr.second.signatures;
+        for (size_t i = 0; i < signatures.size(); ++i)
+        {
+            if (signatures[i].first == signerGuid)
+            {
+                signatures.erase(signatures.begin() + i);
+                affected.push_back(itr.first);
+                break; // a character can sign a petition only once
+            }
+        }
+    }
+
+    return affected;
+}
+
+void GuildMgr::LoadPetitions()
+{
+    m_petitionMap.clear();
+
+    uint32 count = 0;
+
+    //                                                 0          1             2
+    auto queryResult = CharacterDatabase.Query("SELECT ownerguid, petitionguid, name FROM petition");
+
+    if (!queryResult)
+    {
+        BarGoLink bar(1);
+        bar.step();
+        sLog.outString(">> Loaded %u petitions", count);
+        sLog.outString();
+        return;
+    }
+
+    BarGoLink bar(queryResult->GetRowCount());
+
+    do
+    {
+        Field* fields = queryResult->Fetch();
+
+        bar.step();
+        ++count;
+
+        uint32 petitionLowGuid = fields[1].GetUInt32();
+        AddPetition(petitionLowGuid, ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32()), fields[2].GetCppString());
+    }
+    while (queryResult->NextRow());
+
+    //                                                      0             1           2
+    auto signaturesResult = CharacterDatabase.Query("SELECT petitionguid, playerguid, player_account FROM petition_sign");
+
+    if (signaturesResult)
+    {
+        do
+        {
+            Field* fields = signaturesResult->Fetch();
+            SignPetition(fields[0].GetUInt32(), ObjectGuid(HIGHGUID_PLAYER, fields[1].GetUInt32()), fields[2].GetUInt32());
+        }
+        while (signaturesResult->NextRow());
+    }
+
+    sLog.outString(">> Loaded %u petitions", count);
+    sLog.outString();
+}
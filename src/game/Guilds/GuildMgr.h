@@ -21,15 +21,35 @@
 
 #include "Common.h"
 #include "Util/UniqueTrackablePtr.h"
+#include "Entities/ObjectGuid.h"
 
 class Guild;
-class ObjectGuid;
+
+// In-memory mirror of a guild charter (petition/petition_sign tables) - petition
+// handlers read from here instead of querying the database on the world thread
+struct Petition
+{
+    uint32 petitionLowGuid = 0;                             // low guid of the charter item
+    ObjectGuid ownerGuid;
+    std::string name;
+    std::vector<std::pair<ObjectGuid, uint32>> signatures;  // signer guid, signer account id
+
+    bool HasSignatureFromAccount(uint32 accountId) const
+    {
+        for (auto& signature : signatures)
+            if (signature.second == accountId)
+                return true;
+        return false;
+    }
+};
 
 class GuildMgr
 {
         typedef std::unordered_map<uint32, MaNGOS::unique_trackable_ptr<Guild>> GuildMap;
+        typedef std::map<uint32, Petition> PetitionMap;
 
         GuildMap m_GuildMap;
+        PetitionMap m_petitionMap;
     public:
         GuildMgr();
         ~GuildMgr();
@@ -43,6 +63,19 @@ class GuildMgr
         std::string GetGuildNameById(uint32 guildId) const;
 
         void LoadGuilds();
+
+        // Petition index - world thread only, kept in sync with the (async) DB writes
+        Petition const* GetPetition(uint32 petitionLowGuid) const;
+        Petition const* GetPetitionByOwner(ObjectGuid ownerGuid) const;
+        void AddPetition(uint32 petitionLowGuid, ObjectGuid ownerGuid, std::string const& name);
+        void SetPetitionName(uint32 petitionLowGuid, std::string const& name);
+        void SignPetition(uint32 petitionLowGuid, ObjectGuid signerGuid, uint32 signerAccount);
+        void DeletePetition(uint32 petitionLowGuid);
+        void DeletePetitionsByOwner(ObjectGuid ownerGuid);
+        // Removes the signatures of a (deleted) character, returns the affected petition ids
+        std::vector<uint32> RemovePetitionSignatures(ObjectGuid signerGuid);
+
+        void LoadPetitions();
 };
 
 #define sGuildMgr MaNGOS::Singleton<GuildMgr>::Instance()
@@ -60,6 +60,19 @@ LfgRolePriority LFGPlayerQueueInfo::GetRolePriority(LfgRoles role)
     return LFG_PRIORITY_NONE;
 }
 
+void LFGQueue::AccountPlayer(LFGPlayerQueueInfo const& playerInfo, bool add)
+{
+    std::pair<uint32, uint32> const key(playerInfo.team, playerInfo.areaId);
+    AreaRoleCounts& bucket = m_areaBuckets[key];
+    bucket.players += add ? 1 : -1;
+    for (size_t i = 0; i < PotentialRoles.size(); ++i)
+        if (playerInfo.roleMask & PotentialRoles[i])
+            bucket.roleCapable[i] += add ? 1 : -1;
+
+    if (!bucket.players)
+        m_areaBuckets.erase(key);
+}
+
 void LFGQueue::Update()
 {
     TimePoint previously = sWorld.GetCurrentClockTime();
@@ -89,8 +102,10 @@ void LFGQueue::Update()
             // if matchmaking enabled, ignore talents after some time (default 5 min)
             if (sWorld.getConfig(CONFIG_BOOL_LFG_MATCHMAKING) && itr->second.timeInLFG >= (sWorld.getConfig(CONFIG_UINT32_LFG_MATCHMAKING_TIMER) * IN_MILLISECONDS))
             {
+                AccountPlayer(itr->second, false);          // widening the role mask changes the bucket counts
                 itr->second.rolePriority.clear();
                 itr->second.CalculateRoles((Classes)itr->second.playerClass);
+                AccountPlayer(itr->second, true);
             }
 
             ++itr;
@@ -101,11 +116,20 @@ void LFGQueue::Update()
             // Iterate over QueuedGroupsMap to fill groups with roles they're missing.
             for (QueuedGroupsMap::iterator qGroup = m_queuedGroups.begin(); qGroup != m_queuedGroups.end();)
             {
+                // O(1) feasibility check against the bucket counters: only scan
+                // the player map when someone in this team/dungeon bucket can
+                // actually fill a role the group still needs
+                bool feasible = false;
+                AreaBucketMap::const_iterator bucket = m_areaBuckets.find(std::make_pair(qGroup->second.team, qGroup->second.areaId));
+                if (bucket != m_areaBuckets.end())
+                    for (size_t i = 0; i < PotentialRoles.size() && !feasible; ++i)
+                        feasible = (qGroup->second.availableRoles & PotentialRoles[i]) && bucket->second.roleCapable[i] > 0;
+
                 // Remove group from queue if it has been filled by players manually inviting.
                 // We fill 1 group per update since removing it from the queue invalidates
                 // the iterator and we can save on performance a little.
                 // Iterate over QueuedPlayersMap to find suitable player to join group
-                QueuedPlayersMap::iterator next = m_queuedPlayers.begin();
+                QueuedPlayersMap::iterator next = feasible ? m_queuedPlayers.begin() : m_queuedPlayers.end();
                 for (QueuedPlayersMap::iterator qPlayer = next; next != m_queuedPlayers.end(); qPlayer = next)
                 {
                     // Pre-increment iterator here since FindRoleToGroup() may remove qPlayer
@@ -173,11 +197,15 @@ void LFGQueue::Update()
         // Pick first 2 players and form group out of them also inserting them into queue as group.
         if (m_queuedPlayers.size() >= m_groupSize)
         {
-            // Pick Leader as first target.
+            // Pick Leader as first target, but only scan for company when the
+            // leader's bucket can field a full group at all
             QueuedPlayersMap::iterator leader = m_queuedPlayers.begin();
 
+            AreaBucketMap::const_iterator leaderBucket = m_areaBuckets.find(std::make_pair(leader->second.team, leader->second.areaId));
+
             std::list<ObjectGuid> playersInArea;
-            FindInArea(playersInArea, leader->second.areaId, leader->second.team, leader->first);
+            if (leaderBucket != m_areaBuckets.end() && leaderBucket->second.players >= m_groupSize)
+                FindInArea(playersInArea, leader->second.areaId, leader->second.team, leader->first);
 
             // 4 players + the leader
             if (playersInArea.size() >= m_groupSize - 1)
@@ -266,7 +294,12 @@ void LFGQueue::AddGroup(LFGGroupQueueInfo const& groupInfo, uint32 groupId)
 
 void LFGQueue::AddPlayer(LFGPlayerQueueInfo const& playerInfo, ObjectGuid playerGuid)
 {
+    auto itr = m_queuedPlayers.find(playerGuid);
+    if (itr != m_queuedPlayers.end())
+        AccountPlayer(itr->second, false);                  // re-queue, retire the old entry's counts
+
     m_queuedPlayers[playerGuid] = playerInfo;
+    AccountPlayer(playerInfo, true);
 
     sWorld.GetMessager().AddMessage([playerGuid, areaId = playerInfo.areaId](World* world)
     {
@@ -413,6 +446,7 @@ void LFGQueue::RemovePlayerFromQueue(ObjectGuid playerGuid, PlayerLeaveMethod le
             });
         }
 
+        AccountPlayer(itr->second, false);
         m_queuedPlayers.erase(itr);
     }
 }
@@ -460,6 +494,7 @@ void LFGQueue::RestoreOfflinePlayer(ObjectGuid playerGuid)
     if (itr != m_offlinePlayers.end())
     {
         m_queuedPlayers[playerGuid] = itr->second;
+        AccountPlayer(itr->second, true);
         m_offlinePlayers.erase(itr);
         sWorld.GetMessager().AddMessage([playerGuid, areaId = itr->second.areaId](World* world)
         {
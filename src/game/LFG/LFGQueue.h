@@ -99,10 +99,24 @@ class LFGQueue
         void FindInArea(std::list<ObjectGuid>& players, uint32 area, uint32 team, ObjectGuid const& exclude);
         bool FindRoleToGroup(ObjectGuid playerGuid, uint32 groupId, LfgRoles role);
 
+        // per-(team, dungeon area) counters of queued players and the roles they can
+        // fill, maintained on enqueue/dequeue so the match passes can reject a
+        // hopeless bucket in O(1) instead of iterating every queued player
+        struct AreaRoleCounts
+        {
+            uint32 players = 0;
+            uint32 roleCapable[3] = {};                     // tank/healer/damage capable players
+        };
+        typedef std::map<std::pair<uint32, uint32>, AreaRoleCounts> AreaBucketMap;
+
+        void AccountPlayer(LFGPlayerQueueInfo const& playerInfo, bool add);
+
         typedef std::map<ObjectGuid, LFGPlayerQueueInfo> QueuedPlayersMap;
         QueuedPlayersMap m_queuedPlayers;
         QueuedPlayersMap m_offlinePlayers;
 
+        AreaBucketMap m_areaBuckets;
+
         typedef std::map<uint32, LFGGroupQueueInfo> QueuedGroupsMap;
         QueuedGroupsMap m_queuedGroups;
 
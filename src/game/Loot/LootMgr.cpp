@@ -189,6 +189,10 @@ void LootStore::LoadLootTable()
 
         Verify(); // Checks validity of the loot store
 
+        // Templates are complete now - precompute the per-group alias tables for O(1) rolls
+        for (auto& lTpl : m_LootTemplates)
+            lTpl.second.PrecomputeSelection();
+
         sLog.outString(">> Loaded %u loot definitions (" SIZEFMTD " templates) from table %s", count, m_LootTemplates.size(), GetName());
         sLog.outString();
     }
@@ -285,6 +289,17 @@ bool LootStore::CheckLootRefs(LootIdSet* ref_set /*= nullptr*/)
         }
     }
 
+    // (re)cache the resolved reference pointers - this runs at startup once the reference
+    // store is loaded and again on every reload path, so stale pointers cannot survive
+    for (auto& lTpl : m_LootTemplates)
+        lTpl.second.ResolveReferences();
+
+    // with the pointers resolved, collapse guaranteed reference entries into the templates
+    // themselves - the common kill roll then walks plain entries with no indirection at all
+    // (idempotent: inlined references are erased, so a repeated check pass finds none)
+    for (auto& lTpl : m_LootTemplates)
+        lTpl.second.InlineReferences();
+
     return noIssue;
 }
 
@@ -2482,39 +2497,125 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem const& item)
         EqualChanced.push_back(item);
 }
 
+// Precomputes the Walker/Vose alias table over the explicitly chanced entries (at loading stage)
+// The per-entry chances plus the residual miss mass are baked into O(1) sampling; groups with
+// conditional entries, >= 100% entries or an over-100% total keep the ordered linear roll
+void LootTemplate::LootGroup::BuildAliasTable()
+{
+    AliasProb.clear();
+    AliasIndex.clear();
+
+    if (ExplicitlyChanced.empty())
+        return;
+
+    float total = 0.0f;
+    for (auto const& lsi : ExplicitlyChanced)
+    {
+        if (lsi.conditionId || lsi.chance >= 100.0f)
+            return; // per-player conditions and guaranteed entries depend on the roll order
+        total += lsi.chance;
+    }
+
+    if (total > 100.0f)
+        return; // over-100% groups keep the truncating walk (Verify() already reports them)
+
+    // outcome count is entries plus one trailing miss slot (fall through to the equal chanced part)
+    uint32 const count = uint32(ExplicitlyChanced.size()) + 1;
+    std::vector<float> scaled(count);
+    for (uint32 i = 0; i < count - 1; ++i)
+        scaled[i] = ExplicitlyChanced[i].chance * count / 100.0f;
+    scaled[count - 1] = (100.0f - total) * count / 100.0f;
+
+    AliasProb.resize(count);
+    AliasIndex.resize(count);
+
+    std::vector<uint32> small, large;
+    for (uint32 i = 0; i < count; ++i)
+        (scaled[i] < 1.0f ? small : large).push_back(i);
+
+    while (!small.empty() && !large.empty())
+    {
+        uint32 less = small.back(); small.pop_back();
+        uint32 more = large.back(); large.pop_back();
+
+        AliasProb[less] = scaled[less];
+        AliasIndex[less] = more;
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0f;
+        (scaled[more] < 1.0f ? small : large).push_back(more);
+    }
+
+    // leftovers of either worklist are full columns (modulo float drift)
+    for (uint32 i : large)
+    {
+        AliasProb[i] = 1.0f;
+        AliasIndex[i] = i;
+    }
+    for (uint32 i : small)
+    {
+        AliasProb[i] = 1.0f;
+        AliasIndex[i] = i;
+    }
+}
+
+// Caches the resolved reference template pointers (at loading stage)
+void LootTemplate::LootGroup::ResolveReferences()
+{
+    for (auto& lsi : ExplicitlyChanced)
+        if (lsi.mincountOrRef < 0)
+            lsi.refTemplate = LootTemplates_Reference.GetLootFor(-lsi.mincountOrRef);
+
+    for (auto& lsi : EqualChanced)
+        if (lsi.mincountOrRef < 0)
+            lsi.refTemplate = LootTemplates_Reference.GetLootFor(-lsi.mincountOrRef);
+}
+
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot const& loot, Player const* lootOwner) const
 {
     if (!ExplicitlyChanced.empty()) // First explicitly chanced entries are checked
     {
-        std::vector<LootStoreItem const*> lootStoreItemVector; // we'll use new vector to make easy the randomization
+        if (!AliasProb.empty()) // O(1) precomputed sampling - the group has no conditional entries
+        {
+            uint32 column = urand(0, uint32(AliasProb.size() - 1));
+            uint32 outcome = rand_norm_f() < AliasProb[column] ? column : AliasIndex[column];
 
-        // fill the new vector with correct pointer to our item list
-        for (auto& itr : ExplicitlyChanced)
-            lootStoreItemVector.push_back(&itr);
+            if (outcome < ExplicitlyChanced.size())
+                return &ExplicitlyChanced[outcome];
 
-        // randomize the new vector
-        shuffle(lootStoreItemVector.begin(), lootStoreItemVector.end(), *GetRandomGenerator());
+            // trailing miss slot hit - fall through to the equal chanced part
+        }
+        else
+        {
+            std::vector<LootStoreItem const*> lootStoreItemVector; // we'll use new vector to make easy the randomization
 
-        float chance = rand_chance_f();
+            // fill the new vector with correct pointer to our item list
+            for (auto& itr : ExplicitlyChanced)
+                lootStoreItemVector.push_back(&itr);
 
-        // as the new vector is randomized we can start from first element and stop at first one that meet the condition
-        for (std::vector<LootStoreItem const*>::const_iterator itr = lootStoreItemVector.begin(); itr != lootStoreItemVector.end(); ++itr)
-        {
-            LootStoreItem const* lsi = *itr;
+            // randomize the new vector
+            shuffle(lootStoreItemVector.begin(), lootStoreItemVector.end(), *GetRandomGenerator());
 
-            if (lsi->conditionId && lootOwner && !LootTemplate::PlayerOrGroupFulfilsCondition(loot, lootOwner, lsi->conditionId))
+            float chance = rand_chance_f();
+
+            // as the new vector is randomized we can start from first element and stop at first one that meet the condition
+            for (std::vector<LootStoreItem const*>::const_iterator itr = lootStoreItemVector.begin(); itr != lootStoreItemVector.end(); ++itr)
             {
-                sLog.outDebug("In explicit chance -> This item cannot be added! (%u)", lsi->itemid);
-                continue;
-            }
+                LootStoreItem const* lsi = *itr;
+
+                if (lsi->conditionId && lootOwner && !LootTemplate::PlayerOrGroupFulfilsCondition(loot, lootOwner, lsi->conditionId))
+                {
+                    sLog.outDebug("In explicit chance -> This item cannot be added! (%u)", lsi->itemid);
+                    continue;
+                }
 
-            if (lsi->chance >= 100.0f)
-                return lsi;
+                if (lsi->chance >= 100.0f)
+                    return lsi;
 
-            chance -= lsi->chance;
-            if (chance < 0)
-                return lsi;
+                chance -= lsi->chance;
+                if (chance < 0)
+                    return lsi;
+            }
         }
     }
 
@@ -2623,6 +2724,19 @@ void LootTemplate::LootGroup::Process(Loot& loot, Player const* lootOwner, bool
     }
 }
 
+// Same as above, but rolled references are queued on the caller's worklist instead of recursing
+void LootTemplate::LootGroup::Process(Loot& loot, Player const* lootOwner, bool rate, LootProcessList& worklist) const
+{
+    LootStoreItem const* item = Roll(loot, lootOwner);
+    if (item == nullptr)
+        return;
+
+    if (item->mincountOrRef > 0)
+        loot.AddItem(*item);
+    else if (LootTemplate const* lRef = item->refTemplate ? item->refTemplate : LootTemplates_Reference.GetLootFor(-item->mincountOrRef))
+        worklist.push_back(std::make_pair(lRef, uint32(item->maxcount)));
+}
+
 // Overall chance for the group without equal chanced items
 float LootTemplate::LootGroup::RawTotalChance() const
 {
@@ -2698,12 +2812,27 @@ void LootTemplate::AddEntry(LootStoreItem const& item)
 // Rolls for every item in the template and adds the rolled items the the loot
 void LootTemplate::Process(Loot& loot, Player const* lootOwner, bool rate, LootStatsData* lootStatsData /*= nullptr*/) const
 {
-    LootStats::GroupStats* groupStats = nullptr;
-    if (lootStatsData)
+    if (!lootStatsData)
     {
-        groupStats = lootStatsData->stats->GetStatsForLootId(lootStatsData->groupIdOrItemId);
+        // Hot path: an explicit worklist replaces the recursion through references
+        // (loops were already cut at loading stage so the worklist always drains)
+        LootProcessList worklist;
+        ProcessWork(loot, lootOwner, rate, worklist);
+
+        while (!worklist.empty())
+        {
+            std::pair<LootTemplate const*, uint32> work = worklist.back();
+            worklist.pop_back();
+
+            for (uint32 loop = 0; loop < work.second; ++loop) // Ref multiplicator
+                work.first->ProcessWork(loot, lootOwner, rate, worklist);
+        }
+        return;
     }
 
+    // Stats collection keeps the recursive walk - it scopes a LootStatsData per reference
+    LootStats::GroupStats* groupStats = lootStatsData->stats->GetStatsForLootId(lootStatsData->groupIdOrItemId);
+
     // Rolling non-grouped items
     for (auto const& Entrie : Entries)
     {
@@ -2748,6 +2877,102 @@ void LootTemplate::Process(Loot& loot, Player const* lootOwner, bool rate, LootS
         Group.Process(loot, lootOwner, rate, lootStatsData);
 }
 
+// One pass over the template's entries and groups; rolled references are queued on the
+// worklist (together with their Ref multiplicator) instead of being processed recursively
+void LootTemplate::ProcessWork(Loot& loot, Player const* lootOwner, bool rate, LootProcessList& worklist) const
+{
+    // Rolling non-grouped items
+    for (auto const& Entrie : Entries)
+    {
+        // Check condition
+        if (Entrie.conditionId && lootOwner && !PlayerOrGroupFulfilsCondition(loot, lootOwner, Entrie.conditionId))
+            continue;
+
+        if (!Entrie.Roll(rate))
+            continue; // Bad luck for the entry
+
+        if (Entrie.mincountOrRef < 0) // References processing
+        {
+            LootTemplate const* Referenced = Entrie.refTemplate ? Entrie.refTemplate : LootTemplates_Reference.GetLootFor(-Entrie.mincountOrRef);
+
+            if (!Referenced)
+                continue; // Error message already printed at loading stage
+
+            worklist.push_back(std::make_pair(Referenced, uint32(Entrie.maxcount)));
+        }
+        else // Plain entries (not a reference, not grouped)
+            loot.AddItem(Entrie); // Chance is already checked, just add
+    }
+
+    // Now processing groups
+    for (auto const& Group : Groups)
+        Group.Process(loot, lootOwner, rate, worklist);
+}
+
+// Precomputes the per-group alias tables (at loading stage)
+void LootTemplate::PrecomputeSelection()
+{
+    for (auto& Group : Groups)
+        Group.BuildAliasTable();
+}
+
+// Caches the resolved reference template pointers (at loading stage)
+void LootTemplate::ResolveReferences()
+{
+    for (auto& Entrie : Entries)
+        if (Entrie.mincountOrRef < 0)
+            Entrie.refTemplate = LootTemplates_Reference.GetLootFor(-Entrie.mincountOrRef);
+
+    for (auto& Group : Groups)
+        Group.ResolveReferences();
+}
+
+// Upper bound on entries/groups copied into one template by InlineReferences - chains
+// that would expand past it keep the runtime worklist resolution instead
+static uint32 const LOOT_INLINE_EXPANSION_BUDGET = 256;
+
+// Inlines guaranteed reference entries (chance >= 100, unconditional) at loading stage:
+// each is replaced by copies of the referenced template's entries and groups, once per
+// Ref multiplicator - an exact expansion, since every iteration rolls independently.
+// The budget strictly decreases per inline, so cut loops and pathological chains
+// terminate and simply stay as runtime-resolved references
+void LootTemplate::InlineReferences()
+{
+    uint32 budget = LOOT_INLINE_EXPANSION_BUDGET;
+
+    for (size_t i = 0; i < Entries.size();)
+    {
+        LootStoreItem const& lsi = Entries[i];
+
+        if (lsi.mincountOrRef >= 0 || !lsi.refTemplate || lsi.refTemplate == this || lsi.chance < 100.0f || lsi.conditionId)
+        {
+            ++i; // not a reference, or its roll/condition must stay a runtime decision
+            continue;
+        }
+
+        LootTemplate const* referenced = lsi.refTemplate;
+        uint32 repeats = lsi.maxcount;
+        uint32 cost = uint32(referenced->Entries.size() + referenced->Groups.size()) * repeats;
+
+        if (cost > budget)
+        {
+            ++i;
+            continue;
+        }
+
+        budget -= cost;
+        Entries.erase(Entries.begin() + i);
+
+        for (uint32 loop = 0; loop < repeats; ++loop)
+        {
+            Entries.insert(Entries.end(), referenced->Entries.begin(), referenced->Entries.end());
+            Groups.insert(Groups.end(), referenced->Groups.begin(), referenced->Groups.end());
+        }
+        // no ++i: the slot now holds the next original entry, and inlined entries at the
+        // tail are rescanned so guaranteed sub-references collapse in the same pass
+    }
+}
+
 // True if template includes at least 1 quest drop entry
 bool LootTemplate::HasQuestDrop(uint8 groupId) const
 {
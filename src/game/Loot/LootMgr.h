@@ -22,6 +22,7 @@
 #include "Util/ByteBuffer.h"
 #include "Entities/ObjectGuid.h"
 #include "Globals/SharedDefines.h"
+#include "World/MemoryTrend.h"
 
 #include <array>
 #include <vector>
@@ -211,12 +212,13 @@ struct LootStoreItem
     bool    needs_quest : 1;                                // quest drop (negative ChanceOrQuestChance in DB)
     uint8   maxcount    : 8;                                // max drop count for the item (mincountOrRef positive) or Ref multiplicator (mincountOrRef negative)
     uint16  conditionId : 16;                               // additional loot condition Id
+    LootTemplate const* refTemplate;                        // resolved reference template (mincountOrRef negative), cached after loading to skip the store lookup at roll time
 
     // Constructor, converting ChanceOrQuestChance -> (chance, needs_quest)
     // displayid is filled in IsValid() which must be called after
     LootStoreItem(uint32 _itemIndex, uint32 _itemid, float _chanceOrQuestChance, int8 _group, uint16 _conditionId, int32 _mincountOrRef, uint8 _maxcount)
         : itemIndex(_itemIndex), itemid(_itemid), chance(fabs(_chanceOrQuestChance)), mincountOrRef(_mincountOrRef),
-          group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), conditionId(_conditionId)
+          group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), conditionId(_conditionId), refTemplate(nullptr)
     {}
 
     bool Roll(bool rate) const;                             // Checks if the entry takes it's chance (at loot generation)
@@ -262,6 +264,7 @@ typedef std::vector<LootItem*> LootItemList;
 typedef std::vector<LootStoreItem> LootStoreItemList;
 typedef std::unordered_map<uint32, LootTemplate> LootTemplateMap;
 typedef std::set<uint32> LootIdSet;
+typedef std::vector<std::pair<LootTemplate const*, uint32>> LootProcessList; // referenced template + Ref multiplicator, used to flatten reference recursion
 
 class LootTemplate
 {
@@ -275,15 +278,21 @@ class LootTemplate
                 // The same for active quests of the player
                 // Rolls an item from the group (if any) and adds the item to the loot
                 void Process(Loot& loot, Player const* lootOwner, bool rate, LootStatsData* lootStats = nullptr) const;
+                // Same, but queues rolled references on the worklist instead of recursing
+                void Process(Loot& loot, Player const* lootOwner, bool rate, LootProcessList& worklist) const;
                 float RawTotalChance() const;                       // Overall chance for the group (without equal chanced items)
                 float TotalChance() const;                          // Overall chance for the group
 
+                void BuildAliasTable();                             // Precomputes the alias table for O(1) explicit rolls (at loading stage)
+                void ResolveReferences();                           // Caches resolved reference template pointers (at loading stage)
                 void Verify(LootStore const& lootstore, uint32 id, uint32 group_id) const;
                 bool CheckLootRefs(LootIdSet* ref_set, LootIdSet& prevRefs);
 
             private:
                 LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
                 LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+                std::vector<float>  AliasProb;                      // Walker/Vose alias table over ExplicitlyChanced plus a trailing miss slot
+                std::vector<uint32> AliasIndex;                     // empty if the group needs the ordered linear roll (conditions, >= 100% chances)
 
                 // Rolls an item from the group, returns nullptr if all miss their chances
                 LootStoreItem const* Roll(Loot const& loot, Player const* lootOwner) const;
@@ -303,10 +312,20 @@ class LootTemplate
         // True if at least one player fulfills loot condition
         static bool PlayerOrGroupFulfilsCondition(const Loot& loot, Player const* lootOwner, uint16 conditionId);
 
+        // Precomputes the per-group alias tables (at loading stage)
+        void PrecomputeSelection();
+        // Caches resolved reference template pointers (at loading stage)
+        void ResolveReferences();
+        // Inlines guaranteed reference entries into the template (at loading stage)
+        void InlineReferences();
+
         // Checks integrity of the template
         void Verify(LootStore const& lootstore, uint32 id) const;
         bool CheckLootRefs(LootIdSet* ref_set, LootIdSet& prevRefs);
     private:
+        // One pass over the template, queueing rolled references on the worklist instead of recursing
+        void ProcessWork(Loot& loot, Player const* lootOwner, bool rate, LootProcessList& worklist) const;
+
         LootStoreItemList Entries;                          // not grouped only
         LootGroups        Groups;                           // groups have own (optimized) processing, grouped entries go there
 };
@@ -441,6 +460,8 @@ class Loot
         Item*            m_itemTarget;
         ObjectGuid       m_guidTarget;
 
+        MemTrendCounted<MEMTREND_LOOT> m_memTrendMark;    // live-instance marker for .server memtrend
+
         LootItemList     m_lootItems;                     // store of the items contained in loot
         uint32           m_gold;                          // amount of money contained in loot
         uint32           m_maxSlot;                       // used to increment slot index and get total items count
@@ -313,19 +313,35 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
     time_t expire_time = deliver_time + expire_delay;
 
     // Add to DB
-    std::string safe_subject = GetSubject();
+    static SqlStatementID insertMail;
+    static SqlStatementID insertMailItem;
 
     CharacterDatabase.BeginTransaction();
-    CharacterDatabase.escape_string(safe_subject);
-    CharacterDatabase.PExecute("INSERT INTO mail (id,messageType,stationery,mailTemplateId,sender,receiver,subject,itemTextId,has_items,expire_time,deliver_time,money,cod,checked) "
-                               "VALUES ('%u', '%u', '%u', '%u', '%u', '%u', '%s', '%u', '%u', '" UI64FMTD "','" UI64FMTD "', '%u', '%u', '%u')",
-                               mailId, sender.GetMailMessageType(), sender.GetStationery(), GetMailTemplateId(), sender.GetSenderId(), receiver.GetPlayerGuid().GetCounter(), safe_subject.c_str(), GetBodyId(), (has_items ? 1 : 0), (uint64)expire_time, (uint64)deliver_time, m_money, m_COD, checked);
+
+    SqlStatement stmt = CharacterDatabase.CreateStatement(insertMail,
+        "INSERT INTO mail (id,messageType,stationery,mailTemplateId,sender,receiver,subject,itemTextId,has_items,expire_time,deliver_time,money,cod,checked) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+    stmt.addUInt32(mailId);
+    stmt.addUInt8(uint8(sender.GetMailMessageType()));
+    stmt.addUInt8(uint8(sender.GetStationery()));
+    stmt.addUInt16(GetMailTemplateId());
+    stmt.addUInt32(sender.GetSenderId());
+    stmt.addUInt32(receiver.GetPlayerGuid().GetCounter());
+    stmt.addString(GetSubject());
+    stmt.addUInt32(GetBodyId());
+    stmt.addUInt32(has_items ? 1 : 0);
+    stmt.addUInt64(uint64(expire_time));
+    stmt.addUInt64(uint64(deliver_time));
+    stmt.addUInt32(m_money);
+    stmt.addUInt32(m_COD);
+    stmt.addUInt32(checked);
+    stmt.Execute();
 
     for (MailItemMap::const_iterator mailItemIter = m_items.begin(); mailItemIter != m_items.end(); ++mailItemIter)
     {
         Item* item = mailItemIter->second;
-        CharacterDatabase.PExecute("INSERT INTO mail_items (mail_id,item_guid,item_template,receiver) VALUES ('%u', '%u', '%u','%u')",
-                                   mailId, item->GetGUIDLow(), item->GetEntry(), receiver.GetPlayerGuid().GetCounter());
+        stmt = CharacterDatabase.CreateStatement(insertMailItem, "INSERT INTO mail_items (mail_id,item_guid,item_template,receiver) VALUES (?, ?, ?, ?)");
+        stmt.PExecute(mailId, item->GetGUIDLow(), item->GetEntry(), receiver.GetPlayerGuid().GetCounter());
     }
     CharacterDatabase.CommitTransaction();
 
@@ -369,6 +385,56 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
         deleteIncludedItems();
 }
 
+/**
+ * Clones this draft for an offline receiver and appends the generated rows to the batch.
+ *
+ * Matches the CloneFrom + SendMailTo semantics: the body text is cloned to a fresh
+ * item_text row, attached items are cloned and saved to DB (the in-memory copy is
+ * deleted like the offline SendMailTo path does), and the mail / mail_items tuples
+ * are appended for the caller to flush in one multi-row insert per statement.
+ */
+void MailDraft::SendMailBatchTo(uint32 receiverLowGuid, MailSender const& sender, MailCheckMask checked, std::ostringstream& mailValues, std::ostringstream& mailItemValues)
+{
+    uint32 mailId = sObjectMgr.GenerateMailID();
+
+    // mail body is per-mail data, clone it like CloneFrom does
+    uint32 bodyId = m_bodyId ? sObjectMgr.CreateItemText(sObjectMgr.GetItemText(m_bodyId)) : 0;
+
+    bool has_items = false;
+    for (const auto& m_item : m_items)
+    {
+        Item* item = m_item.second;
+
+        if (Item* newitem = item->CloneItem(item->GetCount()))
+        {
+            newitem->SaveToDB();
+
+            if (mailItemValues.tellp())
+                mailItemValues << ",";
+            mailItemValues << "('" << mailId << "', '" << newitem->GetGUIDLow() << "', '" << newitem->GetEntry() << "','" << receiverLowGuid << "')";
+
+            // the receiver is offline, only the DB row is needed
+            delete newitem;
+            has_items = true;
+        }
+    }
+
+    time_t deliver_time = time(nullptr);
+    // expire time if COD 3 days, if no COD 30 days; the auction/battlemaster
+    // special cases of SendMailTo never go through the mass mailer
+    uint32 expire_delay = (m_COD > 0) ? 3 * DAY : 30 * DAY;
+    time_t expire_time = deliver_time + expire_delay;
+
+    std::string safe_subject = GetSubject();
+    CharacterDatabase.escape_string(safe_subject);
+
+    if (mailValues.tellp())
+        mailValues << ",";
+    mailValues << "('" << mailId << "', '" << uint32(sender.GetMailMessageType()) << "', '" << uint32(sender.GetStationery()) << "', '" << GetMailTemplateId()
+               << "', '" << sender.GetSenderId() << "', '" << receiverLowGuid << "', '" << safe_subject << "', '" << bodyId << "', '" << (has_items ? 1 : 0)
+               << "', '" << uint64(expire_time) << "', '" << uint64(deliver_time) << "', '" << m_money << "', '" << m_COD << "', '" << uint32(checked) << "')";
+}
+
 /**
  * Generate items from template at mails loading (this happens when mail with mail template items send in time when receiver has been offline)
  *
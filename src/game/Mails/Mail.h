@@ -252,6 +252,13 @@ class MailDraft
     public:                                                 // finishers
         void SendReturnToSender(uint32 sender_acc, ObjectGuid sender_guid, ObjectGuid receiver_guid);
         void SendMailTo(MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE, uint32 deliver_delay = 0);
+        /**
+         * Bulk variant of CloneFrom + SendMailTo for offline receivers: clones the
+         * draft content for one receiver and appends the mail / mail_items value
+         * tuples to the passed streams instead of executing per-mail statements.
+         * The caller flushes the collected tuples as multi-row inserts.
+         */
+        void SendMailBatchTo(uint32 receiverLowGuid, MailSender const& sender, MailCheckMask checked, std::ostringstream& mailValues, std::ostringstream& mailItemValues);
     private:
         MailDraft(MailDraft const&);                        // trap decl, no body, mail draft must cloned only explicitly...
         MailDraft& operator=(MailDraft const&);             // trap decl, no body, ...because items clone is high price operation
@@ -544,6 +544,22 @@ void WorldSession::HandleGetMailList(WorldPacket& recv_data)
     if (!CheckMailBox(mailboxGuid))
         return;
 
+    // mailbox contents load on first use; the list is sent when the query returns
+    if (!_player->AreMailsLoaded())
+    {
+        _player->LoadMailsAsync();
+        return;
+    }
+
+    SendMailListResult();
+}
+
+/**
+ * Builds and sends the mail list for the current player's loaded mailbox.
+ * Split from HandleGetMailList so the lazy mailbox load can replay the request.
+ */
+void WorldSession::SendMailListResult()
+{
     uint32 mailsCount = 0;                                  // send to client mails amount
 
     WorldPacket data(SMSG_MAIL_LIST_RESULT, (200));         // guess size
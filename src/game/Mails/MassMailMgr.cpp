@@ -71,36 +71,109 @@ void MassMailMgr::AddMassMailTask(MailDraft* mailProto, const MailSender& sender
     CharacterDatabase.AsyncPQuery(&massMailerQueryHandler, &MassMailerQueryHandler::HandleQueryCallback, mailProto, sender, "%s", query);
 }
 
+/// amount of rows per multi-row insert statement, bounds the statement size
+#define MASS_MAIL_FLUSH_SIZE 500
+
 void MassMailMgr::Update(bool sendall /*= false*/)
 {
     if (m_massMails.empty())
         return;
 
     uint32 maxcount = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK);
+    uint32 maxbatch = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_BATCH_PER_TICK);
+
+    // rows collected for offline receivers, flushed as multi-row inserts in one
+    // transaction; execution happens on the DB delay thread like any other
+    // async statement, so the world thread only pays for building the strings
+    std::ostringstream mailValues;
+    std::ostringstream mailItemValues;
+    uint32 batched = 0;
+
+    auto flushBatch = [&]()
+    {
+        if (!mailValues.tellp())
+            return;
+
+        CharacterDatabase.BeginTransaction();
+        std::ostringstream query;
+        query << "INSERT INTO mail (id,messageType,stationery,mailTemplateId,sender,receiver,subject,itemTextId,has_items,expire_time,deliver_time,money,cod,checked) VALUES " << mailValues.str();
+        CharacterDatabase.Execute(query.str().c_str());     // needs to be run this way, because mail body may be more than 1024 characters
+        if (mailItemValues.tellp())
+        {
+            std::ostringstream itemsQuery;
+            itemsQuery << "INSERT INTO mail_items (mail_id,item_guid,item_template,receiver) VALUES " << mailItemValues.str();
+            CharacterDatabase.Execute(itemsQuery.str().c_str());
+        }
+        CharacterDatabase.CommitTransaction();
+
+        mailValues.str("");
+        mailItemValues.str("");
+        batched = 0;
+    };
+
+    bool stalled = false;
 
     do
     {
         MassMail& task = m_massMails.front();
 
-        while (!task.m_receivers.empty() && (sendall || maxcount > 0))
+        while (!task.m_receivers.empty())
         {
             uint32 receiver_lowguid = *task.m_receivers.begin();
-            task.m_receivers.erase(task.m_receivers.begin());
 
             ObjectGuid receiver_guid = ObjectGuid(HIGHGUID_PLAYER, receiver_lowguid);
             Player* receiver = sObjectMgr.GetPlayer(receiver_guid);
 
             // last case. can be just send
-            if (task.m_receivers.empty())
+            if (task.m_receivers.size() == 1)
             {
+                task.m_receivers.erase(task.m_receivers.begin());
+
                 // prevent mail return
                 task.m_protoMail->SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
 
-                if (!sendall)
+                if (!sendall && maxcount > 0)
                     --maxcount;
                 break;
             }
 
+            if (!receiver)
+            {
+                // bulk path: offline receivers only need DB rows, no in-game
+                // notification, so they drain at the (much higher) batch rate
+                if (!sendall && maxbatch == 0)
+                {
+                    stalled = true;
+                    break;
+                }
+
+                task.m_receivers.erase(task.m_receivers.begin());
+
+                // receiver must still exist (not deleted since the task was queued)
+                if (sObjectMgr.GetPlayerAccountIdByGUID(receiver_guid))
+                {
+                    // prevent mail return
+                    task.m_protoMail->SendMailBatchTo(receiver_lowguid, task.m_sender, MAIL_CHECK_MASK_RETURNED, mailValues, mailItemValues);
+
+                    if (++batched >= MASS_MAIL_FLUSH_SIZE)
+                        flushBatch();
+                }
+
+                if (!sendall)
+                    --maxbatch;
+                continue;
+            }
+
+            // online receivers keep the normal SendMailTo path, which also
+            // delivers the in-game mail and the new mail notification
+            if (!sendall && maxcount == 0)
+            {
+                stalled = true;
+                break;
+            }
+
+            task.m_receivers.erase(task.m_receivers.begin());
+
             // need clone draft
             MailDraft draft;
             draft.CloneFrom(*task.m_protoMail);
@@ -115,7 +188,9 @@ void MassMailMgr::Update(bool sendall /*= false*/)
         if (task.m_receivers.empty())
             m_massMails.pop_front();
     }
-    while (!m_massMails.empty() && (sendall || maxcount > 0));
+    while (!m_massMails.empty() && !stalled && (sendall || maxcount > 0 || maxbatch > 0));
+
+    flushBatch();
 }
 
 void MassMailMgr::GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) const
@@ -29,6 +29,8 @@
 #include "Policies/Singleton.h"
 #include "Util/Util.h"
 
+#include <G3D/Vector3.h>
+
 #include <mutex>
 
 char const* MAP_MAGIC         = "MAPS";
@@ -199,6 +201,48 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             m_gridGetHeight = &GridMap::getHeightFromUint8;
         }
+        else if (sWorld.getConfig(CONFIG_BOOL_TERRAIN_QUANTIZE_FLOAT_HEIGHTS))
+        {
+            // quantize float-stored tiles to uint16 plus a per-tile scale:
+            // halves resident height memory, worst case error is
+            // (max - min) / 65535 per tile - far below gameplay precision
+            float* V9 = new float [129 * 129];
+            float* V8 = new float [128 * 128];
+            fread(V9, sizeof(float), 129 * 129, in);
+            fread(V8, sizeof(float), 128 * 128, in);
+
+            float minHeight = V9[0];
+            float maxHeight = V9[0];
+            for (int i = 0; i < 129 * 129; ++i)
+            {
+                minHeight = std::min(minHeight, V9[i]);
+                maxHeight = std::max(maxHeight, V9[i]);
+            }
+            for (int i = 0; i < 128 * 128; ++i)
+            {
+                minHeight = std::min(minHeight, V8[i]);
+                maxHeight = std::max(maxHeight, V8[i]);
+            }
+
+            m_gridHeight = minHeight;
+            if (maxHeight > minHeight)
+            {
+                float const step = 65535.0f / (maxHeight - minHeight);
+                m_uint16_V9 = new uint16 [129 * 129];
+                m_uint16_V8 = new uint16 [128 * 128];
+                for (int i = 0; i < 129 * 129; ++i)
+                    m_uint16_V9[i] = uint16((V9[i] - minHeight) * step + 0.5f);
+                for (int i = 0; i < 128 * 128; ++i)
+                    m_uint16_V8[i] = uint16((V8[i] - minHeight) * step + 0.5f);
+                m_gridIntHeightMultiplier = (maxHeight - minHeight) / 65535;
+                m_gridGetHeight = &GridMap::getHeightFromUint16;
+            }
+            else                                            // completely level tile
+                m_gridGetHeight = &GridMap::getHeightFromFlat;
+
+            delete[] V9;
+            delete[] V8;
+        }
         else
         {
             m_V9 = new float [129 * 129];
@@ -258,6 +302,35 @@ bool GridMap::loadGridMapLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
     return true;
 }
 
+uint32 GridMap::GetMemoryUsage() const
+{
+    uint32 total = sizeof(GridMap);
+
+    if (m_area_map)
+        total += 16 * 16 * sizeof(uint16);
+
+    if (m_V9 && m_V8)
+    {
+        // the union representation is determined by the height getter in use
+        uint32 elementSize = sizeof(float);
+        if (m_gridGetHeight == &GridMap::getHeightFromUint16)
+            elementSize = sizeof(uint16);
+        else if (m_gridGetHeight == &GridMap::getHeightFromUint8)
+            elementSize = sizeof(uint8);
+
+        total += (129 * 129 + 128 * 128) * elementSize;
+    }
+
+    if (m_liquidEntry)
+        total += 16 * 16 * sizeof(uint16);
+    if (m_liquidFlags)
+        total += 16 * 16 * sizeof(uint8);
+    if (m_liquid_map)
+        total += m_liquid_width * m_liquid_height * sizeof(float);
+
+    return total;
+}
+
 uint16 GridMap::getArea(float x, float y) const
 {
     if (!m_area_map)
@@ -742,6 +815,37 @@ GridMap* TerrainInfo::Load(const uint32 x, const uint32 y, bool mapOnly /*= fals
     return pMap;
 }
 
+void TerrainInfo::Prefetch(const uint32 x, const uint32 y)
+{
+    MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
+    MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
+
+    // no RefGrid here - a grid nobody reaches stays unreferenced and gets
+    // swept by the next CleanUpGrids pass instead of being pinned forever;
+    // LoadMapAndVMap early-outs cheaply when everything is already loaded
+    LoadMapAndVMap(x, y);
+}
+
+void TerrainInfo::GetMemoryUsage(uint32& tiles, uint64& bytes)
+{
+    tiles = 0;
+    bytes = 0;
+
+    // lock against concurrent tile loads from map workers / prefetcher
+    LOCK_GUARD lock(m_mutex);
+    for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+    {
+        for (int y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+        {
+            if (GridMap* grid = m_GridMaps[x][y])
+            {
+                ++tiles;
+                bytes += grid->GetMemoryUsage();
+            }
+        }
+    }
+}
+
 // schedule lazy GridMap object cleanup
 void TerrainInfo::Unload(const uint32 x, const uint32 y)
 {
@@ -766,6 +870,10 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
     if (!i_timer.Passed())
         return;
 
+    // exclusive with LoadMapAndVMap - the prefetcher populates unreferenced
+    // grids from its worker thread while this sweep may run
+    LOCK_GUARD lock(m_mutex);
+
     for (int y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
     {
         for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
@@ -825,13 +933,50 @@ int TerrainInfo::UnrefGrid(const uint32& x, const uint32& y)
     return 0;
 }
 
+GridMap* TerrainInfo::GetGridCached(TerrainCursor& cursor, const float x, const float y) const
+{
+    int gx = (int)(32 - x / SIZE_OF_GRIDS);                 // grid x
+    int gy = (int)(32 - y / SIZE_OF_GRIDS);                 // grid y
+
+    // cursor hit: same tile as the last query and the slot still holds the
+    // cached grid (the slot changes when the tile is unloaded or reloaded)
+    if (cursor.grid && cursor.gx == gx && cursor.gy == gy && m_GridMaps[gx][gy] == cursor.grid)
+        return cursor.grid;
+
+    GridMap* grid = const_cast<TerrainInfo*>(this)->GetGrid(x, y);
+    cursor.grid = grid;
+    cursor.gx = gx;
+    cursor.gy = gy;
+    return grid;
+}
+
 float TerrainInfo::GetHeightStatic(float x, float y, float z, bool useVmaps/*=true*/, float maxSearchDist/*=DEFAULT_HEIGHT_SEARCH*/) const
+{
+    return GetHeightInternal(const_cast<TerrainInfo*>(this)->GetGrid(x, y), x, y, z, useVmaps, maxSearchDist);
+}
+
+float TerrainInfo::GetHeightStatic(TerrainCursor& cursor, float x, float y, float z, bool useVmaps/*=true*/, float maxSearchDist/*=DEFAULT_HEIGHT_SEARCH*/) const
+{
+    return GetHeightInternal(GetGridCached(cursor, x, y), x, y, z, useVmaps, maxSearchDist);
+}
+
+void TerrainInfo::GetHeightsStatic(TerrainCursor& cursor, G3D::Vector3* points, size_t count, bool useVmaps/*=true*/) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        float const height = GetHeightInternal(GetGridCached(cursor, points[i].x, points[i].y), points[i].x, points[i].y, points[i].z, useVmaps, DEFAULT_HEIGHT_SEARCH);
+        if (height > INVALID_HEIGHT)
+            points[i].z = height;
+    }
+}
+
+float TerrainInfo::GetHeightInternal(GridMap* gmap, float x, float y, float z, bool useVmaps, float maxSearchDist) const
 {
     float mapHeight = VMAP_INVALID_HEIGHT_VALUE;            // Store Height obtained by maps
     float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;           // Store Height obtained by vmaps (in "corridor" of z (or slightly above z)
 
     // find raw .map surface under Z coordinates (or well-defined above)
-    if (GridMap* gmap = const_cast<TerrainInfo*>(this)->GetGrid(x, y))
+    if (gmap)
         mapHeight = gmap->getHeight(x, y);
 
     if (useVmaps)
@@ -1044,11 +1189,17 @@ void TerrainInfo::GetZoneAndAreaId(uint32& zoneid, uint32& areaid, float x, floa
 }
 
 GridMapLiquidStatus TerrainInfo::getLiquidStatus(float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data, float collisionHeight) const
+{
+    TerrainCursor cursor;
+    return getLiquidStatusInternal(cursor, x, y, z, ReqLiquidType, data, collisionHeight);
+}
+
+GridMapLiquidStatus TerrainInfo::getLiquidStatusInternal(TerrainCursor& cursor, float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data, float collisionHeight) const
 {
     GridMapLiquidStatus result = LIQUID_MAP_NO_WATER;
     uint32 liquid_type = 0;
     float liquid_level = INVALID_HEIGHT_VALUE;
-    float ground_level = GetHeightStatic(x, y, z, true, DEFAULT_WATER_SEARCH);
+    float ground_level = GetHeightStatic(cursor, x, y, z, true, DEFAULT_WATER_SEARCH);
 
     if (m_vmgr->GetLiquidLevel(GetMapId(), x, y, z, ReqLiquidType, liquid_level, ground_level, liquid_type))
     {
@@ -1103,7 +1254,7 @@ GridMapLiquidStatus TerrainInfo::getLiquidStatus(float x, float y, float z, uint
             result = LIQUID_MAP_ABOVE_WATER;
         }
     }
-    else if (GridMap* gmap = const_cast<TerrainInfo*>(this)->GetGrid(x, y))
+    else if (GridMap* gmap = GetGridCached(cursor, x, y))
     {
         GridMapLiquidData map_data;
         GridMapLiquidStatus map_result = gmap->getLiquidStatus(x, y, z, ReqLiquidType, &map_data, collisionHeight);
@@ -1119,6 +1270,49 @@ GridMapLiquidStatus TerrainInfo::getLiquidStatus(float x, float y, float z, uint
     return result;
 }
 
+GridMapLiquidStatus TerrainInfo::getLiquidStatus(LiquidCursor& cursor, float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data, float collisionHeight) const
+{
+    int const gx = (int)(32 - x / SIZE_OF_GRIDS);           // grid x
+    int const gy = (int)(32 - y / SIZE_OF_GRIDS);           // grid y
+
+    // repeated checks on a mover that has not made a step (breath timers, aura
+    // ticks, swim state) resolve to the cached result, as long as the tile slot
+    // still holds the grid the result was computed against
+    for (LiquidCursor::Entry& entry : cursor.entries)
+    {
+        if (entry.valid && entry.x == x && entry.y == y && entry.z == z &&
+                entry.reqLiquidType == ReqLiquidType && entry.collisionHeight == collisionHeight &&
+                entry.tile.gx == gx && entry.tile.gy == gy && m_GridMaps[gx][gy] == entry.tile.grid)
+        {
+            if (data)
+                *data = entry.data;
+            return entry.status;
+        }
+    }
+
+    LiquidCursor::Entry& entry = cursor.entries[cursor.next];
+    cursor.next ^= 1;
+
+    entry.data = GridMapLiquidData();
+    entry.status = getLiquidStatusInternal(entry.tile, x, y, z, ReqLiquidType, &entry.data, collisionHeight);
+    entry.x = x;
+    entry.y = y;
+    entry.z = z;
+    entry.reqLiquidType = ReqLiquidType;
+    entry.collisionHeight = collisionHeight;
+    entry.valid = true;
+
+    if (data)
+        *data = entry.data;
+    return entry.status;
+}
+
+void TerrainInfo::getLiquidStatuses(TerrainCursor& cursor, G3D::Vector3 const* points, size_t count, GridMapLiquidStatus* results, uint8 ReqLiquidType, float collisionHeight) const
+{
+    for (size_t i = 0; i < count; ++i)
+        results[i] = getLiquidStatusInternal(cursor, points[i].x, points[i].y, points[i].z, ReqLiquidType, nullptr, collisionHeight);
+}
+
 bool TerrainInfo::IsInWater(float x, float y, float z, GridMapLiquidData* data) const
 {
     // Check surface in x, y point for liquid
@@ -1169,6 +1363,52 @@ bool TerrainInfo::IsUnderWater(float x, float y, float z, float* pWaterZ/*= null
     return false;
 }
 
+bool TerrainInfo::IsInWater(LiquidCursor& cursor, float x, float y, float z, GridMapLiquidData* data) const
+{
+    // Check surface in x, y point for liquid
+    if (CanCheckLiquidLevel(x, y))
+    {
+        GridMapLiquidData liquid_status;
+        GridMapLiquidData* liquid_ptr = data ? data : &liquid_status;
+        if (getLiquidStatus(cursor, x, y, z, MAP_ALL_LIQUIDS, liquid_ptr))
+            return true;
+    }
+    return false;
+}
+
+bool TerrainInfo::IsSwimmable(LiquidCursor& cursor, float x, float y, float z, float radius /*= 1.5f*/, GridMapLiquidData* data /*= 0*/) const
+{
+    // Check surface in x, y point for liquid
+    if (CanCheckLiquidLevel(x, y))
+    {
+        GridMapLiquidData liquid_status;
+        GridMapLiquidData* liquid_ptr = data ? data : &liquid_status;
+        if (getLiquidStatus(cursor, x, y, z, MAP_ALL_LIQUIDS, liquid_ptr))
+        {
+            if (liquid_ptr->level - liquid_ptr->depth_level > radius) // is unit have enough space to swim
+                return true;
+        }
+    }
+    return false;
+}
+
+bool TerrainInfo::IsUnderWater(LiquidCursor& cursor, float x, float y, float z, float* pWaterZ/*= nullptr*/) const
+{
+    if (CanCheckLiquidLevel(x, y))
+    {
+        GridMapLiquidData mapData;
+
+        if (getLiquidStatus(cursor, x, y, z, MAP_LIQUID_TYPE_WATER | MAP_LIQUID_TYPE_OCEAN, &mapData) & LIQUID_MAP_UNDER_WATER)
+        {
+            if (pWaterZ)
+                *pWaterZ = mapData.level;
+
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * Function find higher form water or ground height for current floor
  *
@@ -1351,6 +1591,33 @@ TerrainInfo* TerrainManager::LoadTerrain(const uint32 mapId)
     return (*iter).second;
 }
 
+TerrainInfo* TerrainManager::AcquireTerrain(const uint32 mapId)
+{
+    Guard _guard(*this);
+
+    TerrainInfo* info;
+    TerrainDataMap::const_iterator iter = i_TerrainMap.find(mapId);
+    if (iter == i_TerrainMap.end())
+    {
+        info = new TerrainInfo(mapId);
+        i_TerrainMap[mapId] = info;
+    }
+    else
+        info = (*iter).second;
+
+    // referenced before the guard drops, so a concurrent UnloadTerrain
+    // cannot delete the object under the caller
+    info->AddRef();
+    return info;
+}
+
+void TerrainManager::ReleaseTerrain(TerrainInfo* terrain)
+{
+    uint32 mapId = terrain->GetMapId();
+    if (terrain->Release())
+        UnloadTerrain(mapId);
+}
+
 void TerrainManager::UnloadTerrain(const uint32 mapId)
 {
     if (sWorld.getConfig(CONFIG_BOOL_GRID_UNLOAD) == 0)
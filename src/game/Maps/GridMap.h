@@ -42,6 +42,11 @@ namespace VMAP
     class IVMapManager;
 };
 
+namespace G3D
+{
+    class Vector3;
+}
+
 class GridMap
 {
     private:
@@ -113,6 +118,9 @@ class GridMap
 
         uint16 getArea(float x, float y) const;
 
+        // bytes held by this tile's area/height/liquid arrays (instrumentation)
+        uint32 GetMemoryUsage() const;
+
         inline float getHeight(float x, float y) const { return (this->*m_gridGetHeight)(x, y); }
         float getLiquidLevel(float x, float y) const;
         uint8 getTerrainType(float x, float y) const;
@@ -145,16 +153,65 @@ class TerrainInfo : public Referencable<std::atomic_long>
 
         uint32 GetMapId() const { return m_mapId; }
 
+        // per-mover terrain cursor: remembers the tile the last height query
+        // resolved, so consecutive queries in the same tile skip the lookup
+        // chain; validated against the tile slot on every use, so grid unload
+        // or reload between queries cannot leave it stale
+        struct TerrainCursor
+        {
+            GridMap* grid = nullptr;
+            int gx = -1;
+            int gy = -1;
+        };
+
+        // per-mover liquid cursor: remembers the last liquid queries together
+        // with their full results. Liquid data is static, so a cached status
+        // stays valid while the mover has not moved and the tile slot still
+        // holds the grid it was computed against (validated on every use like
+        // the height cursor). Two entries, because the swim state and the
+        // underwater breath checks query different liquid masks at the same
+        // point
+        struct LiquidCursor
+        {
+            struct Entry
+            {
+                TerrainCursor tile;
+                float x = 0.f;
+                float y = 0.f;
+                float z = 0.f;
+                float collisionHeight = 0.f;
+                uint8 reqLiquidType = 0;
+                bool valid = false;
+                GridMapLiquidStatus status = LIQUID_MAP_NO_WATER;
+                GridMapLiquidData data = {};
+            };
+
+            Entry entries[2];
+            uint8 next = 0;
+        };
+
         // TODO: move all terrain/vmaps data info query functions
         // from 'Map' class into this class
         float GetHeightStatic(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
+        float GetHeightStatic(TerrainCursor& cursor, float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
+        // batched variant for spline generation: runs of points inside one
+        // tile resolve the tile once through the cursor
+        void GetHeightsStatic(TerrainCursor& cursor, G3D::Vector3* points, size_t count, bool checkVMap = true) const;
         float GetWaterLevel(float x, float y, float z, float* pGround = nullptr) const;
         float GetWaterOrGroundLevel(float x, float y, float z, float& groundZ, bool swim = false, float minWaterDeep = DEFAULT_COLLISION_HEIGHT) const;
         bool IsInWater(float x, float y, float z, GridMapLiquidData* data = nullptr) const;
         bool IsSwimmable(float x, float y, float z, float radius = 1.5f, GridMapLiquidData* data = nullptr) const;
         bool IsUnderWater(float x, float y, float z, float* waterZ = nullptr) const;
+        // cursor variants for the periodic per-unit checks (swim state, breath)
+        bool IsInWater(LiquidCursor& cursor, float x, float y, float z, GridMapLiquidData* data = nullptr) const;
+        bool IsSwimmable(LiquidCursor& cursor, float x, float y, float z, float radius = 1.5f, GridMapLiquidData* data = nullptr) const;
+        bool IsUnderWater(LiquidCursor& cursor, float x, float y, float z, float* waterZ = nullptr) const;
 
         GridMapLiquidStatus getLiquidStatus(float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data = nullptr, float collisionHeight = 2.03128f) const;
+        GridMapLiquidStatus getLiquidStatus(LiquidCursor& cursor, float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data = nullptr, float collisionHeight = 2.03128f) const;
+        // batched shoreline variant: liquid status for a run of points,
+        // resolving the tile once per run through the cursor
+        void getLiquidStatuses(TerrainCursor& cursor, G3D::Vector3 const* points, size_t count, GridMapLiquidStatus* results, uint8 ReqLiquidType, float collisionHeight = 2.03128f) const;
 
         uint16 GetAreaFlag(float x, float y, float z, bool* isOutdoors = nullptr) const;
         uint8 GetTerrainType(float x, float y) const;
@@ -176,6 +233,14 @@ class TerrainInfo : public Referencable<std::atomic_long>
 
         bool CanCheckLiquidLevel(float x, float y) const;
 
+        // background loader entry used by the terrain prefetcher: pulls map,
+        // vmap and mmap data for the grid into memory without taking a grid
+        // reference, so the later foreground Load finds everything resident
+        void Prefetch(const uint32 x, const uint32 y);
+
+        // loaded tile count and resident bytes of this map's terrain grid data (instrumentation)
+        void GetMemoryUsage(uint32& tiles, uint64& bytes);
+
     protected:
         friend class Map;
         friend class ObjectMgr;
@@ -188,8 +253,12 @@ class TerrainInfo : public Referencable<std::atomic_long>
         TerrainInfo& operator=(const TerrainInfo&);
 
         GridMap* GetGrid(const float x, const float y, bool loadOnlyMap = false);
+        GridMap* GetGridCached(TerrainCursor& cursor, const float x, const float y) const;
         GridMap* LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnly = false);
 
+        float GetHeightInternal(GridMap* gmap, float x, float y, float z, bool useVmaps, float maxSearchDist) const;
+        GridMapLiquidStatus getLiquidStatusInternal(TerrainCursor& cursor, float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data, float collisionHeight) const;
+
         int RefGrid(const uint32& x, const uint32& y);
         int UnrefGrid(const uint32& x, const uint32& y);
 
@@ -218,6 +287,11 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
 
     public:
         TerrainInfo* LoadTerrain(const uint32 mapId);
+        // as LoadTerrain, but takes a reference before the manager lock drops,
+        // so off-thread users (terrain prefetcher) cannot race map unload;
+        // balance with ReleaseTerrain
+        TerrainInfo* AcquireTerrain(const uint32 mapId);
+        void ReleaseTerrain(TerrainInfo* terrain);
         void UnloadTerrain(const uint32 mapId);
 
         void Update(const uint32 diff);
@@ -20,6 +20,78 @@
 #include "Database/DatabaseEnv.h"
 #include "Maps/Map.h"
 
+#ifdef BUILD_METRICS
+#include "Metric/Metric.h"
+#endif
+
+void InstanceData::DoUpdate(uint32 diff)
+{
+    m_encounterClockMs += diff;
+
+    while (!m_encounterQueue.empty() && m_encounterQueue.top().dueMs <= m_encounterClockMs)
+    {
+        EncounterDeadline const deadline = m_encounterQueue.top();
+        m_encounterQueue.pop();
+
+        // stale entry left behind by a cancel or reschedule
+        auto itr = m_encounterDeadlines.find(deadline.timerId);
+        if (itr == m_encounterDeadlines.end() || itr->second != deadline.dueMs)
+            continue;
+
+        m_encounterDeadlines.erase(itr);
+        OnEncounterTimer(deadline.timerId);
+    }
+
+#ifdef BUILD_METRICS
+    auto const updateStart = std::chrono::steady_clock::now();
+
+    Update(diff);
+
+    m_updateTimeSumUs += uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - updateStart).count());
+    ++m_updateTicks;
+
+    // aggregate per script instance and ship once a minute - enough to rank
+    // which of the instance scripts actually burn time on this realm
+    m_sinceMetricReportMs += diff;
+    if (m_sinceMetricReportMs >= MINUTE * IN_MILLISECONDS)
+    {
+        metric::metric::instance().report("instance_script.update",
+        {
+            { "time_us", int64(m_updateTimeSumUs) },
+            { "ticks", int64(m_updateTicks) },
+        },
+        {
+            { "map", std::to_string(instance->GetId()) },
+            { "instance", std::to_string(instance->GetInstanceId()) },
+        });
+
+        m_updateTimeSumUs = 0;
+        m_updateTicks = 0;
+        m_sinceMetricReportMs = 0;
+    }
+#else
+    Update(diff);
+#endif
+}
+
+void InstanceData::ScheduleEncounterTimer(uint32 timerId, uint32 delayMs)
+{
+    uint64 const dueMs = m_encounterClockMs + delayMs;
+    m_encounterDeadlines[timerId] = dueMs;                  // orphans any older queue entry for this id
+    m_encounterQueue.push({ dueMs, timerId });
+}
+
+void InstanceData::CancelEncounterTimer(uint32 timerId)
+{
+    m_encounterDeadlines.erase(timerId);                    // the queue entry surfaces later and is skipped
+}
+
+void InstanceData::CancelAllEncounterTimers()
+{
+    m_encounterDeadlines.clear();
+    m_encounterQueue = {};
+}
+
 void InstanceData::SaveToDB() const
 {
     // no reason to save BGs/Arenas
@@ -23,6 +23,10 @@
 #include "Entities/ObjectGuid.h"
 #include "Util/ByteBuffer.h"
 
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
 class Map;
 class Unit;
 class Player;
@@ -52,7 +56,7 @@ class InstanceData
 {
     public:
 
-        explicit InstanceData(Map* map) : instance(map) {}
+        explicit InstanceData(Map* map) : instance(map), m_encounterClockMs(0), m_updateTimeSumUs(0), m_updateTicks(0), m_sinceMetricReportMs(0) {}
         virtual ~InstanceData() {}
 
         Map* instance;
@@ -71,6 +75,24 @@ class InstanceData
         // Called every map update
         virtual void Update(const uint32 /*diff*/) {}
 
+        // map-side entry point: fires due encounter timers, then runs the
+        // script's own Update under the per-script cost instrumentation
+        void DoUpdate(uint32 diff);
+
+        // === encounter timer service ===
+        // deadline-queue alternative to the per-tick countdown chains in
+        // script Update overrides; scripts migrate timer by timer - schedule
+        // an id and receive OnEncounterTimer(id) once the delay elapsed.
+        // Scheduling an already pending id moves its deadline.
+        void ScheduleEncounterTimer(uint32 timerId, uint32 delayMs);
+        void CancelEncounterTimer(uint32 timerId);
+        void CancelAllEncounterTimers();
+        bool HasEncounterTimer(uint32 timerId) const { return m_encounterDeadlines.find(timerId) != m_encounterDeadlines.end(); }
+
+        // fired when a scheduled timer elapsed; rescheduling the same id from
+        // inside the callback is allowed (periodic timers)
+        virtual void OnEncounterTimer(uint32 /*timerId*/) {}
+
         // This is to prevent players from entering during boss encounters.
         virtual bool IsEncounterInProgress() const { return false; };
 
@@ -155,6 +177,27 @@ class InstanceData
 
         virtual void ShowChatCommands(ChatHandler* /*handler*/) {}
         virtual void ExecuteChatCommand(ChatHandler* /*handler*/, char* /*args*/) {}
+
+    private:
+        struct EncounterDeadline
+        {
+            uint64 dueMs;
+            uint32 timerId;
+
+            bool operator>(EncounterDeadline const& other) const { return dueMs > other.dueMs; }
+        };
+
+        uint64 m_encounterClockMs;                          // monotonic script clock, advanced by DoUpdate
+        // min-heap ordered by deadline so an idle script costs one comparison
+        // per tick; cancels and reschedules leave stale entries behind that
+        // are skipped when they surface (deadline no longer matches the map)
+        std::priority_queue<EncounterDeadline, std::vector<EncounterDeadline>, std::greater<EncounterDeadline>> m_encounterQueue;
+        std::unordered_map<uint32, uint64> m_encounterDeadlines;    // pending timerId -> due time
+
+        // per-script Update cost accounting, shipped through the metric pipeline
+        uint64 m_updateTimeSumUs;
+        uint32 m_updateTicks;
+        uint32 m_sinceMetricReportMs;
 };
 
 #endif
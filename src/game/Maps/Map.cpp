@@ -18,6 +18,8 @@
 
 #include "Maps/Map.h"
 #include "Maps/MapManager.h"
+#include "Maps/ObjectResolutionCache.h"
+#include "Maps/MapWorkers.h"
 #include "Entities/Player.h"
 #include "Grids/GridNotifiers.h"
 #include "Log/Log.h"
@@ -30,6 +32,7 @@
 #include "Entities/Transports.h"
 #include "Globals/ObjectAccessor.h"
 #include "Globals/ObjectMgr.h"
+#include "World/MemoryTrend.h"
 #include "World/World.h"
 #include "Groups/Group.h"
 #include "MapRefManager.h"
@@ -44,6 +47,7 @@
 #ifdef BUILD_METRICS
  #include "Metric/Metric.h"
 #endif
+#include "Metric/FrameProfiler.h"
 
 #include <time.h>
 
@@ -153,17 +157,20 @@ void Map::LoadMapAndVMap(int gx, int gy)
 }
 
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
-    : i_mapEntry(sMapStore.LookupEntry(id)),
-      i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0),
+    : m_visibilityGovernorTimer(0),
+      i_mapEntry(sMapStore.LookupEntry(id)),
+      i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0), m_memoryStatsTimer(0), m_combatLogTimer(0),
       m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_persistentState(nullptr),
       m_activeNonPlayersIter(m_activeNonPlayers.end()), m_onEventNotifiedIter(m_onEventNotifiedObjects.end()),
+      m_objectRemovalCounter(0),
       i_gridExpiry(expiry), m_TerrainData(sTerrainMgr.LoadTerrain(id)),
       i_data(nullptr), i_script_id(0), m_transportsIterator(m_transports.begin()), m_spawnManager(*this),
 #ifdef ENABLE_PLAYERBOTS
       m_activeZonesTimer(0), hasRealPlayers(false),
 #endif
-      m_variableManager(this)
+      m_variableManager(this), m_updateTick(0)
 {
+    m_activeCellWords.fill(0);
     m_weatherSystem = new WeatherSystem(this);
 }
 
@@ -178,6 +185,7 @@ void Map::Initialize(bool loadInstanceData /*= true*/)
         {
             // z code
             m_bLoadedGrids[idx][j] = false;
+            m_gridUnloadProgress[idx][j] = 0;
             setNGrid(nullptr, idx, j);
         }
     }
@@ -229,16 +237,230 @@ void Map::InitVisibilityDistance()
     m_VisibleDistance = World::GetMaxVisibleDistanceOnContinents();
 }
 
+Map::CellSnapshot const& Map::GetCellSnapshot(CellPair const& cellPair)
+{
+    uint32 cellId = (cellPair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cellPair.x_coord;
+
+    std::lock_guard<std::mutex> guard(m_cellSnapshotLock);
+    auto itr = m_cellSnapshots.find(cellId);
+    if (itr != m_cellSnapshots.end())
+        return itr->second;
+
+    CellSnapshot& snapshot = m_cellSnapshots[cellId];
+
+    Cell cell(cellPair);
+    cell.SetNoCreate();
+
+    MaNGOS::CellSnapshotFiller filler(snapshot.objects);
+    TypeContainerVisitor<MaNGOS::CellSnapshotFiller, GridTypeMapContainer> gridFiller(filler);
+    TypeContainerVisitor<MaNGOS::CellSnapshotFiller, WorldTypeMapContainer> worldFiller(filler);
+    Visit(cell, gridFiller);
+    Visit(cell, worldFiller);
+
+    // build the packed position mirror alongside the pointer list
+    size_t const count = snapshot.objects.size();
+    snapshot.x.resize(count);
+    snapshot.y.resize(count);
+    snapshot.z.resize(count);
+    snapshot.reach.resize(count);
+    snapshot.isUnit.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        WorldObject* object = snapshot.objects[i];
+        snapshot.x[i] = object->GetPositionX();
+        snapshot.y[i] = object->GetPositionY();
+        snapshot.z[i] = object->GetPositionZ();
+        snapshot.reach[i] = object->GetCombatReach();
+        snapshot.isUnit[i] = uint8(object->IsUnit());
+        snapshot.slots[object] = uint32(i);
+    }
+
+    return snapshot;
+}
+
+void Map::InvalidateCellSnapshot(Cell const& cell)
+{
+    uint32 x = cell.GridX() * MAX_NUMBER_OF_CELLS + cell.CellX();
+    uint32 y = cell.GridY() * MAX_NUMBER_OF_CELLS + cell.CellY();
+
+    std::lock_guard<std::mutex> guard(m_cellSnapshotLock);
+    m_cellSnapshots.erase((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
+}
+
+void Map::InvalidateCellSnapshots()
+{
+    std::lock_guard<std::mutex> guard(m_cellSnapshotLock);
+    m_cellSnapshots.clear();
+}
+
+// Keeps the position mirror exact for objects moving within their cell - cell
+// changes go through Add/RemoveFromGrid which drop the affected snapshots whole
+void Map::RefreshCellSnapshotPosition(WorldObject* obj)
+{
+    CellPair cellPair = MaNGOS::ComputeCellPair(obj->GetPositionX(), obj->GetPositionY());
+    uint32 cellId = (cellPair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cellPair.x_coord;
+
+    std::lock_guard<std::mutex> guard(m_cellSnapshotLock);
+    auto itr = m_cellSnapshots.find(cellId);
+    if (itr == m_cellSnapshots.end())
+        return;
+
+    auto slotItr = itr->second.slots.find(obj);
+    if (slotItr == itr->second.slots.end())
+        return;
+
+    uint32 slot = slotItr->second;
+    itr->second.x[slot] = obj->GetPositionX();
+    itr->second.y[slot] = obj->GetPositionY();
+    itr->second.z[slot] = obj->GetPositionZ();
+    itr->second.reach[slot] = obj->GetCombatReach();
+}
+
+void Map::ScanSnapshotUnitsInRange(float cx, float cy, float cz, float radius, float centerReach, std::vector<Unit*>& out)
+{
+    // map updates run one map per worker thread, so a per-thread lane buffer
+    // keeps the scan allocation-free in steady state
+    static thread_local std::vector<uint8> within;
+
+    CellArea area = Cell::CalculateCellArea(cx, cy, radius);
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            CellSnapshot const& snapshot = GetCellSnapshot(CellPair(x, y));
+            size_t const count = snapshot.objects.size();
+
+            // flat indexed float math over the packed mirror the compiler can vectorize
+            within.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                float const dx = snapshot.x[i] - cx;
+                float const dy = snapshot.y[i] - cy;
+                float const dz = snapshot.z[i] - cz;
+                float const limit = radius + centerReach + snapshot.reach[i];
+                within[i] = uint8(dx * dx + dy * dy + dz * dz <= limit * limit);
+            }
+
+            for (size_t i = 0; i < count; ++i)
+                if (within[i] && snapshot.isUnit[i])
+                    out.push_back(static_cast<Unit*>(snapshot.objects[i]));
+        }
+    }
+}
+
+void Map::AddToFactionIndex(Creature* obj, Cell const& cell)
+{
+    uint32 x = cell.GridX() * MAX_NUMBER_OF_CELLS + cell.CellX();
+    uint32 y = cell.GridY() * MAX_NUMBER_OF_CELLS + cell.CellY();
+
+    std::lock_guard<std::mutex> guard(m_cellFactionLock);
+    m_cellFactionIndex[(y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x].push_back({ obj->GetFaction(), obj });
+}
+
+void Map::RemoveFromFactionIndex(Creature* obj, Cell const& cell)
+{
+    uint32 x = cell.GridX() * MAX_NUMBER_OF_CELLS + cell.CellX();
+    uint32 y = cell.GridY() * MAX_NUMBER_OF_CELLS + cell.CellY();
+
+    std::lock_guard<std::mutex> guard(m_cellFactionLock);
+    auto itr = m_cellFactionIndex.find((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
+    if (itr == m_cellFactionIndex.end())
+        return;
+
+    std::vector<CellFactionEntry>& entries = itr->second;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (entries[i].creature == obj)
+        {
+            entries[i] = entries.back();
+            entries.pop_back();
+            break;
+        }
+    }
+
+    if (entries.empty())
+        m_cellFactionIndex.erase(itr);
+}
+
+void Map::UpdateFactionIndex(Creature* creature, uint32 faction)
+{
+    Cell const& cell = creature->GetCurrentCell();
+    uint32 x = cell.GridX() * MAX_NUMBER_OF_CELLS + cell.CellX();
+    uint32 y = cell.GridY() * MAX_NUMBER_OF_CELLS + cell.CellY();
+
+    std::lock_guard<std::mutex> guard(m_cellFactionLock);
+    auto itr = m_cellFactionIndex.find((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
+    if (itr == m_cellFactionIndex.end())
+        return;
+
+    for (CellFactionEntry& entry : itr->second)
+    {
+        if (entry.creature == creature)
+        {
+            entry.faction = faction;
+            break;
+        }
+    }
+}
+
+void Map::VisitFactionIndexed(WorldObject const* center, float radius, std::function<bool(uint32 factionTemplateId)> const& filter, std::vector<Creature*>& out)
+{
+    CellArea area = Cell::CalculateCellArea(center->GetPositionX(), center->GetPositionY(), radius);
+    CellPair begin_cell;
+    CellPair end_cell;
+    area.ResizeBorders(begin_cell, end_cell);
+
+    // the filter verdict is per faction template - memoize it, an assistance
+    // radius rarely covers more than a handful of distinct factions
+    std::vector<std::pair<uint32, bool>> verdicts;
+
+    std::lock_guard<std::mutex> guard(m_cellFactionLock);
+    for (uint32 x = begin_cell.x_coord; x <= end_cell.x_coord; ++x)
+    {
+        for (uint32 y = begin_cell.y_coord; y <= end_cell.y_coord; ++y)
+        {
+            auto itr = m_cellFactionIndex.find((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
+            if (itr == m_cellFactionIndex.end())
+                continue;
+
+            for (CellFactionEntry const& entry : itr->second)
+            {
+                bool pass = false;
+                bool found = false;
+                for (auto const& verdict : verdicts)
+                {
+                    if (verdict.first == entry.faction)
+                    {
+                        pass = verdict.second;
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found)
+                {
+                    pass = filter(entry.faction);
+                    verdicts.emplace_back(entry.faction, pass);
+                }
+
+                if (pass)
+                    out.push_back(entry.creature);
+            }
+        }
+    }
+}
+
 // Template specialization of utility methods
 template<class T>
 void Map::AddToGrid(T* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     (*grid)(cell.CellX(), cell.CellY()).AddGridObject<T>(obj);
 }
 
 template<>
 void Map::AddToGrid(GameObject* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     (*grid)(cell.CellX(), cell.CellY()).AddGridObject<GameObject>(obj);
     obj->SetCurrentCell(cell);
 }
@@ -246,12 +468,14 @@ void Map::AddToGrid(GameObject* obj, NGridType* grid, Cell const& cell)
 template<>
 void Map::AddToGrid(Player* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     (*grid)(cell.CellX(), cell.CellY()).AddWorldObject(obj);
 }
 
 template<>
 void Map::AddToGrid(Corpse* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     // add to world object registry in grid
     if (obj->GetType() != CORPSE_BONES)
     {
@@ -267,6 +491,7 @@ void Map::AddToGrid(Corpse* obj, NGridType* grid, Cell const& cell)
 template<>
 void Map::AddToGrid(Creature* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     // add to world object registry in grid
     if (obj->IsPet())
     {
@@ -279,23 +504,28 @@ void Map::AddToGrid(Creature* obj, NGridType* grid, Cell const& cell)
         (*grid)(cell.CellX(), cell.CellY()).AddGridObject<Creature>(obj);
         obj->SetCurrentCell(cell);
     }
+
+    AddToFactionIndex(obj, cell);
 }
 
 template<class T>
 void Map::RemoveFromGrid(T* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     (*grid)(cell.CellX(), cell.CellY()).RemoveGridObject<T>(obj);
 }
 
 template<>
 void Map::RemoveFromGrid(Player* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     (*grid)(cell.CellX(), cell.CellY()).RemoveWorldObject(obj);
 }
 
 template<>
 void Map::RemoveFromGrid(Corpse* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     // remove from world object registry in grid
     if (obj->GetType() != CORPSE_BONES)
     {
@@ -311,6 +541,7 @@ void Map::RemoveFromGrid(Corpse* obj, NGridType* grid, Cell const& cell)
 template<>
 void Map::RemoveFromGrid(Creature* obj, NGridType* grid, Cell const& cell)
 {
+    InvalidateCellSnapshot(cell);
     // remove from world object registry in grid
     if (obj->IsPet())
     {
@@ -321,6 +552,8 @@ void Map::RemoveFromGrid(Creature* obj, NGridType* grid, Cell const& cell)
     {
         (*grid)(cell.CellX(), cell.CellY()).RemoveGridObject<Creature>(obj);
     }
+
+    RemoveFromFactionIndex(obj, cell);
 }
 
 void Map::DeleteFromWorld(Player* pl)
@@ -383,6 +616,16 @@ bool Map::EnsureGridLoaded(const Cell& cell)
     NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
 
     MANGOS_ASSERT(grid != nullptr);
+
+    // a grid mid incremental teardown cannot be revived - finish the remaining
+    // slices now (bounded by what is not yet destructed) and reload it fresh
+    if (grid->GetGridState() == GRID_STATE_UNLOADING)
+    {
+        ContinueUnloadGrid(cell.GridX(), cell.GridY(), false);
+        EnsureGridCreated(GridPair(cell.GridX(), cell.GridY()));
+        grid = getNGrid(cell.GridX(), cell.GridY());
+    }
+
     if (!isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
     {
         // it's important to set it loaded before loading!
@@ -423,6 +666,152 @@ void Map::ForceLoadGrid(float x, float y)
     }
 }
 
+void Map::QueueGridWarmup(float x, float y)
+{
+    if (IsLoaded(x, y))
+        return;
+
+    CellPair p = MaNGOS::ComputeCellPair(x, y);
+    Cell cell(p);
+    m_warmupGrids.insert(cell.GridX() * MAX_NUMBER_OF_GRIDS + cell.GridY());
+}
+
+void Map::UpdateGridWarmup()
+{
+    if (m_warmupGrids.empty())
+        return;
+
+    uint32 budget = sWorld.getConfig(CONFIG_UINT32_GRID_WARMUP_GRIDS_PER_TICK);
+    if (!budget)                                            // staging disabled: drain the whole queue now
+        budget = uint32(m_warmupGrids.size());
+
+    // grids occupied by players; pending grids closest to one of them load first
+    std::vector<std::pair<int32, int32>> playerGrids;
+    for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+    {
+        Cell cell(MaNGOS::ComputeCellPair(itr->getSource()->GetPositionX(), itr->getSource()->GetPositionY()));
+        playerGrids.emplace_back(cell.GridX(), cell.GridY());
+    }
+
+    while (budget && !m_warmupGrids.empty())
+    {
+        std::set<uint32>::iterator best = m_warmupGrids.begin();
+        if (!playerGrids.empty())
+        {
+            int32 bestDist = std::numeric_limits<int32>::max();
+            for (std::set<uint32>::iterator itr = m_warmupGrids.begin(); itr != m_warmupGrids.end(); ++itr)
+            {
+                int32 const gx = int32(*itr / MAX_NUMBER_OF_GRIDS);
+                int32 const gy = int32(*itr % MAX_NUMBER_OF_GRIDS);
+                int32 dist = std::numeric_limits<int32>::max();
+                for (auto const& playerGrid : playerGrids)
+                    dist = std::min(dist, (playerGrid.first - gx) * (playerGrid.first - gx) + (playerGrid.second - gy) * (playerGrid.second - gy));
+                if (dist < bestDist)
+                {
+                    bestDist = dist;
+                    best = itr;
+                }
+            }
+        }
+
+        uint32 const gx = *best / MAX_NUMBER_OF_GRIDS;
+        uint32 const gy = *best % MAX_NUMBER_OF_GRIDS;
+        m_warmupGrids.erase(best);
+
+        // a player may have walked into the grid meanwhile; no budget spent then
+        if (loaded(GridPair(gx, gy)))
+            continue;
+
+        Cell cell(CellPair(gx * MAX_NUMBER_OF_CELLS, gy * MAX_NUMBER_OF_CELLS));
+        EnsureGridLoadedAtEnter(cell);
+        getNGrid(gx, gy)->setUnloadExplicitLock(true);
+        --budget;
+    }
+}
+
+float Map::GetVisibilityScale(float x, float y) const
+{
+    if (m_visibilityScale.empty())
+        return 1.0f;
+
+    Cell cell(MaNGOS::ComputeCellPair(x, y));
+    auto itr = m_visibilityScale.find(cell.GridX() * MAX_NUMBER_OF_GRIDS + cell.GridY());
+    return itr != m_visibilityScale.end() ? itr->second : 1.0f;
+}
+
+void Map::UpdateVisibilityGovernor(uint32 diff)
+{
+    m_visibilityGovernorTimer += diff;
+    if (m_visibilityGovernorTimer < 5 * IN_MILLISECONDS)
+        return;
+    m_visibilityGovernorTimer = 0;
+
+    uint32 const threshold = sWorld.getConfig(CONFIG_UINT32_VISIBILITY_GOVERNOR_PLAYERS_PER_GRID);
+    if (!threshold)
+    {
+        m_visibilityScale.clear();
+        return;
+    }
+
+    // player count per occupied grid, one pass over the map reference list
+    std::unordered_map<uint32, uint32> population;
+    for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+    {
+        Cell cell(MaNGOS::ComputeCellPair(itr->getSource()->GetPositionX(), itr->getSource()->GetPositionY()));
+        ++population[cell.GridX() * MAX_NUMBER_OF_GRIDS + cell.GridY()];
+    }
+
+    // scaling the distance by sqrt(threshold/count) roughly caps the visible
+    // pair count of a crowded grid at the threshold's own pair count; the
+    // configured floor keeps every aggro radius inside the scaled distance
+    float const minScale = std::min(1.0f, sWorld.getConfig(CONFIG_FLOAT_VISIBILITY_GOVERNOR_MIN_DISTANCE) / std::max(1.0f, m_VisibleDistance));
+
+    for (auto const& grid : population)
+    {
+        if (grid.second <= threshold)
+            continue;
+
+        float const target = std::max(minScale, sqrt(float(threshold) / float(grid.second)));
+        float& scale = m_visibilityScale.try_emplace(grid.first, 1.0f).first->second;
+        scale += (target - scale) * 0.25f;                  // smoothed, so brief spikes cause no visible pop
+    }
+
+    // grids back under the threshold relax toward full distance and drop out
+    for (auto itr = m_visibilityScale.begin(); itr != m_visibilityScale.end();)
+    {
+        auto pop = population.find(itr->first);
+        if (pop == population.end() || pop->second <= threshold)
+        {
+            itr->second += (1.0f - itr->second) * 0.25f;
+            if (itr->second > 0.99f)
+            {
+                itr = m_visibilityScale.erase(itr);
+                continue;
+            }
+        }
+        ++itr;
+    }
+
+#ifdef BUILD_METRICS
+    if (!m_visibilityScale.empty())
+    {
+        float minScaleActive = 1.0f;
+        for (auto const& grid : m_visibilityScale)
+            minScaleActive = std::min(minScaleActive, grid.second);
+
+        metric::metric::instance().report("map.visibility_governor",
+        {
+            { "scaled_grids", int64(m_visibilityScale.size()) },
+            { "min_scale_pct", int64(minScaleActive * 100) },
+        },
+        {
+            { "map_id", std::to_string(i_id) },
+            { "instance_id", std::to_string(i_InstanceId) },
+        });
+    }
+#endif
+}
+
 void Map::CreatePlayerOnClient(Player* player)
 {
     // update player state for other player and visa-versa
@@ -460,6 +849,8 @@ bool Map::Add(Player* player)
     if (i_data)
         i_data->OnPlayerEnter(player);
 
+    UpdateCellActivity(player);
+
     return true;
 }
 
@@ -595,10 +986,8 @@ void Map::MessageMapBroadcast(WorldObject const* /*obj*/, WorldPacket const& msg
 
 void Map::MessageMapBroadcastZone(WorldObject const* /*obj*/, WorldPacket const& msg, uint32 zoneId)
 {
-    Map::PlayerList const& pList = GetPlayers();
-    for (const auto& itr : pList)
-        if (itr.getSource()->GetZoneId() == zoneId)
-            itr.getSource()->SendDirectMessage(msg);
+    for (Player* player : GetPlayersInZone(zoneId))
+        player->SendDirectMessage(msg);
 }
 
 void Map::MessageMapBroadcastArea(WorldObject const* /*obj*/, WorldPacket const& msg, uint32 areaId)
@@ -639,10 +1028,8 @@ void Map::ExecuteMapWorker(std::function<void(Player*)> const& worker)
 
 void Map::ExecuteMapWorkerZone(uint32 zoneId, std::function<void(Player*)> const& worker)
 {
-    Map::PlayerList const& pList = GetPlayers();
-    for (const auto& itr : pList)
-        if (itr.getSource()->GetZoneId() == zoneId)
-            worker(itr.getSource());
+    for (Player* player : GetPlayersInZone(zoneId))
+        worker(player);
 }
 
 void Map::ExecuteMapWorkerArea(uint32 areaId, std::function<void(Player*)> const& worker)
@@ -685,6 +1072,205 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MaNGOS::Obje
     }
 }
 
+// mark-only variant of VisitNearbyCellsOf: collects the cells to visit so a
+// continent update can hand them out per-NGrid to the map update workers
+void Map::MarkNearbyCellsOf(WorldObject* obj, std::vector<uint32>& cellIds)
+{
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->IsInWorld() ? obj->GetVisibilityData().GetVisibilityDistance() : GetVisibilityDistance());
+
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (!isCellMarked(cell_id))
+            {
+                markCell(cell_id);
+                cellIds.push_back(cell_id);
+            }
+        }
+    }
+}
+
+void Map::UpdateCellActivity(Player* player)
+{
+#ifdef ENABLE_PLAYERBOTS
+    // bots don't activate their surroundings (they only keep their own grid
+    // loaded, see the bot branch in Map::Update), so only real players
+    // contribute to the active cell set
+    if (!sPlayerbotAIConfig.disableBotOptimizations && !player->isRealPlayer())
+    {
+        RemoveCellActivity(player);
+        return;
+    }
+#endif
+
+    CellArea area = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), GetVisibilityDistance());
+    auto itr = m_cellActivityAreas.find(player->GetObjectGuid());
+    if (itr != m_cellActivityAreas.end())
+    {
+        if (itr->second.low_bound == area.low_bound && itr->second.high_bound == area.high_bound)
+            return;
+
+        ApplyCellActivity(itr->second, -1);
+        itr->second = area;
+    }
+    else
+        m_cellActivityAreas.emplace(player->GetObjectGuid(), area);
+
+    ApplyCellActivity(area, 1);
+}
+
+void Map::RemoveCellActivity(Player* player)
+{
+    auto itr = m_cellActivityAreas.find(player->GetObjectGuid());
+    if (itr == m_cellActivityAreas.end())
+        return;
+
+    ApplyCellActivity(itr->second, -1);
+    m_cellActivityAreas.erase(itr);
+}
+
+void Map::ApplyCellActivity(CellArea const& area, int32 delta)
+{
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            uint16& count = m_cellActivityCounts[cell_id];
+            if (delta > 0)
+            {
+                if (!count++)
+                    m_activeCellWords[cell_id / 64] |= (uint64(1) << (cell_id % 64));
+            }
+            else if (count && !--count)
+            {
+                m_activeCellWords[cell_id / 64] &= ~(uint64(1) << (cell_id % 64));
+                m_cellActivityCounts.erase(cell_id);
+            }
+        }
+    }
+}
+
+// opt-in parallel object update phase: occupied NGrids are union-joined with
+// their neighbours so any two objects close enough to interact always land in
+// the same cluster, then each cluster is updated as a stealable sub-task;
+// cross-cluster work queued meanwhile is committed serially via the messager
+uint64 Map::UpdateObjectsParallel(WorldObjectUnSet& objToUpdate, uint32 t_diff, MapUpdater& updater)
+{
+    uint64 count = 0;
+
+    std::vector<uint16> parent(MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS);
+    std::vector<bool> occupied(parent.size(), false);
+    for (uint16 i = 0; i < parent.size(); ++i)
+        parent[i] = i;
+
+    auto find = [&parent](uint16 id)
+    {
+        while (parent[id] != id)
+        {
+            parent[id] = parent[parent[id]]; // path halving
+            id = parent[id];
+        }
+        return id;
+    };
+
+    std::vector<uint16> objectGrid;
+    objectGrid.reserve(objToUpdate.size());
+    for (WorldObject* wObj : objToUpdate)
+    {
+        GridPair p = MaNGOS::ComputeGridPair(wObj->GetPositionX(), wObj->GetPositionY());
+        uint16 gridId = uint16(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord);
+        objectGrid.push_back(gridId);
+        occupied[gridId] = true;
+    }
+
+    // join each occupied grid with its occupied neighbours
+    for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+    {
+        for (uint32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+        {
+            uint16 gridId = uint16(x * MAX_NUMBER_OF_GRIDS + y);
+            if (!occupied[gridId])
+                continue;
+
+            if (x + 1 < MAX_NUMBER_OF_GRIDS)
+            {
+                for (uint32 ny = (y ? y - 1 : 0); ny <= y + 1 && ny < MAX_NUMBER_OF_GRIDS; ++ny)
+                {
+                    uint16 neighbour = uint16((x + 1) * MAX_NUMBER_OF_GRIDS + ny);
+                    if (occupied[neighbour])
+                        parent[find(neighbour)] = find(gridId);
+                }
+            }
+            if (y + 1 < MAX_NUMBER_OF_GRIDS)
+            {
+                uint16 neighbour = uint16(x * MAX_NUMBER_OF_GRIDS + y + 1);
+                if (occupied[neighbour])
+                    parent[find(neighbour)] = find(gridId);
+            }
+        }
+    }
+
+    std::unordered_map<uint16, std::vector<WorldObject*>> clusters;
+    size_t objIndex = 0;
+    for (WorldObject* wObj : objToUpdate)
+        clusters[find(objectGrid[objIndex++])].push_back(wObj);
+
+    if (clusters.size() < 2)
+    {
+        for (WorldObject* wObj : objToUpdate)
+        {
+            wObj->Update(t_diff);
+            ++count;
+        }
+        return count;
+    }
+
+    std::atomic<uint32> remaining(uint32(clusters.size()));
+    for (auto& cluster : clusters)
+    {
+        count += cluster.second.size();
+        updater.schedule_task(new ObjectUpdateWorker(std::move(cluster.second), t_diff, remaining, updater));
+    }
+
+    updater.help_until(remaining);
+
+    // serial commit of cross-cluster interactions deferred during the phase
+    GetMessager().Execute(this);
+
+    return count;
+}
+
+Map::MapMemoryStats Map::GetMemoryStats()
+{
+    MapMemoryStats stats;
+
+    MapStoredObjectTypesContainer& store = GetObjectsStore();
+    stats.creatures = store.size<Creature>();
+    stats.pets = store.size<Pet>();
+    stats.gameObjects = store.size<GameObject>();
+    stats.dynamicObjects = store.size<DynamicObject>();
+
+    for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+    {
+        for (uint32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+        {
+            if (NGridType* grid = getNGrid(x, y))
+            {
+                ++stats.loadedGrids;
+                stats.activeObjects += grid->ActiveObjectsInGrid();
+            }
+        }
+    }
+
+    m_TerrainData->GetMemoryUsage(stats.terrainTiles, stats.terrainBytes);
+    MMAP::MMapFactory::createOrGetMMapManager()->getMapMemoryStats(GetId(), stats.navMeshTiles, stats.navMeshBytes);
+
+    return stats;
+}
+
 void Map::Update(const uint32& t_diff)
 {
 
@@ -695,7 +1281,16 @@ void Map::Update(const uint32& t_diff)
 });
 #endif
 
+    // when map updates run on worker threads this starts its own profile root
+    metric::FrameScope profileScope("map:" + std::to_string(i_id));
+
+    // wall-clock tick budget: once exceeded, the serial object phase is
+    // preempted between objects and the remainder carried to the next tick
+    uint32 const budgetMs = sWorld.getConfig(CONFIG_UINT32_MAP_UPDATE_TICK_BUDGET);
+    auto const updateStart = std::chrono::steady_clock::now();
+
     m_curTime = time(nullptr);
+    ++m_updateTick;
 
 #ifdef _MSC_VER
     localtime_s(&m_curTimeTm, &m_curTime);
@@ -709,9 +1304,12 @@ void Map::Update(const uint32& t_diff)
 
     GetMessager().Execute(this);
     m_spawnManager.Update();
+    UpdateGridWarmup();
+    UpdateVisibilityGovernor(t_diff);
 
     /// update active cells around players and active objects
     resetMarkedCells();
+    InvalidateCellSnapshots();
 
     WorldObjectUnSet objToUpdate;
     MaNGOS::ObjectUpdater obj_updater(objToUpdate, t_diff);
@@ -728,6 +1326,7 @@ void Map::Update(const uint32& t_diff)
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
     {
+        metric::FrameScope sessionsScope("sessions");
 #ifdef BUILD_METRICS
         uint32 updatedSessions = 0;
         metric::duration<std::chrono::milliseconds> sessions_meas("map.update.session", {
@@ -815,6 +1414,15 @@ void Map::Update(const uint32& t_diff)
     bool shouldUpdateBots = urand(0, (uint32)(botUpdateChance * 100)) < 100;
 #endif
 
+    // on busy continents the cell visitation is split into per-NGrid sub-tasks
+    // that idle map update workers steal instead of waiting on one hot map
+    MapUpdater& updater = sMapMgr.GetMapUpdater();
+    bool const splitVisits = updater.activated() && IsContinent();
+    std::vector<uint32> cellsToVisit;
+
+    // closed explicitly once the cell visitation below is done
+    std::optional<metric::FrameScope> visitScope(std::in_place, "visits");
+
     /// update players at tick
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -887,6 +1495,38 @@ void Map::Update(const uint32& t_diff)
     }
 #endif
 
+    ///- Visit the incrementally maintained active cells: the set is kept up to
+    ///- date on player relocation, so the per-tick cost is skipping empty
+    ///- 64-cell words instead of re-marking every player's area from scratch
+    for (uint32 w = 0; w < uint32(m_activeCellWords.size()); ++w)
+    {
+        uint64 word = m_activeCellWords[w];
+        if (!word)
+            continue;
+
+        for (uint32 bit = 0; word; ++bit, word >>= 1)
+        {
+            if (!(word & 1))
+                continue;
+
+            uint32 cell_id = w * 64 + bit;
+            if (isCellMarked(cell_id))
+                continue;
+
+            markCell(cell_id);
+            if (splitVisits)
+                cellsToVisit.push_back(cell_id);
+            else
+            {
+                CellPair pair(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+                Cell cell(pair);
+                cell.SetNoCreate();
+                Visit(cell, grid_object_update);
+                Visit(cell, world_object_update);
+            }
+        }
+    }
+
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* player = m_mapRefIter->getSource();
@@ -915,11 +1555,63 @@ void Map::Update(const uint32& t_diff)
         }
 #endif
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
-
-        // If player is using far sight, visit that object too
+        // the player's own surroundings come from the active cell set above;
+        // only a far sight viewpoint needs extra visitation
         if (WorldObject* viewPoint = GetWorldObject(player->GetFarSightGuid()))
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+        {
+            if (splitVisits)
+                MarkNearbyCellsOf(viewPoint, cellsToVisit);
+            else
+                VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+        }
+    }
+
+    if (splitVisits && !cellsToVisit.empty())
+    {
+        // bucket the marked cells by NGrid so no two sub-tasks touch the same grid
+        std::map<uint32, std::vector<Cell>> gridBuckets;
+        for (uint32 cell_id : cellsToVisit)
+        {
+            CellPair pair(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+            Cell cell(pair);
+            cell.SetNoCreate();
+            gridBuckets[cell.GridX() * MAX_NUMBER_OF_GRIDS + cell.GridY()].push_back(cell);
+        }
+
+        // with MapUpdate.ContinentShards set, aggregate the per-grid buckets
+        // into contiguous gx bands: grid-adjacent objects stay inside one
+        // sub-task (boundary interactions only at band edges) and the stable
+        // scheduling slot keeps each band on the same cache-warm worker
+        uint32 const shards = sWorld.getConfig(CONFIG_UINT32_MAP_UPDATE_CONTINENT_SHARDS);
+        if (shards > 1)
+        {
+            std::map<uint32, std::vector<Cell>> shardBuckets;
+            for (auto& bucket : gridBuckets)
+            {
+                std::vector<Cell>& cells = shardBuckets[bucket.first / MAX_NUMBER_OF_GRIDS * shards / MAX_NUMBER_OF_GRIDS];
+                cells.insert(cells.end(), bucket.second.begin(), bucket.second.end());
+            }
+            gridBuckets = std::move(shardBuckets);
+        }
+
+        std::atomic<uint32> remaining(uint32(gridBuckets.size()));
+        std::vector<WorldObjectUnSet> taskSets(gridBuckets.size());
+
+        size_t taskIndex = 0;
+        for (auto& bucket : gridBuckets)
+        {
+            GridCrawler* task = new GridCrawler(*this, std::move(bucket.second), taskSets[taskIndex++], t_diff, remaining, updater);
+            if (shards > 1)
+                updater.schedule_task(task, GetId() * shards + bucket.first);
+            else
+                updater.schedule_task(task);
+        }
+
+        // help draining our own sub-tasks while idle workers steal the rest
+        updater.help_until(remaining);
+
+        for (WorldObjectUnSet& taskSet : taskSets)
+            objToUpdate.insert(taskSet.begin(), taskSet.end());
     }
 
 #ifdef ENABLE_PLAYERBOTS
@@ -988,24 +1680,73 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
+    visitScope.reset();
+
     // update all objects
-    for (auto wObj : objToUpdate)
+    uint32 preemptedCount = 0;
     {
-        wObj->Update(t_diff);
-        ++count;
+        metric::FrameScope objectsScope("objects");
+        if (splitVisits && sWorld.getConfig(CONFIG_BOOL_MAP_UPDATE_PARALLEL_OBJECTS))
+            count = UpdateObjectsParallel(objToUpdate, t_diff, updater);    // worker-drained, not preempted
+        else
+        {
+            // objects preempted by the tick budget last tick go first, so a
+            // persistent overrun rotates through the population instead of
+            // starving the same objects forever
+            std::vector<WorldObject*> ordered;
+            ordered.reserve(objToUpdate.size());
+            for (ObjectGuid const& guid : m_preemptedObjects)
+                if (WorldObject* wObj = GetWorldObject(guid))
+                    if (objToUpdate.erase(wObj))
+                        ordered.push_back(wObj);
+            m_preemptedObjects.clear();
+            ordered.insert(ordered.end(), objToUpdate.begin(), objToUpdate.end());
+
+            for (size_t i = 0; i < ordered.size(); ++i)
+            {
+                // the gap between two object updates is the only safe
+                // preemption boundary in this phase; check one in 64
+                if (budgetMs && i && (i & 63) == 0 &&
+                        std::chrono::steady_clock::now() - updateStart > std::chrono::milliseconds(budgetMs))
+                {
+                    for (size_t j = i; j < ordered.size(); ++j)
+                        m_preemptedObjects.push_back(ordered[j]->GetObjectGuid());
+                    preemptedCount = uint32(ordered.size() - i);
+                    break;
+                }
+
+                ordered[i]->Update(t_diff);
+                ++count;
+            }
+        }
     }
 
 #ifdef BUILD_METRICS
     meas.add_field("count", std::to_string(static_cast<int32>(count)));
 #endif
 
+    ///- Deliver coalesced combat log packets once the grouping window elapsed
+    if (!m_combatLogQueue.empty())
+    {
+        m_combatLogTimer += t_diff;
+        if (m_combatLogTimer >= sWorld.getConfig(CONFIG_UINT32_COMBAT_LOG_COALESCE_DELAY))
+        {
+            m_combatLogTimer = 0;
+            FlushCombatLogQueue();
+        }
+    }
+
     // Send world objects and item update field changes
-    SendObjectUpdates();
+    {
+        metric::FrameScope sendScope("sendUpdates");
+        SendObjectUpdates();
+    }
 
     // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattleGround())
     {
+        metric::FrameScope gridScope("gridStates");
         for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
         {
             NGridType* grid = i->getSource();
@@ -1016,14 +1757,89 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
+    ///- Decay bones whose deadline elapsed - the queue is ordered by expiry
+    ///- time, so only entries actually due this tick are touched
+    if (!m_bonesDecayQueue.empty())
+    {
+        time_t const now = time(nullptr);
+        while (!m_bonesDecayQueue.empty() && m_bonesDecayQueue.begin()->first <= now)
+        {
+            ObjectGuid bonesGuid = m_bonesDecayQueue.begin()->second;
+            m_bonesDecayQueue.erase(m_bonesDecayQueue.begin());
+
+            // may be gone already with an unloaded grid
+            if (Corpse* bones = GetCorpse(bonesGuid))
+                if (bones->GetType() == CORPSE_BONES)
+                    bones->AddObjectToRemoveList();
+        }
+    }
+
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
         ScriptsProcess();
 
     if (i_data)
-        i_data->Update(t_diff);
+        i_data->DoUpdate(t_diff);
+
+    ///- Send world state variables changed this tick to their observers
+    m_variableManager.FlushDirty();
 
     m_weatherSystem->UpdateWeathers(t_diff);
+
+    ///- Tick budget overrun diagnostics
+    if (budgetMs)
+    {
+        uint32 const elapsedMs = uint32(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - updateStart).count());
+        if (elapsedMs > budgetMs || preemptedCount)
+        {
+            DEBUG_LOG("Map %u instance %u overran its %ums update budget: %ums spent, %u object updates carried to next tick",
+                      i_id, i_InstanceId, budgetMs, elapsedMs, preemptedCount);
+
+#ifdef BUILD_METRICS
+            metric::metric::instance().report("map.update.overrun",
+            {
+                { "elapsed_ms", int64(elapsedMs) },
+                { "budget_ms", int64(budgetMs) },
+                { "preempted", int64(preemptedCount) },
+                { "objects", int64(count) },
+                { "players", int64(m_mapRefManager.getSize()) },
+            },
+            {
+                { "map_id", std::to_string(i_id) },
+                { "instance_id", std::to_string(i_InstanceId) },
+            });
+#endif
+        }
+    }
+
+#ifdef BUILD_METRICS
+    // periodic population/memory gauge per map
+    m_memoryStatsTimer += t_diff;
+    if (m_memoryStatsTimer >= MINUTE * IN_MILLISECONDS)
+    {
+        m_memoryStatsTimer = 0;
+
+        MapMemoryStats stats = GetMemoryStats();
+        metric::metric::instance().report("map.memory",
+        {
+            { "players", int64(m_mapRefManager.getSize()) },
+            { "creatures", int64(stats.creatures) },
+            { "pets", int64(stats.pets) },
+            { "gameobjects", int64(stats.gameObjects) },
+            { "dynamicobjects", int64(stats.dynamicObjects) },
+            { "loaded_grids", int64(stats.loadedGrids) },
+            { "active_objects", int64(stats.activeObjects) },
+            { "terrain_tiles", int64(stats.terrainTiles) },
+            { "terrain_bytes", int64(stats.terrainBytes) },
+            { "navmesh_tiles", int64(stats.navMeshTiles) },
+            { "navmesh_bytes", int64(stats.navMeshBytes) },
+        },
+        {
+            { "map_id", std::to_string(i_id) },
+            { "instance_id", std::to_string(i_InstanceId) },
+        });
+    }
+#endif
 }
 
 void Map::Remove(Player* player, bool remove)
@@ -1044,6 +1860,9 @@ void Map::Remove(Player* player, bool remove)
     if (m_mapRefIter == player->GetMapRef())
         m_mapRefIter = m_mapRefIter->nocheck_prev();
     player->GetMapRef().unlink();
+    IncrementObjectRemovalCounter();
+    RemoveFromZoneRegistry(player, player->GetCachedZoneId());
+    RemoveCellActivity(player);
     CellPair p = MaNGOS::ComputeCellPair(player->GetPositionX(), player->GetPositionY());
     if (p.x_coord >= TOTAL_NUMBER_OF_CELLS_PER_MAP || p.y_coord >= TOTAL_NUMBER_OF_CELLS_PER_MAP)
     {
@@ -1121,7 +1940,7 @@ void Map::Remove(T* obj, bool remove)
         delete obj;
 }
 
-void Map::PlayerRelocation(Player* player, float x, float y, float z, float orientation)
+void Map::PlayerRelocation(Player* player, float x, float y, float z, float orientation, bool notify)
 {
     MANGOS_ASSERT(player);
 
@@ -1134,6 +1953,9 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
 
     player->Relocate(x, y, z, orientation);
 
+    if (same_cell)
+        RefreshCellSnapshotPosition(player);
+
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
         DEBUG_FILTER_LOG(LOG_FILTER_PLAYER_MOVES, "Player %s relocation grid[%u,%u]cell[%u,%u]->grid[%u,%u]cell[%u,%u]", player->GetName(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
@@ -1149,7 +1971,10 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
         player->GetViewPoint().Event_GridChanged(&(*newGrid)(new_cell.CellX(), new_cell.CellY()));
     }
 
-    player->OnRelocated();
+    if (notify)
+        player->OnRelocated();
+
+    UpdateCellActivity(player);
 
     NGridType* newGrid = getNGrid(new_cell.GridX(), new_cell.GridY());
     if (!same_cell && newGrid->GetGridState() != GRID_STATE_ACTIVE)
@@ -1159,7 +1984,7 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     }
 }
 
-void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang)
+void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool notify)
 {
     Cell new_cell(MaNGOS::ComputeCellPair(x, y));
 
@@ -1168,7 +1993,9 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     {
         // update pos
         creature->Relocate(x, y, z, ang);
-        creature->OnRelocated();
+        RefreshCellSnapshotPosition(creature);
+        if (notify)
+            creature->OnRelocated();
     }
     // if creature can't be move in new cell/grid (not loaded) move it to repawn cell/grid
     // creature coordinates will be updated and notifiers send
@@ -1266,37 +2093,71 @@ bool Map::UnloadGrid(const uint32& x, const uint32& y, bool pForce)
     NGridType* grid = getNGrid(x, y);
     MANGOS_ASSERT(grid != nullptr);
 
-    {
-        if (!pForce && ActiveObjectsNearGrid(x, y))
+    if (grid->GetGridState() != GRID_STATE_UNLOADING)
+        if (!BeginUnloadGrid(x, y, pForce))
             return false;
 
-        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u", x, y, i_id);
+    ContinueUnloadGrid(x, y, false);
+    return true;
+}
 
-        ObjectGridStoper stoper(*grid);
-        stoper.StopN();
+bool Map::BeginUnloadGrid(const uint32& x, const uint32& y, bool pForce)
+{
+    NGridType* grid = getNGrid(x, y);
+    MANGOS_ASSERT(grid != nullptr);
 
-        ObjectGridUnloader unloader(*grid);
+    if (!pForce && ActiveObjectsNearGrid(x, y))
+        return false;
 
-        // Finish remove and delete all creatures with delayed remove before moving to respawn grids
-        // Must know real mob position before move
-        RemoveAllObjectsInRemoveList();
+    DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u", x, y, i_id);
 
-        // move creatures to respawn grids if this is diff.grid or to remove list
-        unloader.MoveToRespawnN();
+    ObjectGridStoper stoper(*grid);
+    stoper.StopN();
 
-        // Finish remove and delete all creatures with delayed remove before unload
-        RemoveAllObjectsInRemoveList();
+    ObjectGridUnloader unloader(*grid);
 
-        unloader.UnloadN();
+    // Finish remove and delete all creatures with delayed remove before moving to respawn grids
+    // Must know real mob position before move
+    RemoveAllObjectsInRemoveList();
 
-        // Unloading a grid can also add creatures to the list of objects to be
-        // removed, for example guardian pets. Remove these now to avoid they
-        // wouldn't actually be removed because the grid is already unloaded.
-        RemoveAllObjectsInRemoveList();
+    // move creatures to respawn grids if this is diff.grid or to remove list
+    unloader.MoveToRespawnN();
 
-        delete getNGrid(x, y);
-        setNGrid(nullptr, x, y);
-    }
+    // Finish remove and delete all creatures with delayed remove before unload
+    RemoveAllObjectsInRemoveList();
+
+    // from here on the remaining objects are destructed in bounded slices by
+    // ContinueUnloadGrid, so a grid full of objects does not stall one map tick
+    m_gridUnloadProgress[x][y] = 0;
+    grid->SetGridState(GRID_STATE_UNLOADING);
+    return true;
+}
+
+bool Map::ContinueUnloadGrid(const uint32& x, const uint32& y, bool limited /*= true*/)
+{
+    NGridType* grid = getNGrid(x, y);
+    MANGOS_ASSERT(grid != nullptr && grid->GetGridState() == GRID_STATE_UNLOADING);
+
+    uint32 const totalCells = MAX_NUMBER_OF_CELLS * MAX_NUMBER_OF_CELLS;
+    uint32 cell = m_gridUnloadProgress[x][y];
+    uint32 const last = limited ? std::min(cell + MAX_NUMBER_OF_CELLS, totalCells) : totalCells;
+
+    ObjectGridUnloader unloader(*grid);
+    for (; cell < last; ++cell)
+        unloader.UnloadCell(cell / MAX_NUMBER_OF_CELLS, cell % MAX_NUMBER_OF_CELLS);
+
+    m_gridUnloadProgress[x][y] = cell;
+    if (cell < totalCells)
+        return false;
+
+    // Unloading a grid can also add creatures to the list of objects to be
+    // removed, for example guardian pets. Remove these now to avoid they
+    // wouldn't actually be removed because the grid is already unloaded.
+    RemoveAllObjectsInRemoveList();
+
+    delete getNGrid(x, y);
+    setNGrid(nullptr, x, y);
+    m_gridUnloadProgress[x][y] = 0;
 
     int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
     int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
@@ -1328,6 +2189,12 @@ const char* Map::GetMapName() const
     return i_mapEntry ? i_mapEntry->name[sWorld.GetDefaultDbcLocale()] : "UNNAMEDMAP\x0";
 }
 
+void Map::QueueBonesDecay(Corpse* bones)
+{
+    // deadline mirrors the bones branch of Corpse::IsExpired
+    m_bonesDecayQueue.emplace(bones->GetGhostTime() + 60 * MINUTE + 1, bones->GetObjectGuid());
+}
+
 void Map::UpdateObjectVisibility(WorldObject* obj, Cell cell, const CellPair& cellpair)
 {
     cell.SetNoCreate();
@@ -1522,16 +2389,71 @@ void Map::SendToPlayers(WorldPacket const& data) const
 
 bool Map::SendToPlayersInZone(WorldPacket const& data, uint32 zoneId) const
 {
-    bool foundPlayer = false;
-    for (const auto& itr : m_mapRefManager)
+    std::vector<Player*> const& players = GetPlayersInZone(zoneId);
+    for (Player* player : players)
+        player->GetSession()->SendPacket(data);
+    return !players.empty();
+}
+
+void Map::QueueCombatLogPacket(WorldObject const* source, WorldPacket const& packet)
+{
+    if (!sWorld.getConfig(CONFIG_UINT32_COMBAT_LOG_COALESCE_DELAY))
+    {
+        MessageBroadcast(source, packet);
+        return;
+    }
+
+    m_combatLogQueue[source->GetObjectGuid()].push_back(packet);
+}
+
+void Map::FlushCombatLogQueue()
+{
+    for (auto& batch : m_combatLogQueue)
     {
-        if (itr.getSource()->GetZoneId() == zoneId)
+        // source may have left the map with packets still pending
+        WorldObject* source = GetWorldObject(batch.first);
+        if (!source || !source->IsInWorld())
+            continue;
+
+        ExecuteDistWorker(source, GetVisibilityDistance(), [&batch](Player* viewer)
         {
-            itr.getSource()->GetSession()->SendPacket(data);
-            foundPlayer = true;
-        }
+            for (WorldPacket const& packet : batch.second)
+                viewer->GetSession()->SendPacket(packet);
+        });
+    }
+
+    m_combatLogQueue.clear();
+}
+
+void Map::UpdateZoneRegistry(Player* player, uint32 oldZone, uint32 newZone)
+{
+    if (oldZone != newZone)
+        RemoveFromZoneRegistry(player, oldZone);
+
+    std::vector<Player*>& players = m_zonePlayers[newZone];
+    if (std::find(players.begin(), players.end(), player) == players.end())
+        players.push_back(player);
+}
+
+void Map::RemoveFromZoneRegistry(Player* player, uint32 zoneId)
+{
+    auto itr = m_zonePlayers.find(zoneId);
+    if (itr == m_zonePlayers.end())
+        return;
+
+    auto pos = std::find(itr->second.begin(), itr->second.end(), player);
+    if (pos != itr->second.end())
+    {
+        *pos = itr->second.back();
+        itr->second.pop_back();
     }
-    return foundPlayer;
+}
+
+std::vector<Player*> const& Map::GetPlayersInZone(uint32 zoneId) const
+{
+    static std::vector<Player*> const empty;
+    auto itr = m_zonePlayers.find(zoneId);
+    return itr != m_zonePlayers.end() ? itr->second : empty;
 }
 
 bool Map::ActiveObjectsNearGrid(uint32 x, uint32 y) const
@@ -1926,7 +2848,7 @@ void DungeonMap::Remove(Player* player, bool remove)
 /*
     Returns true if there are no players in the instance
 */
-bool DungeonMap::Reset(InstanceResetMethod method)
+bool DungeonMap::Reset(InstanceResetMethod method, uint32 unloadDelay)
 {
     // note: since the map may not be loaded when the instance needs to be reset
     // the instance must be deleted from the DB by InstanceSaveManager
@@ -1954,8 +2876,8 @@ bool DungeonMap::Reset(InstanceResetMethod method)
     }
     else
     {
-        // unloaded at next update
-        m_unloadTimer = MIN_UNLOAD_DELAY;
+        // unloaded once the (possibly staggered) delay elapses
+        m_unloadTimer = unloadDelay;
         m_resetAfterUnload = true;
     }
 
@@ -2174,7 +3096,8 @@ bool Map::ScriptsStart(ScriptMapType scriptType, uint32 id, Object* source, Obje
     ObjectGuid targetGuid = target ? target->GetObjectGuid() : ObjectGuid();
     ObjectGuid ownerGuid  = source->isType(TYPEMASK_ITEM) ? ((Item*)source)->GetOwnerGuid() : ObjectGuid();
 
-    if (execParams)                                         // Check if the execution should be uniquely
+    // only scan the schedule when steps of this very script are pending
+    if (execParams && m_scheduledScriptCounts.count(MakeScheduledScriptKey(scriptType, id)))
     {
         for (ScriptScheduleMap::const_iterator searchItr = m_scriptSchedule.begin(); searchItr != m_scriptSchedule.end(); ++searchItr)
         {
@@ -2213,6 +3136,8 @@ bool Map::ScriptsStart(ScriptMapType scriptType, uint32 id, Object* source, Obje
         auto const& scriptInfo = scriptInfoItr->second;
         ScriptAction sa(scriptType, this, sourceGuid, targetGuid, ownerGuid, scriptInfo);
         m_scriptSchedule.emplace(GetCurrentClockTime() + std::chrono::milliseconds(scriptInfoItr->first), sa);
+        ++m_scheduledScriptCounts[MakeScheduledScriptKey(scriptType, id)];
+        MemoryTrend::Account(MEMTREND_SCRIPTS, +1);
     }
 
     return true;
@@ -2232,6 +3157,8 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
     if (delay)
     {
         m_scriptSchedule.emplace(GetCurrentClockTime() + std::chrono::milliseconds(delay), sa);
+        ++m_scheduledScriptCounts[MakeScheduledScriptKey(SCRIPT_TYPE_INTERNAL, script.id)];
+        MemoryTrend::Account(MEMTREND_SCRIPTS, +1);
     }
     else
         sa.HandleScriptStep();
@@ -2260,18 +3187,28 @@ void Map::ScriptsProcess()
             for (ScriptScheduleMap::iterator rmItr = m_scriptSchedule.begin(); rmItr != m_scriptSchedule.end();)
             {
                 if (rmItr->second.IsSameScript(tableName, id, sourceGuid, targetGuid, ownerGuid))
-                    m_scriptSchedule.erase(rmItr++);
+                    EraseScheduledScript(rmItr++);
                 else
                     ++rmItr;
             }
         }
         else
-            m_scriptSchedule.erase(iter);
+            EraseScheduledScript(iter);
 
         iter = m_scriptSchedule.begin();
     }
 }
 
+void Map::EraseScheduledScript(ScriptScheduleMap::iterator itr)
+{
+    auto countItr = m_scheduledScriptCounts.find(MakeScheduledScriptKey(itr->second.GetScriptType(), itr->second.GetId()));
+    if (countItr != m_scheduledScriptCounts.end() && --countItr->second == 0)
+        m_scheduledScriptCounts.erase(countItr);
+
+    m_scriptSchedule.erase(itr);
+    MemoryTrend::Account(MEMTREND_SCRIPTS, -1);
+}
+
 /**
  * Function return player that in world at CURRENT map
  *
@@ -2372,6 +3309,25 @@ Unit* Map::GetUnit(ObjectGuid guid)
     return GetAnyTypeCreature(guid);
 }
 
+Unit* ObjectResolutionCache::ResolveUnit(Map* map, ObjectGuid guid)
+{
+    uint32 const epoch = map->GetObjectRemovalCounter();
+    for (auto& entry : m_entries)
+        if (entry.guid == guid && entry.epoch == epoch && entry.unit)
+            return entry.unit;
+
+    Unit* unit = map->GetUnit(guid);
+    if (unit)
+    {
+        CacheEntry& entry = m_entries[m_next];
+        m_next ^= 1;
+        entry.guid = guid;
+        entry.unit = unit;
+        entry.epoch = epoch;
+    }
+    return unit;
+}
+
 /**
  * Function return world object in world at CURRENT map, so any except transports
  */
@@ -2652,10 +3608,31 @@ void Map::PlayDirectSoundToMap(uint32 soundId, uint32 zoneId /*=0*/) const
     WorldPacket data(SMSG_PLAY_SOUND, 4);
     data << uint32(soundId);
 
-    Map::PlayerList const& pList = GetPlayers();
-    for (const auto& itr : pList)
-        if (!zoneId || itr.getSource()->GetZoneId() == zoneId)
+    if (zoneId)
+    {
+        for (Player* player : GetPlayersInZone(zoneId))
+            player->SendDirectMessage(data);
+    }
+    else
+    {
+        Map::PlayerList const& pList = GetPlayers();
+        for (const auto& itr : pList)
             itr.getSource()->SendDirectMessage(data);
+    }
+}
+
+namespace
+{
+    // bound on memoized LoS entries per map (~40 bytes each); the cache is
+    // simply dropped on overflow, correctness never depends on its contents
+    constexpr size_t MAX_LOS_CACHE_SIZE = 0x10000;
+
+    uint32 FloatBits(float value)
+    {
+        uint32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
 }
 
 /**
@@ -2663,8 +3640,39 @@ void Map::PlayDirectSoundToMap(uint32 soundId, uint32 zoneId /*=0*/) const
  */
 bool Map::IsInLineOfSight(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool ignoreM2Model) const
 {
-    return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model)
-           && m_dyn_tree.isInLineOfSight(srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model);
+    // the static BIH walk is the expensive part and its result is immutable
+    // for a given endpoint pair - memoize it; the dynamic tree holds only a
+    // handful of models (transports, elevators) which move every tick, so
+    // that part is always evaluated live
+    LosCacheKey key;
+    key.a = (uint64(FloatBits(srcX)) << 32) | FloatBits(srcY);
+    key.b = (uint64(FloatBits(srcZ)) << 32) | FloatBits(destX);
+    key.c = (uint64(FloatBits(destY)) << 32) | FloatBits(destZ);
+    key.m2 = ignoreM2Model ? 1 : 0;
+
+    bool staticResult;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> guard(m_losCacheLock);
+        auto itr = m_losCache.find(key);
+        if (itr != m_losCache.end())
+        {
+            staticResult = itr->second;
+            cached = true;
+        }
+    }
+
+    if (!cached)
+    {
+        staticResult = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model);
+
+        std::lock_guard<std::mutex> guard(m_losCacheLock);
+        if (m_losCache.size() >= MAX_LOS_CACHE_SIZE)
+            m_losCache.clear();
+        m_losCache[key] = staticResult;
+    }
+
+    return staticResult && m_dyn_tree.isInLineOfSight(srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model);
 }
 
 /**
@@ -2760,6 +3768,15 @@ float Map::GetHeight(float x, float y, float z, bool swim) const
     return std::max<float>(staticHeight, m_dyn_tree.getHeight(x, y, dynSearchHeight, dynSearchHeight - staticHeight));
 }
 
+float Map::GetHeight(TerrainInfo::TerrainCursor& cursor, float x, float y, float z, bool swim) const
+{
+    float staticHeight = m_TerrainData->GetHeightStatic(cursor, x, y, z, true, (swim ? DEFAULT_WATER_SEARCH : DEFAULT_HEIGHT_SEARCH));
+
+    // Get Dynamic Height around static Height (if valid)
+    float dynSearchHeight = 2.0f + (z < staticHeight ? staticHeight : z);
+    return std::max<float>(staticHeight, m_dyn_tree.getHeight(x, y, dynSearchHeight, dynSearchHeight - staticHeight));
+}
+
 void Map::InsertGameObjectModel(const GameObjectModel& mdl)
 {
     m_dyn_tree.insert(mdl);
@@ -41,9 +41,12 @@
 #include "Util/UniqueTrackablePtr.h"
 #include "World/WorldStateVariableManager.h"
 
+#include <array>
 #include <bitset>
 #include <functional>
 #include <list>
+#include <mutex>
+#include <unordered_map>
 
 struct CreatureInfo;
 class Creature;
@@ -63,6 +66,7 @@ class WeatherSystem;
 class GenericTransport;
 namespace MaNGOS { struct ObjectUpdater; }
 class Transport;
+class MapUpdater;
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push,N), also any gcc version not support it at some platform
 #if defined( __GNUC__ )
@@ -131,6 +135,8 @@ class Map : public GridRefManager<NGridType>
         static void DeleteFromWorld(Player* pl);        // player object will deleted at call
 
         void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
+        void MarkNearbyCellsOf(WorldObject* obj, std::vector<uint32>& cellIds);
+        uint64 UpdateObjectsParallel(WorldObjectUnSet& objToUpdate, uint32 t_diff, MapUpdater& updater);
         virtual void Update(const uint32&);
 
         void MessageBroadcast(Player const*, WorldPacket const&, bool to_self);
@@ -147,11 +153,17 @@ class Map : public GridRefManager<NGridType>
         void ExecuteMapWorkerArea(uint32 areaId, std::function<void(Player*)> const& worker);
 
         float GetVisibilityDistance() const { return m_VisibleDistance; }
+        // load governor scale for the grid containing (x,y): 1.0 normally,
+        // below 1.0 while the grid holds more players than the configured
+        // threshold (see UpdateVisibilityGovernor)
+        float GetVisibilityScale(float x, float y) const;
         // function for setting up visibility distance for maps on per-type/per-Id basis
         virtual void InitVisibilityDistance();
 
-        void PlayerRelocation(Player*, float x, float y, float z, float orientation);
-        void CreatureRelocation(Creature* creature, float x, float y, float z, float ang);
+        // notify=false skips the visibility/AI notifier cascade - used by transports,
+        // which relocate all passengers as a group and notify once per transport
+        void PlayerRelocation(Player*, float x, float y, float z, float orientation, bool notify = true);
+        void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool notify = true);
         void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true);
 
         template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
@@ -159,7 +171,7 @@ class Map : public GridRefManager<NGridType>
         bool IsRemovalGrid(float x, float y) const
         {
             GridPair p = MaNGOS::ComputeGridPair(x, y);
-            return (!getNGrid(p.x_coord, p.y_coord) || getNGrid(p.x_coord, p.y_coord)->GetGridState() == GRID_STATE_REMOVAL);
+            return (!getNGrid(p.x_coord, p.y_coord) || getNGrid(p.x_coord, p.y_coord)->GetGridState() >= GRID_STATE_REMOVAL);
         }
 
         bool IsLoaded(float x, float y) const
@@ -171,7 +183,17 @@ class Map : public GridRefManager<NGridType>
         bool GetUnloadLock(const GridPair& p) const { return getNGrid(p.x_coord, p.y_coord)->getUnloadLock(); }
         void SetUnloadLock(const GridPair& p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadExplicitLock(on); }
         void ForceLoadGrid(float x, float y);
+        // deferred ForceLoadGrid: queued grids are object-loaded in bounded
+        // batches from Map::Update, nearest grids to players first, so a mass
+        // preload (LoadAllGridsOnMaps) ramps up instead of stalling map creation
+        void QueueGridWarmup(float x, float y);
         bool UnloadGrid(const uint32& x, const uint32& y, bool pForce);
+        // incremental grid teardown: Begin stops combat, moves creatures to their
+        // respawn grids and marks the grid GRID_STATE_UNLOADING; Continue then
+        // destructs a bounded slice of cells per call (all remaining ones when
+        // limited is false) and returns true once the grid is deleted
+        bool BeginUnloadGrid(const uint32& x, const uint32& y, bool pForce);
+        bool ContinueUnloadGrid(const uint32& x, const uint32& y, bool limited = true);
         virtual void UnloadAll(bool pForce);
 
         void ResetGridExpiry(NGridType& grid, float factor = 1) const
@@ -213,22 +235,66 @@ class Map : public GridRefManager<NGridType>
 
         void UpdateObjectVisibility(WorldObject* obj, Cell cell, const CellPair& cellpair);
 
+        // incremental active-cell set - each player's adjacency area is applied
+        // on relocation instead of being re-marked from scratch every tick
+        void UpdateCellActivity(Player* player);
+        void RemoveCellActivity(Player* player);
+
         void resetMarkedCells() { marked_cells.reset(); }
         bool isCellMarked(uint32 pCellId) const { return marked_cells.test(pCellId); }
         void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
 
+        // per-tick shared cell object snapshots used by camera visibility scans;
+        // the packed struct-of-arrays position mirror lets range scans run the
+        // distance cut without dereferencing the objects themselves
+        struct CellSnapshot
+        {
+            std::vector<WorldObject*> objects;
+            std::vector<float> x, y, z;                         // mirrored positions, refreshed on relocation
+            std::vector<float> reach;                           // combat reach (0 for non-units)
+            std::vector<uint8> isUnit;
+            std::unordered_map<WorldObject*, uint32> slots;     // object -> mirror slot, for the relocation refresh
+        };
+        CellSnapshot const& GetCellSnapshot(CellPair const& cellPair);
+        void InvalidateCellSnapshot(Cell const& cell);
+        void InvalidateCellSnapshots();
+        void RefreshCellSnapshotPosition(WorldObject* obj);
+        // Conservative unit range scan over the position mirror: the per-lane cut is
+        // radius padded by both sides' combat reach (superset of IsWithinDistInMap),
+        // so callers run their exact checks on the survivors only
+        void ScanSnapshotUnitsInRange(float cx, float cy, float cz, float radius, float centerReach, std::vector<Unit*>& out);
+
+        // per-cell creature faction index for assistance searches: hands out
+        // creatures around center whose indexed faction template passes filter,
+        // without visiting every grid object in range; callers re-run the full
+        // eligibility checks (distance, LOS, combat state) on the candidates
+        void VisitFactionIndexed(WorldObject const* center, float radius, std::function<bool(uint32 factionTemplateId)> const& filter, std::vector<Creature*>& out);
+        void UpdateFactionIndex(Creature* creature, uint32 faction);
+
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(uint32 x, uint32 y) const;
 
         /// Send a Packet to all players on a map
         void SendToPlayers(WorldPacket const& data) const;
+
+        // combat log coalescer - damage and periodic log packets are buffered
+        // per source and delivered with one viewer resolution per source when
+        // the grouping window elapses (CombatLogCoalesceDelay, 0 = immediate)
+        void QueueCombatLogPacket(WorldObject const* source, WorldPacket const& packet);
         /// Send a Packet to all players in a zone. Return false if no player found
         bool SendToPlayersInZone(WorldPacket const& data, uint32 zoneId) const;
 
         typedef MapRefManager PlayerList;
         PlayerList const& GetPlayers() const { return m_mapRefManager; }
 
+        // per-zone player registry, maintained on Player::UpdateZone transitions -
+        // zone-scoped broadcasts and workers iterate this instead of scanning
+        // the whole map player list
+        void UpdateZoneRegistry(Player* player, uint32 oldZone, uint32 newZone);
+        void RemoveFromZoneRegistry(Player* player, uint32 zoneId);
+        std::vector<Player*> const& GetPlayersInZone(uint32 zoneId) const;
+
         // per-map script storage
         enum ScriptExecutionParam
         {
@@ -258,6 +324,10 @@ class Map : public GridRefManager<NGridType>
         GameObject* GetGameObject(ObjectGuid guid);
         DynamicObject* GetDynamicObject(ObjectGuid guid);
         Corpse* GetCorpse(ObjectGuid guid) const;                 // !!! find corpse can be not in world
+        // schedule bones removal for when their decay time elapses; processed in
+        // Update, so decay cost is bound by what expires this tick and not by
+        // how many bones have piled up on the map
+        void QueueBonesDecay(Corpse* bones);
         Unit* GetUnit(ObjectGuid guid);                     // only use if sure that need objects at current map, specially for player case
         WorldObject* GetWorldObject(ObjectGuid guid);       // only use if sure that need objects at current map, specially for player case
         // dbguid methods
@@ -281,6 +351,30 @@ class Map : public GridRefManager<NGridType>
 
         typedef TypeUnorderedMapContainer<AllMapStoredObjectTypes, ObjectGuid> MapStoredObjectTypesContainer;
         MapStoredObjectTypesContainer& GetObjectsStore() { return m_objectsStore; }
+
+        // monotonically increasing count of erases from the object store and of
+        // player removals; ObjectResolutionCache entries carry the value they
+        // were resolved under, so a cached pointer is only trusted while no
+        // object has left the map since
+        uint32 GetObjectRemovalCounter() const { return m_objectRemovalCounter; }
+        void IncrementObjectRemovalCounter() { ++m_objectRemovalCounter; }
+
+        // population/memory snapshot for the instrumentation surface
+        // (.server info maps and the map.memory metric)
+        struct MapMemoryStats
+        {
+            uint32 creatures = 0;
+            uint32 pets = 0;
+            uint32 gameObjects = 0;
+            uint32 dynamicObjects = 0;
+            uint32 loadedGrids = 0;
+            uint32 activeObjects = 0;       // world objects resident in loaded grid cells
+            uint32 terrainTiles = 0;
+            uint64 terrainBytes = 0;
+            uint32 navMeshTiles = 0;
+            uint64 navMeshBytes = 0;
+        };
+        MapMemoryStats GetMemoryStats();
         std::map<uint32, uint32>& GetTempCreatures() { return m_tempCreatures; }
         std::map<uint32, uint32>& GetTempPets() { return m_tempPets; }
 
@@ -310,6 +404,8 @@ class Map : public GridRefManager<NGridType>
 
         // Dynamic VMaps
         float GetHeight(float x, float y, float z, bool swim = false) const;
+        // cursor variant: repeated queries in one tile skip the terrain lookup chain
+        float GetHeight(TerrainInfo::TerrainCursor& cursor, float x, float y, float z, bool swim = false) const;
         bool GetHeightInRange(float x, float y, float& z, float maxSearchDist = 4.0f) const;
         bool IsInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, bool ignoreM2Model) const;
         bool GetHitPosition(float srcX, float srcY, float srcZ, float& destX, float& destY, float& destZ, float modifyDist) const;
@@ -348,6 +444,7 @@ class Map : public GridRefManager<NGridType>
         uint32 GetCurrentMSTime() const;
         TimePoint GetCurrentClockTime() const;
         uint32 GetCurrentDiff() const;
+        uint32 GetUpdateTick() const { return m_updateTick; }
         time_t GetCurrentTime_t() const;
         tm GetCurrentTime_tm() const;
 
@@ -400,6 +497,8 @@ class Map : public GridRefManager<NGridType>
         bool CreatureCellRelocation(Creature* c, const Cell& new_cell);
 
         bool loaded(const GridPair&) const;
+        void UpdateGridWarmup();
+        void UpdateVisibilityGovernor(uint32 diff);
         void EnsureGridCreated(const GridPair&);
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedAtEnter(Cell const&, Player* player = nullptr);
@@ -422,12 +521,22 @@ class Map : public GridRefManager<NGridType>
         void SendObjectUpdates();
         std::set<Object*> i_objectsToClientUpdate;
 
+        std::set<uint32> m_warmupGrids;                     // packed grid coords pending deferred object load
+
+        std::unordered_map<uint32, float> m_visibilityScale; // packed grid coords -> visibility distance scale of crowded grids
+        uint32 m_visibilityGovernorTimer;
+
+        // objects whose update was preempted by the tick budget (MapUpdate.TickBudget),
+        // carried by guid into the next tick and processed there first
+        std::vector<ObjectGuid> m_preemptedObjects;
+
     protected:
         MapEntry const* i_mapEntry;
         uint32 i_id;
         uint32 i_InstanceId;
         MaNGOS::unique_weak_ptr<Map> m_weakRef;
         uint32 m_unloadTimer;
+        uint32 m_memoryStatsTimer;                          // interval between map.memory metric reports
         float m_VisibleDistance;
         MapPersistentState* m_persistentState;
 
@@ -438,6 +547,7 @@ class Map : public GridRefManager<NGridType>
         ActiveNonPlayers m_activeNonPlayers;
         ActiveNonPlayers::iterator m_activeNonPlayersIter;
         MapStoredObjectTypesContainer m_objectsStore;
+        uint32 m_objectRemovalCounter;
         std::map<uint32, uint32> m_tempCreatures;
         std::map<uint32, uint32> m_tempPets;
         std::map<std::pair<HighGuid, uint32>, std::vector<WorldObject*>> m_dbGuidObjects;
@@ -452,8 +562,10 @@ class Map : public GridRefManager<NGridType>
         time_t i_gridExpiry;
         time_t m_curTime;
         tm m_curTimeTm;
+        uint32 m_updateTick;                                // incremented once per Map::Update, used to dedupe owner-driven minion updates
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        uint16 m_gridUnloadProgress[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS]; // next cell index to destruct for grids in GRID_STATE_UNLOADING
 
         // Shared geodata object with map coord info...
         TerrainInfo* const m_TerrainData;
@@ -461,10 +573,73 @@ class Map : public GridRefManager<NGridType>
 
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
+        // cells activated by player adjacency, see UpdateCellActivity; the word
+        // array lets the update loop skip inactive regions 64 cells at a time
+        void ApplyCellActivity(CellArea const& area, int32 delta);
+        std::array<uint64, (TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP + 63) / 64> m_activeCellWords;
+        std::unordered_map<uint32, uint16> m_cellActivityCounts;
+        std::unordered_map<ObjectGuid, CellArea> m_cellActivityAreas;
+
+        // guarded because grid membership can change from map update sub-tasks
+        std::unordered_map<uint32, CellSnapshot> m_cellSnapshots;
+        std::mutex m_cellSnapshotLock;
+
+        // bones ordered by decay deadline, filled when bones are spawned
+        std::multimap<time_t, ObjectGuid> m_bonesDecayQueue;
+
+        // players currently in each zone, see UpdateZoneRegistry
+        std::unordered_map<uint32, std::vector<Player*>> m_zonePlayers;
+
+        // pending combat log packets per source, see QueueCombatLogPacket
+        void FlushCombatLogQueue();
+        std::unordered_map<ObjectGuid, std::vector<WorldPacket>> m_combatLogQueue;
+        uint32 m_combatLogTimer;
+
+        // per-cell creature faction index, maintained in AddToGrid/RemoveFromGrid
+        // and refreshed by Unit::setFaction; guarded for the same reason as above
+        struct CellFactionEntry
+        {
+            uint32 faction;
+            Creature* creature;
+        };
+        void AddToFactionIndex(Creature* obj, Cell const& cell);
+        void RemoveFromFactionIndex(Creature* obj, Cell const& cell);
+        std::unordered_map<uint32, std::vector<CellFactionEntry>> m_cellFactionIndex;
+        std::mutex m_cellFactionLock;
+
+        // memoized static-vmap LoS results - aura ticks, spell target checks
+        // and AI reactions re-query identical endpoint pairs dozens of times a
+        // second while nobody moves, and static geometry never changes
+        struct LosCacheKey
+        {
+            uint64 a, b, c; // the six coordinate bit patterns
+            uint32 m2;      // ignoreM2Model
+
+            bool operator==(LosCacheKey const& other) const { return a == other.a && b == other.b && c == other.c && m2 == other.m2; }
+        };
+        struct LosCacheKeyHash
+        {
+            size_t operator()(LosCacheKey const& key) const
+            {
+                uint64 hash = key.a * 0x9E3779B97F4A7C15ull;
+                hash ^= key.b + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+                hash ^= key.c + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+                return size_t(hash ^ key.m2);
+            }
+        };
+        mutable std::unordered_map<LosCacheKey, bool, LosCacheKeyHash> m_losCache;
+        mutable std::mutex m_losCacheLock;
+
         WorldObjectSet i_objectsToRemove;
 
         typedef std::multimap<TimePoint, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
+        // pending step count per (script type, id) - lets uniqueness checks in
+        // ScriptsStart skip the schedule scan when no same script is pending
+        std::unordered_map<uint64, uint32> m_scheduledScriptCounts;
+
+        static uint64 MakeScheduledScriptKey(ScriptMapType scriptType, uint32 id) { return (uint64(scriptType) << 32) | id; }
+        void EraseScheduledScript(ScriptScheduleMap::iterator itr);
 
         InstanceData* i_data;
         uint32 i_script_id;
@@ -543,7 +718,9 @@ class DungeonMap : public Map
         bool Add(Player*) override;
         void Remove(Player*, bool) override;
         void Update(const uint32&) override;
-        bool Reset(InstanceResetMethod method);
+        // unloadDelay staggers the teardown of empty instances at a global
+        // reset, so hundreds of maps do not unload within the same update cycle
+        bool Reset(InstanceResetMethod method, uint32 unloadDelay = MIN_UNLOAD_DELAY);
         void PermBindAllPlayers(Player* player = nullptr);
         void UnloadAll(bool pForce) override;
         void SendResetWarnings(uint32 timeLeft) const;
@@ -26,8 +26,10 @@
 #include "World/World.h"
 #include "Grids/CellImpl.h"
 #include "Globals/ObjectMgr.h"
+#include "Util/TickArena.h"
 #include "Maps/MapWorkers.h"
 #include "BattleGround/BattleGroundMgr.h"
+#include "Config/Config.h"
 #include <future>
 
 #define CLASS_LOCK MaNGOS::ClassLevelLockable<MapManager, std::recursive_mutex>
@@ -35,7 +37,7 @@ INSTANTIATE_SINGLETON_2(MapManager, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(MapManager, std::recursive_mutex);
 
 MapManager::MapManager()
-    : i_gridCleanUpDelay(sWorld.getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN))
+    : i_gridCleanUpDelay(sWorld.getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN)), m_prewarmCount(0)
 {
     i_timer.SetInterval(sWorld.getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
 }
@@ -55,7 +57,29 @@ void MapManager::Initialize()
 
     int num_threads(sWorld.getConfig(CONFIG_UINT32_NUM_MAP_THREADS));
     if (num_threads > 0)
+    {
+        std::vector<uint32> affinity;
+        for (std::string const& token : StrSplit(sConfig.GetStringDefault("MapUpdate.ThreadAffinity", ""), ","))
+            affinity.push_back(atoi(token.c_str()));
+        m_updater.SetWorkerAffinity(std::move(affinity));
+        m_updater.SetAffinityGroups(sConfig.GetIntDefault("MapUpdate.AffinityGroups", 0));
         m_updater.activate(num_threads);
+    }
+
+    m_prewarmCount = sConfig.GetIntDefault("Instance.Prewarm.Count", 1);
+    std::string prewarmMapIds = sConfig.GetStringDefault("Instance.Prewarm.MapIds", "");
+    for (std::string const& token : StrSplit(prewarmMapIds, ","))
+    {
+        uint32 mapId = atoi(token.c_str());
+        MapEntry const* entry = sMapStore.LookupEntry(mapId);
+        if (!entry || !entry->IsDungeon() || !ObjectMgr::GetInstanceTemplate(mapId))
+        {
+            sLog.outError("MapManager: Instance.Prewarm.MapIds entry '%s' is not an instanceable dungeon map, ignored", token.c_str());
+            continue;
+        }
+
+        m_prewarmMapIds.push_back(mapId);
+    }
 }
 
 void MapManager::InitStateMachine()
@@ -64,6 +88,7 @@ void MapManager::InitStateMachine()
     si_GridStates[GRID_STATE_ACTIVE] = new ActiveState;
     si_GridStates[GRID_STATE_IDLE] = new IdleState;
     si_GridStates[GRID_STATE_REMOVAL] = new RemovalState;
+    si_GridStates[GRID_STATE_UNLOADING] = new UnloadingState;
 }
 
 void MapManager::DeleteStateMachine()
@@ -72,6 +97,7 @@ void MapManager::DeleteStateMachine()
     delete si_GridStates[GRID_STATE_ACTIVE];
     delete si_GridStates[GRID_STATE_IDLE];
     delete si_GridStates[GRID_STATE_REMOVAL];
+    delete si_GridStates[GRID_STATE_UNLOADING];
 }
 
 void MapManager::UpdateGridState(grid_state_t state, Map& map, NGridType& ngrid, GridInfo& ginfo, const uint32& x, const uint32& y, const uint32& t_diff)
@@ -190,6 +216,23 @@ void MapManager::DeleteInstance(uint32 mapid, uint32 instanceId)
     }
 }
 
+// builds one missing instance pre-warm pool entry; scheduled alongside the map
+// update workers so construction overlaps the update phase on the worker pool
+class InstancePrewarmWorker : public Worker
+{
+    public:
+        InstancePrewarmWorker(MapManager& manager, MapUpdater& updater) : Worker(updater), m_manager(manager) {}
+
+        void execute() override
+        {
+            m_manager.PrewarmInstances();
+            GetWorker().update_finished();
+        }
+
+    private:
+        MapManager& m_manager;
+};
+
 void MapManager::Update(uint32 diff)
 {
     i_timer.Update(diff);
@@ -199,13 +242,25 @@ void MapManager::Update(uint32 diff)
     for (auto& map : i_maps)
     {
         if (m_updater.activated())
-            m_updater.schedule_update(new MapUpdateWorker(*map.second, (uint32)i_timer.GetCurrent(), m_updater));
+            m_updater.schedule_update(new MapUpdateWorker(*map.second, (uint32)i_timer.GetCurrent(), m_updater), map.second->GetId());
         else
             map.second->Update((uint32)i_timer.GetCurrent());
     }
 
     if (m_updater.activated())
+    {
+        if (!m_prewarmMapIds.empty())
+            m_updater.schedule_update(new InstancePrewarmWorker(*this, m_updater));
+
         m_updater.wait();
+    }
+    else
+    {
+        if (!m_prewarmMapIds.empty())
+            PrewarmInstances();
+
+        MaNGOS::TickArena::Instance().Reset();
+    }
 
     // remove all maps which can be unloaded
     MapMapType::iterator iter = i_maps.begin();
@@ -329,9 +384,15 @@ Map* MapManager::CreateInstance(uint32 id, Player* player)
     {
         // if no instanceId via group members or instance saves is found
         // the instance will be created for the first time
-        NewInstanceId = GenerateInstanceId();
 
-        pNewMap = CreateDungeonMap(id, NewInstanceId);
+        // bind a ready pre-warmed instance instead of building the map now
+        map = TakePrewarmedInstance(id);
+        if (!map)
+        {
+            NewInstanceId = GenerateInstanceId();
+
+            pNewMap = CreateDungeonMap(id, NewInstanceId);
+        }
     }
 
     // add a new map object into the registry
@@ -372,6 +433,76 @@ DungeonMap* MapManager::CreateDungeonMap(uint32 id, uint32 InstanceId, DungeonPe
     return map;
 }
 
+/**
+  Method that tops up the instance pre-warm pool with fresh unbound instances
+  - runs on a MapUpdater worker while the world thread waits for the update phase,
+    so the global managers touched by Map::Initialize see no concurrent world thread
+  - builds at most one instance per update tick to keep the worker pool responsive
+  - an instance that sits unclaimed past Instance.UnloadDelay is unloaded again by
+    the never-entered unload timer every DungeonMap starts with
+*/
+void MapManager::PrewarmInstances()
+{
+    for (uint32 mapId : m_prewarmMapIds)
+    {
+        {
+            Guard guard(*this);
+            std::lock_guard<std::mutex> lock(m_prewarmLock);
+
+            std::deque<uint32>& pool = m_prewarmedInstances[mapId];
+            // drop entries whose instance was meanwhile unloaded again
+            while (!pool.empty() && i_maps.find(MapID(mapId, pool.front())) == i_maps.end())
+                pool.pop_front();
+
+            if (pool.size() >= m_prewarmCount)
+                continue;
+        }
+
+        uint32 instanceId = GenerateInstanceId();
+        DungeonMap* map = CreateDungeonMap(mapId, instanceId);
+
+        Guard guard(*this);
+        MaNGOS::unique_trackable_ptr<Map>& ptr = i_maps[MapID(mapId, instanceId)];
+        ptr.reset(map);
+        map->SetWeakPtr(ptr);
+
+        std::lock_guard<std::mutex> lock(m_prewarmLock);
+        m_prewarmedInstances[mapId].push_back(instanceId);
+
+        // one instance per tick - the next missing one is built on a later update
+        return;
+    }
+}
+
+/**
+  Method that hands out a ready pre-warmed instance of the given map
+  - returns nullptr when the pool has none, making the caller build one synchronously
+
+  @param    map id
+*/
+Map* MapManager::TakePrewarmedInstance(uint32 mapId)
+{
+    Guard guard(*this);
+    std::lock_guard<std::mutex> lock(m_prewarmLock);
+
+    auto poolItr = m_prewarmedInstances.find(mapId);
+    if (poolItr == m_prewarmedInstances.end())
+        return nullptr;
+
+    while (!poolItr->second.empty())
+    {
+        uint32 instanceId = poolItr->second.front();
+        poolItr->second.pop_front();
+
+        // the instance may have been unloaded again while it sat unclaimed
+        MapMapType::const_iterator mapItr = i_maps.find(MapID(mapId, instanceId));
+        if (mapItr != i_maps.end())
+            return mapItr->second.get();
+    }
+
+    return nullptr;
+}
+
 BattleGroundMap* MapManager::CreateBattleGroundMap(uint32 id, uint32 InstanceId, BattleGround* bg)
 {
     DEBUG_LOG("MapInstanced::CreateBattleGroundMap: instance:%d for map:%d and bgType:%d created.", InstanceId, id, bg->GetTypeId());
@@ -28,6 +28,8 @@
 #include "Maps/MapUpdater.h"
 #include "Util/UniqueTrackablePtr.h"
 
+#include <deque>
+
 class Transport;
 class BattleGround;
 struct TransportTemplate;
@@ -75,6 +77,12 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         void Initialize();
         void Update(uint32);
 
+        // builds missing instance pre-warm pool entries; called on a MapUpdater
+        // worker while the world thread waits for the map update phase
+        void PrewarmInstances();
+
+        MapUpdater& GetMapUpdater() { return m_updater; }
+
         void SetGridCleanUpDelay(uint32 t)
         {
             if (t < MIN_GRID_DELAY)
@@ -174,11 +182,19 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         DungeonMap* CreateDungeonMap(uint32 id, uint32 InstanceId, DungeonPersistentState* save = nullptr);
         BattleGroundMap* CreateBattleGroundMap(uint32 id, uint32 InstanceId, BattleGround* bg);
 
+        Map* TakePrewarmedInstance(uint32 mapId);
+
         std::mutex m_lock;
         uint32 i_gridCleanUpDelay;
         MapMapType i_maps;
         IntervalTimer i_timer;
 
+        // instance pre-warm pool: ready but not yet claimed instance ids per map id
+        std::vector<uint32> m_prewarmMapIds;
+        uint32 m_prewarmCount;
+        std::map<uint32, std::deque<uint32>> m_prewarmedInstances;
+        std::mutex m_prewarmLock;
+
         std::atomic<uint32> i_MaxInstanceId;
         MapUpdater m_updater;
 };
@@ -78,21 +78,7 @@ void MapPersistentState::SaveCreatureRespawnTime(uint32 loguid, time_t t)
     if (GetMapEntry()->IsBattleGround())
         return;
 
-    CharacterDatabase.BeginTransaction();
-
-    static SqlStatementID delSpawnTime ;
-    static SqlStatementID insSpawnTime ;
-
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delSpawnTime, "DELETE FROM creature_respawn WHERE guid = ? AND instance = ?");
-    stmt.PExecute(loguid, m_instanceid);
-
-    if (t > sWorld.GetGameTime())
-    {
-        stmt = CharacterDatabase.CreateStatement(insSpawnTime, "INSERT INTO creature_respawn VALUES ( ?, ?, ? )");
-        stmt.PExecute(loguid, uint64(t), m_instanceid);
-    }
-
-    CharacterDatabase.CommitTransaction();
+    sMapPersistentStateMgr.JournalCreatureRespawnTime(loguid, m_instanceid, t);
 }
 
 void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
@@ -103,21 +89,7 @@ void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
     if (GetMapEntry()->IsBattleGround())
         return;
 
-    CharacterDatabase.BeginTransaction();
-
-    static SqlStatementID delSpawnTime ;
-    static SqlStatementID insSpawnTime ;
-
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delSpawnTime, "DELETE FROM gameobject_respawn WHERE guid = ? AND instance = ?");
-    stmt.PExecute(loguid, m_instanceid);
-
-    if (t > sWorld.GetGameTime())
-    {
-        stmt = CharacterDatabase.CreateStatement(insSpawnTime, "INSERT INTO gameobject_respawn VALUES ( ?, ?, ? )");
-        stmt.PExecute(loguid, uint64(t), m_instanceid);
-    }
-
-    CharacterDatabase.CommitTransaction();
+    sMapPersistentStateMgr.JournalGORespawnTime(loguid, m_instanceid, t);
 }
 
 time_t MapPersistentState::GetObjectRespawnTime(uint32 typeId, uint32 loguid) const
@@ -272,6 +244,8 @@ void DungeonPersistentState::SaveToDB()
 
 void DungeonPersistentState::DeleteRespawnTimes()
 {
+    sMapPersistentStateMgr.DropRespawnJournal(GetInstanceId());
+
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM creature_respawn WHERE instance = '%u'", GetInstanceId());
     CharacterDatabase.PExecute("DELETE FROM gameobject_respawn WHERE instance = '%u'", GetInstanceId());
@@ -616,7 +590,7 @@ void DungeonResetScheduler::ResetAllRaid()
 
 //== MapPersistentStateManager functions =========================
 
-MapPersistentStateManager::MapPersistentStateManager() : lock_instLists(false), m_Scheduler(*this)
+MapPersistentStateManager::MapPersistentStateManager() : lock_instLists(false), m_Scheduler(*this), m_nextRespawnJournalFlush(0)
 {
 }
 
@@ -695,6 +669,8 @@ void MapPersistentStateManager::DeleteInstanceFromDB(uint32 instanceid)
 {
     if (instanceid)
     {
+        sMapPersistentStateMgr.DropRespawnJournal(instanceid);
+
         CharacterDatabase.BeginTransaction();
         CharacterDatabase.PExecute("DELETE FROM instance WHERE id = '%u'", instanceid);
         CharacterDatabase.PExecute("DELETE FROM character_instance WHERE instance = '%u'", instanceid);
@@ -705,6 +681,101 @@ void MapPersistentStateManager::DeleteInstanceFromDB(uint32 instanceid)
     }
 }
 
+void MapPersistentStateManager::Update()
+{
+    m_Scheduler.Update();
+
+    time_t now = sWorld.GetGameTime();
+    if (now >= m_nextRespawnJournalFlush)
+    {
+        FlushRespawnJournal();
+        m_nextRespawnJournalFlush = now + RESPAWN_JOURNAL_FLUSH_DELAY;
+    }
+}
+
+void MapPersistentStateManager::JournalCreatureRespawnTime(uint32 loguid, uint32 instanceId, time_t t)
+{
+    std::lock_guard<std::mutex> lock(m_respawnJournalLock);
+    m_creatureRespawnJournal[std::make_pair(loguid, instanceId)] = t;
+}
+
+void MapPersistentStateManager::JournalGORespawnTime(uint32 loguid, uint32 instanceId, time_t t)
+{
+    std::lock_guard<std::mutex> lock(m_respawnJournalLock);
+    m_goRespawnJournal[std::make_pair(loguid, instanceId)] = t;
+}
+
+void MapPersistentStateManager::FlushRespawnJournal()
+{
+    RespawnJournal creatures;
+    RespawnJournal gos;
+    {
+        std::lock_guard<std::mutex> lock(m_respawnJournalLock);
+        std::swap(creatures, m_creatureRespawnJournal);
+        std::swap(gos, m_goRespawnJournal);
+    }
+
+    if (creatures.empty() && gos.empty())
+        return;
+
+    static SqlStatementID delCreatureSpawnTime;
+    static SqlStatementID insCreatureSpawnTime;
+    static SqlStatementID delGoSpawnTime;
+    static SqlStatementID insGoSpawnTime;
+
+    time_t now = sWorld.GetGameTime();
+
+    CharacterDatabase.BeginTransaction();
+
+    for (auto& entry : creatures)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(delCreatureSpawnTime, "DELETE FROM creature_respawn WHERE guid = ? AND instance = ?");
+        stmt.PExecute(entry.first.first, entry.first.second);
+
+        // a respawn time that elapsed while journaled needs no row - the creature is up again
+        if (entry.second > now)
+        {
+            stmt = CharacterDatabase.CreateStatement(insCreatureSpawnTime, "INSERT INTO creature_respawn VALUES ( ?, ?, ? )");
+            stmt.PExecute(entry.first.first, uint64(entry.second), entry.first.second);
+        }
+    }
+
+    for (auto& entry : gos)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(delGoSpawnTime, "DELETE FROM gameobject_respawn WHERE guid = ? AND instance = ?");
+        stmt.PExecute(entry.first.first, entry.first.second);
+
+        if (entry.second > now)
+        {
+            stmt = CharacterDatabase.CreateStatement(insGoSpawnTime, "INSERT INTO gameobject_respawn VALUES ( ?, ?, ? )");
+            stmt.PExecute(entry.first.first, uint64(entry.second), entry.first.second);
+        }
+    }
+
+    CharacterDatabase.CommitTransaction();
+}
+
+void MapPersistentStateManager::DropRespawnJournal(uint32 instanceId)
+{
+    std::lock_guard<std::mutex> lock(m_respawnJournalLock);
+
+    for (RespawnJournal::iterator itr = m_creatureRespawnJournal.begin(); itr != m_creatureRespawnJournal.end();)
+    {
+        if (itr->first.second == instanceId)
+            itr = m_creatureRespawnJournal.erase(itr);
+        else
+            ++itr;
+    }
+
+    for (RespawnJournal::iterator itr = m_goRespawnJournal.begin(); itr != m_goRespawnJournal.end();)
+    {
+        if (itr->first.second == instanceId)
+            itr = m_goRespawnJournal.erase(itr);
+        else
+            ++itr;
+    }
+}
+
 void MapPersistentStateManager::RemovePersistentState(uint32 mapId, uint32 instanceId)
 {
     if (lock_instLists)
@@ -879,12 +950,21 @@ void MapPersistentStateManager::_ResetInstance(uint32 mapid, uint32 instanceId)
 
 struct MapPersistantStateResetWorker
 {
+    // milliseconds between consecutive instance unloads at a global reset; the
+    // teardown itself runs in each map's own update on the worker pool, this
+    // only keeps hundreds of unloads from landing in the same update cycle
+    static uint32 const UNLOAD_STAGGER_INTERVAL = 250;
+
     MapPersistantStateResetWorker() {};
     void operator()(Map* map)
     {
         ((DungeonMap*)map)->TeleportAllPlayersTo(TELEPORT_LOCATION_HOMEBIND);
-        ((DungeonMap*)map)->Reset(INSTANCE_RESET_GLOBAL);
+        ((DungeonMap*)map)->Reset(INSTANCE_RESET_GLOBAL, MIN_UNLOAD_DELAY + m_unloadDelay);
+        m_unloadDelay += UNLOAD_STAGGER_INTERVAL;
     }
+
+    private:
+        uint32 m_unloadDelay = 0;
 };
 
 struct MapPersistantStateWarnWorker
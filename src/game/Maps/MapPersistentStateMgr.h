@@ -40,6 +40,9 @@ class Map;
 
 #define NORMAL_INSTANCE_RESET_TIME 30 * MINUTE
 
+// seconds between flushes of the write-behind respawn journal
+#define RESPAWN_JOURNAL_FLUSH_DELAY 60
+
 typedef std::set<uint32> CellGuidSet;
 
 struct MapCellObjectGuids
@@ -349,7 +352,18 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
 
         void GetStatistics(uint32& numStates, uint32& numBoundPlayers, uint32& numBoundGroups);
 
-        void Update() { m_Scheduler.Update(); }
+        void Update();
+
+        // write-behind respawn journal: respawn time changes are collected here from the
+        // map update threads and flushed as one transaction per interval by the world
+        // thread (and once more at shutdown). Crash recovery: at most the last flush
+        // interval of changes is lost - the affected creatures/gameobjects simply stand
+        // respawned after restart, same as a death lost by the old per-death write.
+        void JournalCreatureRespawnTime(uint32 loguid, uint32 instanceId, time_t t);
+        void JournalGORespawnTime(uint32 loguid, uint32 instanceId, time_t t);
+        void FlushRespawnJournal();
+        // forget not yet flushed changes of an instance whose respawn rows are deleted
+        void DropRespawnJournal(uint32 instanceId);
     private:
         typedef std::unordered_map < uint32 /*InstanceId or MapId*/, MapPersistentState* > PersistentStateMap;
 
@@ -369,6 +383,13 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
         PersistentStateMap m_instanceSaveByMapId;
 
         DungeonResetScheduler m_Scheduler;
+
+        // pending respawn journal entries, keyed by spawn guid and instance id
+        typedef std::map<std::pair<uint32, uint32>, time_t> RespawnJournal;
+        RespawnJournal m_creatureRespawnJournal;
+        RespawnJournal m_goRespawnJournal;
+        std::mutex m_respawnJournalLock;
+        time_t m_nextRespawnJournalFlush;
 };
 
 template<typename Do>
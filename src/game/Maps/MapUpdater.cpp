@@ -18,11 +18,37 @@
 
 #include "MapUpdater.h"
 #include "MapWorkers.h"
+#include "Util/TickArena.h"
+
+#if PLATFORM == PLATFORM_WINDOWS
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// pin the calling thread to one cpu; silently a no-op on platforms without support
+static void PinThreadToCpu(uint32 cpu)
+{
+#if PLATFORM == PLATFORM_WINDOWS
+    SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << (cpu % 64));
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+// deque index of the current thread, so schedule_task knows where to push;
+// external threads (the world thread) fall back to deque 0
+static thread_local size_t s_workerIndex = 0;
 
 MapUpdater::MapUpdater(size_t num_threads) : _cancelationToken(false), pending_requests(0)
 {
-    for (size_t i = 0; i < num_threads; ++i)
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+    activate(num_threads);
 }
 
 void MapUpdater::activate(size_t num_threads)
@@ -30,18 +56,32 @@ void MapUpdater::activate(size_t num_threads)
     if (activated())
         return;
 
+    _taskQueues.resize(num_threads ? num_threads : 1);
     for (size_t i = 0; i < num_threads; ++i)
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i));
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> lock(_workLock);
+        _cancelationToken = true;
+        _workCondition.notify_all();
+    }
 
     for (auto& thread : _workerThreads)
         thread.join();
+
+    for (auto& entry : _updateQueue)
+        delete entry.first;
+    _updateQueue.clear();
+
+    for (auto& queue : _taskQueues)
+    {
+        for (Worker* task : queue)
+            delete task;
+        queue.clear();
+    }
 }
 
 void MapUpdater::wait()
@@ -71,30 +111,141 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::schedule_update(Worker* worker)
+void MapUpdater::schedule_update(Worker* worker, uint32 affinityHint)
 {
-    std::lock_guard<std::mutex> lock(_lock);
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        ++pending_requests;
+    }
 
-    ++pending_requests;
-    _queue.Push(std::move(worker));
+    std::lock_guard<std::mutex> lock(_workLock);
+    _updateQueue.emplace_back(worker, _numGroups ? affinityHint % _numGroups : 0);
+    _workCondition.notify_one();
 }
 
-void MapUpdater::WorkerThread()
+uint32 MapUpdater::worker_group(size_t index) const
 {
+    if (!_numGroups || _taskQueues.empty())
+        return 0;
+
+    return uint32(index * _numGroups / _taskQueues.size()) % _numGroups;
+}
+
+void MapUpdater::schedule_task(Worker* task)
+{
+    std::lock_guard<std::mutex> lock(_workLock);
+    _taskQueues[s_workerIndex].push_back(task);
+    _workCondition.notify_one();
+}
+
+void MapUpdater::schedule_task(Worker* task, uint32 slot)
+{
+    std::lock_guard<std::mutex> lock(_workLock);
+    _taskQueues[slot % _taskQueues.size()].push_back(task);
+    _workCondition.notify_one();
+}
+
+Worker* MapUpdater::take_task(size_t index)
+{
+    std::deque<Worker*>& own = _taskQueues[index];
+    if (!own.empty())
+    {
+        Worker* task = own.back();
+        own.pop_back();
+        return task;
+    }
+
+    for (size_t i = 0; i < _taskQueues.size(); ++i)
+    {
+        std::deque<Worker*>& victim = _taskQueues[(index + i) % _taskQueues.size()];
+        if (!victim.empty())
+        {
+            Worker* task = victim.front();
+            victim.pop_front();
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+Worker* MapUpdater::take_work(size_t index)
+{
+    if (Worker* task = take_task(index))
+        return task;
+
+    if (!_updateQueue.empty())
+    {
+        // prefer an update belonging to this worker's affinity group so a map is
+        // usually ticked on the same node; fall back to any update rather than idle
+        if (_numGroups)
+        {
+            uint32 const group = worker_group(index);
+            for (auto itr = _updateQueue.begin(); itr != _updateQueue.end(); ++itr)
+            {
+                if (itr->second == group)
+                {
+                    Worker* worker = itr->first;
+                    _updateQueue.erase(itr);
+                    return worker;
+                }
+            }
+        }
+
+        Worker* worker = _updateQueue.front().first;
+        _updateQueue.pop_front();
+        return worker;
+    }
+
+    return nullptr;
+}
+
+void MapUpdater::help_until(std::atomic<uint32>& remaining)
+{
+    while (remaining.load(std::memory_order_acquire) > 0)
+    {
+        Worker* task;
+        {
+            std::lock_guard<std::mutex> lock(_workLock);
+            task = take_task(s_workerIndex);
+        }
+
+        if (task)
+        {
+            task->execute();
+            delete task;
+        }
+        else // the last tasks are being finished by other workers
+            std::this_thread::yield();
+    }
+}
+
+void MapUpdater::WorkerThread(size_t index)
+{
+    s_workerIndex = index;
+
+    // pinned workers keep their map's grids and pools node-local through first touch
+    if (!_affinityCpus.empty())
+        PinThreadToCpu(_affinityCpus[index % _affinityCpus.size()]);
+
     while (true)
     {
         Worker* request = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_workLock);
 
-        _queue.WaitAndPop(request);
+            while (!_cancelationToken && !(request = take_work(index)))
+                _workCondition.wait(lock);
 
-        if (_cancelationToken)
-        {
-            delete request;
-            return;
+            if (_cancelationToken)
+                return;
         }
 
         request->execute();
 
         delete request;
+
+        // all arena-backed containers of this update slice are gone now
+        MaNGOS::TickArena::Instance().Reset();
     }
-}
\ No newline at end of file
+}
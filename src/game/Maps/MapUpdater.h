@@ -20,11 +20,11 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Platform/Define.h"
-#include "Util/ProducerConsumerQueue.h"
 
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <deque>
 #include <vector>
 #include <condition_variable>
 
@@ -33,20 +33,43 @@ class Worker;
 class MapUpdater
 {
     public:
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
+        MapUpdater() : _cancelationToken(false), pending_requests(0), _numGroups(0) {}
         MapUpdater(size_t num_threads);
         MapUpdater(const MapUpdater&) = delete;
-        
+
         void activate(size_t num_threads);
         void deactivate();
         void wait();
         void join();
         bool activated();
+        size_t GetNumThreads() const { return _workerThreads.size(); }
         void update_finished();
-        void schedule_update(Worker* worker);
+        // affinityHint groups map updates onto a stable subset of the workers
+        // (NUMA soft affinity); with 0 groups configured the hint is ignored
+        void schedule_update(Worker* worker, uint32 affinityHint = 0);
+
+        // both must be set before activate(): pin worker i to cpus[i % cpus.size()],
+        // and split the workers into the given number of scheduling groups
+        void SetWorkerAffinity(std::vector<uint32> cpus) { _affinityCpus = std::move(cpus); }
+        void SetAffinityGroups(uint32 groups) { _numGroups = groups; }
+
+        // submit a sub-task of the currently running map update to the calling
+        // worker's own deque - idle workers steal it from the front
+        void schedule_task(Worker* task);
+        // same, but onto a fixed worker's deque chosen by slot, so the same
+        // region of a map lands on the same (cache-warm) worker tick after
+        // tick; stealing still rebalances when that worker is behind
+        void schedule_task(Worker* task, uint32 slot);
+        // execute/steal queued sub-tasks until the counter reaches zero, so the
+        // thread that split its update helps draining instead of blocking
+        void help_until(std::atomic<uint32>& remaining);
 
     private:
-        ProducerConsumerQueue<Worker *> _queue;
+        std::deque<std::pair<Worker*, uint32>> _updateQueue;    // worker and its affinity group
+        std::vector<std::deque<Worker*>> _taskQueues;
+
+        std::vector<uint32> _affinityCpus;
+        uint32 _numGroups;
 
         std::vector<std::thread> _workerThreads;
         std::atomic<bool> _cancelationToken;
@@ -55,7 +78,18 @@ class MapUpdater
         std::condition_variable _condition;
         size_t pending_requests;
 
-        void WorkerThread();
+        std::mutex _workLock;
+        std::condition_variable _workCondition;
+
+        // pop a sub-task: own deque back first (still cache-hot), then steal
+        // from the front of the other workers' deques; caller holds _workLock
+        Worker* take_task(size_t index);
+        // pop any work at all, preferring sub-tasks over whole map updates
+        Worker* take_work(size_t index);
+        // scheduling group of a worker thread: contiguous blocks of workers
+        uint32 worker_group(size_t index) const;
+
+        void WorkerThread(size_t index);
 };
 
-#endif //_MAP_UPDATER_H_INCLUDED
\ No newline at end of file
+#endif //_MAP_UPDATER_H_INCLUDED
@@ -58,17 +58,18 @@ class MapUpdateWorker : public Worker
         uint32 m_diff;
 };
 
+// collects the objects to update from one NGrid's worth of cells; scheduled as
+// a stealable sub-task of a continent update, writes only into its own set
 class GridCrawler : public Worker
 {
     public:
-        GridCrawler(Map& map, std::vector<Cell> &cells, uint32 diff, MapUpdater& updater) :
-            Worker(updater), m_map(map), m_cells(cells), m_diff(diff)
+        GridCrawler(Map& map, std::vector<Cell> cells, WorldObjectUnSet& objToUpdate, uint32 diff, std::atomic<uint32>& remaining, MapUpdater& updater) :
+            Worker(updater), m_map(map), m_cells(std::move(cells)), m_objToUpdate(objToUpdate), m_diff(diff), m_remaining(remaining)
         {}
 
         void execute() override
         {
-            WorldObjectUnSet objToUpdate;
-            MaNGOS::ObjectUpdater obj_updater(objToUpdate, m_diff);
+            MaNGOS::ObjectUpdater obj_updater(m_objToUpdate, m_diff);
             TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(obj_updater);    // For creature
             TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(obj_updater);   // For pets
 
@@ -78,34 +79,39 @@ class GridCrawler : public Worker
                 m_map.Visit(cell, world_object_update);
             }
 
-            GetWorker().update_finished();
+            m_remaining.fetch_sub(1, std::memory_order_release);
         }
 
     private:
         Map& m_map;
-        std::vector<Cell> &m_cells;
+        std::vector<Cell> m_cells;
+        WorldObjectUnSet& m_objToUpdate;
         uint32 m_diff;
+        std::atomic<uint32>& m_remaining;
 };
 
 
+// updates one non-interacting object cluster; scheduled as a stealable
+// sub-task of the opt-in parallel object update phase
 class ObjectUpdateWorker : public Worker
 {
     public:
-        ObjectUpdateWorker(std::unordered_set<WorldObject*>& objects, uint32 diff, MapUpdater& updater) :
-            Worker(updater), m_objects(objects), m_diff(diff)
+        ObjectUpdateWorker(std::vector<WorldObject*> objects, uint32 diff, std::atomic<uint32>& remaining, MapUpdater& updater) :
+            Worker(updater), m_objects(std::move(objects)), m_diff(diff), m_remaining(remaining)
         {}
 
         void execute() override
         {
-            for (WorldObject* const &object : m_objects)
+            for (WorldObject* object : m_objects)
                 object->Update(m_diff);
 
-            GetWorker().update_finished();
+            m_remaining.fetch_sub(1, std::memory_order_release);
         }
 
     private:
-        std::unordered_set<WorldObject*>& m_objects;
+        std::vector<WorldObject*> m_objects;
         uint32 m_diff;
+        std::atomic<uint32>& m_remaining;
 };
 
 #endif //_MAP_WORKERS_H_INCLUDED
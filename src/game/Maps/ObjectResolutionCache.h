@@ -0,0 +1,51 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OBJECTRESOLUTIONCACHE_H
+#define MANGOS_OBJECTRESOLUTIONCACHE_H
+
+#include "Entities/ObjectGuid.h"
+
+class Map;
+class Unit;
+
+// Two-entry guid-to-pointer cache for callers that resolve the same guids
+// against Map::GetUnit every update tick (periodic aura caster lookups and
+// the like). Each entry remembers the map removal counter it was resolved
+// under and is only trusted while no object has left the map since, so a
+// cached pointer can never outlive the object it refers to. Misses fall
+// through to the regular object store lookup; null results are not cached,
+// as the object may enter the map without touching the removal counter.
+class ObjectResolutionCache
+{
+    public:
+        Unit* ResolveUnit(Map* map, ObjectGuid guid);
+
+    private:
+        struct CacheEntry
+        {
+            ObjectGuid guid;
+            Unit* unit = nullptr;
+            uint32 epoch = 0;
+        };
+
+        CacheEntry m_entries[2];
+        uint8 m_next = 0;                                   // replacement slot for the next miss
+};
+
+#endif
@@ -107,13 +107,27 @@ void SpawnManager::Initialize()
     }
 }
 
+void SpawnManager::ScheduleWakeup(SpawnInfo const& spawn)
+{
+    if (!m_timersInitialized) // everything present is scheduled when the wheel is anchored
+        return;
+
+    uint64 key = 0;
+    if (spawn.GetRespawnTime() > m_timerBase)
+        key = uint64(std::chrono::duration_cast<std::chrono::milliseconds>(spawn.GetRespawnTime() - m_timerBase).count());
+    m_spawnTimers.Insert(std::make_pair(spawn.GetDbGuid(), spawn.GetHighGuid()), key);
+}
+
 void SpawnManager::AddCreature(uint32 dbguid)
 {
     time_t respawnTime = m_map.GetPersistentState()->GetCreatureRespawnTime(dbguid);
     if (m_updated)
         m_deferredSpawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_UNIT);
     else
+    {
         m_spawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_UNIT);
+        ScheduleWakeup(m_spawns.back());
+    }
 }
 
 void SpawnManager::AddGameObject(uint32 dbguid)
@@ -122,7 +136,10 @@ void SpawnManager::AddGameObject(uint32 dbguid)
     if (m_updated)
         m_deferredSpawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_GAMEOBJECT);
     else
+    {
         m_spawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_GAMEOBJECT);
+        ScheduleWakeup(m_spawns.back());
+    }
 }
 
 void SpawnManager::RespawnCreature(uint32 dbguid, uint32 respawnDelay)
@@ -137,7 +154,10 @@ void SpawnManager::RespawnCreature(uint32 dbguid, uint32 respawnDelay)
             found = true;
             m_map.GetPersistentState()->SaveCreatureRespawnTime(dbguid, time(nullptr) + respawnDelay);
             if (respawnDelay > 0)
+            {
                 spawnInfo.SetRespawnTime(m_map.GetCurrentClockTime() + std::chrono::seconds(respawnDelay));
+                ScheduleWakeup(spawnInfo); // the previously queued wake-up may be later than this
+            }
             break;
         }
         ++itr;
@@ -148,7 +168,11 @@ void SpawnManager::RespawnCreature(uint32 dbguid, uint32 respawnDelay)
         AddCreature(dbguid);
     }
     else if (respawnDelay == 0)
+    {
         (*itr).ConstructForMap(m_map);
+        if (m_timersInitialized) // let the next Update erase the now used entry
+            m_spawnTimers.Insert(std::make_pair(dbguid, HIGHGUID_UNIT), m_spawnTimers.GetTime() + 1);
+    }
 }
 
 void SpawnManager::RespawnGameObject(uint32 dbguid, uint32 respawnDelay)
@@ -163,7 +187,10 @@ void SpawnManager::RespawnGameObject(uint32 dbguid, uint32 respawnDelay)
             found = true;
             m_map.GetPersistentState()->SaveGORespawnTime(dbguid, time(nullptr) + respawnDelay);
             if (respawnDelay > 0)
+            {
                 spawnInfo.SetRespawnTime(m_map.GetCurrentClockTime() + std::chrono::seconds(respawnDelay));
+                ScheduleWakeup(spawnInfo); // the previously queued wake-up may be later than this
+            }
             break;
         }
         ++itr;
@@ -174,7 +201,11 @@ void SpawnManager::RespawnGameObject(uint32 dbguid, uint32 respawnDelay)
         AddGameObject(dbguid);
     }
     else if (respawnDelay == 0)
+    {
         (*itr).ConstructForMap(m_map);
+        if (m_timersInitialized) // let the next Update erase the now used entry
+            m_spawnTimers.Insert(std::make_pair(dbguid, HIGHGUID_GAMEOBJECT), m_spawnTimers.GetTime() + 1);
+    }
 }
 
 void SpawnManager::RemoveSpawns(std::vector<uint32> const& creatureDbGuids, std::vector<uint32> const& goDbGuids)
@@ -185,11 +216,19 @@ void SpawnManager::RemoveSpawns(std::vector<uint32> const& creatureDbGuids, std:
         {
             case HIGHGUID_GAMEOBJECT:
                 if (std::find(goDbGuids.begin(), goDbGuids.end(), spawnInfo.GetDbGuid()) != goDbGuids.end())
+                {
                     spawnInfo.SetUsed(); // will be erased on next manager update
+                    if (m_timersInitialized)
+                        m_spawnTimers.Insert(std::make_pair(spawnInfo.GetDbGuid(), spawnInfo.GetHighGuid()), m_spawnTimers.GetTime() + 1);
+                }
                 break;
             case HIGHGUID_UNIT:
                 if (std::find(creatureDbGuids.begin(), creatureDbGuids.end(), spawnInfo.GetDbGuid()) != creatureDbGuids.end())
+                {
                     spawnInfo.SetUsed(); // will be erased on next manager update
+                    if (m_timersInitialized)
+                        m_spawnTimers.Insert(std::make_pair(spawnInfo.GetDbGuid(), spawnInfo.GetHighGuid()), m_spawnTimers.GetTime() + 1);
+                }
                 break;
             default: break;
         }
@@ -203,6 +242,8 @@ void SpawnManager::RemoveSpawn(uint32 dbguid, HighGuid high)
         if (spawnInfo.GetHighGuid() == high && spawnInfo.GetDbGuid() == dbguid)
         {
             spawnInfo.SetUsed(); // will be erased on next manager update
+            if (m_timersInitialized)
+                m_spawnTimers.Insert(std::make_pair(dbguid, high), m_spawnTimers.GetTime() + 1);
             break;
         }
     }
@@ -258,22 +299,49 @@ void SpawnManager::RespawnAll()
 void SpawnManager::Update()
 {
     m_updated = true;
+    auto now = m_map.GetCurrentClockTime();
+    if (!m_timersInitialized) // anchor the wheel on the first map tick, then enqueue everything loaded so far
+    {
+        m_timerBase = now;
+        m_timersInitialized = true;
+        for (auto& spawnInfo : m_spawns)
+            ScheduleWakeup(spawnInfo);
+    }
     if (!m_deferredSpawns.empty()) // cannot insert during update
     {
         m_spawns.reserve(m_spawns.size() + m_deferredSpawns.size());
-        std::move(std::begin(m_deferredSpawns), std::end(m_deferredSpawns), std::back_inserter(m_spawns));
+        for (auto& spawnInfo : m_deferredSpawns)
+        {
+            m_spawns.push_back(std::move(spawnInfo));
+            ScheduleWakeup(m_spawns.back());
+        }
         m_deferredSpawns.clear();
     }
-    auto now = m_map.GetCurrentClockTime();
-    for (auto itr = m_spawns.begin(); itr != m_spawns.end();)
+    // only spawns whose wake-up is due are looked at - idle spawns cost nothing per tick
+    uint64 const nowKey = uint64(std::chrono::duration_cast<std::chrono::milliseconds>(now - m_timerBase).count());
+    m_spawnTimers.Advance(nowKey, [&](std::pair<uint32, HighGuid> const& key)
     {
-        auto& spawnInfo = *itr;
-        if (spawnInfo.IsUsed() ||
-            (spawnInfo.GetRespawnTime() <= now && spawnInfo.ConstructForMap(m_map)))
-            itr = m_spawns.erase(itr);
-        else
-            ++itr;
-    }
+        auto itr = std::find_if(m_spawns.begin(), m_spawns.end(), [&](SpawnInfo const& info)
+        {
+            return info.GetDbGuid() == key.first && info.GetHighGuid() == key.second;
+        });
+        if (itr == m_spawns.end())
+            return; // stale wake-up - the spawn was removed or already constructed
+        if (itr->IsUsed())
+        {
+            m_spawns.erase(itr);
+            return;
+        }
+        if (itr->GetRespawnTime() > now)
+        {
+            ScheduleWakeup(*itr); // the respawn was pushed back since this wake-up was queued
+            return;
+        }
+        if (itr->ConstructForMap(m_map))
+            m_spawns.erase(itr);
+        else // linking dependency not up yet, retry on the next map tick
+            m_spawnTimers.Insert(key, nowKey + 1);
+    });
     m_updated = false;
 
     // spawn groups are safe from this
@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Entities/ObjectGuid.h"
 #include "Maps/SpawnGroup.h"
+#include "Utilities/TimerWheel.h"
 
 #include <string>
 
@@ -51,7 +52,7 @@ bool operator<(SpawnInfo const& lhs, SpawnInfo const& rhs);
 class SpawnManager
 {
     public:
-        SpawnManager(Map& map) : m_map(map), m_updated(false) {}
+        SpawnManager(Map& map) : m_map(map), m_updated(false), m_timersInitialized(false) {}
         ~SpawnManager();
         void Initialize();
 
@@ -79,10 +80,21 @@ class SpawnManager
 
         void RespawnSpawnGroupsInVicinity(Position pos, float range);
     private:
+        // queues a wake-up on the timer wheel for the given spawn; no-op before the
+        // wheel is anchored on the first Update, which schedules everything loaded so far
+        void ScheduleWakeup(SpawnInfo const& spawn);
+
         Map& m_map;
 
         std::vector<SpawnInfo> m_deferredSpawns;
         std::vector<SpawnInfo> m_spawns; // must only be erased from in Update
+
+        // wake-up keys into m_spawns - entries may be stale (spawn removed or
+        // rescheduled since they were queued) and are validated on expiry
+        TimerWheel<std::pair<uint32, HighGuid>> m_spawnTimers;
+        TimePoint m_timerBase;
+        bool m_timersInitialized;
+
         std::map<uint32, SpawnGroup*> m_spawnGroups;
         bool m_updated;
 
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/TerrainPrefetcher.h"
+#include "Maps/GridMap.h"
+
+#define CLASS_LOCK MaNGOS::ClassLevelLockable<TerrainPrefetcher, std::mutex>
+INSTANTIATE_SINGLETON_2(TerrainPrefetcher, CLASS_LOCK);
+INSTANTIATE_CLASS_MUTEX(TerrainPrefetcher, std::mutex);
+
+namespace
+{
+    uint32 PackGridKey(uint32 mapId, uint32 gx, uint32 gy)
+    {
+        return (mapId << 12) | (gx << 6) | gy;              // grid coords fit 6 bits each
+    }
+}
+
+void TerrainPrefetcher::Activate()
+{
+    if (activated())
+        return;
+
+    m_cancelationToken = false;
+    m_worker = std::thread(&TerrainPrefetcher::WorkerThread, this);
+}
+
+void TerrainPrefetcher::Deactivate()
+{
+    if (!activated())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_cancelationToken = true;
+        m_requests.clear();
+        m_inFlight.clear();
+    }
+    m_condition.notify_all();
+
+    m_worker.join();
+    m_worker = std::thread();
+}
+
+void TerrainPrefetcher::Request(uint32 mapId, uint32 gx, uint32 gy)
+{
+    if (gx >= MAX_NUMBER_OF_GRIDS || gy >= MAX_NUMBER_OF_GRIDS)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (!m_inFlight.insert(PackGridKey(mapId, gx, gy)).second)
+            return;                                         // already queued or loading
+
+        m_requests.push_back({ mapId, gx, gy });
+    }
+    m_condition.notify_one();
+}
+
+void TerrainPrefetcher::WorkerThread()
+{
+    for (;;)
+    {
+        GridRequest request;
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_condition.wait(guard, [this]() { return m_cancelationToken || !m_requests.empty(); });
+            if (m_cancelationToken)
+                return;
+
+            request = m_requests.front();
+            m_requests.pop_front();
+        }
+
+        // the reference taken here keeps the TerrainInfo alive even if the
+        // last map using it unloads while we are loading
+        TerrainInfo* terrain = sTerrainMgr.AcquireTerrain(request.mapId);
+        terrain->Prefetch(request.gx, request.gy);
+        sTerrainMgr.ReleaseTerrain(terrain);
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_inFlight.erase(PackGridKey(request.mapId, request.gx, request.gy));
+        }
+    }
+}
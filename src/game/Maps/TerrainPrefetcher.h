@@ -0,0 +1,80 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_TERRAIN_PREFETCHER_H
+#define MANGOS_TERRAIN_PREFETCHER_H
+
+#include "Platform/Define.h"
+#include "Policies/Singleton.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+/**
+ * Predictive background loading of terrain, vmap and mmap grid data.
+ *
+ * When a player crosses into a grid whose data files are not loaded, the
+ * map, vmap tile and navmesh tile are read and parsed inside the movement
+ * handling - a visible tick spike. The movement handler projects moving
+ * players a few seconds ahead and queues the grids they are about to
+ * reach here, so the later synchronous load finds everything resident.
+ *
+ * Only the data files are prefetched; grid object population
+ * (ObjectGridLoader) still runs in the foreground when the grid activates.
+ *
+ * Disabled (fully synchronous loading as before) unless Terrain.Prefetch
+ * is set.
+ */
+class TerrainPrefetcher : public MaNGOS::Singleton<TerrainPrefetcher, MaNGOS::ClassLevelLockable<TerrainPrefetcher, std::mutex> >
+{
+    public:
+        TerrainPrefetcher() : m_cancelationToken(false) {}
+
+        void Activate();
+        void Deactivate();
+        bool activated() const { return m_worker.joinable(); }
+
+        // queue a background load of the grid's terrain/vmap/mmap data;
+        // duplicate requests for a grid already in flight are dropped
+        void Request(uint32 mapId, uint32 gx, uint32 gy);
+
+    private:
+        struct GridRequest
+        {
+            uint32 mapId;
+            uint32 gx;
+            uint32 gy;
+        };
+
+        void WorkerThread();
+
+        std::thread m_worker;
+        std::deque<GridRequest> m_requests;
+        std::unordered_set<uint32> m_inFlight;              // packed mapId/gx/gy keys
+
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        bool m_cancelationToken;
+};
+
+#define sTerrainPrefetcher MaNGOS::Singleton<TerrainPrefetcher>::Instance()
+
+#endif
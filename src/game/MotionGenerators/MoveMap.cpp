@@ -21,8 +21,23 @@
 #include "MotionGenerators/MoveMap.h"
 #include "MoveMapSharedDefines.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace MMAP
 {
+    void UnmapTileFile(void* base, size_t size)
+    {
+#ifndef _WIN32
+        munmap(base, size);
+#else
+        (void)base; (void)size;
+#endif
+    }
+
     constexpr char MAP_FILE_NAME_FORMAT[] = "mmaps/%03i.mmap";
     constexpr char TILE_FILE_NAME_FORMAT[] = "mmaps/%03i%02i%02i.mmtile";
     constexpr char GO_FILE_NAME_FORMAT[] = "mmaps/go%04i.mmtile";
@@ -150,6 +165,8 @@ namespace MMAP
 
     bool MMapManager::IsMMapIsLoaded(uint32 mapId, uint32 x, uint32 y) const
     {
+        std::lock_guard<std::mutex> guard(m_tilesMutex);
+
         // get this mmap data
         auto itr = loadedMMaps.find(mapId);
 
@@ -197,6 +214,8 @@ namespace MMAP
 
     bool MMapManager::loadMap(std::string const& basePath, uint32 mapId, int32 x, int32 y)
     {
+        std::lock_guard<std::mutex> guard(m_tilesMutex);
+
         // get this mmap data
         auto itr = loadedMMaps.find(mapId);
         MANGOS_ASSERT(itr != loadedMMaps.end()); // must not occur here as it would not be thread safe - only in loadMapData through loadMapInstance
@@ -247,6 +266,50 @@ namespace MMAP
             return false;
         }
 
+#ifndef _WIN32
+        if (m_memoryMapped)
+        {
+            fclose(file);
+
+            // map the whole file copy-on-write: the untouched pages are
+            // demand-paged and shared between every process on the host,
+            // Detour's in-place link fixups only privatize the pages they write
+            int fd = open(filePath, O_RDONLY);
+            if (fd == -1)
+            {
+                sLog.outError("MMAP:loadMap: Could not reopen mmtile file '%s' for mapping", filePath);
+                return false;
+            }
+
+            size_t mapSize = sizeof(MmapTileHeader) + fileHeader.size;
+            void* base = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd); // the mapping keeps its own reference
+            if (base == MAP_FAILED)
+            {
+                sLog.outError("MMAP:loadMap: Could not map %03u%02i%02i.mmtile", mapId, x, y);
+                return false;
+            }
+
+            unsigned char* mappedData = (unsigned char*)base + sizeof(MmapTileHeader);
+            dtTileRef mappedTileRef = 0;
+
+            // the mapping owns the data - no DT_TILE_FREE_DATA
+            if (dtStatusFailed(mmapData->navMesh->addTile(mappedData, fileHeader.size, 0, 0, &mappedTileRef)))
+            {
+                sLog.outError("MMAP:loadMap: Could not load %03u%02i%02i.mmtile into navmesh", mapId, x, y);
+                UnmapTileFile(base, mapSize);
+                return false;
+            }
+
+            mmapData->mmapTileFiles[packedGridPos] = std::make_pair(base, mapSize);
+            mmapData->mmapLoadedTiles.insert(std::pair<uint32, dtTileRef>(packedGridPos, mappedTileRef));
+            ++loadedTiles;
+            mmapData->loadedTileBytes += fileHeader.size;
+            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:loadMap: Mapped mmtile %03i[%02i,%02i] into %03i[%02i,%02i]", mapId, x, y, mapId, ((dtMeshHeader*)mappedData)->x, ((dtMeshHeader*)mappedData)->y);
+            return true;
+        }
+#endif
+
         unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
         MANGOS_ASSERT(data);
 
@@ -274,6 +337,7 @@ namespace MMAP
 
         mmapData->mmapLoadedTiles.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
         ++loadedTiles;
+        mmapData->loadedTileBytes += fileHeader.size;
         DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:loadMap: Loaded mmtile %03i[%02i,%02i] into %03i[%02i,%02i]", mapId, x, y, mapId, header->x, header->y);
         return true;
     }
@@ -381,6 +445,8 @@ namespace MMAP
 
     bool MMapManager::unloadMap(uint32 mapId, int32 x, int32 y)
     {
+        std::lock_guard<std::mutex> guard(m_tilesMutex);
+
         // check if we have this map loaded
         if (loadedMMaps.find(mapId) == loadedMMaps.end())
         {
@@ -402,6 +468,10 @@ namespace MMAP
 
         dtTileRef tileRef = mmapData->mmapLoadedTiles[packedGridPos];
 
+        uint32 tileBytes = 0;
+        if (dtMeshTile const* tile = mmapData->navMesh->getTileByRef(tileRef))
+            tileBytes = tile->dataSize;
+
         // unload, and mark as non loaded
         dtStatus dtResult = mmapData->navMesh->removeTile(tileRef, nullptr, nullptr);
         if (dtStatusFailed(dtResult))
@@ -415,6 +485,13 @@ namespace MMAP
         else
         {
             mmapData->mmapLoadedTiles.erase(packedGridPos);
+            mmapData->loadedTileBytes -= tileBytes;
+            auto fileItr = mmapData->mmapTileFiles.find(packedGridPos);
+            if (fileItr != mmapData->mmapTileFiles.end())
+            {
+                UnmapTileFile(fileItr->second.first, fileItr->second.second);
+                mmapData->mmapTileFiles.erase(fileItr);
+            }
             --loadedTiles;
             DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMap: Unloaded mmtile %03i[%02i,%02i] from %03i", mapId, x, y, mapId);
             return true;
@@ -438,12 +515,18 @@ namespace MMAP
         {
             uint32 x = (i->first >> 16);
             uint32 y = (i->first & 0x0000FFFF);
+
+            uint32 tileBytes = 0;
+            if (dtMeshTile const* tile = mmapData->navMesh->getTileByRef(i->second))
+                tileBytes = tile->dataSize;
+
             dtStatus dtResult = mmapData->navMesh->removeTile(i->second, nullptr, nullptr);
             if (dtStatusFailed(dtResult))
                 sLog.outError("MMAP:unloadMap: Could not unload %03u%02i%02i.mmtile from navmesh", mapId, x, y);
             else
             {
                 --loadedTiles;
+                mmapData->loadedTileBytes -= tileBytes;
                 DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMap: Unloaded mmtile %03i[%02i,%02i] from %03i", mapId, x, y, mapId);
             }
         }
@@ -509,6 +592,39 @@ namespace MMAP
         return queryItr->second;
     }
 
+    dtNavMeshQuery const* MMapManager::GetThreadLocalNavMeshQuery(uint32 mapId)
+    {
+        auto itr = loadedMMaps.find(mapId);
+        if (itr == loadedMMaps.end())
+            return nullptr;
+
+        auto threadId = std::this_thread::get_id();
+        const auto& mmapData = itr->second;
+        if (mmapData->navMeshThreadQueries.find(threadId) == mmapData->navMeshThreadQueries.end())
+        {
+            std::lock_guard<std::mutex> guard(m_threadQueriesMutex);
+            if (mmapData->navMeshThreadQueries.find(threadId) == mmapData->navMeshThreadQueries.end())
+            {
+                // allocate mesh query
+                std::stringstream ss;
+                ss << threadId;
+                dtNavMeshQuery* query = dtAllocNavMeshQuery();
+                MANGOS_ASSERT(query);
+                if (dtStatusFailed(query->init(mmapData->navMesh, 1024)))
+                {
+                    dtFreeNavMeshQuery(query);
+                    sLog.outError("MMAP:GetThreadLocalNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u tid %s", mapId, ss.str().data());
+                    return nullptr;
+                }
+
+                DETAIL_LOG("MMAP:GetThreadLocalNavMeshQuery: created dtNavMeshQuery for mapId %03u tid %s", mapId, ss.str().data());
+                mmapData->navMeshThreadQueries.insert(std::pair<std::thread::id, dtNavMeshQuery*>(threadId, query));
+            }
+        }
+
+        return mmapData->navMeshThreadQueries[threadId];
+    }
+
     dtNavMeshQuery const* MMapManager::GetModelNavMeshQuery(uint32 displayId)
     {
         if (m_loadedModels.find(displayId) == m_loadedModels.end())
@@ -43,6 +43,9 @@ inline void dtCustomFree(void* ptr)
 //  move map related classes
 namespace MMAP
 {
+    // releases a tile file mapping made by the memory-mapped loader (no-op sizes are not passed)
+    void UnmapTileFile(void* base, size_t size);
+
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
     typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
     typedef std::unordered_map<std::thread::id, dtNavMeshQuery*> NavMeshGOQuerySet;
@@ -56,15 +59,25 @@ namespace MMAP
             for (auto& navMeshQuerie : navMeshQueries)
                 dtFreeNavMeshQuery(navMeshQuerie.second);
 
+            for (auto& navMeshQuerie : navMeshThreadQueries)
+                dtFreeNavMeshQuery(navMeshQuerie.second);
+
             if (navMesh)
                 dtFreeNavMesh(navMesh);
+
+            // the mesh never owns memory-mapped tile data - release the file mappings last
+            for (auto& tileFile : mmapTileFiles)
+                UnmapTileFile(tileFile.second.first, tileFile.second.second);
         }
 
         dtNavMesh* navMesh;
 
         // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
         NavMeshQuerySet navMeshQueries;     // instanceId to query
+        NavMeshGOQuerySet navMeshThreadQueries; // path service worker thread to query
         MMapTileSet mmapLoadedTiles;        // maps [map grid coords] to [dtTile]
+        std::unordered_map<uint32, std::pair<void*, size_t>> mmapTileFiles; // [map grid coords] to memory-mapped tile file
+        std::atomic<uint64> loadedTileBytes{0}; // resident bytes of the loaded tiles (instrumentation)
 
         bool fullLoaded;
     };
@@ -109,6 +122,8 @@ namespace MMAP
 
             // the returned [dtNavMeshQuery const*] is NOT threadsafe
             dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
+            // returns a query owned by the calling thread (path service workers)
+            dtNavMeshQuery const* GetThreadLocalNavMeshQuery(uint32 mapId);
             dtNavMeshQuery const* GetModelNavMeshQuery(uint32 displayId);
             dtNavMesh const* GetNavMesh(uint32 mapId);
             dtNavMesh const* GetGONavMesh(uint32 displayId);
@@ -116,8 +131,25 @@ namespace MMAP
             uint32 getLoadedTilesCount() const { return loadedTiles; }
             uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
 
+            // per-map navmesh tile residency for the memory instrumentation surface
+            void getMapMemoryStats(uint32 mapId, uint32& tiles, uint64& bytes) const
+            {
+                auto itr = loadedMMaps.find(mapId);
+                if (itr == loadedMMaps.end())
+                {
+                    tiles = 0;
+                    bytes = 0;
+                    return;
+                }
+
+                tiles = itr->second->mmapLoadedTiles.size();
+                bytes = itr->second->loadedTileBytes.load(std::memory_order_relaxed);
+            }
+
             void SetEnabled(bool state) { m_enabled = state; }
             bool IsEnabled() const { return m_enabled; }
+
+            void SetMemoryMapped(bool state) { m_memoryMapped = state; }
         private:
             bool loadMapData(std::string const& basePath, uint32 mapId);
             uint32 packTileID(int32 x, int32 y) const;
@@ -127,8 +159,13 @@ namespace MMAP
 
             std::unordered_map<uint32, std::unique_ptr<MMapGOData>> m_loadedModels;
             std::mutex m_modelsMutex;
+            std::mutex m_threadQueriesMutex;
+            // tile load/unload bookkeeping - shared TerrainInfo objects load
+            // tiles from several map update threads and the terrain prefetcher
+            mutable std::mutex m_tilesMutex;
 
             bool m_enabled;
+            bool m_memoryMapped = false;
     };
 
     // static class
@@ -28,6 +28,7 @@
 #include "BattleGround/BattleGround.h"
 #include "WaypointMovementGenerator.h"
 #include "Maps/MapPersistentStateMgr.h"
+#include "Maps/TerrainPrefetcher.h"
 #include "Globals/ObjectMgr.h"
 #include "World/World.h"
 #include "Anticheat/Anticheat.hpp"
@@ -377,6 +378,20 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recv_data)
     if (!ProcessMovementInfo(movementInfo, mover, plMover, recv_data))
         return;
 
+    // queue a background load for the grid the player is heading into, so
+    // crossing the border does not stall the map update on disk reads
+    if (plMover && sTerrainPrefetcher.activated() && movementInfo.HasMovementFlag(MOVEFLAG_FORWARD))
+    {
+        float const lookahead = 4.0f * plMover->GetSpeed(movementInfo.HasMovementFlag(MOVEFLAG_SWIMMING) ? MOVE_SWIM : MOVE_RUN);
+        float const px = plMover->GetPositionX() + lookahead * cos(plMover->GetOrientation());
+        float const py = plMover->GetPositionY() + lookahead * sin(plMover->GetOrientation());
+        if (MaNGOS::IsValidMapCoord(px, py) && !plMover->GetMap()->IsLoaded(px, py))
+        {
+            GridPair const p = MaNGOS::ComputeGridPair(px, py);
+            sTerrainPrefetcher.Request(plMover->GetMapId(), (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord, (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord);
+        }
+    }
+
     // CMSG opcode has no handler in client, should not be sent to others.
     // It is sent by client when you jump and hit something on the way up,
     // thus stopping upward movement and causing you to descend sooner.
@@ -386,9 +401,41 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recv_data)
     WorldPacket data(opcode, recv_data.size());
     data << mover->GetPackGUID();             // write guid
     movementInfo.Write(data);                               // write data
+
+    if (sWorld.getConfig(CONFIG_UINT32_MOVEMENT_COALESCE_WINDOW))
+    {
+        if (opcode == MSG_MOVE_HEARTBEAT)
+        {
+            // only the newest heartbeat state matters to other clients: buffer
+            // it and let UpdateMap flush once the coalescing window elapses
+            if (!m_pendingMoveBroadcast)
+                m_pendingMoveTimer = 0;
+            m_pendingMoveBroadcast = std::make_unique<WorldPacket>(std::move(data));
+            m_pendingMoveGuid = mover->GetObjectGuid();
+            return;
+        }
+
+        // state-changing opcodes must not overtake a buffered heartbeat
+        FlushPendingMoveBroadcast();
+    }
+
     mover->SendMessageToSetExcept(data, _player);
 }
 
+void WorldSession::FlushPendingMoveBroadcast()
+{
+    if (!m_pendingMoveBroadcast)
+        return;
+
+    std::unique_ptr<WorldPacket> data = std::move(m_pendingMoveBroadcast);
+    m_pendingMoveTimer = 0;
+
+    // the mover may have changed or left the world since the heartbeat came in
+    Unit* mover = _player ? _player->GetMover() : nullptr;
+    if (mover && mover->IsInWorld() && mover->GetObjectGuid() == m_pendingMoveGuid)
+        mover->SendMessageToSetExcept(*data, _player);
+}
+
 void WorldSession::HandleForceSpeedChangeAckOpcodes(WorldPacket& recv_data)
 {
     uint16 opcode = recv_data.GetOpcode();
@@ -73,9 +73,24 @@ PathFinder::PathFinder(uint32 mapId, uint32 instanceId) :
 }
 #endif
 
+PathFinder::PathFinder(uint32 mapId, dtNavMeshQuery const* query, uint16 includeFlags, uint16 excludeFlags) :
+    m_type(PATHFIND_BLANK), m_useStraightPath(false), m_forceDestination(false), m_straightLine(false),
+    m_pointPathLimit(MAX_POINT_PATH_LENGTH),
+    m_cachedPoints(m_pointPathLimit * VERTEX_SIZE), m_pathPolyRefs(m_pointPathLimit), m_polyLength(0),
+    m_smoothPathPolyRefs(m_pointPathLimit), m_sourceUnit(nullptr), m_navMesh(nullptr), m_navMeshQuery(nullptr),
+    m_defaultNavMeshQuery(query), m_defaultMapId(mapId), m_ignoreNormalization(true)
+#ifdef ENABLE_PLAYERBOTS
+    , m_defaultInstanceId(0)
+#endif
+{
+    m_filter.setIncludeFlags(includeFlags);
+    m_filter.setExcludeFlags(excludeFlags);
+}
+
 PathFinder::~PathFinder()
 {
-    DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::~PathInfo() for %u \n", m_sourceUnit->GetGUIDLow());
+    if (m_sourceUnit)
+        DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::~PathInfo() for %u \n", m_sourceUnit->GetGUIDLow());
 }
 
 void PathFinder::SetCurrentNavMesh()
@@ -97,16 +112,13 @@ void PathFinder::SetCurrentNavMesh()
             m_navMesh = m_navMeshQuery->getAttachedNavMesh();
 
     }
-#ifdef ENABLE_PLAYERBOTS
     else if (!m_sourceUnit && MMAP::MMapFactory::IsPathfindingEnabled(m_defaultMapId, nullptr))
     {
-        MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
         m_navMeshQuery = m_defaultNavMeshQuery;
 
         if (m_navMeshQuery)
             m_navMesh = m_navMeshQuery->getAttachedNavMesh();
     }
-#endif
 }
 
 bool PathFinder::calculate(float destX, float destY, float destZ, bool forceDest/* = false*/, bool straightLine/* = false*/)
@@ -127,18 +139,13 @@ bool PathFinder::calculate(Vector3 const& start, Vector3 const& dest, bool force
     if (!MaNGOS::IsValidMapCoord(start.x, start.y, start.z))
         return false;
 
-#ifndef ENABLE_PLAYERBOTS
-    if (!m_sourceUnit)
-        return false;
-#endif
-
 #ifdef BUILD_METRICS
     metric::duration<std::chrono::microseconds> meas("pathfinder.calculate", {
-        { "entry", std::to_string(m_sourceUnit->GetEntry()) },
-        { "guid", std::to_string(m_sourceUnit->GetGUIDLow()) },
-        { "unit_type", std::to_string(m_sourceUnit->GetGUIDHigh()) },
-        { "map_id", std::to_string(m_sourceUnit->GetMapId()) },
-        { "instance_id", std::to_string(m_sourceUnit->GetInstanceId()) }
+        { "entry", std::to_string(m_sourceUnit ? m_sourceUnit->GetEntry() : 0) },
+        { "guid", std::to_string(m_sourceUnit ? m_sourceUnit->GetGUIDLow() : 0) },
+        { "unit_type", std::to_string(m_sourceUnit ? uint32(m_sourceUnit->GetGUIDHigh()) : 0) },
+        { "map_id", std::to_string(m_defaultMapId) },
+        { "instance_id", std::to_string(m_sourceUnit ? m_sourceUnit->GetInstanceId() : 0) }
     }, 1000);
 #endif
 
@@ -154,18 +161,12 @@ bool PathFinder::calculate(Vector3 const& start, Vector3 const& dest, bool force
 
     SetCurrentNavMesh();
 
-#ifdef ENABLE_PLAYERBOTS
-    if(m_sourceUnit)
-#endif
+    if (m_sourceUnit)
         DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::calculate() for %u \n", m_sourceUnit->GetGUIDLow());
 
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
-#ifdef ENABLE_PLAYERBOTS
     if (!m_navMesh || !m_navMeshQuery || (m_sourceUnit && m_sourceUnit->hasUnitState(UNIT_STAT_IGNORE_PATHFINDING)) ||
-#else
-    if (!m_navMesh || !m_navMeshQuery || m_sourceUnit->hasUnitState(UNIT_STAT_IGNORE_PATHFINDING) ||
-#endif    
         !HaveTile(start) || !HaveTile(dest))
     {
         BuildShortcut();
@@ -385,17 +386,8 @@ dtPolyRef PathFinder::getPolyByLocation(const float* point, float* distance)
 
 void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
 {
-#ifndef ENABLE_PLAYERBOTS
-    if (!m_sourceUnit)
-        return;
-#endif
-
     // *** getting start/end poly logic ***
-#ifndef ENABLE_PLAYERBOTS
-    if (m_sourceUnit->GetMap()->IsDungeon())
-#else
     if ((m_sourceUnit && m_sourceUnit->GetMap()->IsDungeon()) || (sMapStore.LookupEntry(m_defaultMapId) && sMapStore.LookupEntry(m_defaultMapId)->IsDungeon()))
-#endif
     {
         float distance = sqrt((endPos.x - startPos.x) * (endPos.x - startPos.x) + (endPos.y - startPos.y) * (endPos.y - startPos.y) + (endPos.z - startPos.z) * (endPos.z - startPos.z));
         if (distance > 300.f)
@@ -424,10 +416,8 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
         DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ BuildPolyPath :: (startPoly == 0 || endPoly == 0)\n");
         BuildShortcut();
 
-#ifdef ENABLE_PLAYERBOTS
         if (m_sourceUnit)
         {
-#endif
             // Check for swimming or flying shortcut
             if ((startPoly == INVALID_POLYREF && m_sourceUnit->GetTerrain()->IsSwimmable(startPos.x, startPos.y, startPos.z)) ||
                 (endPoly == INVALID_POLYREF && m_sourceUnit->GetTerrain()->IsSwimmable(endPos.x, endPos.y, endPos.z)))
@@ -440,10 +430,7 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
 
                     m_type = PATHFIND_NOPATH;
             }
-#ifdef ENABLE_PLAYERBOTS
         }
-#endif
-
 
         return;
     }
@@ -455,10 +442,8 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
         DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ BuildPolyPath :: farFromPoly distToStartPoly=%.3f distToEndPoly=%.3f\n", distToStartPoly, distToEndPoly);
 
         bool buildShotrcut = false;
-#ifdef ENABLE_PLAYERBOTS
         if (m_sourceUnit)
         {
-#endif
             Vector3 p = (distToStartPoly > 7.0f) ? startPos : endPos;
             if (m_sourceUnit->GetTerrain()->IsUnderWater(p.x, p.y, p.z))
             {
@@ -472,9 +457,7 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
                 if (m_sourceUnit->CanFly())
                     buildShotrcut = true;
             }
-#ifdef ENABLE_PLAYERBOTS
         }
-#endif
 
 #ifdef ENABLE_PLAYERBOTS
         if (m_sourceUnit && m_sourceUnit->IsPlayer() && IsPointHigherThan(getActualEndPosition(), getStartPosition()))
@@ -1100,6 +1083,52 @@ void PathFinder::updateFilter()
     }
 }
 
+void PathFinder::ComputeFilterFlags(Unit const& owner, uint16& includeFlags, uint16& excludeFlags)
+{
+    includeFlags = 0;
+    excludeFlags = 0;
+
+    if (owner.GetTypeId() == TYPEID_UNIT)
+    {
+        Creature const* creature = static_cast<Creature const*>(&owner);
+        if (creature->CanWalk())
+#ifdef ENABLE_PLAYERBOTS
+            includeFlags |= (NAV_GROUND | NAV_GROUND_STEEP);    // walk
+#else
+            includeFlags |= NAV_GROUND;                         // walk
+#endif
+
+        // creatures don't take environmental damage
+        if (creature->CanSwim())
+            includeFlags |= (NAV_WATER | NAV_MAGMA_SLIME);      // swim
+    }
+    else if (owner.GetTypeId() == TYPEID_PLAYER)
+    {
+        // perfect support not possible, just stay 'safe'
+        includeFlags |= (NAV_GROUND | NAV_WATER);
+    }
+
+    // same cheat as updateFilter - units moved forcefully into terrain they
+    // can't normally move in are allowed to path out of it
+    if (owner.IsInWater() || owner.IsUnderwater())
+    {
+        GridMapLiquidData data;
+        if (owner.GetTerrain()->getLiquidStatus(owner.GetLiquidCursor(), owner.GetPositionX(), owner.GetPositionY(), owner.GetPositionZ(), MAP_ALL_LIQUIDS, &data) != LIQUID_MAP_NO_WATER)
+        {
+            switch (data.type_flags)
+            {
+                case MAP_LIQUID_TYPE_MAGMA:
+                case MAP_LIQUID_TYPE_SLIME:
+                    includeFlags |= NAV_MAGMA_SLIME;
+                    break;
+                default:
+                    includeFlags |= NAV_WATER;
+                    break;
+            }
+        }
+    }
+}
+
 NavTerrainFlag PathFinder::getNavTerrain(float x, float y, float z) const
 {
     GridMapLiquidData data;
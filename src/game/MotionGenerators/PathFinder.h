@@ -95,6 +95,15 @@ class PathFinder
         PointsArray& getPath() { return m_pathPoints; }
         PathType getPathType() const { return m_type; }
 
+        // unit-less constructor for the async path service: runs on a worker
+        // thread against a caller-supplied (thread-owned) query object with a
+        // filter snapshotted from the moving unit at submit time
+        PathFinder(uint32 mapId, dtNavMeshQuery const* query, uint16 includeFlags, uint16 excludeFlags);
+
+        // snapshot of createFilter/updateFilter results for a unit, taken on
+        // the map thread before handing a request to the path service
+        static void ComputeFilterFlags(Unit const& owner, uint16& includeFlags, uint16& excludeFlags);
+
 #ifdef ENABLE_PLAYERBOTS
         PathFinder();
         PathFinder(uint32 mapId, uint32 instanceId = 0);
@@ -0,0 +1,156 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "MotionGenerators/PathFinderService.h"
+#include "MotionGenerators/MoveMap.h"
+#include "Entities/Unit.h"
+
+#define CLASS_LOCK MaNGOS::ClassLevelLockable<PathFinderService, std::mutex>
+INSTANTIATE_SINGLETON_2(PathFinderService, CLASS_LOCK);
+INSTANTIATE_CLASS_MUTEX(PathFinderService, std::mutex);
+
+void PathFinderService::Activate(uint32 numThreads)
+{
+    if (!numThreads || activated())
+        return;
+
+    m_cancelationToken = false;
+    for (uint32 i = 0; i < numThreads; ++i)
+        m_workers.push_back(std::thread(&PathFinderService::WorkerThread, this));
+}
+
+void PathFinderService::Deactivate()
+{
+    if (!activated())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_cancelationToken = true;
+        m_requests.clear();
+    }
+    m_condition.notify_all();
+
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+
+    m_results.clear();
+    m_cancelled.clear();
+}
+
+uint64 PathFinderService::SubmitRequest(Unit const& owner, Vector3 const& start, Vector3 const& end, bool forceDest/* = false*/)
+{
+    if (!activated())
+        return 0;
+
+    // units on transports path against the model navmesh - keep those synchronous
+    if (owner.GetTransport())
+        return 0;
+
+    if (!MMAP::MMapFactory::IsPathfindingEnabled(owner.GetMapId(), &owner))
+        return 0;
+
+    Request request;
+    request.id = ++m_requestCounter;
+    request.mapId = owner.GetMapId();
+    request.start = start;
+    request.end = end;
+    request.forceDest = forceDest;
+    PathFinder::ComputeFilterFlags(owner, request.includeFlags, request.excludeFlags);
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_requests.push_back(request);
+    }
+    m_condition.notify_one();
+    return request.id;
+}
+
+bool PathFinderService::TakeResult(uint64 requestId, Result& result)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    auto itr = m_results.find(requestId);
+    if (itr == m_results.end())
+        return false;
+
+    result = std::move(itr->second);
+    m_results.erase(itr);
+    return true;
+}
+
+void PathFinderService::CancelRequest(uint64 requestId)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    for (auto itr = m_requests.begin(); itr != m_requests.end(); ++itr)
+    {
+        if (itr->id == requestId)
+        {
+            m_requests.erase(itr);
+            return;
+        }
+    }
+
+    // already finished or currently computing - drop the result when it lands
+    if (!m_results.erase(requestId))
+        m_cancelled.insert(requestId);
+}
+
+void PathFinderService::WorkerThread()
+{
+    MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
+
+    while (true)
+    {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            while (!m_cancelationToken && m_requests.empty())
+                m_condition.wait(lock);
+
+            if (m_cancelationToken)
+                return;
+
+            request = m_requests.front();
+            m_requests.pop_front();
+        }
+
+        Result result;
+        if (dtNavMeshQuery const* query = mmap->GetThreadLocalNavMeshQuery(request.mapId))
+        {
+            PathFinder pathFinder(request.mapId, query, request.includeFlags, request.excludeFlags);
+            pathFinder.calculate(request.start, request.end, request.forceDest);
+            result.path = pathFinder.getPath();
+            result.type = pathFinder.getPathType();
+        }
+        else // no navmesh for this map - same shortcut the synchronous path builds
+        {
+            result.path.push_back(request.start);
+            result.path.push_back(request.end);
+            result.type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (m_cancelled.erase(request.id))
+                continue;
+
+            m_results[request.id] = std::move(result);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_PATHFINDER_SERVICE_H
+#define MANGOS_PATHFINDER_SERVICE_H
+
+#include "MotionGenerators/PathFinder.h"
+#include "Policies/Singleton.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Unit;
+
+/**
+ * Off-thread Detour path computation.
+ *
+ * PathFinder::calculate runs the full Detour query inside the map update -
+ * a kiting boss or a pack of chasing mobs visibly stretches the tick.
+ * Movement generators can instead submit a request here, keep moving on
+ * their last spline, and consume the finished path on a later tick.
+ *
+ * Requests carry everything the computation needs by value (start, end,
+ * filter flags snapshotted from the unit at submit time), so worker threads
+ * never touch game objects. Each worker uses its own dtNavMeshQuery from
+ * MMapManager::GetThreadLocalNavMeshQuery - those are not thread safe and
+ * may not be shared with the map threads.
+ *
+ * Disabled (synchronous pathfinding as before) unless PathFinder.AsyncThreads
+ * is set.
+ */
+class PathFinderService : public MaNGOS::Singleton<PathFinderService, MaNGOS::ClassLevelLockable<PathFinderService, std::mutex> >
+{
+    public:
+        struct Result
+        {
+            PointsArray path;
+            PathType type = PATHFIND_BLANK;
+        };
+
+        PathFinderService() : m_requestCounter(0), m_cancelationToken(false) {}
+
+        void Activate(uint32 numThreads);
+        void Deactivate();
+        bool activated() const { return !m_workers.empty(); }
+
+        // returns a nonzero request id, or 0 when the service cannot take the
+        // request (not activated) and the caller must compute synchronously
+        uint64 SubmitRequest(Unit const& owner, Vector3 const& start, Vector3 const& end, bool forceDest = false);
+
+        // fetches a finished path; false while the request is still computing
+        bool TakeResult(uint64 requestId, Result& result);
+
+        // forget a request whose consumer went away (generator destroyed)
+        void CancelRequest(uint64 requestId);
+
+    private:
+        struct Request
+        {
+            uint64 id;
+            uint32 mapId;
+            Vector3 start;
+            Vector3 end;
+            uint16 includeFlags;
+            uint16 excludeFlags;
+            bool forceDest;
+        };
+
+        void WorkerThread();
+
+        std::vector<std::thread> m_workers;
+        std::deque<Request> m_requests;
+        std::unordered_map<uint64, Result> m_results;
+        std::unordered_set<uint64> m_cancelled;
+
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        std::atomic<uint64> m_requestCounter;
+        bool m_cancelationToken;
+};
+
+#define sPathFinderService MaNGOS::Singleton<PathFinderService>::Instance()
+
+#endif
@@ -377,7 +377,8 @@ bool TaxiMovementGenerator::Move(Unit& unit)
 {
     Movement::MoveSplineInit init(unit);
     Movement::PointsArray& spline = init.Path();
-    std::copy((m_spline.begin() + m_pathIndex), m_spline.end(), back_inserter(spline));
+    Movement::PointsArray const& source = (m_bakedPoints ? *m_bakedPoints : m_spline);
+    std::copy((source.begin() + m_pathIndex), source.end(), back_inserter(spline));
     init.SetFirstPointId(m_pathIndex);
     init.SetFly();
     init.SetVelocity(TAXI_FLIGHT_SPEED);
@@ -401,13 +402,21 @@ bool TaxiMovementGenerator::Resume(Unit& unit)
         auto nodes = player.GetTaxiPathSpline();
         m_path.clear();
         m_spline.clear();
-        m_spline.reserve(nodes.size());
 
-        uint32 i = 0;
-        for (auto itr = nodes.begin(); itr != nodes.end(); ++itr, ++i)
+        // Common direct flight: bind the immutable points baked at DBC load
+        // and just seek by offset below. Stitched, trimmed or cross-map legs
+        // keep assembling their points here.
+        m_bakedPoints = player.GetTaxiPathBakedSpline();
+        if (!m_bakedPoints)
         {
-            m_path.emplace(i, WaypointNode((*itr)->x, (*itr)->y, (*itr)->z , std::nullopt, 0, 0));
-            m_spline.push_back({ (*itr)->x, (*itr)->y, (*itr)->z });
+            m_spline.reserve(nodes.size());
+
+            uint32 i = 0;
+            for (auto itr = nodes.begin(); itr != nodes.end(); ++itr, ++i)
+            {
+                m_path.emplace(i, WaypointNode((*itr)->x, (*itr)->y, (*itr)->z , std::nullopt, 0, 0));
+                m_spline.push_back({ (*itr)->x, (*itr)->y, (*itr)->z });
+            }
         }
 
         m_pathIndex = player.GetTaxiPathSplineOffset();
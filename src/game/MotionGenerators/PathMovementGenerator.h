@@ -24,6 +24,7 @@
 #include "Movement/MoveSplineInit.h"
 #include "Entities/ObjectGuid.h"
 
+#include <memory>
 #include <vector>
 
 class AbstractPathMovementGenerator : public MovementGenerator
@@ -104,6 +105,9 @@ class TaxiMovementGenerator : public AbstractPathMovementGenerator
 
     protected:
         virtual bool Move(Unit& unit);
+
+        // immutable spline baked at DBC load, bound when the current leg is a whole single-map path
+        std::shared_ptr<Movement::PointsArray const> m_bakedPoints;
 };
 
 #endif
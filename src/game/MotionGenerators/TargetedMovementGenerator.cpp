@@ -18,6 +18,7 @@
 
 #include "MotionGenerators/TargetedMovementGenerator.h"
 #include "PathFinder.h"
+#include "MotionGenerators/PathFinderService.h"
 #include "Entities/Unit.h"
 #include "Entities/Creature.h"
 #include "Entities/Player.h"
@@ -221,6 +222,12 @@ float ChaseMovementGenerator::GetDynamicTargetDistance(Unit& owner, bool forRang
     }
 }
 
+ChaseMovementGenerator::~ChaseMovementGenerator()
+{
+    if (m_pendingPathId)
+        sPathFinderService.CancelRequest(m_pendingPathId);
+}
+
 void ChaseMovementGenerator::HandleTargetedMovement(Unit& owner, const uint32& time_diff)
 {
     bool targetMoved = false;
@@ -236,6 +243,8 @@ void ChaseMovementGenerator::HandleTargetedMovement(Unit& owner, const uint32& t
         }
         else m_closenessAndFanningTimer -= time_diff;
     }
+    if (m_pendingPathId) // path service finished? dispatch it, else keep moving on the last spline
+        ConsumePendingPath(owner);
     if (!this->i_recheckDistance.Passed())
         return;
 
@@ -269,6 +278,15 @@ void ChaseMovementGenerator::HandleTargetedMovement(Unit& owner, const uint32& t
 
             if (owner.GetDistance(x, y, z, DIST_CALC_NONE) > 0.3f)
             {
+                if (sPathFinderService.activated() && !owner.IsDebuggingMovement())
+                {
+                    RequestPathAsync(owner, x, y, z);
+                    if (m_pendingPathId)
+                    {
+                        this->i_speedChanged = false;
+                        return;
+                    }
+                }
                 if (DispatchSplineToPosition(owner, x, y, z, EnableWalking(), true, true, true))
                 {
                     this->i_targetReached = false;
@@ -544,6 +562,11 @@ bool ChaseMovementGenerator::DispatchSplineToPosition(Unit& owner, float x, floa
 
     auto& path = this->i_path->getPath();
 
+    return DispatchSplineFromPath(owner, path, walk, cutPath, target, checkReachable);
+}
+
+bool ChaseMovementGenerator::DispatchSplineFromPath(Unit& owner, PointsArray& path, bool walk, bool cutPath, bool target, bool checkReachable)
+{
     if (cutPath)
         CutPath(owner, path);
 
@@ -581,6 +604,48 @@ bool ChaseMovementGenerator::DispatchSplineToPosition(Unit& owner, float x, floa
     return true;
 }
 
+void ChaseMovementGenerator::RequestPathAsync(Unit& owner, float x, float y, float z)
+{
+    if (m_pendingPathId) // newer destination supersedes the request in flight
+        sPathFinderService.CancelRequest(m_pendingPathId);
+
+    float sx, sy, sz;
+    owner.GetPosition(sx, sy, sz);
+    m_pendingPathId = sPathFinderService.SubmitRequest(owner, Vector3(sx, sy, sz), Vector3(x, y, z));
+}
+
+bool ChaseMovementGenerator::ConsumePendingPath(Unit& owner)
+{
+    PathFinderService::Result result;
+    if (!sPathFinderService.TakeResult(m_pendingPathId, result))
+        return false; // still computing
+
+    m_pendingPathId = 0;
+
+    if (m_currentMode == CHASE_MODE_DISTANCING) // mode changed while the request was in flight
+        return false;
+
+    if ((result.type & PATHFIND_NOPATH) || result.path.empty())
+    {
+        if (!IsReachablePositionToTarget(owner, owner.GetPositionX(), owner.GetPositionY(), owner.GetPositionZ(), *this->i_target.getTarget()))
+            m_reachable = false;
+        return false;
+    }
+
+    // spline launch overwrites the first point with the current position, so
+    // the slightly stale start from submit time does not matter
+    if (DispatchSplineFromPath(owner, result.path, EnableWalking(), true, true, true))
+    {
+        this->i_targetReached = false;
+        this->i_speedChanged = false;
+        this->i_target->GetPosition(this->i_lastTargetPos.x, this->i_lastTargetPos.y, this->i_lastTargetPos.z, owner.GetTransport());
+        m_closenessAndFanningTimer = 0;
+        return true;
+    }
+
+    return false;
+}
+
 void ChaseMovementGenerator::CutPath(Unit& owner, PointsArray& path)
 {
     if (this->i_offset != 0.f) // need to cut path until most distant viable point
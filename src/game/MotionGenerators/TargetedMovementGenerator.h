@@ -114,8 +114,9 @@ class ChaseMovementGenerator : public TargetedMovementGeneratorMedium<Unit, Chas
         ChaseMovementGenerator(Unit& target, float offset, float angle, bool moveFurther = true, bool walk = false, bool combat = true)
             : TargetedMovementGeneratorMedium<Unit, ChaseMovementGenerator >(target, offset, angle),
             m_moveFurther(moveFurther), m_walk(walk), m_combat(combat), m_reachable(true),
-            m_fanningEnabled(true), m_backpedalEnabled(true), m_currentMode(CHASE_MODE_NORMAL), m_closenessAndFanningTimer(0), m_closenessExpired(false) {}
-        ~ChaseMovementGenerator() {}
+            m_fanningEnabled(true), m_backpedalEnabled(true), m_currentMode(CHASE_MODE_NORMAL), m_closenessAndFanningTimer(0), m_closenessExpired(false),
+            m_pendingPathId(0) {}
+        ~ChaseMovementGenerator();
 
         MovementGeneratorType GetMovementGeneratorType() const override { return CHASE_MOTION_TYPE; }
 
@@ -160,6 +161,9 @@ class ChaseMovementGenerator : public TargetedMovementGeneratorMedium<Unit, Chas
         bool IsReachablePositionToTarget(Unit& owner, float x, float y, float z, Unit& target);
 
         bool DispatchSplineToPosition(Unit& owner, float x, float y, float z, bool walk, bool cutPath, bool target = false, bool checkReachable = false);
+        bool DispatchSplineFromPath(Unit& owner, PointsArray& path, bool walk, bool cutPath, bool target, bool checkReachable);
+        void RequestPathAsync(Unit& owner, float x, float y, float z);
+        bool ConsumePendingPath(Unit& owner);
         void CutPath(Unit& owner, PointsArray& path);
         void Backpedal(Unit& owner);
 
@@ -175,6 +179,8 @@ class ChaseMovementGenerator : public TargetedMovementGeneratorMedium<Unit, Chas
 
         ChaseMovementMode m_currentMode;
 
+        uint64 m_pendingPathId; // async path request in flight, 0 when none
+
         GuidVector m_spawns;
 };
 
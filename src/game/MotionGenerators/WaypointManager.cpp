@@ -17,6 +17,7 @@
  */
 
 #include "WaypointManager.h"
+#include "Movement/MoveSplineInitArgs.h"
 #include "Database/DatabaseEnv.h"
 #include "Maps/GridDefines.h"
 #include "Policies/Singleton.h"
@@ -585,6 +586,8 @@ WaypointNode const* WaypointManager::AddNode(uint32 entry, uint32 dbGuid, uint32
     else
         WorldDatabase.PExecuteLog("INSERT INTO %s (%s,Point,PositionX,PositionY,PositionZ,Orientation) VALUES (%u,%u, %f,%f,%f, %f)", table, key_field, key, pointId, x, y, z, orientation);
 
+    ClearPathSegmentCache(&path);
+
     return &path[pointId];
 }
 
@@ -613,6 +616,7 @@ void WaypointManager::DeleteNode(uint32 entry, uint32 dbGuid, uint32 point, uint
         WorldDatabase.PExecuteLog("DELETE FROM %s WHERE %s=%u AND Point=%u", table, key_field, key, point);
 
     path->erase(point);
+    ClearPathSegmentCache(path);
 }
 
 void WaypointManager::DeletePath(uint32 id)
@@ -620,13 +624,41 @@ void WaypointManager::DeletePath(uint32 id)
     WorldDatabase.PExecuteLog("DELETE FROM creature_movement WHERE Id=%u", id);
     WaypointPathMap::iterator itr = m_pathMap.find(id);
     if (itr != m_pathMap.end())
+    {
         itr->second.clear();
+        ClearPathSegmentCache(&itr->second);
+    }
     // the path is not removed from the map, just cleared
     // WMGs have pointers to the path, so deleting them would crash
     // this wastes some memory, but these functions are
     // only meant to be called by GM commands
 }
 
+bool WaypointManager::GetCachedPathSegment(WaypointPath const* path, uint32 fromPoint, Movement::PointsArray& out) const
+{
+    std::lock_guard<std::mutex> guard(m_pathSegmentCacheMutex);
+    PathSegmentCache::const_iterator itr = m_pathSegmentCache.find(std::make_pair(path, fromPoint));
+    if (itr == m_pathSegmentCache.end())
+        return false;
+
+    out = itr->second;
+    return true;
+}
+
+void WaypointManager::CachePathSegment(WaypointPath const* path, uint32 fromPoint, Movement::PointsArray const& points)
+{
+    std::lock_guard<std::mutex> guard(m_pathSegmentCacheMutex);
+    m_pathSegmentCache[std::make_pair(path, fromPoint)] = points;
+}
+
+void WaypointManager::ClearPathSegmentCache(WaypointPath const* path)
+{
+    std::lock_guard<std::mutex> guard(m_pathSegmentCacheMutex);
+    PathSegmentCache::iterator itr = m_pathSegmentCache.lower_bound(std::make_pair(path, 0u));
+    while (itr != m_pathSegmentCache.end() && itr->first.first == path)
+        itr = m_pathSegmentCache.erase(itr);
+}
+
 void WaypointManager::SetNodePosition(uint32 entry, uint32 dbGuid, uint32 point, uint32 pathId, WaypointPathOrigin wpOrigin, float x, float y, float z)
 {
     // Support only normal movement tables
@@ -658,6 +690,7 @@ void WaypointManager::SetNodePosition(uint32 entry, uint32 dbGuid, uint32 point,
         find->second.y = y;
         find->second.z = z;
     }
+    ClearPathSegmentCache(path);
 }
 
 void WaypointManager::SetNodeWaittime(uint32 entry, uint32 dbGuid, uint32 point, uint32 pathId, WaypointPathOrigin wpOrigin, uint32 waittime)
@@ -21,8 +21,21 @@
 
 #include "Common.h"
 
+#include <mutex>
 #include <optional>
 
+// this header is pulled into most of the core through MotionMaster.h - keep
+// the spline types forward-declared so G3D stays out of the include chain
+namespace G3D
+{
+    class Vector3;
+}
+
+namespace Movement
+{
+    typedef std::vector<G3D::Vector3> PointsArray;
+}
+
 enum WaypointPathOrigin
 {
     PATH_NO_PATH                = 0,
@@ -146,6 +159,13 @@ class WaypointManager
         void SetNodeOrientation(uint32 entry, uint32 dbGuid, uint32 point, uint32 pathId, WaypointPathOrigin wpOrigin, float orientation);
         bool SetNodeScriptId(uint32 entry, uint32 dbGuid, uint32 point, uint32 pathId, WaypointPathOrigin wpOrigin, uint32 scriptId);
 
+        // Shared cache of navmesh paths between consecutive waypoints. Every
+        // segment after the first starts exactly on a node (destinations are
+        // forced), so the computed point sequence is identical for all
+        // creatures walking the path and is baked once on first use.
+        bool GetCachedPathSegment(WaypointPath const* path, uint32 fromPoint, Movement::PointsArray& out) const;
+        void CachePathSegment(WaypointPath const* path, uint32 fromPoint, Movement::PointsArray const& points);
+
         // Small Helper for nice output
         static std::string GetOriginString(WaypointPathOrigin origin)
         {
@@ -193,11 +213,18 @@ class WaypointManager
             }
         }
 
+        // drop baked segments of a path after GM editing
+        void ClearPathSegmentCache(WaypointPath const* path);
+
         WaypointPathMap m_pathMap;
         WaypointPathMap m_pathTemplateMap;
         WaypointPathMap m_externalPathTemplateMap;
         WaypointPathMap m_pathMovementTemplateMap;
 
+        typedef std::map<std::pair<WaypointPath const*, uint32 /*fromPoint*/>, Movement::PointsArray> PathSegmentCache;
+        PathSegmentCache m_pathSegmentCache;
+        mutable std::mutex m_pathSegmentCacheMutex;
+
         std::string m_externalTable;
 };
 
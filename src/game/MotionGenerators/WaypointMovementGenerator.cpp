@@ -253,17 +253,28 @@ void WaypointMovementGenerator<Creature>::OnArrived(Creature& creature)
     m_scriptTime = 0;
 }
 
-// return added travel time - TODO: implement caching of path
-uint32 WaypointMovementGenerator<Creature>::BuildIntPath(PointsArray& path, Creature& creature, Vector3 const& endPos)
+// return added travel time
+uint32 WaypointMovementGenerator<Creature>::BuildIntPath(PointsArray& path, Creature& creature, Vector3 const& endPos, uint32 fromPoint)
 {
     Vector3 startPos = path.back();
     uint32 travelTime = 0;
     auto speedType = MovementInfo::GetSpeedType(creature.m_movementInfo.GetMovementFlags());
     float creatureSpeed = creature.GetSpeed(speedType);
 
-    PathFinder pathfinder(&creature, true);
-    pathfinder.calculate(startPos, endPos, true);
-    auto genPath = pathfinder.getPath();
+    // segments between nodes start exactly on the previous node (forced
+    // destination), so their navmesh path is shared by every creature on
+    // this waypoint path; only the segment from the creature's live
+    // position has to be computed per mover
+    Movement::PointsArray genPath;
+    bool const cacheable = fromPoint != uint32(-1);
+    if (!cacheable || !sWaypointMgr.GetCachedPathSegment(i_path, fromPoint, genPath))
+    {
+        PathFinder pathfinder(&creature, true);
+        pathfinder.calculate(startPos, endPos, true);
+        genPath = pathfinder.getPath();
+        if (cacheable)
+            sWaypointMgr.CachePathSegment(i_path, fromPoint, genPath);
+    }
 
     Vector3 firstPoint = startPos;
     bool first = true;
@@ -388,7 +399,7 @@ void WaypointMovementGenerator<Creature>::SendNextWayPointPath(Creature& creatur
         // extend path only if next node is different than current node
         m_nodeIndexes.push_back(genPath.size() - 1);
         Vector3 nodeAfterCoord(nodeAfter.x, nodeAfter.y, nodeAfter.z);
-        travelTime += BuildIntPath(genPath, creature, nodeAfterCoord);
+        travelTime += BuildIntPath(genPath, creature, nodeAfterCoord, currPointItr->first);
         currPointItr = nodeAfterItr;
         nextNode = &nodeAfterItr->second;
     }
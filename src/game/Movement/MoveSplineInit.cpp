@@ -119,6 +119,14 @@ namespace Movement
         return move_spline.Duration();
     }
 
+    void MoveSplineInit::SnapPathToGround()
+    {
+        if (args.path.empty())
+            return;
+
+        unit.GetTerrain()->GetHeightsStatic(unit.GetTerrainCursor(), args.path.data(), args.path.size());
+    }
+
     void MoveSplineInit::Stop(bool forceSend /*= false*/)
     {
         MoveSpline& move_spline = *unit.movespline;
@@ -90,6 +90,12 @@ namespace Movement
 
             PointsArray& Path() { return args.path; }
 
+            /* Snaps every queued path point to ground height in one batched
+             * terrain query; runs of points inside one tile resolve the tile
+             * once through the mover's terrain cursor
+             */
+            void SnapPathToGround();
+
             void SetCombatSlowed(float slowed) { args.slowed = slowed; }
             bool CheckBounds() const { return args._checkPathBounds(); }
         protected:
@@ -20,6 +20,12 @@
 #include <sstream>
 #include <G3D/Matrix4.h>
 
+// x86-64 guarantees SSE2; use the 4-wide spline evaluation kernels there
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPLINE_SSE2_EVAL
+#include <emmintrin.h>
+#endif
+
 namespace Movement
 {
 
@@ -96,6 +102,89 @@ namespace Movement
         position.z = z;
     }*/
 
+#ifdef SPLINE_SSE2_EVAL
+    // weights = t^3 * row0 + t^2 * row1 + t * row2 + row3 of the coefficient matrix
+    inline __m128 C_EvaluateWeights(float t3, float t2, float t1, float t0, const Matrix4& matr)
+    {
+        return _mm_add_ps(
+                   _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t3), _mm_loadu_ps(matr[0])),
+                              _mm_mul_ps(_mm_set1_ps(t2), _mm_loadu_ps(matr[1]))),
+                   _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t1), _mm_loadu_ps(matr[2])),
+                              _mm_mul_ps(_mm_set1_ps(t0), _mm_loadu_ps(matr[3]))));
+    }
+
+    inline void C_WeightedSum(const Vector3* vertice, __m128 weights, Vector3& result)
+    {
+        // control points are loaded component-wise: a 16-byte load of the
+        // last point would read past the end of the points array
+        __m128 acc = _mm_mul_ps(_mm_shuffle_ps(weights, weights, 0x00), _mm_set_ps(0.f, vertice[0].z, vertice[0].y, vertice[0].x));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(weights, weights, 0x55), _mm_set_ps(0.f, vertice[1].z, vertice[1].y, vertice[1].x)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(weights, weights, 0xAA), _mm_set_ps(0.f, vertice[2].z, vertice[2].y, vertice[2].x)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(weights, weights, 0xFF), _mm_set_ps(0.f, vertice[3].z, vertice[3].y, vertice[3].x)));
+
+        alignas(16) float out[4];
+        _mm_store_ps(out, acc);
+        result.x = out[0];
+        result.y = out[1];
+        result.z = out[2];
+    }
+
+    inline void C_Evaluate(const Vector3* vertice, float t, const Matrix4& matr, Vector3& result)
+    {
+        C_WeightedSum(vertice, C_EvaluateWeights(t * t * t, t * t, t, 1.f, matr), result);
+    }
+
+    inline void C_Evaluate_Derivative(const Vector3* vertice, float t, const Matrix4& matr, Vector3& result)
+    {
+        C_WeightedSum(vertice, C_EvaluateWeights(3.f * t * t, 2.f * t, 1.f, 0.f, matr), result);
+    }
+
+    // Evaluates up to four parameter values of one segment in a single SoA
+    // pass (positions held x/y/z per lane) and sums the chord lengths with
+    // one vector square root; this is the whole segment length integration
+    // for STEPS_PER_SEGMENT <= 4.
+    inline float C_SegLengthBatch4(const Vector3* vertice, const Matrix4& matr, const Vector3& start, int steps)
+    {
+        float const step = 1.f / float(steps);
+        __m128 const t1 = _mm_mul_ps(_mm_set_ps(4.f, 3.f, 2.f, 1.f), _mm_set1_ps(step));
+        __m128 const t2 = _mm_mul_ps(t1, t1);
+        __m128 const t3 = _mm_mul_ps(t2, t1);
+
+        __m128 x = _mm_setzero_ps();
+        __m128 y = _mm_setzero_ps();
+        __m128 z = _mm_setzero_ps();
+        for (int j = 0; j < 4; ++j)
+        {
+            // per-lane weight j = t^3 * m[0][j] + t^2 * m[1][j] + t * m[2][j] + m[3][j]
+            __m128 const w = _mm_add_ps(
+                                 _mm_add_ps(_mm_mul_ps(t3, _mm_set1_ps(matr[0][j])), _mm_mul_ps(t2, _mm_set1_ps(matr[1][j]))),
+                                 _mm_add_ps(_mm_mul_ps(t1, _mm_set1_ps(matr[2][j])), _mm_set1_ps(matr[3][j])));
+            x = _mm_add_ps(x, _mm_mul_ps(w, _mm_set1_ps(vertice[j].x)));
+            y = _mm_add_ps(y, _mm_mul_ps(w, _mm_set1_ps(vertice[j].y)));
+            z = _mm_add_ps(z, _mm_mul_ps(w, _mm_set1_ps(vertice[j].z)));
+        }
+
+        // chord chain: each lane's previous sample is the lane before it,
+        // with the segment start ahead of lane zero
+        alignas(16) float px[5] = { start.x };
+        alignas(16) float py[5] = { start.y };
+        alignas(16) float pz[5] = { start.z };
+        _mm_storeu_ps(px + 1, x);
+        _mm_storeu_ps(py + 1, y);
+        _mm_storeu_ps(pz + 1, z);
+
+        __m128 const dx = _mm_sub_ps(_mm_loadu_ps(px + 1), _mm_load_ps(px));
+        __m128 const dy = _mm_sub_ps(_mm_loadu_ps(py + 1), _mm_load_ps(py));
+        __m128 const dz = _mm_sub_ps(_mm_loadu_ps(pz + 1), _mm_load_ps(pz));
+        alignas(16) float lengths[4];
+        _mm_store_ps(lengths, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz))));
+
+        float length = 0.f;
+        for (int i = 0; i < steps; ++i)     // lanes beyond steps are discarded
+            length += lengths[i];
+        return length;
+    }
+#else
     inline void C_Evaluate(const Vector3* vertice, float t, const Matrix4& matr, Vector3& result)
     {
         Vector4 tvec(t * t * t, t * t, t, 1.f);
@@ -113,6 +202,7 @@ namespace Movement
         result = vertice[0] * weights[0] + vertice[1] * weights[1]
                  + vertice[2] * weights[2] + vertice[3] * weights[3];
     }
+#endif
 
     void SplineBase::EvaluateLinear(index_type index, float u, Vector3& result) const
     {
@@ -162,8 +252,14 @@ namespace Movement
     {
         MANGOS_ASSERT(index >= index_lo && index < index_hi);
 
-        Vector3 nextPos;
         const Vector3* p = &points[index - 1];
+
+#ifdef SPLINE_SSE2_EVAL
+        if (STEPS_PER_SEGMENT <= 4)
+            return C_SegLengthBatch4(p, s_catmullRomCoeffs, p[1], STEPS_PER_SEGMENT);
+#endif
+
+        Vector3 nextPos;
         Vector3 curPos = nextPos = p[1];
 
         index_type i = 1;
@@ -183,9 +279,14 @@ namespace Movement
         index *= 3u;
         MANGOS_ASSERT(index >= index_lo && index < index_hi);
 
-        Vector3 nextPos;
         const Vector3* p = &points[index];
 
+#ifdef SPLINE_SSE2_EVAL
+        if (STEPS_PER_SEGMENT <= 4)
+            return C_SegLengthBatch4(p, s_Bezier3Coeffs, p[0], STEPS_PER_SEGMENT);
+#endif
+
+        Vector3 nextPos;
         C_Evaluate(p, 0.f, s_Bezier3Coeffs, nextPos);
         Vector3 curPos = nextPos;
 
@@ -43,6 +43,15 @@
 #include "../../Spells/SpellMgr.h"
 #include "../../Tools/Language.h"
 #include "../../World/World.h"
+#include "Config/Config.h"
+#ifdef BUILD_METRICS
+ #include "Metric/Metric.h"
+#endif
+
+#include <atomic>
+#include <mutex>
+
+extern Config botConfig;
 
 #include "../AI/PlayerbotDruidAI.h"
 #include "../AI/PlayerbotHunterAI.h"
@@ -82,6 +91,9 @@ PlayerbotAI::PlayerbotAI(PlayerbotMgr &mgr, Player* const bot, bool debugWhisper
     m_ignoreNeutralizeEffect(false),
     m_debugWhisper(debugWhisper)
 {
+    // stagger the first think so a freshly added group of bots does not tick in lockstep
+    m_ignoreAIUpdatesUntilTime = CurrentTime() + urand(0, 3);
+
     // set bot state and needed item list
     m_botState = BOTSTATE_LOADING;
     SetQuestNeedItems();
@@ -3374,7 +3386,7 @@ void PlayerbotAI::UpdateAttackerInfo()
             continue;
         Unit* a = itr->second.attacker;
         float t = 0.00;
-        std::list<HostileReference*>::const_iterator i = a->getThreatManager().getThreatList().begin();
+        ThreatList::const_iterator i = a->getThreatManager().getThreatList().begin();
         for (; i != a->getThreatManager().getThreatList().end(); ++i)
         {
             if ((*i)->getThreat() > t && (*i)->getTarget() != m_bot)
@@ -3871,6 +3883,61 @@ void PlayerbotAI::Announce(AnnounceFlags msg)
 // hasUnitState(FLAG) FLAG like: UNIT_STAT_ROOT, UNIT_STAT_CONFUSED, UNIT_STAT_STUNNED
 // hasAuraType
 
+uint8 PlayerbotAI::CalcThinkInterval() const
+{
+    // fighting bots must react to target and group changes quickly
+    if (m_botState == BOTSTATE_COMBAT || m_bot->IsInCombat())
+        return 1;
+
+    // moving bots only need to correct their course now and then
+    if (m_botState == BOTSTATE_FLYING || m_botState == BOTSTATE_LOOTING || m_bot->IsTaxiFlying() || m_bot->IsMoving())
+        return 2;
+
+    // an idle bot merely polls for new orders
+    return 4;
+}
+
+bool PlayerbotAI::TakeThinkSlot()
+{
+    static uint32 const budget = botConfig.GetIntDefault("PlayerbotAI.ThinkBudgetPerTick", 0);
+    if (!budget)
+        return true;
+
+    // bots update from the map workers, so the per tick bookkeeping must be atomic;
+    // a new budget epoch begins whenever the world tick timestamp moves
+    static std::atomic<uint32> tickStamp{0};
+    static std::atomic<int32> slotsLeft{0};
+    static std::atomic<uint32> thinks{0};
+    static std::atomic<uint32> deferrals{0};
+
+    uint32 now = World::GetCurrentMSTime();
+    uint32 stamp = tickStamp.load(std::memory_order_relaxed);
+    if (stamp != now && tickStamp.compare_exchange_strong(stamp, now))
+    {
+        // report the achieved think rate of the finished tick for tuning bot count against headroom
+#ifdef BUILD_METRICS
+        metric::metric::instance().report("playerbot.thinks",
+        {
+            { "count", int64(thinks.exchange(0, std::memory_order_relaxed)) },
+            { "deferred", int64(deferrals.exchange(0, std::memory_order_relaxed)) },
+        }, {});
+#else
+        thinks.store(0, std::memory_order_relaxed);
+        deferrals.store(0, std::memory_order_relaxed);
+#endif
+        slotsLeft.store(int32(budget), std::memory_order_relaxed);
+    }
+
+    if (slotsLeft.fetch_sub(1, std::memory_order_relaxed) > 0)
+    {
+        thinks.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    deferrals.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
 void PlayerbotAI::UpdateAI(const uint32 /*p_time*/)
 {
     if (GetClassAI()->GetWaitUntil() <= CurrentTime())
@@ -3879,8 +3946,13 @@ void PlayerbotAI::UpdateAI(const uint32 /*p_time*/)
     if (CurrentTime() < m_ignoreAIUpdatesUntilTime)
         return;
 
-    // default updates occur every two seconds
-    SetIgnoreUpdateTime(2);
+    // when this tick's global think budget is spent, retry on a later tick;
+    // the ignore time is left untouched so the bot stays at the front of the queue
+    if (!TakeThinkSlot())
+        return;
+
+    // update cadence scales with the bot's situation - combat thinks fastest
+    SetIgnoreUpdateTime(CalcThinkInterval());
 
     if (m_botState == BOTSTATE_LOADING)
     {
@@ -5138,6 +5210,67 @@ void PlayerbotAI::findItemsInInv(std::list<uint32>& itemIdSearchList, std::list<
     }
 }
 
+PlayerbotAI::CellPerception const& PlayerbotAI::GetCellPerception()
+{
+    // snapshots are keyed by map and cell so a 40-bot raid standing together
+    // pays for one grid walk per tick instead of one per bot; access is
+    // mutex-guarded because bots update from the map worker threads
+    static std::map<std::pair<Map const*, uint32>, CellPerception> s_perception;
+    static std::mutex s_perceptionLock;
+    static uint32 s_perceptionTick = 0;
+
+    Map* map = m_bot->GetMap();
+    CellPair center(MaNGOS::ComputeCellPair(m_bot->GetPositionX(), m_bot->GetPositionY()).normalize());
+    uint32 cellId = (center.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + center.x_coord;
+    uint32 now = World::GetCurrentMSTime();
+
+    std::lock_guard<std::mutex> guard(s_perceptionLock);
+
+    // drop last tick's snapshots wholesale - they hold raw pointers into maps
+    // that may since have despawned objects or been unloaded entirely
+    if (s_perceptionTick != now)
+    {
+        s_perceptionTick = now;
+        s_perception.clear();
+    }
+
+    CellPerception& perception = s_perception[{ map, cellId }];
+    if (perception.tickStamp == now)
+        return perception;
+
+    perception.tickStamp = now;
+    perception.creatures.clear();
+    perception.corpses.clear();
+    perception.gameObjects.clear();
+
+    // pad the gather radius by a cell so the snapshot covers every bot standing
+    // anywhere in this cell, not just the one that happened to build it
+    float radius = float(m_mgr.m_confCollectDistance) + SIZE_OF_GRID_CELL;
+    CellArea area = Cell::CalculateCellArea(m_bot->GetPositionX(), m_bot->GetPositionY(), radius);
+
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            for (WorldObject* obj : map->GetCellSnapshot(CellPair(x, y)).objects)
+            {
+                if (obj->GetTypeId() == TYPEID_UNIT)
+                {
+                    Creature* creature = static_cast<Creature*>(obj);
+                    if (creature->IsAlive())
+                        perception.creatures.push_back(creature);
+                    else
+                        perception.corpses.push_back(creature);
+                }
+                else if (obj->GetTypeId() == TYPEID_GAMEOBJECT)
+                    perception.gameObjects.push_back(static_cast<GameObject*>(obj));
+            }
+        }
+    }
+
+    return perception;
+}
+
 void PlayerbotAI::findNearbyGO()
 {
     if (m_collectObjects.empty())
@@ -5167,10 +5300,10 @@ void PlayerbotAI::findNearbyGO()
             }
         }
 
-        // search for GOs with entry, within range of m_bot
-        MaNGOS::GameObjectEntryInPosRangeCheck go_check(*m_bot, entry, m_bot->GetPositionX(), m_bot->GetPositionY(), m_bot->GetPositionZ(), float(m_collectDist));
-        MaNGOS::GameObjectListSearcher<MaNGOS::GameObjectEntryInPosRangeCheck> checker(tempTargetGOList, go_check);
-        Cell::VisitGridObjects(m_bot, checker, float(m_collectDist));
+        // search the shared cell snapshot for GOs with entry, within range of m_bot
+        for (GameObject* go : GetCellPerception().gameObjects)
+            if (go->GetEntry() == entry && go->IsWithinDist3d(m_bot->GetPositionX(), m_bot->GetPositionY(), m_bot->GetPositionZ(), float(m_collectDist)))
+                tempTargetGOList.push_back(go);
 
         // no objects found, continue to next entry
         if (tempTargetGOList.empty())
@@ -5188,20 +5321,17 @@ void PlayerbotAI::findNearbyGO()
 
 void PlayerbotAI::findNearbyCorpse()
 {
-    UnitList corpseList;
     float radius = float(m_mgr.m_confCollectDistance);
 //    float radius = 40.0f;
-    MaNGOS::AnyDeadUnitCheck corpse_check(m_bot);
-    MaNGOS::UnitListSearcher<MaNGOS::AnyDeadUnitCheck> reaper(corpseList, corpse_check);
-    Cell::VisitAllObjects(m_bot, reaper, radius);
+    std::vector<Creature*> const& corpseList = GetCellPerception().corpses;
 
     //if (!corpseList.empty())
     //    TellMaster("Found %i Corpse(s)", corpseList.size());
 
-    for (UnitList::const_iterator i = corpseList.begin(); i != corpseList.end(); ++i)
+    for (std::vector<Creature*>::const_iterator i = corpseList.begin(); i != corpseList.end(); ++i)
     {
-        Creature* corpse = (Creature*)*i;
-        if (!corpse)
+        Creature* corpse = *i;
+        if (!corpse || !m_bot->IsWithinDistInMap(corpse, radius))
             continue;
 
         if (!corpse->IsCorpse() || corpse->IsDespawned() || m_bot->CanAssist(corpse) || !corpse->m_loot)
@@ -5232,25 +5362,19 @@ void PlayerbotAI::findNearbyCreature()
         m_findNPC.clear();
         return;
     }
-    CreatureList creatureList;
     float radius = INTERACTION_DISTANCE;
 
-    CellPair pair(MaNGOS::ComputeCellPair(m_bot->GetPositionX(), m_bot->GetPositionY()));
-    Cell cell(pair);
-
-    MaNGOS::AnyUnitInObjectRangeCheck go_check(m_bot, radius);
-    MaNGOS::CreatureListSearcher<MaNGOS::AnyUnitInObjectRangeCheck> go_search(creatureList, go_check);
-    TypeContainerVisitor<MaNGOS::CreatureListSearcher<MaNGOS::AnyUnitInObjectRangeCheck>, GridTypeMapContainer> go_visit(go_search);
-
-    // Get Creatures
-    cell.Visit(pair, go_visit, *(m_bot->GetMap()), *(m_bot), radius);
+    // Get Creatures from the shared cell snapshot
+    std::vector<Creature*> const& creatureList = GetCellPerception().creatures;
 
     // if (!creatureList.empty())
     //    TellMaster("Found %i Creatures.", creatureList.size());
 
-    for (CreatureList::iterator iter = creatureList.begin(); iter != creatureList.end(); iter++)
+    for (std::vector<Creature*>::const_iterator iter = creatureList.begin(); iter != creatureList.end(); iter++)
     {
         Creature* currCreature = *iter;
+        if (!m_bot->IsWithinDistInMap(currCreature, radius))
+            continue;
 
         for (std::list<enum NPCFlags>::iterator itr = m_findNPC.begin(); itr != m_findNPC.end();)
         {
@@ -29,6 +29,8 @@ class WorldPacket;
 class WorldObject;
 class Player;
 class Unit;
+class Creature;
+class GameObject;
 class Object;
 class Item;
 class PlayerbotClassAI;
@@ -391,6 +393,17 @@ class PlayerbotAI
         void findItemsInEquip(std::list<uint32>& itemIdSearchList, std::list<Item*>& foundItemList) const;
         // finds items in bots inventory and adds them to foundItemList, removes found items from itemIdSearchList
         void findItemsInInv(std::list<uint32>& itemIdSearchList, std::list<Item*>& foundItemList) const;
+        // shared perception snapshot for one occupied cell: built once per world tick
+        // by the first bot standing in it, consumed read-only by every other bot there
+        struct CellPerception
+        {
+            uint32 tickStamp = 0;
+            std::vector<Creature*> creatures;       // live creatures for NPC interaction
+            std::vector<Creature*> corpses;         // dead creatures for looting and skinning
+            std::vector<GameObject*> gameObjects;   // gameobjects for collection
+        };
+        // returns the perception snapshot of the bot's current cell, building it when stale
+        CellPerception const& GetCellPerception();
         // finds nearby game objects that are specified in m_collectObjects then adds them to the m_lootTargets list
         void findNearbyGO();
         // finds nearby creatures, whose UNIT_NPC_FLAGS match the flags specified in item list m_itemIds
@@ -495,6 +508,10 @@ class PlayerbotAI
         void DoCombatMovement();
         void SetIgnoreUpdateTime(uint8 t = 0) { m_ignoreAIUpdatesUntilTime = time(nullptr) + t; };
         time_t CurrentTime() { return time(nullptr); };
+        // think interval in seconds scaled by the bot's current situation
+        uint8 CalcThinkInterval() const;
+        // claims one slot of the global per-tick think budget; false means defer to a later tick
+        static bool TakeThinkSlot();
 
         Player* GetPlayerBot() const { return m_bot; }
         Player* GetPlayer() const { return m_bot; }
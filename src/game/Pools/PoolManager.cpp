@@ -193,7 +193,7 @@ void PoolGroup<T>::SetExcludeObject(uint32 guid, bool state)
 }
 
 template <class T>
-PoolObject* PoolGroup<T>::RollOne(SpawnedPoolData& spawns, uint32 triggerFrom, MapPersistentState& mapState)
+PoolObject* PoolGroup<T>::RollOne(SpawnedPoolData& spawns, uint32 triggerFrom, MapPersistentState& mapState, std::vector<PoolObject*>& equalCandidates)
 {
     PoolObject* explicitlyObjFound = nullptr;
     auto gen = GetRandomGenerator();
@@ -233,32 +233,27 @@ PoolObject* PoolGroup<T>::RollOne(SpawnedPoolData& spawns, uint32 triggerFrom, M
         }
     }
 
-    if (!EqualChanced.empty())
+    // draw without replacement from the shared spawn pass scratch: pick a
+    // random remaining candidate and swap-remove it, so successive rolls of
+    // the same SpawnObject call never reshuffle the whole list - big
+    // herb/ore pools made the per-roll shuffle the dominant cost
+    while (!equalCandidates.empty())
     {
-        std::vector <PoolObject*> equalyChancedVector;
+        size_t index = urand(0, equalCandidates.size() - 1);
+        PoolObject* obj = equalCandidates[index];
+        equalCandidates[index] = equalCandidates.back();
+        equalCandidates.pop_back();
 
-        // call memory manager once to reserve enough memory for performance
-        equalyChancedVector.reserve(EqualChanced.size());
-
-        // fill new vector with address of object in EqualChanced list
-        std::transform(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(equalyChancedVector), [](PoolObject& objPtr) { return &objPtr; });
-
-        // randomize the new vector
-        std::shuffle(equalyChancedVector.begin(), equalyChancedVector.end(), *gen);
-
-        for (auto obj : equalyChancedVector)
-        {
-            if (obj->exclude)
-                continue;
+        if (obj->exclude)
+            continue;
 
-            if (!CanSpawn(obj, mapState))
-                continue;
+        if (!CanSpawn(obj, mapState))
+            continue;
 
-            if (obj->guid != triggerFrom && spawns.IsSpawnedObject<T>(obj->guid))
-                continue;
+        if (obj->guid != triggerFrom && spawns.IsSpawnedObject<T>(obj->guid))
+            continue;
 
-            return obj;
-        }
+        return obj;
     }
 
     // return first explicitly chanced object if there is one
@@ -406,10 +401,20 @@ void PoolGroup<T>::SpawnObject(MapPersistentState& mapState, uint32 limit, uint3
             triggerFrom = 0;
     }
 
+    if (count <= 0)
+        return;
+
+    // selection scratch shared by every roll of this call - candidates are
+    // swap-removed as RollOne inspects them, which also guarantees one
+    // object is never picked twice in the same pass
+    std::vector<PoolObject*> equalCandidates;
+    equalCandidates.reserve(EqualChanced.size());
+    std::transform(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(equalCandidates), [](PoolObject& objPtr) { return &objPtr; });
+
     // This will try to spawn the rest of pool, not guaranteed
     for (int i = 0; i < count; ++i)
     {
-        PoolObject* obj = RollOne(spawns, triggerFrom, mapState);
+        PoolObject* obj = RollOne(spawns, triggerFrom, mapState, equalCandidates);
         if (!obj)
             continue;
         if (obj->guid == lastDespawned)
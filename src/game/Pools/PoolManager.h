@@ -106,7 +106,9 @@ class PoolGroup
         void AddEntry(PoolObject& poolitem, uint32 maxentries);
         bool CheckPool() const;
         void CheckEventLinkAndReport(int16 event_id, std::map<uint32, int16> const& creature2event, std::map<uint32, int16> const& go2event) const;
-        PoolObject* RollOne(SpawnedPoolData& spawns, uint32 triggerFrom, MapPersistentState& mapState);
+        // equalCandidates is the spawn pass scratch: candidates are drawn
+        // without replacement from it across successive rolls of one call
+        PoolObject* RollOne(SpawnedPoolData& spawns, uint32 triggerFrom, MapPersistentState& mapState, std::vector<PoolObject*>& equalCandidates);
         void DespawnObject(MapPersistentState& mapState, uint32 guid = 0);
         void Despawn1Object(MapPersistentState& mapState, uint32 guid);
         void SpawnObject(MapPersistentState& mapState, uint32 limit, uint32 triggerFrom, bool instantly);
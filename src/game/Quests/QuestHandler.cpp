@@ -631,21 +631,21 @@ uint32 WorldSession::getDialogStatus(const Player* pPlayer, const Object* questg
 
     uint32 dialogStatus = defstatus;
 
-    QuestRelationsMapBounds rbounds;                        // QuestRelations (quest-giver)
-    QuestRelationsMapBounds irbounds;                       // InvolvedRelations (quest-finisher)
+    QuestRelations const* relations;                        // QuestRelations (quest-giver)
+    QuestRelations const* involvedRelations;                // InvolvedRelations (quest-finisher)
 
     switch (questgiver->GetTypeId())
     {
         case TYPEID_UNIT:
         {
-            rbounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(questgiver->GetEntry());
-            irbounds = sObjectMgr.GetCreatureQuestInvolvedRelationsMapBounds(questgiver->GetEntry());
+            relations = &sObjectMgr.GetCreatureQuestRelations(questgiver->GetEntry());
+            involvedRelations = &sObjectMgr.GetCreatureQuestInvolvedRelations(questgiver->GetEntry());
             break;
         }
         case TYPEID_GAMEOBJECT:
         {
-            rbounds = sObjectMgr.GetGOQuestRelationsMapBounds(questgiver->GetEntry());
-            irbounds = sObjectMgr.GetGOQuestInvolvedRelationsMapBounds(questgiver->GetEntry());
+            relations = &sObjectMgr.GetGOQuestRelations(questgiver->GetEntry());
+            involvedRelations = &sObjectMgr.GetGOQuestInvolvedRelations(questgiver->GetEntry());
             break;
         }
         default:
@@ -655,10 +655,9 @@ uint32 WorldSession::getDialogStatus(const Player* pPlayer, const Object* questg
     }
 
     // Check markings for quest-finisher
-    for (QuestRelationsMap::const_iterator itr = irbounds.first; itr != irbounds.second; ++itr)
+    for (uint32 quest_id : *involvedRelations)
     {
         uint32 dialogStatusNew = DIALOG_STATUS_NONE;
-        uint32 quest_id = itr->second;
         Quest const* pQuest = sObjectMgr.GetQuestTemplate(quest_id);
 
         if (!pQuest || !pQuest->IsActive())
@@ -679,10 +678,9 @@ uint32 WorldSession::getDialogStatus(const Player* pPlayer, const Object* questg
     }
 
     // check markings for quest-giver
-    for (QuestRelationsMap::const_iterator itr = rbounds.first; itr != rbounds.second; ++itr)
+    for (uint32 quest_id : *relations)
     {
         uint32 dialogStatusNew = DIALOG_STATUS_NONE;
-        uint32 quest_id = itr->second;
         Quest const* pQuest = sObjectMgr.GetQuestTemplate(quest_id);
 
         if (!pQuest || !pQuest->IsActive())
@@ -194,6 +194,41 @@ void ReputationMgr::SendState(FactionState const* faction)
     m_player->SendDirectMessage(data);
 }
 
+void ReputationMgr::SendStates()
+{
+    uint32 count = 0;
+
+    WorldPacket data(SMSG_SET_FACTION_STANDING, (16));
+    size_t p_count = data.wpos();
+    data << (uint32) count;                                 // placeholder
+
+    for (auto& m_faction : m_factions)
+    {
+        FactionState& faction = m_faction.second;
+        if (faction.needSend)
+        {
+            faction.needSend = false;
+            data << uint32(faction.ReputationListID);
+            data << uint32(faction.Standing);
+
+            ++count;
+        }
+    }
+
+    if (!count)
+        return;
+
+    data.put<uint32>(p_count, count);
+    m_player->SendDirectMessage(data);
+}
+
+void ReputationMgr::EndBatch()
+{
+    MANGOS_ASSERT(m_batchDepth);
+    if (--m_batchDepth == 0)
+        SendStates();
+}
+
 void ReputationMgr::SendInitialReputations()
 {
     WorldPacket data(SMSG_INITIALIZE_FACTIONS, (4 + 64 * 5));
@@ -294,8 +329,12 @@ bool ReputationMgr::SetReputation(FactionEntry const* factionEntry, int32 standi
     if (faction != m_factions.end())
     {
         res = SetOneFactionReputation(factionEntry, standing, incremental);
-        // only this faction gets reported to client, even if it has no own visible standing
-        SendState(&faction->second);
+        // only this faction gets reported to client, even if it has no own visible standing;
+        // inside a batch window the combined report is sent by EndBatch instead
+        if (m_batchDepth)
+            faction->second.needSend = true;
+        else
+            SendState(&faction->second);
     }
     return res;
 }
@@ -57,7 +57,7 @@ class QueryResult;
 class ReputationMgr
 {
     public:                                                 // constructors and global modifiers
-        explicit ReputationMgr(Player* owner) : m_player(owner) {}
+        explicit ReputationMgr(Player* owner) : m_player(owner), m_batchDepth(0) {}
         ~ReputationMgr() {}
 
         void SaveToDB();
@@ -103,10 +103,18 @@ class ReputationMgr
 
         void ApplyForceReaction(uint32 faction_id, ReputationRank rank, bool apply);
 
+        // batch window for rewards touching several factions at once (kill and
+        // quest reputation): per-change client notifications are deferred and a
+        // single combined SMSG_SET_FACTION_STANDING goes out when the outermost
+        // batch closes
+        void BeginBatch() { ++m_batchDepth; }
+        void EndBatch();
+
     public:                                                 // senders
         void SendInitialReputations();
         void SendForceReactions();
         void SendState(FactionState const* faction);
+        void SendStates();                                  // one packet with every faction marked needSend
 
     private:                                                // internal helper functions
         void Initialize();
@@ -121,6 +129,7 @@ class ReputationMgr
         Player* m_player;
         FactionStateList m_factions;
         ForcedReactions m_forcedReactions;
+        uint8 m_batchDepth;                                 // nested BeginBatch/EndBatch windows
 };
 
 #endif
@@ -24,6 +24,7 @@
 #include "Globals/Locales.h"
 #include "Globals/SharedDefines.h"
 #include "Server/SQLStorages.h"
+#include "Database/DBCPack.h"
 
 #include "DBCfmt.h"
 
@@ -154,6 +155,7 @@ DBCStorage <TaxiPathEntry> sTaxiPathStore(TaxiPathEntryfmt);
 
 // DBC store data but sTaxiPathNodesByPath used for fast access to entries (it's not owner pointed data).
 TaxiPathNodesByPath sTaxiPathNodesByPath;
+TaxiPathSplinesByPath sTaxiPathSplinesByPath;
 static DBCStorage <TaxiPathNodeEntry> sTaxiPathNodeStore(TaxiPathNodeEntryfmt);
 
 DBCStorage <TransportAnimationEntry> sTransportAnimationStore(TransportAnimationfmt);
@@ -183,6 +185,10 @@ std::string AcceptableClientBuildsListStr()
     return data.str();
 }
 
+// preprocessed archive of all converted stores; parsed DBC files are packed
+// into it on first startup and later startups map it instead of parsing
+static DBCPack sDBCPack;
+
 static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string& filename)
 {
     sLog.outError("Size of '%s' setted by format string (%u) not equal size of C++ structure (%u).", filename.c_str(), fsize, rsize);
@@ -197,6 +203,14 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
     // compatibility format and C++ structure sizes
     MANGOS_ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
+    // fast path: the pack already holds this store fully converted, locale
+    // strings included
+    if (sDBCPack.IsOpen() && storage.LoadFromPack(sDBCPack, filename.c_str()))
+    {
+        bar.step();
+        return;
+    }
+
     std::string dbc_filename = dbc_path + filename;
     if (storage.Load(dbc_filename.c_str()))
     {
@@ -210,6 +224,9 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
             if (!storage.LoadStringsFrom(dbc_filename_loc.c_str()))
                 availableDbcLocales &= ~(1 << i);           // mark as not available for speedup next checks
         }
+
+        if (sDBCPack.IsWriting())
+            storage.WriteToPack(sDBCPack, filename.c_str());
     }
     else
     {
@@ -240,6 +257,13 @@ void LoadDBCStores(const std::string& dataPath)
 
     const uint32 DBCFilesCount = 52;
 
+    std::string const packFileName = dbcPath + "dbc.pack";
+    uint64 const dbcFingerprint = DBCPack::FingerprintDirectory(dbcPath);
+    if (sDBCPack.Open(packFileName, dbcFingerprint))
+        sLog.outString("Using preprocessed DBC pack %s", packFileName.c_str());
+    else
+        sDBCPack.BeginWrite(packFileName, dbcFingerprint);  // rebuild it from this parse
+
     BarGoLink bar(DBCFilesCount);
 
     StoreProblemList bad_dbc_files;
@@ -505,6 +529,33 @@ void LoadDBCStores(const std::string& dataPath)
         if (TaxiPathNodeEntry const* entry = sTaxiPathNodeStore.LookupEntry(i))
             sTaxiPathNodesByPath[entry->path].set(entry->index, entry);
 
+    // Bake immutable shared spline points per taxi path: flights on the same
+    // path bind these by pointer instead of rebuilding the geometry for every
+    // passenger. Paths with mid-flight map transitions keep runtime assembly.
+    sTaxiPathSplinesByPath.resize(pathCount);
+    for (uint32 i = 1; i < sTaxiPathNodesByPath.size(); ++i)
+    {
+        TaxiPathNodeList const& nodes = sTaxiPathNodesByPath[i];
+        if (nodes.size() < 2)
+            continue;
+
+        bool singleMap = true;
+        auto points = std::make_shared<Movement::PointsArray>();
+        points->reserve(nodes.size());
+        for (size_t node = 0; node < nodes.size(); ++node)
+        {
+            if (nodes[node]->mapid != nodes[0]->mapid)
+            {
+                singleMap = false;
+                break;
+            }
+            points->push_back({ nodes[node]->x, nodes[node]->y, nodes[node]->z });
+        }
+
+        if (singleMap)
+            sTaxiPathSplinesByPath[i] = std::move(points);
+    }
+
     // Initialize global taxinodes mask
     // include existing nodes that have at least single not spell base (scripted) path
     {
@@ -561,6 +612,12 @@ void LoadDBCStores(const std::string& dataPath)
     // LoadDBC(availableDbcLocales,bar,bad_dbc_files,sWorldMapOverlayStore,     dbcPath,"WorldMapOverlay.dbc");
     // LoadDBC(availableDbcLocales, bar, bad_dbc_files, sWorldSafeLocsStore,       dbcPath, "WorldSafeLocs.dbc");
 
+    if (sDBCPack.IsWriting() && bad_dbc_files.empty())
+    {
+        if (sDBCPack.FinishWrite())
+            sLog.outString("Written preprocessed DBC pack %s", packFileName.c_str());
+    }
+
     // error checks
     if (bad_dbc_files.size() >= DBCFilesCount)
     {
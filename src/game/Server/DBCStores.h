@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Database/DBCStore.h"
 #include "Server/DBCStructure.h"
+#include "Movement/MoveSplineInitArgs.h"
 
 #include <list>
 #include <vector>
@@ -143,6 +144,11 @@ extern DBCStorage <TaxiPathEntry>                sTaxiPathStore;
 extern TaxiMask                                  sTaxiNodesMask;
 extern TaxiPathSetBySource                       sTaxiPathSetBySource;
 extern TaxiPathNodesByPath                       sTaxiPathNodesByPath;
+// immutable spline points baked once per single-map taxi path at DBC load -
+// flights bind these by shared pointer instead of rebuilding the geometry
+typedef std::shared_ptr<Movement::PointsArray const> TaxiPathSplinePtr;
+typedef std::vector<TaxiPathSplinePtr>           TaxiPathSplinesByPath;
+extern TaxiPathSplinesByPath                     sTaxiPathSplinesByPath;
 extern DBCStorage <TransportAnimationEntry>      sTransportAnimationStore;
 extern DBCStorage <WMOAreaTableEntry>            sWMOAreaTableStore;
 // extern DBCStorage <WorldMapAreaEntry>           sWorldMapAreaStore; -- use Zone2MapCoordinates and Map2ZoneCoordinates
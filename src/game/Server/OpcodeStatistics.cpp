@@ -0,0 +1,162 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/OpcodeStatistics.h"
+
+#ifdef BUILD_METRICS
+#include "Metric/Metric.h"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+
+OpcodeStatistics& OpcodeStatistics::instance()
+{
+    static OpcodeStatistics statistics;
+    return statistics;
+}
+
+void OpcodeStatistics::Reset()
+{
+    for (Entry& entry : m_entries)
+    {
+        entry.count.store(0, std::memory_order_relaxed);
+        entry.bytes.store(0, std::memory_order_relaxed);
+        entry.totalNs.store(0, std::memory_order_relaxed);
+        entry.maxNs.store(0, std::memory_order_relaxed);
+    }
+
+    for (auto& byClass : m_latency)
+        for (LatencyHistogram& histogram : byClass)
+            for (auto& bucket : histogram.buckets)
+                bucket.store(0, std::memory_order_relaxed);
+}
+
+std::vector<std::string> OpcodeStatistics::Dump(uint32 rows) const
+{
+    std::vector<uint32> active;
+    for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+        if (m_entries[i].count.load(std::memory_order_relaxed))
+            active.push_back(i);
+
+    std::sort(active.begin(), active.end(), [this](uint32 lhs, uint32 rhs)
+    {
+        return m_entries[lhs].totalNs.load(std::memory_order_relaxed) > m_entries[rhs].totalNs.load(std::memory_order_relaxed);
+    });
+
+    if (active.size() > rows)
+        active.resize(rows);
+
+    std::vector<std::string> lines;
+    lines.push_back("opcode                                    count        kB  total ms   avg us   max us");
+
+    char buf[256];
+    for (uint32 opcode : active)
+    {
+        Entry const& entry = m_entries[opcode];
+        uint64 const count = entry.count.load(std::memory_order_relaxed);
+        uint64 const totalNs = entry.totalNs.load(std::memory_order_relaxed);
+
+        snprintf(buf, sizeof(buf), "%-36s %10llu %9llu %9llu %8llu %8llu",
+                 LookupOpcodeName(uint16(opcode)),
+                 (unsigned long long)count,
+                 (unsigned long long)(entry.bytes.load(std::memory_order_relaxed) / 1024),
+                 (unsigned long long)(totalNs / 1000000),
+                 (unsigned long long)(count ? totalNs / count / 1000 : 0),
+                 (unsigned long long)(entry.maxNs.load(std::memory_order_relaxed) / 1000));
+        lines.push_back(buf);
+    }
+
+    if (active.empty())
+        lines.push_back("no opcodes handled yet");
+
+    return lines;
+}
+
+#ifdef BUILD_METRICS
+void OpcodeStatistics::ReportToMetric()
+{
+    for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+    {
+        uint64 const count = m_entries[i].count.load(std::memory_order_relaxed);
+        if (count == m_reportedCount[i])
+            continue;
+
+        uint64 const bytes = m_entries[i].bytes.load(std::memory_order_relaxed);
+        uint64 const totalNs = m_entries[i].totalNs.load(std::memory_order_relaxed);
+
+        metric::metric::instance().report("opcode_handler",
+        {
+            { "count", static_cast<int64>(count - m_reportedCount[i]) },
+            { "bytes", static_cast<int64>(bytes - m_reportedBytes[i]) },
+            { "duration_ns", static_cast<int64>(totalNs - m_reportedNs[i]) },
+        },
+        { { "opcode", LookupOpcodeName(uint16(i)) } });
+
+        m_reportedCount[i] = count;
+        m_reportedBytes[i] = bytes;
+        m_reportedNs[i] = totalNs;
+    }
+
+    static char const* const classNames[LATENCY_CLASS_COUNT] = { "inplace", "world", "map", "map_thread", "network" };
+    static char const* const kindNames[LATENCY_KIND_COUNT] = { "dwell", "exec" };
+
+    for (uint32 processing = 0; processing < LATENCY_CLASS_COUNT; ++processing)
+    {
+        for (uint32 kind = 0; kind < LATENCY_KIND_COUNT; ++kind)
+        {
+            // interval deltas since the previous report
+            uint64 deltas[LATENCY_BUCKET_COUNT];
+            uint64 total = 0;
+            for (uint32 bucket = 0; bucket < LATENCY_BUCKET_COUNT; ++bucket)
+            {
+                uint64 const value = m_latency[processing][kind].buckets[bucket].load(std::memory_order_relaxed);
+                deltas[bucket] = value - m_reportedLatency[processing][kind][bucket];
+                m_reportedLatency[processing][kind][bucket] = value;
+                total += deltas[bucket];
+            }
+
+            if (!total)
+                continue;
+
+            // percentile = upper bound (in us) of the bucket holding the rank
+            auto percentile = [&](double fraction) -> int64
+            {
+                uint64 const rank = uint64(double(total) * fraction);
+                uint64 cumulative = 0;
+                for (uint32 bucket = 0; bucket < LATENCY_BUCKET_COUNT; ++bucket)
+                {
+                    cumulative += deltas[bucket];
+                    if (cumulative > rank)
+                        return int64(uint64(1) << (bucket + 1)) - 1;
+                }
+                return int64(uint64(1) << LATENCY_BUCKET_COUNT);
+            };
+
+            metric::metric::instance().report("packet_latency",
+            {
+                { "count", static_cast<int64>(total) },
+                { "p50_us", percentile(0.50) },
+                { "p95_us", percentile(0.95) },
+                { "p99_us", percentile(0.99) },
+            },
+            { { "class", classNames[processing] }, { "kind", kindNames[kind] } });
+        }
+    }
+}
+#endif
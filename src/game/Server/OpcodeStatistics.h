@@ -0,0 +1,127 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOSSERVER_OPCODESTATISTICS_H
+#define MANGOSSERVER_OPCODESTATISTICS_H
+
+#include "Common.h"
+#include "Server/Opcodes.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+/**
+ * Per-opcode dispatch counters recorded by WorldSession::ExecuteOpcode.
+ *
+ * Every handled client packet adds its size and handler wall time to the
+ * entry of its opcode; the counters are relaxed atomics so the world thread
+ * and the session update workers aggregate without locking. ".server opcodes"
+ * dumps the heaviest opcodes, and with metrics built in the per-second deltas
+ * are shipped through the metric pipeline.
+ */
+class OpcodeStatistics
+{
+    public:
+        static OpcodeStatistics& instance();
+
+        void Record(uint32 opcode, uint32 bytes, uint64 ns)
+        {
+            if (opcode >= NUM_MSG_TYPES)
+                return;
+
+            Entry& entry = m_entries[opcode];
+            entry.count.fetch_add(1, std::memory_order_relaxed);
+            entry.bytes.fetch_add(bytes, std::memory_order_relaxed);
+            entry.totalNs.fetch_add(ns, std::memory_order_relaxed);
+
+            uint64 prev = entry.maxNs.load(std::memory_order_relaxed);
+            while (ns > prev && !entry.maxNs.compare_exchange_weak(prev, ns, std::memory_order_relaxed))
+                ;
+        }
+
+        // round-trip decomposition recorded per packet processing class: the
+        // dwell time a packet spent queued between socket read and handler
+        // start, and the handler execution time. Power-of-two microsecond
+        // buckets (HDR-style) allow interval percentiles without per-sample
+        // storage; the processing class identifies the queue the packet
+        // dwelled in (world tick, map tick, network thread, ...)
+        enum LatencyKind
+        {
+            LATENCY_DWELL = 0,
+            LATENCY_EXEC  = 1,
+            LATENCY_KIND_COUNT
+        };
+
+        static uint32 const LATENCY_CLASS_COUNT = PROCESS_IMMEDIATE + 1;
+        static uint32 const LATENCY_BUCKET_COUNT = 24;      // [0,1] us doubling up to ~8.4 s, last bucket overflow
+
+        void RecordLatency(uint32 processing, LatencyKind kind, uint64 ns)
+        {
+            if (processing >= LATENCY_CLASS_COUNT)
+                return;
+
+            uint32 bucket = 0;
+            for (uint64 value = ns / 1000; value > 1 && bucket < LATENCY_BUCKET_COUNT - 1; value >>= 1)
+                ++bucket;
+            m_latency[processing][kind].buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Reset();
+
+        // heaviest opcodes by cumulative handler time, formatted for chat/console output
+        std::vector<std::string> Dump(uint32 rows) const;
+
+#ifdef BUILD_METRICS
+        // ship the activity since the previous call through the metric pipeline;
+        // must only be called from the world thread
+        void ReportToMetric();
+#endif
+
+    private:
+        struct Entry
+        {
+            std::atomic<uint64> count{0};
+            std::atomic<uint64> bytes{0};
+            std::atomic<uint64> totalNs{0};
+            std::atomic<uint64> maxNs{0};
+        };
+
+        struct LatencyHistogram
+        {
+            LatencyHistogram()
+            {
+                for (auto& bucket : buckets)
+                    bucket.store(0, std::memory_order_relaxed);
+            }
+
+            std::atomic<uint64> buckets[LATENCY_BUCKET_COUNT];
+        };
+
+        Entry m_entries[NUM_MSG_TYPES];
+        LatencyHistogram m_latency[LATENCY_CLASS_COUNT][LATENCY_KIND_COUNT];
+
+#ifdef BUILD_METRICS
+        uint64 m_reportedCount[NUM_MSG_TYPES] = {};
+        uint64 m_reportedBytes[NUM_MSG_TYPES] = {};
+        uint64 m_reportedNs[NUM_MSG_TYPES] = {};
+        uint64 m_reportedLatency[LATENCY_CLASS_COUNT][LATENCY_KIND_COUNT][LATENCY_BUCKET_COUNT] = {};
+#endif
+};
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_PACKETLAYOUTS_H
+#define MANGOS_PACKETLAYOUTS_H
+
+#include "Server/Opcodes.h"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Compile-time wire layout declarations for fixed-layout client opcodes.
+ *
+ * A layout lists the field types of a packet's fixed prefix in wire order;
+ * the minimum wire size is computed constexpr and collected into the
+ * ClientPacketMinSize table below. ExecuteOpcode checks it once before
+ * dispatch, so handlers of declared opcodes never unwind through a
+ * ByteBufferException on truncated input - the per-field runtime checks
+ * remain only as a second line of defence. Declared here are the
+ * highest-frequency opcodes: movement, speed/state acks, casts, item use
+ * and the common queries.
+ */
+
+// wire size of one field; nested layouts contribute their own MinSize
+template <typename T, typename = void>
+struct WireSize { static constexpr size_t value = sizeof(T); };
+
+template <typename T>
+struct WireSize<T, std::void_t<decltype(T::MinSize)>> { static constexpr size_t value = T::MinSize; };
+
+template <typename... Fields>
+struct PacketLayout
+{
+    static_assert((std::is_trivially_copyable<Fields>::value && ...), "packet fields must be trivially copyable wire types");
+    static constexpr size_t MinSize = (WireSize<Fields>::value + ... + 0);
+};
+
+// fixed prefix of the client MovementInfo: move flags, client time, x, y, z, o
+// (transport, swim pitch and fall data follow depending on the flags)
+struct MovementInfoLayout : PacketLayout<uint32, uint32, float, float, float, float> {};
+static_assert(MovementInfoLayout::MinSize == 24, "client MovementInfo prefix is 24 bytes on the wire");
+
+// spell cast targets: target mask, then guids/positions depending on the mask
+struct SpellCastTargetsLayout : PacketLayout<uint16> {};
+
+// movement change ack: mover guid, order counter, movement info
+struct MovementAckLayout : PacketLayout<uint64, uint32, MovementInfoLayout> {};
+
+// default: no layout declared, no upfront bounds check
+template <uint32 OpcodeValue>
+struct ClientPacketLayout : PacketLayout<> {};
+
+// movement state changes - MovementInfo only, no guid from a 1.12 client
+template <> struct ClientPacketLayout<MSG_MOVE_START_FORWARD>       : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_BACKWARD>      : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_STOP>                : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_STRAFE_LEFT>   : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_STRAFE_RIGHT>  : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_STOP_STRAFE>         : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_JUMP>                : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_TURN_LEFT>     : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_TURN_RIGHT>    : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_STOP_TURN>           : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_PITCH_UP>      : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_PITCH_DOWN>    : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_STOP_PITCH>          : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_SET_RUN_MODE>        : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_SET_WALK_MODE>       : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_FALL_LAND>           : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_START_SWIM>          : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_STOP_SWIM>           : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_SET_FACING>          : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_SET_PITCH>           : MovementInfoLayout {};
+template <> struct ClientPacketLayout<MSG_MOVE_HEARTBEAT>           : MovementInfoLayout {};
+
+// speed / move flag change acks
+template <> struct ClientPacketLayout<CMSG_FORCE_RUN_SPEED_CHANGE_ACK>      : PacketLayout<MovementAckLayout, float> {};
+template <> struct ClientPacketLayout<CMSG_FORCE_RUN_BACK_SPEED_CHANGE_ACK> : PacketLayout<MovementAckLayout, float> {};
+template <> struct ClientPacketLayout<CMSG_FORCE_SWIM_SPEED_CHANGE_ACK>     : PacketLayout<MovementAckLayout, float> {};
+template <> struct ClientPacketLayout<CMSG_FORCE_MOVE_ROOT_ACK>             : MovementAckLayout {};
+template <> struct ClientPacketLayout<CMSG_FORCE_MOVE_UNROOT_ACK>           : MovementAckLayout {};
+template <> struct ClientPacketLayout<CMSG_MOVE_KNOCK_BACK_ACK>             : MovementAckLayout {};
+template <> struct ClientPacketLayout<CMSG_MOVE_HOVER_ACK>                  : PacketLayout<MovementAckLayout, uint32> {};
+template <> struct ClientPacketLayout<CMSG_MOVE_WATER_WALK_ACK>             : PacketLayout<MovementAckLayout, uint32> {};
+
+// combat and casts
+template <> struct ClientPacketLayout<CMSG_CAST_SPELL>        : PacketLayout<uint32, SpellCastTargetsLayout> {};
+template <> struct ClientPacketLayout<CMSG_CANCEL_CAST>       : PacketLayout<uint32> {};
+template <> struct ClientPacketLayout<CMSG_CANCEL_AURA>       : PacketLayout<uint32> {};
+template <> struct ClientPacketLayout<CMSG_USE_ITEM>          : PacketLayout<uint8, uint8, uint8> {};
+template <> struct ClientPacketLayout<CMSG_ATTACKSWING>       : PacketLayout<uint64> {};
+template <> struct ClientPacketLayout<CMSG_SET_SELECTION>     : PacketLayout<uint64> {};
+template <> struct ClientPacketLayout<CMSG_STANDSTATECHANGE>  : PacketLayout<uint32> {};
+template <> struct ClientPacketLayout<CMSG_SETSHEATHED>       : PacketLayout<uint32> {};
+
+// session / mover bookkeeping
+template <> struct ClientPacketLayout<CMSG_SET_ACTIVE_MOVER>  : PacketLayout<uint64> {};
+template <> struct ClientPacketLayout<CMSG_MOVE_TIME_SKIPPED> : PacketLayout<uint64, uint32> {};
+
+// common queries
+template <> struct ClientPacketLayout<CMSG_NAME_QUERY>        : PacketLayout<uint64> {};
+template <> struct ClientPacketLayout<CMSG_CREATURE_QUERY>    : PacketLayout<uint32, uint64> {};
+template <> struct ClientPacketLayout<CMSG_GAMEOBJECT_QUERY>  : PacketLayout<uint32, uint64> {};
+template <> struct ClientPacketLayout<CMSG_ITEM_QUERY_SINGLE> : PacketLayout<uint32, uint64> {};
+
+namespace PacketLayoutDetail
+{
+    template <size_t... Opcodes>
+    constexpr std::array<uint16, sizeof...(Opcodes)> BuildMinSizeTable(std::index_sequence<Opcodes...>)
+    {
+        return {{ uint16(ClientPacketLayout<Opcodes>::MinSize)... }};
+    }
+}
+
+// minimum wire size per opcode, 0 where no layout is declared
+inline constexpr std::array<uint16, NUM_MSG_TYPES> ClientPacketMinSize =
+    PacketLayoutDetail::BuildMinSizeTable(std::make_index_sequence<NUM_MSG_TYPES>{});
+
+#endif
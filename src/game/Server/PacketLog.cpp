@@ -57,7 +57,7 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(nullptr)
+PacketLog::PacketLog() : _file(nullptr), _captureFile(nullptr), _captureTick(0)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
 }
@@ -68,6 +68,11 @@ PacketLog::~PacketLog()
         fclose(_file);
 
     _file = nullptr;
+
+    if (_captureFile)
+        fclose(_captureFile);
+
+    _captureFile = nullptr;
 }
 
 PacketLog* PacketLog::instance()
@@ -117,6 +122,74 @@ void PacketLog::Reinitialize()
     Initialize();
 }
 
+bool PacketLog::InitializeReplayCapture(uint32 randSeed)
+{
+    static uint32 buildVersion[] = EXPECTED_MANGOSD_CLIENT_BUILD;
+    std::string logsDir = sConfig.GetStringDefault("LogsDir", "");
+
+    if (!logsDir.empty())
+        if ((logsDir.at(logsDir.length() - 1) != '/') && (logsDir.at(logsDir.length() - 1) != '\\'))
+            logsDir.push_back('/');
+
+    std::string captureName = sConfig.GetStringDefault("ReplayCaptureFile", "");
+    if (captureName.empty())
+        return false;
+
+    _captureFile = fopen((logsDir + captureName).c_str(), "wb");
+    if (!_captureFile)
+        return false;
+
+    ReplayCaptureHeader header;
+    header.Signature[0] = 'W'; header.Signature[1] = 'T'; header.Signature[2] = 'C';
+    header.FormatVersion = REPLAY_CAPTURE_VERSION;
+    header.Build = buildVersion[0];
+    header.StartUnixtime = uint32(time(nullptr));
+    header.StartMSTime = WorldTimer::getMSTime();
+    header.RandSeed = randSeed;
+
+    fwrite(&header, sizeof(header), 1, _captureFile);
+    return true;
+}
+
+void PacketLog::CaptureTick(uint32 diff)
+{
+    std::lock_guard<std::mutex> lock(_captureLock);
+    if (!_captureFile)
+        return;
+
+    ReplayTickRecord record;
+    record.Tick = ++_captureTick;
+    record.Diff = diff;
+    record.MSTime = WorldTimer::getMSTime();
+
+    uint8 const type = REPLAY_REC_TICK;
+    fwrite(&type, sizeof(type), 1, _captureFile);
+    fwrite(&record, sizeof(record), 1, _captureFile);
+
+    // one flush per tick keeps the stream usable after a crash without
+    // paying for a flush on every packet
+    fflush(_captureFile);
+}
+
+void PacketLog::CaptureClientPacket(WorldPacket const& packet, uint32 playerGuidLow)
+{
+    std::lock_guard<std::mutex> lock(_captureLock);
+    if (!_captureFile)
+        return;
+
+    ReplayPacketRecord record;
+    record.Tick = _captureTick;
+    record.PlayerGuidLow = playerGuidLow;
+    record.Opcode = uint16(packet.GetOpcode());
+    record.Size = packet.size();
+
+    uint8 const type = REPLAY_REC_PACKET;
+    fwrite(&type, sizeof(type), 1, _captureFile);
+    fwrite(&record, sizeof(record), 1, _captureFile);
+    if (!packet.empty())
+        fwrite(packet.contents(), 1, packet.size(), _captureFile);
+}
+
 void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port)
 {
     std::lock_guard<std::mutex> lock(_logPacketLock);
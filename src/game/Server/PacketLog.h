@@ -29,6 +29,48 @@ enum Direction
     SERVER_TO_CLIENT
 };
 
+// Replay capture stream (ReplayCaptureFile / mangosd --replay): a compact
+// binary record of everything the world executed per tick - tick markers with
+// the tick duration, and every client packet that reached a handler together
+// with the owning character - so a live-only tick spike can be re-run as a
+// workload against a database snapshot. See ReplayMgr for the consumer.
+#pragma pack(push, 1)
+
+struct ReplayCaptureHeader
+{
+    char Signature[3];                                      // "WTC"
+    uint16 FormatVersion;
+    uint32 Build;
+    uint32 StartUnixtime;
+    uint32 StartMSTime;
+    uint32 RandSeed;                                        // srand seed of the captured process
+};
+
+struct ReplayTickRecord
+{
+    uint32 Tick;
+    uint32 Diff;                                            // duration of the previous tick, ms
+    uint32 MSTime;
+};
+
+struct ReplayPacketRecord
+{
+    uint32 Tick;
+    uint32 PlayerGuidLow;                                   // character the session owned at execution
+    uint16 Opcode;
+    uint32 Size;                                            // payload bytes following this record
+};
+
+#pragma pack(pop)
+
+enum ReplayRecordType : uint8
+{
+    REPLAY_REC_TICK   = 0,
+    REPLAY_REC_PACKET = 1,
+};
+
+uint16 const REPLAY_CAPTURE_VERSION = 1;
+
 class WorldPacket;
 
 class PacketLog
@@ -47,8 +89,21 @@ class PacketLog
         bool CanLogPacket() const { return (_file != nullptr); }
         void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port);
 
+        // opens ReplayCaptureFile and writes the capture header; called once
+        // from the world thread when the world goes live
+        bool InitializeReplayCapture(uint32 randSeed);
+        bool CanCaptureReplay() const { return (_captureFile != nullptr); }
+        // world thread, once per World::Update: advances the capture tick
+        void CaptureTick(uint32 diff);
+        // session update threads: records a client packet about to be executed
+        void CaptureClientPacket(WorldPacket const& packet, uint32 playerGuidLow);
+
     private:
         FILE* _file;
+
+        std::mutex _captureLock;
+        FILE* _captureFile;
+        uint32 _captureTick;
 };
 
 #define sPacketLog PacketLog::instance()
@@ -0,0 +1,218 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/PacketRateLimiter.h"
+#include "Server/Opcodes.h"
+#include "Server/WorldPacket.h"
+#include "Globals/SharedDefines.h"
+#include "World/World.h"
+
+#ifdef BUILD_METRICS
+#include "Metric/Metric.h"
+#endif
+
+std::mutex PacketRateLimiter::s_accountStrikeLock;
+std::unordered_map<uint32, uint32> PacketRateLimiter::s_accountStrikes;
+
+std::atomic<uint64> PacketRateLimiter::s_violationCount[MAX_PACKET_RATE_CLASS];
+std::atomic<uint64> PacketRateLimiter::s_disconnectCount(0);
+std::atomic<uint64> PacketRateLimiter::s_banCount(0);
+#ifdef BUILD_METRICS
+uint64 PacketRateLimiter::s_reportedViolations[MAX_PACKET_RATE_CLASS] = {};
+uint64 PacketRateLimiter::s_reportedDisconnects = 0;
+uint64 PacketRateLimiter::s_reportedBans = 0;
+#endif
+
+PacketRateLimiter::PacketRateLimiter() : m_violations(0)
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.tokens = -1.f;                               // filled to the burst allowance on first use
+        bucket.lastRefill = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
+    }
+}
+
+PacketRateClass PacketRateLimiter::Classify(uint16 opcode)
+{
+    // the client movement block is contiguous in 1.12
+    if (opcode >= MSG_MOVE_START_FORWARD && opcode <= MSG_MOVE_HEARTBEAT)
+        return PACKET_RATE_CLASS_MOVEMENT;
+
+    switch (opcode)
+    {
+        case CMSG_MOVE_FALL_RESET:
+        case CMSG_MOVE_TIME_SKIPPED:
+            return PACKET_RATE_CLASS_MOVEMENT;
+        case CMSG_MESSAGECHAT:
+        case CMSG_TEXT_EMOTE:
+        case CMSG_EMOTE:
+            return PACKET_RATE_CLASS_CHAT;
+        case CMSG_NAME_QUERY:
+        case CMSG_GUILD_QUERY:
+        case CMSG_ITEM_QUERY_SINGLE:
+        case CMSG_PAGE_TEXT_QUERY:
+        case CMSG_QUEST_QUERY:
+        case CMSG_GAMEOBJECT_QUERY:
+        case CMSG_CREATURE_QUERY:
+        case CMSG_PETITION_QUERY:
+        case CMSG_PET_NAME_QUERY:
+        case CMSG_WHO:
+        case CMSG_WHOIS:
+        case CMSG_INSPECT:
+        case CMSG_AUCTION_LIST_ITEMS:
+        case CMSG_AUCTION_LIST_OWNER_ITEMS:
+        case CMSG_AUCTION_LIST_BIDDER_ITEMS:
+        case MSG_AUCTION_HELLO:
+        case CMSG_GET_MAIL_LIST:
+            return PACKET_RATE_CLASS_QUERY;
+        default:
+            return PACKET_RATE_CLASS_OTHER;
+    }
+}
+
+PacketRateClass PacketRateLimiter::Classify(WorldPacket const& packet)
+{
+    // addon sync traffic (DBM, BigWigs and friends) is our single
+    // highest-volume chat opcode during raids; peek the language field so it
+    // fills its own bucket instead of draining the player chat budget. The
+    // payload starts with type and lang as consecutive uint32s.
+    if (packet.GetOpcode() == CMSG_MESSAGECHAT && packet.size() >= 8 && packet.read<uint32>(4) == LANG_ADDON)
+        return PACKET_RATE_CLASS_ADDON;
+
+    return Classify(uint16(packet.GetOpcode()));
+}
+
+char const* PacketRateLimiter::ClassName(PacketRateClass rateClass)
+{
+    switch (rateClass)
+    {
+        case PACKET_RATE_CLASS_MOVEMENT: return "movement";
+        case PACKET_RATE_CLASS_CHAT:     return "chat";
+        case PACKET_RATE_CLASS_ADDON:    return "addon";
+        case PACKET_RATE_CLASS_QUERY:    return "query";
+        default:                         return "other";
+    }
+}
+
+bool PacketRateLimiter::Allow(WorldPacket const& packet)
+{
+    if (!sWorld.getConfig(CONFIG_BOOL_PACKET_RATE_LIMIT))
+        return true;
+
+    static eConfigUInt32Values const rateConfig[MAX_PACKET_RATE_CLASS] =
+    {
+        CONFIG_UINT32_PACKET_RATE_LIMIT_MOVEMENT_RATE,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_CHAT_RATE,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_ADDON_RATE,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_QUERY_RATE,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_OTHER_RATE,
+    };
+    static eConfigUInt32Values const burstConfig[MAX_PACKET_RATE_CLASS] =
+    {
+        CONFIG_UINT32_PACKET_RATE_LIMIT_MOVEMENT_BURST,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_CHAT_BURST,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_ADDON_BURST,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_QUERY_BURST,
+        CONFIG_UINT32_PACKET_RATE_LIMIT_OTHER_BURST,
+    };
+
+    PacketRateClass const rateClass = Classify(packet);
+    uint32 const rate = sWorld.getConfig(rateConfig[rateClass]);
+    if (!rate)                                              // class not limited
+        return true;
+
+    float const burst = float(std::max(sWorld.getConfig(burstConfig[rateClass]), rate));
+
+    TokenBucket& bucket = m_buckets[rateClass];
+    TimePoint const now = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
+
+    if (bucket.tokens < 0.f)
+        bucket.tokens = burst;
+    else
+    {
+        uint64 const elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - bucket.lastRefill).count();
+        bucket.tokens = std::min(burst, bucket.tokens + float(rate) * float(elapsedMs) / float(IN_MILLISECONDS));
+    }
+    bucket.lastRefill = now;
+
+    if (bucket.tokens >= 1.f)
+    {
+        bucket.tokens -= 1.f;
+        return true;
+    }
+
+    ++m_violations;
+    s_violationCount[rateClass].fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool PacketRateLimiter::ShouldDisconnect() const
+{
+    uint32 const threshold = sWorld.getConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_DISCONNECT_THRESHOLD);
+    return threshold && m_violations >= threshold;
+}
+
+bool PacketRateLimiter::RegisterDisconnect(uint32 accountId)
+{
+    s_disconnectCount.fetch_add(1, std::memory_order_relaxed);
+
+    uint32 const banStrikes = sWorld.getConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_BAN_STRIKES);
+    if (!banStrikes)
+        return false;
+
+    std::lock_guard<std::mutex> guard(s_accountStrikeLock);
+    uint32& strikes = s_accountStrikes[accountId];
+    if (++strikes < banStrikes)
+        return false;
+
+    strikes = 0;
+    s_banCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+#ifdef BUILD_METRICS
+void PacketRateLimiter::ReportToMetric()
+{
+    for (uint32 i = 0; i < MAX_PACKET_RATE_CLASS; ++i)
+    {
+        uint64 const count = s_violationCount[i].load(std::memory_order_relaxed);
+        if (count == s_reportedViolations[i])
+            continue;
+
+        metric::metric::instance().report("packet_rate_limit",
+            "violations", static_cast<int64>(count - s_reportedViolations[i]),
+            { { "class", ClassName(PacketRateClass(i)) } });
+
+        s_reportedViolations[i] = count;
+    }
+
+    uint64 const disconnects = s_disconnectCount.load(std::memory_order_relaxed);
+    uint64 const bans = s_banCount.load(std::memory_order_relaxed);
+    if (disconnects != s_reportedDisconnects || bans != s_reportedBans)
+    {
+        metric::metric::instance().report("packet_rate_limit",
+        {
+            { "disconnects", static_cast<int64>(disconnects - s_reportedDisconnects) },
+            { "bans", static_cast<int64>(bans - s_reportedBans) },
+        }, {});
+
+        s_reportedDisconnects = disconnects;
+        s_reportedBans = bans;
+    }
+}
+#endif
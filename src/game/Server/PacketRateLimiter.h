@@ -0,0 +1,111 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOSSERVER_PACKETRATELIMITER_H
+#define MANGOSSERVER_PACKETRATELIMITER_H
+
+#include "Common.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+// buckets group client opcodes by handling cost rather than by meaning: a
+// flood of cheap movement packets needs a far larger budget than a flood of
+// DB-backed queries to do comparable damage
+enum PacketRateClass
+{
+    PACKET_RATE_CLASS_MOVEMENT = 0,                         // high frequency and cheap to handle
+    PACKET_RATE_CLASS_CHAT,
+    PACKET_RATE_CLASS_ADDON,                                // LANG_ADDON chat - DBM/BigWigs sync, far chattier than players
+    PACKET_RATE_CLASS_QUERY,                                // lookups and listings, expensive per packet
+    PACKET_RATE_CLASS_OTHER,
+    MAX_PACKET_RATE_CLASS
+};
+
+class WorldPacket;
+
+/**
+ * Per-socket token buckets applied in WorldSocket::ProcessIncomingData before
+ * a client packet is queued to its session, so a flooding client is paid for
+ * on the network thread instead of inside WorldSession::Update.
+ *
+ * Each opcode class refills tokens at a configured per-second rate up to a
+ * burst allowance; a packet arriving with an empty bucket is dropped and
+ * counted as a violation. Escalation: once a connection accumulates the
+ * configured violation count it is disconnected, and an account collecting
+ * enough of those disconnects is temp-banned through the regular ban path.
+ * Violation counters are shipped through the metric pipeline next to the
+ * opcode statistics.
+ *
+ * The buckets run on the socket's service context and need no locking; only
+ * the account strike registry and the metric counters are shared.
+ */
+class PacketRateLimiter
+{
+    public:
+        PacketRateLimiter();
+
+        // consume a token for the packet's class; false when the bucket is
+        // empty - the caller drops the packet
+        bool Allow(WorldPacket const& packet);
+
+        // this connection collected enough violations to be disconnected
+        bool ShouldDisconnect() const;
+
+        uint32 GetViolations() const { return m_violations; }
+
+        static PacketRateClass Classify(uint16 opcode);
+        // payload-aware variant: routes LANG_ADDON chat into its own bucket
+        static PacketRateClass Classify(WorldPacket const& packet);
+        static char const* ClassName(PacketRateClass rateClass);
+
+        // account strike after a rate-limit disconnect; true once the account
+        // crossed the temp-ban threshold (the strike count is then reset)
+        static bool RegisterDisconnect(uint32 accountId);
+
+#ifdef BUILD_METRICS
+        // ship violation deltas since the previous call through the metric
+        // pipeline; must only be called from the world thread
+        static void ReportToMetric();
+#endif
+
+    private:
+        struct TokenBucket
+        {
+            float tokens;
+            TimePoint lastRefill;
+        };
+
+        TokenBucket m_buckets[MAX_PACKET_RATE_CLASS];
+        uint32 m_violations;
+
+        static std::mutex s_accountStrikeLock;
+        static std::unordered_map<uint32, uint32> s_accountStrikes;
+
+        static std::atomic<uint64> s_violationCount[MAX_PACKET_RATE_CLASS];
+        static std::atomic<uint64> s_disconnectCount;
+        static std::atomic<uint64> s_banCount;
+#ifdef BUILD_METRICS
+        static uint64 s_reportedViolations[MAX_PACKET_RATE_CLASS];
+        static uint64 s_reportedDisconnects;
+        static uint64 s_reportedBans;
+#endif
+};
+
+#endif
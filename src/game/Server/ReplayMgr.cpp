@@ -0,0 +1,226 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/ReplayMgr.h"
+#include "Server/PacketLog.h"
+#include "Server/WorldSession.h"
+#include "Server/WorldPacket.h"
+#include "Server/Opcodes.h"
+#include "World/World.h"
+#include "Entities/Player.h"
+#include "Globals/SharedDefines.h"
+
+#define CLASS_LOCK MaNGOS::ClassLevelLockable<ReplayMgr, std::mutex>
+INSTANTIATE_SINGLETON_2(ReplayMgr, CLASS_LOCK);
+INSTANTIATE_CLASS_MUTEX(ReplayMgr, std::mutex);
+
+namespace
+{
+    // how long to wait for the replay sessions to finish logging in before
+    // starting the tick cursor anyway
+    uint32 const REPLAY_LOGIN_GRACE = 30 * IN_MILLISECONDS;
+}
+
+ReplayMgr::ReplayMgr() : m_active(false), m_cursorTick(0), m_lastTick(0), m_injected(0), m_dropped(0), m_loginGraceTimer(0)
+{
+}
+
+ReplayMgr::~ReplayMgr() = default;
+
+bool ReplayMgr::LoadCapture()
+{
+    FILE* file = fopen(m_fileName.c_str(), "rb");
+    if (!file)
+    {
+        sLog.outError("Replay: cannot open capture file %s", m_fileName.c_str());
+        return false;
+    }
+
+    ReplayCaptureHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        header.Signature[0] != 'W' || header.Signature[1] != 'T' || header.Signature[2] != 'C')
+    {
+        sLog.outError("Replay: %s is not a replay capture", m_fileName.c_str());
+        fclose(file);
+        return false;
+    }
+
+    if (header.FormatVersion != REPLAY_CAPTURE_VERSION)
+    {
+        sLog.outError("Replay: capture format version %u not supported (expected %u)", header.FormatVersion, REPLAY_CAPTURE_VERSION);
+        fclose(file);
+        return false;
+    }
+
+    static uint32 buildVersion[] = EXPECTED_MANGOSD_CLIENT_BUILD;
+    if (header.Build != buildVersion[0])
+        sLog.outError("Replay: capture was taken on build %u, this is build %u - results may differ", header.Build, buildVersion[0]);
+
+    // reproduce at least the libc RNG sequence of the captured process
+    srand(header.RandSeed);
+
+    uint32 packets = 0;
+    for (;;)
+    {
+        uint8 type;
+        if (fread(&type, sizeof(type), 1, file) != 1)
+            break;                                          // clean end of stream
+
+        if (type == REPLAY_REC_TICK)
+        {
+            ReplayTickRecord record;
+            if (fread(&record, sizeof(record), 1, file) != 1)
+                break;                                      // torn tail from a crash, stop here
+
+            m_lastTick = record.Tick;
+        }
+        else if (type == REPLAY_REC_PACKET)
+        {
+            ReplayPacketRecord record;
+            if (fread(&record, sizeof(record), 1, file) != 1)
+                break;
+
+            // client packet sizes are bounded by the 16 bit wire header
+            if (record.Opcode >= NUM_MSG_TYPES || record.Size > 0xFFFF)
+            {
+                sLog.outError("Replay: corrupted packet record (opcode %u, size %u), stopping at tick %u", record.Opcode, record.Size, record.Tick);
+                break;
+            }
+
+            auto packet = std::make_unique<WorldPacket>(Opcodes(record.Opcode), record.Size);
+            if (record.Size)
+            {
+                std::vector<uint8> payload(record.Size);
+                if (fread(payload.data(), 1, record.Size, file) != record.Size)
+                    break;
+
+                packet->append(payload.data(), record.Size);
+            }
+
+            m_characters.insert(record.PlayerGuidLow);
+            m_packets[record.Tick].push_back({ record.PlayerGuidLow, std::move(packet) });
+            ++packets;
+        }
+        else
+        {
+            sLog.outError("Replay: unknown record type %u, stopping", type);
+            break;
+        }
+    }
+
+    fclose(file);
+
+    sLog.outString("Replay: loaded %u packets over %u ticks for %u characters from %s",
+        packets, m_lastTick, uint32(m_characters.size()), m_fileName.c_str());
+    return m_lastTick != 0;
+}
+
+void ReplayMgr::Start()
+{
+    if (!IsConfigured() || m_active)
+        return;
+
+    sLog.outString("Replay: THIS IS A REPLAY RUN - point the databases at a snapshot, character state will be consumed");
+
+    if (!LoadCapture())
+        return;
+
+    for (uint32 guidLow : m_characters)
+        LoginReplaySession(ObjectGuid(HIGHGUID_PLAYER, guidLow));
+
+    m_active = true;
+}
+
+void ReplayMgr::Stop()
+{
+    if (!m_active)
+        return;
+
+    for (auto& itr : m_sessions)
+    {
+        itr.second->LogoutPlayer();
+        delete itr.second;
+    }
+    m_sessions.clear();
+    m_packets.clear();
+    m_active = false;
+}
+
+void ReplayMgr::OnSessionLogin(WorldSession* session)
+{
+    m_sessions[session->GetPlayer()->GetGUIDLow()] = session;
+    sLog.outDetail("Replay: character %u logged in (%u of %u)",
+        session->GetPlayer()->GetGUIDLow(), uint32(m_sessions.size()), uint32(m_characters.size()));
+}
+
+void ReplayMgr::Update(uint32 diff)
+{
+    if (!m_active)
+        return;
+
+    // hold the cursor until the captured characters are in the world - login
+    // failures (characters missing from the snapshot) only cost the grace
+    bool const consuming = m_cursorTick || m_sessions.size() >= m_characters.size() || m_loginGraceTimer >= REPLAY_LOGIN_GRACE;
+    if (!consuming)
+        m_loginGraceTimer += diff;
+
+    if (consuming)
+    {
+        ++m_cursorTick;
+
+        auto tickItr = m_packets.find(m_cursorTick);
+        if (tickItr != m_packets.end())
+        {
+            for (CapturedPacket& captured : tickItr->second)
+            {
+                auto sessionItr = m_sessions.find(captured.playerGuidLow);
+                if (sessionItr != m_sessions.end() && sessionItr->second->GetPlayer() && sessionItr->second->GetPlayer()->IsInWorld())
+                {
+                    sessionItr->second->QueuePacket(std::move(captured.packet));
+                    ++m_injected;
+                }
+                else
+                    ++m_dropped;
+            }
+            m_packets.erase(tickItr);
+        }
+    }
+
+    for (auto itr = m_sessions.begin(); itr != m_sessions.end();)
+    {
+        WorldSession* session = itr->second;
+        if (!session->GetPlayer())
+        {
+            // login failed or the character got logged out from under us
+            delete session;
+            itr = m_sessions.erase(itr);
+            continue;
+        }
+
+        // replay sessions are not in the world's session map - drain their
+        // queues here the same way bot sessions are drained
+        session->HandleBotPackets();
+        ++itr;
+    }
+
+    if (consuming && m_cursorTick >= m_lastTick)
+    {
+        sLog.outString("Replay: finished - %u packets injected, %u dropped over %u ticks", m_injected, m_dropped, m_lastTick);
+        Stop();
+    }
+}
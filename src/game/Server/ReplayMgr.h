@@ -0,0 +1,98 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_REPLAY_MGR_H
+#define MANGOS_REPLAY_MGR_H
+
+#include "Platform/Define.h"
+#include "Policies/Singleton.h"
+#include "Entities/ObjectGuid.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+class WorldSession;
+class WorldPacket;
+
+/**
+ * Consumer of the replay capture stream written by PacketLog
+ * (ReplayCaptureFile): mangosd --replay <file> logs the captured characters
+ * in on socketless sessions (the stress-test/bot mechanism), then re-queues
+ * every captured client packet on the world tick it originally executed on,
+ * driving the full packet handling, movement and visibility paths with the
+ * recorded workload. Run it against a database snapshot taken near the
+ * capture so the characters exist in the recorded state - a live-only tick
+ * spike becomes an artifact that can be replayed under a profiler.
+ *
+ * Replay is paced by the live tick rate, one captured tick per world tick;
+ * it reproduces the recorded load and ordering, not a bit-exact simulation
+ * (handlers still see current time and shared RNG state).
+ */
+class ReplayMgr : public MaNGOS::Singleton<ReplayMgr, MaNGOS::ClassLevelLockable<ReplayMgr, std::mutex> >
+{
+    public:
+        ReplayMgr();
+        ~ReplayMgr();                                       // out of line: members hold unique_ptr<WorldPacket>
+
+        // set from the --replay command line option before the world loads
+        void SetFileName(std::string const& name) { m_fileName = name; }
+        bool IsConfigured() const { return !m_fileName.empty(); }
+
+        // loads the capture and logs in the captured characters
+        void Start();
+        // logs out and destroys all replay sessions
+        void Stop();
+
+        void Update(uint32 diff);
+        bool IsActive() const { return m_active; }
+
+        // called from the login query callback once the character is loaded
+        void OnSessionLogin(WorldSession* session);
+
+    private:
+        // implemented in CharacterHandler.cpp next to the other login paths
+        // (needs the file-local LoginQueryHolder)
+        void LoginReplaySession(ObjectGuid playerGuid);
+
+        bool LoadCapture();
+
+        bool m_active;
+        std::string m_fileName;
+
+        struct CapturedPacket
+        {
+            uint32 playerGuidLow;
+            std::unique_ptr<WorldPacket> packet;
+        };
+
+        std::map<uint32, std::vector<CapturedPacket>> m_packets; // capture tick -> packets executed on it
+        std::set<uint32> m_characters;                      // distinct captured character guids
+        std::map<uint32, WorldSession*> m_sessions;         // character guid low -> replay session
+
+        uint32 m_cursorTick;
+        uint32 m_lastTick;
+        uint32 m_injected;
+        uint32 m_dropped;
+        uint32 m_loginGraceTimer;
+};
+
+#define sReplayMgr MaNGOS::Singleton<ReplayMgr>::Instance()
+
+#endif
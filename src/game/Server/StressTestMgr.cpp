@@ -0,0 +1,221 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/StressTestMgr.h"
+#include "Server/WorldSession.h"
+#include "World/World.h"
+#include "Entities/Player.h"
+#include "Maps/GridDefines.h"
+#include "Database/DatabaseEnv.h"
+#include "Util/Timer.h"
+
+#ifdef BUILD_METRICS
+ #include "Metric/Metric.h"
+#endif
+
+#include <algorithm>
+
+#define CLASS_LOCK MaNGOS::ClassLevelLockable<StressTestMgr, std::mutex>
+INSTANTIATE_SINGLETON_2(StressTestMgr, CLASS_LOCK);
+INSTANTIATE_CLASS_MUTEX(StressTestMgr, std::mutex);
+
+namespace
+{
+    uint32 const STRESS_REPORT_INTERVAL = 10 * IN_MILLISECONDS;
+}
+
+void StressTestMgr::Start()
+{
+    uint32 const count = sWorld.getConfig(CONFIG_UINT32_STRESS_TEST_SESSIONS);
+    if (!count || m_active)
+        return;
+
+    sLog.outString("StressTest: logging in up to %u synthetic sessions - THIS IS A LOAD TEST MODE, not for live realms", count);
+
+    auto queryResult = CharacterDatabase.PQuery("SELECT guid FROM characters ORDER BY guid LIMIT %u", count);
+    if (!queryResult)
+    {
+        sLog.outError("StressTest: no characters found, harness not started");
+        return;
+    }
+
+    do
+    {
+        Field* fields = queryResult->Fetch();
+        LoginStressSession(ObjectGuid(HIGHGUID_PLAYER, fields[0].GetUInt32()));
+    }
+    while (queryResult->NextRow());
+
+    m_active = true;
+}
+
+void StressTestMgr::Stop()
+{
+    if (!m_active)
+        return;
+
+    for (auto& itr : m_sessions)
+    {
+        itr.second->LogoutPlayer();
+        delete itr.second;
+    }
+    m_sessions.clear();
+    m_active = false;
+}
+
+void StressTestMgr::OnSessionLogin(WorldSession* session)
+{
+    m_sessions[session->GetPlayer()->GetGUIDLow()] = session;
+    sLog.outDetail("StressTest: session %u logged in (%u of them now active)", session->GetAccountId(), uint32(m_sessions.size()));
+}
+
+void StressTestMgr::Update(uint32 diff)
+{
+    if (!m_active)
+        return;
+
+    m_tickTimes.push_back(diff);
+
+    m_moveTimer += diff;
+    m_castTimer += diff;
+    m_chatTimer += diff;
+    m_reportTimer += diff;
+
+    uint32 const moveInterval = sWorld.getConfig(CONFIG_UINT32_STRESS_TEST_MOVE_INTERVAL);
+    uint32 const castInterval = sWorld.getConfig(CONFIG_UINT32_STRESS_TEST_CAST_INTERVAL);
+    uint32 const chatInterval = sWorld.getConfig(CONFIG_UINT32_STRESS_TEST_CHAT_INTERVAL);
+
+    bool const doMove = moveInterval && m_moveTimer >= moveInterval;
+    bool const doCast = castInterval && m_castTimer >= castInterval;
+    bool const doChat = chatInterval && m_chatTimer >= chatInterval;
+
+    for (auto itr = m_sessions.begin(); itr != m_sessions.end();)
+    {
+        WorldSession* session = itr->second;
+        Player* player = session->GetPlayer();
+        if (!player)
+        {
+            // login failed or the character got logged out from under us
+            delete session;
+            itr = m_sessions.erase(itr);
+            continue;
+        }
+
+        if (player->IsInWorld() && !player->IsBeingTeleported())
+        {
+            if (doMove)
+                InjectMovement(session, player, moveInterval);
+            if (doCast)
+                InjectCast(session, player);
+            if (doChat)
+                InjectChat(session);
+        }
+
+        // synthetic sessions are not in the world's session map - drain
+        // their queues here the same way bot sessions are drained
+        session->HandleBotPackets();
+        ++itr;
+    }
+
+    if (doMove)
+        m_moveTimer = 0;
+    if (doCast)
+        m_castTimer = 0;
+    if (doChat)
+        m_chatTimer = 0;
+
+    if (m_reportTimer >= STRESS_REPORT_INTERVAL)
+    {
+        ReportTickPercentiles();
+        m_reportTimer = 0;
+    }
+}
+
+void StressTestMgr::InjectMovement(WorldSession* session, Player* player, uint32 interval) const
+{
+    MovementInfo info = player->m_movementInfo;
+    info.SetMovementFlags(MOVEFLAG_FORWARD);
+    info.ctime = WorldTimer::getMSTime();
+
+    // walk a run-speed step along the current orientation; turn randomly now
+    // and then, or when about to step off the map
+    float orientation = player->GetOrientation();
+    if (!urand(0, 9))
+        orientation = rand_norm_f() * 2 * M_PI_F;
+
+    float const step = player->GetSpeed(MOVE_RUN) * interval / IN_MILLISECONDS;
+    float const x = player->GetPositionX() + step * cos(orientation);
+    float const y = player->GetPositionY() + step * sin(orientation);
+    if (!MaNGOS::IsValidMapCoord(x, y))
+        return;
+
+    info.ChangePosition(x, y, player->GetPositionZ(), orientation);
+
+    auto packet = std::make_unique<WorldPacket>(MSG_MOVE_HEARTBEAT, 4 + 4 + 4 * 4 + 4);
+    *packet << info;
+    session->QueuePacket(std::move(packet));
+}
+
+void StressTestMgr::InjectCast(WorldSession* session, Player* player) const
+{
+    uint32 const spellId = sWorld.getConfig(CONFIG_UINT32_STRESS_TEST_CAST_SPELL);
+    if (!spellId || player->IsNonMeleeSpellCasted(false))
+        return;
+
+    auto packet = std::make_unique<WorldPacket>(CMSG_CAST_SPELL, 4 + 2);
+    *packet << spellId;
+    *packet << uint16(0);                                   // TARGET_FLAG_SELF
+    session->QueuePacket(std::move(packet));
+}
+
+void StressTestMgr::InjectChat(WorldSession* session) const
+{
+    auto packet = std::make_unique<WorldPacket>(CMSG_MESSAGECHAT, 4 + 4 + 16);
+    *packet << uint32(CHAT_MSG_SAY);
+    *packet << uint32(LANG_UNIVERSAL);
+    *packet << "stress test chatter";
+    session->QueuePacket(std::move(packet));
+}
+
+void StressTestMgr::ReportTickPercentiles()
+{
+    if (m_tickTimes.empty())
+        return;
+
+    std::sort(m_tickTimes.begin(), m_tickTimes.end());
+    auto percentile = [&](uint32 pct) { return m_tickTimes[(m_tickTimes.size() - 1) * pct / 100]; };
+
+    uint32 const p50 = percentile(50);
+    uint32 const p95 = percentile(95);
+    uint32 const p99 = percentile(99);
+    uint32 const worst = m_tickTimes.back();
+
+    sLog.outString("StressTest: %u sessions, tick ms p50 %u / p95 %u / p99 %u / max %u",
+        uint32(m_sessions.size()), p50, p95, p99, worst);
+
+#ifdef BUILD_METRICS
+    metric::measurement meas("stress.tick");
+    meas.add_tag("sessions", std::to_string(m_sessions.size()));
+    meas.add_field("p50", std::to_string(p50));
+    meas.add_field("p95", std::to_string(p95));
+    meas.add_field("p99", std::to_string(p99));
+    meas.add_field("max", std::to_string(worst));
+#endif
+
+    m_tickTimes.clear();
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_STRESS_TEST_MGR_H
+#define MANGOS_STRESS_TEST_MGR_H
+
+#include "Platform/Define.h"
+#include "Policies/Singleton.h"
+#include "Entities/ObjectGuid.h"
+
+#include <map>
+#include <vector>
+
+class WorldSession;
+class Player;
+
+/**
+ * Headless load-generation harness for capacity testing.
+ *
+ * When StressTest.Sessions is set, logs in that many characters from the
+ * characters table on socketless sessions (the same mechanism player bots
+ * use) and injects movement, spell cast and chat packets into them at the
+ * configured rates, exercising the full packet handling, movement
+ * broadcast and visibility paths of a live realm. World tick times are
+ * collected and the 50th/95th/99th percentile plus maximum are logged
+ * (and shipped through Metric when built in) every ten seconds.
+ *
+ * Strictly for test realms - the harness walks real characters around and
+ * lets them talk. Disabled by default.
+ */
+class StressTestMgr : public MaNGOS::Singleton<StressTestMgr, MaNGOS::ClassLevelLockable<StressTestMgr, std::mutex> >
+{
+    public:
+        StressTestMgr() : m_active(false), m_moveTimer(0), m_castTimer(0), m_chatTimer(0), m_reportTimer(0) {}
+
+        // logs in StressTest.Sessions characters on synthetic sessions
+        void Start();
+        // logs out and destroys all synthetic sessions
+        void Stop();
+
+        void Update(uint32 diff);
+        bool IsActive() const { return m_active; }
+
+        // called from the login query callback once the character is loaded
+        void OnSessionLogin(WorldSession* session);
+
+    private:
+        // implemented in CharacterHandler.cpp next to the other login paths
+        // (needs the file-local LoginQueryHolder)
+        void LoginStressSession(ObjectGuid playerGuid);
+
+        void InjectMovement(WorldSession* session, Player* player, uint32 interval) const;
+        void InjectCast(WorldSession* session, Player* player) const;
+        void InjectChat(WorldSession* session) const;
+        void ReportTickPercentiles();
+
+        bool m_active;
+
+        std::map<uint32, WorldSession*> m_sessions;         // character guid low -> synthetic session
+
+        uint32 m_moveTimer;
+        uint32 m_castTimer;
+        uint32 m_chatTimer;
+        uint32 m_reportTimer;
+
+        std::vector<uint32> m_tickTimes;                    // world tick durations since last report, ms
+};
+
+#define sStressTestMgr MaNGOS::Singleton<StressTestMgr>::Instance()
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/WorldPacket.h"
+#include "World/MemoryTrend.h"
+
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    size_t const THREAD_CACHE_MAX = 256;                    // blocks parked per thread
+    size_t const TRANSFER_BATCH = 32;                       // blocks exchanged with the backstop at once
+    size_t const GLOBAL_CACHE_MAX = 1024;                   // blocks parked in the shared backstop
+
+    // freed blocks a cache still owns are released when it is destroyed
+    struct PacketBlockCache
+    {
+        std::vector<void*> blocks;
+
+        ~PacketBlockCache()
+        {
+            for (void* block : blocks)
+                ::operator delete(block);
+        }
+    };
+
+    std::mutex s_globalCacheLock;
+    PacketBlockCache s_globalCache;
+
+    thread_local PacketBlockCache s_threadCache;
+}
+
+void* WorldPacket::operator new(size_t size)
+{
+    MemoryTrend::Account(MEMTREND_PACKETS, +1);
+
+    if (size != sizeof(WorldPacket))
+        return ::operator new(size);
+
+    std::vector<void*>& cache = s_threadCache.blocks;
+    if (cache.empty())
+    {
+        // refill a batch from the shared backstop: the receive path allocates
+        // on the network thread while world and map threads free, so blocks
+        // have to flow back against the packet direction
+        std::lock_guard<std::mutex> guard(s_globalCacheLock);
+        std::vector<void*>& global = s_globalCache.blocks;
+        while (!global.empty() && cache.size() < TRANSFER_BATCH)
+        {
+            cache.push_back(global.back());
+            global.pop_back();
+        }
+    }
+
+    if (!cache.empty())
+    {
+        void* block = cache.back();
+        cache.pop_back();
+        return block;
+    }
+
+    return ::operator new(size);
+}
+
+void WorldPacket::operator delete(void* ptr, size_t size) noexcept
+{
+    if (!ptr)
+        return;
+
+    MemoryTrend::Account(MEMTREND_PACKETS, -1);
+
+    if (size != sizeof(WorldPacket))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    std::vector<void*>& cache = s_threadCache.blocks;
+    cache.push_back(ptr);
+    if (cache.size() <= THREAD_CACHE_MAX)
+        return;
+
+    // thread cache overflow: donate a batch to the backstop, free the surplus
+    {
+        std::lock_guard<std::mutex> guard(s_globalCacheLock);
+        std::vector<void*>& global = s_globalCache.blocks;
+        while (!cache.empty() && global.size() < GLOBAL_CACHE_MAX)
+        {
+            global.push_back(cache.back());
+            cache.pop_back();
+        }
+    }
+
+    while (cache.size() > THREAD_CACHE_MAX / 2)
+    {
+        ::operator delete(cache.back());
+        cache.pop_back();
+    }
+}
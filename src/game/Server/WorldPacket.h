@@ -23,6 +23,8 @@
 #include "Util/ByteBuffer.h"
 #include "Server/Opcodes.h"
 #include <chrono>
+#include <memory>
+#include <vector>
 
 // Note: m_opcode and size stored in platfom dependent format
 // ignore endianess until send, and converted at receive
@@ -35,11 +37,43 @@ class WorldPacket : public ByteBuffer
         }
         explicit WorldPacket(Opcodes opcode, size_t reservedSize = 200) : ByteBuffer(reservedSize), m_opcode(opcode) {}
 
+        // heap packets (the receive path and queued sends make one per packet)
+        // come from per-thread freelists with a shared backstop; payloads up to
+        // ByteStorage::INLINE_CAPACITY ride along inside the recycled block, so
+        // the common case costs no allocator call at all
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size) noexcept;
+
+        /// pooled heap packet, preferred over a naked new for queued sends
+        static std::unique_ptr<WorldPacket> Acquire(Opcodes opcode, size_t reservedSize = 200)
+        {
+            return std::make_unique<WorldPacket>(opcode, reservedSize);
+        }
+
         void Initialize(Opcodes opcode, size_t reservedSize = 200)
         {
             clear();
             reserve(reservedSize);
             m_opcode = opcode;
+            m_sharedPayload.reset();
+        }
+
+        // refcounted immutable snapshot of the payload, built on first use: when
+        // the same packet object is delivered to many sessions (SendMessageToSet)
+        // every socket queues this one allocation, and only the small encrypted
+        // header is assembled per session. The snapshot is rebuilt if the packet
+        // is resized between sends; rewriting bytes of an already sent packet
+        // without changing its size is not supported.
+        std::shared_ptr<std::vector<char> const> GetSharedPayload() const
+        {
+            if (empty())
+                return nullptr;
+
+            if (!m_sharedPayload || m_sharedPayload->size() != size())
+                m_sharedPayload = std::make_shared<std::vector<char> const>(
+                    reinterpret_cast<char const*>(contents()), reinterpret_cast<char const*>(contents()) + size());
+
+            return m_sharedPayload;
         }
 
         Opcodes GetOpcode() const { return m_opcode; }
@@ -51,6 +85,7 @@ class WorldPacket : public ByteBuffer
 
     private:
         Opcodes m_opcode;
-        std::chrono::steady_clock::time_point m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
+        std::chrono::steady_clock::time_point m_receivedTime; // stamped at socket read; default (epoch) for locally injected packets.
+        mutable std::shared_ptr<std::vector<char> const> m_sharedPayload;
 };
 #endif
@@ -26,6 +26,9 @@
 #include "Database/DatabaseEnv.h"
 #include "Log/Log.h"
 #include "Server/Opcodes.h"
+#include "Server/OpcodeStatistics.h"
+#include "Server/PacketLayouts.h"
+#include "Server/PacketLog.h"
 #include "Server/WorldPacket.h"
 #include "Server/WorldSession.h"
 #include "Entities/Player.h"
@@ -56,6 +59,9 @@
 #include "playerbot/playerbot.h"
 #endif
 
+// bulk lane budget per WorldSession::Update tick - flooding opcodes beyond this wait for the next tick
+static uint32 const MAX_BULK_PACKETS_PER_TICK = 100;
+
 // select opcodes appropriate for processing in Map::Update context for current session state
 static bool MapSessionFilterHelper(WorldSession* session, OpcodeHandler const& opHandle)
 {
@@ -114,6 +120,10 @@ WorldSession::~WorldSession()
     if (_player)
         LogoutPlayer();
 
+    // drop the optimistic name reservation of a character creation that never finished
+    if (m_charCreateInfo)
+        sObjectMgr.ReleasePendingCharacterName(m_charCreateInfo->name);
+
     // marks this session as finalized in the socket which references (BUT DOES NOT OWN) it.
     // this lets the socket handling code know that the socket can be safely deleted
     if (m_socket)
@@ -274,28 +284,31 @@ void WorldSession::QueuePacket(std::unique_ptr<WorldPacket> new_packet)
     }
 
     if (opHandle.packetProcessing == PROCESS_MAP_THREAD)
-    {
-        std::lock_guard<std::mutex> guard(m_recvQueueMapLock);
-        m_recvQueueMap.push_back(std::move(new_packet));
-    }
+        m_recvQueueMap.Enqueue(std::move(new_packet));
+    else if (opHandle.packetProcessing == PROCESS_THREADSAFE)
+        // latency-critical lane: movement, casts and acks must not wait behind
+        // a burst of flooding opcodes in the bulk lane
+        m_recvQueuePriority.Enqueue(std::move(new_packet));
     else
-    {
-        std::lock_guard<std::mutex> guard(m_recvQueueLock);
-        m_recvQueue.push_back(std::move(new_packet));
-    }
+        m_recvQueue.Enqueue(std::move(new_packet));
 }
 
 void WorldSession::DeleteMovementPackets()
 {
-    std::lock_guard<std::mutex> guard(m_recvQueueMapLock);
-    for (auto itr = m_recvQueueMap.begin(); itr != m_recvQueueMap.end();)
+    // map thread only (it owns the consuming side): fold freshly queued
+    // packets into the backlog, then filter the backlog in place
+    std::unique_ptr<WorldPacket> queued;
+    while (m_recvQueueMap.Dequeue(queued))
+        m_recvQueueMapBacklog.push_back(std::move(queued));
+
+    for (auto itr = m_recvQueueMapBacklog.begin(); itr != m_recvQueueMapBacklog.end();)
     {
         switch ((*itr)->GetOpcode())
         {
             case MSG_MOVE_SET_FACING:
             case MSG_MOVE_HEARTBEAT:
             {
-                itr = m_recvQueueMap.erase(itr);
+                itr = m_recvQueueMapBacklog.erase(itr);
                 break;
             }
             default:
@@ -346,17 +359,83 @@ void WorldSession::ProcessByteBufferException(WorldPacket const& packet)
     }
 }
 
-/// Update the WorldSession (triggered by World update)
-bool WorldSession::Update(uint32 diff)
+/// Process one queued packet according to its required session status
+void WorldSession::ProcessQueuedPacket(WorldPacket& packet)
 {
-    GetMessager().Execute(this);
-
-    std::deque<std::unique_ptr<WorldPacket>> recvQueueCopy;
+    OpcodeHandler const& opHandle = opcodeTable[packet.GetOpcode()];
+    switch (opHandle.status)
     {
-        std::lock_guard<std::mutex> guard(m_recvQueueLock);
-        std::swap(recvQueueCopy, m_recvQueue);
+        case STATUS_LOGGEDIN:
+            if (!_player)
+            {
+                // skip STATUS_LOGGEDIN opcode unexpected errors if player logout sometime ago - this can be network lag delayed packets
+                if (!m_playerRecentlyLogout)
+                    LogUnexpectedOpcode(packet, "the player has not logged in yet");
+            }
+            else if (_player->IsInWorld())
+                ExecuteOpcode(opHandle, packet);
+
+            // lag can cause STATUS_LOGGEDIN opcodes to arrive after the player started a transfer
+
+#if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
+            if (_player && _player->GetPlayerbotMgr())
+                _player->GetPlayerbotMgr()->HandleMasterIncomingPacket(packet);
+#endif
+            break;
+        case STATUS_LOGGEDIN_OR_RECENTLY_LOGGEDOUT:
+            if (!_player && !m_playerRecentlyLogout)
+            {
+                LogUnexpectedOpcode(packet, "the player has not logged in yet and not recently logout");
+            }
+            else
+                // not expected _player or must checked in packet hanlder
+                ExecuteOpcode(opHandle, packet);
+            break;
+        case STATUS_TRANSFER:
+            if (!_player)
+                LogUnexpectedOpcode(packet, "the player has not logged in yet");
+            else if (_player->IsInWorld())
+                LogUnexpectedOpcode(packet, "the player is still in world");
+            else
+                ExecuteOpcode(opHandle, packet);
+            break;
+        case STATUS_AUTHED:
+            // prevent cheating with skip queue wait
+            if (m_inQueue && packet.GetOpcode() != CMSG_WARDEN_DATA)
+            {
+                LogUnexpectedOpcode(packet, "the player not pass queue yet");
+                break;
+            }
+
+            // single from authed time opcodes send in to after logout time
+            // and before other STATUS_LOGGEDIN_OR_RECENTLY_LOGGOUT opcodes.
+            m_playerRecentlyLogout = false;
+
+            ExecuteOpcode(opHandle, packet);
+            break;
+        case STATUS_NEVER:
+            sLog.outError("SESSION: received not allowed opcode %s (0x%.4X)",
+                          packet.GetOpcodeName(),
+                          packet.GetOpcode());
+            break;
+        case STATUS_UNHANDLED:
+            DEBUG_LOG("SESSION: received not handled opcode %s (0x%.4X)",
+                      packet.GetOpcodeName(),
+                      packet.GetOpcode());
+            break;
+        default:
+            sLog.outError("SESSION: received wrong-status-req opcode %s (0x%.4X)",
+                          packet.GetOpcodeName(),
+                          packet.GetOpcode());
+            break;
     }
+}
 
+/// Parallel stage of the session update, run from the session worker pool
+/// before the serial World::UpdateSessions walk; only session-local work and
+/// handlers tagged thread-safe belong here
+void WorldSession::UpdateParallel(uint32 diff)
+{
     if (m_socket && !m_socket->IsClosed() && m_anticheat)
     {
         auto const now = WorldTimer::getMSTime();
@@ -364,84 +443,43 @@ bool WorldSession::Update(uint32 diff)
         m_lastAnticheatUpdate = now;
     }
 
-    ///- Retrieve packets from the receive queue and call the appropriate handlers
-    /// not process packets if socket already closed
-    while (m_socket && !m_socket->IsClosed() && !recvQueueCopy.empty())
+    // the latency-critical lane (PROCESS_THREADSAFE: movement, casts, acks) is
+    // always drained fully; sessions sharing a map stay on one worker, so the
+    // per-map serialization these handlers rely on is preserved
+    std::unique_ptr<WorldPacket> queued;
+    while (m_recvQueuePriority.Dequeue(queued))
     {
-        // sLog.outError("MOEP: %s (0x%.4X)", packet->GetOpcodeName(), packet->GetOpcode());
-
-        auto const packet = std::move(recvQueueCopy.front());
-        recvQueueCopy.pop_front();
-
-        OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
-        switch (opHandle.status)
-        {
-            case STATUS_LOGGEDIN:
-                if (!_player)
-                {
-                    // skip STATUS_LOGGEDIN opcode unexpected errors if player logout sometime ago - this can be network lag delayed packets
-                    if (!m_playerRecentlyLogout)
-                        LogUnexpectedOpcode(*packet, "the player has not logged in yet");
-                }
-                else if (_player->IsInWorld())
-                    ExecuteOpcode(opHandle, *packet);
+        if (m_socket && !m_socket->IsClosed())
+            ProcessQueuedPacket(*queued);
+    }
 
-                // lag can cause STATUS_LOGGEDIN opcodes to arrive after the player started a transfer
+    // handlers that mutate shared world state (PROCESS_THREADUNSAFE) defer to
+    // the serial phase via the backlog
+    while (m_recvQueue.Dequeue(queued))
+        m_recvQueueBacklog.push_back(std::move(queued));
+}
 
-#if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
-                if (_player && _player->GetPlayerbotMgr())
-                    _player->GetPlayerbotMgr()->HandleMasterIncomingPacket(*packet);
-#endif
-                break;
-            case STATUS_LOGGEDIN_OR_RECENTLY_LOGGEDOUT:
-                if (!_player && !m_playerRecentlyLogout)
-                {
-                    LogUnexpectedOpcode(*packet, "the player has not logged in yet and not recently logout");
-                }
-                else
-                    // not expected _player or must checked in packet hanlder
-                    ExecuteOpcode(opHandle, *packet);
-                break;
-            case STATUS_TRANSFER:
-                if (!_player)
-                    LogUnexpectedOpcode(*packet, "the player has not logged in yet");
-                else if (_player->IsInWorld())
-                    LogUnexpectedOpcode(*packet, "the player is still in world");
-                else
-                    ExecuteOpcode(opHandle, *packet);
-                break;
-            case STATUS_AUTHED:
-                // prevent cheating with skip queue wait
-                if (m_inQueue && packet->GetOpcode() != CMSG_WARDEN_DATA)
-                {
-                    LogUnexpectedOpcode(*packet, "the player not pass queue yet");
-                    break;
-                }
+/// Update the WorldSession (triggered by World update)
+bool WorldSession::Update(uint32 diff)
+{
+    GetMessager().Execute(this);
 
-                // single from authed time opcodes send in to after logout time
-                // and before other STATUS_LOGGEDIN_OR_RECENTLY_LOGGOUT opcodes.
-                m_playerRecentlyLogout = false;
+    ///- Serial phase: the thread-safe lane already ran in UpdateParallel, only
+    /// the deferred bulk lane remains, capped per tick so flooding opcodes
+    /// cannot starve combat input
+    uint32 bulkBudget = MAX_BULK_PACKETS_PER_TICK;
+    while (m_socket && !m_socket->IsClosed() && !m_recvQueueBacklog.empty() && bulkBudget > 0)
+    {
+        auto const packet = std::move(m_recvQueueBacklog.front());
+        m_recvQueueBacklog.pop_front();
+        --bulkBudget;
 
-                ExecuteOpcode(opHandle, *packet);
-                break;
-            case STATUS_NEVER:
-                sLog.outError("SESSION: received not allowed opcode %s (0x%.4X)",
-                              packet->GetOpcodeName(),
-                              packet->GetOpcode());
-                break;
-            case STATUS_UNHANDLED:
-                DEBUG_LOG("SESSION: received not handled opcode %s (0x%.4X)",
-                          packet->GetOpcodeName(),
-                          packet->GetOpcode());
-                break;
-            default:
-                sLog.outError("SESSION: received wrong-status-req opcode %s (0x%.4X)",
-                              packet->GetOpcodeName(),
-                              packet->GetOpcode());
-                break;
-        }
+        ProcessQueuedPacket(*packet);
     }
 
+    // bulk packets over budget stay in the backlog, in order ahead of
+    // whatever arrives next tick
+
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     // Process player bot packets
     // The PlayerbotAI class adds to the packet queue to simulate a real player
@@ -454,10 +492,24 @@ bool WorldSession::Update(uint32 diff)
         {
             Player* const botPlayer = itr->second;
             WorldSession* const pBotWorldSession = botPlayer->GetSession();
-            while(!pBotWorldSession->m_recvQueue.empty())
+            // bots have no tick budget - fold the priority lane in ahead of the bulk lane
+            std::deque<std::unique_ptr<WorldPacket>> botPackets;
             {
-                auto const botpacket = std::move(pBotWorldSession->m_recvQueue.front());
-                pBotWorldSession->m_recvQueue.pop_front();
+                std::unique_ptr<WorldPacket> queued;
+                while (pBotWorldSession->m_recvQueuePriority.Dequeue(queued))
+                    botPackets.push_back(std::move(queued));
+                while (pBotWorldSession->m_recvQueue.Dequeue(queued))
+                    pBotWorldSession->m_recvQueueBacklog.push_back(std::move(queued));
+                while (!pBotWorldSession->m_recvQueueBacklog.empty())
+                {
+                    botPackets.push_back(std::move(pBotWorldSession->m_recvQueueBacklog.front()));
+                    pBotWorldSession->m_recvQueueBacklog.pop_front();
+                }
+            }
+            while (!botPackets.empty())
+            {
+                auto const botpacket = std::move(botPackets.front());
+                botPackets.pop_front();
 
                 OpcodeHandler const& opHandle = opcodeTable[botpacket->GetOpcode()];
                 pBotWorldSession->ExecuteOpcode(opHandle, *botpacket);
@@ -480,7 +532,6 @@ bool WorldSession::Update(uint32 diff)
         {
             if (m_requestSocket)
             {
-                std::lock_guard<std::mutex> guard(m_recvQueueLock);
                 if (!IsOffline())
                     SetOffline();
 
@@ -561,16 +612,17 @@ bool WorldSession::Update(uint32 diff)
 
 void WorldSession::UpdateMap(uint32 diff)
 {
-    std::deque<std::unique_ptr<WorldPacket>> recvQueueMapCopy;
+    // map-thread private: fold freshly queued packets behind any backlog
     {
-        std::lock_guard<std::mutex> guard(m_recvQueueMapLock);
-        std::swap(recvQueueMapCopy, m_recvQueueMap);
+        std::unique_ptr<WorldPacket> queued;
+        while (m_recvQueueMap.Dequeue(queued))
+            m_recvQueueMapBacklog.push_back(std::move(queued));
     }
 
-    while (m_socket && !m_socket->IsClosed() && recvQueueMapCopy.size())
+    while (m_socket && !m_socket->IsClosed() && !m_recvQueueMapBacklog.empty())
     {
-        auto const packet = std::move(recvQueueMapCopy.front());
-        recvQueueMapCopy.pop_front();
+        auto const packet = std::move(m_recvQueueMapBacklog.front());
+        m_recvQueueMapBacklog.pop_front();
 
         OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
         
@@ -579,18 +631,39 @@ void WorldSession::UpdateMap(uint32 diff)
             ExecuteOpcode(opHandle, *packet);
         }
     }
+
+    if (m_pendingMoveBroadcast)
+    {
+        m_pendingMoveTimer += diff;
+        if (m_pendingMoveTimer >= sWorld.getConfig(CONFIG_UINT32_MOVEMENT_COALESCE_WINDOW))
+            FlushPendingMoveBroadcast();
+    }
 }
 
-#ifdef ENABLE_PLAYERBOTS
 void WorldSession::HandleBotPackets()
 {
-    while (!m_recvQueue.empty())
+    // bots have no tick budget - fold the priority lane in ahead of the bulk lane
+    std::deque<std::unique_ptr<WorldPacket>> packets;
+    {
+        std::unique_ptr<WorldPacket> queued;
+        while (m_recvQueuePriority.Dequeue(queued))
+            packets.push_back(std::move(queued));
+        while (m_recvQueue.Dequeue(queued))
+            m_recvQueueBacklog.push_back(std::move(queued));
+        while (!m_recvQueueBacklog.empty())
+        {
+            packets.push_back(std::move(m_recvQueueBacklog.front()));
+            m_recvQueueBacklog.pop_front();
+        }
+    }
+
+    while (!packets.empty())
     {
         if (_player)
             _player->SetCanDelayTeleport(true);
 
-        auto const packet = std::move(m_recvQueue.front());
-        m_recvQueue.pop_front();
+        auto const packet = std::move(packets.front());
+        packets.pop_front();
         OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
         (this->*opHandle.handler)(*packet);
 
@@ -606,7 +679,6 @@ void WorldSession::HandleBotPackets()
         }
     }
 }
-#endif
 
 /// %Log the player out
 void WorldSession::LogoutPlayer()
@@ -722,6 +794,7 @@ void WorldSession::LogoutPlayer()
             }
 
             guild->BroadcastEvent(GE_SIGNED_OFF, _player->GetObjectGuid(), _player->GetName());
+            guild->OnMemberLogout(_player->GetGUIDLow());
         }
 
         ///- Remove pet
@@ -1194,11 +1267,34 @@ void WorldSession::SendTransferAborted(TransferAbortReason reason) const
 
 void WorldSession::ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& packet)
 {
+    // single upfront bounds check generated from the declared wire layout:
+    // a truncated fixed-layout packet is rejected here instead of unwinding
+    // through a ByteBufferException in the middle of the handler
+    if (packet.size() < ClientPacketMinSize[packet.GetOpcode()])
+    {
+        ProcessByteBufferException(packet);
+        return;
+    }
+
+    // replay capture: record real client input about to execute, keyed to the
+    // owning character - pre-login traffic and locally injected packets
+    // (playerbots, stress driver) cannot be replayed and are skipped
+    if (_player && m_socket && sPacketLog->CanCaptureReplay())
+        sPacketLog->CaptureClientPacket(packet, _player->GetGUIDLow());
+
     // need prevent do internal far teleports in handlers because some handlers do lot steps
     // or call code that can do far teleports in some conditions unexpectedly for generic way work code
     if (_player)
         _player->SetCanDelayTeleport(true);
 
+    auto const handlerStart = std::chrono::steady_clock::now();
+
+    // packets stamped at socket read report their queue-dwell time; packets
+    // injected locally (playerbots, stress driver) carry no receive time
+    if (packet.GetReceivedTime().time_since_epoch().count())
+        OpcodeStatistics::instance().RecordLatency(opHandle.packetProcessing, OpcodeStatistics::LATENCY_DWELL,
+            uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(handlerStart - packet.GetReceivedTime()).count()));
+
     try
     {
         (this->*opHandle.handler)(packet);
@@ -1208,6 +1304,10 @@ void WorldSession::ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& pac
         ProcessByteBufferException(packet);
     }
 
+    uint64 const handlerNs = uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - handlerStart).count());
+    OpcodeStatistics::instance().Record(packet.GetOpcode(), uint32(packet.size()), handlerNs);
+    OpcodeStatistics::instance().RecordLatency(opHandle.packetProcessing, OpcodeStatistics::LATENCY_EXEC, handlerNs);
+
     if (_player)
     {
         // can be not set in fact for login opcode, but this not create porblems.
@@ -1292,15 +1392,11 @@ void WorldSession::AssignAnticheat(std::unique_ptr<SessionAnticheatInterface>&&
     m_anticheat = std::move(anticheat);
 }
 
-#ifdef BUILD_DEPRECATED_PLAYERBOT
-
 void WorldSession::SetNoAnticheat()
 {
     m_anticheat.reset(new NullSessionAnticheat(this));
 }
 
-#endif
-
 void WorldSession::AfkStateChange(bool state)
 {
     if (state)
@@ -1313,10 +1409,3 @@ void WorldSession::HandleWardenDataOpcode(WorldPacket& recv_data)
 {
     m_anticheat->WardenPacket(recv_data);
 }
-
-#ifdef ENABLE_PLAYERBOTS
-void WorldSession::SetNoAnticheat()
-{
-    m_anticheat.reset(new NullSessionAnticheat(this));
-}
-#endif
\ No newline at end of file
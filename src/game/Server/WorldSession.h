@@ -32,6 +32,7 @@
 #include "Server/WorldSocket.h"
 #include "Multithreading/Messager.h"
 #include "BattleGround/BattleGroundDefines.h"
+#include "Util/MPSCQueue.h"
 
 #include <atomic>
 #include <map>
@@ -53,6 +54,7 @@ class Unit;
 class WorldPacket;
 class QueryResult;
 class LoginQueryHolder;
+class SqlQueryHolder;
 class CharacterHandler;
 class GMTicket;
 class MovementInfo;
@@ -142,6 +144,22 @@ enum TransferAbortReason
     TRANSFER_ABORT_ZONE_IN_COMBAT               = 0x05,     // Unable to zone in while an encounter is in progress.
 };
 
+// creation data carried across the async character creation pipeline
+// (see HandleCharCreateOpcode and its callbacks in CharacterHandler.cpp)
+struct CharacterCreateInfo
+{
+    std::string name;                           // normalized, reserved in ObjectMgr while the create is in flight
+    uint8 race       = 0;
+    uint8 class_     = 0;
+    uint8 gender     = 0;
+    uint8 skin       = 0;
+    uint8 face       = 0;
+    uint8 hairStyle  = 0;
+    uint8 hairColor  = 0;
+    uint8 facialHair = 0;
+    uint8 outfitId   = 0;
+};
+
 struct CharacterNameQueryResponse
 {
     ObjectGuid          guid;                   // pc's guid
@@ -245,6 +263,11 @@ class WorldSession
         std::string const& GetAccountName() const { return m_accountName; }
         Player* GetPlayer() const { return _player; }
         char const* GetPlayerName() const;
+
+        // off-thread GM commands hold the session alive until they finish
+        void IncPendingOffThreadCommands() { ++m_pendingOffThreadCommands; }
+        void DecPendingOffThreadCommands() { --m_pendingOffThreadCommands; }
+        bool HasPendingOffThreadCommands() const { return m_pendingOffThreadCommands != 0; }
         void SetSecurity(AccountTypes security) { _security = security; }
 #if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
         // Players connected without socket are bot
@@ -260,9 +283,9 @@ class WorldSession
         void AssignAnticheat(std::unique_ptr<SessionAnticheatInterface>&& anticheat);
         SessionAnticheatInterface* GetAnticheat() const { return m_anticheat.get(); }
 
-#if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
+        // replaces the anticheat with the null implementation - for
+        // socketless sessions (player bots, stress-test harness)
         void SetNoAnticheat();
-#endif
 
         /// Session in auth.queue currently
         void SetInQueue(bool state) { m_inQueue = state; }
@@ -303,6 +326,7 @@ class WorldSession
 
         void DeleteMovementPackets();
 
+        void UpdateParallel(uint32 diff);
         bool Update(uint32 diff);
         void UpdateMap(uint32 diff);
 
@@ -440,7 +464,15 @@ class WorldSession
         void HandleCharCreateOpcode(WorldPacket& recvPacket);
         void HandlePlayerLoginOpcode(WorldPacket& recvPacket);
         void HandleCharEnum(QueryResult* result);
+        // async character creation pipeline: account limit check on the login DB,
+        // then realm limit/race queries on the character DB, then the actual create
+        void HandleCharCreateAccountChecked(QueryResult* result);
+        void HandleCharCreateFinalize(SqlQueryHolder* holder);
+        void HandleCharDeleteConfirmed(QueryResult* result);
         void HandlePlayerLogin(LoginQueryHolder* holder);
+        // world-thread tail of the staged login: map add and everything that
+        // touches shared systems (group, guild, social, tickets)
+        void HandlePlayerLoginFinalize();
         void HandlePlayerReconnect();
 
         // played time
@@ -640,6 +672,7 @@ class WorldSession
         void HandleAuctionPlaceBid(WorldPacket& recv_data);
 
         void HandleGetMailList(WorldPacket& recv_data);
+        void SendMailListResult();
         void HandleSendMail(WorldPacket& recv_data);
         void HandleMailTakeMoney(WorldPacket& recv_data);
         void HandleMailTakeItem(WorldPacket& recv_data);
@@ -798,9 +831,9 @@ class WorldSession
         std::deque<uint32> GetOutOpcodeHistory();
         std::deque<uint32> GetIncOpcodeHistory();
 
-#ifdef ENABLE_PLAYERBOTS
+        // drains both receive lanes directly, bypassing the per-tick budget -
+        // for socketless sessions (player bots, stress-test harness)
         void HandleBotPackets();
-#endif
 
         Messager<WorldSession>& GetMessager() { return m_messager; }
 
@@ -812,8 +845,12 @@ class WorldSession
         bool VerifyMovementInfo(MovementInfo const& movementInfo, Unit* mover, bool unroot) const;
         void HandleMoverRelocation(MovementInfo& movementInfo);
 
+        void ProcessQueuedPacket(WorldPacket& packet);
         void ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& packet);
 
+        // movement heartbeat coalescing (Network.MovementCoalesceWindow)
+        void FlushPendingMoveBroadcast();
+
         // logging helper
         void LogUnexpectedOpcode(WorldPacket const& packet, const char* reason) const;
         void LogUnprocessedTail(WorldPacket const& packet) const;
@@ -849,6 +886,11 @@ class WorldSession
         bool m_playerLoading;                               // code processed in LoginPlayer
         bool m_kickSession;
 
+        // in-flight character creation (one per session); releases its name
+        // reservation on abort or session destruction
+        std::unique_ptr<CharacterCreateInfo> m_charCreateInfo;
+        void CharCreateAbort(uint8 result);
+
         // True when the player is in the process of logging out (WorldSession::LogoutPlayer is currently executing)
         bool m_playerLogout;
         bool m_playerRecentlyLogout;
@@ -865,15 +907,30 @@ class WorldSession
 
         bool m_initialZoneUpdated = false;
 
+        // newest buffered movement heartbeat, flushed from UpdateMap when the
+        // coalescing window elapses or a state-changing move opcode arrives
+        std::unique_ptr<WorldPacket> m_pendingMoveBroadcast;
+        ObjectGuid m_pendingMoveGuid;
+        uint32 m_pendingMoveTimer = 0;
+
         // Thread safety mechanisms
-        std::mutex m_recvQueueLock;
-        std::mutex m_recvQueueMapLock;
-        std::deque<std::unique_ptr<WorldPacket>> m_recvQueue;
-        std::deque<std::unique_ptr<WorldPacket>> m_recvQueueMap;
+        // lock-free producer side: network (and bot) threads enqueue, the
+        // owning update thread drains into the private backlogs below
+        MPSCQueue<std::unique_ptr<WorldPacket>> m_recvQueue;
+        MPSCQueue<std::unique_ptr<WorldPacket>> m_recvQueueMap;
+        // latency-critical lane (movement, casts, acks - PROCESS_THREADSAFE):
+        // always drained fully before the bulk lane, which is capped per tick
+        // so flooding opcodes cannot starve combat input
+        MPSCQueue<std::unique_ptr<WorldPacket>> m_recvQueuePriority;
+        // consumer-private backlogs: bulk packets over the tick budget (world
+        // thread) and pending map-thread packets - no locking needed
+        std::deque<std::unique_ptr<WorldPacket>> m_recvQueueBacklog;
+        std::deque<std::unique_ptr<WorldPacket>> m_recvQueueMapBacklog;
 
         Messager<WorldSession> m_messager;
 
         std::atomic<uint32> m_currentPlayerLevel;
+        std::atomic<uint32> m_pendingOffThreadCommands{0};
 };
 #endif
 /// @}
@@ -127,21 +127,14 @@ void WorldSocket::SendPacket(const WorldPacket& pct)
     if (m_opcodeHistoryOut.size() > 50)
         m_opcodeHistoryOut.resize(30);
 
-    if (pct.size() > 0)
-    {
-        // allocate array for full message
-        std::shared_ptr<std::vector<char>> fullMessage = std::make_shared<std::vector<char>>(header.headerSize() + pct.size());
-        std::memcpy(fullMessage->data(), header.data(), header.headerSize()); // copy header
-        std::memcpy((fullMessage->data() + header.headerSize()), reinterpret_cast<const char*>(pct.contents()), pct.size()); // copy packet
-        auto self(shared_from_this());
-        Write(fullMessage->data(), fullMessage->size(), [self, fullMessage](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-    }
+    // only the small header is assembled per session (it carries the session
+    // key encryption); the payload snapshot is refcounted, so a broadcast to
+    // many viewers shares one payload allocation across all their sockets
+    std::shared_ptr<std::vector<char>> headerBuffer = std::make_shared<std::vector<char>>(header.data(), header.data() + header.headerSize());
+    if (std::shared_ptr<std::vector<char> const> payload = pct.GetSharedPayload())
+        QueueWrite(headerBuffer, payload);
     else
-    {
-        std::shared_ptr<ServerPktHeader> sharedHeader = std::make_shared<ServerPktHeader>(header);
-        auto self(shared_from_this());
-        Write(sharedHeader->data(), sharedHeader->headerSize(), [self, sharedHeader](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-    }
+        QueueWrite(headerBuffer);
 }
 
 bool WorldSocket::OnOpen()
@@ -193,7 +186,8 @@ bool WorldSocket::ProcessIncomingData()
                 return;
             }
 
-            std::unique_ptr<WorldPacket> pct = std::make_unique<WorldPacket>(opcode, packetBuffer->size());
+            std::unique_ptr<WorldPacket> pct = WorldPacket::Acquire(opcode, packetBuffer->size());
+            pct->SetReceivedTime(std::chrono::steady_clock::now());
             pct->append(*packetBuffer.get());
             if (sPacketLog->CanLogPacket() && self->IsLoggingPackets())
                 sPacketLog->LogPacket(*pct, CLIENT_TO_SERVER, self->GetRemoteIpAddress(), self->GetRemotePort());
@@ -257,6 +251,35 @@ bool WorldSocket::ProcessIncomingData()
                             return;
                         }
 
+                        // flood protection: drop over-budget packets here so a
+                        // misbehaving client pays on the network thread instead
+                        // of inside WorldSession::Update; GMs are exempt
+                        if (self->m_session->GetSecurity() == SEC_PLAYER && !self->m_rateLimiter.Allow(*pct))
+                        {
+                            if (self->m_rateLimiter.ShouldDisconnect())
+                            {
+                                uint32 const accountId = self->m_session->GetAccountId();
+                                sLog.outError("WorldSocket::ProcessIncomingData: disconnecting account %u (%s) for packet flooding (%u packets dropped)",
+                                    accountId, self->GetRemoteAddress().c_str(), self->m_rateLimiter.GetViolations());
+
+                                if (PacketRateLimiter::RegisterDisconnect(accountId))
+                                {
+                                    uint32 const banDuration = sWorld.getConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_BAN_DURATION);
+                                    sWorld.GetMessager().AddMessage([accountId, banDuration](World* world)
+                                    {
+                                        if (WorldSession* session = world->FindSession(accountId))
+                                            world->BanAccount(session, banDuration, "Packet flooding", "Server");
+                                    });
+                                }
+
+                                self->Close();
+                                return;
+                            }
+
+                            self->ProcessIncomingData();    // throttled: drop the packet, keep reading
+                            return;
+                        }
+
                         self->m_session->QueuePacket(std::move(pct));
                         break;
                     }
@@ -29,6 +29,7 @@
 #include "AuthCrypt.h"
 #include "Auth/BigNumber.h"
 #include "Network/AsyncSocket.hpp"
+#include "Server/PacketRateLimiter.h"
 
 #include <chrono>
 #include <functional>
@@ -123,6 +124,9 @@ class WorldSocket : public MaNGOS::AsyncSocket<WorldSocket>
         std::deque<uint32> m_opcodeHistoryOut;
         std::deque<uint32> m_opcodeHistoryInc;
 
+        // per-opcode-class token buckets, applied before queueing to the session
+        PacketRateLimiter m_rateLimiter;
+
         bool m_loggingPackets;
 
     public:
@@ -80,6 +80,11 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friend_guid, bool ignore)
         fi.Flags |= flag;
         m_playerSocialMap[friend_guid.GetCounter()] = fi;
     }
+
+    // the adding player is online by definition, subscribe him to the friend's status changes
+    if (!ignore)
+        sSocialMgr.RegisterFriendWatcher(friend_guid.GetCounter(), m_playerLowGuid);
+
     return true;
 }
 
@@ -93,6 +98,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid friend_guid, bool ignore)
     if (ignore)
         flag = SOCIAL_FLAG_IGNORED;
 
+    if (!ignore && (itr->second.Flags & SOCIAL_FLAG_FRIEND))
+        sSocialMgr.UnregisterFriendWatcher(friend_guid.GetCounter(), m_playerLowGuid);
+
     itr->second.Flags &= ~flag;
     if (itr->second.Flags == 0)
     {
@@ -183,6 +191,36 @@ SocialMgr::~SocialMgr()
 {
 }
 
+void SocialMgr::RemovePlayerSocial(uint32 guid)
+{
+    SocialMap::iterator itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    // drop the logging out player from the watcher lists of everyone he has friended
+    for (PlayerSocialMap::const_iterator itr2 = itr->second.m_playerSocialMap.begin(); itr2 != itr->second.m_playerSocialMap.end(); ++itr2)
+        if (itr2->second.Flags & SOCIAL_FLAG_FRIEND)
+            UnregisterFriendWatcher(itr2->first, guid);
+
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::RegisterFriendWatcher(uint32 watchedLowGuid, uint32 watcherLowGuid)
+{
+    m_friendWatchers[watchedLowGuid].insert(watcherLowGuid);
+}
+
+void SocialMgr::UnregisterFriendWatcher(uint32 watchedLowGuid, uint32 watcherLowGuid)
+{
+    FriendWatcherMap::iterator itr = m_friendWatchers.find(watchedLowGuid);
+    if (itr == m_friendWatchers.end())
+        return;
+
+    itr->second.erase(watcherLowGuid);
+    if (itr->second.empty())
+        m_friendWatchers.erase(itr);
+}
+
 void SocialMgr::GetFriendInfo(Player* player, uint32 friend_lowguid, FriendInfo& friendInfo) const
 {
     if (!player)
@@ -271,22 +309,23 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket const& pack
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_IN_WHO_LIST));
     bool allowTwoSideWhoList = sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST);
 
-    for (SocialMap::const_iterator itr = m_socialMap.begin(); itr != m_socialMap.end(); ++itr)
+    // only online players having this player friended are registered as watchers
+    FriendWatcherMap::const_iterator watchers = m_friendWatchers.find(guid);
+    if (watchers == m_friendWatchers.end())
+        return;
+
+    for (uint32 watcherLowGuid : watchers->second)
     {
-        PlayerSocialMap::const_iterator itr2 = itr->second.m_playerSocialMap.find(guid);
-        if (itr2 != itr->second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
+        Player* pFriend = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, watcherLowGuid));
+
+        // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
+        // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
+        if (pFriend && pFriend->IsInWorld() &&
+                (pFriend->GetSession()->GetSecurity() > SEC_PLAYER ||
+                 ((pFriend->GetTeam() == team || allowTwoSideWhoList) && security <= gmLevelInWhoList)) &&
+                player->IsVisibleGloballyFor(pFriend))
         {
-            Player* pFriend = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-
-            // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
-            // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-            if (pFriend && pFriend->IsInWorld() &&
-                    (pFriend->GetSession()->GetSecurity() > SEC_PLAYER ||
-                     ((pFriend->GetTeam() == team || allowTwoSideWhoList) && security <= gmLevelInWhoList)) &&
-                    player->IsVisibleGloballyFor(pFriend))
-            {
-                pFriend->GetSession()->SendPacket(packet);
-            }
+            pFriend->GetSession()->SendPacket(packet);
         }
     }
 }
@@ -316,6 +355,9 @@ PlayerSocial* SocialMgr::LoadFromDB(std::unique_ptr<QueryResult> queryResult, Ob
 
         social->m_playerSocialMap[friend_guid] = FriendInfo(flags);
 
+        if (flags & SOCIAL_FLAG_FRIEND)
+            RegisterFriendWatcher(friend_guid, guid.GetCounter());
+
         if (flags & SOCIAL_FLAG_IGNORED)
             ++ignoreCounter;
         else
@@ -136,7 +136,11 @@ class SocialMgr
         SocialMgr();
         ~SocialMgr();
         // Misc
-        void RemovePlayerSocial(uint32 guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(uint32 guid);
+
+        // online watcher upkeep: watchers are in-world players that have the watched player friended
+        void RegisterFriendWatcher(uint32 watchedLowGuid, uint32 watcherLowGuid);
+        void UnregisterFriendWatcher(uint32 watchedLowGuid, uint32 watcherLowGuid);
 
         void GetFriendInfo(Player* player, uint32 friend_lowguid, FriendInfo& friendInfo) const;
         // Packet management
@@ -146,7 +150,10 @@ class SocialMgr
         // Loading
         PlayerSocial* LoadFromDB(std::unique_ptr<QueryResult> queryResult, ObjectGuid guid);
     private:
+        typedef std::map<uint32, std::set<uint32>> FriendWatcherMap;
+
         SocialMap m_socialMap;
+        FriendWatcherMap m_friendWatchers;                  // watched player lowguid -> online players that have him friended
 };
 
 #define sSocialMgr MaNGOS::Singleton<SocialMgr>::Instance()
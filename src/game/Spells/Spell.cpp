@@ -210,8 +210,12 @@ void SpellCastTargets::setCorpseTarget(Corpse* corpse)
 void SpellCastTargets::Update(WorldObject* caster)
 {
     m_GOTarget   = m_GOTargetGUID ? caster->GetMap()->GetGameObject(m_GOTargetGUID) : nullptr;
+    // players are resolved globally by ObjectAccessor, so only the map local
+    // creature path goes through the resolution cache
     m_unitTarget = m_unitTargetGUID ?
-                   (m_unitTargetGUID == caster->GetObjectGuid() ? static_cast<Unit*>(caster) : ObjectAccessor::GetUnit(*caster, m_unitTargetGUID)) :
+                   (m_unitTargetGUID == caster->GetObjectGuid() ? static_cast<Unit*>(caster) :
+                    (!m_unitTargetGUID.IsPlayer() && caster->IsInWorld() ? m_resolution.ResolveUnit(caster->GetMap(), m_unitTargetGUID) :
+                     ObjectAccessor::GetUnit(*caster, m_unitTargetGUID))) :
                    nullptr;
 
     m_itemTarget = nullptr;
@@ -4613,7 +4617,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 
         // only check at first call, Stealth auras are already removed at second call
         // for now, ignore triggered spells
-        if (strict && !m_IsTriggeredSpell)
+        if (strict && !m_IsTriggeredSpell && (GetSpellCheckCastMask(m_spellInfo) & SPELL_PRECHECK_SHAPESHIFT))
         {
             // Cannot be used in this stance/form
             SpellCastResult shapeError = GetErrorAtShapeshiftedCast(m_spellInfo, m_caster->GetShapeshiftForm());
@@ -4624,7 +4628,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                 return SPELL_FAILED_ONLY_STEALTHED;
         }
 
-        if (!m_IsTriggeredSpell && NeedsComboPoints(m_spellInfo) && (!m_targets.getUnitTarget() || m_targets.getUnitTarget()->GetObjectGuid() != m_caster->GetComboTargetGuid()))
+        if (!m_IsTriggeredSpell && (GetSpellCheckCastMask(m_spellInfo) & SPELL_PRECHECK_COMBO_POINTS) && (!m_targets.getUnitTarget() || m_targets.getUnitTarget()->GetObjectGuid() != m_caster->GetComboTargetGuid()))
             // warrior not have real combo-points at client side but use this way for mark allow Overpower use
             return m_caster->getClass() == CLASS_WARRIOR ? SPELL_FAILED_CASTER_AURASTATE : SPELL_FAILED_NO_COMBO_POINTS;
     }
@@ -4654,39 +4658,42 @@ SpellCastResult Spell::CheckCast(bool strict)
             }
 
             // Loatheb Corrupted Mind and Nefarian class calls spell failed
-            switch (m_spellInfo->SpellFamilyName)
+            if (GetSpellCheckCastMask(m_spellInfo) & SPELL_PRECHECK_OVERRIDE_SCRIPT)
             {
-                case SPELLFAMILY_DRUID:
+                switch (m_spellInfo->SpellFamilyName)
                 {
-                    if (IsSpellHaveAura(m_spellInfo, SPELL_AURA_MOD_SHAPESHIFT))
-                        if (m_caster->HasOverrideScript(3655))
-                            return SPELL_FAILED_TARGET_AURASTATE;
-                    //[[fallthrough]]
-                }
-                case SPELLFAMILY_PRIEST:
-                case SPELLFAMILY_SHAMAN:
-                case SPELLFAMILY_PALADIN:
-                {
-                    if (IsSpellHaveEffect(m_spellInfo, SPELL_EFFECT_HEAL) ||
-                        IsSpellHaveAura(m_spellInfo, SPELL_AURA_PERIODIC_HEAL) ||
-                        IsSpellHaveEffect(m_spellInfo, SPELL_EFFECT_DISPEL))
+                    case SPELLFAMILY_DRUID:
                     {
-                        if (m_caster->HasOverrideScript(4327))
-                            return SPELL_FAILED_FIZZLE;
+                        if (IsSpellHaveAura(m_spellInfo, SPELL_AURA_MOD_SHAPESHIFT))
+                            if (m_caster->HasOverrideScript(3655))
+                                return SPELL_FAILED_TARGET_AURASTATE;
+                        //[[fallthrough]]
                     }
-                    break;
-                }
-                case SPELLFAMILY_WARRIOR:
-                {
-                    if (IsSpellHaveAura(m_spellInfo, SPELL_AURA_MOD_SHAPESHIFT))
+                    case SPELLFAMILY_PRIEST:
+                    case SPELLFAMILY_SHAMAN:
+                    case SPELLFAMILY_PALADIN:
                     {
-                        if (m_caster->HasOverrideScript(3654))
-                            return SPELL_FAILED_TARGET_AURASTATE;
+                        if (IsSpellHaveEffect(m_spellInfo, SPELL_EFFECT_HEAL) ||
+                            IsSpellHaveAura(m_spellInfo, SPELL_AURA_PERIODIC_HEAL) ||
+                            IsSpellHaveEffect(m_spellInfo, SPELL_EFFECT_DISPEL))
+                        {
+                            if (m_caster->HasOverrideScript(4327))
+                                return SPELL_FAILED_FIZZLE;
+                        }
+                        break;
                     }
-                    break;
+                    case SPELLFAMILY_WARRIOR:
+                    {
+                        if (IsSpellHaveAura(m_spellInfo, SPELL_AURA_MOD_SHAPESHIFT))
+                        {
+                            if (m_caster->HasOverrideScript(3654))
+                                return SPELL_FAILED_TARGET_AURASTATE;
+                        }
+                        break;
+                    }
+                    default:
+                        break;
                 }
-                default:
-                    break;
             }
         }
     }
@@ -6557,8 +6564,10 @@ SpellCastResult Spell::CheckItems()
         m_eventTarget = ok;                                   // game object found in range
     }
 
+    uint32 const checkMask = GetSpellCheckCastMask(m_spellInfo);
+
     // check reagents (ignore triggered spells with reagents processed by original spell) and special reagent ignore case.
-    if (!IgnoreItemRequirements())
+    if ((checkMask & (SPELL_PRECHECK_REAGENTS | SPELL_PRECHECK_TOTEMS)) && !IgnoreItemRequirements())
     {
         if (!p_caster->CanNoReagentCast(m_spellInfo))
         {
@@ -6635,6 +6644,9 @@ SpellCastResult Spell::CheckItems()
         */
     }
 
+    if (!(checkMask & SPELL_PRECHECK_ITEM_EFFECTS))
+        return SPELL_CAST_OK;
+
     // special checks for spell effects
     for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
     {
@@ -7319,7 +7331,16 @@ SpellCastResult Spell::CanOpenLock(SpellEffectIndex effIndex, uint32 lockId, Ski
 void Spell::FillAreaTargets(UnitList& targetUnitMap, float radius, float cone, SpellNotifyPushType pushType, SpellTargets spellTargets, WorldObject* originalCaster /*=nullptr*/)
 {
     MaNGOS::SpellNotifierCreatureAndPlayer notifier(*this, targetUnitMap, radius, cone, pushType, spellTargets, originalCaster);
-    Cell::VisitAllObjects(notifier.GetCenterX(), notifier.GetCenterY(), m_trueCaster->GetMap(), notifier, radius);
+
+    // walk the shared per-tick cell snapshots instead of revisiting the grids -
+    // stacked AoE casts in the same area reuse one candidate scan per cell
+    Map* map = m_trueCaster->GetMap();
+    CellArea area = Cell::CalculateCellArea(notifier.GetCenterX(), notifier.GetCenterY(), radius);
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+            for (WorldObject* target : map->GetCellSnapshot(CellPair(x, y)).objects)
+                if (target->IsUnit())
+                    notifier.CheckUnit(static_cast<Unit*>(target));
 }
 
 void Spell::FillRaidOrPartyTargets(UnitList& targetUnitMap, Unit* member, float radius, bool raid, bool withPets, bool withcaster) const
@@ -24,6 +24,8 @@
 #include "Globals/SharedDefines.h"
 #include "Server/DBCEnums.h"
 #include "Entities/ObjectGuid.h"
+#include "Maps/ObjectResolutionCache.h"
+#include "Entities/ObjectPool.h"
 #include "Entities/Unit.h"
 #include "Entities/Player.h"
 #include "Server/SQLStorages.h"
@@ -188,6 +190,8 @@ class SpellCastTargets
         ObjectGuid m_CorpseTargetGUID;
         ObjectGuid m_itemTargetGUID;
         uint32 m_itemTargetEntry;
+
+        ObjectResolutionCache m_resolution;                 // Update re-resolves the unit target every spell tick
 };
 
 inline ByteBuffer& operator<< (ByteBuffer& buf, SpellCastTargets const& targets)
@@ -281,6 +285,9 @@ class SpellEvent : public BasicEvent
         SpellEvent(Spell* spell);
         virtual ~SpellEvent();
 
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         virtual bool Execute(uint64 e_time, uint32 p_time) override;
         virtual void Abort(uint64 e_time) override;
         virtual bool IsDeletable() const override;
@@ -468,6 +475,11 @@ class Spell
         Spell(WorldObject* caster, SpellEntry const* info, uint32 triggeredFlags, ObjectGuid originalCasterGUID = ObjectGuid(), SpellEntry const* triggeredBy = nullptr);
         virtual ~Spell();
 
+        // every cast - and each of the hundreds of in-flight projectiles
+        // during raid AoE - is one of these; recycle the blocks
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         SpellCastResult SpellStart(SpellCastTargets const* targets, Aura* triggeredByAura = nullptr);
 
         void cancel();
@@ -1087,27 +1099,34 @@ namespace MaNGOS
         }
 
         template<class T> inline void Visit(GridRefManager<T>& m)
+        {
+            for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
+                CheckUnit(itr->getSource());
+        }
+
+        // runs the per-spell eligibility checks on one candidate - shared by
+        // the grid visitor and the cell snapshot walk in Spell::FillAreaTargets
+        inline void CheckUnit(Unit* unit)
         {
             if (!i_originalCaster || !i_castingObject)
                 return;
 
-            for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
             {
                 // there are still more spells which can be casted on dead, but
                 // they are no AOE and don't have such a nice SPELL_ATTR flag
                 // mostly phase check
-                if (!itr->getSource()->IsInMap(i_originalCaster) || itr->getSource()->IsTaxiFlying())
-                    continue;
+                if (!unit->IsInMap(i_originalCaster) || unit->IsTaxiFlying())
+                    return;
 
                 switch (i_TargetType)
                 {
                     case SPELL_TARGETS_CHAIN_ATTACKABLE:
-                        if (itr->getSource()->IsChainImmune())
-                            continue;
+                        if (unit->IsChainImmune())
+                            return;
                         break;
                     case SPELL_TARGETS_AOE_ATTACKABLE:
-                        if (itr->getSource()->IsAOEImmune())
-                            continue;
+                        if (unit->IsAOEImmune())
+                            return;
                         break;
                     default: break;
                 }
@@ -1115,19 +1134,19 @@ namespace MaNGOS
                 switch (i_TargetType)
                 {
                     case SPELL_TARGETS_ASSISTABLE:
-                        if (!i_originalCaster->CanAssistSpell(itr->getSource(), i_spell.m_spellInfo))
-                            continue;
+                        if (!i_originalCaster->CanAssistSpell(unit, i_spell.m_spellInfo))
+                            return;
                         break;
                     case SPELL_TARGETS_CHAIN_ATTACKABLE:
                     case SPELL_TARGETS_AOE_ATTACKABLE:
                     {
-                        if (!i_originalCaster->CanAttackSpell(itr->getSource(), i_spell.m_spellInfo, true))
-                            continue;
+                        if (!i_originalCaster->CanAttackSpell(unit, i_spell.m_spellInfo, true))
+                            return;
                     }
                     break;
                     case SPELL_TARGETS_ALL:
                         break;
-                    default: continue;
+                    default: return;
                 }
 
                 // we don't need to check InMap here, it's already done some lines above
@@ -1135,24 +1154,24 @@ namespace MaNGOS
                 {
                     case PUSH_CONE:
                     {
-                        float heightDifference = std::abs(itr->getSource()->GetPositionZ() - i_centerZ);
+                        float heightDifference = std::abs(unit->GetPositionZ() - i_centerZ);
                         float maxHeight = i_radius / 2;
-                        float distance = std::min(sqrtf(itr->getSource()->GetDistance2d(i_centerX, i_centerY, DIST_CALC_NONE)), i_radius);
+                        float distance = std::min(sqrtf(unit->GetDistance2d(i_centerX, i_centerY, DIST_CALC_NONE)), i_radius);
                         float ratio = distance / i_radius;
                         float conalMaxHeight = maxHeight * ratio; // pvp combat uses true cone from roughly model
-                        if (!i_originalCaster->IsControlledByPlayer() && itr->getSource()->IsControlledByPlayer())
+                        if (!i_originalCaster->IsControlledByPlayer() && unit->IsControlledByPlayer())
                             conalMaxHeight = maxHeight; // npcs just do a conal max Z aoe
                         if (i_cone >= 0.f)
                         {
-                            if (i_castingObject->isInFront(itr->getSource(), i_radius, i_cone) &&
-                                std::abs(itr->getSource()->GetPositionZ() - i_centerZ) - itr->getSource()->GetCombatReach() <= conalMaxHeight)
-                                i_data.push_back(itr->getSource());
+                            if (i_castingObject->isInFront(unit, i_radius, i_cone) &&
+                                std::abs(unit->GetPositionZ() - i_centerZ) - unit->GetCombatReach() <= conalMaxHeight)
+                                i_data.push_back(unit);
                         }
                         else
                         {
-                            if (i_castingObject->isInBack(itr->getSource(), i_radius, -i_cone) &&
-                                std::abs(itr->getSource()->GetPositionZ() - i_centerZ) - itr->getSource()->GetCombatReach() <= conalMaxHeight)
-                                i_data.push_back(itr->getSource());
+                            if (i_castingObject->isInBack(unit, i_radius, -i_cone) &&
+                                std::abs(unit->GetPositionZ() - i_centerZ) - unit->GetCombatReach() <= conalMaxHeight)
+                                i_data.push_back(unit);
                         }
                         break;
                     }
@@ -1161,10 +1180,10 @@ namespace MaNGOS
                     case PUSH_DEST_CENTER:
                     case PUSH_TARGET_CENTER:
                         float radius = i_radius;
-                        if (i_originalCaster->IsControlledByPlayer() && !itr->getSource()->IsControlledByPlayer())
-                            radius += itr->getSource()->GetCombatReach();
-                        if (itr->getSource()->GetDistance(i_centerX, i_centerY, i_centerZ, DIST_CALC_NONE) <= radius * radius)
-                            i_data.push_back(itr->getSource());
+                        if (i_originalCaster->IsControlledByPlayer() && !unit->IsControlledByPlayer())
+                            radius += unit->GetCombatReach();
+                        if (unit->GetDistance(i_centerX, i_centerY, i_centerZ, DIST_CALC_NONE) <= radius * radius)
+                            i_data.push_back(unit);
                         break;
                 }
             }
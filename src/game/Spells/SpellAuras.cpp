@@ -22,6 +22,7 @@
 #include "Server/WorldSession.h"
 #include "Server/Opcodes.h"
 #include "Log/Log.h"
+#include "World/MemoryTrend.h"
 #include "World/World.h"
 #include "Globals/ObjectMgr.h"
 #include "Spells/SpellMgr.h"
@@ -676,6 +677,12 @@ void Aura::ApplyModifier(bool apply, bool Real)
 {
     AuraType aura = m_modifier.m_auraname;
 
+    // handlers like HandleAuraModStat touch several UnitMods in a row; batch them so
+    // the dependent stats are recomputed once (the aura may be deleted by its handler,
+    // so keep the target pointer rather than asking this aura again)
+    Unit* target = GetTarget();
+    target->BeginStatBatch();
+
     if (apply)
         OnApply(apply);
     if (!apply)
@@ -686,6 +693,8 @@ void Aura::ApplyModifier(bool apply, bool Real)
         OnAfterApply(apply);
     if (!apply)
         OnApply(apply);
+
+    target->EndStatBatch();
 }
 
 ClassFamilyMask Aura::GetAuraSpellClassMask() const
@@ -1257,18 +1266,18 @@ void Aura::HandleAuraDummy(bool apply, bool Real)
                     }
                     case 6946:                              // Curse of the Bleakheart
                     case 41170:
-                        m_isPeriodic = true;
+                        SetPeriodic(true);
                         m_modifier.periodictime = 5 * IN_MILLISECONDS;
                         m_periodicTimer = m_modifier.periodictime;
                         return;
                     case 7057:                              // Haunting Spirits
                         // expected to tick with 30 sec period (tick part see in Aura::PeriodicTick)
-                        m_isPeriodic = true;
+                        SetPeriodic(true);
                         m_modifier.periodictime = 30 * IN_MILLISECONDS;
                         m_periodicTimer = m_modifier.periodictime;
                         return;
                     case 7054:                              // Forsaken Skill
-                        m_isPeriodic = true;
+                        SetPeriodic(true);
                         m_modifier.periodictime = 1 * IN_MILLISECONDS;
                         m_periodicTimer = m_modifier.periodictime;
                         break;
@@ -1281,7 +1290,7 @@ void Aura::HandleAuraDummy(bool apply, bool Real)
                     case 23487:                             // Separation Anxiety (Garr)
                     {
                         // expected to tick with 5 sec period (tick part see in Aura::PeriodicTick)
-                        m_isPeriodic = true;
+                        SetPeriodic(true);
                         m_modifier.periodictime = 5 * IN_MILLISECONDS;
                         m_periodicTimer = m_modifier.periodictime;
                         return;
@@ -3091,7 +3100,7 @@ void Aura::HandleAuraModStalked(bool apply, bool /*Real*/)
 
 void Aura::HandlePeriodicTriggerSpell(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     Unit* target = GetTarget();
 
@@ -3113,22 +3122,22 @@ void Aura::HandlePeriodicTriggerSpell(bool apply, bool /*Real*/)
 
 void Aura::HandlePeriodicTriggerSpellWithValue(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandlePeriodicEnergize(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandleAuraPowerBurn(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandlePeriodicHeal(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     Unit* target = GetTarget();
 
@@ -3159,7 +3168,7 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
     if (!Real)
         return;
 
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     Unit* target = GetTarget();
     SpellEntry const* spellProto = GetSpellProto();
@@ -3241,12 +3250,12 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
 
 void Aura::HandlePeriodicDamagePCT(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandlePeriodicLeech(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     // For prevent double apply bonuses
     bool loading = (GetTarget()->GetTypeId() == TYPEID_PLAYER && ((Player*)GetTarget())->GetSession()->PlayerLoading());
@@ -3267,7 +3276,7 @@ void Aura::HandlePeriodicLeech(bool apply, bool /*Real*/)
 
 void Aura::HandlePeriodicManaLeech(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     if (!apply)
     {
@@ -3284,7 +3293,7 @@ void Aura::HandlePeriodicManaLeech(bool apply, bool /*Real*/)
 
 void Aura::HandlePeriodicHealthFunnel(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     // For prevent double apply bonuses
     bool loading = (GetTarget()->GetTypeId() == TYPEID_PLAYER && ((Player*)GetTarget())->GetSession()->PlayerLoading());
@@ -3589,7 +3598,7 @@ void Aura::HandleAuraModResistenceOfStatPercent(bool /*apply*/, bool /*Real*/)
 /********************************/
 void Aura::HandleAuraModTotalHealthPercentRegen(bool apply, bool /*Real*/)
 {
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandleAuraModTotalManaPercentRegen(bool apply, bool /*Real*/)
@@ -3598,7 +3607,7 @@ void Aura::HandleAuraModTotalManaPercentRegen(bool apply, bool /*Real*/)
         m_modifier.periodictime = 1000;
 
     m_periodicTimer = m_modifier.periodictime;
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 
     if (GetId() == 30024 && !apply && m_removeMode == AURA_REMOVE_BY_DEFAULT) // Shade of Aran drink on interrupt
     {
@@ -3615,7 +3624,7 @@ void Aura::HandleModRegen(bool apply, bool /*Real*/)        // eating
         m_modifier.periodictime = 5000;
 
     m_periodicTimer = 5000;
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandleModPowerRegen(bool apply, bool Real)       // drinking
@@ -3638,7 +3647,7 @@ void Aura::HandleModPowerRegen(bool apply, bool Real)       // drinking
     if (GetTarget()->GetTypeId() == TYPEID_PLAYER && m_modifier.m_miscvalue == POWER_MANA)
         ((Player*)GetTarget())->UpdateManaRegen();
 
-    m_isPeriodic = apply;
+    SetPeriodic(apply);
 }
 
 void Aura::HandleModPowerRegenPCT(bool /*apply*/, bool Real)
@@ -5155,12 +5164,14 @@ SpellAuraHolder::SpellAuraHolder(SpellEntry const* spellproto, Unit* target, Wor
     m_stackAmount(1), m_timeCla(1000), m_removeMode(AURA_REMOVE_BY_DEFAULT),
     m_AuraDRGroup(DIMINISHING_NONE), m_permanent(false), m_isRemovedOnShapeLost(true),
     m_heartbeatResistChance(0), m_heartbeatResistTimer(0), m_heartbeatResistInterval(0),
-    m_deleted(false), m_skipUpdate(false),
+    m_deleted(false), m_skipUpdate(false), m_tickUpdateNeeded(true),
     m_auraScript(SpellScriptMgr::GetAuraScript(spellproto->Id))
 {
     MANGOS_ASSERT(target);
     MANGOS_ASSERT(spellproto && spellproto == sSpellTemplate.LookupEntry<SpellEntry>(spellproto->Id) && "`info` must be pointer to sSpellTemplate element");
 
+    MemoryTrend::Account(MEMTREND_AURAS, +1);
+
     if (!caster)
         m_casterGuid = target->GetObjectGuid();
     else
@@ -5175,6 +5186,10 @@ SpellAuraHolder::SpellAuraHolder(SpellEntry const* spellproto, Unit* target, Wor
 
     m_isRemovedOnShapeLost = IsRemovedOnShapeshiftLost(m_spellProto, GetCasterGuid(), target->GetObjectGuid());
 
+    // same flag resolution as IsTriggeredAtSpellProcEvent: db override wins
+    SpellProcEventEntry const* procEvent = sSpellMgr.GetSpellProcEvent(spellproto->Id);
+    m_procEventFlags = (procEvent && procEvent->procFlags) ? procEvent->procFlags : spellproto->procFlags;
+
     Unit* unitCaster = caster && caster->isType(TYPEMASK_UNIT) ? (Unit*)caster : nullptr;
 
     m_duration = m_maxDuration = CalculateSpellDuration(spellproto, unitCaster, target, m_auraScript);
@@ -5209,18 +5224,36 @@ SpellAuraHolder::SpellAuraHolder(SpellEntry const* spellproto, Unit* target, Wor
 void SpellAuraHolder::AddAura(Aura* aura, SpellEffectIndex index)
 {
     m_auras[index] = aura;
+    UpdateTickNeed();
 }
 
 void SpellAuraHolder::RemoveAura(SpellEffectIndex index)
 {
     m_auras[index] = nullptr;
+    UpdateTickNeed();
+}
+
+void SpellAuraHolder::UpdateTickNeed()
+{
+    // running duration also covers the per-second power cost and heartbeat
+    // resist timers, which Update only services while the holder counts down
+    bool needed = (m_duration > 0);
+    for (auto aura : m_auras)
+        if (aura && (aura->IsPeriodic() || aura->IsAreaAura() || aura->IsPersistent()))
+            needed = true;
+    m_tickUpdateNeeded = needed;
 }
 
 void SpellAuraHolder::ApplyAuraModifiers(bool apply, bool real)
 {
+    // collapse the stat recomputation of all effects of this holder into one pass
+    m_target->BeginStatBatch();
+
     for (int32 i = 0; i < MAX_EFFECT_INDEX && !IsDeleted(); ++i)
         if (Aura* aur = GetAuraByEffectIndex(SpellEffectIndex(i)))
             aur->ApplyModifier(apply, real);
+
+    m_target->EndStatBatch();
 }
 
 void SpellAuraHolder::_AddSpellAuraHolder()
@@ -5500,7 +5533,7 @@ Unit* SpellAuraHolder::GetCaster() const
     if (!m_target->IsInWorld())
         return nullptr;
 
-    return m_target->GetMap()->GetUnit(m_casterGuid);
+    return m_casterResolution.ResolveUnit(m_target->GetMap(), m_casterGuid);
 }
 
 bool SpellAuraHolder::IsWeaponBuffCoexistableWith(SpellAuraHolder const* ref) const
@@ -5653,6 +5686,8 @@ void Aura::HandleAuraSafeFall(bool /*Apply*/, bool /*Real*/)
 
 SpellAuraHolder::~SpellAuraHolder()
 {
+    MemoryTrend::Account(MEMTREND_AURAS, -1);
+
     // note: auras in delete list won't be affected since they clear themselves from holder when adding to deletedAuraslist
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         delete m_auras[i];
@@ -6194,9 +6229,9 @@ uint32 Aura::GetAuraScriptCustomizationValue()
 void Aura::ForcePeriodicity(uint32 periodicTime)
 {
     if (periodicTime == 0)
-        m_isPeriodic = false;
+        SetPeriodic(false);
     else
-        m_isPeriodic = true;
+        SetPeriodic(true);
     m_modifier.periodictime = periodicTime;
     m_periodicTimer = periodicTime;
 }
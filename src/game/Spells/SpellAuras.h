@@ -22,6 +22,8 @@
 #include "Spells/SpellAuraDefines.h"
 #include "Server/DBCEnums.h"
 #include "Entities/ObjectGuid.h"
+#include "Maps/ObjectResolutionCache.h"
+#include "Entities/ObjectPool.h"
 #include "Spells/Scripts/SpellScript.h"
 #include "Util/UniqueTrackablePtr.h"
 
@@ -96,6 +98,11 @@ class SpellAuraHolder
     public:
         SpellAuraHolder(SpellEntry const* spellproto, Unit* target, WorldObject* caster, Item* castItem, SpellEntry const* triggeredBy);
         ~SpellAuraHolder();
+
+        // holders churn at combat rates - recycle their storage through the spawn pool
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         Aura* m_auras[MAX_EFFECT_INDEX];
 
         void AddAura(Aura* aura, SpellEffectIndex index);
@@ -149,6 +156,17 @@ class SpellAuraHolder
         void Update(uint32 diff);
         void RefreshHolder();
 
+        // true when Update has per-tick work to do (periodic or area effects,
+        // running duration); recomputed on the events that change those, and
+        // only ever stale towards true, so skipping on false is always safe
+        bool IsTickUpdateNeeded() const { return m_tickUpdateNeeded; }
+        void UpdateTickNeed();
+
+        // effective proc flags (spell_proc_event override or spell proto), zero
+        // when this holder can never proc - such holders stay out of the
+        // per-unit proc list entirely
+        uint32 GetProcEventFlags() const { return m_procEventFlags; }
+
         TrackedAuraType GetTrackedAuraType() const { return m_trackedAuraType; }
         void SetTrackedAuraType(TrackedAuraType val) { m_trackedAuraType = val; }
         void UnregisterAndCleanupTrackedAuras();
@@ -156,7 +174,7 @@ class SpellAuraHolder
         int32 GetAuraMaxDuration() const { return m_maxDuration; }
         void SetAuraMaxDuration(int32 duration);
         int32 GetAuraDuration() const { return m_duration; }
-        void SetAuraDuration(int32 duration) { m_duration = duration; }
+        void SetAuraDuration(int32 duration) { m_duration = duration; UpdateTickNeed(); }
 
         void SetHeartbeatResist(uint32 chance, int32 originalDuration, uint32 drLevel);
 
@@ -216,6 +234,7 @@ class SpellAuraHolder
 
         Unit* m_target;
         ObjectGuid m_casterGuid;
+        mutable ObjectResolutionCache m_casterResolution;   // GetCaster runs every periodic tick; skip the store hash while the caster stays on the map
         ObjectGuid m_castItemGuid;                          // it is NOT safe to keep a pointer to the item because it may get deleted
         time_t m_applyTime;
         uint32 m_applyMSTime;
@@ -244,6 +263,9 @@ class SpellAuraHolder
         bool m_isRemovedOnShapeLost: 1;
         bool m_deleted: 1;
         bool m_skipUpdate: 1;
+        bool m_tickUpdateNeeded: 1;
+
+        uint32 m_procEventFlags;
 
         TimePoint m_procCooldown;
 
@@ -271,6 +293,11 @@ class Aura
         friend Aura* CreateAura(SpellEntry const* spellproto, SpellEffectIndex eff, int32 const* currentDamage, int32 const* currentBasePoints, SpellAuraHolder* holder, Unit* target, Unit* caster, Item* castItem, uint64 scriptValue);
 
     public:
+        // recycle aura storage through the spawn pool (covers the area aura
+        // subclasses via the deleting destructor, which passes the dynamic size)
+        static void* operator new(size_t size) { return MaNGOS::ObjectMemoryPool::Acquire(size); }
+        static void operator delete(void* ptr, size_t size) { MaNGOS::ObjectMemoryPool::Release(ptr, size); }
+
         // aura handlers
         void HandleNULL(bool, bool)
         {
@@ -452,6 +479,10 @@ class Aura
         bool IsPeriodic() const { return m_isPeriodic; }
         bool IsSaveToDbAura() const;
 
+        // all periodic flag changes go through here so the holder can refresh
+        // its tick-update need (handlers flip the flag well after AddAura)
+        void SetPeriodic(bool apply) { m_isPeriodic = apply; m_spellAuraHolder->UpdateTickNeed(); }
+
         void ApplyModifier(bool apply, bool Real = false);
 
         void UpdateAura(uint32 diff) { Update(diff); }
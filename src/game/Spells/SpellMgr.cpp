@@ -53,6 +53,153 @@ SpellMgr& SpellMgr::Instance()
     return spellMgr;
 }
 
+std::vector<SpellPositivityEntry> sSpellPositivity;
+std::vector<uint8> sSpellCheckCastMasks;
+
+// Mirrors the caster/target dependent branches of IsPositiveEffectTargetMode: only neutral
+// unit target modes (possibly behind a first-layer triggered spell) consult the actual caster
+// and target. Conservative - a conditional verdict just falls back to the full per-call check.
+static bool HasConditionalPositivity(SpellEntry const* entry, SpellEffectIndex effIndex, bool recursive = false)
+{
+    if (IsSpellEffectTriggerSpell(entry, effIndex))
+    {
+        const uint32 spellid = entry->EffectTriggerSpell[effIndex];
+        if (!recursive && spellid && spellid != entry->Id)
+            if (SpellEntry const* triggered = sSpellTemplate.LookupEntry<SpellEntry>(spellid))
+                for (uint32 i = EFFECT_INDEX_0; i < MAX_EFFECT_INDEX; ++i)
+                    if (HasConditionalPositivity(triggered, SpellEffectIndex(i), true))
+                        return true;
+        return false;
+    }
+
+    const uint32 a = entry->EffectImplicitTargetA[effIndex];
+    const uint32 b = entry->EffectImplicitTargetB[effIndex];
+
+    if ((!a && !b) || IsEffectTargetPositive(a, b) || IsEffectTargetScript(a, b))
+        return false;
+    if (IsEffectTargetNegative(a, b))
+        return false;
+    if (IsEffectTargetNeutral(a, b))
+    {
+        const uint32 etarget = (b ? b : a);
+        if (IsPointEffectTarget(SpellTarget(etarget)))
+            return false;
+        // IsNeutralEffectTargetPositive only inspects the caster and target for unit targets
+        return (etarget >= MAX_SPELL_TARGETS || SpellTargetInfoTable[etarget].type == TARGET_TYPE_UNIT);
+    }
+    return false;
+}
+
+void SpellMgr::ComputeSpellPositivity()
+{
+    sSpellPositivity.clear();                               // need for reload case
+    // zero initialized = SPELL_POSITIVITY_CONDITIONAL, so partially filled data stays correct
+    sSpellPositivity.resize(sSpellTemplate.GetMaxEntry());
+
+    uint32 conditional = 0;
+    for (uint32 id = 0; id < sSpellTemplate.GetMaxEntry(); ++id)
+    {
+        SpellEntry const* entry = sSpellTemplate.LookupEntry<SpellEntry>(id);
+        if (!entry)
+            continue;
+
+        for (uint32 i = EFFECT_INDEX_0; i < MAX_EFFECT_INDEX; ++i)
+        {
+            if (HasConditionalPositivity(entry, SpellEffectIndex(i)))
+            {
+                ++conditional;
+                continue;
+            }
+
+            sSpellPositivity[id].effect[i] = IsPositiveEffect(entry, SpellEffectIndex(i)) ? SPELL_POSITIVITY_POSITIVE : SPELL_POSITIVITY_NEGATIVE;
+            sSpellPositivity[id].targetMode[i] = IsPositiveEffectTargetMode(entry, SpellEffectIndex(i)) ? SPELL_POSITIVITY_POSITIVE : SPELL_POSITIVITY_NEGATIVE;
+        }
+    }
+
+    sLog.outString(">> Computed positivity for %u spells (%u caster dependent effects)", sSpellTemplate.GetRecordCount(), conditional);
+    sLog.outString();
+}
+
+uint32 ComputeSpellCheckCastMask(SpellEntry const* entry)
+{
+    uint32 mask = 0;
+
+    // GetErrorAtShapeshiftedCast and the stealth-only check are no-ops without
+    // stance data or the corresponding attributes
+    if (entry->Stances || entry->StancesNot || entry->HasAttribute(SPELL_ATTR_NOT_SHAPESHIFT) || entry->HasAttribute(SPELL_ATTR_ONLY_STEALTHED))
+        mask |= SPELL_PRECHECK_SHAPESHIFT;
+
+    if (NeedsComboPoints(entry))
+        mask |= SPELL_PRECHECK_COMBO_POINTS;
+
+    // families and effects the Loatheb/Nefarian class call override scripts react to
+    {
+        bool const shapeshift = IsSpellHaveAura(entry, SPELL_AURA_MOD_SHAPESHIFT);
+        bool const healOrDispel = IsSpellHaveEffect(entry, SPELL_EFFECT_HEAL) ||
+                                  IsSpellHaveAura(entry, SPELL_AURA_PERIODIC_HEAL) ||
+                                  IsSpellHaveEffect(entry, SPELL_EFFECT_DISPEL);
+        switch (entry->SpellFamilyName)
+        {
+            case SPELLFAMILY_DRUID:
+                if (shapeshift || healOrDispel)
+                    mask |= SPELL_PRECHECK_OVERRIDE_SCRIPT;
+                break;
+            case SPELLFAMILY_PRIEST:
+            case SPELLFAMILY_SHAMAN:
+            case SPELLFAMILY_PALADIN:
+                if (healOrDispel)
+                    mask |= SPELL_PRECHECK_OVERRIDE_SCRIPT;
+                break;
+            case SPELLFAMILY_WARRIOR:
+                if (shapeshift)
+                    mask |= SPELL_PRECHECK_OVERRIDE_SCRIPT;
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (int32 reagent : entry->Reagent)
+        if (reagent > 0)
+            mask |= SPELL_PRECHECK_REAGENTS;
+
+    for (uint32 totem : entry->Totem)
+        if (totem)
+            mask |= SPELL_PRECHECK_TOTEMS;
+
+    for (uint32 effect : entry->Effect)
+    {
+        switch (effect)
+        {
+            case SPELL_EFFECT_CREATE_ITEM:
+            case SPELL_EFFECT_ENCHANT_ITEM:
+            case SPELL_EFFECT_ENCHANT_ITEM_TEMPORARY:
+            case SPELL_EFFECT_DISENCHANT:
+            case SPELL_EFFECT_WEAPON_DAMAGE:
+            case SPELL_EFFECT_WEAPON_DAMAGE_NOSCHOOL:
+                mask |= SPELL_PRECHECK_ITEM_EFFECTS;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return mask;
+}
+
+void SpellMgr::ComputeSpellCheckCastMasks()
+{
+    sSpellCheckCastMasks.clear();                           // need for reload case
+    sSpellCheckCastMasks.resize(sSpellTemplate.GetMaxEntry());
+
+    for (uint32 id = 0; id < sSpellTemplate.GetMaxEntry(); ++id)
+        if (SpellEntry const* entry = sSpellTemplate.LookupEntry<SpellEntry>(id))
+            sSpellCheckCastMasks[id] = uint8(ComputeSpellCheckCastMask(entry));
+
+    sLog.outString(">> Computed cast check masks for %u spells", sSpellTemplate.GetRecordCount());
+    sLog.outString();
+}
+
 int32 GetSpellDuration(SpellEntry const* spellInfo)
 {
     if (!spellInfo)
@@ -1603,6 +1750,8 @@ void SpellMgr::LoadSpellChains()
             mSpellChainsNext.insert(SpellChainMapNext::value_type(node.req, spell_id));
     }
 
+    mSpellChainsNext.finalize();                            // before the redundancy check below queries it
+
     // check single rank redundant cases (single rank talents not added by default so this can be only custom cases)
     for (SpellChainMap::const_iterator i = mSpellChains.begin(); i != mSpellChains.end(); ++i)
     {
@@ -1619,6 +1768,20 @@ void SpellMgr::LoadSpellChains()
 
     sLog.outString(">> Loaded %u spell chain records (%u from DBC data with %u req field updates, and %u loaded from table)", dbc_count + new_count, dbc_count, req_count, new_count);
     sLog.outString();
+
+    // flat rank-by-id and node-by-id caches so hot paths do not pay the chain map lookup
+    mSpellRankCache.clear();                                // need for reload case
+    mSpellRankCache.resize(sSpellTemplate.GetMaxEntry(), 0);
+    mSpellChainCache.clear();
+    mSpellChainCache.resize(sSpellTemplate.GetMaxEntry(), nullptr);
+    for (SpellChainMap::const_iterator i = mSpellChains.begin(); i != mSpellChains.end(); ++i)
+    {
+        if (i->first < mSpellRankCache.size())
+        {
+            mSpellRankCache[i->first] = i->second.rank;
+            mSpellChainCache[i->first] = &i->second;
+        }
+    }
 }
 
 void SpellMgr::LoadSpellLearnSkills()
@@ -2356,6 +2519,9 @@ void SpellMgr::LoadSkillLineAbilityMaps()
         }
     }
 
+    mSkillLineAbilityMapBySpellId.finalize();
+    mSkillLineAbilityMapBySkillId.finalize();
+
     sLog.outString(">> Loaded %u SkillLineAbility MultiMaps Data", count);
     sLog.outString();
 }
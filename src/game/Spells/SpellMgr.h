@@ -36,6 +36,7 @@
 #include "Spells/SpellAuras.h"
 #include "Server/SQLStorages.h"
 #include "Spells/SpellEffectDefines.h"
+#include "Util/FlatMultiMap.h"
 
 #include <map>
 
@@ -1108,11 +1109,62 @@ inline bool IsNeutralEffectTargetPositive(uint32 etarget, const WorldObject* cas
     return !caster->CanAttackSpell(static_cast<const Unit*>(target));
 }
 
+// Load-time precomputed positivity verdicts, see SpellMgr::ComputeSpellPositivity
+enum SpellEffectPositivity : uint8
+{
+    SPELL_POSITIVITY_CONDITIONAL = 0,                       // depends on the actual caster and target (neutral target modes) - compute per call
+    SPELL_POSITIVITY_POSITIVE    = 1,
+    SPELL_POSITIVITY_NEGATIVE    = 2,
+};
+
+struct SpellPositivityEntry
+{
+    uint8 effect[MAX_EFFECT_INDEX];                         // verdict of IsPositiveEffect
+    uint8 targetMode[MAX_EFFECT_INDEX];                     // verdict of IsPositiveEffectTargetMode
+};
+
+// flat sidecar array indexed by spell id; empty until computed after spell template load
+extern std::vector<SpellPositivityEntry> sSpellPositivity;
+
+// Load-time precomputed screens of cast validation work this spell can ever
+// fail, derived from static spell data - Spell::CheckCast and Spell::CheckItems
+// skip whole check groups whose bit is absent. See ComputeSpellCheckCastMasks.
+enum SpellCheckCastFlags
+{
+    SPELL_PRECHECK_SHAPESHIFT      = 0x01,                  // has stance requirements or is restricted while shapeshifted/unstealthed
+    SPELL_PRECHECK_COMBO_POINTS    = 0x02,                  // finishing move, requires a combo target
+    SPELL_PRECHECK_OVERRIDE_SCRIPT = 0x04,                  // candidate for the Loatheb/Nefarian class call override scripts
+    SPELL_PRECHECK_REAGENTS        = 0x08,                  // consumes reagents
+    SPELL_PRECHECK_TOTEMS          = 0x10,                  // requires totem items present in inventory
+    SPELL_PRECHECK_ITEM_EFFECTS    = 0x20,                  // has an effect with its own item validation in CheckItems
+};
+
+uint32 ComputeSpellCheckCastMask(SpellEntry const* entry);
+
+// flat sidecar array indexed by spell id; empty until computed after spell template load
+extern std::vector<uint8> sSpellCheckCastMasks;
+
+inline uint32 GetSpellCheckCastMask(SpellEntry const* entry)
+{
+    if (entry->Id < sSpellCheckCastMasks.size())
+        return sSpellCheckCastMasks[entry->Id];
+    return ComputeSpellCheckCastMask(entry);
+}
+
 inline bool IsPositiveEffectTargetMode(const SpellEntry* entry, SpellEffectIndex effIndex, const WorldObject* caster = nullptr, const WorldObject* target = nullptr, bool recursive = false)
 {
     if (!entry)
         return false;
 
+    // fast path: verdict resolved at load time unless it depends on the actual caster and target
+    // (recursive calls keep the original one-layer trigger scan semantics instead)
+    if (!recursive && entry->Id < sSpellPositivity.size())
+    {
+        uint8 const cached = sSpellPositivity[entry->Id].targetMode[effIndex];
+        if (cached != SPELL_POSITIVITY_CONDITIONAL)
+            return cached == SPELL_POSITIVITY_POSITIVE;
+    }
+
     // Triggered spells case: prefer child spell via IsPositiveSpell()-like scan for triggered spell
     if (IsSpellEffectTriggerSpell(entry, effIndex))
     {
@@ -1160,6 +1212,14 @@ inline bool IsPositiveEffect(const SpellEntry* spellproto, SpellEffectIndex effI
     if (!spellproto)
         return false;
 
+    // fast path: verdict resolved at load time unless it depends on the actual caster and target
+    if (spellproto->Id < sSpellPositivity.size())
+    {
+        uint8 const cached = sSpellPositivity[spellproto->Id].effect[effIndex];
+        if (cached != SPELL_POSITIVITY_CONDITIONAL)
+            return cached == SPELL_POSITIVITY_POSITIVE;
+    }
+
     switch (spellproto->Effect[effIndex])
     {
         case SPELL_EFFECT_SEND_TAXI:                // Some NPCs that send taxis are neutral, so target mode fails
@@ -1892,7 +1952,7 @@ struct SpellChainNode
 };
 
 typedef std::unordered_map<uint32, SpellChainNode> SpellChainMap;
-typedef std::multimap<uint32, uint32> SpellChainMapNext;
+typedef FlatMultiMap<uint32, uint32> SpellChainMapNext;     // flattened: finalized at the end of LoadSpellChains
 
 // Spell learning properties (accessed using SpellMgr functions)
 struct SpellLearnSkillNode
@@ -1914,7 +1974,9 @@ struct SpellLearnSpellNode
 typedef std::multimap<uint32, SpellLearnSpellNode> SpellLearnSpellMap;
 typedef std::pair<SpellLearnSpellMap::const_iterator, SpellLearnSpellMap::const_iterator> SpellLearnSpellMapBounds;
 
-typedef std::multimap<uint32, SkillLineAbilityEntry const*> SkillLineAbilityMap;
+// flattened: per-spell/per-skill spans are scanned on every trainer window
+// build and spell learning cascade, finalized in LoadSkillLineAbilityMaps
+typedef FlatMultiMap<uint32, SkillLineAbilityEntry const*> SkillLineAbilityMap;
 typedef std::pair<SkillLineAbilityMap::const_iterator, SkillLineAbilityMap::const_iterator> SkillLineAbilityMapBounds;
 
 typedef std::multimap<uint32, SkillRaceClassInfoEntry const*> SkillRaceClassInfoMap;
@@ -2136,6 +2198,10 @@ class SpellMgr
         // Spell ranks chains
         SpellChainNode const* GetSpellChainNode(uint32 spell_id) const
         {
+            // flat cache filled at the end of LoadSpellChains
+            if (spell_id < mSpellChainCache.size())
+                return mSpellChainCache[spell_id];
+
             SpellChainMap::const_iterator itr = mSpellChains.find(spell_id);
             if (itr == mSpellChains.end())
                 return nullptr;
@@ -2195,6 +2261,10 @@ class SpellMgr
         // Use IsSpellHigherRankOfSpell instead
         uint8 GetSpellRank(uint32 spell_id) const
         {
+            // flat cache filled at the end of LoadSpellChains
+            if (spell_id < mSpellRankCache.size())
+                return mSpellRankCache[spell_id];
+
             if (SpellChainNode const* node = GetSpellChainNode(spell_id))
                 return node->rank;
 
@@ -2206,17 +2276,17 @@ class SpellMgr
             if (spellId1 == spellId2)
                 return false;
 
-            SpellChainMap::const_iterator itr = mSpellChains.find(spellId1);
+            SpellChainNode const* node = GetSpellChainNode(spellId1);
 
             uint32 rank2 = GetSpellRank(spellId2);
 
             // not ordered correctly by rank value
-            if (itr == mSpellChains.end() || !rank2 || itr->second.rank <= rank2)
+            if (!node || !rank2 || node->rank <= rank2)
                 return false;
 
             // check present in same rank chain
-            for (; itr != mSpellChains.end(); itr = mSpellChains.find(itr->second.prev))
-                if (itr->second.prev == spellId2)
+            for (; node; node = GetSpellChainNode(node->prev))
+                if (node->prev == spellId2)
                     return true;
 
             return false;
@@ -2387,6 +2457,10 @@ class SpellMgr
 
         // Loading data at server startup
         void LoadSpellChains();
+        // fills the sSpellPositivity sidecar; must be after spell template load
+        void ComputeSpellPositivity();
+        // fills the sSpellCheckCastMasks sidecar; must be after spell template load
+        void ComputeSpellCheckCastMasks();
         void LoadSpellLearnSkills();
         void LoadSpellLearnSpells();
         void LoadSpellScriptTarget();
@@ -2404,6 +2478,8 @@ class SpellMgr
 
     private:
         SpellChainMap      mSpellChains;
+        std::vector<uint8> mSpellRankCache;                 // rank by spell id, parallel to sSpellTemplate
+        std::vector<SpellChainNode const*> mSpellChainCache; // chain node by spell id, parallel to sSpellTemplate
         SpellChainMapNext  mSpellChainsNext;
         SpellLearnSkillMap mSpellLearnSkills;
         SpellLearnSpellMap mSpellLearnSpells;
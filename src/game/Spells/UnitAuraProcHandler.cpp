@@ -412,17 +412,21 @@ void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
 {
     ProcExecutionData execData(argData, isVictim);
 
+    // common case: nothing on this unit reacts to these proc flags - holders
+    // without any proc flags are never in m_procHolders to begin with
+    if (!(m_procHolderMask & execData.procFlags))
+        return;
+
     ProcTriggeredVector procTriggered;
     std::vector<SpellAuraHolder*> holdersForDeletion;
     // Fill procTriggered list
-    for (SpellAuraHolderMap::const_iterator itr = GetSpellAuraHolderMap().begin(); itr != GetSpellAuraHolderMap().end(); ++itr)
+    for (SpellAuraHolder* holder : m_procHolders)
     {
-        SpellAuraHolder* holder = itr->second;
         // skip deleted auras (possible at recursive triggered call
         if (holder->GetState() != SPELLAURAHOLDER_STATE_READY || holder->IsDeleted())
             continue;
 
-        ProcTriggeredData procTriggeredData(nullptr, itr->second);
+        ProcTriggeredData procTriggeredData(nullptr, holder);
 
         SpellProcEventTriggerCheck result = IsTriggeredAtSpellProcEvent(execData, holder, procTriggeredData.spellProcEvent, procTriggeredData.canProc);
         if (holder->GetSpellProto()->HasAttribute(SPELL_ATTR_PROC_FAILURE_BURNS_CHARGE) &&
@@ -21,6 +21,7 @@
 #include "Database/DatabaseEnv.h"
 #include "Globals/ObjectMgr.h"
 #include "Accounts/AccountMgr.h"
+#include "World/World.h"
 
 // Character Dump tables
 struct DumpTable
@@ -338,7 +339,7 @@ void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char con
     while (guids && guids_itr != guids->end());             // not set case iterate single time, set case iterate for all guids
 }
 
-std::string PlayerDumpWriter::GetDump(uint32 guid)
+std::string PlayerDumpWriter::GetDumpHeader()
 {
     std::string dump;
 
@@ -373,6 +374,13 @@ std::string PlayerDumpWriter::GetDump(uint32 guid)
     else
         sLog.outError("Character DB not have 'character_db_version' table, revision guard query not added to pdump.");
 
+    return dump;
+}
+
+std::string PlayerDumpWriter::GetDump(uint32 guid)
+{
+    std::string dump = GetDumpHeader();
+
     for (DumpTable* itr = &dumpTables[0]; itr->isValid(); ++itr)
         DumpTableContent(dump, guid, itr->name, itr->name, itr->type);
 
@@ -388,9 +396,20 @@ DumpReturn PlayerDumpWriter::WriteDump(const std::string& file, uint32 guid)
     if (!fout)
         return DUMP_FILE_OPEN_ERROR;
 
-    std::string dump = GetDump(guid);
+    // stream the dump to the file table by table instead of accumulating the
+    // whole character in one string: bulk transfers write hundreds of dumps
+    // in a row and the item/mail tables dominate the size
+    std::string dump = GetDumpHeader();
+    fprintf(fout, "%s", dump.c_str());
 
-    fprintf(fout, "%s\n", dump.c_str());
+    for (DumpTable* itr = &dumpTables[0]; itr->isValid(); ++itr)
+    {
+        dump.clear();
+        DumpTableContent(dump, guid, itr->name, itr->name, itr->type);
+        fprintf(fout, "%s", dump.c_str());
+    }
+
+    fprintf(fout, "\n");
     fclose(fout);
     return DUMP_SUCCESS;
 }
@@ -457,6 +476,22 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
     typedef PetIds::value_type PetIdsPair;
     PetIds petids;
 
+    // consecutive rows of one table (the dump is grouped by table) are merged
+    // into multi-row inserts, so the transaction executes one bulk statement
+    // per table instead of one statement per row
+    std::string batchTable;
+    std::string batchSql;
+    auto flushBatch = [&batchSql]() -> bool
+    {
+        if (batchSql.empty())
+            return true;
+
+        batchSql += ";";
+        bool ok = CharacterDatabase.Execute(batchSql.c_str());
+        batchSql.clear();
+        return ok;
+    };
+
     CharacterDatabase.BeginTransaction();
     while (!feof(fin))
     {
@@ -480,7 +515,7 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
         // add required_ check
         if (line.substr(nw_pos, 41) == "UPDATE character_db_version SET required_")
         {
-            if (!CharacterDatabase.Execute(line.c_str()))
+            if (!flushBatch() || !CharacterDatabase.Execute(line.c_str()))
                 ROLLBACK(DUMP_FILE_BROKEN);
 
             continue;
@@ -665,10 +700,35 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
                 break;
         }
 
-        if (!CharacterDatabase.Execute(line.c_str()))
+        // cut the values tuple out of the single-row insert and append it to
+        // the batch for its table
+        std::string::size_type valuesPos = line.find("VALUES (");
+        std::string::size_type valuesEnd = line.find_last_of(')');
+        if (valuesPos == std::string::npos || valuesEnd == std::string::npos || valuesEnd < valuesPos)
             ROLLBACK(DUMP_FILE_BROKEN);
+
+        std::string values = line.substr(valuesPos + 7, valuesEnd - valuesPos - 6);
+
+        if (tn != batchTable || batchSql.size() + values.size() + 4 > MAX_QUERY_LEN)
+        {
+            if (!flushBatch())
+                ROLLBACK(DUMP_FILE_BROKEN);
+
+            batchTable = tn;
+        }
+
+        if (batchSql.empty())
+            batchSql = std::string("INSERT INTO ") + _TABLE_SIM_ + tn + _TABLE_SIM_ + " VALUES " + values;
+        else
+        {
+            batchSql += ", ";
+            batchSql += values;
+        }
     }
 
+    if (!flushBatch())
+        ROLLBACK(DUMP_FILE_BROKEN);
+
     CharacterDatabase.CommitTransaction();
 
     // FIXME: current code with post-updating guids not safe for future per-map threads
@@ -679,6 +739,10 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
     if (incHighest)
         sObjectMgr.m_CharGuids.Set(sObjectMgr.m_CharGuids.GetNextAfterMaxUsed() + 1);
 
+    // the import added a characters row behind the cached lookups
+    ObjectMgr::InvalidateCharacterLookupCache();
+    sWorld.InvalidateCharacterEnumCache(account);
+
     fclose(fin);
 
     return DUMP_SUCCESS;
@@ -76,6 +76,7 @@ class PlayerDumpWriter : public PlayerDump
         typedef std::set<uint32> GUIDs;
 
         void DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type);
+        static std::string GetDumpHeader();
         static std::string GenerateWhereStr(char const* field, GUIDs const& guids, GUIDs::const_iterator& itr);
         static std::string GenerateWhereStr(char const* field, uint32 guid);
 
@@ -342,7 +342,11 @@ void Weather::LogWeatherState(WeatherState state) const
 //                  Weather System
 // ---------------------------------------------------------
 
-WeatherSystem::WeatherSystem(Map const* _map) : m_map(_map)
+// Weather only changes on a minutes-scale interval, so per-zone timer
+// bookkeeping is batched onto this slow tick instead of every map update
+#define WEATHER_SLOW_TICK (5 * IN_MILLISECONDS)
+
+WeatherSystem::WeatherSystem(Map const* _map) : m_map(_map), m_slowTickTime(0)
 {}
 
 WeatherSystem::~WeatherSystem()
@@ -370,6 +374,15 @@ Weather* WeatherSystem::FindOrCreateWeather(uint32 zoneId)
 /// Update Weathers for the different zones
 void WeatherSystem::UpdateWeathers(uint32 diff)
 {
+    ///- Accumulate elapsed time until the slow tick passes, so a map tick
+    ///  normally does no weather work at all
+    m_slowTickTime += diff;
+    if (m_slowTickTime < WEATHER_SLOW_TICK)
+        return;
+
+    diff = m_slowTickTime;
+    m_slowTickTime = 0;
+
     ///- Send an update signal to Weather objects
     for (WeatherMap::iterator itr = m_weathers.begin(); itr != m_weathers.end();)
     {
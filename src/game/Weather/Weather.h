@@ -118,6 +118,7 @@ class WeatherSystem
 
         typedef std::unordered_map<uint32 /*zoneId*/, Weather*> WeatherMap;
         WeatherMap m_weathers;
+        uint32 m_slowTickTime;
 };
 
 // ---------------------------------------------------------
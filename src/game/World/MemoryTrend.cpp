@@ -0,0 +1,142 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "World/MemoryTrend.h"
+#include "Chat/Chat.h"
+#include "World/World.h"
+
+#ifdef BUILD_METRICS
+#include "Metric/Metric.h"
+#endif
+
+#ifdef __linux__
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+INSTANTIATE_SINGLETON_1(MemoryTrend);
+
+std::atomic<int64> MemoryTrend::m_liveCounters[MEMTREND_COUNT];
+
+namespace
+{
+    // one sample per memtrend timer firing (5 min), one week of history
+    constexpr size_t MAX_RETAINED = 7 * DAY / (5 * MINUTE);
+
+    char const* SeriesName(MemTrendSeries series)
+    {
+        switch (series)
+        {
+            case MEMTREND_SESSIONS: return "sessions";
+            case MEMTREND_AURAS:    return "auras";
+            case MEMTREND_PACKETS:  return "packets";
+            case MEMTREND_LOOT:     return "loot";
+            case MEMTREND_SCRIPTS:  return "scripts";
+            case MEMTREND_OBJECTS:  return "objects";
+            case MEMTREND_RSS_KB:   return "rss_kb";
+            default:                return "unknown";
+        }
+    }
+
+    int64 GetResidentSetKB()
+    {
+#ifdef __linux__
+        if (FILE* statm = fopen("/proc/self/statm", "r"))
+        {
+            long total = 0, resident = 0;
+            int const parsed = fscanf(statm, "%ld %ld", &total, &resident);
+            fclose(statm);
+            if (parsed == 2)
+                return int64(resident) * (sysconf(_SC_PAGESIZE) / 1024);
+        }
+#endif
+        // no portable source elsewhere; the per-subsystem counters still work
+        return 0;
+    }
+}
+
+void MemoryTrend::Sample()
+{
+    TrendSample sample;
+    sample.time = time(nullptr);
+
+    for (uint32 i = 0; i < MEMTREND_COUNT; ++i)
+        sample.values[i] = GetLiveCount(MemTrendSeries(i));
+
+    // the sampled (non-counter) series
+    sample.values[MEMTREND_SESSIONS] = sWorld.GetActiveAndQueuedSessionCount();
+    sample.values[MEMTREND_RSS_KB] = GetResidentSetKB();
+
+    m_samples.push_back(sample);
+    while (m_samples.size() > MAX_RETAINED)
+        m_samples.pop_front();
+
+#ifdef BUILD_METRICS
+    metric::metric::instance().report("memory.trend",
+    {
+        { "sessions", sample.values[MEMTREND_SESSIONS] },
+        { "auras", sample.values[MEMTREND_AURAS] },
+        { "packets", sample.values[MEMTREND_PACKETS] },
+        { "loot", sample.values[MEMTREND_LOOT] },
+        { "scripts", sample.values[MEMTREND_SCRIPTS] },
+        { "objects", sample.values[MEMTREND_OBJECTS] },
+        { "rss_kb", sample.values[MEMTREND_RSS_KB] },
+    }, {});
+#endif
+}
+
+void MemoryTrend::Report(ChatHandler& handler, uint32 hours) const
+{
+    if (m_samples.size() < 2)
+    {
+        handler.PSendSysMessage("Memory trend: not enough samples yet (one every 5 minutes).");
+        return;
+    }
+
+    TrendSample const& now = m_samples.back();
+
+    // oldest sample inside the requested window
+    time_t const cutoff = now.time - time_t(hours) * HOUR;
+    TrendSample const* base = &m_samples.front();
+    for (TrendSample const& sample : m_samples)
+    {
+        if (sample.time >= cutoff)
+        {
+            base = &sample;
+            break;
+        }
+    }
+
+    float const spanHours = float(now.time - base->time) / HOUR;
+    if (spanHours <= 0.0f)
+    {
+        handler.PSendSysMessage("Memory trend: window shorter than the sample interval.");
+        return;
+    }
+
+    handler.PSendSysMessage("Memory trend over the last %.1f hours (%u samples retained):",
+        spanHours, uint32(m_samples.size()));
+
+    for (uint32 i = 0; i < MEMTREND_COUNT; ++i)
+    {
+        int64 const delta = now.values[i] - base->values[i];
+        handler.PSendSysMessage("  %-8s: now " SI64FMTD ", then " SI64FMTD ", %+lld (%+.1f/hr)",
+            SeriesName(MemTrendSeries(i)), now.values[i], base->values[i],
+            (long long)delta, float(delta) / spanHours);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_MEMORYTREND_H
+#define MANGOS_MEMORYTREND_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <atomic>
+#include <deque>
+
+class ChatHandler;
+
+enum MemTrendSeries
+{
+    MEMTREND_SESSIONS   = 0,                                // world sessions (active + queued), sampled
+    MEMTREND_AURAS      = 1,                                // live SpellAuraHolder instances
+    MEMTREND_PACKETS    = 2,                                // live heap WorldPacket instances
+    MEMTREND_LOOT       = 3,                                // live Loot instances
+    MEMTREND_SCRIPTS    = 4,                                // queued dbscript actions across all maps
+    MEMTREND_OBJECTS    = 5,                                // live world Object instances (items, units, GOs, corpses)
+    MEMTREND_RSS_KB     = 6,                                // process resident set, sampled from the OS
+    MEMTREND_COUNT      = 7
+};
+
+/**
+ * Long-uptime memory trend bookkeeping.
+ *
+ * High-churn subsystems keep a live instance counter (bumped from their
+ * constructors/destructors or operator new/delete, cheap relaxed atomics),
+ * and the world samples all of them together with the process RSS on a
+ * fixed cadence into a ring of snapshots. Slow growth can then be
+ * attributed to a subsystem with .server memtrend instead of guessing
+ * from RSS alone, and each sample is reported as a memory.trend metric
+ * when metrics are built in.
+ */
+class MemoryTrend
+{
+    public:
+        // live counter hook, callable from any thread
+        static void Account(MemTrendSeries series, int32 delta)
+        {
+            m_liveCounters[series].fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        static int64 GetLiveCount(MemTrendSeries series)
+        {
+            return m_liveCounters[series].load(std::memory_order_relaxed);
+        }
+
+        // take a snapshot of all series; called by World::Update on the memtrend timer
+        void Sample();
+
+        // print the growth per series over the last hours to the chat handler
+        void Report(ChatHandler& handler, uint32 hours) const;
+
+    private:
+        struct TrendSample
+        {
+            time_t time;
+            int64 values[MEMTREND_COUNT];
+        };
+
+        static std::atomic<int64> m_liveCounters[MEMTREND_COUNT];
+
+        std::deque<TrendSample> m_samples;                  // oldest first, trimmed to MAX_RETAINED
+};
+
+// RAII live-instance marker: added as a member it counts every constructor
+// of the enclosing class (copies included) without touching each one
+template <MemTrendSeries Series>
+struct MemTrendCounted
+{
+    MemTrendCounted() { MemoryTrend::Account(Series, +1); }
+    MemTrendCounted(MemTrendCounted const&) { MemoryTrend::Account(Series, +1); }
+    MemTrendCounted& operator=(MemTrendCounted const&) { return *this; }
+    ~MemTrendCounted() { MemoryTrend::Account(Series, -1); }
+};
+
+#define sMemoryTrend MaNGOS::Singleton<MemoryTrend>::Instance()
+
+#endif
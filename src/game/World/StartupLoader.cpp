@@ -0,0 +1,80 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "World/StartupLoader.h"
+#include "Log/Log.h"
+#include "Util/ProgressBar.h"
+
+#include <atomic>
+#include <thread>
+
+void StartupLoader::AddStep(char const* name, std::function<void()> work)
+{
+    m_steps.push_back(Step{ name, std::move(work) });
+}
+
+void StartupLoader::Run(uint32 numThreads)
+{
+    if (m_steps.empty())
+        return;
+
+    if (numThreads > uint32(m_steps.size()))
+        numThreads = uint32(m_steps.size());
+
+    if (numThreads <= 1)
+    {
+        for (Step const& step : m_steps)
+        {
+            sLog.outString("Loading %s...", step.name);
+            step.work();
+        }
+        m_steps.clear();
+        return;
+    }
+
+    // per-row progress bars from concurrent steps would interleave into
+    // garbage - suppress them for the batch and report aggregate progress
+    bool const barState = BarGoLink::GetOutputState();
+    BarGoLink::SetOutputState(false);
+
+    uint32 const total = uint32(m_steps.size());
+    std::atomic<uint32> nextStep(0);
+    std::atomic<uint32> doneSteps(0);
+
+    auto worker = [&]()
+    {
+        while (true)
+        {
+            uint32 const index = nextStep.fetch_add(1);
+            if (index >= total)
+                return;
+
+            m_steps[index].work();
+            sLog.outString(">> [%u/%u] %s loaded", doneSteps.fetch_add(1) + 1, total, m_steps[index].name);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < numThreads; ++i)
+        threads.push_back(std::thread(worker));
+    for (std::thread& thread : threads)
+        thread.join();
+
+    BarGoLink::SetOutputState(barState);
+    m_steps.clear();
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_STARTUPLOADER_H
+#define MANGOS_STARTUPLOADER_H
+
+#include "Platform/Define.h"
+
+#include <functional>
+#include <vector>
+
+/**
+ * Runs a batch of independent world startup loading steps side by side.
+ *
+ * World::SetInitialWorldSettings is one long sequential chain, but many of
+ * its steps only fill their own container from their own table. Those can be
+ * queued into a batch here and run on worker threads; ordering constraints
+ * between batches are expressed simply by running the batches in order.
+ * Steps queued into the same batch must not touch shared mutable state -
+ * every call site documents why its steps are independent.
+ *
+ * Database reads are safe from worker threads: synchronous queries go
+ * through the round-robin connection pool and every connection carries its
+ * own lock. While a batch runs in parallel, the per-row progress bars are
+ * suppressed (concurrent bars interleave into garbage) and replaced by one
+ * aggregate line per finished step.
+ *
+ * StartupLoader.Threads <= 1 keeps the old strictly sequential behaviour.
+ */
+class StartupLoader
+{
+    public:
+        void AddStep(char const* name, std::function<void()> work);
+
+        // executes all queued steps and waits for completion
+        void Run(uint32 numThreads);
+
+    private:
+        struct Step
+        {
+            char const* name;
+            std::function<void()> work;
+        };
+
+        std::vector<Step> m_steps;
+};
+
+#endif
@@ -21,12 +21,16 @@
 */
 
 #include "World/World.h"
+#include "Tools/Language.h"
+#include "revision.h"
 #include "Database/DatabaseEnv.h"
 #include "Config/Config.h"
 #include "Platform/Define.h"
 #include "SystemConfig.h"
 #include "Log/Log.h"
 #include "Server/Opcodes.h"
+#include "Server/OpcodeStatistics.h"
+#include "Server/PacketRateLimiter.h"
 #include "Server/WorldSession.h"
 #include "Server/WorldPacket.h"
 #include "Entities/Player.h"
@@ -44,6 +48,13 @@
 #include "Loot/LootMgr.h"
 #include "Entities/ItemEnchantmentMgr.h"
 #include "Maps/MapManager.h"
+#include "Maps/MapWorkers.h"
+#include "MotionGenerators/PathFinderService.h"
+#include "Maps/TerrainPrefetcher.h"
+#include "Server/StressTestMgr.h"
+#include "Server/ReplayMgr.h"
+#include "Server/PacketLog.h"
+#include "World/StartupLoader.h"
 #include "DBScripts/ScriptMgr.h"
 #include "AI/CreatureAIRegistry.h"
 #include "Policies/Singleton.h"
@@ -64,6 +75,7 @@
 #include "Entities/CreatureLinkingMgr.h"
 #include "Weather/Weather.h"
 #include "Cinematics/CinematicMgr.h"
+#include "World/MemoryTrend.h"
 #include "World/WorldState.h"
 #include "Maps/TransportMgr.h"
 #include "Anticheat/Anticheat.hpp"
@@ -77,6 +89,7 @@
 #ifdef BUILD_METRICS
  #include "Metric/Metric.h"
 #endif
+#include "Metric/FrameProfiler.h"
 
 #ifdef ENABLE_PLAYERBOTS
 #include "ahbot/AhBot.h"
@@ -103,6 +116,7 @@ float World::m_MaxVisibleDistanceInInstances  = DEFAULT_VISIBILITY_INSTANCE;
 float World::m_MaxVisibleDistanceInBG         = DEFAULT_VISIBILITY_BG;
 
 float  World::m_relocation_lower_limit_sq = 10.f * 10.f;
+float  World::m_relocation_ai_lower_limit_sq = 3.f * 3.f;
 uint32 World::m_relocation_ai_notify_delay = 1000u;
 
 uint32 World::m_currentMSTime = 0;
@@ -121,6 +135,8 @@ World::World(): mail_timer(0), mail_timer_expires(0), m_NextWeeklyQuestReset(0),
 {
     m_playerLimit = 0;
     m_allowMovement = true;
+    m_standby = false;
+    m_randomSeed = 0;
     m_ShutdownMask = 0;
     m_ShutdownTimer = 0;
     m_gameTime = time(nullptr);
@@ -132,17 +148,8 @@ World::World(): mail_timer(0), mail_timer_expires(0), m_NextWeeklyQuestReset(0),
     m_defaultDbcLocale = DEFAULT_LOCALE;
     m_availableDbcLocaleMask = 0;
 
-    for (unsigned int& m_configUint32Value : m_configUint32Values)
-        m_configUint32Value = 0;
-
-    for (int& m_configInt32Value : m_configInt32Values)
-        m_configInt32Value = 0;
-
-    for (float& m_configFloatValue : m_configFloatValues)
-        m_configFloatValue = 0.0f;
-
-    for (bool& m_configBoolValue : m_configBoolValues)
-        m_configBoolValue = false;
+    m_configStaging = WorldConfigValues();                  // zero-initialize all values
+    m_configValues.store(new WorldConfigValues(m_configStaging), std::memory_order_release);
 }
 
 /// World destructor
@@ -150,6 +157,13 @@ World::~World()
 {
     // it is assumed that no other thread is accessing this data when the destructor is called.  therefore, no locks are necessary
 
+    // stop the command worker before sessions go away, it may still hold one
+    if (m_commandThread.joinable())
+    {
+        m_commandThreadStop.store(true, std::memory_order_release);
+        m_commandThread.join();
+    }
+
     ///- Empty the kicked session set
     for (auto const session : m_sessions)
         delete session.second;
@@ -157,8 +171,14 @@ World::~World()
     for (auto const cliCommand : m_cliCommandQueue)
         delete cliCommand;
 
-    for (auto const session : m_sessionAddQueue)
-        delete session;
+    {
+        WorldSession* session;
+        while (m_sessionAddQueue.Dequeue(session))
+            delete session;
+    }
+
+    if (m_sessionUpdater.activated())
+        m_sessionUpdater.deactivate();
 
     VMAP::VMapFactory::clear();
     MMAP::MMapFactory::clear();
@@ -167,6 +187,12 @@ World::~World()
         m_lfgQueueThread.join();
     if (m_bgQueueThread.joinable())
         m_bgQueueThread.join();
+    if (m_auctionSearchThread.joinable())
+        m_auctionSearchThread.join();
+
+    // no readers remain: release the published config bundle and any retired ones
+    PruneRetiredConfigValues(true);
+    delete m_configValues.load(std::memory_order_acquire);
 }
 
 /// Cleanups before world stop
@@ -175,10 +201,16 @@ void World::CleanupsBeforeStop()
 #ifdef ENABLE_PLAYERBOTS
     sRandomPlayerbotMgr.LogoutAllBots();
 #endif
+    sStressTestMgr.Stop();                           // log out synthetic sessions before the real ones
+    sReplayMgr.Stop();
     KickAll(true);                                   // save and kick all players
     UpdateSessions(1);                               // real players unload required UpdateSessions call
     sBattleGroundMgr.DeleteAllBattleGrounds();       // unload battleground templates before different singletons destroyed
+    sPathFinderService.Deactivate();                 // stop path workers before the maps and navmeshes go away
+    sTerrainPrefetcher.Deactivate();                 // stop background terrain loads before the terrain goes away
     sMapMgr.UnloadAll();                             // unload all grids (including locked in memory)
+    sMapPersistentStateMgr.FlushRespawnJournal();    // persist pending respawn time changes before the database goes away
+    sAnticheatLib->Shutdown();                       // stop the anticheat worker thread
 }
 
 /// Find a session by its id
@@ -191,6 +223,32 @@ WorldSession* World::FindSession(uint32 id) const
     return nullptr;
 }
 
+/// Cache the built character enum payload for an account
+void World::SetCharacterEnumCache(uint32 accountId, std::vector<uint8> data)
+{
+    std::lock_guard<std::mutex> guard(m_charEnumCacheMutex);
+    m_charEnumCache[accountId] = std::move(data);
+}
+
+/// Fetch the cached character enum payload for an account, if any
+bool World::GetCharacterEnumCache(uint32 accountId, std::vector<uint8>& data) const
+{
+    std::lock_guard<std::mutex> guard(m_charEnumCacheMutex);
+    auto itr = m_charEnumCache.find(accountId);
+    if (itr == m_charEnumCache.end())
+        return false;
+
+    data = itr->second;
+    return true;
+}
+
+/// Drop the cached character enum payload after anything that changes enum-visible data
+void World::InvalidateCharacterEnumCache(uint32 accountId)
+{
+    std::lock_guard<std::mutex> guard(m_charEnumCacheMutex);
+    m_charEnumCache.erase(accountId);
+}
+
 /// Remove a given session
 bool World::RemoveSession(uint32 id)
 {
@@ -209,9 +267,38 @@ bool World::RemoveSession(uint32 id)
 
 void World::AddSession(WorldSession* s)
 {
-    std::lock_guard<std::mutex> guard(m_sessionAddQueueLock);
+    m_sessionAddQueue.Enqueue(s);
+}
+
+void World::ScheduleOffThreadCommand(std::function<void()> task)
+{
+    // lazy start is race-free: commands are only scheduled from the world thread
+    if (!m_commandThread.joinable())
+    {
+        m_commandThread = std::thread([this]()
+        {
+            std::function<void()> queued;
+            while (true)
+            {
+                bool idle = true;
+                while (m_commandQueue.Dequeue(queued))
+                {
+                    idle = false;
+                    queued();
+                }
+
+                if (idle)
+                {
+                    if (m_commandThreadStop.load(std::memory_order_acquire))
+                        return;
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+        });
+    }
 
-    m_sessionAddQueue.push_back(s);
+    m_commandQueue.Enqueue(std::move(task));
 }
 
 void
@@ -481,6 +568,8 @@ void World::LoadConfigSettings(bool reload)
 
     ///- Read other configuration items from the config file
     setConfigMinMax(CONFIG_UINT32_COMPRESSION, "Compression", 1, 1, 9);
+    setConfigMinMax(CONFIG_UINT32_COMPRESSION_LARGE_LEVEL, "CompressionLargeLevel", 1, 1, 9);
+    setConfig(CONFIG_UINT32_COMPRESSION_LARGE_SIZE, "CompressionLargeSize", 8192);
     setConfig(CONFIG_BOOL_ADDON_CHANNEL, "AddonChannel", true);
     setConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB, "CleanCharacterDB", true);
     setConfig(CONFIG_BOOL_GRID_UNLOAD, "GridUnload", true);
@@ -501,6 +590,10 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_INTERVAL_SAVE, "PlayerSave.Interval", 15 * MINUTE * IN_MILLISECONDS);
     setConfigMinMax(CONFIG_UINT32_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, 0, MAX_LEVEL);
     setConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
+    setConfig(CONFIG_BOOL_CHAR_ENUM_CACHE, "CharacterEnumCache", false);
+    setConfig(CONFIG_BOOL_VENDOR_LIST_CACHE, "VendorListCache", true);
+
+    setConfig(CONFIG_UINT32_GRID_WARMUP_GRIDS_PER_TICK, "GridWarmup.GridsPerTick", 4);
 
     setConfigMin(CONFIG_UINT32_INTERVAL_GRIDCLEAN, "GridCleanUpDelay", 5 * MINUTE * IN_MILLISECONDS, MIN_GRID_DELAY);
     if (reload)
@@ -512,6 +605,8 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_UINT32_INTERVAL_CHANGEWEATHER, "ChangeWeatherInterval", 10 * MINUTE * IN_MILLISECONDS);
 
+    setConfig(CONFIG_UINT32_COMBAT_LOG_COALESCE_DELAY, "CombatLogCoalesceDelay", 50);
+
     if (configNoReload(reload, CONFIG_UINT32_PORT_WORLD, "WorldServerPort", DEFAULT_WORLDSERVER_PORT))
         setConfig(CONFIG_UINT32_PORT_WORLD, "WorldServerPort", DEFAULT_WORLDSERVER_PORT);
 
@@ -618,6 +713,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
     setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 10, 1);
+    setConfigMin(CONFIG_UINT32_MASS_MAILER_BATCH_PER_TICK, "MassMailer.BatchPerTick", 1000, 1);
 
     setConfig(CONFIG_UINT32_UPTIME_UPDATE, "UpdateUptimeInterval", 10);
     if (reload)
@@ -627,6 +723,21 @@ void World::LoadConfigSettings(bool reload)
     }
 
     setConfig(CONFIG_UINT32_NUM_MAP_THREADS, "MapUpdate.Threads", 3);
+    setConfig(CONFIG_UINT32_NUM_SESSION_THREADS, "SessionUpdate.Threads", 0);
+    setConfig(CONFIG_UINT32_PATHFINDER_THREADS, "PathFinder.AsyncThreads", 0);
+    setConfig(CONFIG_BOOL_TERRAIN_PREFETCH, "Terrain.Prefetch", false);
+    setConfig(CONFIG_BOOL_TERRAIN_QUANTIZE_FLOAT_HEIGHTS, "Terrain.QuantizeFloatHeights", true);
+    setConfig(CONFIG_UINT32_STARTUP_LOAD_THREADS, "StartupLoader.Threads", 0);
+    setConfig(CONFIG_UINT32_STRESS_TEST_SESSIONS, "StressTest.Sessions", 0);
+    setConfig(CONFIG_UINT32_STRESS_TEST_MOVE_INTERVAL, "StressTest.MoveInterval", 500);
+    setConfig(CONFIG_UINT32_STRESS_TEST_CAST_INTERVAL, "StressTest.CastInterval", 5000);
+    setConfig(CONFIG_UINT32_STRESS_TEST_CAST_SPELL, "StressTest.CastSpell", 0);
+    setConfig(CONFIG_UINT32_STRESS_TEST_CHAT_INTERVAL, "StressTest.ChatInterval", 10000);
+    setConfig(CONFIG_UINT32_AI_LOD_DISTANCE, "AILod.Distance", 60);
+    setConfig(CONFIG_UINT32_AI_LOD_INTERVAL, "AILod.Interval", 2000);
+    setConfig(CONFIG_BOOL_MAP_UPDATE_PARALLEL_OBJECTS, "MapUpdate.ParallelObjectUpdates", false);
+    setConfig(CONFIG_UINT32_MAP_UPDATE_TICK_BUDGET, "MapUpdate.TickBudget", 0);
+    setConfig(CONFIG_UINT32_MAP_UPDATE_CONTINENT_SHARDS, "MapUpdate.ContinentShards", 0);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_ORANGE, "SkillChance.Orange", 100);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_YELLOW, "SkillChance.Yellow", 75);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_GREEN,  "SkillChance.Green",  25);
@@ -719,6 +830,22 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_BOOL_OUTDOORPVP_EP_ENABLED,                       "OutdoorPvp.EPEnabled", true);
 
     setConfig(CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET, "Network.KickOnBadPacket", false);
+    setConfig(CONFIG_UINT32_MOVEMENT_COALESCE_WINDOW, "Network.MovementCoalesceWindow", 0);
+
+    setConfig(CONFIG_BOOL_PACKET_RATE_LIMIT,                          "Network.PacketRateLimit.Enable", false);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_MOVEMENT_RATE,          "Network.PacketRateLimit.MovementRate", 60);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_MOVEMENT_BURST,         "Network.PacketRateLimit.MovementBurst", 180);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_CHAT_RATE,              "Network.PacketRateLimit.ChatRate", 10);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_CHAT_BURST,             "Network.PacketRateLimit.ChatBurst", 30);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_ADDON_RATE,             "Network.PacketRateLimit.AddonRate", 40);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_ADDON_BURST,            "Network.PacketRateLimit.AddonBurst", 120);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_QUERY_RATE,             "Network.PacketRateLimit.QueryRate", 25);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_QUERY_BURST,            "Network.PacketRateLimit.QueryBurst", 100);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_OTHER_RATE,             "Network.PacketRateLimit.OtherRate", 50);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_OTHER_BURST,            "Network.PacketRateLimit.OtherBurst", 150);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_DISCONNECT_THRESHOLD,   "Network.PacketRateLimit.DisconnectThreshold", 100);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_BAN_STRIKES,            "Network.PacketRateLimit.BanStrikes", 3);
+    setConfig(CONFIG_UINT32_PACKET_RATE_LIMIT_BAN_DURATION,           "Network.PacketRateLimit.BanDuration", 600);
 
     setConfig(CONFIG_BOOL_PLAYER_COMMANDS, "PlayerCommands", true);
 
@@ -746,6 +873,7 @@ void World::LoadConfigSettings(bool reload)
 
     m_relocation_ai_notify_delay = sConfig.GetIntDefault("Visibility.AIRelocationNotifyDelay", 1000u);
     m_relocation_lower_limit_sq = pow(sConfig.GetFloatDefault("Visibility.RelocationLowerLimit", 10), 2);
+    m_relocation_ai_lower_limit_sq = pow(sConfig.GetFloatDefault("Visibility.AIRelocationLowerLimit", 3), 2);
 
     // Visibility on Continents
     m_MaxVisibleDistanceOnContinents      = sConfig.GetFloatDefault("Visibility.Distance.Continents",     DEFAULT_VISIBILITY_DISTANCE);
@@ -786,6 +914,16 @@ void World::LoadConfigSettings(bool reload)
         m_MaxVisibleDistanceInBG = MAX_VISIBILITY_DISTANCE;
     }
 
+    // Visibility governor: grids holding more players than the threshold get
+    // their effective visibility distance scaled down (0 = disabled)
+    setConfig(CONFIG_UINT32_VISIBILITY_GOVERNOR_PLAYERS_PER_GRID, "Visibility.Governor.PlayersPerGrid", 120);
+    setConfigPos(CONFIG_FLOAT_VISIBILITY_GOVERNOR_MIN_DISTANCE, "Visibility.Governor.MinDistance", 60.0f);
+    if (getConfig(CONFIG_FLOAT_VISIBILITY_GOVERNOR_MIN_DISTANCE) < 45 * getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO))
+    {
+        sLog.outError("Visibility.Governor.MinDistance can't be less max aggro radius %f", 45 * getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO));
+        setConfig(CONFIG_FLOAT_VISIBILITY_GOVERNOR_MIN_DISTANCE, 45 * getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO));
+    }
+
     ///- Load the CharDelete related config options
     setConfigMinMax(CONFIG_UINT32_CHARDELETE_METHOD, "CharDelete.Method", 0, 0, 1);
     setConfigMinMax(CONFIG_UINT32_CHARDELETE_MIN_LEVEL, "CharDelete.MinLevel", 0, 0, getConfig(CONFIG_UINT32_MAX_PLAYER_LEVEL));
@@ -833,10 +971,12 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_BOOL_MMAP_ENABLED, "mmap.enabled", true);
     std::string ignoreMapIds = sConfig.GetStringDefault("mmap.ignoreMapIds");
     setConfig(CONFIG_BOOL_PRELOAD_MMAP_TILES, "mmap.preload", false);
+    setConfig(CONFIG_BOOL_MMAP_MEMORY_MAPPED, "mmap.memoryMapped", false);
     MMAP::MMapFactory::preventPathfindingOnMaps(ignoreMapIds.c_str());
     bool enabledPathfinding = getConfig(CONFIG_BOOL_MMAP_ENABLED);
     sLog.outString("WORLD: MMap pathfinding %sabled", enabledPathfinding ? "en" : "dis");
     MMAP::MMapFactory::createOrGetMMapManager()->SetEnabled(enabledPathfinding);
+    MMAP::MMapFactory::createOrGetMMapManager()->SetMemoryMapped(getConfig(CONFIG_BOOL_MMAP_MEMORY_MAPPED));
 
     setConfig(CONFIG_BOOL_PATH_FIND_OPTIMIZE, "PathFinder.OptimizePath", true);
     setConfig(CONFIG_BOOL_PATH_FIND_NORMALIZE_Z, "PathFinder.NormalizeZ", false);
@@ -908,12 +1048,66 @@ void World::LoadConfigSettings(bool reload)
 /// Initialize the World
 void World::SetInitialWorldSettings()
 {
-    ///- Initialize the random number generator
-    srand((unsigned int)time(nullptr));
-
     ///- Time server startup
     uint32 uStartTime = WorldTimer::getMSTime();
 
+    m_standby = sConfig.GetBoolDefault("Standby.Enable", false);
+
+    LoadStaticData();
+
+    if (m_standby)
+    {
+        // warm standby: everything immutable is resident, the live-state phase
+        // runs from ActivateStandby when the failover trigger fires
+        sLog.outString("---------------------------------------");
+        sLog.outString("    CMANGOS: World standing by warm    ");
+        sLog.outString("---------------------------------------");
+        sLog.outString();
+
+        uint32 uStartInterval = WorldTimer::getMSTimeDiff(uStartTime, WorldTimer::getMSTime());
+        sLog.outString("STANDBY PRELOAD TIME: %i minutes %i seconds", uStartInterval / 60000, (uStartInterval % 60000) / 1000);
+        sLog.outString();
+        return;
+    }
+
+    InitializeLiveState();
+
+    sLog.outString("---------------------------------------");
+    sLog.outString("      CMANGOS: World initialized       ");
+    sLog.outString("---------------------------------------");
+    sLog.outString();
+
+    uint32 uStartInterval = WorldTimer::getMSTimeDiff(uStartTime, WorldTimer::getMSTime());
+    sLog.outString("SERVER STARTUP TIME: %i minutes %i seconds", uStartInterval / 60000, (uStartInterval % 60000) / 1000);
+    sLog.outString();
+}
+
+/// Standby mode: bring the pre-loaded world live after the primary went down
+void World::ActivateStandby()
+{
+    uint32 uStartTime = WorldTimer::getMSTime();
+
+    InitializeLiveState();
+
+    sLog.outString("---------------------------------------");
+    sLog.outString("      CMANGOS: World initialized       ");
+    sLog.outString("---------------------------------------");
+    sLog.outString();
+
+    uint32 uStartInterval = WorldTimer::getMSTimeDiff(uStartTime, WorldTimer::getMSTime());
+    sLog.outString("STANDBY ACTIVATION TIME: %i minutes %i seconds", uStartInterval / 60000, (uStartInterval % 60000) / 1000);
+    sLog.outString();
+}
+
+/// Load everything that is immutable while the server runs: configs, DBC stores,
+/// templates, localization and scripts. Writes nothing a live primary could be
+/// using, so a warm standby process may run this against the same databases.
+void World::LoadStaticData()
+{
+    ///- Initialize the random number generator
+    m_randomSeed = (unsigned int)time(nullptr);             // recorded in the replay capture header
+    srand(m_randomSeed);
+
     ///- Initialize detour memory management
     dtAllocSetCustom(dtCustomAlloc, dtCustomFree);
 
@@ -941,21 +1135,16 @@ void World::SetInitialWorldSettings()
         exit(1);                                            // Error message displayed in function already
     }
 
-    ///- Update the realm entry in the database with the realm type from the config file
-    // No SQL injection as values are treated as integers
-
-    // not send custom type REALM_FFA_PVP to realm list
-    uint32 server_type = IsFFAPvPRealm() ? uint32(REALM_TYPE_PVP) : getConfig(CONFIG_UINT32_GAME_TYPE);
-    uint32 realm_zone = getConfig(CONFIG_UINT32_REALM_ZONE);
-    LoginDatabase.PExecute("UPDATE realmlist SET icon = %u, timezone = %u WHERE id = '%u'", server_type, realm_zone, realmID);
-
-    ///- Remove the bones (they should not exist in DB though) and old corpses after a restart
-    CharacterDatabase.PExecute("DELETE FROM corpse WHERE corpse_type = '0' OR time < (" _UNIXTIME_ "-'%u')", 3 * DAY);
-
     /// load spell_dbc first! dbc's need them
     sLog.outString("Loading spell_template...");
     sObjectMgr.LoadSpellTemplate();
 
+    sLog.outString("Computing spell positivity...");
+    sSpellMgr.ComputeSpellPositivity();
+
+    sLog.outString("Computing spell cast check masks...");
+    sSpellMgr.ComputeSpellCheckCastMasks();
+
     sLog.outString("Loading spell groups...");
     sSpellStacker.LoadSpellGroups();
 
@@ -1002,14 +1191,19 @@ void World::SetInitialWorldSettings()
     sSpellMgr.LoadSkillRaceClassInfoMap();
 
     ///- Clean up and pack instances
-    sLog.outString("Packing instances...");
-    sMapPersistentStateMgr.PackInstances();
+    if (!m_standby)
+    {
+        // renumbering rows while the primary still owns the databases would
+        // corrupt its live state - a standby defers this to activation
+        sLog.outString("Packing instances...");
+        sMapPersistentStateMgr.PackInstances();
 
-    sLog.outString("Cleaning up instances...");
-    sMapPersistentStateMgr.CleanupInstances();              // must be called before `creature_respawn`/`gameobject_respawn` tables and after pack instances
+        sLog.outString("Cleaning up instances...");
+        sMapPersistentStateMgr.CleanupInstances();          // must be called before `creature_respawn`/`gameobject_respawn` tables and after pack instances
 
-    sLog.outString("Packing groups...");
-    sObjectMgr.PackGroupIds();                              // must be after CleanupInstances
+        sLog.outString("Packing groups...");
+        sObjectMgr.PackGroupIds();                          // must be after CleanupInstances
+    }
 
     ///- Init highest guids before any guid using table loading to prevent using not initialized guids in some code.
     sObjectMgr.SetHighestGuids();                           // must be after packing instances
@@ -1243,8 +1437,15 @@ void World::SetInitialWorldSettings()
     sLog.outString("Loading Pet Name Parts...");
     sObjectMgr.LoadPetNames();
 
-    CharacterDatabaseCleaner::CleanDatabase();
-    sLog.outString();
+    if (!m_standby)
+    {
+        // writes to the character DB the primary still owns - a standby
+        // defers this to activation like the instance/group packing above
+        CharacterDatabaseCleaner::CleanDatabase();
+        sLog.outString();
+    }
+
+    ObjectMgr::RegisterCharacterLookupCache();
 
     sLog.outString("Loading the max pet number...");
     sObjectMgr.LoadPetNumber();
@@ -1256,8 +1457,8 @@ void World::SetInitialWorldSettings()
     sObjectMgr.LoadCorpses();
 
     sLog.outString("Loading Loot Tables...");
-    LootIdSet ids_set;
-    LoadLootTables(ids_set);
+    m_lootIdsPendingCheck.clear();
+    LoadLootTables(m_lootIdsPendingCheck);
     sLog.outString(">>> Loot Tables loaded");
     sLog.outString();
 
@@ -1307,40 +1508,40 @@ void World::SetInitialWorldSettings()
     sLog.outString("Loading Waypoints...");
     sWaypointMgr.Load();
 
-    sLog.outString("Loading ReservedNames...");
-    sObjectMgr.LoadReservedPlayersNames();
-
-    sLog.outString("Loading GameObjects for quests...");
-    sObjectMgr.LoadGameObjectForQuests();
-
-    sLog.outString("Loading BattleMasters...");
-    sBattleGroundMgr.LoadBattleMastersEntry(false);
-
-    sLog.outString("Loading BattleGround event indexes...");
-    sBattleGroundMgr.LoadBattleEventIndexes(false);
-
-    sLog.outString("Loading GameTeleports...");
-    sObjectMgr.LoadGameTele();
-
-    sLog.outString("Loading Questgiver Greetings...");
-    sObjectMgr.LoadQuestgiverGreeting();
-
-    sLog.outString("Loading Trainer Greetings...");
-    sObjectMgr.LoadTrainerGreetings();
+    {
+        // independent world data - every step fills only its own container
+        // and reads nothing but templates loaded further up, so the batch
+        // may run on parallel startup threads
+        StartupLoader loader;
+        loader.AddStep("ReservedNames", [] { sObjectMgr.LoadReservedPlayersNames(); });
+        loader.AddStep("GameObjects for quests", [] { sObjectMgr.LoadGameObjectForQuests(); });
+        loader.AddStep("BattleMasters", [] { sBattleGroundMgr.LoadBattleMastersEntry(false); });
+        loader.AddStep("BattleGround event indexes", [] { sBattleGroundMgr.LoadBattleEventIndexes(false); });
+        loader.AddStep("GameTeleports", [] { sObjectMgr.LoadGameTele(); });
+        loader.AddStep("Questgiver Greetings", [] { sObjectMgr.LoadQuestgiverGreeting(); });
+        loader.AddStep("Trainer Greetings", [] { sObjectMgr.LoadTrainerGreetings(); });
+        loader.Run(getConfig(CONFIG_UINT32_STARTUP_LOAD_THREADS));
+    }
 
     ///- Loading localization data
     sLog.outString("Loading Localization strings...");
-    sObjectMgr.LoadCreatureLocales();                       // must be after CreatureInfo loading
-    sObjectMgr.LoadGameObjectLocales();                     // must be after GameobjectInfo loading
-    sObjectMgr.LoadItemLocales();                           // must be after ItemPrototypes loading
-    sObjectMgr.LoadQuestLocales();                          // must be after QuestTemplates loading
-    sObjectMgr.LoadGossipTextLocales();                     // must be after LoadGossipText
-    sObjectMgr.LoadPageTextLocales();                       // must be after PageText loading
-    sObjectMgr.LoadGossipMenuItemsLocales();                // must be after gossip menu items loading
-    sObjectMgr.LoadPointOfInterestLocales();                // must be after POI loading
-    sObjectMgr.LoadQuestgiverGreetingLocales();
-    sObjectMgr.LoadTrainerGreetingLocales();                // must be after CreatureInfo loading
-    sObjectMgr.LoadBroadcastTextLocales();
+    {
+        // each locale loader only fills its own map; the shared storage
+        // locale index is guarded inside GetOrNewStorageLocaleIndexFor
+        StartupLoader loader;
+        loader.AddStep("Creature locales", [] { sObjectMgr.LoadCreatureLocales(); });                   // must be after CreatureInfo loading
+        loader.AddStep("Gameobject locales", [] { sObjectMgr.LoadGameObjectLocales(); });               // must be after GameobjectInfo loading
+        loader.AddStep("Item locales", [] { sObjectMgr.LoadItemLocales(); });                           // must be after ItemPrototypes loading
+        loader.AddStep("Quest locales", [] { sObjectMgr.LoadQuestLocales(); });                         // must be after QuestTemplates loading
+        loader.AddStep("NPC text locales", [] { sObjectMgr.LoadGossipTextLocales(); });                 // must be after LoadGossipText
+        loader.AddStep("Page text locales", [] { sObjectMgr.LoadPageTextLocales(); });                  // must be after PageText loading
+        loader.AddStep("Gossip menu option locales", [] { sObjectMgr.LoadGossipMenuItemsLocales(); });  // must be after gossip menu items loading
+        loader.AddStep("Points of interest locales", [] { sObjectMgr.LoadPointOfInterestLocales(); });  // must be after POI loading
+        loader.AddStep("Questgiver greeting locales", [] { sObjectMgr.LoadQuestgiverGreetingLocales(); });
+        loader.AddStep("Trainer greeting locales", [] { sObjectMgr.LoadTrainerGreetingLocales(); });    // must be after CreatureInfo loading
+        loader.AddStep("Broadcast text locales", [] { sObjectMgr.LoadBroadcastTextLocales(); });
+        loader.Run(getConfig(CONFIG_UINT32_STARTUP_LOAD_THREADS));
+    }
     sLog.outString(">>> Localization strings loaded");
     sLog.outString();
 
@@ -1349,25 +1550,6 @@ void World::SetInitialWorldSettings()
     sWorld.GetLFGQueue().LoadMeetingStones();
 #endif
 
-    ///- Load dynamic data tables from the database
-    sLog.outString("Loading Auctions...");
-    sAuctionMgr.LoadAuctionItems();
-    sAuctionMgr.LoadAuctions();
-    sLog.outString(">>> Auctions loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Guilds...");
-    sGuildMgr.LoadGuilds();
-
-    sLog.outString("Loading Groups...");
-    sObjectMgr.LoadGroups();
-
-    sLog.outString("Returning old mails...");
-    sObjectMgr.ReturnOrDeleteOldMails(false);
-
-    sLog.outString("Loading GM tickets...");
-    sTicketMgr.LoadGMTickets();
-
     ///- Load and initialize EventAI Scripts
     sLog.outString("Loading CreatureEventAI Summons...");
     sEventAIMgr.LoadCreatureEventAI_Summons(false);         // false, will checked in LoadCreatureEventAI_Scripts
@@ -1400,6 +1582,69 @@ void World::SetInitialWorldSettings()
     // after spellscripts
     sScriptDevAIMgr.CheckScriptNames();
 
+    ///- Initialize static helper structures
+    AIRegistry::Initialize();
+}
+
+/// Initialize everything tied to this process owning the realm: database
+/// cleanup, dynamic tables, timers, subsystem threads and the map system.
+/// Runs directly after LoadStaticData on a normal startup, or deferred until
+/// the failover trigger when the process was booted as a warm standby.
+void World::InitializeLiveState()
+{
+    ///- Update the realm entry in the database with the realm type from the config file
+    // No SQL injection as values are treated as integers
+
+    // not send custom type REALM_FFA_PVP to realm list
+    uint32 server_type = IsFFAPvPRealm() ? uint32(REALM_TYPE_PVP) : getConfig(CONFIG_UINT32_GAME_TYPE);
+    uint32 realm_zone = getConfig(CONFIG_UINT32_REALM_ZONE);
+    LoginDatabase.PExecute("UPDATE realmlist SET icon = %u, timezone = %u WHERE id = '%u'", server_type, realm_zone, realmID);
+
+    ///- Remove the bones (they should not exist in DB though) and old corpses after a restart
+    CharacterDatabase.PExecute("DELETE FROM corpse WHERE corpse_type = '0' OR time < (" _UNIXTIME_ "-'%u')", 3 * DAY);
+
+    if (m_standby)
+    {
+        ///- Catch up on the maintenance LoadStaticData had to defer while the primary owned the databases
+        sLog.outString("Packing instances...");
+        sMapPersistentStateMgr.PackInstances();
+
+        sLog.outString("Cleaning up instances...");
+        sMapPersistentStateMgr.CleanupInstances();          // must be called before `creature_respawn`/`gameobject_respawn` tables and after pack instances
+
+        sLog.outString("Packing groups...");
+        sObjectMgr.PackGroupIds();                          // must be after CleanupInstances
+
+        CharacterDatabaseCleaner::CleanDatabase();
+
+        sObjectMgr.SetHighestGuids();                       // refresh: the primary kept allocating guids while we stood by
+        sLog.outString();
+
+        m_standby = false;
+    }
+
+    ///- Load dynamic data tables from the database
+    sLog.outString("Loading Auctions...");
+    sAuctionMgr.LoadAuctionItems();
+    sAuctionMgr.LoadAuctions();
+    sLog.outString(">>> Auctions loaded");
+    sLog.outString();
+
+    sLog.outString("Loading Guilds...");
+    sGuildMgr.LoadGuilds();
+
+    sLog.outString("Loading Petitions...");
+    sGuildMgr.LoadPetitions();
+
+    sLog.outString("Loading Groups...");
+    sObjectMgr.LoadGroups();
+
+    sLog.outString("Returning old mails...");
+    sObjectMgr.ReturnOrDeleteOldMails(false);
+
+    sLog.outString("Loading GM tickets...");
+    sTicketMgr.LoadGMTickets();
+
     ///- Initialize game time and timers
     sLog.outString("Initialize game time and timers");
     m_gameTime = time(nullptr);
@@ -1429,6 +1674,12 @@ void World::SetInitialWorldSettings()
     // Update groups with offline leader after delay in seconds
     m_timers[WUPDATE_GROUPS].SetInterval(IN_MILLISECONDS);
 
+    // Publish the read-only status snapshot consumed by SOAP/RA threads
+    m_timers[WUPDATE_STATUS_SNAPSHOT].SetInterval(5 * IN_MILLISECONDS);
+
+    // Sample the per-subsystem memory trend counters (.server memtrend)
+    m_timers[WUPDATE_MEMTREND].SetInterval(5 * MINUTE * IN_MILLISECONDS);
+
     // to set mailtimer to return mails every day between 4 and 5 am
     // mailtimer is increased when updating auctions
     // one second is 1000 -(tested on win system)
@@ -1437,9 +1688,6 @@ void World::SetInitialWorldSettings()
     mail_timer_expires = uint32((DAY * IN_MILLISECONDS) / (m_timers[WUPDATE_AUCTIONS].GetInterval()));
     DEBUG_LOG("Mail timer set to: %u, mail return is called every %u minutes", mail_timer, mail_timer_expires);
 
-    ///- Initialize static helper structures
-    AIRegistry::Initialize();
-
     ///- Initialize Outdoor PvP
     sLog.outString("Starting Outdoor PvP System");          // should be before loading maps
     sOutdoorPvPMgr.InitOutdoorPvP();
@@ -1449,10 +1697,34 @@ void World::SetInitialWorldSettings()
     sMapMgr.Initialize();
     sLog.outString();
 
+    ///- Start the session update worker pool when configured
+    if (uint32 sessionThreads = getConfig(CONFIG_UINT32_NUM_SESSION_THREADS))
+    {
+        sLog.outString("Starting Session Update with %u threads", sessionThreads);
+        sLog.outString();
+        m_sessionUpdater.activate(sessionThreads);
+    }
+
+    ///- Start the async pathfinding service when configured
+    if (uint32 pathThreads = getConfig(CONFIG_UINT32_PATHFINDER_THREADS))
+    {
+        sLog.outString("Starting Path Finder Service with %u threads", pathThreads);
+        sPathFinderService.Activate(pathThreads);
+        sLog.outString();
+    }
+
+    ///- Start the terrain prefetcher when configured
+    if (getConfig(CONFIG_BOOL_TERRAIN_PREFETCH))
+    {
+        sLog.outString("Starting Terrain Prefetcher");
+        sTerrainPrefetcher.Activate();
+        sLog.outString();
+    }
+
     ///- Initialize Battlegrounds
     sLog.outString("Starting BattleGround System");
     sBattleGroundMgr.CreateInitialBattleGrounds();
-    CheckLootTemplates_Reference(ids_set);
+    CheckLootTemplates_Reference(m_lootIdsPendingCheck);
 
     sLog.outString("Deleting expired bans...");
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE expires_at<=" _UNIXTIME_ " AND expires_at<>banned_at");
@@ -1498,6 +1770,9 @@ void World::SetInitialWorldSettings()
     m_timers[WUPDATE_METRICS].SetInterval(1 * IN_MILLISECONDS);
 #endif // BUILD_METRICS
 
+    // de-phase the periodic housekeeping now that every interval is configured
+    StaggerTimers();
+
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     PlayerbotMgr::SetInitialWorldSettings();
 #endif
@@ -1513,14 +1788,26 @@ void World::SetInitialWorldSettings()
 #endif
 #endif
 
-    sLog.outString("---------------------------------------");
-    sLog.outString("      CMANGOS: World initialized       ");
-    sLog.outString("---------------------------------------");
-    sLog.outString();
+    ///- Start the load-generation harness when configured (test realms only)
+    if (getConfig(CONFIG_UINT32_STRESS_TEST_SESSIONS))
+    {
+        sStressTestMgr.Start();
+        sLog.outString();
+    }
 
-    uint32 uStartInterval = WorldTimer::getMSTimeDiff(uStartTime, WorldTimer::getMSTime());
-    sLog.outString("SERVER STARTUP TIME: %i minutes %i seconds", uStartInterval / 60000, (uStartInterval % 60000) / 1000);
-    sLog.outString();
+    ///- Open the replay capture stream when configured
+    if (sPacketLog->InitializeReplayCapture(m_randomSeed))
+    {
+        sLog.outString("Replay capture enabled");
+        sLog.outString();
+    }
+
+    ///- Start feeding a captured workload when launched with --replay
+    if (sReplayMgr.IsConfigured())
+    {
+        sReplayMgr.Start();
+        sLog.outString();
+    }
 }
 
 void World::DetectDBCLang()
@@ -1576,6 +1863,12 @@ void World::Update(uint32 diff)
     m_currentTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
     m_currentDiff = diff;
 
+    metric::FrameProfiler::instance().BeginTick();
+
+    ///- Advance the replay capture tick (no-op unless ReplayCaptureFile is set)
+    if (sPacketLog->CanCaptureReplay())
+        sPacketLog->CaptureTick(diff);
+
 #ifdef ENABLE_PLAYERBOTS
     m_currentDiffSum += diff;
     m_currentDiffSumIndex++;
@@ -1670,7 +1963,10 @@ void World::Update(uint32 diff)
 #ifdef BUILD_METRICS
     auto preSessionTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
 #endif
-    UpdateSessions(diff);
+    {
+        metric::FrameScope scope("sessions");
+        UpdateSessions(diff);
+    }
 
     /// <li> Update uptime table
     if (m_timers[WUPDATE_UPTIME].Passed())
@@ -1687,13 +1983,25 @@ void World::Update(uint32 diff)
 #ifdef BUILD_METRICS
     auto preMapTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
 #endif
-    sMapMgr.Update(diff);
+    {
+        metric::FrameScope scope("maps");
+        sMapMgr.Update(diff);
+    }
 #ifdef BUILD_METRICS
     auto postMapTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
 #endif
-    sBattleGroundMgr.Update(diff);
-    sOutdoorPvPMgr.Update(diff);
-    sWorldState.Update(diff);
+    {
+        metric::FrameScope scope("singletons");
+        sBattleGroundMgr.Update(diff);
+        sOutdoorPvPMgr.Update(diff);
+        sWorldState.Update(diff);
+    }
+
+    ///- Drive the load-generation harness (no-op unless StressTest.Sessions is set)
+    sStressTestMgr.Update(diff);
+
+    ///- Feed the replay workload (no-op unless started with --replay)
+    sReplayMgr.Update(diff);
 #ifdef BUILD_METRICS
     auto postSingletonTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
 #endif
@@ -1708,6 +2016,21 @@ void World::Update(uint32 diff)
         }
     }
 
+    /// <li> Republish the read-only status snapshot for off-thread consumers
+    if (m_timers[WUPDATE_STATUS_SNAPSHOT].Passed())
+    {
+        m_timers[WUPDATE_STATUS_SNAPSHOT].Reset();
+        UpdateStatusSnapshot();
+        PruneRetiredConfigValues();
+    }
+
+    /// <li> Sample the per-subsystem memory trend counters
+    if (m_timers[WUPDATE_MEMTREND].Passed())
+    {
+        m_timers[WUPDATE_MEMTREND].Reset();
+        sMemoryTrend.Sample();
+    }
+
     ///- Delete all characters which have been deleted X days before
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
@@ -1716,7 +2039,10 @@ void World::Update(uint32 diff)
     }
 
     // execute callbacks from sql queries that were queued recently
-    UpdateResultQueue();
+    {
+        metric::FrameScope scope("db.resultQueue");
+        UpdateResultQueue();
+    }
 
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
@@ -1740,12 +2066,17 @@ void World::Update(uint32 diff)
     {
         m_timers[WUPDATE_METRICS].Reset();
         GeneratePacketMetrics();
+        OpcodeStatistics::instance().ReportToMetric();
+        PacketRateLimiter::ReportToMetric();
     }
 #endif
 
     /// </ul>
     ///- Move all creatures with "delayed move" and remove and delete all objects with "delayed remove"
-    sMapMgr.RemoveAllObjectsInRemoveList();
+    {
+        metric::FrameScope scope("removeList");
+        sMapMgr.RemoveAllObjectsInRemoveList();
+    }
 
     // update the instance reset times
     sMapPersistentStateMgr.Update();
@@ -1784,6 +2115,8 @@ void World::Update(uint32 diff)
     meas.add_field("singletons", std::to_string(singletons));
     meas.add_field("cleanup", std::to_string(cleanup));
 #endif
+
+    metric::FrameProfiler::instance().EndTick();
 }
 
 namespace MaNGOS
@@ -2212,19 +2545,59 @@ void World::ShutdownCancel()
     DEBUG_LOG("Server %s cancelled.", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shutdown"));
 }
 
+// runs WorldSession::UpdateParallel for one bucket of sessions on a pool worker
+class SessionUpdateWorker : public Worker
+{
+    public:
+        SessionUpdateWorker(std::vector<WorldSession*> sessions, uint32 diff, MapUpdater& updater) :
+            Worker(updater), m_sessions(std::move(sessions)), m_diff(diff)
+        {}
+
+        void execute() override
+        {
+            for (WorldSession* session : m_sessions)
+                session->UpdateParallel(m_diff);
+            GetWorker().update_finished();
+        }
+
+    private:
+        std::vector<WorldSession*> m_sessions;
+        uint32 m_diff;
+};
+
 void World::UpdateSessions(uint32 diff)
 {
     ///- Add new sessions
     {
-        std::deque<WorldSession*> sessionQueueCopy;
+        WorldSession* session;
+        while (m_sessionAddQueue.Dequeue(session))
+            AddSession_(session);
+    }
+
+    ///- Parallel stage: thread-safe handlers run across the worker pool; the
+    /// bucket is picked by map so sessions sharing a map keep one worker and
+    /// the same relative order (stable affinity), sessions without a player
+    /// spread by account id
+    if (m_sessionUpdater.activated())
+    {
+        size_t const partitions = m_sessionUpdater.GetNumThreads();
+        std::vector<std::vector<WorldSession*>> buckets(partitions);
+        for (auto& pair : m_sessions)
         {
-            std::lock_guard<std::mutex> guard(m_sessionAddQueueLock);
-            std::swap(m_sessionAddQueue, sessionQueueCopy);
+            WorldSession* session = pair.second;
+            uint32 const key = session->GetPlayer() ? session->GetPlayer()->GetMapId() : session->GetAccountId();
+            buckets[key % partitions].push_back(session);
         }
 
-        for (auto const& session : sessionQueueCopy)
-            AddSession_(session);
+        for (auto& bucket : buckets)
+            if (!bucket.empty())
+                m_sessionUpdater.schedule_update(new SessionUpdateWorker(std::move(bucket), diff, m_sessionUpdater));
+
+        m_sessionUpdater.wait();
     }
+    else
+        for (auto& pair : m_sessions)
+            pair.second->UpdateParallel(diff);
 
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(); itr != m_sessions.end();)
@@ -2235,6 +2608,14 @@ void World::UpdateSessions(uint32 diff)
         // if WorldSession::Update fails, it means that the session should be destroyed
         if (!pSession->Update(diff))
         {
+            if (pSession->HasPendingOffThreadCommands())
+            {
+                // the command worker still sends output through this session,
+                // retry the removal next tick
+                ++itr;
+                continue;
+            }
+
             RemoveQueuedSession(pSession);
             itr = m_sessions.erase(itr);
             delete pSession;
@@ -2306,6 +2687,148 @@ void World::ProcessCliCommands()
     }
 }
 
+/// Publish the staging configuration as a new immutable bundle; world thread only.
+/// The previous bundle is retired rather than freed immediately because a reader
+/// on another thread may have loaded its pointer just before the swap.
+void World::PublishConfigValues()
+{
+    WorldConfigValues const* previous = m_configValues.exchange(new WorldConfigValues(m_configStaging), std::memory_order_acq_rel);
+    if (previous)
+        m_retiredConfigValues.push_back({ previous, time(nullptr) });
+}
+
+/// Free retired configuration bundles once no reader can still hold a pointer
+/// into them; a minute is far beyond any getConfig load-to-dereference window
+void World::PruneRetiredConfigValues(bool force)
+{
+    if (m_retiredConfigValues.empty())
+        return;
+
+    time_t const now = time(nullptr);
+    for (auto itr = m_retiredConfigValues.begin(); itr != m_retiredConfigValues.end();)
+    {
+        if (force || now - itr->second >= MINUTE)
+        {
+            delete itr->first;
+            itr = m_retiredConfigValues.erase(itr);
+        }
+        else
+            ++itr;
+    }
+}
+
+/// Build the ".server info maps" report text; world thread only
+void World::BuildServerInfoMapsText(std::string& out) const
+{
+    char buf[256];
+
+    uint32 totalCreatures = 0;
+    uint32 totalGameObjects = 0;
+    uint32 totalGrids = 0;
+    uint64 totalTerrainBytes = 0;
+    uint64 totalNavMeshBytes = 0;
+
+    for (auto& itr : sMapMgr.Maps())
+    {
+        Map* map = itr.second.get();
+        Map::MapMemoryStats stats = map->GetMemoryStats();
+
+        snprintf(buf, sizeof(buf), "Map %u instance %u (%s): players %u, creatures %u, pets %u, gameobjects %u, dynobjects %u\n",
+                 map->GetId(), map->GetInstanceId(), map->GetMapName(), map->GetPlayers().getSize(),
+                 stats.creatures, stats.pets, stats.gameObjects, stats.dynamicObjects);
+        out += buf;
+        snprintf(buf, sizeof(buf), "  grids %u loaded (%u active objects), terrain %u tiles (%u KB), navmesh %u tiles (%u KB)\n",
+                 stats.loadedGrids, stats.activeObjects,
+                 stats.terrainTiles, uint32(stats.terrainBytes / 1024),
+                 stats.navMeshTiles, uint32(stats.navMeshBytes / 1024));
+        out += buf;
+
+        totalCreatures += stats.creatures;
+        totalGameObjects += stats.gameObjects;
+        totalGrids += stats.loadedGrids;
+        totalTerrainBytes += stats.terrainBytes;
+        totalNavMeshBytes += stats.navMeshBytes;
+    }
+
+    // terrain and navmesh data is shared between instances of one map id, so these totals overcount for instanced maps
+    snprintf(buf, sizeof(buf), "Total: %u maps, %u creatures, %u gameobjects, %u grids, terrain %u KB, navmesh %u KB",
+             uint32(sMapMgr.Maps().size()), totalCreatures, totalGameObjects, totalGrids,
+             uint32(totalTerrainBytes / 1024), uint32(totalNavMeshBytes / 1024));
+    out += buf;
+}
+
+/// Rebuild and publish the read-only status snapshot; world thread only
+void World::UpdateStatusSnapshot()
+{
+    auto snapshot = std::make_shared<ServerStatusSnapshot>();
+    snapshot->builtAt = m_gameTime;
+
+    char buf[256];
+    std::string& info = snapshot->infoText;
+    info = _FULLVERSION(REVISION_DATE, REVISION_ID);
+    info += '\n';
+    snprintf(buf, sizeof(buf), sObjectMgr.GetMangosStringForDbcLocale(LANG_USING_WORLD_DB), GetDBVersion());
+    info += buf;
+    info += '\n';
+    snprintf(buf, sizeof(buf), sObjectMgr.GetMangosStringForDbcLocale(LANG_USING_EVENT_AI), GetCreatureEventAIVersion());
+    info += buf;
+    info += '\n';
+    snprintf(buf, sizeof(buf), sObjectMgr.GetMangosStringForDbcLocale(LANG_CONNECTED_USERS),
+             GetActiveSessionCount(), GetMaxActiveSessionCount(), GetQueuedSessionCount(), GetMaxQueuedSessionCount());
+    info += buf;
+    info += '\n';
+    snprintf(buf, sizeof(buf), sObjectMgr.GetMangosStringForDbcLocale(LANG_UPTIME), secsToTimeString(GetUptime()).c_str());
+    info += buf;
+    info += '\n';
+
+    BuildServerInfoMapsText(snapshot->mapsText);
+    snapshot->mapsText += '\n';
+
+    std::atomic_store(&m_statusSnapshot, std::shared_ptr<ServerStatusSnapshot const>(std::move(snapshot)));
+}
+
+/// Answer read-only status commands against the published snapshot on the
+/// calling thread; only commands this cannot serve cross into the world
+/// thread. Returns false when no snapshot exists yet or the command is not a
+/// pure status query, in which case it queues as usual.
+bool World::TryExecuteSnapshotCommand(const CliCommandHolder* commandHolder) const
+{
+    auto snapshot = std::atomic_load(&m_statusSnapshot);
+    if (!snapshot)
+        return false;
+
+    char const* text = &commandHolder->m_command[0];
+    while (*text == ' ' || *text == '\t')
+        ++text;
+    if (*text == '.' || *text == '!')
+        ++text;
+
+    // only full command names match; abbreviations take the normal path
+    std::string command(text);
+    size_t const end = command.find_last_not_of(" \t\r\n");
+    command.erase(end == std::string::npos ? 0 : end + 1);
+    strToLower(command);
+
+    std::string const* reply;
+    if (command == "server info")
+        reply = &snapshot->infoText;
+    else if (command == "server info maps")
+    {
+        // below the command's access level: let the world thread produce the usual refusal
+        if (commandHolder->m_cliAccessLevel < SEC_ADMINISTRATOR)
+            return false;
+        reply = &snapshot->mapsText;
+    }
+    else
+        return false;
+
+    if (commandHolder->m_print)
+        commandHolder->m_print(reply->c_str());
+    if (commandHolder->m_commandFinished)
+        commandHolder->m_commandFinished(true);
+    return true;
+}
+
 void World::InitResultQueue()
 {
 }
@@ -2390,6 +2913,30 @@ void World::LoadSpamRecords(bool reload)
     }
 }
 
+/// Spread the initial phases of the periodic housekeeping timers
+void World::StaggerTimers()
+{
+    // timers sharing a common divisor (every-minute auctions, 20s AHBot,
+    // 20min corpse sweeps, ...) otherwise all start at phase zero and keep
+    // re-aligning on the same tick forever, which shows up as a harmonic
+    // ridge in the tick-time histogram; starting each one at a different
+    // golden-ratio point of its own period keeps the residues distinct
+    for (uint32 i = 0; i < WUPDATE_COUNT; ++i)
+    {
+        // interval is recomputed per game event; leave its phase alone
+        if (i == WUPDATE_EVENTS)
+            continue;
+
+        time_t const interval = m_timers[i].GetInterval();
+        // phase is meaningless for the sub-second bookkeeping timers
+        if (interval < 10 * IN_MILLISECONDS)
+            continue;
+
+        double const phase = std::fmod((i + 1) * 0.6180339887498949, 1.0);
+        m_timers[i].SetCurrent(time_t(interval * phase));
+    }
+}
+
 void World::ResetWeeklyQuests()
 {
     DETAIL_LOG("Weekly quests reset for all characters.");
@@ -2815,3 +3362,11 @@ void World::StartBGQueueThread()
         m_bgQueue.Update();
     });
 }
+
+void World::StartAuctionHouseSearchThread()
+{
+    m_auctionSearchThread = std::thread([&]()
+    {
+        m_auctionHouseSearcher.Update();
+    });
+}
@@ -32,6 +32,9 @@
 #include "Globals/GraveyardManager.h"
 #include "LFG/LFGQueue.h"
 #include "BattleGround/BattleGroundQueue.h"
+#include "AuctionHouse/AuctionHouseSearcher.h"
+#include "Util/MPSCQueue.h"
+#include "Maps/MapUpdater.h"
 
 #include <set>
 #include <list>
@@ -42,6 +45,8 @@
 #include <vector>
 #include <array>
 #include <atomic>
+#include <memory>
+#include <thread>
 
 class Object;
 class ObjectGuid;
@@ -86,17 +91,24 @@ enum WorldTimers
     WUPDATE_GROUPS      = 6,
     WUPDATE_WARDEN      = 7, // This is here for headache merge error issues
     WUPDATE_METRICS     = 8, // not used if BUILD_METRICS is not set
-    WUPDATE_COUNT       = 9
+    WUPDATE_STATUS_SNAPSHOT = 9, // read-only status snapshot for off-thread SOAP/RA queries
+    WUPDATE_MEMTREND    = 10, // per-subsystem memory trend sample
+    WUPDATE_COUNT       = 11
 };
 
 /// Configuration elements
 enum eConfigUInt32Values
 {
     CONFIG_UINT32_COMPRESSION = 0,
+    CONFIG_UINT32_COMPRESSION_LARGE_LEVEL,
+    CONFIG_UINT32_COMPRESSION_LARGE_SIZE,
     CONFIG_UINT32_INTERVAL_SAVE,
     CONFIG_UINT32_INTERVAL_GRIDCLEAN,
     CONFIG_UINT32_INTERVAL_MAPUPDATE,
+    CONFIG_UINT32_GRID_WARMUP_GRIDS_PER_TICK,
+    CONFIG_UINT32_VISIBILITY_GOVERNOR_PLAYERS_PER_GRID,
     CONFIG_UINT32_INTERVAL_CHANGEWEATHER,
+    CONFIG_UINT32_COMBAT_LOG_COALESCE_DELAY,
     CONFIG_UINT32_PORT_WORLD,
     CONFIG_UINT32_GAME_TYPE,
     CONFIG_UINT32_REALM_ZONE,
@@ -140,8 +152,35 @@ enum eConfigUInt32Values
     CONFIG_UINT32_GM_INVISIBLE_AURA,
     CONFIG_UINT32_MAIL_DELIVERY_DELAY,
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
+    CONFIG_UINT32_MASS_MAILER_BATCH_PER_TICK,
     CONFIG_UINT32_UPTIME_UPDATE,
     CONFIG_UINT32_NUM_MAP_THREADS,
+    CONFIG_UINT32_MAP_UPDATE_TICK_BUDGET,
+    CONFIG_UINT32_MAP_UPDATE_CONTINENT_SHARDS,
+    CONFIG_UINT32_NUM_SESSION_THREADS,
+    CONFIG_UINT32_PATHFINDER_THREADS,
+    CONFIG_UINT32_STARTUP_LOAD_THREADS,
+    CONFIG_UINT32_MOVEMENT_COALESCE_WINDOW,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_MOVEMENT_RATE,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_MOVEMENT_BURST,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_CHAT_RATE,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_CHAT_BURST,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_ADDON_RATE,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_ADDON_BURST,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_QUERY_RATE,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_QUERY_BURST,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_OTHER_RATE,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_OTHER_BURST,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_DISCONNECT_THRESHOLD,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_BAN_STRIKES,
+    CONFIG_UINT32_PACKET_RATE_LIMIT_BAN_DURATION,
+    CONFIG_UINT32_STRESS_TEST_SESSIONS,
+    CONFIG_UINT32_STRESS_TEST_MOVE_INTERVAL,
+    CONFIG_UINT32_STRESS_TEST_CAST_INTERVAL,
+    CONFIG_UINT32_STRESS_TEST_CAST_SPELL,
+    CONFIG_UINT32_STRESS_TEST_CHAT_INTERVAL,
+    CONFIG_UINT32_AI_LOD_DISTANCE,
+    CONFIG_UINT32_AI_LOD_INTERVAL,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_SKILL_CHANCE_ORANGE,
     CONFIG_UINT32_SKILL_CHANCE_YELLOW,
@@ -290,6 +329,7 @@ enum eConfigFloatValues
     CONFIG_FLOAT_LEASH_RADIUS,
     CONFIG_FLOAT_HARDCORE_DEATH_XP_REFUND_PCT,
     CONFIG_FLOAT_HARDCORE_BOT_LOOT_CRATE_GOLD_PCT,
+    CONFIG_FLOAT_VISIBILITY_GOVERNOR_MIN_DISTANCE,
     CONFIG_FLOAT_VALUE_COUNT
 };
 
@@ -297,6 +337,7 @@ enum eConfigFloatValues
 enum eConfigBoolValues
 {
     CONFIG_BOOL_GRID_UNLOAD = 0,
+    CONFIG_BOOL_MAP_UPDATE_PARALLEL_OBJECTS,
     CONFIG_BOOL_SAVE_RESPAWN_TIME_IMMEDIATELY,
     CONFIG_BOOL_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_CHAT,
@@ -344,7 +385,10 @@ enum eConfigBoolValues
     CONFIG_BOOL_OUTDOORPVP_SI_ENABLED,
     CONFIG_BOOL_OUTDOORPVP_EP_ENABLED,
     CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET,
+    CONFIG_BOOL_PACKET_RATE_LIMIT,
     CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT,
+    CONFIG_BOOL_CHAR_ENUM_CACHE,
+    CONFIG_BOOL_VENDOR_LIST_CACHE,
     CONFIG_BOOL_CLEAN_CHARACTER_DB,
     CONFIG_BOOL_VMAP_INDOOR_CHECK,
     CONFIG_BOOL_PET_UNSUMMON_AT_MOUNT,
@@ -359,6 +403,9 @@ enum eConfigBoolValues
     CONFIG_BOOL_ALWAYS_SHOW_QUEST_GREETING,
     CONFIG_BOOL_DISABLE_INSTANCE_RELOCATE,
     CONFIG_BOOL_PRELOAD_MMAP_TILES,
+    CONFIG_BOOL_MMAP_MEMORY_MAPPED,
+    CONFIG_BOOL_TERRAIN_PREFETCH,
+    CONFIG_BOOL_TERRAIN_QUANTIZE_FLOAT_HEIGHTS,
     CONFIG_BOOL_REGEN_ZONE_AREA_ON_STARTUP,
     CONFIG_BOOL_HARDCORE_MODE_ENABLED,
     CONFIG_BOOL_HARDCORE_DEATH_XP_LOSS,
@@ -397,6 +444,29 @@ struct CliCommandHolder
     }
 };
 
+/// Read-only server state published by the world thread for off-thread
+/// consumers (SOAP and remote-admin polling). The object is immutable once
+/// published; readers grab the shared_ptr atomically and never touch live
+/// world structures.
+struct ServerStatusSnapshot
+{
+    time_t builtAt = 0;
+    std::string infoText;                                   // prebuilt ".server info" reply
+    std::string mapsText;                                   // prebuilt ".server info maps" reply
+};
+
+/// Immutable bundle of all runtime configuration values. getConfig readers
+/// dereference the currently published bundle, so ".reload config" swaps in a
+/// complete new value set in one atomic pointer store and a reader on another
+/// thread never observes a half-reloaded mix.
+struct WorldConfigValues
+{
+    uint32 uint32Values[CONFIG_UINT32_VALUE_COUNT];
+    int32 int32Values[CONFIG_INT32_VALUE_COUNT];
+    float floatValues[CONFIG_FLOAT_VALUE_COUNT];
+    bool boolValues[CONFIG_BOOL_VALUE_COUNT];
+};
+
 /// The World
 class World
 {
@@ -411,6 +481,9 @@ class World
         WorldSession* FindSession(uint32 id) const;
         void AddSession(WorldSession* s);
         bool RemoveSession(uint32 id);
+        // runs a read-only/DB-bound task (flagged GM commands) on the command
+        // worker thread; must be called from the world thread
+        void ScheduleOffThreadCommand(std::function<void()> task);
         /// Get the number of current active sessions
         void UpdateMaxSessionCounters();
         uint32 GetActiveAndQueuedSessionCount() const { return m_sessions.size(); }
@@ -420,6 +493,10 @@ class World
         uint32 GetMaxQueuedSessionCount() const { return m_maxQueuedSessionCount; }
         uint32 GetMaxActiveSessionCount() const { return m_maxActiveSessionCount; }
         uint32 GetUniqueSessionCount() const { return m_uniqueSessionCount.size(); }
+        // cached SMSG_CHAR_ENUM payloads per account, invalidated on character save/create/delete/rename
+        void SetCharacterEnumCache(uint32 accountId, std::vector<uint8> data);
+        bool GetCharacterEnumCache(uint32 accountId, std::vector<uint8>& data) const;
+        void InvalidateCharacterEnumCache(uint32 accountId);
         // player counts
         void SetOnlinePlayer(Team team, uint8 race, uint8 plClass, bool apply); // threadsafe
         uint32 GetOnlineTeamPlayers(bool alliance) const { return m_onlineTeams[alliance]; }
@@ -483,6 +560,10 @@ class World
         }
 
         void SetInitialWorldSettings();
+        /// Standby mode only: run the deferred live-state initialization when the failover trigger fires
+        void ActivateStandby();
+        /// True after SetInitialWorldSettings when Standby.Enable held back the live-state phase
+        bool IsStandby() const { return m_standby; }
         void LoadConfigSettings(bool reload = false);
         void LoadSpamRecords(bool reload = false);
 
@@ -508,25 +589,25 @@ class World
 
         void UpdateSessions(uint32 diff);
 
+        /// Set a server configuration element (see #eConfigFloatValues); world thread only
+        void setConfig(eConfigFloatValues index, float value) { m_configStaging.floatValues[index] = value; PublishConfigValues(); }
         /// Get a server configuration element (see #eConfigFloatValues)
-        void setConfig(eConfigFloatValues index, float value) { m_configFloatValues[index] = value; }
-        /// Get a server configuration element (see #eConfigFloatValues)
-        float getConfig(eConfigFloatValues rate) const { return m_configFloatValues[rate]; }
+        float getConfig(eConfigFloatValues rate) const { return m_configValues.load(std::memory_order_acquire)->floatValues[rate]; }
 
-        /// Set a server configuration element (see #eConfigUInt32Values)
-        void setConfig(eConfigUInt32Values index, uint32 value) { m_configUint32Values[index] = value; }
+        /// Set a server configuration element (see #eConfigUInt32Values); world thread only
+        void setConfig(eConfigUInt32Values index, uint32 value) { m_configStaging.uint32Values[index] = value; PublishConfigValues(); }
         /// Get a server configuration element (see #eConfigUInt32Values)
-        uint32 getConfig(eConfigUInt32Values index) const { return m_configUint32Values[index]; }
+        uint32 getConfig(eConfigUInt32Values index) const { return m_configValues.load(std::memory_order_acquire)->uint32Values[index]; }
 
-        /// Set a server configuration element (see #eConfigInt32Values)
-        void setConfig(eConfigInt32Values index, int32 value) { m_configInt32Values[index] = value; }
+        /// Set a server configuration element (see #eConfigInt32Values); world thread only
+        void setConfig(eConfigInt32Values index, int32 value) { m_configStaging.int32Values[index] = value; PublishConfigValues(); }
         /// Get a server configuration element (see #eConfigInt32Values)
-        int32 getConfig(eConfigInt32Values index) const { return m_configInt32Values[index]; }
+        int32 getConfig(eConfigInt32Values index) const { return m_configValues.load(std::memory_order_acquire)->int32Values[index]; }
 
-        /// Set a server configuration element (see #eConfigBoolValues)
-        void setConfig(eConfigBoolValues index, bool value) { m_configBoolValues[index] = value; }
+        /// Set a server configuration element (see #eConfigBoolValues); world thread only
+        void setConfig(eConfigBoolValues index, bool value) { m_configStaging.boolValues[index] = value; PublishConfigValues(); }
         /// Get a server configuration element (see #eConfigBoolValues)
-        bool getConfig(eConfigBoolValues index) const { return m_configBoolValues[index]; }
+        bool getConfig(eConfigBoolValues index) const { return m_configValues.load(std::memory_order_acquire)->boolValues[index]; }
 
         /// Get configuration about force-loaded maps
         bool isForceLoadMap(uint32 id) const { return m_configForceLoadMapIds.find(id) != m_configForceLoadMapIds.end(); }
@@ -571,13 +652,29 @@ class World
         static float GetMaxVisibleDistanceInBG()            { return m_MaxVisibleDistanceInBG;         }
 
         static float GetRelocationLowerLimitSq() { return m_relocation_lower_limit_sq; }
+        static float GetRelocationAILowerLimitSq() { return m_relocation_ai_lower_limit_sq; }
         static uint32 GetRelocationAINotifyDelay() { return m_relocation_ai_notify_delay; }
 
         void InitServerMaintenanceCheck();
         void ServerMaintenanceStart();
 
         void ProcessCliCommands();
-        void QueueCliCommand(const CliCommandHolder* commandHolder) { std::lock_guard<std::mutex> guard(m_cliCommandQueueLock); m_cliCommandQueue.push_back(commandHolder); }
+        void QueueCliCommand(const CliCommandHolder* commandHolder)
+        {
+            // read-only status queries are answered from the published
+            // snapshot on the calling thread; only the rest crosses into
+            // the world thread
+            if (TryExecuteSnapshotCommand(commandHolder))
+            {
+                delete commandHolder;
+                return;
+            }
+            std::lock_guard<std::mutex> guard(m_cliCommandQueueLock);
+            m_cliCommandQueue.push_back(commandHolder);
+        }
+
+        std::shared_ptr<ServerStatusSnapshot const> GetStatusSnapshot() const { return std::atomic_load(&m_statusSnapshot); }
+        void BuildServerInfoMapsText(std::string& out) const; // world thread only
 
         void UpdateResultQueue();
         void InitResultQueue();
@@ -635,8 +732,10 @@ class World
 
         LFGQueue& GetLFGQueue() { return m_lfgQueue; }
         BattleGroundQueue& GetBGQueue() { return m_bgQueue; }
+        AuctionHouseSearcher& GetAuctionHouseSearcher() { return m_auctionHouseSearcher; }
         void StartLFGQueueThread();
         void StartBGQueueThread();
+        void StartAuctionHouseSearchThread();
     protected:
         void _UpdateGameTime();
         // callback for UpdateRealmCharacters
@@ -645,12 +744,25 @@ class World
         void InitWeeklyQuestResetTime();
         void ResetWeeklyQuests();
 
+        void StaggerTimers();
+
 #ifdef BUILD_METRICS
         void GeneratePacketMetrics(); // thread safe due to atomics
         uint32 GetAverageLatency() const;
 #endif
 
     private:
+        // SetInitialWorldSettings split: static data (templates, DBC, scripts) can be
+        // pre-loaded by a warm standby process, live state (dynamic tables, timers,
+        // maps) must wait until this process owns the realm
+        void LoadStaticData();
+        void InitializeLiveState();
+        bool m_standby;
+        uint32 m_randomSeed;                                // srand seed, recorded in the replay capture header
+        // loot ids collected by LoadStaticData, reference-checked in
+        // InitializeLiveState once the battlegrounds registered theirs
+        std::set<uint32> m_lootIdsPendingCheck;
+
         void setConfig(eConfigUInt32Values index, char const* fieldname, uint32 defvalue);
         void setConfig(eConfigInt32Values index, char const* fieldname, int32 defvalue);
         void setConfig(eConfigFloatValues index, char const* fieldname, float defvalue);
@@ -688,10 +800,19 @@ class World
         uint32 m_maxActiveSessionCount;
         uint32 m_maxQueuedSessionCount;
 
-        uint32 m_configUint32Values[CONFIG_UINT32_VALUE_COUNT];
-        int32 m_configInt32Values[CONFIG_INT32_VALUE_COUNT];
-        float m_configFloatValues[CONFIG_FLOAT_VALUE_COUNT];
-        bool m_configBoolValues[CONFIG_BOOL_VALUE_COUNT];
+        mutable std::mutex m_charEnumCacheMutex;
+        std::unordered_map<uint32, std::vector<uint8>> m_charEnumCache;
+
+        // runtime configuration: setConfig edits the staging copy (world thread
+        // only) and republishes it as a new immutable bundle; getConfig reads
+        // the published bundle lock-free. Replaced bundles sit in the retired
+        // list for a grace period before being freed, so a reader that loaded
+        // the old pointer just before a swap never dereferences freed memory
+        void PublishConfigValues();
+        void PruneRetiredConfigValues(bool force = false);
+        WorldConfigValues m_configStaging;
+        std::atomic<WorldConfigValues const*> m_configValues;
+        std::vector<std::pair<WorldConfigValues const*, time_t>> m_retiredConfigValues;
 
         int32 m_playerLimit;
         LocaleConstant m_defaultDbcLocale;                  // from config for one from loaded DBC locales
@@ -707,12 +828,17 @@ class World
         static float m_MaxVisibleDistanceInBG;
 
         static float  m_relocation_lower_limit_sq;
+        static float  m_relocation_ai_lower_limit_sq;
         static uint32 m_relocation_ai_notify_delay;
 
         // CLI command holder to be thread safe
         std::mutex m_cliCommandQueueLock;
         std::deque<const CliCommandHolder*> m_cliCommandQueue;
 
+        void UpdateStatusSnapshot();                        // world thread: rebuild and publish the read-only snapshot
+        bool TryExecuteSnapshotCommand(const CliCommandHolder* commandHolder) const; // any thread
+        std::shared_ptr<ServerStatusSnapshot const> m_statusSnapshot; // accessed through std::atomic_load/atomic_store only
+
         // next weekly quests reset time
         time_t m_NextWeeklyQuestReset;
 
@@ -722,8 +848,16 @@ class World
         // sessions that are added async
         void AddSession_(WorldSession* s);
 
-        std::mutex m_sessionAddQueueLock;
-        std::deque<WorldSession*> m_sessionAddQueue;
+        // network threads enqueue, the world thread drains in UpdateSessions
+        MPSCQueue<WorldSession*> m_sessionAddQueue;
+
+        // worker pool for the parallel session update stage (SessionUpdate.Threads)
+        MapUpdater m_sessionUpdater;
+
+        // worker thread for off-thread GM commands, started on first use
+        MPSCQueue<std::function<void()>> m_commandQueue;
+        std::thread m_commandThread;
+        std::atomic<bool> m_commandThreadStop{false};
 
         // used versions
         std::string m_DBVersion;
@@ -768,6 +902,8 @@ class World
         std::thread m_lfgQueueThread;
         BattleGroundQueue m_bgQueue;
         std::thread m_bgQueueThread;
+        AuctionHouseSearcher m_auctionHouseSearcher;
+        std::thread m_auctionSearchThread;
 };
 
 extern uint32 realmID;
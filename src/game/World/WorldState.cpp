@@ -1257,10 +1257,8 @@ void WorldState::BroadcastSIWorldstates()
     uint32 remainingTanaris = GetSIRemaining(SI_REMAINING_TANARIS);
     uint32 remainingWinterspring = GetSIRemaining(SI_REMAINING_WINTERSPRING);
 
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (const auto& itr : m)
+    for (Player* pl : sObjectAccessor.GetPlayersSnapshot())
     {
-        Player* pl = itr.second;
         // do not process players which are not in world
         if (!pl->IsInWorld())
             continue;
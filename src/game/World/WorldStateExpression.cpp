@@ -308,78 +308,188 @@ static int32(* const WorldStateExpressionFunctions[WSE_FUNCTION_MAX])(Map const*
     },
 };
 
-int32 EvalSingleValue(ByteBuffer& buffer, Map const* map)
+namespace
 {
-    WorldStateExpressionValueType valueType = buffer.read<WorldStateExpressionValueType>();
-    int32 value = 0;
+    // compile-time value: when isConst is set nothing was emitted for the
+    // subtree and the parent may fold it further or materialize it
+    struct WseValue
+    {
+        bool isConst;
+        int32 value;
+    };
 
-    switch (valueType)
+    void EmitConstantAt(std::vector<WseInstruction>& code, size_t pos, int32 value)
     {
-        case WorldStateExpressionValueType::CONSTANT:
-        {
-            value = buffer.read<int32>();
-            break;
-        }
-        case WorldStateExpressionValueType::WORLDSTATE:
+        code.insert(code.begin() + pos, { WseOpcode::PUSH_CONSTANT, value });
+    }
+
+    int32 ApplyArithmetic(WorldStateExpressionOperatorType operatorType, int32 leftValue, int32 rightValue)
+    {
+        switch (operatorType)
         {
-            uint32 worldStateId = buffer.read<uint32>();
-            value = map->GetVariableManager().GetVariable(worldStateId);
-            break;
+            case WorldStateExpressionOperatorType::SUM:             return leftValue + rightValue;
+            case WorldStateExpressionOperatorType::SUBTRACTION:    return leftValue - rightValue;
+            case WorldStateExpressionOperatorType::MULTIPLICATION:  return leftValue * rightValue;
+            case WorldStateExpressionOperatorType::DIVISION:        return !rightValue ? 0 : leftValue / rightValue;
+            case WorldStateExpressionOperatorType::REMAINDER:       return !rightValue ? 0 : leftValue % rightValue;
+            default:                                                return leftValue;
         }
-        case WorldStateExpressionValueType::FUNCTION:
-        {
-            uint32 functionType = buffer.read<uint32>();
-            int32 arg1 = EvalSingleValue(buffer, map);
-            int32 arg2 = EvalSingleValue(buffer, map);
+    }
 
-            if (functionType >= WSE_FUNCTION_MAX)
-                return 0;
+    WseValue CompileSingleValue(ByteBuffer& buffer, std::vector<WseInstruction>& code)
+    {
+        WorldStateExpressionValueType valueType = buffer.read<WorldStateExpressionValueType>();
 
-            value = WorldStateExpressionFunctions[functionType](map, arg1, arg2);
-            break;
+        switch (valueType)
+        {
+            case WorldStateExpressionValueType::CONSTANT:
+                return { true, buffer.read<int32>() };
+            case WorldStateExpressionValueType::WORLDSTATE:
+                code.push_back({ WseOpcode::PUSH_WORLDSTATE, int32(buffer.read<uint32>()) });
+                return { false, 0 };
+            case WorldStateExpressionValueType::FUNCTION:
+            {
+                uint32 functionType = buffer.read<uint32>();
+
+                size_t const arg1Start = code.size();
+                WseValue arg1 = CompileSingleValue(buffer, code);
+                WseValue arg2 = CompileSingleValue(buffer, code);
+
+                // functions are impure (random rolls, clock reads) - the
+                // arguments are materialized, the call itself never folds
+                if (arg1.isConst)
+                    EmitConstantAt(code, arg1Start, arg1.value);
+                if (arg2.isConst)
+                    code.push_back({ WseOpcode::PUSH_CONSTANT, arg2.value });
+                code.push_back({ WseOpcode::CALL_FUNCTION, int32(functionType) });
+                return { false, 0 };
+            }
+            default:
+                return { true, 0 };
         }
-        default:
-            break;
     }
 
-    return value;
-}
+    WseValue CompileValue(ByteBuffer& buffer, std::vector<WseInstruction>& code)
+    {
+        size_t const leftStart = code.size();
+        WseValue left = CompileSingleValue(buffer, code);
 
-int32 EvalValue(ByteBuffer& buffer, Map const* map)
-{
-    int32 leftValue = EvalSingleValue(buffer, map);
+        WorldStateExpressionOperatorType operatorType = buffer.read<WorldStateExpressionOperatorType>();
+        if (operatorType == WorldStateExpressionOperatorType::NONE)
+            return left;
 
-    WorldStateExpressionOperatorType operatorType = buffer.read<WorldStateExpressionOperatorType>();
-    if (operatorType == WorldStateExpressionOperatorType::NONE)
-        return leftValue;
+        WseValue right = CompileSingleValue(buffer, code);
 
-    int32 rightValue = EvalSingleValue(buffer, map);
+        if (left.isConst && right.isConst)
+            return { true, ApplyArithmetic(operatorType, left.value, right.value) };
 
-    switch (operatorType)
-    {
-        case WorldStateExpressionOperatorType::SUM:             return leftValue + rightValue;
-        case WorldStateExpressionOperatorType::SUBTRACTION:    return leftValue - rightValue;
-        case WorldStateExpressionOperatorType::MULTIPLICATION:  return leftValue * rightValue;
-        case WorldStateExpressionOperatorType::DIVISION:        return !rightValue ? 0 : leftValue / rightValue;
-        case WorldStateExpressionOperatorType::REMAINDER:       return !rightValue ? 0 : leftValue % rightValue;
-        default:
-            break;
+        if (left.isConst)
+            EmitConstantAt(code, leftStart, left.value);
+        if (right.isConst)
+            code.push_back({ WseOpcode::PUSH_CONSTANT, right.value });
+        code.push_back({ WseOpcode::ARITHMETIC, int32(operatorType) });
+        return { false, 0 };
     }
 
-    return leftValue;
-}
+    WseValue CompileRelOp(ByteBuffer& buffer, std::vector<WseInstruction>& code)
+    {
+        size_t const leftStart = code.size();
+        WseValue left = CompileValue(buffer, code);
 
-bool EvalRelOp(ByteBuffer& buffer, Map const* map)
-{
-    int32 leftValue = EvalValue(buffer, map);
+        ConditionOperation compareLogic = buffer.read<ConditionOperation>();
+        if (compareLogic == ConditionOperation::NONE)
+        {
+            if (left.isConst)
+                return { true, left.value != 0 };
+
+            code.push_back({ WseOpcode::TEST_NONZERO, 0 });
+            return { false, 0 };
+        }
+
+        WseValue right = CompileValue(buffer, code);
+
+        if (left.isConst && right.isConst)
+            return { true, int32(ConditionEntry::CheckOp(compareLogic, left.value, right.value)) };
+
+        if (left.isConst)
+            EmitConstantAt(code, leftStart, left.value);
+        if (right.isConst)
+            code.push_back({ WseOpcode::PUSH_CONSTANT, right.value });
+        code.push_back({ WseOpcode::COMPARE, int32(compareLogic) });
+        return { false, 0 };
+    }
 
-    ConditionOperation compareLogic = buffer.read<ConditionOperation>();
-    if (compareLogic == ConditionOperation::NONE)
-        return leftValue != 0;
+    // mirrors the parse order the interpreter used, including stopping a
+    // logic chain that still has trailing data after a combined term
+    std::shared_ptr<WorldStateExpressionProgram const> CompileWorldStateExpression(std::string const& hex, uint32 id)
+    {
+        auto program = std::make_shared<WorldStateExpressionProgram>();
 
-    int32 rightValue = EvalValue(buffer, map);
+        try
+        {
+            ByteBuffer buffer = HexToBytes(hex);
+            if (buffer.empty() || !buffer.read<bool>())
+            {
+                program->constantResult = true;             // empty or disabled: always false
+                return program;
+            }
+
+            std::vector<WseInstruction>& code = program->code;
+
+            size_t resultStart = 0;
+            WseValue result = CompileRelOp(buffer, code);
+
+            ConditionLogic resultLogic = buffer.read<ConditionLogic>();
+            while (resultLogic != ConditionLogic::NONE)
+            {
+                WseValue second = CompileRelOp(buffer, code);
+
+                if (result.isConst && second.isConst)
+                {
+                    switch (resultLogic)
+                    {
+                        case ConditionLogic::AND: result.value = int32(result.value && second.value); break;
+                        case ConditionLogic::OR:  result.value = int32(result.value || second.value); break;
+                        case ConditionLogic::XOR: result.value = int32((result.value != 0) != (second.value != 0)); break;
+                        default:
+                            break;
+                    }
+                }
+                else
+                {
+                    if (result.isConst)
+                        EmitConstantAt(code, resultStart, result.value);
+                    if (second.isConst)
+                        code.push_back({ WseOpcode::PUSH_CONSTANT, second.value });
+                    code.push_back({ WseOpcode::LOGIC, int32(resultLogic) });
+                    result = { false, 0 };
+                }
+
+                if (buffer.rpos() < buffer.size())
+                    break;
+
+                resultLogic = buffer.read<ConditionLogic>();
+            }
+
+            if (result.isConst)
+            {
+                program->code.clear();
+                program->constantResult = true;
+                program->result = result.value != 0;
+            }
+        }
+        catch (ByteBufferException const&)
+        {
+            // malformed blob - used to blow up on first evaluation, now
+            // rejected once at load
+            sLog.outErrorDb("Table worldstate_expression entry %u has a malformed expression blob, forced to false", id);
+            program->code.clear();
+            program->constantResult = true;
+            program->result = false;
+        }
 
-    return ConditionEntry::CheckOp(compareLogic, leftValue, rightValue);
+        return program;
+    }
 }
 
 std::shared_ptr<std::map<int32, WorldStateExpressionEntry>> WorldStateExpressionMgr::Load()
@@ -398,6 +508,9 @@ std::shared_ptr<std::map<int32, WorldStateExpressionEntry>> WorldStateExpression
     BarGoLink bar(result->GetRowCount());
     uint32 Count = 0;
 
+    // identical blobs compile once and share one program
+    std::map<std::string, std::shared_ptr<WorldStateExpressionProgram const>> compiledCache;
+
     do
     {
         bar.step();
@@ -407,7 +520,13 @@ std::shared_ptr<std::map<int32, WorldStateExpressionEntry>> WorldStateExpression
         conditionEntry.Id = fields[0].GetUInt32();
         conditionEntry.Expression = fields[1].GetCppString();
 
+        auto cacheItr = compiledCache.find(conditionEntry.Expression);
+        if (cacheItr == compiledCache.end())
+            cacheItr = compiledCache.emplace(conditionEntry.Expression, CompileWorldStateExpression(conditionEntry.Expression, conditionEntry.Id)).first;
+        conditionEntry.Program = cacheItr->second;
+
         expressions->emplace(conditionEntry.Id, conditionEntry);
+        ++Count;
     }
     while (result->NextRow());
 
@@ -419,46 +538,87 @@ std::shared_ptr<std::map<int32, WorldStateExpressionEntry>> WorldStateExpression
     return expressions;
 }
 
-bool WorldStateExpressionMgr::Meets(Map const* map, int32 Id)
+bool WorldStateExpressionMgr::Evaluate(WorldStateExpressionProgram const& program, Map const* map)
 {
-    auto expressions = map->GetMapDataContainer().GetWorldStateExpressions();
-    auto itr = expressions->find(Id);
-    if (expressions->end() == itr)
-        return false;
-
-    WorldStateExpressionEntry const& expression = itr->second;
-
-    ByteBuffer buffer = HexToBytes(expression.Expression);
-    if (buffer.empty())
-        return false;
-
-    bool enabled = buffer.read<bool>();
-    if (!enabled)
-        return false;
-
-    bool finalResult = EvalRelOp(buffer, map);
-    ConditionLogic resultLogic = buffer.read<ConditionLogic>();
+    if (program.constantResult)
+        return program.result;
+
+    // each instruction pushes at most one value, so code.size() bounds the
+    // stack; real expressions are a handful of instructions deep
+    int32 fixedStack[32];
+    std::vector<int32> dynamicStack;
+    int32* stack = fixedStack;
+    if (program.code.size() > 32)
+    {
+        dynamicStack.resize(program.code.size());
+        stack = dynamicStack.data();
+    }
+    uint32 top = 0;
 
-    while (resultLogic != ConditionLogic::NONE)
+    for (WseInstruction const& ins : program.code)
     {
-        bool secondResult = EvalRelOp(buffer, map);
-
-        switch (resultLogic)
+        switch (ins.opcode)
         {
-            case ConditionLogic::AND: finalResult = finalResult && secondResult; break;
-            case ConditionLogic::OR:  finalResult = finalResult || secondResult; break;
-            case ConditionLogic::XOR: finalResult = finalResult != secondResult; break;
-            default:
+            case WseOpcode::PUSH_CONSTANT:
+                stack[top++] = ins.operand;
+                break;
+            case WseOpcode::PUSH_WORLDSTATE:
+                stack[top++] = map->GetVariableManager().GetVariable(uint32(ins.operand));
                 break;
+            case WseOpcode::CALL_FUNCTION:
+            {
+                int32 const arg2 = stack[--top];
+                int32 const arg1 = stack[--top];
+                uint32 const functionType = uint32(ins.operand);
+                stack[top++] = functionType < WSE_FUNCTION_MAX ? WorldStateExpressionFunctions[functionType](map, arg1, arg2) : 0;
+                break;
+            }
+            case WseOpcode::ARITHMETIC:
+            {
+                int32 const right = stack[--top];
+                stack[top - 1] = ApplyArithmetic(WorldStateExpressionOperatorType(ins.operand), stack[top - 1], right);
+                break;
+            }
+            case WseOpcode::COMPARE:
+            {
+                int32 const right = stack[--top];
+                stack[top - 1] = int32(ConditionEntry::CheckOp(ConditionOperation(ins.operand), stack[top - 1], right));
+                break;
+            }
+            case WseOpcode::TEST_NONZERO:
+                stack[top - 1] = int32(stack[top - 1] != 0);
+                break;
+            case WseOpcode::LOGIC:
+            {
+                bool const right = stack[--top] != 0;
+                bool const left = stack[top - 1] != 0;
+                switch (ConditionLogic(ins.operand))
+                {
+                    case ConditionLogic::AND: stack[top - 1] = int32(left && right); break;
+                    case ConditionLogic::OR:  stack[top - 1] = int32(left || right); break;
+                    case ConditionLogic::XOR: stack[top - 1] = int32(left != right); break;
+                    default:
+                        break;
+                }
+                break;
+            }
         }
+    }
 
-        if (buffer.rpos() < buffer.size())
-            break;
+    return top && stack[top - 1] != 0;
+}
 
-        resultLogic = buffer.read<ConditionLogic>();
-    }
+bool WorldStateExpressionMgr::Meets(Map const* map, int32 Id)
+{
+    auto expressions = map->GetMapDataContainer().GetWorldStateExpressions();
+    auto itr = expressions->find(Id);
+    if (expressions->end() == itr)
+        return false;
+
+    if (!itr->second.Program)
+        return false;
 
-    return finalResult;
+    return Evaluate(*itr->second.Program, map);
 }
 
 bool WorldStateExpressionMgr::Exists(int32 Id)
@@ -23,6 +23,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 class Map;
 
@@ -88,10 +89,39 @@ enum WorldStateExpressionFunctions
     WSE_FUNCTION_MAX,
 };
 
+enum class WseOpcode : uint8
+{
+    PUSH_CONSTANT,                                          // operand: value
+    PUSH_WORLDSTATE,                                        // operand: worldstate id
+    CALL_FUNCTION,                                          // operand: function id; pops arg2, arg1, pushes result
+    ARITHMETIC,                                             // operand: WorldStateExpressionOperatorType; pops right, left
+    COMPARE,                                                // operand: ConditionOperation; pops right, left, pushes 0/1
+    TEST_NONZERO,                                           // replaces the top value with 0/1
+    LOGIC,                                                  // operand: ConditionLogic; pops right, left, pushes 0/1
+};
+
+struct WseInstruction
+{
+    WseOpcode opcode;
+    int32 operand;
+};
+
+// flat postfix program compiled once at load - evaluation walks the
+// instruction array over a small value stack instead of hex-decoding and
+// recursively interpreting the expression blob on every call. Subtrees
+// without worldstate reads or function calls are folded at compile time.
+struct WorldStateExpressionProgram
+{
+    std::vector<WseInstruction> code;
+    bool constantResult = false;                            // whole expression folded (also disabled/invalid blobs)
+    bool result = false;                                    // value used when constantResult is set
+};
+
 struct WorldStateExpressionEntry
 {
     uint32 Id;
     std::string Expression;
+    std::shared_ptr<WorldStateExpressionProgram const> Program; // shared between entries with identical blobs
 };
 
 class WorldStateExpressionMgr
@@ -105,6 +135,8 @@ class WorldStateExpressionMgr
 
         std::shared_ptr<std::map<int32, WorldStateExpressionEntry>> Get() { return m_expressions; }
     private:
+        static bool Evaluate(WorldStateExpressionProgram const& program, Map const* map);
+
         std::shared_ptr<std::map<int32, WorldStateExpressionEntry>> m_expressions;
 };
 
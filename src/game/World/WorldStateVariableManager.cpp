@@ -18,6 +18,7 @@
 
 #include "World/WorldStateVariableManager.h"
 #include "Util/ByteBuffer.h"
+#include "Server/WorldPacket.h"
 #include "Maps/Map.h"
 #include "Maps/MapReference.h"
 #include "Entities/Player.h"
@@ -64,8 +65,13 @@ void WorldStateVariableManager::SetVariable(int32 Id, int32 value)
         return;
 
     variable.value = value;
-    if (m_variables[Id].send)
-        BroadcastVariable(Id);
+    // broadcast is deferred to FlushDirty so several changes within one map
+    // tick (score ticks and the like) collapse into a single send
+    if (variable.send && !variable.dirty)
+    {
+        variable.dirty = true;
+        m_dirtyIds.push_back(Id);
+    }
 }
 
 void WorldStateVariableManager::SetVariableData(int32 Id, bool send, uint32 zoneId, uint32 areaId)
@@ -98,28 +104,57 @@ void WorldStateVariableManager::FillInitialWorldStates(ByteBuffer& data, uint32&
 
 void WorldStateVariableManager::BroadcastVariable(int32 Id) const
 {
-    auto const& lPlayers = m_owner->GetPlayers();
-    if (!lPlayers.isEmpty())
+    WorldStateVariable const* variable = GetVariableData(Id);
+    MANGOS_ASSERT(variable); // if we are broadcasting a variable it must be initialized
+    SendToObservers(Id, *variable);
+}
+
+void WorldStateVariableManager::SendToObservers(int32 Id, WorldStateVariable const& variable) const
+{
+    WorldPacket data(SMSG_UPDATE_WORLD_STATE, 8);
+    data << uint32(Id);
+    data << uint32(variable.value);
+
+    // zone-bound states go through the per-zone registry so only sessions
+    // actually observing the state are touched; the payload is refcounted
+    // across all receivers
+    if (variable.zoneId)
+    {
+        for (Player* player : m_owner->GetPlayersInZone(variable.zoneId))
+            if (!variable.areaId || variable.areaId == player->GetAreaId())
+                player->GetSession()->SendPacket(data);
+        return;
+    }
+
+    for (const auto& lPlayer : m_owner->GetPlayers())
     {
-        WorldStateVariable const* variable = GetVariableData(Id);
-        MANGOS_ASSERT(variable); // if we are broadcasting a variable it must be initialized
-        int32 value = variable->value;
-        bool queryIds = variable->zoneId || variable->areaId;
-        for (const auto& lPlayer : lPlayers)
+        if (Player* player = lPlayer.getSource())
         {
-            if (Player* player = lPlayer.getSource())
-            {
-                uint32 zoneId, areaId;
-                if (queryIds) // optimization
-                    player->GetZoneAndAreaId(zoneId, areaId);
-                if ((!variable->zoneId || variable->zoneId == zoneId) &&
-                    (!variable->areaId || variable->areaId == areaId))
-                    player->SendUpdateWorldState(Id, value);
-            }
+            if (!variable.areaId || variable.areaId == player->GetAreaId())
+                player->GetSession()->SendPacket(data);
         }
     }
 }
 
+void WorldStateVariableManager::FlushDirty()
+{
+    if (m_dirtyIds.empty())
+        return;
+
+    for (int32 id : m_dirtyIds)
+    {
+        auto itr = m_variables.find(id);
+        if (itr == m_variables.end())
+            continue;
+
+        itr->second.dirty = false;
+        if (itr->second.send)
+            SendToObservers(id, itr->second);
+    }
+
+    m_dirtyIds.clear();
+}
+
 std::string WorldStateVariableManager::GetVariableList() const
 {
     std::string output;
@@ -32,11 +32,12 @@ struct WorldStateVariable
 {
     int32 value;
     bool send;
+    bool dirty;                                             // pending broadcast, see FlushDirty
     uint32 zoneId;
     uint32 areaId;
     std::vector<std::function<void()>> executors;
 
-    WorldStateVariable() : value(0), send(false), zoneId(0), areaId(0) {}
+    WorldStateVariable() : value(0), send(false), dirty(false), zoneId(0), areaId(0) {}
 };
 
 class WorldStateVariableManager
@@ -54,13 +55,19 @@ class WorldStateVariableManager
 
         void FillInitialWorldStates(ByteBuffer& data, uint32& count, uint32 zoneId, uint32 areaId);
         void BroadcastVariable(int32 Id) const;
+        // sends all variables changed since the last map tick in one pass,
+        // deduplicating repeated changes to the same variable
+        void FlushDirty();
 
         std::string GetVariableList() const;
 
         void SetEncounterVariable(uint32 encounterId, bool state);
 
     private:
+        void SendToObservers(int32 Id, WorldStateVariable const& variable) const;
+
         std::map<int32, WorldStateVariable> m_variables;
+        std::vector<int32> m_dirtyIds;
         Map* m_owner;
 };
 
@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #define MAX_STACK_SIZE 64
 
@@ -61,6 +62,18 @@ struct AABound
     Vector3 lo, hi;
 };
 
+// Some ray callbacks can test a whole leaf at once (e.g. the SIMD triangle
+// batches in WorldModel). Those provide the batched form
+// operator()(ray, objects, count, maxDist, stopAtFirst, ignoreM2Model)
+// instead of the per-object one, detected here.
+template<typename RayCallback, typename = void>
+struct BIHCanBatchLeaf : std::false_type {};
+
+template<typename RayCallback>
+struct BIHCanBatchLeaf<RayCallback, std::void_t<decltype(std::declval<RayCallback&>()(
+    std::declval<const Ray&>(), static_cast<const uint32*>(nullptr), int(),
+    std::declval<float&>(), bool(), bool()))>> : std::true_type {};
+
 /** Bounding Interval Hierarchy Class.
     Building and Ray-Intersection functions based on BIH from
     Sunflow, a Java Raytracer, released under MIT/X11 License
@@ -219,12 +232,23 @@ class BIH
                         {
                             // leaf - test some objects
                             int n = tree[node + 1];
-                            while (n > 0)
+                            if constexpr (BIHCanBatchLeaf<RayCallback>::value)
                             {
-                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirst, ignoreM2Model);
-                                if (stopAtFirst && hit) return;
-                                --n;
-                                ++offset;
+                                if (n > 0)
+                                {
+                                    bool hit = intersectCallback(r, &objects[offset], n, maxDist, stopAtFirst, ignoreM2Model);
+                                    if (stopAtFirst && hit) return;
+                                }
+                            }
+                            else
+                            {
+                                while (n > 0)
+                                {
+                                    bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirst, ignoreM2Model);
+                                    if (stopAtFirst && hit) return;
+                                    --n;
+                                    ++offset;
+                                }
                             }
                             break;
                         }
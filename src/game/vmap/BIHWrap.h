@@ -57,42 +57,67 @@ class BIHWrap
 
         typedef G3D::Array<const T*> ObjArray;
 
+        enum
+        {
+            // rebuild mid-query only once this many changes accumulated;
+            // below that, removals are nulled slots skipped by the callback
+            // and pending inserts are tested by linear scan
+            PENDING_REBUILD_THRESHOLD = 8,
+            DEAD_SLOT_REBUILD_THRESHOLD = 16,
+        };
+
         BIH m_tree;
         ObjArray m_objects;
         G3D::Table<const T*, uint32> m_obj2Idx;
         G3D::Set<const T*> m_objects_to_push;
-        int unbalanced_times;
+        int m_deadObjects;
+
+        void balanceIfNeeded()
+        {
+            if (m_objects_to_push.size() >= PENDING_REBUILD_THRESHOLD || m_deadObjects >= DEAD_SLOT_REBUILD_THRESHOLD)
+                balance();
+        }
 
     public:
 
-        BIHWrap() : unbalanced_times(0) {}
+        BIHWrap() : m_deadObjects(0) {}
 
         void insert(const T& obj)
         {
-            ++unbalanced_times;
             m_objects_to_push.insert(&obj);
         }
 
         void remove(const T& obj)
         {
-            ++unbalanced_times;
             uint32 Idx = 0;
             const T* temp;
             if (m_obj2Idx.getRemove(&obj, temp, Idx))
+            {
                 m_objects[Idx] = nullptr;
+                ++m_deadObjects;
+            }
             else
                 m_objects_to_push.remove(&obj);
         }
 
         void balance()
         {
-            if (unbalanced_times == 0)
+            if (m_objects_to_push.size() == 0 && m_deadObjects == 0)
                 return;
 
-            unbalanced_times = 0;
-            m_objects.fastClear();
-            m_obj2Idx.getKeys(m_objects);
-            m_objects_to_push.getMembers(m_objects);
+            // fold pending inserts and compact dead slots in one rebuild
+            ObjArray buffer;
+            for (int i = 0; i < m_objects.size(); ++i)
+                if (m_objects[i])
+                    buffer.append(m_objects[i]);
+            m_objects_to_push.getMembers(buffer);
+            m_objects_to_push.clear();
+            m_deadObjects = 0;
+
+            m_objects = buffer;
+            m_obj2Idx.clear();
+            for (int i = 0; i < m_objects.size(); ++i)
+                m_obj2Idx.set(m_objects[i], i);
 
             m_tree.build(m_objects, BoundsFunc::getBounds2);
         }
@@ -100,16 +125,21 @@ class BIHWrap
         template<typename RayCallback>
         void intersectRay(const Ray& r, RayCallback& intersectCallback, float& maxDist, bool ignoreM2Model)
         {
-            balance();
+            balanceIfNeeded();
             MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
             m_tree.intersectRay(r, temp_cb, maxDist, true, ignoreM2Model);
+            for (typename G3D::Set<const T*>::Iterator it = m_objects_to_push.begin(); it != m_objects_to_push.end(); ++it)
+                if (intersectCallback(r, **it, maxDist, true, ignoreM2Model))
+                    break;
         }
 
         template<typename IsectCallback>
         void intersectPoint(const Vector3& p, IsectCallback& intersectCallback)
         {
-            balance();
+            balanceIfNeeded();
             MDLCallback<IsectCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
             m_tree.intersectPoint(p, temp_cb);
+            for (typename G3D::Set<const T*>::Iterator it = m_objects_to_push.begin(); it != m_objects_to_push.end(); ++it)
+                intersectCallback(p, **it);
         }
 };
@@ -22,6 +22,10 @@
 #include "ModelInstance.h"
 #include <string.h>
 
+#ifdef VMAP_SSE2_RAYTEST
+#include <emmintrin.h>
+#endif
+
 using G3D::Vector3;
 using G3D::Ray;
 
@@ -85,6 +89,98 @@ namespace VMAP
         return false;
     }
 
+#ifdef VMAP_SSE2_RAYTEST
+    // 4-wide version of IntersectTriangle against the SoA layout: tests the
+    // whole triangle batch of a BIH leaf and keeps the closest lane.
+    // Semantics (epsilon, strict bounds tests) match the scalar version above;
+    // a near-zero determinant makes f infinite and the resulting NaN/inf
+    // compares reject the lane, same as the early-out up there.
+    bool IntersectTriangle4(const TriangleSoA& tris, const uint32* entries, int count, const G3D::Ray& ray, float& distance)
+    {
+        static const float EPS = 1e-5f;
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 eps = _mm_set1_ps(EPS);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        const __m128 orgX = _mm_set1_ps(ray.origin().x);
+        const __m128 orgY = _mm_set1_ps(ray.origin().y);
+        const __m128 orgZ = _mm_set1_ps(ray.origin().z);
+        const __m128 dirX = _mm_set1_ps(ray.direction().x);
+        const __m128 dirY = _mm_set1_ps(ray.direction().y);
+        const __m128 dirZ = _mm_set1_ps(ray.direction().z);
+
+        bool anyHit = false;
+        for (int base = 0; base < count; base += 4)
+        {
+            uint32 idx[4];
+            for (int lane = 0; lane < 4; ++lane)
+                idx[lane] = entries[(base + lane) < count ? base + lane : base]; // pad short batches by repeating
+
+            auto load4 = [&idx](const std::vector<float>& component)
+            {
+                return _mm_set_ps(component[idx[3]], component[idx[2]], component[idx[1]], component[idx[0]]);
+            };
+
+            const __m128 v0X = load4(tris.v0x), v0Y = load4(tris.v0y), v0Z = load4(tris.v0z);
+            const __m128 e1X = load4(tris.e1x), e1Y = load4(tris.e1y), e1Z = load4(tris.e1z);
+            const __m128 e2X = load4(tris.e2x), e2Y = load4(tris.e2y), e2Z = load4(tris.e2z);
+
+            // p = dir x e2
+            const __m128 pX = _mm_sub_ps(_mm_mul_ps(dirY, e2Z), _mm_mul_ps(dirZ, e2Y));
+            const __m128 pY = _mm_sub_ps(_mm_mul_ps(dirZ, e2X), _mm_mul_ps(dirX, e2Z));
+            const __m128 pZ = _mm_sub_ps(_mm_mul_ps(dirX, e2Y), _mm_mul_ps(dirY, e2X));
+
+            // a = e1 . p
+            const __m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1X, pX), _mm_mul_ps(e1Y, pY)), _mm_mul_ps(e1Z, pZ));
+            __m128 valid = _mm_cmpge_ps(_mm_and_ps(a, absMask), eps);
+            if (!_mm_movemask_ps(valid))
+                continue;
+
+            const __m128 f = _mm_div_ps(one, a);
+
+            // s = org - v0
+            const __m128 sX = _mm_sub_ps(orgX, v0X);
+            const __m128 sY = _mm_sub_ps(orgY, v0Y);
+            const __m128 sZ = _mm_sub_ps(orgZ, v0Z);
+
+            // u = f * (s . p)
+            const __m128 u = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sX, pX), _mm_mul_ps(sY, pY)), _mm_mul_ps(sZ, pZ)));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+            // q = s x e1
+            const __m128 qX = _mm_sub_ps(_mm_mul_ps(sY, e1Z), _mm_mul_ps(sZ, e1Y));
+            const __m128 qY = _mm_sub_ps(_mm_mul_ps(sZ, e1X), _mm_mul_ps(sX, e1Z));
+            const __m128 qZ = _mm_sub_ps(_mm_mul_ps(sX, e1Y), _mm_mul_ps(sY, e1X));
+
+            // v = f * (dir . q)
+            const __m128 v = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dirX, qX), _mm_mul_ps(dirY, qY)), _mm_mul_ps(dirZ, qZ)));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+            // t = f * (e2 . q)
+            const __m128 t = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2X, qX), _mm_mul_ps(e2Y, qY)), _mm_mul_ps(e2Z, qZ)));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmplt_ps(t, _mm_set1_ps(distance))));
+
+            const int hitMask = _mm_movemask_ps(valid);
+            if (!hitMask)
+                continue;
+
+            float lanes[4];
+            _mm_storeu_ps(lanes, t);
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                if ((hitMask & (1 << lane)) && lanes[lane] < distance)
+                {
+                    distance = lanes[lane];
+                    anyHit = true;
+                }
+            }
+        }
+        return anyHit;
+    }
+#endif
+
     class TriBoundFunc
     {
         public:
@@ -252,6 +348,9 @@ namespace VMAP
         iBound(other.iBound), iMogpFlags(other.iMogpFlags), iGroupWMOID(other.iGroupWMOID),
         vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(nullptr)
     {
+#ifdef VMAP_SSE2_RAYTEST
+        trianglesSoA = other.trianglesSoA;
+#endif
         if (other.iLiquid)
             iLiquid = new WmoLiquid(*other.iLiquid);
     }
@@ -262,8 +361,42 @@ namespace VMAP
         triangles.swap(tri);
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
+#ifdef VMAP_SSE2_RAYTEST
+        buildTriangleSoA();
+#endif
     }
 
+#ifdef VMAP_SSE2_RAYTEST
+    void GroupModel::buildTriangleSoA()
+    {
+        const size_t count = triangles.size();
+        trianglesSoA.v0x.resize(count);
+        trianglesSoA.v0y.resize(count);
+        trianglesSoA.v0z.resize(count);
+        trianglesSoA.e1x.resize(count);
+        trianglesSoA.e1y.resize(count);
+        trianglesSoA.e1z.resize(count);
+        trianglesSoA.e2x.resize(count);
+        trianglesSoA.e2y.resize(count);
+        trianglesSoA.e2z.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Vector3& v0 = vertices[triangles[i].idx0];
+            const Vector3 e1 = vertices[triangles[i].idx1] - v0;
+            const Vector3 e2 = vertices[triangles[i].idx2] - v0;
+            trianglesSoA.v0x[i] = v0.x;
+            trianglesSoA.v0y[i] = v0.y;
+            trianglesSoA.v0z[i] = v0.z;
+            trianglesSoA.e1x[i] = e1.x;
+            trianglesSoA.e1y[i] = e1.y;
+            trianglesSoA.e1z[i] = e1.z;
+            trianglesSoA.e2x[i] = e2.x;
+            trianglesSoA.e2y[i] = e2.y;
+            trianglesSoA.e2z[i] = e2.z;
+        }
+    }
+#endif
+
     bool GroupModel::writeToFile(FILE* wf)
     {
         bool result = true;
@@ -349,6 +482,10 @@ namespace VMAP
         if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
         if (result && chunkSize > 0)
             result = WmoLiquid::readFromFile(rf, iLiquid);
+#ifdef VMAP_SSE2_RAYTEST
+        if (result)
+            buildTriangleSoA();
+#endif
         return result;
     }
 
@@ -367,11 +504,32 @@ namespace VMAP
         bool hit;
     };
 
+#ifdef VMAP_SSE2_RAYTEST
+    // leaf-batching variant: the BIH hands it whole leaves at once (see
+    // BIHCanBatchLeaf) and the 4-wide kernel tests them in one go
+    struct GModelRayCallbackSSE
+    {
+        GModelRayCallbackSSE(const TriangleSoA& tris): triangles(&tris), hit(false) {}
+        bool operator()(const G3D::Ray& ray, const uint32* entries, int count, float& distance, bool /*pStopAtFirstHit*/, bool /*ignoreM2Model*/)
+        {
+            if (IntersectTriangle4(*triangles, entries, count, ray, distance))
+                hit = true;
+            return hit;
+        }
+        const TriangleSoA* triangles;
+        bool hit;
+    };
+#endif
+
     bool GroupModel::IntersectRay(const G3D::Ray& ray, float& distance, bool stopAtFirstHit, bool ignoreM2Model) const
     {
         if (triangles.empty())
             return false;
+#ifdef VMAP_SSE2_RAYTEST
+        GModelRayCallbackSSE callback(trianglesSoA);
+#else
         GModelRayCallback callback(triangles, vertices);
+#endif
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit, ignoreM2Model);
         return callback.hit;
     }
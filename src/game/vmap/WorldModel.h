@@ -26,6 +26,11 @@
 
 #include "Platform/Define.h"
 
+// x86-64 guarantees SSE2; use the 4-wide triangle intersection kernel there
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VMAP_SSE2_RAYTEST
+#endif
+
 namespace VMAP
 {
     class TreeNode;
@@ -45,6 +50,18 @@ namespace VMAP
             uint32 idx2;
     };
 
+#ifdef VMAP_SSE2_RAYTEST
+    /*! triangles rearranged for the 4-wide ray test: one flat array per
+        component, with the two edge vectors precomputed so the kernel only
+        gathers and never chases vertex indices */
+    struct TriangleSoA
+    {
+        std::vector<float> v0x, v0y, v0z;   // first vertex
+        std::vector<float> e1x, e1y, e1z;   // edge vertex1 - vertex0
+        std::vector<float> e2x, e2y, e2z;   // edge vertex2 - vertex0
+    };
+#endif
+
     class WmoLiquid
     {
         public:
@@ -103,6 +120,10 @@ namespace VMAP
             std::vector<MeshTriangle> triangles;
             BIH meshTree;
             WmoLiquid* iLiquid;
+#ifdef VMAP_SSE2_RAYTEST
+            void buildTriangleSoA();
+            TriangleSoA trianglesSoA;
+#endif
 
 #ifdef MMAP_GENERATOR
         public:
@@ -28,6 +28,7 @@
 #include "Master.h"
 #include "SystemConfig.h"
 #include "AuctionHouseBot/AuctionHouseBot.h"
+#include "Server/ReplayMgr.h"
 #include "PlayerBot/config.h"
 
 #include <openssl/opensslv.h>
@@ -68,7 +69,7 @@ uint32 realmID;                                             ///< Id of the realm
 /// Launch the mangos server
 int main(int argc, char* argv[])
 {
-    std::string auctionBotConfig, configFile, playerBotConfig, serviceParameter;
+    std::string auctionBotConfig, configFile, playerBotConfig, serviceParameter, replayFile;
 
     boost::program_options::options_description desc("Allowed options");
     desc.add_options()
@@ -77,6 +78,7 @@ int main(int argc, char* argv[])
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     ("playerbot,p", boost::program_options::value<std::string>(&playerBotConfig)->default_value(_D_PLAYERBOT_CONFIG), "playerbot configuration file")
 #endif
+    ("replay", boost::program_options::value<std::string>(&replayFile), "feed a world-tick capture (see ReplayCaptureFile) through the server - use a snapshot database")
     ("help,h", "prints usage")
     ("version,v", "print version and exit")
 #ifdef _WIN32
@@ -116,6 +118,9 @@ int main(int argc, char* argv[])
     if (vm.count("ahbot"))
         sAuctionHouseBot.SetConfigFileName(auctionBotConfig);
 
+    if (vm.count("replay"))
+        sReplayMgr.SetFileName(replayFile);
+
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     if (vm.count("playerbot"))
         _PLAYERBOT_CONFIG = playerBotConfig;
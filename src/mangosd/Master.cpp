@@ -138,6 +138,52 @@ int Master::Run()
     ///- Catch termination signals
     _HookSignals();
 
+    ///- Hold a warm standby here until the failover trigger appears
+    if (sWorld.IsStandby())
+    {
+        std::string triggerFile = sConfig.GetStringDefault("Standby.TriggerFile", "mangosd.activate");
+        sLog.outString("Standby: world pre-loaded, create file '%s' (or send a termination signal) to go live", triggerFile.c_str());
+
+        uint32 pingCounter = 0;
+        while (!World::IsStopped())
+        {
+            if (FILE* trigger = fopen(triggerFile.c_str(), "rb"))
+            {
+                fclose(trigger);
+                remove(triggerFile.c_str());
+                break;
+            }
+
+            // keep the idle connections alive through long standby windows
+            if (++pingCounter >= 10 * MINUTE)
+            {
+                pingCounter = 0;
+                LoginDatabase.Ping();
+                WorldDatabase.Ping();
+                CharacterDatabase.Ping();
+                LogsDatabase.Ping();
+            }
+
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+
+        if (World::IsStopped())
+        {
+            // never went live: leave realmlist and online flags alone, the
+            // primary may still own them
+            sLog.outString("Standby: termination requested before activation");
+            _UnhookSignals();
+            CharacterDatabase.HaltDelayThread();
+            WorldDatabase.HaltDelayThread();
+            LoginDatabase.HaltDelayThread();
+            LogsDatabase.HaltDelayThread();
+            m_canBeKilled = true;
+            return World::GetExitCode();
+        }
+
+        sWorld.ActivateStandby();
+    }
+
     ///- Launch WorldRunnable thread
     MaNGOS::Thread world_thread(new WorldRunnable);
     world_thread.setPriority(MaNGOS::Priority_Highest);
@@ -151,6 +197,7 @@ int Master::Run()
 
     sWorld.StartLFGQueueThread();
     sWorld.StartBGQueueThread();
+    sWorld.StartAuctionHouseSearchThread();
 
     MaNGOS::Thread* cliThread = nullptr;
 
@@ -344,15 +391,16 @@ bool Master::_StartDB()
     ///- Get world database info from configuration file
     std::string dbstring = sConfig.GetStringDefault("WorldDatabaseInfo");
     int nConnections = sConfig.GetIntDefault("WorldDatabaseConnections", 1);
+    int nAsyncQueryThreads = sConfig.GetIntDefault("WorldDatabaseAsyncQueryThreads", 0);
     if (dbstring.empty())
     {
         sLog.outError("Database not specified in configuration file");
         return false;
     }
-    sLog.outString("World Database total connections: %i", nConnections + 1);
+    sLog.outString("World Database total connections: %i", nConnections + 1 + nAsyncQueryThreads);
 
     ///- Initialise the world database
-    if (!WorldDatabase.Initialize(dbstring.c_str(), nConnections))
+    if (!WorldDatabase.Initialize(dbstring.c_str(), nConnections, nAsyncQueryThreads))
     {
         sLog.outError("Cannot connect to world database %s", dbstring.c_str());
         return false;
@@ -367,6 +415,7 @@ bool Master::_StartDB()
 
     dbstring = sConfig.GetStringDefault("CharacterDatabaseInfo");
     nConnections = sConfig.GetIntDefault("CharacterDatabaseConnections", 1);
+    nAsyncQueryThreads = sConfig.GetIntDefault("CharacterDatabaseAsyncQueryThreads", 0);
     if (dbstring.empty())
     {
         sLog.outError("Character Database not specified in configuration file");
@@ -375,10 +424,10 @@ bool Master::_StartDB()
         WorldDatabase.HaltDelayThread();
         return false;
     }
-    sLog.outString("Character Database total connections: %i", nConnections + 1);
+    sLog.outString("Character Database total connections: %i", nConnections + 1 + nAsyncQueryThreads);
 
     ///- Initialise the Character database
-    if (!CharacterDatabase.Initialize(dbstring.c_str(), nConnections))
+    if (!CharacterDatabase.Initialize(dbstring.c_str(), nConnections, nAsyncQueryThreads))
     {
         sLog.outError("Cannot connect to Character database %s", dbstring.c_str());
 
@@ -395,9 +444,22 @@ bool Master::_StartDB()
         return false;
     }
 
+    ///- Attach the character save write-ahead journal and replay crash leftovers
+    std::string journalPath = sConfig.GetStringDefault("Database.CharacterJournal");
+    if (!journalPath.empty() && !CharacterDatabase.InitJournal(journalPath.c_str()))
+    {
+        sLog.outError("Cannot open character save journal %s", journalPath.c_str());
+
+        ///- Wait for already started DB delay threads to end
+        WorldDatabase.HaltDelayThread();
+        CharacterDatabase.HaltDelayThread();
+        return false;
+    }
+
     ///- Get login database info from configuration file
     dbstring = sConfig.GetStringDefault("LoginDatabaseInfo");
     nConnections = sConfig.GetIntDefault("LoginDatabaseConnections", 1);
+    nAsyncQueryThreads = sConfig.GetIntDefault("LoginDatabaseAsyncQueryThreads", 0);
     if (dbstring.empty())
     {
         sLog.outError("Login database not specified in configuration file");
@@ -409,8 +471,8 @@ bool Master::_StartDB()
     }
 
     ///- Initialise the login database
-    sLog.outString("Login Database total connections: %i", nConnections + 1);
-    if (!LoginDatabase.Initialize(dbstring.c_str(), nConnections))
+    sLog.outString("Login Database total connections: %i", nConnections + 1 + nAsyncQueryThreads);
+    if (!LoginDatabase.Initialize(dbstring.c_str(), nConnections, nAsyncQueryThreads))
     {
         sLog.outError("Cannot connect to login database %s", dbstring.c_str());
 
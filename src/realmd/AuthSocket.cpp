@@ -196,6 +196,25 @@ AuthSocket::AuthSocket(boost::asio::io_context& context)
 {
 }
 
+boost::asio::thread_pool* AuthSocket::s_workerPool = nullptr;
+
+void AuthSocket::SetWorkerPool(boost::asio::thread_pool* pool)
+{
+    s_workerPool = pool;
+}
+
+/// Continue authentication off the network threads. SRP6 modular exponentiation and the
+/// blocking LoginDatabase lookups would otherwise serialize every pending logon behind
+/// the socket currently being served. Per-socket ordering is preserved because the auth
+/// protocol never has more than one outstanding read per connection.
+void AuthSocket::PostWork(std::function<void()>&& work)
+{
+    if (s_workerPool)
+        boost::asio::post(*s_workerPool, std::move(work));
+    else
+        work();
+}
+
 bool AuthSocket::OnOpen()
 {
     m_timeoutTimer.expires_after(std::chrono::seconds(30));
@@ -356,193 +375,201 @@ bool AuthSocket::_HandleLogonChallenge()
                 return;
             }
 
-            if (body->userName_len > AUTH_LOGON_MAX_NAME)
-                return;
+            ///- account lookup and SRP ephemeral generation continue on the worker pool
+            PostWork([self, header, body]() { self->ProcessLogonChallenge(header, body); });
+        });
+    });
 
-            body->userName[body->userName_len] = '\0';
+    return true;
+}
 
-            DEBUG_LOG("[AuthChallenge] got full packet, %#04x bytes", header->size);
-            DEBUG_LOG("[AuthChallenge] name(%d): '%s'", body->userName_len, body->userName);
+void AuthSocket::ProcessLogonChallenge(std::shared_ptr<sAuthLogonChallengeHeader> header, std::shared_ptr<sAuthLogonChallengeBody> body)
+{
+    std::shared_ptr<AuthSocket> self = shared_from_this();
 
-            // BigEndian code, nop in little endian case
-            // size already converted
-            EndianConvert(*((uint32*)(&body->gamename[0])));
-            EndianConvert(body->build);
-            EndianConvert(*((uint32*)(&body->platform[0])));
-            EndianConvert(*((uint32*)(&body->os[0])));
-            EndianConvert(*((uint32*)(&body->country[0])));
-            EndianConvert(body->timezone_bias);
-            EndianConvert(body->ip);
+    if (body->userName_len > AUTH_LOGON_MAX_NAME)
+        return;
 
-            std::shared_ptr<ByteBuffer> pkt = std::make_shared<ByteBuffer>();
+    body->userName[body->userName_len] = '\0';
+
+    DEBUG_LOG("[AuthChallenge] got full packet, %#04x bytes", header->size);
+    DEBUG_LOG("[AuthChallenge] name(%d): '%s'", body->userName_len, body->userName);
+
+    // BigEndian code, nop in little endian case
+    // size already converted
+    EndianConvert(*((uint32*)(&body->gamename[0])));
+    EndianConvert(body->build);
+    EndianConvert(*((uint32*)(&body->platform[0])));
+    EndianConvert(*((uint32*)(&body->os[0])));
+    EndianConvert(*((uint32*)(&body->country[0])));
+    EndianConvert(body->timezone_bias);
+    EndianConvert(body->ip);
+
+    std::shared_ptr<ByteBuffer> pkt = std::make_shared<ByteBuffer>();
+
+    self->_login = (const char*)body->userName;
+    self->_build = body->build;
+
+    // Convert uint8[4] to string, restore string order as its byte order is reversed
+    body->os[3] = '\0';
+    self->m_os = (char*)body->os;
+    std::reverse(self->m_os.begin(), self->m_os.end());
+    body->platform[3] = '\0';
+    self->m_platform = (char*)body->platform;
+    std::reverse(self->m_platform.begin(), self->m_platform.end());
+
+    self->m_locale.resize(sizeof(body->country));
+    self->m_locale.assign(body->country, (body->country + sizeof(body->country)));
+    std::reverse(self->m_locale.begin(), self->m_locale.end());
+
+    ///- Normalize account name
+    // utf8ToUpperOnlyLatin(_login); -- client already send account in expected form
+
+    // Escape the user input used in DB to avoid further SQL injection
+    // Memory will be freed on AuthSocket object destruction
+    self->_safelogin = self->_login;
+    LoginDatabase.escape_string(self->_safelogin);
+    self->_safelocale = self->m_locale;
+    LoginDatabase.escape_string(self->_safelocale);
+    LoginDatabase.escape_string(self->m_os);
+
+    *pkt << uint8(CMD_AUTH_LOGON_CHALLENGE);
+    *pkt << uint8(0x00);
+
+    ///- Verify that this IP is not in the ip_banned table
+    // No SQL injection possible (paste the IP address as passed by the socket)
+    std::unique_ptr<QueryResult> ip_banned_result(LoginDatabase.PQuery("SELECT expires_at FROM ip_banned "
+        "WHERE (expires_at = banned_at OR expires_at > " _UNIXTIME_ ") AND ip = '%s'", self->GetRemoteAddress().c_str()));
+
+    if (ip_banned_result)
+    {
+        *pkt << uint8(AUTH_LOGON_FAILED_FAIL_NOACCESS);
+        BASIC_LOG("[AuthChallenge] Banned ip %s tries to login!", self->GetRemoteAddress().c_str());
+    }
+    else
+    {
+        ///- Get the account details from the account table
+        // No SQL injection (escaped user name)
+        auto queryResult = LoginDatabase.PQuery("SELECT id,locked,lockedIp,gmlevel,v,s,token FROM account WHERE username = '%s'", self->_safelogin.c_str());
+        if (queryResult)
+        {
+            Field* fields = queryResult->Fetch();
 
-            self->_login = (const char*)body->userName;
-            self->_build = body->build;
-
-            // Convert uint8[4] to string, restore string order as its byte order is reversed
-            body->os[3] = '\0';
-            self->m_os = (char*)body->os;
-            std::reverse(self->m_os.begin(), self->m_os.end());
-            body->platform[3] = '\0';
-            self->m_platform = (char*)body->platform;
-            std::reverse(self->m_platform.begin(), self->m_platform.end());
-
-            self->m_locale.resize(sizeof(body->country));
-            self->m_locale.assign(body->country, (body->country + sizeof(body->country)));
-            std::reverse(self->m_locale.begin(), self->m_locale.end());
-
-            ///- Normalize account name
-            // utf8ToUpperOnlyLatin(_login); -- client already send account in expected form
-
-            // Escape the user input used in DB to avoid further SQL injection
-            // Memory will be freed on AuthSocket object destruction
-            self->_safelogin = self->_login;
-            LoginDatabase.escape_string(self->_safelogin);
-            self->_safelocale = self->m_locale;
-            LoginDatabase.escape_string(self->_safelocale);
-            LoginDatabase.escape_string(self->m_os);
-
-            *pkt << uint8(CMD_AUTH_LOGON_CHALLENGE);
-            *pkt << uint8(0x00);
-
-            ///- Verify that this IP is not in the ip_banned table
-            // No SQL injection possible (paste the IP address as passed by the socket)
-            std::unique_ptr<QueryResult> ip_banned_result(LoginDatabase.PQuery("SELECT expires_at FROM ip_banned "
-                "WHERE (expires_at = banned_at OR expires_at > " _UNIXTIME_ ") AND ip = '%s'", self->GetRemoteAddress().c_str()));
-
-            if (ip_banned_result)
+            ///- If the IP is 'locked', check that the player comes indeed from the correct IP address
+            bool locked = false;
+            if (fields[1].GetUInt8() == 1)               // if ip is locked
             {
-                *pkt << uint8(AUTH_LOGON_FAILED_FAIL_NOACCESS);
-                BASIC_LOG("[AuthChallenge] Banned ip %s tries to login!", self->GetRemoteAddress().c_str());
+                DEBUG_LOG("[AuthChallenge] Account '%s' is locked to IP - '%s'", self->_login.c_str(), fields[2].GetString());
+                DEBUG_LOG("[AuthChallenge] Player address is '%s'", self->GetRemoteAddress().c_str());
+                if (strcmp(fields[2].GetString(), self->GetRemoteAddress().c_str()))
+                {
+                    DEBUG_LOG("[AuthChallenge] Account IP differs");
+                    *pkt << uint8(AUTH_LOGON_FAILED_SUSPENDED);
+                    locked = true;
+                }
+                else
+                    DEBUG_LOG("[AuthChallenge] Account IP matches");
             }
             else
+                DEBUG_LOG("[AuthChallenge] Account '%s' is not locked to ip", self->_login.c_str());
+
+            std::string databaseV = fields[4].GetCppString();
+            std::string databaseS = fields[5].GetCppString();
+            bool broken = false;
+
+            if (!self->srp.SetVerifier(databaseV.c_str()) || !self->srp.SetSalt(databaseS.c_str()))
             {
-                ///- Get the account details from the account table
-                // No SQL injection (escaped user name)
-                auto queryResult = LoginDatabase.PQuery("SELECT id,locked,lockedIp,gmlevel,v,s,token FROM account WHERE username = '%s'", self->_safelogin.c_str());
-                if (queryResult)
-                {
-                    Field* fields = queryResult->Fetch();
+                *pkt << uint8(AUTH_LOGON_FAILED_FAIL_NOACCESS);
+                DEBUG_LOG("[AuthChallenge] Broken v/s values in database for account %s!", self->_login.c_str());
+                broken = true;
+            }
 
-                    ///- If the IP is 'locked', check that the player comes indeed from the correct IP address
-                    bool locked = false;
-                    if (fields[1].GetUInt8() == 1)               // if ip is locked
+            if (!locked && !broken)
+            {
+                ///- If the account is banned, reject the logon attempt
+                auto banresult = LoginDatabase.PQuery("SELECT banned_at,expires_at FROM account_banned WHERE "
+                    "account_id = %u AND active = 1 AND (expires_at > " _UNIXTIME_ " OR expires_at = banned_at)", fields[0].GetUInt32());
+                if (banresult)
+                {
+                    if ((*banresult)[0].GetUInt64() == (*banresult)[1].GetUInt64())
                     {
-                        DEBUG_LOG("[AuthChallenge] Account '%s' is locked to IP - '%s'", self->_login.c_str(), fields[2].GetString());
-                        DEBUG_LOG("[AuthChallenge] Player address is '%s'", self->GetRemoteAddress().c_str());
-                        if (strcmp(fields[2].GetString(), self->GetRemoteAddress().c_str()))
-                        {
-                            DEBUG_LOG("[AuthChallenge] Account IP differs");
-                            *pkt << uint8(AUTH_LOGON_FAILED_SUSPENDED);
-                            locked = true;
-                        }
-                        else
-                            DEBUG_LOG("[AuthChallenge] Account IP matches");
+                        *pkt << uint8(AUTH_LOGON_FAILED_BANNED);
+                        BASIC_LOG("[AuthChallenge] Banned account %s tries to login!", self->_login.c_str());
                     }
                     else
-                        DEBUG_LOG("[AuthChallenge] Account '%s' is not locked to ip", self->_login.c_str());
+                    {
+                        *pkt << uint8(AUTH_LOGON_FAILED_SUSPENDED);
+                        BASIC_LOG("[AuthChallenge] Temporarily banned account %s tries to login!", self->_login.c_str());
+                    }
+                }
+                else
+                {
+                    DEBUG_LOG("database authentication values: v='%s' s='%s'", databaseV.c_str(), databaseS.c_str());
+
+                    BigNumber s;
+                    s.SetHexStr(databaseS.c_str());
+
+                    self->srp.CalculateHostPublicEphemeral();
 
-                    std::string databaseV = fields[4].GetCppString();
-                    std::string databaseS = fields[5].GetCppString();
-                    bool broken = false;
+                    ///- Fill the response packet with the result
+                    *pkt << uint8(AUTH_LOGON_SUCCESS);
 
-                    if (!self->srp.SetVerifier(databaseV.c_str()) || !self->srp.SetSalt(databaseS.c_str()))
+                    // B may be calculated < 32B so we force minimal length to 32B
+                    pkt->append(self->srp.GetHostPublicEphemeral().AsByteArray(32));      // 32 bytes
+                    *pkt << uint8(1);
+                    pkt->append(self->srp.GetGeneratorModulo().AsByteArray());
+                    *pkt << uint8(32);
+                    pkt->append(self->srp.GetPrime().AsByteArray(32));
+                    pkt->append(s.AsByteArray());// 32 bytes
+                    pkt->append(VersionChallenge.data(), VersionChallenge.size());
+                    uint8 securityFlags = 0;
+
+                    self->_token = fields[6].GetCppString();
+                    if (!self->_token.empty() && self->_build >= 8606) // authenticator was added in 2.4.3
+                        securityFlags = SECURITY_FLAG_AUTHENTICATOR;
+
+                    if (!self->_token.empty() && self->_build <= 6141)
+                        securityFlags = SECURITY_FLAG_PIN;
+
+                    *pkt << uint8(securityFlags);                    // security flags (0x0...0x04)
+
+                    if (securityFlags & SECURITY_FLAG_PIN)          // PIN input
                     {
-                        *pkt << uint8(AUTH_LOGON_FAILED_FAIL_NOACCESS);
-                        DEBUG_LOG("[AuthChallenge] Broken v/s values in database for account %s!", self->_login.c_str());
-                        broken = true;
+                        uint32 gridSeedPkt = self->m_gridSeed = static_cast<uint32>(0);
+                        EndianConvert(gridSeedPkt);
+                        self->m_serverSecuritySalt.SetRand(16 * 8); // 16 bytes random
+                        self->m_promptPin = true;
+
+                        *pkt << gridSeedPkt;
+                        pkt->append(self->m_serverSecuritySalt.AsByteArray(16).data(), 16);
                     }
 
-                    if (!locked && !broken)
+                    if (securityFlags & SECURITY_FLAG_UNK)          // Matrix input
                     {
-                        ///- If the account is banned, reject the logon attempt
-                        auto banresult = LoginDatabase.PQuery("SELECT banned_at,expires_at FROM account_banned WHERE "
-                            "account_id = %u AND active = 1 AND (expires_at > " _UNIXTIME_ " OR expires_at = banned_at)", fields[0].GetUInt32());
-                        if (banresult)
-                        {
-                            if ((*banresult)[0].GetUInt64() == (*banresult)[1].GetUInt64())
-                            {
-                                *pkt << uint8(AUTH_LOGON_FAILED_BANNED);
-                                BASIC_LOG("[AuthChallenge] Banned account %s tries to login!", self->_login.c_str());
-                            }
-                            else
-                            {
-                                *pkt << uint8(AUTH_LOGON_FAILED_SUSPENDED);
-                                BASIC_LOG("[AuthChallenge] Temporarily banned account %s tries to login!", self->_login.c_str());
-                            }
-                        }
-                        else
-                        {
-                            DEBUG_LOG("database authentication values: v='%s' s='%s'", databaseV.c_str(), databaseS.c_str());
-
-                            BigNumber s;
-                            s.SetHexStr(databaseS.c_str());
-
-                            self->srp.CalculateHostPublicEphemeral();
-
-                            ///- Fill the response packet with the result
-                            *pkt << uint8(AUTH_LOGON_SUCCESS);
-
-                            // B may be calculated < 32B so we force minimal length to 32B
-                            pkt->append(self->srp.GetHostPublicEphemeral().AsByteArray(32));      // 32 bytes
-                            *pkt << uint8(1);
-                            pkt->append(self->srp.GetGeneratorModulo().AsByteArray());
-                            *pkt << uint8(32);
-                            pkt->append(self->srp.GetPrime().AsByteArray(32));
-                            pkt->append(s.AsByteArray());// 32 bytes
-                            pkt->append(VersionChallenge.data(), VersionChallenge.size());
-                            uint8 securityFlags = 0;
-
-                            self->_token = fields[6].GetCppString();
-                            if (!self->_token.empty() && self->_build >= 8606) // authenticator was added in 2.4.3
-                                securityFlags = SECURITY_FLAG_AUTHENTICATOR;
-
-                            if (!self->_token.empty() && self->_build <= 6141)
-                                securityFlags = SECURITY_FLAG_PIN;
-
-                            *pkt << uint8(securityFlags);                    // security flags (0x0...0x04)
-
-                            if (securityFlags & SECURITY_FLAG_PIN)          // PIN input
-                            {
-                                uint32 gridSeedPkt = self->m_gridSeed = static_cast<uint32>(0);
-                                EndianConvert(gridSeedPkt);
-                                self->m_serverSecuritySalt.SetRand(16 * 8); // 16 bytes random
-                                self->m_promptPin = true;
-
-                                *pkt << gridSeedPkt;
-                                pkt->append(self->m_serverSecuritySalt.AsByteArray(16).data(), 16);
-                            }
-
-                            if (securityFlags & SECURITY_FLAG_UNK)          // Matrix input
-                            {
-                                *pkt << uint8(0);
-                                *pkt << uint8(0);
-                                *pkt << uint8(0);
-                                *pkt << uint8(0);
-                                *pkt << uint64(0);
-                            }
-
-                            if (securityFlags & SECURITY_FLAG_AUTHENTICATOR)    // Authenticator input
-                                *pkt << uint8(1);
-
-                            uint8 secLevel = fields[3].GetUInt8();
-                            self->_accountSecurityLevel = secLevel <= SEC_ADMINISTRATOR ? AccountTypes(secLevel) : SEC_ADMINISTRATOR;
-
-                            ///- All good, await client's proof
-                            self->_status = STATUS_LOGON_PROOF;
-                        }
+                        *pkt << uint8(0);
+                        *pkt << uint8(0);
+                        *pkt << uint8(0);
+                        *pkt << uint8(0);
+                        *pkt << uint64(0);
                     }
+
+                    if (securityFlags & SECURITY_FLAG_AUTHENTICATOR)    // Authenticator input
+                        *pkt << uint8(1);
+
+                    uint8 secLevel = fields[3].GetUInt8();
+                    self->_accountSecurityLevel = secLevel <= SEC_ADMINISTRATOR ? AccountTypes(secLevel) : SEC_ADMINISTRATOR;
+
+                    ///- All good, await client's proof
+                    self->_status = STATUS_LOGON_PROOF;
                 }
-                else                                                // no account
-                    *pkt << uint8(AUTH_LOGON_FAILED_UNKNOWN_ACCOUNT);
             }
+        }
+        else                                                // no account
+            *pkt << uint8(AUTH_LOGON_FAILED_UNKNOWN_ACCOUNT);
+    }
 
-            self->Write((const char*)pkt->contents(), pkt->size(), [self, pkt](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-            self->ProcessIncomingData();
-        });
-    });
-
-    return true;
+    self->Write((const char*)pkt->contents(), pkt->size(), [self, pkt](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
+    self->ProcessIncomingData();
 }
 
 /// Logon Proof command handler
@@ -560,142 +587,150 @@ bool AuthSocket::_HandleLogonProof()
             return;
         }
 
-        ///- Session is closed unless overriden
-        self->_status = STATUS_CLOSED;
+        ///- SRP session key math and failed-login bookkeeping are too heavy for a network thread
+        PostWork([self, lp]() { self->ProcessLogonProof(lp); });
+    });
 
-        /// <ul><li> If the client has no valid version
-        if (!FindBuildInfo(self->_build))
-        {
-            // no patch found
-            std::shared_ptr<ByteBuffer> pkt = std::make_shared<ByteBuffer>();
-            *pkt << uint8(CMD_AUTH_LOGON_CHALLENGE);
-            *pkt << uint8(0x00);
-            *pkt << uint8(AUTH_LOGON_FAILED_VERSION_INVALID);
+    return true;
+}
 
-            BASIC_LOG("[AuthChallenge] Account %s tried to login with invalid client version %u!", self->_login.c_str(), self->_build);
-            self->Write((const char*)pkt->contents(), pkt->size(), [self, pkt](const boost::system::error_code& /*error*/, std::size_t /*written*/) { self->Close();});
-            return;
-        }
-        /// </ul>
+void AuthSocket::ProcessLogonProof(std::shared_ptr<sAuthLogonProof_C> lp)
+{
+    std::shared_ptr<AuthSocket> self = shared_from_this();
 
-        ///- Continue the SRP6 calculation based on data received from the client
-        if (!self->srp.CalculateSessionKey(lp->A, 32))
-        {
-            BASIC_LOG("[AuthChallenge] Session calculation failed for account %s!", self->_login.c_str());
-            return;
-        }
+    ///- Session is closed unless overriden
+    self->_status = STATUS_CLOSED;
+
+    /// <ul><li> If the client has no valid version
+    if (!FindBuildInfo(self->_build))
+    {
+        // no patch found
+        std::shared_ptr<ByteBuffer> pkt = std::make_shared<ByteBuffer>();
+        *pkt << uint8(CMD_AUTH_LOGON_CHALLENGE);
+        *pkt << uint8(0x00);
+        *pkt << uint8(AUTH_LOGON_FAILED_VERSION_INVALID);
+
+        BASIC_LOG("[AuthChallenge] Account %s tried to login with invalid client version %u!", self->_login.c_str(), self->_build);
+        self->Write((const char*)pkt->contents(), pkt->size(), [self, pkt](const boost::system::error_code& /*error*/, std::size_t /*written*/) { self->Close();});
+        return;
+    }
+    /// </ul>
+
+    ///- Continue the SRP6 calculation based on data received from the client
+    if (!self->srp.CalculateSessionKey(lp->A, 32))
+    {
+        BASIC_LOG("[AuthChallenge] Session calculation failed for account %s!", self->_login.c_str());
+        return;
+    }
 
-        self->srp.HashSessionKey();
-        self->srp.CalculateProof(self->_login);
+    self->srp.HashSessionKey();
+    self->srp.CalculateProof(self->_login);
 
-        ///- Check if SRP6 results match (password is correct), else send an error
-        if (!self->srp.Proof(lp->M1, 20))
+    ///- Check if SRP6 results match (password is correct), else send an error
+    if (!self->srp.Proof(lp->M1, 20))
+    {
+        if (self->_build > 6141 && (lp->securityFlags & SECURITY_FLAG_AUTHENTICATOR || !self->_token.empty()))
         {
-            if (self->_build > 6141 && (lp->securityFlags & SECURITY_FLAG_AUTHENTICATOR || !self->_token.empty()))
+            std::shared_ptr<uint8> pinCount = std::make_shared<uint8>();
+            self->Read((char*)pinCount.get(), sizeof(uint8), [self, pinCount, lp](const boost::system::error_code& error, std::size_t /*read*/)
             {
-                std::shared_ptr<uint8> pinCount = std::make_shared<uint8>();
-                self->Read((char*)pinCount.get(), sizeof(uint8), [self, pinCount, lp](const boost::system::error_code& error, std::size_t /*read*/)
+                if (error || *pinCount > 16)
+                {
+                    self->Write(logonProofUnknownAccountPinInvalid, sizeof(logonProofUnknownAccountPinInvalid), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) { self->Close();});
+                    return;
+                }
+
+                std::shared_ptr<std::vector<uint8>> keys = std::make_shared<std::vector<uint8>>(*pinCount + 1);
+                self->Read((char*)keys->data(), sizeof(uint8) * *pinCount, [self, pinCount, keys, lp](const boost::system::error_code& error, std::size_t /*read*/)
                 {
-                    if (error || *pinCount > 16)
+                    if (error)
                     {
                         self->Write(logonProofUnknownAccountPinInvalid, sizeof(logonProofUnknownAccountPinInvalid), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) { self->Close();});
                         return;
                     }
 
-                    std::shared_ptr<std::vector<uint8>> keys = std::make_shared<std::vector<uint8>>(*pinCount + 1);
-                    self->Read((char*)keys->data(), sizeof(uint8) * *pinCount, [self, pinCount, keys, lp](const boost::system::error_code& error, std::size_t /*read*/)
+                    (*keys)[*pinCount] = '\0';
+                    auto ServerToken = self->generateToken(self->_token.c_str());
+                    auto clientToken = atoi((const char*)keys->data());
+                    if (ServerToken != clientToken)
                     {
-                        if (error)
-                        {
-                            self->Write(logonProofUnknownAccountPinInvalid, sizeof(logonProofUnknownAccountPinInvalid), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) { self->Close();});
-                            return;
-                        }
-
-                        (*keys)[*pinCount] = '\0';
-                        auto ServerToken = self->generateToken(self->_token.c_str());
-                        auto clientToken = atoi((const char*)keys->data());
-                        if (ServerToken != clientToken)
-                        {
-                            BASIC_LOG("[AuthChallenge] Account %s tried to login with wrong pincode! Given %u Expected %u Pin Count: %u", self->_login.c_str(), clientToken, ServerToken, *pinCount);
-                            self->Write(logonProofUnknownAccount, sizeof(logonProofUnknownAccount), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-                            return;
-                        }
-
-                        self->verifyVersionAndFinalizeAuthentication(lp);
-                    });
+                        BASIC_LOG("[AuthChallenge] Account %s tried to login with wrong pincode! Given %u Expected %u Pin Count: %u", self->_login.c_str(), clientToken, ServerToken, *pinCount);
+                        self->Write(logonProofUnknownAccount, sizeof(logonProofUnknownAccount), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
+                        return;
+                    }
+
+                    PostWork([self, lp]() { self->verifyVersionAndFinalizeAuthentication(lp); });
                 });
-                return;
-            }
+            });
+            return;
+        }
 
-            if ((lp->securityFlags & SECURITY_FLAG_PIN) && !self->_token.empty())
+        if ((lp->securityFlags & SECURITY_FLAG_PIN) && !self->_token.empty())
+        {
+            int32 serverToken = self->generateToken(self->_token.c_str());
+            if (!self->VerifyPinData(serverToken, lp->pinData))
             {
-                int32 serverToken = self->generateToken(self->_token.c_str());
-                if (!self->VerifyPinData(serverToken, lp->pinData))
-                {
-                    BASIC_LOG("[AuthChallenge] Account %s tried to login with wrong pincode!", self->_login.c_str());
-                    self->Write(logonProofUnknownAccount, sizeof(logonProofUnknownAccount), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-                    return;
-                }
+                BASIC_LOG("[AuthChallenge] Account %s tried to login with wrong pincode!", self->_login.c_str());
+                self->Write(logonProofUnknownAccount, sizeof(logonProofUnknownAccount), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
+                return;
             }
+        }
 
-            self->verifyVersionAndFinalizeAuthentication(lp);
+        self->verifyVersionAndFinalizeAuthentication(lp);
+    }
+    else
+    {
+        if (self->_build > 6005)                                  // > 1.12.2
+        {
+            self->Write(logonProofUnknownAccount, sizeof(logonProofUnknownAccount), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
         }
         else
         {
-            if (self->_build > 6005)                                  // > 1.12.2
-            {
-                self->Write(logonProofUnknownAccount, sizeof(logonProofUnknownAccount), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-            }
-            else
-            {
-                // 1.x not react incorrectly at 4-byte message use 3 as real error
-                self->Write(logonProofUnknownAccountVanilla, sizeof(logonProofUnknownAccountVanilla), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
-            }
+            // 1.x not react incorrectly at 4-byte message use 3 as real error
+            self->Write(logonProofUnknownAccountVanilla, sizeof(logonProofUnknownAccountVanilla), [self](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
+        }
 
-            BASIC_LOG("[AuthChallenge] account %s tried to login with wrong password!", self->_login.c_str());
+        BASIC_LOG("[AuthChallenge] account %s tried to login with wrong password!", self->_login.c_str());
 
-            uint32 MaxWrongPassCount = sConfig.GetIntDefault("WrongPass.MaxCount", 0);
-            if (MaxWrongPassCount > 0)
+        uint32 MaxWrongPassCount = sConfig.GetIntDefault("WrongPass.MaxCount", 0);
+        if (MaxWrongPassCount > 0)
+        {
+            // Increment number of failed logins by one and if it reaches the limit temporarily ban that account or IP
+            LoginDatabase.PExecute("UPDATE account SET failed_logins = failed_logins + 1 WHERE username = '%s'", self->_safelogin.c_str());
+
+            if (auto loginfail = LoginDatabase.PQuery("SELECT id, failed_logins FROM account WHERE username = '%s'", self->_safelogin.c_str()))
             {
-                // Increment number of failed logins by one and if it reaches the limit temporarily ban that account or IP
-                LoginDatabase.PExecute("UPDATE account SET failed_logins = failed_logins + 1 WHERE username = '%s'", self->_safelogin.c_str());
+                Field* fields = loginfail->Fetch();
+                uint32 failed_logins = fields[1].GetUInt32();
 
-                if (auto loginfail = LoginDatabase.PQuery("SELECT id, failed_logins FROM account WHERE username = '%s'", self->_safelogin.c_str()))
+                if (failed_logins >= MaxWrongPassCount)
                 {
-                    Field* fields = loginfail->Fetch();
-                    uint32 failed_logins = fields[1].GetUInt32();
+                    uint32 WrongPassBanTime = sConfig.GetIntDefault("WrongPass.BanTime", 600);
+                    bool WrongPassBanType = sConfig.GetBoolDefault("WrongPass.BanType", false);
 
-                    if (failed_logins >= MaxWrongPassCount)
+                    if (WrongPassBanType)
+                    {
+                        uint32 acc_id = fields[0].GetUInt32();
+                        LoginDatabase.PExecute("INSERT INTO account_banned(account_id, banned_at, expires_at, banned_by, reason, active)"
+                            "VALUES ('%u'," _UNIXTIME_ "," _UNIXTIME_ "+'%u','MaNGOS realmd','Failed login autoban',1)",
+                            acc_id, WrongPassBanTime);
+                        BASIC_LOG("[AuthChallenge] account %s got banned for '%u' seconds because it failed to authenticate '%u' times",
+                            self->_login.c_str(), WrongPassBanTime, failed_logins);
+                    }
+                    else
                     {
-                        uint32 WrongPassBanTime = sConfig.GetIntDefault("WrongPass.BanTime", 600);
-                        bool WrongPassBanType = sConfig.GetBoolDefault("WrongPass.BanType", false);
-
-                        if (WrongPassBanType)
-                        {
-                            uint32 acc_id = fields[0].GetUInt32();
-                            LoginDatabase.PExecute("INSERT INTO account_banned(account_id, banned_at, expires_at, banned_by, reason, active)"
-                                "VALUES ('%u'," _UNIXTIME_ "," _UNIXTIME_ "+'%u','MaNGOS realmd','Failed login autoban',1)",
-                                acc_id, WrongPassBanTime);
-                            BASIC_LOG("[AuthChallenge] account %s got banned for '%u' seconds because it failed to authenticate '%u' times",
-                                self->_login.c_str(), WrongPassBanTime, failed_logins);
-                        }
-                        else
-                        {
-                            std::string current_ip = self->GetRemoteAddress();
-                            LoginDatabase.escape_string(current_ip);
-                            LoginDatabase.PExecute("INSERT INTO ip_banned VALUES ('%s'," _UNIXTIME_ "," _UNIXTIME_ "+'%u','MaNGOS realmd','Failed login autoban')",
-                                current_ip.c_str(), WrongPassBanTime);
-                            BASIC_LOG("[AuthChallenge] IP %s got banned for '%u' seconds because account %s failed to authenticate '%u' times",
-                                current_ip.c_str(), WrongPassBanTime, self->_login.c_str(), failed_logins);
-                        }
+                        std::string current_ip = self->GetRemoteAddress();
+                        LoginDatabase.escape_string(current_ip);
+                        LoginDatabase.PExecute("INSERT INTO ip_banned VALUES ('%s'," _UNIXTIME_ "," _UNIXTIME_ "+'%u','MaNGOS realmd','Failed login autoban')",
+                            current_ip.c_str(), WrongPassBanTime);
+                        BASIC_LOG("[AuthChallenge] IP %s got banned for '%u' seconds because account %s failed to authenticate '%u' times",
+                            current_ip.c_str(), WrongPassBanTime, self->_login.c_str(), failed_logins);
                     }
                 }
             }
-            self->ProcessIncomingData();
         }
-    });
-
-    return true;
+        self->ProcessIncomingData();
+    }
 }
 
 /// Reconnect Challenge command handler
@@ -735,51 +770,58 @@ bool AuthSocket::_HandleReconnectChallenge()
                 return;
             }
 
-            if (body->userName_len > 10)
-                return;
+            PostWork([self, header, body]() { self->ProcessReconnectChallenge(header, body); });
+        });
+    });
 
-            body->userName[body->userName_len] = '\0';
-            DEBUG_LOG("[ReconnectChallenge] got full packet, %#04x bytes", header->size);
-            DEBUG_LOG("[ReconnectChallenge] name(%d): '%s'", body->userName_len, body->userName);
+    return true;
+}
 
-            self->_login = (const char*)body->userName;
+void AuthSocket::ProcessReconnectChallenge(std::shared_ptr<sAuthLogonChallengeHeader> header, std::shared_ptr<sAuthLogonChallengeBody> body)
+{
+    std::shared_ptr<AuthSocket> self = shared_from_this();
 
-            self->_safelogin = self->_login;
-            LoginDatabase.escape_string(self->_safelogin);
+    if (body->userName_len > 10)
+        return;
 
-            EndianConvert(body->build);
-            self->_build = body->build;
+    body->userName[body->userName_len] = '\0';
+    DEBUG_LOG("[ReconnectChallenge] got full packet, %#04x bytes", header->size);
+    DEBUG_LOG("[ReconnectChallenge] name(%d): '%s'", body->userName_len, body->userName);
 
-            auto queryResult = LoginDatabase.PQuery("SELECT sessionkey FROM account WHERE username = '%s'", self->_safelogin.c_str());
+    self->_login = (const char*)body->userName;
 
-            // Stop if the account is not found
-            if (!queryResult)
-            {
-                sLog.outError("[ERROR] user %s tried to login and we cannot find his session key in the database.", self->_login.c_str());
-                self->Close();
-                return;
-            }
+    self->_safelogin = self->_login;
+    LoginDatabase.escape_string(self->_safelogin);
 
-            Field* fields = queryResult->Fetch();
-            self->srp.SetStrongSessionKey(fields[0].GetString());
+    EndianConvert(body->build);
+    self->_build = body->build;
 
-            ///- All good, await client's proof
-            self->_status = STATUS_RECON_PROOF;
+    auto queryResult = LoginDatabase.PQuery("SELECT sessionkey FROM account WHERE username = '%s'", self->_safelogin.c_str());
 
-            ///- Sending response
-            std::shared_ptr<ByteBuffer> pkt = std::make_shared<ByteBuffer>();
-            *pkt << (uint8)CMD_AUTH_RECONNECT_CHALLENGE;
-            *pkt << (uint8)0x00;
-            self->_reconnectProof.SetRand(16 * 8);
-            pkt->append(self->_reconnectProof.AsByteArray(16));        // 16 bytes random
-            pkt->append(VersionChallenge.data(), VersionChallenge.size());
-            self->Write((const char*)pkt->contents(), pkt->size(), [self, pkt](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
+    // Stop if the account is not found
+    if (!queryResult)
+    {
+        sLog.outError("[ERROR] user %s tried to login and we cannot find his session key in the database.", self->_login.c_str());
+        self->Close();
+        return;
+    }
 
-            self->ProcessIncomingData();
-        });
-    });
+    Field* fields = queryResult->Fetch();
+    self->srp.SetStrongSessionKey(fields[0].GetString());
 
-    return true;
+    ///- All good, await client's proof
+    self->_status = STATUS_RECON_PROOF;
+
+    ///- Sending response
+    std::shared_ptr<ByteBuffer> pkt = std::make_shared<ByteBuffer>();
+    *pkt << (uint8)CMD_AUTH_RECONNECT_CHALLENGE;
+    *pkt << (uint8)0x00;
+    self->_reconnectProof.SetRand(16 * 8);
+    pkt->append(self->_reconnectProof.AsByteArray(16));        // 16 bytes random
+    pkt->append(VersionChallenge.data(), VersionChallenge.size());
+    self->Write((const char*)pkt->contents(), pkt->size(), [self, pkt](const boost::system::error_code& /*error*/, std::size_t /*written*/) {});
+
+    self->ProcessIncomingData();
 }
 
 /// Reconnect Proof command handler
@@ -887,6 +929,37 @@ bool AuthSocket::_HandleRealmList()
 
 void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLevel)
 {
+    // One query for the character counts on all realms instead of one per realm; the
+    // counts are patched into the (possibly cached) packet below
+    std::map<uint32, uint8> characterCounts;
+    // No SQL injection. acctid is uint32.
+    if (auto queryResult = LoginDatabase.PQuery("SELECT realmid, numchars FROM realmcharacters WHERE acctid='%u'", acctid))
+    {
+        do
+        {
+            Field* fields = queryResult->Fetch();
+            characterCounts[fields[0].GetUInt32()] = fields[1].GetUInt8();
+        }
+        while (queryResult->NextRow());
+    }
+
+    // The packet layout depends on the client build and on both security levels used below
+    uint32 const cacheKey = (uint32(_build) << 16) | (uint32(securityLevel) << 8) | uint32(_accountSecurityLevel);
+    if (std::shared_ptr<RealmListPayload const> cached = sRealmList.GetCachedPayload(cacheKey))
+    {
+        pkt.append(cached->data.data(), cached->data.size());
+        for (auto const& slot : cached->numCharSlots)
+        {
+            std::map<uint32, uint8>::const_iterator itr = characterCounts.find(slot.first);
+            pkt.put<uint8>(slot.second, itr != characterCounts.end() ? itr->second : 0);
+        }
+        for (auto const& slot : cached->populationSlots)
+            pkt.put<float>(slot.second, sRealmList.GetPopulationLevel(slot.first));
+        return;
+    }
+
+    std::shared_ptr<RealmListPayload> built = std::make_shared<RealmListPayload>();
+
     switch (_build)
     {
         case 5875:                                          // 1.12.1
@@ -898,17 +971,10 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
 
             for (const auto& i : sRealmList)
             {
-                uint8 AmountOfCharacters;
-
-                // No SQL injection. id of realm is controlled by the database.
-                auto queryResult = LoginDatabase.PQuery("SELECT numchars FROM realmcharacters WHERE realmid = '%d' AND acctid='%u'", i.second.m_ID, acctid);
-                if (queryResult)
-                {
-                    Field* fields = queryResult->Fetch();
-                    AmountOfCharacters = fields[0].GetUInt8();
-                }
-                else
-                    AmountOfCharacters = 0;
+                uint8 AmountOfCharacters = 0;
+                std::map<uint32, uint8>::const_iterator countItr = characterCounts.find(i.second.m_ID);
+                if (countItr != characterCounts.end())
+                    AmountOfCharacters = countItr->second;
 
                 bool ok_build = std::find(i.second.realmbuilds.begin(), i.second.realmbuilds.end(), _build) != i.second.realmbuilds.end();
 
@@ -941,7 +1007,9 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
                 pkt << uint8(realmflags);                   // realmflags
                 pkt << name;                                // name
                 pkt << i.second.address;                   // address
+                built->populationSlots.push_back({ i.second.m_ID, pkt.wpos() });
                 pkt << float(i.second.populationLevel);
+                built->numCharSlots.push_back({ i.second.m_ID, pkt.wpos() });
                 pkt << uint8(AmountOfCharacters);
                 pkt << uint8(categoryId);                   // realm category
                 pkt << uint8(0x00);                         // unk, may be realm number/id?
@@ -964,17 +1032,10 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
 
             for (const auto& i : sRealmList)
             {
-                uint8 AmountOfCharacters;
-
-                // No SQL injection. id of realm is controlled by the database.
-                auto queryResult = LoginDatabase.PQuery("SELECT numchars FROM realmcharacters WHERE realmid = '%d' AND acctid='%u'", i.second.m_ID, acctid);
-                if (queryResult)
-                {
-                    Field* fields = queryResult->Fetch();
-                    AmountOfCharacters = fields[0].GetUInt8();
-                }
-                else
-                    AmountOfCharacters = 0;
+                uint8 AmountOfCharacters = 0;
+                std::map<uint32, uint8>::const_iterator countItr = characterCounts.find(i.second.m_ID);
+                if (countItr != characterCounts.end())
+                    AmountOfCharacters = countItr->second;
 
                 bool ok_build = std::find(i.second.realmbuilds.begin(), i.second.realmbuilds.end(), _build) != i.second.realmbuilds.end();
 
@@ -1004,7 +1065,9 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
                 pkt << uint8(realmFlags);                   // see enum RealmFlags
                 pkt << i.first;                            // name
                 pkt << i.second.address;                   // address
+                built->populationSlots.push_back({ i.second.m_ID, pkt.wpos() });
                 pkt << float(i.second.populationLevel);
+                built->numCharSlots.push_back({ i.second.m_ID, pkt.wpos() });
                 pkt << uint8(AmountOfCharacters);
                 pkt << uint8(categoryId);                   // realm category (Cfg_Categories.dbc)
                 pkt << uint8(0x2C);                         // unk, may be realm number/id?
@@ -1022,6 +1085,9 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
             break;
         }
     }
+
+    built->data.assign(pkt.contents(), pkt.contents() + pkt.size());
+    sRealmList.StoreCachedPayload(cacheKey, built);
 }
 
 uint8 AuthSocket::getEligibleRealmCount(uint8 accountSecurityLevel)
@@ -37,6 +37,8 @@
 
 #define HMAC_RES_SIZE 20
 
+struct sAuthLogonChallengeHeader;
+struct sAuthLogonChallengeBody;
 struct sAuthLogonProof_C;
 struct sAuthLogonPinData_C;
 
@@ -47,6 +49,9 @@ class AuthSocket : public MaNGOS::AsyncSocket<AuthSocket>
 
         AuthSocket(boost::asio::io_context& context);
 
+        // worker pool shared by all sockets for SRP computation and account lookups
+        static void SetWorkerPool(boost::asio::thread_pool* pool);
+
         bool OnOpen() override;
 
         void SendProof(Sha1Hash sha);
@@ -69,8 +74,18 @@ class AuthSocket : public MaNGOS::AsyncSocket<AuthSocket>
         bool _HandleXferAccept();
 
     private:
+        // runs work on the shared pool, or inline when no pool was installed
+        static void PostWork(std::function<void()>&& work);
+
+        // heavy continuations of the command handlers, executed on the worker pool
+        void ProcessLogonChallenge(std::shared_ptr<sAuthLogonChallengeHeader> header, std::shared_ptr<sAuthLogonChallengeBody> body);
+        void ProcessLogonProof(std::shared_ptr<sAuthLogonProof_C> lp);
+        void ProcessReconnectChallenge(std::shared_ptr<sAuthLogonChallengeHeader> header, std::shared_ptr<sAuthLogonChallengeBody> body);
+
         void verifyVersionAndFinalizeAuthentication(std::shared_ptr<sAuthLogonProof_C> lp);
 
+        static boost::asio::thread_pool* s_workerPool;
+
         enum eStatus
         {
             STATUS_CHALLENGE,
@@ -239,6 +239,12 @@ int main(int argc, char* argv[])
     LoginDatabase.CommitTransaction();
 
     uint32 networkThreadCount = sConfig.GetIntDefault("ListenerThreads", 1);
+
+    // SRP computation and account lookups run here instead of the network threads
+    uint32 authWorkerThreadCount = sConfig.GetIntDefault("AuthWorkerThreads", 2);
+    boost::asio::thread_pool authWorkers(authWorkerThreadCount);
+    AuthSocket::SetWorkerPool(&authWorkers);
+
     MaNGOS::AsyncListener<AuthSocket> listener(context,
             sConfig.GetStringDefault("BindIP", "0.0.0.0"),
             sConfig.GetIntDefault("RealmServerPort", DEFAULT_REALMSERVER_PORT)
@@ -325,6 +331,9 @@ int main(int argc, char* argv[])
     for (uint32 i = 0; i < networkThreadCount; ++i)
         threads[i].join();
 
+    AuthSocket::SetWorkerPool(nullptr);
+    authWorkers.join();
+
     // Wait for the delay thread to exit
     LoginDatabase.HaltDelayThread();
 
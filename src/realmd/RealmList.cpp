@@ -157,6 +157,31 @@ void RealmList::UpdateRealm(uint32 ID, const std::string& name, const std::strin
     std::ostringstream ss;
     ss << address << ":" << port;
     realm.address   = ss.str();
+
+    std::lock_guard<std::mutex> guard(m_cacheLock);
+    m_populations[ID] = popu;
+}
+
+/// True if anything other than the population level changed between two realm list snapshots
+static bool RealmsDiffer(RealmList::RealmMap const& a, RealmList::RealmMap const& b)
+{
+    if (a.size() != b.size())
+        return true;
+
+    for (auto itrA = a.begin(), itrB = b.begin(); itrA != a.end(); ++itrA, ++itrB)
+    {
+        if (itrA->first != itrB->first)
+            return true;
+
+        Realm const& ra = itrA->second;
+        Realm const& rb = itrB->second;
+        if (ra.m_ID != rb.m_ID || ra.address != rb.address || ra.icon != rb.icon ||
+                ra.realmflags != rb.realmflags || ra.timezone != rb.timezone ||
+                ra.allowedSecurityLevel != rb.allowedSecurityLevel || ra.realmbuilds != rb.realmbuilds)
+            return true;
+    }
+
+    return false;
 }
 
 void RealmList::UpdateIfNeed()
@@ -168,10 +193,39 @@ void RealmList::UpdateIfNeed()
     m_NextUpdateTime = time(nullptr) + m_UpdateInterval;
 
     // Clears Realm list
-    m_realms.clear();
+    RealmMap existingRealms;
+    std::swap(existingRealms, m_realms);
 
     // Get the content of the realmlist table in the database
     UpdateRealms(false);
+
+    // Population changes flow into cached packets through GetPopulationLevel; everything
+    // else changes the packet layout and forces the cached payloads to be rebuilt
+    if (RealmsDiffer(existingRealms, m_realms))
+    {
+        std::lock_guard<std::mutex> guard(m_cacheLock);
+        m_payloadCache.clear();
+    }
+}
+
+std::shared_ptr<RealmListPayload const> RealmList::GetCachedPayload(uint32 key) const
+{
+    std::lock_guard<std::mutex> guard(m_cacheLock);
+    PayloadCache::const_iterator itr = m_payloadCache.find(key);
+    return itr != m_payloadCache.end() ? itr->second : nullptr;
+}
+
+void RealmList::StoreCachedPayload(uint32 key, std::shared_ptr<RealmListPayload const> const& payload)
+{
+    std::lock_guard<std::mutex> guard(m_cacheLock);
+    m_payloadCache[key] = payload;
+}
+
+float RealmList::GetPopulationLevel(uint32 realmId) const
+{
+    std::lock_guard<std::mutex> guard(m_cacheLock);
+    std::map<uint32, float>::const_iterator itr = m_populations.find(realmId);
+    return itr != m_populations.end() ? itr->second : 0.0f;
 }
 
 void RealmList::UpdateRealms(bool init)
@@ -25,6 +25,9 @@
 
 #include "Common.h"
 #include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 struct RealmBuildInfo
 {
@@ -56,6 +59,16 @@ struct Realm
     RealmBuildInfo realmBuildInfo;                          // build info for show version in list
 };
 
+/// Prebuilt CMD_REALM_LIST payload for one client build / security level combination.
+/// The per-account character counts and the live population numbers are patched into
+/// a copy of the payload on every request instead of rebuilding the whole packet.
+struct RealmListPayload
+{
+    std::vector<uint8> data;
+    std::vector<std::pair<uint32, size_t>> numCharSlots;    // realm id -> offset of the AmountOfCharacters byte
+    std::vector<std::pair<uint32, size_t>> populationSlots; // realm id -> offset of the population float
+};
+
 /// Storage object for the list of realms on the server
 class RealmList
 {
@@ -74,6 +87,11 @@ class RealmList
         RealmMap::const_iterator begin() const { return m_realms.begin(); }
         RealmMap::const_iterator end() const { return m_realms.end(); }
         uint32 size() const { return m_realms.size(); }
+
+        // Cached realm-list packets (filled by AuthSocket::LoadRealmlist)
+        std::shared_ptr<RealmListPayload const> GetCachedPayload(uint32 key) const;
+        void StoreCachedPayload(uint32 key, std::shared_ptr<RealmListPayload const> const& payload);
+        float GetPopulationLevel(uint32 realmId) const;
     private:
         void UpdateRealms(bool init);
         void UpdateRealm(uint32 ID, const std::string& name, const std::string& address, uint32 port, uint8 icon, RealmFlags realmflags, uint8 timezone, AccountTypes allowedSecurityLevel, float popu, const std::string& builds);
@@ -81,6 +99,11 @@ class RealmList
         RealmMap m_realms;                                  ///< Internal map of realms
         uint32   m_UpdateInterval;
         time_t   m_NextUpdateTime;
+
+        typedef std::map<uint32, std::shared_ptr<RealmListPayload const>> PayloadCache;
+        PayloadCache m_payloadCache;                        ///< Built packets per build/security level, dropped on structural realm changes
+        std::map<uint32, float> m_populations;              ///< Live population by realm id, patched into cached packets per request
+        mutable std::mutex m_cacheLock;                     ///< Auth handlers run on multiple IO threads
 };
 
 #define sRealmList RealmList::Instance()
@@ -0,0 +1,381 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "DBCPack.h"
+#include "DBCFileLoader.h"
+#include "Platform/Filesystem.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    char const PACK_MAGIC[4] = { 'M', 'D', 'B', 'P' };
+    size_t const PACK_ALIGNMENT = 16;
+
+    size_t AlignUp(size_t value)
+    {
+        return (value + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+    }
+
+    /// bounds-checked sequential reader over the mapped archive
+    struct PackCursor
+    {
+        unsigned char const* base;
+        size_t size;
+        size_t pos = 0;
+
+        bool Read(void* out, size_t bytes)
+        {
+            if (pos + bytes > size)
+                return false;
+            memcpy(out, base + pos, bytes);
+            pos += bytes;
+            return true;
+        }
+
+        unsigned char const* Skip(size_t bytes)
+        {
+            if (pos + bytes > size)
+                return nullptr;
+            unsigned char const* at = base + pos;
+            pos += bytes;
+            return at;
+        }
+
+        bool Align()
+        {
+            size_t const aligned = AlignUp(pos);
+            if (aligned > size)
+                return false;
+            pos = aligned;
+            return true;
+        }
+    };
+
+    uint64 FNVHash(uint64 hash, void const* data, size_t size)
+    {
+        unsigned char const* bytes = static_cast<unsigned char const*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+}
+
+DBCPack::~DBCPack()
+{
+    CloseMapping();
+}
+
+void DBCPack::CloseMapping()
+{
+    if (!m_base)
+        return;
+
+#ifndef _WIN32
+    if (m_mapped)
+        munmap(m_base, m_size);
+    else
+        delete[] m_base;
+#else
+    delete[] m_base;
+#endif
+
+    m_base = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_stores.clear();
+}
+
+bool DBCPack::Open(std::string const& fileName, uint64 fingerprint)
+{
+    CloseMapping();
+
+#ifndef _WIN32
+    int const fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 24)
+    {
+        close(fd);
+        return false;
+    }
+
+    m_size = size_t(st.st_size);
+    // private copy-on-write mapping: the string slot fixup dirties only the
+    // pages it touches, everything else stays shared between processes
+    void* mapping = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        m_size = 0;
+        return false;
+    }
+    m_base = static_cast<unsigned char*>(mapping);
+    m_mapped = true;
+#else
+    // no page sharing on this platform; still skips the per-record parse
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+
+    std::streamoff const fileSize = file.tellg();
+    if (fileSize < 24)
+        return false;
+
+    m_size = size_t(fileSize);
+    m_base = new unsigned char[m_size];
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(m_base), fileSize))
+    {
+        CloseMapping();
+        return false;
+    }
+#endif
+
+    PackCursor cursor{ m_base, m_size };
+
+    char magic[4];
+    uint32 version = 0;
+    uint32 pointerSize = 0;
+    uint64 packFingerprint = 0;
+    uint32 storeCount = 0;
+    if (!cursor.Read(magic, sizeof(magic)) || memcmp(magic, PACK_MAGIC, sizeof(magic)) != 0 ||
+            !cursor.Read(&version, sizeof(version)) || version != PACK_VERSION ||
+            !cursor.Read(&pointerSize, sizeof(pointerSize)) || pointerSize != sizeof(void*) ||
+            !cursor.Read(&packFingerprint, sizeof(packFingerprint)) || packFingerprint != fingerprint ||
+            !cursor.Read(&storeCount, sizeof(storeCount)))
+    {
+        CloseMapping();
+        return false;
+    }
+
+    for (uint32 i = 0; i < storeCount; ++i)
+    {
+        uint32 nameLen = 0;
+        if (!cursor.Read(&nameLen, sizeof(nameLen)) || nameLen > 256)
+            break;
+        unsigned char const* nameAt = cursor.Skip(nameLen);
+        if (!nameAt)
+            break;
+        std::string name(reinterpret_cast<char const*>(nameAt), nameLen);
+
+        uint32 fmtLen = 0;
+        if (!cursor.Read(&fmtLen, sizeof(fmtLen)) || fmtLen > 256)
+            break;
+        unsigned char const* fmtAt = cursor.Skip(fmtLen);
+        if (!fmtAt)
+            break;
+        std::string fmt(reinterpret_cast<char const*>(fmtAt), fmtLen);
+
+        StoreChunk chunk;
+        if (!cursor.Read(&chunk.nCount, sizeof(chunk.nCount)) ||
+                !cursor.Read(&chunk.recordCount, sizeof(chunk.recordCount)) ||
+                !cursor.Read(&chunk.recordSize, sizeof(chunk.recordSize)) ||
+                !cursor.Read(&chunk.stringPoolSize, sizeof(chunk.stringPoolSize)) ||
+                !cursor.Align())
+            break;
+
+        chunk.records = const_cast<unsigned char*>(cursor.Skip(size_t(chunk.recordCount) * chunk.recordSize));
+        if (!chunk.records && chunk.recordCount)
+            break;
+        if (!cursor.Align())
+            break;
+        chunk.index = reinterpret_cast<uint32 const*>(cursor.Skip(size_t(chunk.nCount) * sizeof(uint32)));
+        if (!chunk.index && chunk.nCount)
+            break;
+        if (!cursor.Align())
+            break;
+        chunk.stringPool = reinterpret_cast<char const*>(cursor.Skip(size_t(chunk.stringPoolSize)));
+        if (!chunk.stringPool && chunk.stringPoolSize)
+            break;
+        if (!cursor.Align())
+            break;
+
+        // the pack stores the format it was written with; a changed format
+        // string means the C++ struct changed, so the chunk is kept but
+        // GetStore will reject it and the store falls back to a normal parse
+        m_stores[name + "|" + fmt] = chunk;
+    }
+
+    if (m_stores.size() != storeCount)
+    {
+        CloseMapping();
+        return false;
+    }
+
+    return true;
+}
+
+DBCPack::StoreChunk* DBCPack::GetStore(std::string const& name, char const* fmt)
+{
+    auto itr = m_stores.find(name + "|" + fmt);
+    return itr != m_stores.end() ? &itr->second : nullptr;
+}
+
+void DBCPack::BeginWrite(std::string const& fileName, uint64 fingerprint)
+{
+    m_writing = true;
+    m_writeFileName = fileName;
+    m_writeBuffer.clear();
+    m_writeStoreCount = 0;
+
+    uint32 const version = PACK_VERSION;
+    uint32 const pointerSize = sizeof(void*);
+    uint32 const storeCountPlaceholder = 0;                 // patched in FinishWrite
+    AppendBytes(PACK_MAGIC, sizeof(PACK_MAGIC));
+    AppendBytes(&version, sizeof(version));
+    AppendBytes(&pointerSize, sizeof(pointerSize));
+    AppendBytes(&fingerprint, sizeof(fingerprint));
+    AppendBytes(&storeCountPlaceholder, sizeof(storeCountPlaceholder));
+}
+
+void DBCPack::AppendBytes(void const* data, size_t size)
+{
+    unsigned char const* bytes = static_cast<unsigned char const*>(data);
+    m_writeBuffer.insert(m_writeBuffer.end(), bytes, bytes + size);
+}
+
+void DBCPack::AppendPadding()
+{
+    m_writeBuffer.resize(AlignUp(m_writeBuffer.size()), 0);
+}
+
+void DBCPack::AppendStore(std::string const& name, char const* fmt, uint32 nCount, uint32 recordSize,
+                          std::vector<unsigned char> const& records, std::vector<uint32> const& index,
+                          std::vector<char> const& stringPool)
+{
+    if (!m_writing)
+        return;
+
+    uint32 const nameLen = uint32(name.length());
+    uint32 const fmtLen = uint32(strlen(fmt));
+    uint32 const recordCount = recordSize ? uint32(records.size() / recordSize) : 0;
+    uint64 const stringPoolSize = stringPool.size();
+
+    AppendBytes(&nameLen, sizeof(nameLen));
+    AppendBytes(name.data(), nameLen);
+    AppendBytes(&fmtLen, sizeof(fmtLen));
+    AppendBytes(fmt, fmtLen);
+    AppendBytes(&nCount, sizeof(nCount));
+    AppendBytes(&recordCount, sizeof(recordCount));
+    AppendBytes(&recordSize, sizeof(recordSize));
+    AppendBytes(&stringPoolSize, sizeof(stringPoolSize));
+    AppendPadding();
+    AppendBytes(records.data(), records.size());
+    AppendPadding();
+    AppendBytes(index.data(), index.size() * sizeof(uint32));
+    AppendPadding();
+    AppendBytes(stringPool.data(), stringPool.size());
+    AppendPadding();
+
+    ++m_writeStoreCount;
+}
+
+bool DBCPack::FinishWrite()
+{
+    if (!m_writing)
+        return false;
+    m_writing = false;
+
+    // patch the store count behind magic + version + pointer size + fingerprint
+    memcpy(&m_writeBuffer[sizeof(PACK_MAGIC) + sizeof(uint32) * 2 + sizeof(uint64)], &m_writeStoreCount, sizeof(m_writeStoreCount));
+
+    // write to a temporary and rename, so a crash never leaves a torn pack
+    std::string const tmpFileName = m_writeFileName + ".tmp";
+    {
+        std::ofstream file(tmpFileName, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<char const*>(m_writeBuffer.data()), m_writeBuffer.size()))
+            return false;
+    }
+
+    boost::system::error_code error;
+    MaNGOS::Filesystem::rename(tmpFileName, m_writeFileName, error);
+    m_writeBuffer.clear();
+    return !error;
+}
+
+uint64 DBCPack::FingerprintDirectory(std::string const& path)
+{
+    std::vector<std::string> entries;
+
+    boost::system::error_code error;
+    for (MaNGOS::Filesystem::recursive_directory_iterator itr(path, error), end; !error && itr != end; itr.increment(error))
+    {
+        MaNGOS::Filesystem::path const& file = itr->path();
+        if (file.extension() != ".dbc")
+            continue;
+
+        std::string entry = file.generic_string();
+        entry += '|';
+        entry += std::to_string(uint64(MaNGOS::Filesystem::file_size(file, error)));
+        entry += '|';
+        entry += std::to_string(uint64(MaNGOS::Filesystem::last_write_time(file, error)));
+        entries.push_back(std::move(entry));
+    }
+
+    // order-independent: iteration order differs between filesystems
+    std::sort(entries.begin(), entries.end());
+
+    uint64 hash = 0xcbf29ce484222325ULL;
+    for (auto const& entry : entries)
+        hash = FNVHash(hash, entry.data(), entry.size());
+    return hash;
+}
+
+void DBCPack::BuildStringSlotOffsets(char const* fmt, std::vector<uint32>& offsets)
+{
+    offsets.clear();
+
+    uint32 offset = 0;
+    for (uint32 x = 0; fmt[x]; ++x)
+    {
+        switch (fmt[x])
+        {
+            case FT_FLOAT:
+                offset += sizeof(float);
+                break;
+            case FT_IND:
+            case FT_INT:
+                offset += sizeof(uint32);
+                break;
+            case FT_BYTE:
+                offset += sizeof(uint8);
+                break;
+            case FT_STRING:
+                offsets.push_back(offset);
+                offset += sizeof(char*);
+                break;
+            default:
+                break;
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DBC_PACK_H
+#define DBC_PACK_H
+
+#include "Platform/Define.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/// Preprocessed DBC archive: one file holding every store's converted record
+/// images, index table and merged string pool, written after the first normal
+/// parse and memory-mapped on later startups so LoadDBCStores skips the
+/// per-record format conversion entirely. Record string slots are stored as
+/// pool offsets and fixed up in place after mapping; with a copy-on-write
+/// private mapping only the string-bearing pages go unshared, the rest of the
+/// archive stays shareable between realm processes.
+///
+/// The pack carries a fingerprint of the dbc directory (file names, sizes and
+/// modification times) plus the pointer size it was written with; any mismatch
+/// discards it and the next startup parses the DBC files and rewrites it.
+/// Deleting the pack file forces a rebuild.
+class DBCPack
+{
+    public:
+        static uint32 const PACK_VERSION = 1;
+
+        struct StoreChunk
+        {
+            uint32 nCount = 0;                              // index table size (max id + 1)
+            uint32 recordCount = 0;
+            uint32 recordSize = 0;                          // in-memory record size (equals sizeof of the C++ entry struct)
+            uint64 stringPoolSize = 0;
+            unsigned char* records = nullptr;               // writable: string slots are rewritten to pointers after mapping
+            uint32 const* index = nullptr;                  // per id: record index + 1, 0 for absent ids
+            char const* stringPool = nullptr;
+            bool fixedUp = false;                           // string slots already converted to pointers
+        };
+
+        DBCPack() {}
+        ~DBCPack();
+
+        // reader side
+        bool Open(std::string const& fileName, uint64 fingerprint);
+        bool IsOpen() const { return m_base != nullptr; }
+        // returns the chunk for a store, nullptr when absent or the format string changed
+        StoreChunk* GetStore(std::string const& name, char const* fmt);
+
+        // writer side: chunks are appended in memory and written out as one file
+        void BeginWrite(std::string const& fileName, uint64 fingerprint);
+        bool IsWriting() const { return m_writing; }
+        void AppendStore(std::string const& name, char const* fmt, uint32 nCount, uint32 recordSize,
+                         std::vector<unsigned char> const& records, std::vector<uint32> const& index,
+                         std::vector<char> const& stringPool);
+        bool FinishWrite();
+
+        /// hash of every .dbc file's name, size and modification time under path
+        static uint64 FingerprintDirectory(std::string const& path);
+
+        /// in-memory byte offsets of the FT_STRING slots for a format string
+        static void BuildStringSlotOffsets(char const* fmt, std::vector<uint32>& offsets);
+
+    private:
+        void CloseMapping();
+        void AppendBytes(void const* data, size_t size);
+        void AppendPadding();
+
+        unsigned char* m_base = nullptr;
+        size_t m_size = 0;
+        bool m_mapped = false;                              // mmap-backed; false means plain heap read fallback
+        std::map<std::string, StoreChunk> m_stores;
+
+        bool m_writing = false;
+        std::string m_writeFileName;
+        std::vector<unsigned char> m_writeBuffer;
+        uint32 m_writeStoreCount = 0;
+};
+
+#endif
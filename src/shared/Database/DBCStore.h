@@ -20,13 +20,17 @@
 #define DBCSTORE_H
 
 #include "DBCFileLoader.h"
+#include "DBCPack.h"
+
+#include <cstring>
+#include <unordered_map>
 
 template<class T>
 class DBCStorage
 {
         typedef std::list<char*> StringPoolList;
     public:
-        explicit DBCStorage(const char* f) : nCount(0), fieldCount(0), fmt(f), indexTable(nullptr), m_dataTable(nullptr) { }
+        explicit DBCStorage(const char* f) : nCount(0), fieldCount(0), fmt(f), indexTable(nullptr), m_dataTable(nullptr), m_packBacked(false) { }
         ~DBCStorage() { Clear(); }
 
         T const* LookupEntry(uint32 id) const { return (id >= nCount) ? nullptr : indexTable[id]; }
@@ -70,6 +74,103 @@ class DBCStorage
             return true;
         }
 
+        /// Load from a preprocessed DBC pack (see DBCPack); returns false when
+        /// the pack has no matching chunk, which falls back to a normal parse
+        bool LoadFromPack(DBCPack& pack, char const* name)
+        {
+            DBCPack::StoreChunk* chunk = pack.GetStore(name, fmt);
+            if (!chunk || chunk->recordSize != sizeof(T))
+                return false;
+
+            // rewrite the string slots from pool offsets to process-local
+            // pointers; this only dirties the string-bearing pages of the
+            // copy-on-write mapping
+            if (!chunk->fixedUp)
+            {
+                std::vector<uint32> stringSlots;
+                DBCPack::BuildStringSlotOffsets(fmt, stringSlots);
+                for (uint32 rec = 0; rec < chunk->recordCount; ++rec)
+                {
+                    unsigned char* image = chunk->records + size_t(rec) * sizeof(T);
+                    for (uint32 slot : stringSlots)
+                    {
+                        uintptr_t encoded;
+                        memcpy(&encoded, image + slot, sizeof(encoded));
+                        char const* str = encoded ? chunk->stringPool + (encoded - 1) : nullptr;
+                        memcpy(image + slot, &str, sizeof(str));
+                    }
+                }
+                chunk->fixedUp = true;
+            }
+
+            fieldCount = uint32(strlen(fmt));
+            nCount = chunk->nCount;
+            indexTable = new T*[nCount];
+            for (uint32 id = 0; id < nCount; ++id)
+                indexTable[id] = chunk->index[id] ? (T*)(chunk->records + size_t(chunk->index[id] - 1) * sizeof(T)) : nullptr;
+            m_dataTable = (T*)chunk->records;
+            m_packBacked = true;                            // records and strings stay owned by the pack mapping
+            return true;
+        }
+
+        /// Serialize the loaded store (locale strings included) into the pack
+        void WriteToPack(DBCPack& pack, char const* name) const
+        {
+            if (!indexTable)
+                return;
+
+            std::vector<uint32> stringSlots;
+            DBCPack::BuildStringSlotOffsets(fmt, stringSlots);
+
+            std::vector<unsigned char> records;
+            std::vector<uint32> index(nCount, 0);
+            std::vector<char> stringPool;
+            std::unordered_map<void const*, uint32> recordIndices;
+            std::unordered_map<char const*, uint64> stringOffsets;
+
+            for (uint32 id = 0; id < nCount; ++id)
+            {
+                T const* entry = indexTable[id];
+                if (!entry)
+                    continue;
+
+                auto itr = recordIndices.find(entry);
+                if (itr == recordIndices.end())
+                {
+                    uint32 const newIndex = uint32(records.size() / sizeof(T));
+                    records.resize(records.size() + sizeof(T));
+                    unsigned char* image = records.data() + size_t(newIndex) * sizeof(T);
+                    memcpy(image, entry, sizeof(T));
+
+                    // string slots are stored as pool offset + 1, 0 for null
+                    for (uint32 slot : stringSlots)
+                    {
+                        char const* str;
+                        memcpy(&str, image + slot, sizeof(str));
+                        uintptr_t encoded = 0;
+                        if (str)
+                        {
+                            auto sitr = stringOffsets.find(str);
+                            if (sitr == stringOffsets.end())
+                            {
+                                uint64 const offset = stringPool.size();
+                                stringPool.insert(stringPool.end(), str, str + strlen(str) + 1);
+                                sitr = stringOffsets.insert({ str, offset }).first;
+                            }
+                            encoded = uintptr_t(sitr->second + 1);
+                        }
+                        memcpy(image + slot, &encoded, sizeof(encoded));
+                    }
+
+                    itr = recordIndices.insert({ entry, newIndex }).first;
+                }
+
+                index[id] = itr->second + 1;
+            }
+
+            pack.AppendStore(name, fmt, nCount, sizeof(T), records, index, stringPool);
+        }
+
         void Clear()
         {
             if (!indexTable)
@@ -77,14 +178,17 @@ class DBCStorage
 
             delete[]((char*)indexTable);
             indexTable = nullptr;
-            delete[]((char*)m_dataTable);
-            m_dataTable = nullptr;
-
-            while (!m_stringPoolList.empty())
+            if (!m_packBacked)
             {
-                delete[] m_stringPoolList.front();
-                m_stringPoolList.pop_front();
+                delete[]((char*)m_dataTable);
+
+                while (!m_stringPoolList.empty())
+                {
+                    delete[] m_stringPoolList.front();
+                    m_stringPoolList.pop_front();
+                }
             }
+            m_dataTable = nullptr;
             nCount = 0;
         }
 
@@ -98,6 +202,7 @@ class DBCStorage
         T** indexTable;
         T* m_dataTable;
         StringPoolList m_stringPoolList;
+        bool m_packBacked;                                  // data/strings live in the pack mapping, not on this store's heap
 };
 
 #endif
@@ -19,6 +19,8 @@
 #include "DatabaseEnv.h"
 #include "Config/Config.h"
 #include "Database/SqlOperations.h"
+#include "Database/SqlJournal.h"
+#include "Database/QueryResultCached.h"
 
 #include <ctime>
 #include <iostream>
@@ -98,7 +100,7 @@ Database::~Database()
     StopServer();
 }
 
-bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
+bool Database::Initialize(const char* infoString, int nConns /*= 1*/, int nAsyncQueryThreads /*= 0*/)
 {
     // Enable logging of SQL commands (usually only GM commands)
     // (See method: PExecuteLog)
@@ -143,6 +145,28 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
     m_pResultQueue = new SqlResultQueue;
 
     InitDelayThread();
+
+    // create worker threads with own connections for read-only async queries;
+    // writes and transactions always stay on the single serialized delay thread
+    if (nAsyncQueryThreads > MAX_CONNECTION_POOL_SIZE)
+        nAsyncQueryThreads = MAX_CONNECTION_POOL_SIZE;
+
+    for (int i = 0; i < nAsyncQueryThreads; ++i)
+    {
+        SqlConnection* pConn = CreateConnection();
+        if (!pConn->Initialize(infoString))
+        {
+            delete pConn;
+            return false;
+        }
+
+        m_pAsyncQueryConnections.push_back(pConn);
+
+        SqlDelayThread* threadBody = new SqlDelayThread(this, pConn);
+        m_queryThreadBodies.push_back(threadBody);          // will be deleted with its thread
+        m_queryThreads.push_back(new MaNGOS::Thread(threadBody));
+    }
+
     return true;
 }
 
@@ -156,6 +180,11 @@ void Database::StopServer()
     m_pResultQueue = nullptr;
     m_pAsyncConn = nullptr;
 
+    for (auto& pAsyncQueryConnection : m_pAsyncQueryConnections)
+        delete pAsyncQueryConnection;
+
+    m_pAsyncQueryConnections.clear();
+
     for (auto& m_pQueryConnection : m_pQueryConnections)
         delete m_pQueryConnection;
 
@@ -181,6 +210,20 @@ void Database::HaltDelayThread()
 {
     if (!m_threadBody || !m_delayThread) return;
 
+    // stop the async query workers first so no result can be queued
+    // after the requesting side stopped draining the result queue
+    for (auto& queryThreadBody : m_queryThreadBodies)
+        queryThreadBody->Stop();                            // Stop event
+
+    for (auto& queryThread : m_queryThreads)
+    {
+        queryThread->wait();                                // Wait for flush to DB
+        delete queryThread;                                 // This also deletes its thread body
+    }
+
+    m_queryThreads.clear();
+    m_queryThreadBodies.clear();
+
     m_threadBody->Stop();                                   // Stop event
     m_delayThread->wait();                                  // Wait for flush to DB
     delete m_delayThread;                                   // This also deletes m_threadBody
@@ -226,6 +269,21 @@ SqlConnection* Database::getQueryConnection()
     return m_pQueryConnections[nCount % m_nQueryConnPoolSize];
 }
 
+SqlDelayThread* Database::getQueryThread()
+{
+    if (m_queryThreadBodies.empty())
+        return m_threadBody;
+
+    long nCount = 0;
+
+    if (m_nAsyncQueryCounter == long(1 << 31))
+        m_nAsyncQueryCounter = 0;
+    else
+        nCount = ++m_nAsyncQueryCounter;
+
+    return m_queryThreadBodies[nCount % m_queryThreadBodies.size()];
+}
+
 void Database::Ping()
 {
     const char* sql = "SELECT 1";
@@ -284,6 +342,74 @@ bool Database::PExecuteLog(const char* format, ...)
     return Execute(szQuery);
 }
 
+std::unique_ptr<QueryResult> Database::Query(const char* sql)
+{
+    if (!m_cachedShapes.empty() && IsCachedShape(sql))
+        return CachedQuery(sql);
+
+    SqlConnection::Lock guard(getQueryConnection());
+    return guard->Query(sql);
+}
+
+std::unique_ptr<QueryResult> Database::QueryTyped(const char* sql)
+{
+    // the query cache stores text rows, so typed queries bypass it
+    SqlConnection::Lock guard(getQueryConnection());
+    return guard->QueryTyped(sql);
+}
+
+bool Database::IsCachedShape(char const* sql) const
+{
+    LOCK_GUARD guard(m_cacheGuard);
+    for (std::string const& shape : m_cachedShapes)
+        if (!strncmp(sql, shape.c_str(), shape.length()))
+            return true;
+    return false;
+}
+
+std::unique_ptr<QueryResult> Database::CachedQuery(char const* sql)
+{
+    {
+        LOCK_GUARD guard(m_cacheGuard);
+        auto itr = m_queryCache.find(sql);
+        if (itr != m_queryCache.end())
+            return QueryResultCached::MakeView(itr->second);
+    }
+
+    std::unique_ptr<QueryResult> result;
+    {
+        SqlConnection::Lock guard(getQueryConnection());
+        result = guard->Query(sql);
+    }
+
+    // empty results are cached too - repeated misses are the common case for lookups
+    auto rows = CachedRowSet::Materialize(result.get());
+
+    LOCK_GUARD guard(m_cacheGuard);
+    m_queryCache[sql] = rows;
+    return QueryResultCached::MakeView(rows);
+}
+
+void Database::RegisterCachedQueryShape(char const* prefix)
+{
+    LOCK_GUARD guard(m_cacheGuard);
+    m_cachedShapes.push_back(prefix);
+}
+
+void Database::InvalidateCachedQueries(char const* prefix)
+{
+    size_t const length = strlen(prefix);
+
+    LOCK_GUARD guard(m_cacheGuard);
+    for (auto itr = m_queryCache.begin(); itr != m_queryCache.end();)
+    {
+        if (!itr->first.compare(0, length, prefix))
+            itr = m_queryCache.erase(itr);
+        else
+            ++itr;
+    }
+}
+
 std::unique_ptr<QueryResult> Database::PQuery(const char* format, ...)
 {
     if (!format)
@@ -304,6 +430,26 @@ std::unique_ptr<QueryResult> Database::PQuery(const char* format, ...)
     return Query(szQuery);
 }
 
+std::unique_ptr<QueryResult> Database::PQueryTyped(const char* format, ...)
+{
+    if (!format)
+        return {};
+
+    va_list ap;
+    char szQuery [MAX_QUERY_LEN];
+    va_start(ap, format);
+    int res = vsnprintf(szQuery, MAX_QUERY_LEN, format, ap);
+    va_end(ap);
+
+    if (res == -1)
+    {
+        sLog.outError("SQL Query truncated (and not execute) for format: %s", format);
+        return {};
+    }
+
+    return QueryTyped(szQuery);
+}
+
 QueryNamedResult* Database::PQueryNamed(const char* format, ...)
 {
     if (!format) return nullptr;
@@ -323,6 +469,63 @@ QueryNamedResult* Database::PQueryNamed(const char* format, ...)
     return QueryNamed(szQuery);
 }
 
+bool Database::AsyncQuery(std::function<void(QueryResult*)> callback, const char* sql)
+{
+    if (!sql || !m_pResultQueue)
+        return false;
+
+    return getQueryThread()->Delay(new SqlQuery(sql, new MaNGOS::QueryCallback(std::move(callback)), m_pResultQueue));
+}
+
+bool Database::AsyncPQuery(std::function<void(QueryResult*)> callback, const char* format, ...)
+{
+    if (!format)
+        return false;
+
+    va_list ap;
+    char szQuery [MAX_QUERY_LEN];
+    va_start(ap, format);
+    int res = vsnprintf(szQuery, MAX_QUERY_LEN, format, ap);
+    va_end(ap);
+
+    if (res == -1)
+    {
+        sLog.outError("SQL Query truncated (and not execute) for format: %s", format);
+        return false;
+    }
+
+    return AsyncQuery(std::move(callback), szQuery);
+}
+
+bool Database::AsyncQueryUnsafe(std::function<void(QueryResult*)> callback, const char* sql)
+{
+    if (!sql)
+        return false;
+
+    // no result queue: the callback runs on the worker thread right after the query
+    return getQueryThread()->Delay(new SqlQuery(sql, new MaNGOS::QueryCallback(std::move(callback)), nullptr));
+}
+
+bool Database::AsyncPQueryUnsafe(std::function<void(QueryResult*)> callback, const char* format, ...)
+{
+    if (!format)
+        return false;
+
+    va_list ap;
+    char szQuery [MAX_QUERY_LEN];
+    va_start(ap, format);
+    int res = vsnprintf(szQuery, MAX_QUERY_LEN, format, ap);
+    va_end(ap);
+
+    if (res == -1)
+    {
+        sLog.outError("SQL Query truncated (and not execute) for format: %s", format);
+        return false;
+    }
+
+    return AsyncQueryUnsafe(std::move(callback), szQuery);
+}
+
 bool Database::Execute(const char* sql)
 {
     if (!m_pAsyncConn)
@@ -414,6 +617,37 @@ bool Database::CommitTransaction()
     return true;
 }
 
+bool Database::InitJournal(char const* path)
+{
+    auto journal = std::make_unique<SqlJournal>();
+    if (!journal->Open(path))
+        return false;
+
+    if (uint32 replayed = journal->Replay(*this))
+        sLog.outString("Replayed %u statement(s) from journal %s left by an unclean shutdown", replayed, path);
+
+    m_journal = std::move(journal);
+    return true;
+}
+
+bool Database::CommitJournaledTransaction()
+{
+    if (!m_pAsyncConn || !m_currentTransaction.get())
+        return false;
+
+    // the direct path below executes synchronously right here, so only the
+    // async path needs the crash window covered
+    if (m_journal && m_allowAsyncTransactions)
+    {
+        SqlTransaction* transaction = m_currentTransaction.get();
+        std::vector<std::string> statements;
+        if (transaction->FormatSqlStatements(*this, statements))
+            transaction->SetJournal(m_journal.get(), m_journal->Append(statements));
+    }
+
+    return CommitTransaction();
+}
+
 bool Database::CommitTransactionDirect()
 {
     if (!m_pAsyncConn)
@@ -22,12 +22,14 @@
 #include "Common.h"
 #include "Multithreading/Threading.h"
 #include "Database/SqlDelayThread.h"
+#include "Database/SqlJournal.h"
 #include "Policies/ThreadingModel.h"
 #include "SqlPreparedStatement.h"
 #include "QueryResult.h"
 
 #include <boost/thread/tss.hpp>
 #include <atomic>
+#include <functional>
 #include <memory>
 
 class SqlTransaction;
@@ -36,6 +38,7 @@ class SqlQueryHolder;
 class SqlStmtParameters;
 class SqlParamBinder;
 class Database;
+class CachedRowSet;
 
 #define MAX_QUERY_LEN   (32*1024)
 
@@ -49,6 +52,9 @@ class SqlConnection
         virtual bool Initialize(const char* infoString) = 0;
         // public methods for making queries
         virtual std::unique_ptr<QueryResult> Query(const char* sql) = 0;
+        // binary protocol variant for bulk loaders - backends without native
+        // typed result support fall back to the regular text protocol query
+        virtual std::unique_ptr<QueryResult> QueryTyped(const char* sql) { return Query(sql); }
         virtual QueryNamedResult* QueryNamed(const char* sql) = 0;
 
         // public methods for making requests
@@ -106,18 +112,15 @@ class Database
     public:
         virtual ~Database();
 
-        virtual bool Initialize(const char* infoString, int nConns = 1);
+        virtual bool Initialize(const char* infoString, int nConns = 1, int nAsyncQueryThreads = 0);
         // start worker thread for async DB request execution
         virtual void InitDelayThread();
         // stop worker thread
         virtual void HaltDelayThread();
 
         /// Synchronous DB queries
-        inline std::unique_ptr<QueryResult> Query(const char* sql)
-        {
-            SqlConnection::Lock guard(getQueryConnection());
-            return guard->Query(sql);
-        }
+        std::unique_ptr<QueryResult> Query(const char* sql);
+        std::unique_ptr<QueryResult> QueryTyped(const char* sql);
 
         inline QueryNamedResult* QueryNamed(const char* sql)
         {
@@ -126,6 +129,7 @@ class Database
         }
 
         std::unique_ptr<QueryResult> PQuery(const char* format, ...) ATTR_PRINTF(2, 3);
+        std::unique_ptr<QueryResult> PQueryTyped(const char* format, ...) ATTR_PRINTF(2, 3);
         QueryNamedResult* PQueryNamed(const char* format, ...) ATTR_PRINTF(2, 3);
 
         bool DirectExecute(const char* sql) const
@@ -173,6 +177,13 @@ class Database
         bool AsyncPQuery(void (*method)(QueryResult*, ParamType1, ParamType2), ParamType1 param1, ParamType2 param2, const char* format, ...) ATTR_PRINTF(5, 6);
         template<typename ParamType1, typename ParamType2, typename ParamType3>
         bool AsyncPQuery(void (*method)(QueryResult*, ParamType1, ParamType2, ParamType3), ParamType1 param1, ParamType2 param2, ParamType3 param3, const char* format, ...) ATTR_PRINTF(6, 7);
+        // Query / functional - result is delivered through ProcessResultQueue on the next world tick
+        bool AsyncQuery(std::function<void(QueryResult*)> callback, const char* sql);
+        bool AsyncPQuery(std::function<void(QueryResult*)> callback, const char* format, ...) ATTR_PRINTF(3, 4);
+        // Query / functional - callback runs on the DB worker thread as soon as the result
+        // is ready, without waiting for the next world tick; it MUST NOT touch world state
+        bool AsyncQueryUnsafe(std::function<void(QueryResult*)> callback, const char* sql);
+        bool AsyncPQueryUnsafe(std::function<void(QueryResult*)> callback, const char* format, ...) ATTR_PRINTF(3, 4);
         template<class Class>
         // QueryHolder
         bool DelayQueryHolder(Class* object, void (Class::*method)(QueryResult*, SqlQueryHolder*), SqlQueryHolder* holder);
@@ -191,6 +202,17 @@ class Database
         // for sync transaction execution
         bool CommitTransactionDirect();
 
+        // WRITE-AHEAD JOURNAL
+
+        // attaches a local write-ahead journal file and synchronously replays
+        // any records a crashed process left in it; call once after Initialize,
+        // before the world starts producing saves
+        bool InitJournal(char const* path);
+        // commits the current transaction like CommitTransaction, but appends
+        // it (fsync'd) to the journal first when one is attached, so a process
+        // crash before the async flush cannot lose it
+        bool CommitJournaledTransaction();
+
         // PREPARED STATEMENT API
 
         // allocate index for prepared statement with SQL request 'fmt'
@@ -222,6 +244,16 @@ class Database
         // NO ASYNC TRANSACTIONS DURING SERVER STARTUP - ONLY DURING RUNTIME!!!
         void AllowAsyncTransactions() { m_allowAsyncTransactions = true; }
 
+        // READ-THROUGH ROWSET CACHE
+
+        // registers a query shape: synchronous Query()/PQuery() calls whose SQL starts
+        // with the given prefix are answered from an in-memory rowset cache keyed by
+        // the full statement text, until the shape is invalidated
+        void RegisterCachedQueryShape(char const* prefix);
+        // drops every cached rowset whose SQL starts with the given prefix - call this
+        // from the code paths that modify the rows the registered shapes read
+        void InvalidateCachedQueries(char const* prefix);
+
     protected:
         Database() :
             m_nQueryConnPoolSize(1), m_pAsyncConn(nullptr), m_pResultQueue(nullptr),
@@ -229,6 +261,7 @@ class Database
             m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0)
         {
             m_nQueryCounter = -1;
+            m_nAsyncQueryCounter = -1;
         }
 
         void StopServer();
@@ -247,6 +280,9 @@ class Database
         SqlConnection* getQueryConnection();
         // for now return one single connection for async requests
         SqlConnection* getAsyncConnection() const { return m_pAsyncConn; }
+        // round-robin worker selection for read-only async queries; writes and
+        // transactions always stay on the single serialized delay thread
+        SqlDelayThread* getQueryThread();
 
         friend class SqlStatement;
         // PREPARED STATEMENT API
@@ -269,8 +305,16 @@ class Database
         SqlDelayThread*     m_threadBody;                   ///< Pointer to delay sql executer (owned by m_delayThread)
         MaNGOS::Thread*     m_delayThread;                  ///< Pointer to executer thread
 
+        ///< additional worker threads with own connections for read-only async queries
+        SqlConnectionContainer m_pAsyncQueryConnections;
+        std::vector<SqlDelayThread*> m_queryThreadBodies;   // owned by m_queryThreads
+        std::vector<MaNGOS::Thread*> m_queryThreads;
+        std::atomic_long m_nAsyncQueryCounter;              // counter for query thread selection
+
         std::atomic<bool> m_allowAsyncTransactions;         ///< flag which specifies if async transactions are enabled
 
+        std::unique_ptr<SqlJournal> m_journal;              ///< write-ahead journal for crash-safe transactions
+
         // PREPARED STATEMENT REGISTRY
         typedef std::mutex LOCK_TYPE;
         typedef std::lock_guard<LOCK_TYPE> LOCK_GUARD;
@@ -282,6 +326,14 @@ class Database
 
         int m_iStmtIndex;
 
+        // READ-THROUGH ROWSET CACHE
+        bool IsCachedShape(char const* sql) const;
+        std::unique_ptr<QueryResult> CachedQuery(char const* sql);
+
+        mutable LOCK_TYPE m_cacheGuard;
+        std::vector<std::string> m_cachedShapes;
+        std::unordered_map<std::string, std::shared_ptr<CachedRowSet const>> m_queryCache;
+
     private:
 
         bool m_logSQL;
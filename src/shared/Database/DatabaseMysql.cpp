@@ -221,6 +221,63 @@ std::unique_ptr<QueryResult> MySQLConnection::Query(const char* sql)
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> MySQLConnection::QueryTyped(const char* sql)
+{
+    if (!mMysql)
+        return nullptr;
+
+    MYSQL_STMT* stmt = mysql_stmt_init(mMysql);
+    if (!stmt)
+        return Query(sql);
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    if (mysql_stmt_prepare(stmt, sql, static_cast<unsigned long>(strlen(sql))))
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("prepare ERROR: %s", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return Query(sql);
+    }
+
+    // statements without a result set (or ones the server refuses to prepare
+    // as such) go through the regular text protocol path
+    MYSQL_RES* metadata = mysql_stmt_result_metadata(stmt);
+    if (!metadata)
+    {
+        mysql_stmt_close(stmt);
+        return Query(sql);
+    }
+    mysql_free_result(metadata);
+
+    // real column lengths are needed to size the recycled row buffers once
+    MySqlBindBool updateMaxLength = 1;
+    mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &updateMaxLength);
+
+    if (mysql_stmt_execute(stmt) || mysql_stmt_store_result(stmt))
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("query ERROR: %s", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+    DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL: %s", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), sql);
+
+    uint64 rowCount = mysql_stmt_num_rows(stmt);
+    uint32 fieldCount = mysql_stmt_field_count(stmt);
+
+    if (!rowCount)
+    {
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+
+    auto queryResult = std::make_unique<QueryResultTypedMysql>(stmt, rowCount, fieldCount);
+
+    queryResult->NextRow();
+    return queryResult;
+}
+
 QueryNamedResult* MySQLConnection::QueryNamed(const char* sql)
 {
     MYSQL_RES* result = nullptr;
@@ -71,6 +71,7 @@ class MySQLConnection : public SqlConnection
         bool Initialize(const char* infoString) override;
 
         std::unique_ptr<QueryResult> Query(const char* sql) override;
+        std::unique_ptr<QueryResult> QueryTyped(const char* sql) override;
         QueryNamedResult* QueryNamed(const char* sql) override;
         bool Execute(const char* sql) override;
 
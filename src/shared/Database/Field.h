@@ -34,13 +34,13 @@ class Field
             DB_TYPE_BOOL    = 0x04
         };
 
-        Field() : mValue(nullptr), mType(DB_TYPE_UNKNOWN) {}
-        Field(const char* value, enum DataTypes type) : mValue(value), mType(type) {}
+        Field() : mValue(nullptr), mType(DB_TYPE_UNKNOWN), mTyped(false), mNumInt(0), mNumFloat(0.0) {}
+        Field(const char* value, enum DataTypes type) : mValue(value), mType(type), mTyped(false), mNumInt(0), mNumFloat(0.0) {}
 
         ~Field() {}
 
         enum DataTypes GetType() const { return mType; }
-        bool IsNULL() const { return mValue == nullptr; }
+        bool IsNULL() const { return !mTyped && mValue == nullptr; }
 
         const char* GetString() const
         {
@@ -50,15 +50,18 @@ class Field
         {
             return mValue ? mValue : "";                    // std::string s = 0 have undefine result in C++
         }
-        float GetFloat() const { return mValue ? static_cast<float>(atof(mValue)) : 0.0f; }
-        bool GetBool() const { return mValue ? atoi(mValue) > 0 : false; }
-        int32 GetInt32() const { return mValue ? static_cast<int32>(atol(mValue)) : int32(0); }
-        uint8 GetUInt8() const { return mValue ? static_cast<uint8>(atol(mValue)) : uint8(0); }
-        uint16 GetUInt16() const { return mValue ? static_cast<uint16>(atol(mValue)) : uint16(0); }
-        int16 GetInt16() const { return mValue ? static_cast<int16>(atol(mValue)) : int16(0); }
-        uint32 GetUInt32() const { return mValue ? static_cast<uint32>(atoll(mValue)) : uint32(0); }
+        float GetFloat() const { return mTyped ? static_cast<float>(mNumFloat) : (mValue ? static_cast<float>(atof(mValue)) : 0.0f); }
+        bool GetBool() const { return mTyped ? mNumInt > 0 : (mValue ? atoi(mValue) > 0 : false); }
+        int32 GetInt32() const { return mTyped ? static_cast<int32>(mNumInt) : (mValue ? static_cast<int32>(atol(mValue)) : int32(0)); }
+        uint8 GetUInt8() const { return mTyped ? static_cast<uint8>(mNumInt) : (mValue ? static_cast<uint8>(atol(mValue)) : uint8(0)); }
+        uint16 GetUInt16() const { return mTyped ? static_cast<uint16>(mNumInt) : (mValue ? static_cast<uint16>(atol(mValue)) : uint16(0)); }
+        int16 GetInt16() const { return mTyped ? static_cast<int16>(mNumInt) : (mValue ? static_cast<int16>(atol(mValue)) : int16(0)); }
+        uint32 GetUInt32() const { return mTyped ? static_cast<uint32>(mNumInt) : (mValue ? static_cast<uint32>(atoll(mValue)) : uint32(0)); }
         uint64 GetUInt64() const
         {
+            if (mTyped)
+                return static_cast<uint64>(mNumInt);
+
             uint64 value = 0;
             if (!mValue || sscanf(mValue, UI64FMTD, &value) == -1)
                 return 0;
@@ -70,7 +73,12 @@ class Field
         void SetType(enum DataTypes type) { mType = type; }
         // no need for memory allocations to store resultset field strings
         // all we need is to cache pointers returned by different DBMS APIs
-        void SetValue(const char* value) { mValue = value; }
+        void SetValue(const char* value) { mValue = value; mTyped = false; }
+
+        // native-typed values delivered by binary protocol result sets - the
+        // numeric getters return them directly without any text conversion
+        void SetInt64Value(int64 value) { mNumInt = value; mNumFloat = static_cast<double>(value); mTyped = true; mValue = nullptr; }
+        void SetDoubleValue(double value) { mNumFloat = value; mNumInt = static_cast<int64>(value); mTyped = true; mValue = nullptr; }
 
     private:
         Field(Field const&);
@@ -78,5 +86,8 @@ class Field
 
         const char* mValue;
         enum DataTypes mType;
+        bool mTyped;
+        int64 mNumInt;
+        double mNumFloat;
 };
 #endif
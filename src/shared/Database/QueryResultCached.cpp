@@ -0,0 +1,83 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "QueryResultCached.h"
+
+std::shared_ptr<CachedRowSet const> CachedRowSet::Materialize(QueryResult* result)
+{
+    auto rows = std::make_shared<CachedRowSet>();
+
+    if (result)
+    {
+        uint32 const fieldCount = result->GetFieldCount();
+        do
+        {
+            Field* fields = result->Fetch();
+
+            if (rows->m_types.empty())
+                for (uint32 i = 0; i < fieldCount; ++i)
+                    rows->m_types.push_back(fields[i].GetType());
+
+            std::vector<CachedValue> row(fieldCount);
+            for (uint32 i = 0; i < fieldCount; ++i)
+            {
+                row[i].isNull = fields[i].IsNULL();
+                if (!row[i].isNull)
+                    row[i].text = fields[i].GetString();
+            }
+            rows->m_rows.push_back(std::move(row));
+        }
+        while (result->NextRow());
+    }
+
+    return rows;
+}
+
+std::unique_ptr<QueryResult> QueryResultCached::MakeView(std::shared_ptr<CachedRowSet const> const& rows)
+{
+    if (!rows || rows->m_rows.empty())
+        return nullptr;
+
+    return std::unique_ptr<QueryResult>(new QueryResultCached(rows));
+}
+
+QueryResultCached::QueryResultCached(std::shared_ptr<CachedRowSet const> rows)
+    : QueryResult(rows->GetRowCount(), rows->GetFieldCount()),
+      m_rows(std::move(rows)), m_fields(m_rows->GetFieldCount()), m_nextRow(0)
+{
+    for (uint32 i = 0; i < mFieldCount; ++i)
+        m_fields[i].SetType(m_rows->m_types[i]);
+
+    mCurrentRow = m_fields.empty() ? nullptr : m_fields.data();
+
+    // position on the first row like the DBMS backends do
+    NextRow();
+}
+
+bool QueryResultCached::NextRow()
+{
+    if (m_nextRow >= m_rows->m_rows.size())
+        return false;
+
+    std::vector<CachedRowSet::CachedValue> const& row = m_rows->m_rows[m_nextRow];
+    for (uint32 i = 0; i < mFieldCount; ++i)
+        m_fields[i].SetValue(row[i].isNull ? nullptr : row[i].text.c_str());
+
+    ++m_nextRow;
+    return true;
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef QUERYRESULTCACHED_H
+#define QUERYRESULTCACHED_H
+
+#include "QueryResult.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * Immutable rowset materialized from a QueryResult, shared between the
+ * Database read-through cache and the views handed out to callers.
+ */
+class CachedRowSet
+{
+        friend class QueryResultCached;
+
+    public:
+        // drains the given cursor into an in-memory copy; accepts nullptr (empty result)
+        static std::shared_ptr<CachedRowSet const> Materialize(QueryResult* result);
+
+        uint64 GetRowCount() const { return m_rows.size(); }
+        uint32 GetFieldCount() const { return uint32(m_types.size()); }
+
+    private:
+        struct CachedValue
+        {
+            std::string text;
+            bool isNull;
+        };
+
+        std::vector<Field::DataTypes> m_types;
+        std::vector<std::vector<CachedValue>> m_rows;
+};
+
+/**
+ * QueryResult served from a CachedRowSet. Every caller gets an own cursor;
+ * the underlying rows stay shared and untouched.
+ */
+class QueryResultCached : public QueryResult
+{
+    public:
+        // returns nullptr for empty rowsets, matching the DBMS backends
+        static std::unique_ptr<QueryResult> MakeView(std::shared_ptr<CachedRowSet const> const& rows);
+
+        bool NextRow() override;
+
+    private:
+        explicit QueryResultCached(std::shared_ptr<CachedRowSet const> rows);
+
+        std::shared_ptr<CachedRowSet const> m_rows;
+        std::vector<Field> m_fields;
+        size_t m_nextRow;
+};
+
+#endif
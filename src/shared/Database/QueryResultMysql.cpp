@@ -22,6 +22,8 @@
 #include "DatabaseEnv.h"
 #include "Util/Errors.h"
 
+#include <algorithm>
+
 QueryResultMysql::QueryResultMysql(MYSQL_RES* result, MYSQL_FIELD* fields, uint64 rowCount, uint32 fieldCount) :
     QueryResult(rowCount, fieldCount), mResult(result)
 {
@@ -67,7 +69,118 @@ void QueryResultMysql::EndQuery()
     }
 }
 
-enum Field::DataTypes QueryResultMysql::ConvertNativeType(enum_field_types mysqlType) const
+QueryResultTypedMysql::QueryResultTypedMysql(MYSQL_STMT* stmt, uint64 rowCount, uint32 fieldCount) :
+    QueryResult(rowCount, fieldCount), mStmt(stmt)
+{
+    mCurrentRow = new Field[mFieldCount];
+    MANGOS_ASSERT(mCurrentRow);
+
+    mBinds.resize(mFieldCount);
+    memset(mBinds.data(), 0, sizeof(MYSQL_BIND) * mFieldCount);
+    mBuffers.resize(mFieldCount);
+    mLengths.resize(mFieldCount);
+    mNulls.resize(mFieldCount);
+    mIsText.resize(mFieldCount);
+
+    MYSQL_RES* metadata = mysql_stmt_result_metadata(mStmt);
+    MANGOS_ASSERT(metadata);
+    MYSQL_FIELD* fields = mysql_fetch_fields(metadata);
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+    {
+        mCurrentRow[i].SetType(QueryResultMysql::ConvertNativeType(fields[i].type));
+
+        MYSQL_BIND& bind = mBinds[i];
+        switch (fields[i].type)
+        {
+            case FIELD_TYPE_TINY:
+            case FIELD_TYPE_SHORT:
+            case FIELD_TYPE_LONG:
+            case FIELD_TYPE_INT24:
+            case FIELD_TYPE_LONGLONG:
+            case FIELD_TYPE_YEAR:
+                // narrower widths are widened by the client library on fetch
+                bind.buffer_type = MYSQL_TYPE_LONGLONG;
+                bind.is_unsigned = (fields[i].flags & UNSIGNED_FLAG) != 0;
+                mBuffers[i].resize(sizeof(uint64));
+                break;
+            case FIELD_TYPE_FLOAT:
+            case FIELD_TYPE_DOUBLE:
+            case FIELD_TYPE_DECIMAL:
+                bind.buffer_type = MYSQL_TYPE_DOUBLE;
+                mBuffers[i].resize(sizeof(double));
+                break;
+            default:
+                // strings, blobs, enums, dates: fetched as text into a buffer
+                // sized once from the stored result's max_length
+                bind.buffer_type = MYSQL_TYPE_STRING;
+                mBuffers[i].resize(size_t(fields[i].max_length) + 1);
+                mIsText[i] = true;
+                break;
+        }
+
+        bind.buffer = mBuffers[i].data();
+        bind.buffer_length = static_cast<unsigned long>(mBuffers[i].size());
+        bind.length = &mLengths[i];
+        bind.is_null = &mNulls[i];
+    }
+
+    mysql_free_result(metadata);
+    mysql_stmt_bind_result(mStmt, mBinds.data());
+}
+
+QueryResultTypedMysql::~QueryResultTypedMysql()
+{
+    EndQuery();
+}
+
+bool QueryResultTypedMysql::NextRow()
+{
+    if (!mStmt)
+        return false;
+
+    int status = mysql_stmt_fetch(mStmt);
+    if (status != 0 && status != MYSQL_DATA_TRUNCATED)
+    {
+        EndQuery();
+        return false;
+    }
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+    {
+        if (mNulls[i])
+            mCurrentRow[i].SetValue(nullptr);
+        else if (mIsText[i])
+        {
+            // terminate in place - the buffer is reused by the next fetch, so
+            // the pointer handed to Field stays valid only for this row, which
+            // matches the lifetime the text protocol result already provides
+            unsigned long length = std::min(mLengths[i], static_cast<unsigned long>(mBuffers[i].size() - 1));
+            mBuffers[i][length] = '\0';
+            mCurrentRow[i].SetValue(mBuffers[i].data());
+        }
+        else if (mBinds[i].buffer_type == MYSQL_TYPE_DOUBLE)
+            mCurrentRow[i].SetDoubleValue(*reinterpret_cast<double*>(mBuffers[i].data()));
+        else
+            mCurrentRow[i].SetInt64Value(*reinterpret_cast<int64*>(mBuffers[i].data()));
+    }
+
+    return true;
+}
+
+void QueryResultTypedMysql::EndQuery()
+{
+    delete[] mCurrentRow;
+    mCurrentRow = nullptr;
+
+    if (mStmt)
+    {
+        mysql_stmt_close(mStmt);
+        mStmt = nullptr;
+    }
+}
+
+enum Field::DataTypes QueryResultMysql::ConvertNativeType(enum_field_types mysqlType)
 {
     switch (mysqlType)
     {
@@ -30,6 +30,13 @@
 
 #include <mysql.h>
 
+#include <type_traits>
+#include <vector>
+
+// MySQL 8 replaced my_bool with bool while MariaDB kept the typedef - derive
+// the flag type from the MYSQL_BIND structure so both client libraries work
+typedef std::remove_pointer<decltype(MYSQL_BIND::is_null)>::type MySqlBindBool;
+
 class QueryResultMysql : public QueryResult
 {
     public:
@@ -39,12 +46,39 @@ class QueryResultMysql : public QueryResult
 
         bool NextRow() override;
 
+        static enum Field::DataTypes ConvertNativeType(enum_field_types mysqlType);
+
     private:
-        enum Field::DataTypes ConvertNativeType(enum_field_types mysqlType) const;
         void EndQuery();
 
         MYSQL_RES* mResult;
 };
+
+// result of a binary protocol (prepared statement) query: columns are bound
+// through MYSQL_BIND in their native types and fetched into row buffers that
+// are recycled across fetches, so bulk loaders skip the per-access text
+// conversion the classic text protocol result requires
+class QueryResultTypedMysql : public QueryResult
+{
+    public:
+        // takes ownership of an executed statement whose result set is already
+        // stored client-side (mysql_stmt_store_result)
+        QueryResultTypedMysql(MYSQL_STMT* stmt, uint64 rowCount, uint32 fieldCount);
+
+        ~QueryResultTypedMysql();
+
+        bool NextRow() override;
+
+    private:
+        void EndQuery();
+
+        MYSQL_STMT* mStmt;
+        std::vector<MYSQL_BIND> mBinds;
+        std::vector<std::vector<char>> mBuffers;        // one reusable value buffer per column
+        std::vector<unsigned long> mLengths;
+        std::vector<MySqlBindBool> mNulls;
+        std::vector<bool> mIsText;                      // column decodes as text rather than a native number
+};
 #endif
 #endif
 #endif
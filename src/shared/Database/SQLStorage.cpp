@@ -17,6 +17,211 @@
  */
 
 #include "SQLStorage.h"
+#include "Config/Config.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// -----------------------------------  binary cache  ------------------------------------------ //
+
+namespace
+{
+    char const SQLSTORAGE_CACHE_MAGIC[4] = { 'M', 'S', 'Q', 'C' };
+    uint32 const SQLSTORAGE_CACHE_VERSION = 1;
+
+    uint32 FieldSizeByFormat(char format)
+    {
+        switch (format)
+        {
+            case FT_LOGIC:      return sizeof(bool);
+            case FT_BYTE:
+            case FT_NA_BYTE:    return sizeof(char);
+            case FT_INT:
+            case FT_NA:         return sizeof(uint32);
+            case FT_FLOAT:
+            case FT_NA_FLOAT:   return sizeof(float);
+            case FT_STRING:
+            case FT_NA_POINTER: return sizeof(char*);
+            case FT_64BITINT:   return sizeof(uint64);
+            default:
+                assert(false && "unknown format character");
+                return 0;
+        }
+    }
+
+    std::string CacheFilePath(char const* tableName)
+    {
+        std::string dir = sConfig.GetStringDefault("SQLStorage.CacheDir", "sqlcache");
+#ifdef _WIN32
+        _mkdir(dir.c_str());
+#else
+        mkdir(dir.c_str(), 0755);
+#endif
+        return dir + "/" + tableName + ".bin";
+    }
+
+    bool WriteString(FILE* f, char const* str)
+    {
+        uint32 len = str ? uint32(strlen(str)) : 0;
+        if (fwrite(&len, sizeof(uint32), 1, f) != 1)
+            return false;
+        return !len || fwrite(str, 1, len, f) == len;
+    }
+
+    // reads a length-prefixed string and compares it against the expected one
+    bool ReadAndCheckString(FILE* f, char const* expected)
+    {
+        uint32 len = 0;
+        if (fread(&len, sizeof(uint32), 1, f) != 1 || len > 0xFFFF)
+            return false;
+        std::string str(len, '\0');
+        if (len && fread(&str[0], 1, len, f) != len)
+            return false;
+        return str == (expected ? expected : "");
+    }
+}
+
+bool SQLStorageBase::CacheEnabled()
+{
+    return sConfig.GetBoolDefault("SQLStorage.Cache", false);
+}
+
+bool SQLStorageBase::LoadFromCacheFile(uint64 checksum)
+{
+    FILE* f = fopen(CacheFilePath(m_tableName).c_str(), "rb");
+    if (!f)
+        return false;
+
+    bool result = true;
+    char magic[4];
+    uint32 version = 0;
+    uint64 storedChecksum = 0;
+    if (result && (fread(magic, 1, 4, f) != 4 || memcmp(magic, SQLSTORAGE_CACHE_MAGIC, 4) != 0)) result = false;
+    if (result && (fread(&version, sizeof(uint32), 1, f) != 1 || version != SQLSTORAGE_CACHE_VERSION)) result = false;
+    if (result && (fread(&storedChecksum, sizeof(uint64), 1, f) != 1 || storedChecksum != checksum)) result = false;
+    // a changed source or destination format means changed conversion code
+    if (result && !ReadAndCheckString(f, m_src_format)) result = false;
+    if (result && !ReadAndCheckString(f, m_dst_format)) result = false;
+
+    uint32 maxEntry = 0;
+    uint32 recordCount = 0;
+    uint32 recordSize = 0;
+    if (result && fread(&maxEntry, sizeof(uint32), 1, f) != 1) result = false;
+    if (result && fread(&recordCount, sizeof(uint32), 1, f) != 1) result = false;
+    if (result && fread(&recordSize, sizeof(uint32), 1, f) != 1) result = false;
+
+    uint32 expectedSize = 0;
+    for (uint32 x = 0; x < m_dstFieldCount; ++x)
+        expectedSize += FieldSizeByFormat(m_dst_format[x]);
+    if (recordSize != expectedSize)
+        result = false;
+
+    if (result)
+    {
+        prepareToLoad(maxEntry, recordCount, recordSize);
+        for (uint32 i = 0; i < recordCount && result; ++i)
+        {
+            uint32 recordId = 0;
+            if (fread(&recordId, sizeof(uint32), 1, f) != 1)
+            {
+                result = false;
+                break;
+            }
+
+            char* record = createRecord(recordId);
+            uint32 offset = 0;
+            for (uint32 x = 0; x < m_dstFieldCount && result; ++x)
+            {
+                if (m_dst_format[x] == FT_STRING || m_dst_format[x] == FT_NA_POINTER)
+                {
+                    uint32 len = 0;
+                    if (fread(&len, sizeof(uint32), 1, f) != 1)
+                    {
+                        result = false;
+                        break;
+                    }
+                    char* str = new char[len + 1];
+                    if (len && fread(str, 1, len, f) != len)
+                    {
+                        delete[] str;
+                        result = false;
+                        break;
+                    }
+                    str[len] = '\0';
+                    *(char**)(record + offset) = str;
+                    offset += sizeof(char*);
+                }
+                else
+                {
+                    uint32 size = FieldSizeByFormat(m_dst_format[x]);
+                    if (fread(record + offset, 1, size, f) != size)
+                    {
+                        result = false;
+                        break;
+                    }
+                    offset += size;
+                }
+            }
+        }
+    }
+
+    fclose(f);
+    // on a truncated or stale file the caller falls back to the SQL load,
+    // which calls prepareToLoad again and frees whatever was created so far
+    return result;
+}
+
+void SQLStorageBase::SaveToCacheFile(uint64 checksum) const
+{
+    FILE* f = fopen(CacheFilePath(m_tableName).c_str(), "wb");
+    if (!f)
+        return;
+
+    bool result = true;
+    if (result && fwrite(SQLSTORAGE_CACHE_MAGIC, 1, 4, f) != 4) result = false;
+    if (result && fwrite(&SQLSTORAGE_CACHE_VERSION, sizeof(uint32), 1, f) != 1) result = false;
+    if (result && fwrite(&checksum, sizeof(uint64), 1, f) != 1) result = false;
+    if (result && !WriteString(f, m_src_format)) result = false;
+    if (result && !WriteString(f, m_dst_format)) result = false;
+    if (result && fwrite(&m_maxEntry, sizeof(uint32), 1, f) != 1) result = false;
+    if (result && fwrite(&m_recordCount, sizeof(uint32), 1, f) != 1) result = false;
+    if (result && fwrite(&m_recordSize, sizeof(uint32), 1, f) != 1) result = false;
+
+    for (uint32 i = 0; i < m_recordCount && result; ++i)
+    {
+        char const* record = m_data + i * m_recordSize;
+        if (fwrite(&m_recordIds[i], sizeof(uint32), 1, f) != 1)
+        {
+            result = false;
+            break;
+        }
+
+        uint32 offset = 0;
+        for (uint32 x = 0; x < m_dstFieldCount && result; ++x)
+        {
+            if (m_dst_format[x] == FT_STRING || m_dst_format[x] == FT_NA_POINTER)
+            {
+                if (!WriteString(f, *(char* const*)(record + offset)))
+                    result = false;
+                offset += sizeof(char*);
+            }
+            else
+            {
+                uint32 size = FieldSizeByFormat(m_dst_format[x]);
+                if (fwrite(record + offset, 1, size, f) != size)
+                    result = false;
+                offset += size;
+            }
+        }
+    }
+
+    fclose(f);
+    if (!result)
+        remove(CacheFilePath(m_tableName).c_str());
+}
 
 // -----------------------------------  SQLStorageBase  ---------------------------------------- //
 
@@ -48,6 +253,7 @@ char* SQLStorageBase::createRecord(uint32 recordId)
 {
     char* newRecord = &m_data[m_recordCount * m_recordSize];
     ++m_recordCount;
+    m_recordIds.push_back(recordId);
 
     JustCreatedRecord(recordId, newRecord);
     return newRecord;
@@ -63,6 +269,8 @@ void SQLStorageBase::prepareToLoad(uint32 maxEntry, uint32 recordCount, uint32 r
     memset(m_data, 0, recordCount * m_recordSize);
 
     m_recordCount = 0;
+    m_recordIds.clear();
+    m_recordIds.reserve(recordCount);
 }
 
 // Function to delete the data
@@ -70,6 +70,13 @@ class SQLStorageBase
 
         void Initialize(const char* tableName, const char* entry_field, const char* src_format, const char* dst_format);
 
+        // On-disk binary cache of the fully converted table, keyed by a table
+        // checksum. Records are stream-read back through createRecord, so the
+        // per-class lookup index is rebuilt the same way as on a SQL load.
+        static bool CacheEnabled();
+        bool LoadFromCacheFile(uint64 checksum);
+        void SaveToCacheFile(uint64 checksum) const;
+
         uint32 GetDstFieldCount() const { return m_dstFieldCount; }
         uint32 GetSrcFieldCount() const { return m_srcFieldCount; }
         uint32 GetRecordSize() const { return m_recordSize; }
@@ -96,6 +103,7 @@ class SQLStorageBase
 
         // Data Storage
         char* m_data;
+        std::vector<uint32> m_recordIds;                    // in creation order, parallel to m_data records
 };
 
 class SQLStorage : public SQLStorageBase
@@ -305,6 +305,22 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::storeValue(char const* v
 template<class DerivedLoader, class StorageClass>
 void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store, bool error_at_empty /*= true*/)
 {
+    // with the binary cache enabled, try to serve the fully converted table
+    // from disk - valid only while the table checksum matches
+    uint64 cacheChecksum = 0;
+    if (SQLStorageBase::CacheEnabled())
+    {
+        if (auto checksumResult = WorldDatabase.PQuery("CHECKSUM TABLE %s", store.GetTableName()))
+        {
+            cacheChecksum = (*checksumResult)[1].GetUInt64();
+            if (cacheChecksum && store.LoadFromCacheFile(cacheChecksum))
+            {
+                sLog.outString(">> Loaded %s from binary cache (%u records)", store.GetTableName(), store.GetRecordCount());
+                return;
+            }
+        }
+    }
+
     Field* fields = nullptr;
     auto queryResult = WorldDatabase.PQuery("SELECT MAX(%s) FROM %s", store.EntryFieldName(), store.GetTableName());
     if (!queryResult)
@@ -440,6 +456,10 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
         }
     }
     while (queryResult->NextRow());
+
+    // conversion already ran, so a cache hit next boot skips it entirely
+    if (cacheChecksum)
+        store.SaveToCacheFile(cacheChecksum);
 }
 
 #endif
@@ -19,9 +19,12 @@
 #include "Database/SqlDelayThread.h"
 #include "Database/SqlOperations.h"
 #include "DatabaseEnv.h"
+#include "Config/Config.h"
 
 SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn) : m_dbEngine(db), m_dbConnection(conn), m_running(true)
 {
+    m_coalesceBatch = std::max(sConfig.GetIntDefault("Database.CoalesceBatch", 32), 1);
+    m_coalesceBytes = std::max(sConfig.GetIntDefault("Database.CoalesceBytes", 256 * 1024), 1);
 }
 
 SqlDelayThread::~SqlDelayThread()
@@ -83,8 +86,37 @@ void SqlDelayThread::ProcessRequests()
 
     while (!sqlQueue.empty())
     {
-        auto const s = std::move(sqlQueue.front());
+        auto s = std::move(sqlQueue.front());
         sqlQueue.pop();
+
+        // merge a run of consecutive transactions accumulated during one world tick
+        // into a single multi-statement commit instead of one MySQL round-trip each
+        if (m_coalesceBatch > 1 && dynamic_cast<SqlTransaction*>(s.get()))
+        {
+            std::vector<std::unique_ptr<SqlOperation>> batch;
+            size_t bytes = s->GetByteEstimate();
+            batch.push_back(std::move(s));
+
+            while (!sqlQueue.empty() && batch.size() < m_coalesceBatch && bytes < m_coalesceBytes)
+            {
+                SqlOperation* next = sqlQueue.front().get();
+                if (!dynamic_cast<SqlTransaction*>(next))
+                    break;
+
+                bytes += next->GetByteEstimate();
+                batch.push_back(std::move(sqlQueue.front()));
+                sqlQueue.pop();
+            }
+
+            if (batch.size() > 1)
+            {
+                SqlTransaction::ExecuteCoalesced(m_dbConnection, batch);
+                continue;
+            }
+
+            s = std::move(batch.front());
+        }
+
         s->Execute(m_dbConnection);
     }
 }
@@ -39,6 +39,8 @@ class SqlDelayThread : public MaNGOS::Runnable
         Database* m_dbEngine;                                   ///< Pointer to used Database engine
         SqlConnection* m_dbConnection;                          ///< Pointer to DB connection
         std::atomic<bool> m_running;
+        uint32 m_coalesceBatch;                                 ///< Max transactions merged into one commit (1 disables)
+        uint32 m_coalesceBytes;                                 ///< Approximate byte budget of one merged commit
 
         // process all enqueued requests
         void ProcessRequests();
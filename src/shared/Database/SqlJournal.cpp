@@ -0,0 +1,140 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Database/SqlJournal.h"
+#include "DatabaseEnv.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+    bool FlushToDisk(FILE* file)
+    {
+        if (fflush(file) != 0)
+            return false;
+#ifdef _WIN32
+        return _commit(_fileno(file)) == 0;
+#else
+        return fsync(fileno(file)) == 0;
+#endif
+    }
+}
+
+SqlJournal::~SqlJournal()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_file)
+    {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+bool SqlJournal::Open(std::string const& path)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_path = path;
+    // append mode creates the file if missing and preserves crash leftovers
+    m_file = fopen(path.c_str(), "a+b");
+    return m_file != nullptr;
+}
+
+uint32 SqlJournal::Replay(Database& db)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_file)
+        return 0;
+
+    rewind(m_file);
+
+    uint32 replayed = 0;
+    std::vector<char> buffer;
+    for (;;)
+    {
+        uint32 length = 0;
+        if (fread(&length, sizeof(length), 1, m_file) != 1)
+            break;
+
+        // a zero or oversized length means a corrupted tail, not a record
+        if (!length || length > MAX_QUERY_LEN)
+            break;
+
+        buffer.resize(length + 1);
+        if (fread(buffer.data(), 1, length, m_file) != length)
+            break;                                          // record torn by the crash itself
+
+        buffer[length] = '\0';
+        if (db.DirectExecute(buffer.data()))
+            ++replayed;
+        else
+            sLog.outError("SqlJournal: replay of a journaled statement failed: %s", buffer.data());
+    }
+
+    ResetLocked();
+    return replayed;
+}
+
+uint64 SqlJournal::Append(std::vector<std::string> const& statements)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_file)
+        return 0;
+
+    for (std::string const& sql : statements)
+    {
+        uint32 const length = uint32(sql.size());
+        fwrite(&length, sizeof(length), 1, m_file);
+        fwrite(sql.data(), 1, length, m_file);
+    }
+
+    if (!FlushToDisk(m_file))
+        sLog.outError("SqlJournal: flush of %s failed, journal is no longer crash safe", m_path.c_str());
+
+    return ++m_appendSequence;
+}
+
+void SqlJournal::Confirm(uint64 sequence)
+{
+    if (!sequence)
+        return;
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (sequence > m_confirmSequence)
+        m_confirmSequence = sequence;
+
+    // everything appended so far reached the database - drop the records
+    if (m_confirmSequence == m_appendSequence && m_file)
+        ResetLocked();
+}
+
+void SqlJournal::ResetLocked()
+{
+    if (FILE* reopened = freopen(m_path.c_str(), "w+b", m_file))
+        m_file = reopened;
+    else
+    {
+        // freopen closed the old stream on failure; further saves lose the
+        // journal safety net but keep flowing to the database
+        sLog.outError("SqlJournal: cannot truncate %s, journaling disabled", m_path.c_str());
+        m_file = nullptr;
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SQLJOURNAL_H
+#define SQLJOURNAL_H
+
+#include "Common.h"
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Database;
+
+/**
+ * Local write-ahead journal for asynchronously flushed transactions.
+ *
+ * Character saves are committed through the async delay thread (and merged
+ * into coalesced batches there), so a process crash loses every save still
+ * sitting in that queue. A journaled transaction appends its statements as
+ * plain SQL to this file and fsyncs before it is queued - cheap sequential
+ * I/O on the world thread - while the MySQL flush stays batched. When the
+ * delay thread reports a transaction committed, its record is confirmed;
+ * once every appended record is confirmed the file is truncated, so in
+ * steady state it holds at most a few ticks worth of saves. On restart
+ * after a crash, Replay() feeds the leftover records back into the
+ * database in their original order.
+ *
+ * Records are length-prefixed, so a write torn by the crash itself is
+ * detected and discarded during replay. The journal guards against process
+ * death, not against SQL errors: a statement the database rejects would be
+ * rejected on replay too, so failed transactions release their records
+ * like successful ones.
+ */
+class SqlJournal
+{
+    public:
+        SqlJournal() : m_file(nullptr), m_appendSequence(0), m_confirmSequence(0) {}
+        ~SqlJournal();
+
+        // opens (creating if needed) the journal file; existing records are
+        // kept for Replay. Returns false on I/O error
+        bool Open(std::string const& path);
+        // replays records left behind by a crashed process into the database
+        // and empties the file; call once after Open, before the first save.
+        // Returns the number of successfully replayed statements
+        uint32 Replay(Database& db);
+
+        // durably appends one transaction's statements and returns its
+        // sequence id (never 0); called from the committing thread
+        uint64 Append(std::vector<std::string> const& statements);
+        // marks a sequence as flushed to the database; called from the delay
+        // thread. Once everything appended is confirmed the file is truncated
+        void Confirm(uint64 sequence);
+
+    private:
+        // truncates the file in place, keeping the handle valid for appends
+        void ResetLocked();
+
+        std::mutex m_mutex;
+        FILE* m_file;
+        std::string m_path;
+        uint64 m_appendSequence;
+        uint64 m_confirmSequence;
+};
+
+#endif
@@ -18,6 +18,7 @@
 
 #include "SqlOperations.h"
 #include "SqlDelayThread.h"
+#include "SqlJournal.h"
 #include "DatabaseEnv.h"
 #include "DatabaseImpl.h"
 
@@ -46,25 +47,103 @@ SqlTransaction::~SqlTransaction()
 bool SqlTransaction::Execute(SqlConnection* conn)
 {
     if (m_queue.empty())
+    {
+        ConfirmJournal();
         return true;
+    }
 
     LOCK_DB_CONN(conn);
 
     conn->BeginTransaction();
 
+    if (!ExecuteStatements(conn))
+    {
+        conn->RollbackTransaction();
+        // a SQL error is terminal, not a crash: replaying the record after a
+        // restart would fail the same way, so it is released regardless
+        ConfirmJournal();
+        return false;
+    }
+
+    bool const committed = conn->CommitTransaction();
+    ConfirmJournal();
+    return committed;
+}
+
+void SqlTransaction::ConfirmJournal()
+{
+    if (m_journal)
+    {
+        m_journal->Confirm(m_journalSequence);
+        m_journal = nullptr;
+    }
+}
+
+bool SqlTransaction::FormatSqlStatements(Database& db, std::vector<std::string>& out) const
+{
+    out.reserve(m_queue.size());
+    for (SqlOperation* pStmt : m_queue)
+    {
+        std::string sql;
+        if (!pStmt->FormatSql(db, sql))
+            return false;
+        out.push_back(std::move(sql));
+    }
+    return true;
+}
+
+bool SqlTransaction::ExecuteStatements(SqlConnection* conn)
+{
     const int nItems = m_queue.size();
     for (int i = 0; i < nItems; ++i)
     {
         SqlOperation* pStmt = m_queue[i];
 
         if (!pStmt->Execute(conn))
-        {
-            conn->RollbackTransaction();
             return false;
+    }
+
+    return true;
+}
+
+size_t SqlTransaction::GetByteEstimate() const
+{
+    size_t bytes = 0;
+    for (SqlOperation* pStmt : m_queue)
+        bytes += pStmt->GetByteEstimate();
+    return bytes;
+}
+
+void SqlTransaction::ExecuteCoalesced(SqlConnection* conn, std::vector<std::unique_ptr<SqlOperation>>& transactions)
+{
+    {
+        LOCK_DB_CONN(conn);
+
+        conn->BeginTransaction();
+
+        bool ok = true;
+        for (auto& transaction : transactions)
+        {
+            if (!static_cast<SqlTransaction*>(transaction.get())->ExecuteStatements(conn))
+            {
+                ok = false;
+                break;
+            }
+        }
+
+        if (ok && conn->CommitTransaction())
+        {
+            for (auto& transaction : transactions)
+                static_cast<SqlTransaction*>(transaction.get())->ConfirmJournal();
+            return;
         }
+
+        conn->RollbackTransaction();
     }
 
-    return conn->CommitTransaction();
+    // a statement failed - re-run each transaction separately to keep its own atomicity
+    for (auto& transaction : transactions)
+        transaction->Execute(conn);
 }
 
 SqlPreparedRequest::SqlPreparedRequest(int nIndex, SqlStmtParameters* arg) : m_nIndex(nIndex), m_param(arg)
@@ -82,18 +161,57 @@ bool SqlPreparedRequest::Execute(SqlConnection* conn)
     return conn->ExecuteStmt(m_nIndex, *m_param);
 }
 
+bool SqlPreparedRequest::FormatSql(Database& db, std::string& out) const
+{
+    // substitute bound values into the format string the same way
+    // SqlPlainPreparedStatement does when prepared statements are unavailable
+    out = db.GetStmtString(m_nIndex);
+    if (out.empty())
+        return false;
+
+    size_t lastPos = 0;
+    for (SqlStmtFieldData const& data : m_param->params())
+    {
+        std::ostringstream fmt;
+        SqlPlainPreparedStatement::DataToString(db, data, fmt);
+
+        lastPos = out.find('?', lastPos);
+        if (lastPos == std::string::npos)
+            return false;
+
+        std::string const value = fmt.str();
+        out.replace(lastPos, 1, value);
+        lastPos += value.length();
+    }
+
+    return true;
+}
+
 /// ---- ASYNC QUERIES ----
 
 bool SqlQuery::Execute(SqlConnection* conn)
 {
-    if (!m_callback || !m_queue)
+    if (!m_callback)
         return false;
 
-    LOCK_DB_CONN(conn);
-    /// execute the query and store the result in the callback
-    m_callback->SetResult(conn->Query(&m_sql[0]));
-    /// add the callback to the sql result queue of the thread it originated from
-    m_queue->Add(m_callback);
+    {
+        LOCK_DB_CONN(conn);
+        /// execute the query and store the result in the callback
+        m_callback->SetResult(conn->Query(&m_sql[0]));
+    }
+
+    if (m_queue)
+    {
+        /// add the callback to the sql result queue of the thread it originated from
+        m_queue->Add(m_callback);
+    }
+    else
+    {
+        /// no result queue - the requester marked the callback as safe to run
+        /// right here on the worker thread (Database::AsyncQueryUnsafe)
+        m_callback->Execute();
+        delete m_callback;
+    }
 
     return true;
 }
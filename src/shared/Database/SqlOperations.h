@@ -32,6 +32,7 @@
 class Database;
 class SqlConnection;
 class SqlDelayThread;
+class SqlJournal;
 class SqlStmtParameters;
 
 class SqlOperation
@@ -39,6 +40,11 @@ class SqlOperation
     public:
         virtual void OnRemove() { delete this; }
         virtual bool Execute(SqlConnection* conn) = 0;
+        // rough wire size of the operation, used for the coalescing byte budget
+        virtual size_t GetByteEstimate() const { return 256; }
+        // renders the operation as a plain SQL string for the write-ahead
+        // journal; returns false for operations that cannot be replayed
+        virtual bool FormatSql(Database& /*db*/, std::string& /*out*/) const { return false; }
         virtual ~SqlOperation() {}
 };
 
@@ -52,20 +58,42 @@ class SqlPlainRequest : public SqlOperation
         SqlPlainRequest(const char* sql) : m_sql(mangos_strdup(sql)) {}
         ~SqlPlainRequest() { char* tofree = const_cast<char*>(m_sql); delete[] tofree; }
         bool Execute(SqlConnection* conn) override;
+        size_t GetByteEstimate() const override { return strlen(m_sql); }
+        bool FormatSql(Database& /*db*/, std::string& out) const override { out = m_sql; return true; }
 };
 
 class SqlTransaction : public SqlOperation
 {
     private:
         std::vector<SqlOperation* > m_queue;
+        SqlJournal* m_journal;
+        uint64 m_journalSequence;
 
     public:
-        SqlTransaction() {}
+        SqlTransaction() : m_journal(nullptr), m_journalSequence(0) {}
         ~SqlTransaction();
 
         void DelayExecute(SqlOperation* sql) { m_queue.push_back(sql); }
 
         bool Execute(SqlConnection* conn) override;
+        size_t GetByteEstimate() const override;
+
+        // renders every queued statement for the write-ahead journal; returns
+        // false if any statement cannot be represented as plain SQL
+        bool FormatSqlStatements(Database& db, std::vector<std::string>& out) const;
+        // attaches the journal record this transaction has to confirm once
+        // its database commit (or terminal failure) is known
+        void SetJournal(SqlJournal* journal, uint64 sequence) { m_journal = journal; m_journalSequence = sequence; }
+        void ConfirmJournal();
+
+        // merges several queued transactions into a single multi-statement commit;
+        // if any statement fails the batch is rolled back and each transaction is
+        // re-run on its own, so one bad transaction cannot discard the others
+        static void ExecuteCoalesced(SqlConnection* conn, std::vector<std::unique_ptr<SqlOperation>>& transactions);
+
+    private:
+        // runs the queued statements on an already open transaction
+        bool ExecuteStatements(SqlConnection* conn);
 };
 
 class SqlPreparedRequest : public SqlOperation
@@ -75,6 +103,7 @@ class SqlPreparedRequest : public SqlOperation
         ~SqlPreparedRequest();
 
         bool Execute(SqlConnection* conn) override;
+        bool FormatSql(Database& db, std::string& out) const override;
 
     private:
         const int m_nIndex;
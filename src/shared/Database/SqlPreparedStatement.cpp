@@ -134,6 +134,11 @@ bool SqlPlainPreparedStatement::execute()
 }
 
 void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const
+{
+    DataToString(m_pConn.DB(), data, fmt);
+}
+
+void SqlPlainPreparedStatement::DataToString(Database& db, const SqlStmtFieldData& data, std::ostringstream& fmt)
 {
     switch (data.type())
     {
@@ -151,7 +156,7 @@ void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::
         case FIELD_STRING:
         {
             std::string tmp = data.toStr();
-            m_pConn.DB().escape_string(tmp);
+            db.escape_string(tmp);
             fmt << "'" << tmp << "'";
             break;
         }
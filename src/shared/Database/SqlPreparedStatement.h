@@ -254,6 +254,43 @@ class SqlStatement
         void addString(const std::string& var) { arg(var.c_str()); }
         void addString(std::ostringstream& ss) { arg(ss.str().c_str()); ss.str(std::string()); }
 
+        // FNV-1a hash of all currently bound parameters - lets callers skip
+        // re-executing a statement whose values did not change since the last
+        // run; skipParams lists parameter indexes to leave out of the hash
+        uint32 CalculateBoundHash(std::initializer_list<uint32> skipParams = {}) const
+        {
+            uint32 hash = 0x811C9DC5;
+            auto feed = [&hash](void const* data, size_t size)
+            {
+                unsigned char const* bytes = static_cast<unsigned char const*>(data);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    hash ^= bytes[i];
+                    hash *= 0x01000193;
+                }
+            };
+
+            if (!m_pParams)
+                return hash;
+
+            uint32 index = 0;
+            for (SqlStmtFieldData const& param : m_pParams->params())
+            {
+                bool skip = false;
+                for (uint32 skipIndex : skipParams)
+                    if (skipIndex == index)
+                        skip = true;
+                ++index;
+                if (skip)
+                    continue;
+
+                uint8 type = uint8(param.type());
+                feed(&type, sizeof(type));
+                feed(param.buff(), param.size());
+            }
+            return hash;
+        }
+
     protected:
         // don't allow anyone except Database class to create static SqlStatement objects
         friend class Database;
@@ -340,6 +377,10 @@ class SqlPlainPreparedStatement : public SqlPreparedStatement
 
         virtual bool execute() override;
 
+        // renders one bound value in the literal form plain requests use;
+        // shared with the write-ahead journal statement formatter
+        static void DataToString(Database& db, const SqlStmtFieldData& data, std::ostringstream& fmt);
+
     protected:
         void DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const;
 
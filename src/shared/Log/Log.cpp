@@ -70,7 +70,9 @@ const int LogType_count = int(LogError) + 1;
 
 Log::Log() :
     raLogfile(nullptr), logfile(nullptr), gmLogfile(nullptr), charLogfile(nullptr), dberLogfile(nullptr),
-    eventAiErLogfile(nullptr), scriptErrLogFile(nullptr), worldLogfile(nullptr), customLogFile(nullptr), m_colored(false), m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(nullptr)
+    eventAiErLogfile(nullptr), scriptErrLogFile(nullptr), worldLogfile(nullptr), customLogFile(nullptr),
+    m_async(false), m_asyncStop(false), m_asyncPending(0), m_asyncDropped(0),
+    m_colored(false), m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(nullptr)
 {
     Initialize();
 }
@@ -287,6 +289,11 @@ void Log::Initialize()
 
     // Char log settings
     m_charLog_Dump = sConfig.GetBoolDefault("CharLogDump", false);
+
+    // Async log settings
+    m_async = sConfig.GetBoolDefault("LogAsync", false);
+    if (m_async && !m_asyncWriter.joinable())
+        m_asyncWriter = std::thread(&Log::asyncWriterLoop, this);
 }
 
 FILE* Log::openLogFile(char const* configFileName, char const* configTimeStampFlag, char const* mode)
@@ -360,6 +367,108 @@ std::string Log::GetTimestampStr()
     return std::string(buf);
 }
 
+// upper bound of queued messages before the overload policy drops new ones
+static const int ASYNC_QUEUE_LIMIT = 8192;
+// single message size limit on the async path; longer output is truncated
+static const size_t ASYNC_MESSAGE_SIZE = 4096;
+
+bool Log::queueAsyncMessage(char const* format, va_list ap, LogLevel level)
+{
+    if (m_asyncPending.load(std::memory_order_relaxed) >= ASYNC_QUEUE_LIMIT)
+    {
+        // overloaded: drop and count, the writer reports the total later
+        m_asyncDropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    char buffer[ASYNC_MESSAGE_SIZE];
+    va_list copy;
+    va_copy(copy, ap);
+    int length = vsnprintf(buffer, sizeof(buffer), format, copy);
+    va_end(copy);
+    if (length < 0)
+        return false;                                       // formatting failed, let the caller use the synchronous path
+
+    std::unique_ptr<AsyncMessage> message(new AsyncMessage());
+    message->text.assign(buffer, std::min(size_t(length), sizeof(buffer) - 1));
+    message->level = level;
+
+    m_asyncPending.fetch_add(1, std::memory_order_relaxed);
+    m_asyncQueue.Enqueue(std::move(message));
+    return true;
+}
+
+void Log::writeAsyncMessage(AsyncMessage const& message)
+{
+    // serializes against the synchronous paths (errors, fatal output)
+    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+
+    if (message.level == LOG_LVL_MINIMAL || m_logLevel >= message.level)
+    {
+        if (m_colored)
+            SetColor(true, m_colors[message.level == LOG_LVL_MINIMAL ? LogNormal : (message.level == LOG_LVL_DEBUG ? LogDebug : LogDetails)]);
+
+        if (m_includeTime)
+            outTime();
+
+        utf8printf(stdout, "%s", message.text.c_str());
+
+        if (m_colored)
+            ResetColor(true);
+
+        printf("\n");
+        fflush(stdout);
+    }
+
+    if (logfile && (message.level == LOG_LVL_MINIMAL || m_logFileLevel >= message.level))
+    {
+        outTimestamp(logfile);
+        fprintf(logfile, "%s\n", message.text.c_str());
+        fflush(logfile);
+    }
+}
+
+void Log::asyncWriterLoop()
+{
+    while (true)
+    {
+        bool idle = true;
+
+        std::unique_ptr<AsyncMessage> message;
+        while (m_asyncQueue.Dequeue(message))
+        {
+            idle = false;
+            m_asyncPending.fetch_sub(1, std::memory_order_relaxed);
+            writeAsyncMessage(*message);
+        }
+
+        if (uint32 dropped = m_asyncDropped.exchange(0, std::memory_order_relaxed))
+        {
+            AsyncMessage note;
+            note.text = "Log: dropped " + std::to_string(dropped) + " queued messages under load";
+            note.level = LOG_LVL_MINIMAL;
+            writeAsyncMessage(note);
+        }
+
+        if (idle)
+        {
+            if (m_asyncStop.load(std::memory_order_acquire))
+                return;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+}
+
+void Log::stopAsyncWriter()
+{
+    if (!m_asyncWriter.joinable())
+        return;
+
+    m_asyncStop.store(true, std::memory_order_release);
+    m_asyncWriter.join();
+}
+
 void Log::outString()
 {
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
@@ -381,6 +490,16 @@ void Log::outString(const char* str, ...)
     if (!str)
         return;
 
+    if (m_async)
+    {
+        va_list ap;
+        va_start(ap, str);
+        bool queued = queueAsyncMessage(str, ap, LOG_LVL_MINIMAL);
+        va_end(ap);
+        if (queued)
+            return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (m_colored)
@@ -616,6 +735,16 @@ void Log::outBasic(const char* str, ...)
     if (!str)
         return;
 
+    if (m_async)
+    {
+        va_list ap;
+        va_start(ap, str);
+        bool queued = queueAsyncMessage(str, ap, LOG_LVL_BASIC);
+        va_end(ap);
+        if (queued)
+            return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_BASIC)
     {
@@ -655,6 +784,16 @@ void Log::outDetail(const char* str, ...)
     if (!str)
         return;
 
+    if (m_async)
+    {
+        va_list ap;
+        va_start(ap, str);
+        bool queued = queueAsyncMessage(str, ap, LOG_LVL_DETAIL);
+        va_end(ap);
+        if (queued)
+            return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
@@ -696,6 +835,16 @@ void Log::outDebug(const char* str, ...)
     if (!str)
         return;
 
+    if (m_async)
+    {
+        va_list ap;
+        va_start(ap, str);
+        bool queued = queueAsyncMessage(str, ap, LOG_LVL_DEBUG);
+        va_end(ap);
+        if (queued)
+            return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_DEBUG)
     {
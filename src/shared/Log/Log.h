@@ -21,8 +21,12 @@
 
 #include "Common.h"
 #include "Policies/Singleton.h"
+#include "Util/MPSCQueue.h"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <thread>
 
 class Config;
 class ByteBuffer;
@@ -100,6 +104,8 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
 
         ~Log()
         {
+            stopAsyncWriter();
+
             if (logfile != nullptr)
                 fclose(logfile);
             logfile = nullptr;
@@ -198,6 +204,20 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
         FILE* openLogFile(char const* configFileName, char const* configTimeStampFlag, char const* mode);
         FILE* openGmlogPerAccount(uint32 account);
 
+        // asynchronous output (Log.Async): informational messages are
+        // formatted at the call site and queued, a dedicated writer thread
+        // does the console/file I/O; errors always write synchronously
+        struct AsyncMessage
+        {
+            std::string text;
+            LogLevel level;
+        };
+
+        bool queueAsyncMessage(char const* format, va_list ap, LogLevel level);
+        void writeAsyncMessage(AsyncMessage const& message);
+        void asyncWriterLoop();
+        void stopAsyncWriter();
+
         FILE* raLogfile;
         FILE* logfile;
         FILE* gmLogfile;
@@ -211,6 +231,14 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
         std::mutex m_worldLogMtx;
         std::mutex m_traceLogMtx;
 
+        // async log control
+        bool m_async;
+        std::thread m_asyncWriter;
+        std::atomic<bool> m_asyncStop;
+        MPSCQueue<std::unique_ptr<AsyncMessage>> m_asyncQueue;
+        std::atomic<int32> m_asyncPending;
+        std::atomic<uint32> m_asyncDropped;
+
         // log/console control
         LogLevel m_logLevel;
         LogLevel m_logFileLevel;
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Metric/FrameProfiler.h"
+
+#ifdef BUILD_METRICS
+ #include "Metric/Metric.h"
+#endif
+
+namespace
+{
+    // stack of full scope paths for the current thread
+    thread_local std::vector<std::string> t_scopeStack;
+}
+
+metric::FrameProfiler& metric::FrameProfiler::instance()
+{
+    static FrameProfiler instance;
+    return instance;
+}
+
+void metric::FrameProfiler::BeginTick()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_current.clear();
+    m_tickStart = std::chrono::steady_clock::now();
+}
+
+void metric::FrameProfiler::EndTick()
+{
+    auto const now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    uint64 const total = std::chrono::duration_cast<std::chrono::microseconds>(now - m_tickStart).count();
+
+#ifdef BUILD_METRICS
+    for (auto const& entry : m_current)
+        metric::instance().report("world.profile",
+            { { "duration", static_cast<int64>(entry.second.micros) }, { "count", static_cast<int64>(entry.second.count) } },
+            { { "path", entry.first } });
+#endif
+
+    // keep the heaviest tick around for ".server profile"; age it out after a
+    // minute so the dump reflects a recent spike, not one from last night
+    if (total >= m_worstTotal || (now - m_worstTime) > std::chrono::minutes(1))
+    {
+        m_worst = m_current;
+        m_worstTotal = total;
+        m_worstTime = now;
+    }
+}
+
+void metric::FrameProfiler::Record(std::string const& path, uint64 micros)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    PathTotal& total = m_current[path];
+    total.micros += micros;
+    ++total.count;
+}
+
+std::vector<std::string> metric::FrameProfiler::DumpWorstTick()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    std::vector<std::string> lines;
+    lines.reserve(m_worst.size() + 1);
+    lines.push_back("tick " + std::to_string(m_worstTotal));
+    for (auto const& entry : m_worst)
+        lines.push_back(entry.first + " " + std::to_string(entry.second.micros));
+
+    return lines;
+}
+
+metric::FrameScope::FrameScope(std::string name) : m_start(std::chrono::steady_clock::now())
+{
+    if (t_scopeStack.empty())
+        t_scopeStack.push_back(std::move(name));
+    else
+        t_scopeStack.push_back(t_scopeStack.back() + ";" + name);
+}
+
+metric::FrameScope::~FrameScope()
+{
+    uint64 const micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+    FrameProfiler::instance().Record(t_scopeStack.back(), micros);
+    t_scopeStack.pop_back();
+}
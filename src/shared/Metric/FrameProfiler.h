@@ -0,0 +1,86 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOSSERVER_FRAMEPROFILER_H
+#define MANGOSSERVER_FRAMEPROFILER_H
+
+#include "Common.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace metric
+{
+    /**
+     * Hierarchical profiler for the world tick's internals.
+     *
+     * FrameScope instances around the phases of World::Update, Map::Update and
+     * the session and DB flush blocks record their wall time under a
+     * semicolon-joined path built from the enclosing scopes on the same thread
+     * (map updates running on worker threads start their own root). EndTick()
+     * aggregates one world tick's samples, ships them through the metric
+     * pipeline when that is enabled, and keeps a snapshot of the worst recent
+     * tick that ".server profile" dumps as a flame-graph collapsed stack.
+     */
+    class FrameProfiler
+    {
+        public:
+            static FrameProfiler& instance();
+
+            void BeginTick();
+            void EndTick();
+
+            // records one finished scope - called from ~FrameScope
+            void Record(std::string const& path, uint64 micros);
+
+            // worst recent tick as flamegraph collapsed-stack lines ("a;b;c <micros>")
+            std::vector<std::string> DumpWorstTick();
+
+        private:
+            struct PathTotal
+            {
+                uint64 micros = 0;
+                uint32 count = 0;
+            };
+
+            std::mutex m_lock;
+            std::map<std::string, PathTotal> m_current;
+            std::chrono::steady_clock::time_point m_tickStart;
+
+            // worst tick seen recently - a heavier tick or one minute of age replaces it
+            std::map<std::string, PathTotal> m_worst;
+            uint64 m_worstTotal = 0;
+            std::chrono::steady_clock::time_point m_worstTime;
+    };
+
+    // scoped timer around one phase of a tick; nests under enclosing scopes on the same thread
+    class FrameScope
+    {
+        public:
+            explicit FrameScope(std::string name);
+            ~FrameScope();
+
+        private:
+            std::chrono::steady_clock::time_point m_start;
+    };
+}
+
+#endif
@@ -25,6 +25,11 @@
 #include "boost/lexical_cast.hpp"
 #include "Log/Log.h"
 
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace MaNGOS
 {
     // this socket is different in that it does not block on reads
@@ -40,6 +45,15 @@ namespace MaNGOS
             void ReadSkip(size_t skipSize, std::function<void(const boost::system::error_code&, std::size_t)>&& callback);
             void Write(const char* buffer, size_t length, std::function<void(const boost::system::error_code&, std::size_t)>&& callback);
 
+            // queue a refcounted immutable buffer for sending: buffers that
+            // accumulate while a write is in flight go out together as one
+            // gathered async_write, so a burst of packets to one session costs
+            // a single syscall
+            void QueueWrite(std::shared_ptr<std::vector<char> const> const& buffer);
+            // queue a per-session header and a (possibly shared) payload as one
+            // unit, so no flush can slip between them
+            void QueueWrite(std::shared_ptr<std::vector<char> const> const& header, std::shared_ptr<std::vector<char> const> const& payload);
+
             bool Start();
             void Close()
             {
@@ -64,8 +78,15 @@ namespace MaNGOS
             virtual bool ProcessIncomingData() = 0;
             virtual bool OnOpen() = 0;
 
+            void FlushWriteQueue();                         // caller must hold m_writeMutex with no write in flight
+
             boost::asio::ip::tcp::socket m_socket;
 
+            std::mutex m_writeMutex;
+            std::deque<std::shared_ptr<std::vector<char> const>> m_writeQueue;
+            std::vector<std::shared_ptr<std::vector<char> const>> m_writeInFlight;
+            bool m_writing = false;
+
             std::mutex m_closeMutex;
             std::string m_address;
             std::string m_remoteEndpoint;
@@ -114,6 +135,54 @@ namespace MaNGOS
         boost::asio::async_write(m_socket, boost::asio::buffer(buffer, length), callback);
     }
 
+    template <typename SocketType>
+    void MaNGOS::AsyncSocket<SocketType>::QueueWrite(std::shared_ptr<std::vector<char> const> const& buffer)
+    {
+        std::lock_guard<std::mutex> guard(m_writeMutex);
+        m_writeQueue.push_back(buffer);
+        if (!m_writing)
+        {
+            m_writing = true;
+            FlushWriteQueue();
+        }
+    }
+
+    template <typename SocketType>
+    void MaNGOS::AsyncSocket<SocketType>::QueueWrite(std::shared_ptr<std::vector<char> const> const& header, std::shared_ptr<std::vector<char> const> const& payload)
+    {
+        std::lock_guard<std::mutex> guard(m_writeMutex);
+        m_writeQueue.push_back(header);
+        m_writeQueue.push_back(payload);
+        if (!m_writing)
+        {
+            m_writing = true;
+            FlushWriteQueue();
+        }
+    }
+
+    template <typename SocketType>
+    void MaNGOS::AsyncSocket<SocketType>::FlushWriteQueue()
+    {
+        m_writeInFlight.assign(m_writeQueue.begin(), m_writeQueue.end());
+        m_writeQueue.clear();
+
+        std::vector<boost::asio::const_buffer> buffers;
+        buffers.reserve(m_writeInFlight.size());
+        for (auto const& buffer : m_writeInFlight)
+            buffers.push_back(boost::asio::buffer(buffer->data(), buffer->size()));
+
+        auto self(this->shared_from_this());
+        boost::asio::async_write(m_socket, buffers, [self](const boost::system::error_code& error, std::size_t /*written*/)
+        {
+            std::lock_guard<std::mutex> guard(self->m_writeMutex);
+            self->m_writeInFlight.clear();
+            if (error || self->m_writeQueue.empty())
+                self->m_writing = false;
+            else
+                self->FlushWriteQueue();
+        });
+    }
+
     template <typename SocketType>
     bool MaNGOS::AsyncSocket<SocketType>::AsyncSocket::Start()
     {
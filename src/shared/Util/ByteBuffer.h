@@ -46,6 +46,71 @@ struct Unused
     Unused() {}
 };
 
+// small-buffer storage for packet payloads: packets up to INLINE_CAPACITY
+// bytes - the vast majority - live entirely inside the buffer object and
+// never touch the heap. reserve() while inline only records a hint, so the
+// default reservation of packet constructors costs nothing; when a write
+// outgrows the inline space, the single heap allocation is sized to the
+// hint, so builders that pass an exact packet size never reallocate.
+class ByteStorage
+{
+    public:
+        static constexpr size_t INLINE_CAPACITY = 128;
+
+        ByteStorage() : m_size(0), m_reserveHint(0), m_onHeap(false) {}
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        uint8* data() { return m_onHeap ? m_heap.data() : m_inline; }
+        uint8 const* data() const { return m_onHeap ? m_heap.data() : m_inline; }
+
+        uint8& operator[](size_t pos) { return data()[pos]; }
+        uint8 const& operator[](size_t pos) const { return data()[pos]; }
+
+        void clear()
+        {
+            if (m_onHeap)
+                m_heap.clear();
+            m_size = 0;
+        }
+
+        void reserve(size_t n)
+        {
+            if (m_onHeap)
+                m_heap.reserve(n);
+            else if (n > INLINE_CAPACITY)
+                m_reserveHint = n;                          // defer the allocation until a write needs it
+        }
+
+        void resize(size_t n)
+        {
+            if (!m_onHeap && n > INLINE_CAPACITY)
+                MoveToHeap(n);
+
+            if (m_onHeap)
+                m_heap.resize(n);
+            else if (n > m_size)
+                memset(m_inline + m_size, 0, n - m_size);   // match vector value initialization
+
+            m_size = n;
+        }
+
+    private:
+        void MoveToHeap(size_t needed)
+        {
+            m_heap.reserve(std::max(needed, std::max(m_reserveHint, INLINE_CAPACITY * 2)));
+            m_heap.assign(m_inline, m_inline + m_size);
+            m_onHeap = true;
+        }
+
+        uint8 m_inline[INLINE_CAPACITY];
+        std::vector<uint8> m_heap;
+        size_t m_size;
+        size_t m_reserveHint;                               // reserve() request received while still inline
+        bool m_onHeap;
+};
+
 class ByteBuffer
 {
     public:
@@ -467,7 +532,7 @@ class ByteBuffer
         }
 
         size_t _rpos, _wpos;
-        std::vector<uint8> _storage;
+        ByteStorage _storage;
 
         static constexpr size_t s_defaultSize = 0x1000;
 };
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_FLATMULTIMAP_H
+#define MANGOS_FLATMULTIMAP_H
+
+#include "Platform/Define.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Drop-in replacement for a load-once, read-many std::multimap: all entries
+ * live in one contiguous vector sorted by key, with a per-key offset index
+ * built once after loading. equal_range becomes a single hash lookup
+ * returning a cache-friendly span instead of a tree walk, which is what the
+ * hot per-key scans (trainer lists, spell learning cascades) iterate.
+ *
+ * Usage contract: insert() during loading, finalize() once after the last
+ * insert, lookups only after that. finalize() keeps the insertion order of
+ * entries sharing a key, matching multimap semantics. Iterators are plain
+ * vector iterators and value_type is the familiar (key, value) pair, so
+ * existing multimap iteration code compiles unchanged.
+ */
+template <typename Key, typename Value>
+class FlatMultiMap
+{
+    public:
+        typedef std::pair<Key, Value> value_type;
+        typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+        void clear()
+        {
+            m_data.clear();
+            m_index.clear();
+        }
+
+        // invalidates the index until the next finalize()
+        void insert(value_type const& value) { m_data.push_back(value); }
+
+        // sort and rebuild the offset index; must run after the last insert
+        // and before the first lookup
+        void finalize()
+        {
+            std::stable_sort(m_data.begin(), m_data.end(), [](value_type const& a, value_type const& b) { return a.first < b.first; });
+
+            m_index.clear();
+            m_index.reserve(m_data.size());
+            for (uint32 i = 0; i < m_data.size(); ++i)
+            {
+                auto itr = m_index.try_emplace(m_data[i].first, std::make_pair(i, i)).first;
+                itr->second.second = i + 1;
+            }
+        }
+
+        const_iterator begin() const { return m_data.begin(); }
+        const_iterator end() const { return m_data.end(); }
+        bool empty() const { return m_data.empty(); }
+        size_t size() const { return m_data.size(); }
+
+        std::pair<const_iterator, const_iterator> equal_range(Key key) const
+        {
+            auto itr = m_index.find(key);
+            if (itr == m_index.end())
+                return { m_data.end(), m_data.end() };
+            return { m_data.begin() + itr->second.first, m_data.begin() + itr->second.second };
+        }
+
+        const_iterator find(Key key) const
+        {
+            auto itr = m_index.find(key);
+            return itr != m_index.end() ? m_data.begin() + itr->second.first : m_data.end();
+        }
+
+        const_iterator lower_bound(Key key) const { return equal_range(key).first; }
+        const_iterator upper_bound(Key key) const { return equal_range(key).second; }
+
+    private:
+        std::vector<value_type> m_data;
+        std::unordered_map<Key, std::pair<uint32, uint32>> m_index;
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_MPSCQUEUE_H
+#define MANGOS_MPSCQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+/**
+ * Unbounded lock-free multi-producer single-consumer queue (Vyukov style).
+ *
+ * Any number of threads may Enqueue concurrently; exactly one thread owns the
+ * consuming side and may call Dequeue. Producers never block and never touch
+ * a mutex - an enqueue is one allocation plus one atomic exchange.
+ */
+template <typename T>
+class MPSCQueue
+{
+    public:
+        MPSCQueue() : m_head(new Node()), m_tail(m_head.load(std::memory_order_relaxed)) {}
+        MPSCQueue(MPSCQueue const&) = delete;
+        MPSCQueue& operator=(MPSCQueue const&) = delete;
+
+        ~MPSCQueue()
+        {
+            T value;
+            while (Dequeue(value)) {}
+            delete m_tail;
+        }
+
+        void Enqueue(T value)
+        {
+            Node* node = new Node(std::move(value));
+            Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+        }
+
+        // consumer thread only
+        bool Dequeue(T& value)
+        {
+            Node* tail = m_tail;
+            Node* next = tail->next.load(std::memory_order_acquire);
+            if (!next)
+                return false;
+
+            value = std::move(next->value);
+            m_tail = next;
+            delete tail;
+            return true;
+        }
+
+    private:
+        struct Node
+        {
+            Node() : next(nullptr), value() {}
+            explicit Node(T v) : next(nullptr), value(std::move(v)) {}
+
+            std::atomic<Node*> next;
+            T value;
+        };
+
+        std::atomic<Node*> m_head;                          // producers push here
+        Node* m_tail;                                       // consumer pops here (stub node)
+};
+
+#endif
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_TICKARENA_H
+#define MANGOS_TICKARENA_H
+
+#include "Platform/Define.h"
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace MaNGOS
+{
+    /**
+     * Thread-local bump arena backing short-lived search containers.
+     *
+     * Grid searchers fill result lists that live for microseconds, yet every
+     * node goes through the global allocator. Containers using TickAllocator
+     * draw from this arena instead: allocation is a pointer bump, deallocate
+     * is a no-op and the whole arena is reclaimed by Reset once the owning
+     * thread finished its update slice (see MapUpdater::WorkerThread and
+     * MapManager::Update).
+     *
+     * Only use it for containers that are created and destroyed on the same
+     * thread before the next Reset - never for anything stored across ticks.
+     */
+    class TickArena
+    {
+        public:
+            static TickArena& Instance()
+            {
+                static thread_local TickArena instance;
+                return instance;
+            }
+
+            void* Allocate(size_t size, size_t alignment)
+            {
+                size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+                if (!m_blocks.empty() && offset + size <= m_blockSizes[m_current])
+                {
+                    void* ptr = m_blocks[m_current].get() + offset;
+                    m_offset = offset + size;
+                    return ptr;
+                }
+
+                // current block exhausted - move to the next one, growing the
+                // arena if the high-water mark of earlier ticks is exceeded
+                size_t needed = size + alignment;
+                while (m_current + 1 < m_blocks.size())
+                {
+                    ++m_current;
+                    m_offset = 0;
+                    if (needed <= m_blockSizes[m_current])
+                        return Allocate(size, alignment);
+                }
+
+                size_t blockSize = needed > DEFAULT_BLOCK_SIZE ? needed : DEFAULT_BLOCK_SIZE;
+                m_blocks.emplace_back(new char[blockSize]);
+                m_blockSizes.push_back(blockSize);
+                m_current = m_blocks.size() - 1;
+                m_offset = 0;
+                return Allocate(size, alignment);
+            }
+
+            // reclaims everything at once; blocks are kept for reuse so a
+            // steady-state tick does not touch the global allocator at all
+            void Reset()
+            {
+                m_current = 0;
+                m_offset = 0;
+            }
+
+        private:
+            TickArena() : m_current(0), m_offset(0) {}
+
+            static size_t const DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+            std::vector<std::unique_ptr<char[]>> m_blocks;
+            std::vector<size_t> m_blockSizes;
+            size_t m_current;
+            size_t m_offset;
+    };
+
+    template<typename T>
+    class TickAllocator
+    {
+        public:
+            typedef T value_type;
+
+            TickAllocator() = default;
+            template<typename U> TickAllocator(TickAllocator<U> const&) {}
+
+            T* allocate(size_t n)
+            {
+                return static_cast<T*>(TickArena::Instance().Allocate(n * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T*, size_t) {} // reclaimed wholesale by TickArena::Reset
+
+            bool operator==(TickAllocator const&) const { return true; }
+            bool operator!=(TickAllocator const&) const { return false; }
+    };
+
+    template<typename T> using TickList = std::list<T, TickAllocator<T>>;
+    template<typename T> using TickVector = std::vector<T, TickAllocator<T>>;
+}
+
+#endif
@@ -2,6 +2,6 @@
 #define __REVISION_SQL_H__
  #define REVISION_DB_REALMD "required_z2820_01_realmd_joindate_datetime"
  #define REVISION_DB_LOGS "required_z2778_01_logs_anticheat"
- #define REVISION_DB_CHARACTERS "required_z2819_01_characters_item_instance_text_id_fix"
+ #define REVISION_DB_CHARACTERS "required_z2820_01_characters_aura_blob"
  #define REVISION_DB_MANGOS "required_z2832_01_mangos_slamrock_spell"
 #endif // __REVISION_SQL_H__